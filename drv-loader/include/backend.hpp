@@ -0,0 +1,209 @@
+#pragma once
+
+#include "helpers.hpp"
+#include "lazy_loader_light.hpp"
+#include "platform.hpp"
+#include "simulated_kernel.hpp"
+#include "unique_resource.hpp"
+
+#include <cstdint>
+#include <vector>
+
+#include "ntstatus_codes.hpp"
+
+// service control backends: the registry and ntdll calls of a load/unload, selected at compile time
+//
+// a backend is a struct of static functions:
+//   typedef ... key_type;                                                     owned open registry key
+//   static LSTATUS open_key(const char* path, key_type& key);                 HKLM relative, creates missing parents
+//   static LSTATUS create_key(const key_type& parent, const char* name, key_type& key, bool& created);
+//   static LSTATUS set_values(const key_type& key, const registry_value_t* values, std::size_t count);  stops at the first failure
+//   static LSTATUS delete_tree(const key_type& parent, const char* name);     key and subkeys
+//   static LSTATUS delete_value(const key_type& key, const char* value);
+//   static LSTATUS query_value(const key_type& parent, const char* name, const char* value, DWORD& type, std::vector<std::uint8_t>& data);
+//   static NTSTATUS query_modules(std::vector<std::uint8_t>& buffer);         SystemModuleInformation, see modules.hpp
+//   static NTSTATUS load_driver(UNICODE_STRING* registry_path);               "\Registry\Machine\..." service key
+//   static NTSTATUS unload_driver(UNICODE_STRING* registry_path);
+//   static void yield(void);                                                  gives up the rest of the time slice
+
+namespace drv_loader {
+
+	typedef struct _UNICODE_STRING {
+		USHORT Length;
+		USHORT MaximumLength;
+		PWSTR  Buffer;
+	} UNICODE_STRING, * PUNICODE_STRING;
+
+	typedef struct _registry_value_t {
+		const char* name;
+		DWORD type;
+		const void* data;
+		DWORD size;
+	} registry_value_t, *pregistry_value_t;
+
+#if defined(_WIN32)
+	struct win32_backend {
+		typedef helpers::unique_hkey key_type;
+
+		// also enumerates and deletes, RegDeleteTreeA needs both on the parent of the deleted key
+		static LSTATUS open_key(const char* path, key_type& key) {
+			return ::RegCreateKeyExA(HKEY_LOCAL_MACHINE, path, NULL, nullptr, REG_OPTION_NON_VOLATILE, KEY_READ | KEY_WRITE | DELETE, nullptr, key.put(), nullptr);
+		}
+
+		static LSTATUS create_key(const key_type& parent, const char* name, key_type& key, bool& created) {
+			DWORD disposition = 0;
+
+			LSTATUS status = ::RegCreateKeyExA(parent.get(), name, NULL, nullptr, REG_OPTION_NON_VOLATILE, KEY_WRITE | KEY_QUERY_VALUE, nullptr, key.put(), &disposition);
+			created = disposition == REG_CREATED_NEW_KEY;
+
+			return status;
+		}
+
+		// the registry has no multiple value write, one RegSetValueExA per value
+		static LSTATUS set_values(const key_type& key, const registry_value_t* values, std::size_t count) {
+			for (std::size_t i = 0; i < count; ++i) {
+				LSTATUS status = ::RegSetValueExA(key.get(), values[i].name, NULL, values[i].type, static_cast<const BYTE*>(values[i].data), values[i].size);
+				if (status != ERROR_SUCCESS) {
+					return status;
+				}
+			}
+
+			return ERROR_SUCCESS;
+		}
+
+		static LSTATUS delete_tree(const key_type& parent, const char* name) {
+			return ::RegDeleteTreeA(parent.get(), name);
+		}
+
+		static LSTATUS delete_value(const key_type& key, const char* value) {
+			return ::RegDeleteValueA(key.get(), value);
+		}
+
+		static LSTATUS query_value(const key_type& parent, const char* name, const char* value, DWORD& type, std::vector<std::uint8_t>& data) {
+			DWORD size = 0;
+
+			LSTATUS status = ::RegGetValueA(parent.get(), name, value, RRF_RT_ANY | RRF_NOEXPAND, &type, nullptr, &size);
+			if (status != ERROR_SUCCESS) {
+				return status;
+			}
+
+			data.resize(size);
+			status = ::RegGetValueA(parent.get(), name, value, RRF_RT_ANY | RRF_NOEXPAND, &type, data.data(), &size);
+			data.resize(size);
+
+			return status;
+		}
+
+		// grows buffer until the list fits, it can change between two calls
+		static NTSTATUS query_modules(std::vector<std::uint8_t>& buffer) {
+			constexpr ULONG system_module_information = 11;
+
+			ULONG size = buffer.empty() ? 0x10000 : static_cast<ULONG>(buffer.size());
+
+			for (;;) {
+				ULONG required = 0;
+				buffer.resize(size);
+
+				NTSTATUS status = imports().query_system_information.call<NTSTATUS>(system_module_information, buffer.data(), size, &required);
+				if (status != STATUS_INFO_LENGTH_MISMATCH) {
+					return status;
+				}
+
+				size = required > size ? required : size * 2;
+			}
+		}
+
+		static NTSTATUS load_driver(UNICODE_STRING* registry_path) {
+			return imports().load_driver.call<NTSTATUS>(registry_path);
+		}
+
+		static NTSTATUS unload_driver(UNICODE_STRING* registry_path) {
+			return imports().unload_driver.call<NTSTATUS>(registry_path);
+		}
+
+		static void yield(void) {
+			imports().yield_execution.call<NTSTATUS>();
+		}
+
+		typedef struct _imports_t {
+			lazy_loader_light::lazyimport load_driver;
+			lazy_loader_light::lazyimport unload_driver;
+			lazy_loader_light::lazyimport yield_execution;
+			lazy_loader_light::lazyimport query_system_information;
+		} imports_t, *pimports_t;
+
+		// resolved together by the first caller, lazymodulecollection is not thread safe and batches call from a worker pool
+		static const imports_t& imports(void) {
+			static const imports_t imports = {
+				LAZYLOAD("ntdll.dll!NtLoadDriver"),
+				LAZYLOAD("ntdll.dll!NtUnloadDriver"),
+				LAZYLOAD("ntdll.dll!NtYieldExecution"),
+				LAZYLOAD("ntdll.dll!NtQuerySystemInformation"),
+			};
+
+			return imports;
+		}
+	};
+#endif
+
+	// simulated::kernel behind the same interface, runs anywhere
+	struct simulated_backend {
+		typedef simulated::unique_key key_type;
+
+		static LSTATUS open_key(const char* path, key_type& key) {
+			bool created = false;
+			return simulated::kernel::instance().create_key(simulated::root_key, path, *key.put(), created);
+		}
+
+		static LSTATUS create_key(const key_type& parent, const char* name, key_type& key, bool& created) {
+			return simulated::kernel::instance().create_key(parent.get(), name, *key.put(), created);
+		}
+
+		// all or nothing under the simulated kernel lock
+		static LSTATUS set_values(const key_type& key, const registry_value_t* values, std::size_t count) {
+			return simulated::kernel::instance().set_values(key.get(), values, count);
+		}
+
+		static LSTATUS delete_tree(const key_type& parent, const char* name) {
+			return simulated::kernel::instance().delete_tree(parent.get(), name);
+		}
+
+		static LSTATUS delete_value(const key_type& key, const char* value) {
+			return simulated::kernel::instance().delete_value(key.get(), value);
+		}
+
+		static LSTATUS query_value(const key_type& parent, const char* name, const char* value, DWORD& type, std::vector<std::uint8_t>& data) {
+			simulated::value_t out;
+
+			LSTATUS status = simulated::kernel::instance().query_value(parent.get(), name, value, out);
+			if (status == ERROR_SUCCESS) {
+				type = out.type;
+				data = std::move(out.data);
+			}
+
+			return status;
+		}
+
+		static NTSTATUS query_modules(std::vector<std::uint8_t>& buffer) {
+			return simulated::kernel::instance().query_modules(buffer);
+		}
+
+		static NTSTATUS load_driver(UNICODE_STRING* registry_path) {
+			return simulated::kernel::instance().load_driver(registry_path->Buffer, registry_path->Length / sizeof(wchar_t));
+		}
+
+		static NTSTATUS unload_driver(UNICODE_STRING* registry_path) {
+			return simulated::kernel::instance().unload_driver(registry_path->Buffer, registry_path->Length / sizeof(wchar_t));
+		}
+
+		static void yield(void) {
+			std::this_thread::yield();
+		}
+	};
+
+#if defined(_WIN32)
+	typedef win32_backend default_backend;
+#else
+	typedef simulated_backend default_backend;
+#endif
+}
@@ -0,0 +1,98 @@
+#pragma once
+
+#include <cstdint>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define CPU_FEATURES_X86 1
+#endif
+
+#if defined(CPU_FEATURES_X86)
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#include <immintrin.h>
+#endif
+
+// msvc accepts any intrinsic in any function, gcc and clang need the instruction set enabled per function
+#if defined(_MSC_VER) && !defined(__clang__)
+#define CPU_FEATURES_TARGET_SSSE3
+#define CPU_FEATURES_TARGET_AVX2
+#else
+#define CPU_FEATURES_TARGET_SSSE3 __attribute__((target("ssse3")))
+#define CPU_FEATURES_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+
+namespace cpu_features {
+
+	typedef struct _features_t {
+		bool sse2;
+		bool ssse3;
+		bool avx2;
+	} features_t, *pfeatures_t;
+
+#if defined(CPU_FEATURES_X86)
+	static void cpuid(std::uint32_t leaf, std::uint32_t subleaf, std::uint32_t regs[4]) {
+#if defined(_MSC_VER)
+		int info[4] = {};
+		::__cpuidex(info, static_cast<int>(leaf), static_cast<int>(subleaf));
+		for (int i = 0; i < 4; ++i) {
+			regs[i] = static_cast<std::uint32_t>(info[i]);
+		}
+#else
+		__cpuid_count(leaf, subleaf, regs[0], regs[1], regs[2], regs[3]);
+#endif
+	}
+
+	static std::uint64_t xgetbv(std::uint32_t index) {
+#if defined(_MSC_VER)
+		return ::_xgetbv(index);
+#else
+		std::uint32_t eax = 0, edx = 0;
+		__asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(index));
+		return (static_cast<std::uint64_t>(edx) << 32) | eax;
+#endif
+	}
+#endif
+
+	static features_t detect(void) {
+		features_t features = {};
+
+#if defined(CPU_FEATURES_X86)
+		std::uint32_t regs[4] = {};
+
+		cpuid(0, 0, regs);
+		std::uint32_t max_leaf = regs[0];
+
+		cpuid(1, 0, regs);
+		features.sse2 = (regs[3] & (1u << 26)) != 0;
+		features.ssse3 = (regs[2] & (1u << 9)) != 0;
+
+		// avx2 also needs the os to save ymm registers on context switch
+		bool os_saves_ymm = (regs[2] & (1u << 27)) != 0 && (regs[2] & (1u << 28)) != 0 && (xgetbv(0) & 0x6) == 0x6;
+
+		if (os_saves_ymm && max_leaf >= 7) {
+			cpuid(7, 0, regs);
+			features.avx2 = (regs[1] & (1u << 5)) != 0;
+		}
+#endif
+
+		return features;
+	}
+
+	static const features_t& get(void) {
+		static const features_t features = detect();
+		return features;
+	}
+
+	static std::uint32_t count_trailing_zeros(std::uint32_t value) {
+#if defined(_MSC_VER)
+		unsigned long index = 0;
+		::_BitScanForward(&index, value);
+		return static_cast<std::uint32_t>(index);
+#else
+		return static_cast<std::uint32_t>(__builtin_ctz(value));
+#endif
+	}
+}
@@ -1,155 +1,1132 @@
 #pragma once
 
+#include "backend.hpp"
 #include "helpers.hpp"
-#include "lazy_loader_light.hpp"
+#include "histogram.hpp"
+#include "metrics.hpp"
+#include "modules.hpp"
+#include "nt_status.hpp"
+#include "ntstatus_table.hpp"
+#include "ntstatus_win32.hpp"
+#include "pe.hpp"
+#include "platform.hpp"
+#include "retry.hpp"
+#include "trace.hpp"
+#include "win32_table.hpp"
 
-#include <filesystem>
+#include <charconv>
+#include <cstring>
+#include <vector>
 
-#define NOMINMAX
-#include <windows.h>
+#if defined(__linux__) || defined(__APPLE__)
+#include <sys/stat.h>
+#endif
 
-#include "ntstatus.hpp"
+#include "ntstatus_codes.hpp"
 
 namespace drv_loader {
 
-	typedef struct _UNICODE_STRING {
-		USHORT Length;
-		USHORT MaximumLength;
-		PWSTR  Buffer;
-	} UNICODE_STRING, * PUNICODE_STRING;
-
 	constexpr char prefix[] = "\\??\\";
+	constexpr char services_key[] = "System\\CurrentControlSet\\Services";
 	constexpr char registry_subkey[] = "System\\CurrentControlSet\\Services\\";
 	constexpr char registry_prefix[] = "\\Registry\\Machine\\";
+	constexpr char image_identity_value[] = "DrvLoaderImageIdentity";
+
+	// registry key names are limited to 255 characters
+	constexpr std::size_t max_key_name = 255;
+	constexpr std::size_t max_registry_path = (sizeof(registry_prefix) - 1) + (sizeof(registry_subkey) - 1) + max_key_name;
+
+	// UNICODE_STRING lengths are 16 bits byte counts
+	constexpr std::size_t max_image_path = 32767;
+
+	typedef helpers::fixed_string<char, max_image_path> image_path_t;
+	typedef helpers::fixed_string<char, max_registry_path> registry_path_t;
+	typedef helpers::fixed_string<wchar_t, max_registry_path> nt_registry_path_t;
 
 	typedef enum _loader_operation_t {
 		none,
 		load,
 		unload,
+		list, // loaded kernel modules
+		status, // whether one driver is loaded
 
 		// number of entries in enum
 		n_loader_operation
 	} loader_operation_t;
 
+	static const char* operation_name(loader_operation_t operation) {
+		constexpr const char* names[] = {
+			"none",
+			"load",
+			"unload",
+			"list",
+			"status",
+		};
+
+		return operation < n_loader_operation ? names[operation] : "unknown";
+	}
+
 	typedef struct _config_t {
 		std::string display_name;
 		std::string file_path;
 		loader_operation_t operation;
+		std::vector<std::uint32_t> tolerated_statuses; // NTSTATUS values reported as success, e.g. STATUS_IMAGE_ALREADY_LOADED
+		std::vector<std::string> depends_on; // display names, batch ordering only (see scheduler.hpp)
+		retry::policy_t retry; // NtLoadDriver/NtUnloadDriver retries, see retry.hpp
+		bool skip_if_loaded; // a load of the image that is already loaded does nothing, see is_loaded_image
+		bool check_image; // validate the driver file before loading it, see check_image
 	} config_t, *pconfig_t;
 
-	static std::uint32_t load_driver(const config_t& config) {
-		if (config.operation != loader_operation_t::load) {
-			return ERROR_INVALID_OPERATION;
+	// what an operation did besides succeeding or failing
+	typedef struct _report_t {
+		std::uint32_t retries; // NtLoadDriver/NtUnloadDriver calls retried under config.retry
+		bool unchanged; // load skipped, the same image is already loaded
+		pe::error_t image_error; // why check_image rejected the driver file
+	} report_t, *preport_t;
+
+	static bool is_tolerated(const config_t& config, nt::nt_status nt_status) {
+		for (std::uint32_t tolerated : config.tolerated_statuses) {
+			if (tolerated == nt_status.value()) {
+				return true;
+			}
 		}
 
-		std::filesystem::path path = config.file_path;
-		std::string ntpath = std::string(prefix) + std::filesystem::absolute(path).string();
+		return false;
+	}
 
-		std::string reg_path = std::string(registry_subkey) + config.display_name;
+	typedef enum _phase_t {
+		phase_load,
+		phase_unload,
+		phase_canonicalize_path,
+		phase_check_loaded,
+		phase_check_image,
+		phase_open_services_key,
+		phase_create_key,
+		phase_set_values,
+		phase_nt_load_driver,
+		phase_retry,
+		phase_nt_unload_driver,
+		phase_delete_key,
+		phase_rollback_key,
+		phase_query_modules,
+		phase_index_modules,
+		phase_find_module,
 
-		HKEY key_handle = nullptr;
-		LSTATUS status = ::RegCreateKeyExA(HKEY_LOCAL_MACHINE, reg_path.c_str(), NULL, nullptr, REG_OPTION_NON_VOLATILE, KEY_WRITE | KEY_QUERY_VALUE, nullptr, &key_handle, nullptr);
-		if (status != ERROR_SUCCESS) {
-			return status;
+		// number of entries in enum
+		n_phase
+	} phase_t;
+
+	static const char* phase_name(phase_t phase) {
+		constexpr const char* names[] = {
+			"load_driver",
+			"unload_driver",
+			"canonicalize_path",
+			"check_loaded",
+			"check_image",
+			"open_services_key",
+			"RegCreateKeyExA",
+			"RegSetValueExA",
+			"NtLoadDriver",
+			"retry",
+			"NtUnloadDriver",
+			"RegDeleteTreeA",
+			"rollback_key",
+			"NtQuerySystemInformation",
+			"index_modules",
+			"find_module",
+		};
+
+		return phase < n_phase ? names[phase] : "unknown";
+	}
+
+	typedef histogram::log_histogram<> phase_histogram_t;
+
+	// latency distribution of every phase, in nanoseconds, accumulated over the process lifetime
+	static phase_histogram_t& phase_histogram(phase_t phase) {
+		static phase_histogram_t histograms[n_phase];
+		return histograms[phase];
+	}
+
+	// measures one phase of a load or unload for as long as it is in scope, into its histogram and the trace when enabled
+	class phase_scope {
+		public:
+			explicit phase_scope(phase_t phase) : _phase(phase), _start(trace::now()) {}
+
+			phase_scope(const phase_scope&) = delete; // non copyable
+			phase_scope& operator= (const phase_scope&) = delete;
+
+			~phase_scope(void) {
+				std::uint64_t duration = trace::now() - _start;
+
+				phase_histogram(_phase).record(duration);
+
+				if (trace::enabled()) {
+					trace::record(phase_name(_phase), _start, duration);
+				}
+			}
+
+		private:
+			phase_t _phase;
+			std::uint64_t _start;
+	};
+
+	typedef enum _status_domain_t {
+		domain_none,
+		domain_win32,
+		domain_ntstatus,
+
+		// number of entries in enum
+		n_status_domain
+	} status_domain_t;
+
+	static const char* status_domain_name(status_domain_t domain) {
+		constexpr const char* names[] = {
+			"none",
+			"win32",
+			"ntstatus",
+		};
+
+		return domain < n_status_domain ? names[domain] : "unknown";
+	}
+
+	// outcome of an operation: which number space the code belongs to and the phase that produced it
+	typedef struct _loader_error_t {
+		status_domain_t domain; // domain_none on success
+		std::uint32_t code;
+		phase_t phase;
+
+		bool failed(void) const { return domain != domain_none; }
+	} loader_error_t, *ploader_error_t;
+
+	static loader_error_t success(void) {
+		return { domain_none, 0, n_phase };
+	}
+
+	static loader_error_t win32_error(phase_t phase, std::uint32_t code) {
+		return { domain_win32, code, phase };
+	}
+
+	static loader_error_t ntstatus_error(phase_t phase, nt::nt_status status) {
+		return { domain_ntstatus, status.value(), phase };
+	}
+
+	typedef enum _registry_api_t {
+		api_reg_create_key,
+		api_reg_set_value,
+		api_reg_delete_tree,
+		api_reg_get_value,
+		api_reg_delete_value,
+
+		// number of entries in enum
+		n_registry_api
+	} registry_api_t;
+
+	static const char* registry_api_name(registry_api_t api) {
+		constexpr const char* names[] = {
+			"RegCreateKeyExA",
+			"RegSetValueExA",
+			"RegDeleteTreeA",
+			"RegGetValueA",
+			"RegDeleteValueA",
+		};
+
+		return api < n_registry_api ? names[api] : "unknown";
+	}
+
+	typedef struct _loader_metrics_t {
+		metrics::counter loads;
+		metrics::counter unloads;
+		metrics::counter load_failures;
+		metrics::counter unload_failures;
+		metrics::counter load_retries;
+		metrics::counter unload_retries;
+		metrics::counter retries_exhausted;
+		metrics::counter unchanged_loads;
+		metrics::counter tolerated_failures;
+		metrics::counter key_rollbacks;
+		metrics::counter registry_failures[n_registry_api];
+		metrics::counter image_check_failures[pe::n_error];
+		metrics::code_counters<256> failures; // keyed by (status_domain_t, code)
+	} loader_metrics_t, *ploader_metrics_t;
+
+	static loader_metrics_t& loader_metrics(void) {
+		static loader_metrics_t metrics;
+		return metrics;
+	}
+
+	static loader_error_t registry_error(phase_t phase, registry_api_t api, LSTATUS status) {
+		loader_metrics().registry_failures[api].increment();
+		return win32_error(phase, static_cast<std::uint32_t>(status));
+	}
+
+	static bool write_metrics(const std::string& path, metrics::format_t format) {
+		std::FILE* file = std::fopen(path.c_str(), "wb");
+		if (file == nullptr) {
+			return false;
 		}
 
-		status = ::RegSetValueExA(key_handle, "ImagePath", NULL, REG_EXPAND_SZ, reinterpret_cast<const std::uint8_t*>(ntpath.c_str()), static_cast<std::uint32_t>(ntpath.size()));
-		if (status != ERROR_SUCCESS) {
-			return status;
+		const loader_metrics_t& counters = loader_metrics();
+		metrics::family_writer writer(file, format);
+
+		writer.family("drv_loader_loads", "Driver load operations.");
+		writer.sample(counters.loads.value());
+
+		writer.family("drv_loader_unloads", "Driver unload operations.");
+		writer.sample(counters.unloads.value());
+
+		writer.family("drv_loader_load_failures", "Driver load operations that failed.");
+		writer.sample(counters.load_failures.value());
+
+		writer.family("drv_loader_unload_failures", "Driver unload operations that failed.");
+		writer.sample(counters.unload_failures.value());
+
+		writer.family("drv_loader_load_retries", "NtLoadDriver calls retried after a retryable status.");
+		writer.sample(counters.load_retries.value());
+
+		writer.family("drv_loader_unload_retries", "NtUnloadDriver calls retried after a retryable status.");
+		writer.sample(counters.unload_retries.value());
+
+		writer.family("drv_loader_retries_exhausted", "Operations still failing with a retryable status when the retry policy ran out.");
+		writer.sample(counters.retries_exhausted.value());
+
+		writer.family("drv_loader_unchanged_loads", "Loads skipped because the same image was already loaded.");
+		writer.sample(counters.unchanged_loads.value());
+
+		writer.family("drv_loader_tolerated_failures", "NtLoadDriver/NtUnloadDriver failures reported as success through --tolerate.");
+		writer.sample(counters.tolerated_failures.value());
+
+		writer.family("drv_loader_key_rollbacks", "Service keys removed, or given back their previous values, after a failed load.");
+		writer.sample(counters.key_rollbacks.value());
+
+		writer.family("drv_loader_registry_failures", "Failed registry calls by API.");
+		for (std::size_t i = 0; i < n_registry_api; ++i) {
+			metrics::label_t label = { "api", registry_api_name(static_cast<registry_api_t>(i)) };
+			writer.sample(counters.registry_failures[i].value(), &label, 1);
 		}
 
-		constexpr std::uint32_t type = 1;
-		status = ::RegSetValueExA(key_handle, "Type", NULL, REG_DWORD, reinterpret_cast<const std::uint8_t*>(&type), sizeof(type));
-		if (status != ERROR_SUCCESS) {
-			return status;
+		writer.family("drv_loader_image_check_failures", "Driver files rejected by --check-image, by reason.");
+		for (std::size_t i = 1; i < pe::n_error; ++i) {
+			metrics::label_t label = { "reason", pe::error_name(static_cast<pe::error_t>(i)) };
+			writer.sample(counters.image_check_failures[i].value(), &label, 1);
 		}
 
-		constexpr std::uint32_t start = 3;
-		status = ::RegSetValueExA(key_handle, "Start", NULL, REG_DWORD, reinterpret_cast<const std::uint8_t*>(&start), sizeof(start));
-		if (status != ERROR_SUCCESS) {
-			return status;
+		writer.family("drv_loader_failures", "Failures by status code.");
+		counters.failures.for_each([&writer](std::uint32_t domain, std::uint32_t code, std::uint64_t count) {
+			char code_string[11] = "0x";
+			code_string[2 + hex::format_integer(code, code_string + 2, hex::uppercase | hex::zero_padded)] = '\0';
+
+			metrics::label_t labels[] = { { "domain", status_domain_name(static_cast<status_domain_t>(domain)) }, { "code", code_string } };
+			writer.sample(count, labels, 2);
+		});
+
+		writer.family("drv_loader_failures_overflow", "Failures missing from drv_loader_failures because every status code slot was taken.");
+		writer.sample(counters.failures.overflow());
+
+		writer.finish();
+
+		return std::fclose(file) == 0;
+	}
+
+	// "\??\<absolute file path>", returns the required length when it does not fit or helpers::npos on failure
+	static std::size_t build_image_path(const std::string& file_path, image_path_t& out) {
+		out.assign(prefix, sizeof(prefix) - 1);
+		return helpers::append_full_path(out, file_path.c_str());
+	}
+
+	// "\Registry\Machine\System\CurrentControlSet\Services\<display name>"
+	static std::size_t build_registry_path(const std::string& display_name, registry_path_t& out) {
+		out.assign(registry_prefix, sizeof(registry_prefix) - 1);
+		out.append(registry_subkey, sizeof(registry_subkey) - 1);
+
+		if (!out.append(display_name.c_str(), display_name.size())) {
+			return out.size() + display_name.size();
+		}
+
+		return out.size();
+	}
+
+	static std::uint32_t build_nt_registry_path(const std::string& display_name, registry_path_t& registry_path, nt_registry_path_t& nt_registry_path) {
+		if (build_registry_path(display_name, registry_path) > registry_path.capacity()) {
+			return ERROR_FILENAME_EXCED_RANGE;
+		}
+
+		nt_registry_path.clear();
+		std::size_t length = helpers::append_unicode(nt_registry_path, registry_path.c_str(), registry_path.size());
+		if (length == helpers::npos) {
+			return ERROR_NO_UNICODE_TRANSLATION;
+		}
+
+		if (length > nt_registry_path.capacity()) {
+			return ERROR_FILENAME_EXCED_RANGE;
 		}
 
-		constexpr std::uint32_t error_control = 1;
-		status = ::RegSetValueExA(key_handle, "ErrorControl", NULL, REG_DWORD, reinterpret_cast<const std::uint8_t*>(&error_control), sizeof(error_control));
+		return ERROR_SUCCESS;
+	}
+
+	// same as RtlInitUnicodeString, without the round trip through ntdll
+	static UNICODE_STRING make_unicode_string(nt_registry_path_t& path) {
+		UNICODE_STRING ustr = {};
+		ustr.Length = static_cast<USHORT>(path.size() * sizeof(wchar_t));
+		ustr.MaximumLength = static_cast<USHORT>((path.size() + 1) * sizeof(wchar_t));
+		ustr.Buffer = path.data();
+		return ustr;
+	}
+
+	// HKLM\System\CurrentControlSet\Services, opened once and shared by every operation of a batch
+	template <typename Backend = default_backend>
+	static loader_error_t open_services_key(typename Backend::key_type& key) {
+		phase_scope phase(phase_open_services_key);
+
+		LSTATUS status = Backend::open_key(services_key, key);
 		if (status != ERROR_SUCCESS) {
-			return status;
+			return registry_error(phase_open_services_key, api_reg_create_key, status);
+		}
+
+		return success();
+	}
+
+	// the values of a service key, staged then written through the backend in one set_values call, staged deletions after it
+	// when writing fails or when rollback() is called, a key created by write() is deleted again, and a key that already
+	// existed gets back the values it had: it is not residue of this load
+	template <typename Backend = default_backend>
+	class service_key_writer {
+		public:
+			static constexpr std::size_t max_values = 8;
+
+			explicit service_key_writer(const typename Backend::key_type& services) : _services(services) {}
+
+			service_key_writer(const service_key_writer&) = delete; // non copyable
+			service_key_writer& operator= (const service_key_writer&) = delete;
+
+			// strings are referenced and must outlive write()
+			bool stage_string(const char* name, DWORD type, const char* str, std::size_t length) {
+				if (_count == max_values) {
+					return false;
+				}
+
+				_values[_count++] = { name, type, str, static_cast<DWORD>(length) };
+				return true;
+			}
+
+			bool stage_binary(const char* name, const void* data, std::size_t size) {
+				if (_count == max_values) {
+					return false;
+				}
+
+				_values[_count++] = { name, REG_BINARY, data, static_cast<DWORD>(size) };
+				return true;
+			}
+
+			bool stage_dword(const char* name, std::uint32_t value) {
+				if (_count == max_values) {
+					return false;
+				}
+
+				_dwords[_count] = value;
+				_values[_count] = { name, REG_DWORD, &_dwords[_count], sizeof(std::uint32_t) };
+				++_count;
+
+				return true;
+			}
+
+			// removes the value from an existing key, nothing to do for a key write() creates
+			bool stage_delete(const char* name) {
+				if (_count == max_values) {
+					return false;
+				}
+
+				_deleted[_count] = true;
+				_values[_count++] = { name, REG_NONE, nullptr, 0 };
+				return true;
+			}
+
+			// creates (or opens) the key under services, writes every staged value and closes it
+			// the previous values of an existing key are saved first, for rollback()
+			loader_error_t write(const char* key_name) {
+				typename Backend::key_type key;
+				LSTATUS status = ERROR_SUCCESS;
+				registry_api_t api = api_reg_set_value;
+
+				_key_name = key_name;
+
+				{
+					phase_scope phase(phase_create_key);
+
+					status = Backend::create_key(_services, key_name, key, _created);
+					if (status != ERROR_SUCCESS) {
+						return registry_error(phase_create_key, api_reg_create_key, status);
+					}
+				}
+
+				{
+					phase_scope phase(phase_set_values);
+
+					if (!_created) {
+						status = save_previous_values();
+						if (status != ERROR_SUCCESS) {
+							return registry_error(phase_set_values, api_reg_get_value, status);
+						}
+					}
+
+					registry_value_t written[max_values] = {};
+					std::size_t written_count = 0;
+
+					for (std::size_t i = 0; i < _count; ++i) {
+						if (!_deleted[i]) {
+							written[written_count++] = _values[i];
+						}
+					}
+
+					status = Backend::set_values(key, written, written_count);
+
+					for (std::size_t i = 0; i < _count && status == ERROR_SUCCESS && !_created; ++i) {
+						if (_deleted[i]) {
+							LSTATUS delete_status = Backend::delete_value(key, _values[i].name);
+							if (delete_status != ERROR_SUCCESS && delete_status != ERROR_FILE_NOT_FOUND) {
+								status = delete_status;
+								api = api_reg_delete_value;
+							}
+						}
+					}
+				}
+
+				key.reset();
+
+				if (status != ERROR_SUCCESS) {
+					rollback();
+					return registry_error(phase_set_values, api, status);
+				}
+
+				return success();
+			}
+
+			// deletes the key if write() created it, or puts back the values it replaced in an existing key
+			// best effort: a failure is only counted
+			void rollback(void) {
+				if (!_created && !_saved) {
+					return;
+				}
+
+				phase_scope phase(phase_rollback_key);
+				loader_metrics().key_rollbacks.increment();
+
+				if (_created) {
+					_created = false;
+
+					LSTATUS status = Backend::delete_tree(_services, _key_name);
+					if (status != ERROR_SUCCESS) {
+						registry_error(phase_rollback_key, api_reg_delete_tree, status);
+					}
+
+					return;
+				}
+
+				_saved = false;
+				restore_previous_values();
+			}
+
+		private:
+			// per thread so the buffers keep their capacity from one load to the next
+			static std::vector<std::uint8_t>* saved_data(void) {
+				thread_local std::vector<std::uint8_t> data[max_values];
+				return data;
+			}
+
+			LSTATUS save_previous_values(void) {
+				std::vector<std::uint8_t>* data = saved_data();
+
+				for (std::size_t i = 0; i < _count; ++i) {
+					LSTATUS status = Backend::query_value(_services, _key_name, _values[i].name, _saved_types[i], data[i]);
+					if (status != ERROR_SUCCESS && status != ERROR_FILE_NOT_FOUND) {
+						return status;
+					}
+
+					_existed[i] = status == ERROR_SUCCESS;
+				}
+
+				_saved = true;
+				return ERROR_SUCCESS;
+			}
+
+			// values that did not exist are deleted, the others written back with their previous type and data
+			void restore_previous_values(void) {
+				typename Backend::key_type key;
+				bool created = false;
+
+				LSTATUS status = Backend::create_key(_services, _key_name, key, created);
+				if (status != ERROR_SUCCESS) {
+					registry_error(phase_rollback_key, api_reg_create_key, status);
+					return;
+				}
+
+				std::vector<std::uint8_t>* data = saved_data();
+				registry_value_t previous[max_values] = {};
+				std::size_t previous_count = 0;
+
+				for (std::size_t i = 0; i < _count; ++i) {
+					if (_existed[i]) {
+						previous[previous_count++] = { _values[i].name, _saved_types[i], data[i].data(), static_cast<DWORD>(data[i].size()) };
+						continue;
+					}
+
+					status = Backend::delete_value(key, _values[i].name);
+					if (status != ERROR_SUCCESS && status != ERROR_FILE_NOT_FOUND) {
+						registry_error(phase_rollback_key, api_reg_delete_value, status);
+					}
+				}
+
+				status = Backend::set_values(key, previous, previous_count);
+				if (status != ERROR_SUCCESS) {
+					registry_error(phase_rollback_key, api_reg_set_value, status);
+				}
+			}
+
+			const typename Backend::key_type& _services;
+			registry_value_t _values[max_values] = {};
+			std::uint32_t _dwords[max_values] = {};
+			bool _deleted[max_values] = {};
+			std::size_t _count = 0;
+			const char* _key_name = nullptr;
+			bool _created = false;
+			DWORD _saved_types[max_values] = {};
+			bool _existed[max_values] = {};
+			bool _saved = false;
+	};
+
+	// NtQuerySystemInformation(SystemModuleInformation) into blob, see modules.hpp
+	template <typename Backend = default_backend>
+	static loader_error_t query_modules(std::vector<std::uint8_t>& blob) {
+		phase_scope phase(phase_query_modules);
+
+		nt::nt_status status(Backend::query_modules(blob));
+		if (!status.is_success()) {
+			return ntstatus_error(phase_query_modules, status);
+		}
+
+		return success();
+	}
+
+	// index keeps views into blob
+	static loader_error_t index_modules(const std::vector<std::uint8_t>& blob, modules::module_index& index) {
+		phase_scope phase(phase_index_modules);
+
+		modules::module_list list;
+		if (!list.assign(blob.data(), blob.size())) {
+			return win32_error(phase_index_modules, ERROR_INVALID_DATA);
+		}
+
+		index.build(list);
+		return success();
+	}
+
+	// size and modification time of a driver file, recorded in its service key by loads with --skip-if-loaded
+	typedef struct _image_identity_t {
+		std::uint64_t size;
+		std::int64_t last_write; // FILETIME on windows, nanoseconds since the epoch elsewhere
+	} image_identity_t, *pimage_identity_t;
+
+	static bool image_identity(const char* file_path, image_identity_t& out) {
+#if defined(_WIN32)
+		WIN32_FILE_ATTRIBUTE_DATA data = {};
+		if (!::GetFileAttributesExA(file_path, GetFileExInfoStandard, &data)) {
+			return false;
+		}
+
+		out.size = (static_cast<std::uint64_t>(data.nFileSizeHigh) << 32) | data.nFileSizeLow;
+		out.last_write = static_cast<std::int64_t>((static_cast<std::uint64_t>(data.ftLastWriteTime.dwHighDateTime) << 32) | data.ftLastWriteTime.dwLowDateTime);
+#else
+		struct stat file_stat = {};
+		if (::stat(file_path, &file_stat) != 0) {
+			return false;
+		}
+
+#if defined(__APPLE__)
+		const struct timespec& last_write = file_stat.st_mtimespec;
+#else
+		const struct timespec& last_write = file_stat.st_mtim;
+#endif
+		out.size = static_cast<std::uint64_t>(file_stat.st_size);
+		out.last_write = static_cast<std::int64_t>(last_write.tv_sec) * 1000000000 + last_write.tv_nsec;
+#endif
+		return true;
+	}
+
+	// true when a loaded module has ntpath as path and the service key records the identity the file has now,
+	// i.e. this file was loaded under this service and has not been rebuilt since
+	// paths longer than FullPathName never match, such loads always go through NtLoadDriver
+	template <typename Backend = default_backend>
+	static bool is_loaded_image(const config_t& config, const typename Backend::key_type& services, const image_path_t& ntpath, const image_identity_t& identity) {
+		std::vector<std::uint8_t> blob;
+		modules::module_index index;
+
+		if (query_modules<Backend>(blob).failed() || index_modules(blob, index).failed()) {
+			return false;
+		}
+
+		std::string_view path(ntpath.c_str(), ntpath.size());
+		const modules::module_t* module = index.find(path.substr(path.find_last_of("\\/") + 1));
+
+		if (module == nullptr || !modules::equal_path(module->full_path, path)) {
+			return false;
 		}
 
-		status = ::RegSetValueExA(key_handle, "DisplayName", NULL, REG_SZ, reinterpret_cast<const std::uint8_t*>(config.display_name.c_str()), static_cast<std::uint32_t>(config.display_name.size()));
+		DWORD type = 0;
+		std::vector<std::uint8_t> recorded;
+
+		if (Backend::query_value(services, config.display_name.c_str(), image_identity_value, type, recorded) != ERROR_SUCCESS) {
+			return false;
+		}
+
+		return type == REG_BINARY && recorded.size() == sizeof(identity) && std::memcmp(recorded.data(), &identity, sizeof(identity)) == 0;
+	}
+
+	// the file must be a native driver of the host machine (see pe.hpp), read in place from a read only mapping
+	static loader_error_t check_image(const std::string& file_path, report_t& report) {
+		phase_scope phase(phase_check_image);
+
+		pe::mapped_file file;
+
+		std::uint32_t status = file.open(file_path);
 		if (status != ERROR_SUCCESS) {
-			return status;
+			return win32_error(phase_check_image, status);
 		}
 
-		if (key_handle != nullptr) {
-			::RegCloseKey(key_handle);
+		pe::image_info_t info = {};
+
+		report.image_error = pe::validate(file.data(), file.size(), pe::host_machine, info);
+		if (report.image_error == pe::none) {
+			return success();
 		}
 
-		UNICODE_STRING nt_reg_path = {};
+		loader_metrics().image_check_failures[report.image_error].increment();
+		return win32_error(phase_check_image, report.image_error == pe::machine_mismatch ? ERROR_EXE_MACHINE_TYPE_MISMATCH : ERROR_BAD_EXE_FORMAT);
+	}
 
-		std::wstring reg_path_copy = helpers::to_unicode(std::string(registry_prefix) + reg_path);
-		LAZYCALL(void, "ntdll.dll!RtlInitUnicodeString", &nt_reg_path, reg_path_copy.c_str());
-		
-		NTSTATUS nt_status = LAZYCALL(NTSTATUS, "ntdll.dll!NtLoadDriver", &nt_reg_path);
+	template <typename Backend = default_backend>
+	static loader_error_t load_driver(const config_t& config, const typename Backend::key_type& services, report_t& report) {
+		if (config.operation != loader_operation_t::load) {
+			return win32_error(phase_load, ERROR_INVALID_OPERATION);
+		}
+
+		phase_scope operation_phase(phase_load);
+
+		image_path_t ntpath;
+		registry_path_t reg_path;
+		nt_registry_path_t nt_reg_path_buffer;
+
+		{
+			phase_scope phase(phase_canonicalize_path);
 
-		if (nt_status == STATUS_IMAGE_ALREADY_LOADED) {
-			LAZYCALL(NTSTATUS, "ntdll.dll!NtUnloadDriver", &nt_reg_path);
-			LAZYCALL(NTSTATUS, "ntdll.dll!NtYieldExecution");
-			nt_status = LAZYCALL(NTSTATUS, "ntdll.dll!NtLoadDriver", &nt_reg_path);
+			std::size_t ntpath_length = build_image_path(config.file_path, ntpath);
+			if (ntpath_length == helpers::npos) {
+				return win32_error(phase_canonicalize_path, platform::last_error());
+			}
+
+			if (ntpath_length > ntpath.capacity()) {
+				return win32_error(phase_canonicalize_path, ERROR_FILENAME_EXCED_RANGE);
+			}
+
+			std::uint32_t build_status = build_nt_registry_path(config.display_name, reg_path, nt_reg_path_buffer);
+			if (build_status != ERROR_SUCCESS) {
+				return win32_error(phase_canonicalize_path, build_status);
+			}
 		}
 
-		if (nt_status == STATUS_SUCCESS) {
-			return ERROR_SUCCESS;
+		// only --skip-if-loaded reads the identity, and records it for the next run
+		image_identity_t identity = {};
+		bool has_identity = config.skip_if_loaded && image_identity(config.file_path.c_str(), identity);
+
+		if (has_identity) {
+			phase_scope phase(phase_check_loaded);
+
+			if (is_loaded_image<Backend>(config, services, ntpath, identity)) {
+				loader_metrics().unchanged_loads.increment();
+				report.unchanged = true;
+				return success();
+			}
 		}
 
-		ULONG converted_status = LAZYCALL(ULONG, "ntdll!RtlNtStatusToDosError", nt_status);
-		if (converted_status == ERROR_MR_MID_NOT_FOUND) {
-			return nt_status;
+		if (config.check_image) {
+			loader_error_t check_status = check_image(config.file_path, report);
+			if (check_status.failed()) {
+				return check_status;
+			}
 		}
 
-		return static_cast<std::uint32_t>(converted_status);
+		service_key_writer<Backend> service_key(services);
+
+		service_key.stage_string("ImagePath", REG_EXPAND_SZ, ntpath.c_str(), ntpath.size());
+		service_key.stage_dword("Type", 1);
+		service_key.stage_dword("Start", 3);
+		service_key.stage_dword("ErrorControl", 1);
+		service_key.stage_string("DisplayName", REG_SZ, config.display_name.c_str(), config.display_name.size());
+
+		// a value recorded by an earlier run describes the file as it was then, it must not match a file loaded since
+		if (has_identity) {
+			service_key.stage_binary(image_identity_value, &identity, sizeof(identity));
+		} else {
+			service_key.stage_delete(image_identity_value);
+		}
+
+		loader_error_t write_status = service_key.write(config.display_name.c_str());
+		if (write_status.failed()) {
+			return write_status;
+		}
+
+		UNICODE_STRING nt_reg_path = make_unicode_string(nt_reg_path_buffer);
+		retry::backoff backoff(config.retry);
+		nt::nt_status nt_status;
+		phase_t nt_phase = phase_nt_load_driver;
+		bool unloaded = false;
+
+		{
+			phase_scope phase(phase_nt_load_driver);
+			nt_status = nt::nt_status(Backend::load_driver(&nt_reg_path));
+		}
+
+		// a tolerated STATUS_IMAGE_ALREADY_LOADED keeps the loaded image instead of reloading it
+		while (!nt_status.is_success() && !is_tolerated(config, nt_status) && retry::is_retryable(config.retry, nt_status.value())) {
+			std::chrono::microseconds delay;
+			if (!backoff.next(delay)) {
+				loader_metrics().retries_exhausted.increment();
+				break;
+			}
+
+			phase_scope phase(phase_retry);
+			loader_metrics().load_retries.increment();
+			nt_phase = phase_retry;
+			++report.retries;
+
+			// the loaded image is unloaded once, later attempts wait for the kernel to release it
+			if (nt_status == nt::nt_status(STATUS_IMAGE_ALREADY_LOADED) && !unloaded) {
+				Backend::unload_driver(&nt_reg_path);
+				unloaded = true;
+			}
+
+			retry::wait<Backend>(delay);
+			nt_status = nt::nt_status(Backend::load_driver(&nt_reg_path));
+		}
+
+		if (nt_status.is_success()) {
+			return success();
+		}
+
+		if (is_tolerated(config, nt_status)) {
+			loader_metrics().tolerated_failures.increment();
+			return success();
+		}
+
+		service_key.rollback();
+
+		return ntstatus_error(nt_phase, nt_status);
 	}
 
-	static std::uint32_t unload_driver(const config_t& config) {
+	template <typename Backend = default_backend>
+	static loader_error_t unload_driver(const config_t& config, const typename Backend::key_type& services, report_t& report) {
 		if (config.operation != loader_operation_t::unload) {
-			return ERROR_INVALID_OPERATION;
+			return win32_error(phase_unload, ERROR_INVALID_OPERATION);
 		}
 
-		std::string reg_path = std::string(registry_subkey) + config.display_name;
+		phase_scope operation_phase(phase_unload);
+
+		registry_path_t reg_path;
+		nt_registry_path_t nt_reg_path_buffer;
+
+		{
+			phase_scope phase(phase_canonicalize_path);
 
-		UNICODE_STRING nt_reg_path = {};
+			std::uint32_t build_status = build_nt_registry_path(config.display_name, reg_path, nt_reg_path_buffer);
+			if (build_status != ERROR_SUCCESS) {
+				return win32_error(phase_canonicalize_path, build_status);
+			}
+		}
 
-		std::wstring reg_path_copy = helpers::to_unicode(std::string(registry_prefix) + reg_path);
-		LAZYCALL(void, "ntdll.dll!RtlInitUnicodeString", &nt_reg_path, reg_path_copy.c_str());
+		UNICODE_STRING nt_reg_path = make_unicode_string(nt_reg_path_buffer);
+		retry::backoff backoff(config.retry);
+		nt::nt_status nt_status;
+		phase_t nt_phase = phase_nt_unload_driver;
 
-		NTSTATUS nt_status = LAZYCALL(NTSTATUS, "ntdll.dll!NtUnloadDriver", &nt_reg_path);
+		{
+			phase_scope phase(phase_nt_unload_driver);
+			nt_status = nt::nt_status(Backend::unload_driver(&nt_reg_path));
+		}
 
-		if (nt_status != STATUS_SUCCESS) {
-			ULONG converted_status = LAZYCALL(ULONG, "ntdll!RtlNtStatusToDosError", nt_status);
-			if (converted_status == ERROR_MR_MID_NOT_FOUND) {
-				return nt_status;
+		while (!nt_status.is_success() && !is_tolerated(config, nt_status) && retry::is_retryable(config.retry, nt_status.value())) {
+			std::chrono::microseconds delay;
+			if (!backoff.next(delay)) {
+				loader_metrics().retries_exhausted.increment();
+				break;
 			}
 
-			return static_cast<std::uint32_t>(converted_status);
+			phase_scope phase(phase_retry);
+			loader_metrics().unload_retries.increment();
+			nt_phase = phase_retry;
+			++report.retries;
+
+			retry::wait<Backend>(delay);
+			nt_status = nt::nt_status(Backend::unload_driver(&nt_reg_path));
 		}
 
-		return static_cast<std::uint32_t>(::RegDeleteTreeA(HKEY_LOCAL_MACHINE, reg_path.c_str()));
+		// a tolerated failure (e.g. STATUS_OBJECT_NAME_NOT_FOUND when nothing is loaded) still removes the service key
+		if (!nt_status.is_success() && is_tolerated(config, nt_status)) {
+			loader_metrics().tolerated_failures.increment();
+		} else if (!nt_status.is_success()) {
+			return ntstatus_error(nt_phase, nt_status);
+		}
+
+		phase_scope phase(phase_delete_key);
+
+		LSTATUS status = Backend::delete_tree(services, config.display_name.c_str());
+		if (status != ERROR_SUCCESS) {
+			return registry_error(phase_delete_key, api_reg_delete_tree, status);
+		}
+
+		return success();
 	}
 
-	static std::uint32_t load_unload(const config_t& config) {
-		std::uint32_t ret = ERROR_INVALID_OPERATION;
+	template <typename Backend = default_backend>
+	static loader_error_t load_unload(const config_t& config, const typename Backend::key_type& services, report_t& report) {
+		loader_error_t ret = win32_error(phase_load, ERROR_INVALID_OPERATION);
 
 		switch (config.operation) {
 			case loader_operation_t::load:
-				ret = load_driver(config);
+				loader_metrics().loads.increment();
+				ret = load_driver<Backend>(config, services, report);
+
+				if (ret.failed()) {
+					loader_metrics().load_failures.increment();
+				}
 				break;
 			case loader_operation_t::unload:
-				ret = unload_driver(config);
+				loader_metrics().unloads.increment();
+				ret = unload_driver<Backend>(config, services, report);
+
+				if (ret.failed()) {
+					loader_metrics().unload_failures.increment();
+				}
 				break;
 			default:
 				break;
 		}
 
+		if (ret.failed()) {
+			loader_metrics().failures.increment(ret.domain, ret.code);
+		}
+
 		return ret;
 	}
-}
\ No newline at end of file
+
+	template <typename Backend = default_backend>
+	static loader_error_t load_unload(const config_t& config, report_t& report) {
+		typename Backend::key_type services;
+
+		loader_error_t ret = open_services_key<Backend>(services);
+		if (ret.failed()) {
+			loader_metrics().failures.increment(ret.domain, ret.code);
+			return ret;
+		}
+
+		return load_unload<Backend>(config, services, report);
+	}
+
+	// base name of the image of a status operation: of the driver file when one is given, else of the ImagePath of the service key
+	template <typename Backend = default_backend>
+	static loader_error_t status_image_name(const config_t& config, std::string& base_name) {
+		std::string image_path = config.file_path;
+
+		if (image_path.empty()) {
+			typename Backend::key_type services;
+
+			loader_error_t ret = open_services_key<Backend>(services);
+			if (ret.failed()) {
+				return ret;
+			}
+
+			DWORD type = 0;
+			std::vector<std::uint8_t> data;
+
+			LSTATUS status = Backend::query_value(services, config.display_name.c_str(), "ImagePath", type, data);
+			if (status != ERROR_SUCCESS) {
+				return win32_error(phase_find_module, static_cast<std::uint32_t>(status));
+			}
+
+			if (type != REG_SZ && type != REG_EXPAND_SZ) {
+				return win32_error(phase_find_module, ERROR_INVALID_DATA);
+			}
+
+			image_path.assign(data.begin(), data.end());
+			image_path.resize(std::char_traits<char>::length(image_path.c_str())); // REG_SZ data may or may not count the terminator
+		}
+
+		std::size_t separator = image_path.find_last_of("\\/");
+		base_name = separator == std::string::npos ? image_path : image_path.substr(separator + 1);
+
+		return success();
+	}
+
+	// nullptr when not loaded
+	static const modules::module_t* find_module(const modules::module_index& index, const std::string& base_name) {
+		phase_scope phase(phase_find_module);
+		return index.find(base_name);
+	}
+
+	typedef helpers::fixed_string<char, 1024> error_text_t;
+
+	namespace detail {
+
+		// appends what fits, error text is best effort
+		static void append_truncated(error_text_t& out, const char* str, std::size_t length) {
+			out.append(str, length < out.available() ? length : out.available());
+		}
+
+		static void append_truncated(error_text_t& out, std::string_view str) {
+			append_truncated(out, str.data(), str.size());
+		}
+
+		static void append_decimal(error_text_t& out, std::uint32_t value) {
+			char digits[10];
+			std::to_chars_result res = std::to_chars(digits, digits + sizeof(digits), value);
+			append_truncated(out, digits, static_cast<std::size_t>(res.ptr - digits));
+		}
+
+		static void append_hex(error_text_t& out, std::uint32_t value) {
+			char digits[10] = { '0', 'x' };
+			append_truncated(out, digits, 2 + hex::format_integer(value, digits + 2, hex::uppercase | hex::zero_padded));
+		}
+
+		// end of the insert starting at message[at] == '%': "%1" to "%99", or a printf conversion such as "%hs" or
+		// "%08lx"; at + 1 when none starts there
+		static std::size_t insert_end(std::string_view message, std::size_t at) {
+			std::size_t i = at + 1;
+
+			if (i < message.size() && message[i] >= '1' && message[i] <= '9') {
+				++i;
+				return i < message.size() && message[i] >= '0' && message[i] <= '9' ? i + 1 : i;
+			}
+
+			while (i < message.size() && message[i] >= '0' && message[i] <= '9') {
+				++i;
+			}
+
+			while (i < message.size() && (message[i] == 'h' || message[i] == 'l' || message[i] == 'w')) {
+				++i;
+			}
+
+			if (i < message.size() && std::string_view("cdpsuxXZ").find(message[i]) != std::string_view::npos) {
+				return i + 1;
+			}
+
+			return at + 1;
+		}
+
+		// message table text with its inserts filled: the first one names the file or service the message is about
+		// when it is a string ("%1", "%hs", "%ws", "%wZ") and subject is given, every other insert reads "?"
+		static void append_message(error_text_t& out, std::string_view message, std::string_view subject) {
+			bool first_insert = true;
+
+			for (std::size_t i = 0; i < message.size();) {
+				std::size_t percent = message.find('%', i);
+				append_truncated(out, message.substr(i, percent - i));
+
+				if (percent == std::string_view::npos) {
+					return;
+				}
+
+				std::size_t end = insert_end(message, percent);
+				std::string_view insert = message.substr(percent, end - percent);
+
+				// "%%" and a lone '%' are the character itself
+				if (end == percent + 1) {
+					append_truncated(out, "%");
+					i = end < message.size() && message[end] == '%' ? end + 1 : end;
+					continue;
+				}
+
+				bool string_insert = insert == "%1" || insert == "%hs" || insert == "%ws" || insert == "%wZ";
+				append_truncated(out, first_insert && string_insert && !subject.empty() ? subject : std::string_view("?"));
+
+				first_insert = false;
+				i = end;
+			}
+		}
+	}
+
+	// "<phase> failed: ntstatus 0xC000010E STATUS_IMAGE_ALREADY_LOADED (error, facility NONE, win32 1056 ERROR_SERVICE_ALREADY_RUNNING): <message>"
+	// "<phase> failed: win32 5 ERROR_ACCESS_DENIED (0x00000005): <message>"
+	// written into out without allocating, long messages are truncated
+	// subject, the driver path or display name, fills the message insert naming the image or service
+	static void format_error(const loader_error_t& error, error_text_t& out, std::string_view subject = std::string_view()) {
+		out.clear();
+
+		if (!error.failed()) {
+			detail::append_truncated(out, "success");
+			return;
+		}
+
+		detail::append_truncated(out, phase_name(error.phase));
+		detail::append_truncated(out, " failed: ");
+		detail::append_truncated(out, status_domain_name(error.domain));
+		detail::append_truncated(out, " ");
+
+		if (error.domain == domain_win32) {
+			const status_table::entry_t* entry = status_table::find_code(win32_table::table, error.code);
+
+			detail::append_decimal(out, error.code);
+
+			if (entry != nullptr) {
+				detail::append_truncated(out, " ");
+				detail::append_truncated(out, status_table::name(win32_table::table, *entry));
+			}
+
+			detail::append_truncated(out, " (");
+			detail::append_hex(out, error.code);
+			detail::append_truncated(out, ")");
+
+			if (entry != nullptr && entry->message_length != 0) {
+				detail::append_truncated(out, ": ");
+				detail::append_message(out, status_table::message(win32_table::table, *entry), subject);
+			}
+
+			return;
+		}
+
+		nt::nt_status status(error.code);
+		const status_table::entry_t* entry = status_table::find_code(ntstatus_table::table, status.value());
+
+		detail::append_hex(out, status.value());
+
+		if (entry != nullptr) {
+			detail::append_truncated(out, " ");
+			detail::append_truncated(out, status_table::name(ntstatus_table::table, *entry));
+		}
+
+		detail::append_truncated(out, " (");
+		detail::append_truncated(out, nt::severity_name(status.severity()));
+		detail::append_truncated(out, ", facility ");
+		detail::append_truncated(out, status.facility_name());
+
+		if (status.customer()) {
+			detail::append_truncated(out, ", customer");
+		}
+
+		std::uint32_t win32_code = ntstatus_win32::to_win32(status.value());
+		if (win32_code != ntstatus_win32::not_found && !status.customer()) {
+			const status_table::entry_t* win32_entry = status_table::find_code(win32_table::table, win32_code);
+
+			detail::append_truncated(out, ", win32 ");
+			detail::append_decimal(out, win32_code);
+
+			if (win32_entry != nullptr) {
+				detail::append_truncated(out, " ");
+				detail::append_truncated(out, status_table::name(win32_table::table, *win32_entry));
+			}
+		}
+
+		detail::append_truncated(out, ")");
+
+		if (entry != nullptr && entry->message_length != 0) {
+			detail::append_truncated(out, ": ");
+			detail::append_message(out, status_table::message(ntstatus_table::table, *entry), subject);
+		}
+	}
+}
@@ -21,8 +21,9 @@ class Functor<ResultType(*)(ArgumentTypes ...)> {
             return _ptr;
         }
 
-        ResultType operator() (ArgumentTypes&& ...args) const {
-            return reinterpret_cast<ResultType(*)(ArgumentTypes ...)>(_ptr)(std::forward<ArgumentTypes>(args)...);
+        // by value, as the callee takes them: an lvalue converts to the parameter type instead of binding a reference
+        ResultType operator() (ArgumentTypes ...args) const {
+            return reinterpret_cast<ResultType(*)(ArgumentTypes ...)>(_ptr)(args...);
         }
 
     private:
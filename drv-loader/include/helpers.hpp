@@ -1,136 +1,290 @@
 #pragma once
 
-#include <locale>
-#include <codecvt>
 #include <string>
 #include <cstdint>
 #include <charconv>
 #include <array>
+#include <stdexcept>
 
-#define NOMINMAX
-#include <windows.h>
+#include "hex.hpp"
+#include "platform.hpp"
+#include "unique_resource.hpp"
+#include "utf.hpp"
 
 namespace helpers {
 
 	static std::string to_ansi(const std::wstring& wstr) {
-		std::wstring_convert<std::codecvt_utf8_utf16<wchar_t>> converter;
-		return converter.to_bytes(wstr);
+		std::string str(utf::max_utf8_length<wchar_t>(wstr.size()), '\0');
+
+		utf::result_t result = utf::to_utf8(wstr.data(), wstr.size(), str.data());
+		if (result.error != utf::none) {
+			throw std::range_error("helpers::to_ansi: " + std::string(utf::error_name(result.error)) + " at offset " + std::to_string(result.position));
+		}
+
+		str.resize(result.written);
+		return str;
 	}
 
 	static std::wstring to_unicode(const std::string& str) {
-		std::wstring_convert<std::codecvt_utf8_utf16<wchar_t>> converter;
-		return converter.from_bytes(str);
+		// utf-8 never takes fewer units than its utf-16/utf-32 form
+		std::wstring wstr(str.size(), L'\0');
+
+		utf::result_t result = utf::from_utf8(str.data(), str.size(), wstr.data());
+		if (result.error != utf::none) {
+			throw std::range_error("helpers::to_unicode: " + std::string(utf::error_name(result.error)) + " at offset " + std::to_string(result.position));
+		}
+
+		wstr.resize(result.written);
+		return wstr;
 	}
 
-	template <typename T>
-	static std::string to_hex_string(T number) {
-		static_assert(std::is_integral<T>::value, "helpers::to_hex_string is only available for integral types");
+	// returned by the buffer apis below when the input cannot be converted at all
+	constexpr std::size_t npos = static_cast<std::size_t>(-1);
 
-		constexpr std::size_t buffer_size = std::is_signed<T>::value ? (sizeof(T) * 2) + 1 : sizeof(T) * 2;
-		std::array<char, buffer_size> arr;
+	// null terminated string with inline storage, never allocates
+	template <typename CharT, std::size_t Capacity>
+	class fixed_string {
+		private:
+			CharT _data[Capacity + 1] = {};
+			std::size_t _size = 0;
+		public:
+			typedef CharT value_type;
 
-		auto res = std::to_chars(arr.data(), arr.data() + arr.size(), number, 16);
+			fixed_string(void) = default;
 
-		return std::string(arr.data(), std::distance(arr.data(), res.ptr));
+			// return false and leave the string untouched when the result would not fit
+			bool assign(const CharT* str, std::size_t length) {
+				clear();
+				return append(str, length);
+			}
+
+			bool append(const CharT* str, std::size_t length) {
+				if (length > Capacity - _size) {
+					return false;
+				}
+
+				std::char_traits<CharT>::copy(_data + _size, str, length);
+				resize(_size + length);
+
+				return true;
+			}
+
+			bool append(const CharT* str) {
+				return append(str, std::char_traits<CharT>::length(str));
+			}
+
+			// commits characters written through data()
+			void resize(std::size_t size) {
+				_size = size < Capacity ? size : Capacity;
+				_data[_size] = CharT();
+			}
+
+			void clear(void) { resize(0); }
+
+			CharT* data(void) { return _data; }
+			const CharT* c_str(void) const { return _data; }
+			std::size_t size(void) const { return _size; }
+			bool empty(void) const { return _size == 0; }
+			constexpr std::size_t capacity(void) const { return Capacity; }
+			std::size_t available(void) const { return Capacity - _size; }
+	};
+
+	// writes the null terminated wide form of str into buffer and returns its length
+	// a result >= capacity means nothing usable was written, it is the required length (or npos on malformed input)
+	static std::size_t to_unicode(const char* str, std::size_t length, wchar_t* buffer, std::size_t capacity) {
+		utf::result_t result = {};
+
+		// utf-8 never takes fewer units than its wide form: with room for `length` units (what the vectorized decoder
+		// stores in whole blocks) there is no counting pass
+		if (length < capacity) {
+			result = utf::from_utf8(str, length, buffer);
+		} else {
+			std::size_t required = utf::from_utf8_length<wchar_t>(str, length);
+			if (required >= capacity) {
+				return required;
+			}
+
+			result = utf::from_utf8_exact(str, length, buffer);
+		}
+
+		if (result.error != utf::none) {
+			return npos;
+		}
+
+		buffer[result.written] = L'\0';
+		return result.written;
 	}
 
-	template <typename T>
-	static T from_hex_string(const std::string& string) {
-		static_assert(std::is_integral<T>::value, "helpers::from_hex_string is only available for integral types");
+	// writes the null terminated utf-8 form of wstr into buffer, same return convention as to_unicode
+	static std::size_t to_ansi(const wchar_t* wstr, std::size_t length, char* buffer, std::size_t capacity) {
+		std::size_t required = utf::to_utf8_length(wstr, length);
+		if (required >= capacity) {
+			return required;
+		}
 
-		T result;
-		std::from_chars(string.data(), string.data() + string.size(), result, 16);
+		utf::result_t result = utf::max_utf8_length<wchar_t>(length) < capacity ? utf::to_utf8(wstr, length, buffer) : utf::to_utf8_exact(wstr, length, buffer);
+		if (result.error != utf::none) {
+			return npos;
+		}
 
-		return result;
+		buffer[result.written] = '\0';
+		return result.written;
 	}
 
-	template<class T>
-	class scoped_ptr {
-		private:
-			T* _ptr = nullptr;
-		public:
-			typedef T element_type;
+	// appends the converted string, returns the required total length when it does not fit
+	template <std::size_t Capacity>
+	static std::size_t append_unicode(fixed_string<wchar_t, Capacity>& out, const char* str, std::size_t length) {
+		std::size_t written = to_unicode(str, length, out.data() + out.size(), out.available() + 1);
+		if (written == npos) {
+			return npos;
+		}
 
-			explicit scoped_ptr(T* ptr = nullptr) : _ptr(ptr) {}
-			scoped_ptr(const scoped_ptr&) = delete; // non copyable
-			~scoped_ptr(void) { if (_ptr != nullptr) { delete _ptr; } }
+		if (written > out.available()) {
+			return out.size() + written;
+		}
 
-			void reset(T* ptr = nullptr) { _ptr = ptr; };
+		out.resize(out.size() + written);
+		return out.size();
+	}
 
-			T& operator*(void) const { return *_ptr; }
-			T* operator->(void) const { return _ptr; }
-			T* get(void) const { return _ptr; }
-	};
+	// appends the absolute form of path, returns the required total length when it does not fit or npos on failure
+	// outside windows the required length is an upper bound when path has ".." components
+	template <std::size_t Capacity>
+	static std::size_t append_full_path(fixed_string<char, Capacity>& out, const char* path) {
+#if defined(_WIN32)
+		char* buffer = out.data() + out.size();
+		std::size_t capacity = out.available() + 1;
+
+		// returns the length without terminator on success, the required size with terminator otherwise
+		DWORD length = ::GetFullPathNameA(path, static_cast<DWORD>(capacity), buffer, nullptr);
+		if (length == 0) {
+			return npos;
+		}
 
-	template<>
-	class scoped_ptr<void> {
-		private:
-			void* _ptr = nullptr;
-		public:
-			typedef void element_type;
+		if (length >= capacity) {
+			return out.size() + length - 1;
+		}
 
-			explicit scoped_ptr(void* ptr = nullptr) : _ptr(ptr) {}
-			scoped_ptr(const scoped_ptr&) = delete; // non copyable
-			~scoped_ptr(void) { if (_ptr != nullptr) { delete _ptr; } }
+		out.resize(out.size() + length);
+		return out.size();
+#else
+		// lexical like GetFullPathNameA, the file does not have to exist: the working directory (already canonical)
+		// then every component of path, "." skipped, ".." dropping the last component but never the root
+		char* buffer = out.data();
+		std::size_t root = out.size();
+		std::size_t end = root;
+		std::size_t limit = root + out.available();
+
+		if (path[0] == '/') {
+			if (end == limit) {
+				return root + std::char_traits<char>::length(path);
+			}
 
-			void reset(void* ptr = nullptr) { _ptr = ptr; };
+			buffer[end++] = '/';
+		} else {
+			if (::getcwd(buffer + root, out.available() + 1) == nullptr) {
+				return errno == ERANGE ? limit + 1 + std::char_traits<char>::length(path) : npos;
+			}
 
-			void* operator->(void) const { return _ptr; }
-			void* get(void) const { return _ptr; }
-	};
+			end += std::char_traits<char>::length(buffer + root);
+		}
 
-	template<>
-	class scoped_ptr<void*> {
-	private:
-		void* _ptr = nullptr;
-	public:
-		typedef void element_type;
+		for (const char* component = path; *component != '\0';) {
+			const char* next = component;
+			while (*next != '\0' && *next != '/') {
+				++next;
+			}
 
-		explicit scoped_ptr(void* ptr = nullptr) : _ptr(ptr) {}
-		scoped_ptr(const scoped_ptr&) = delete; // non copyable
-		~scoped_ptr(void) { if (_ptr != nullptr) { delete _ptr; } }
+			std::size_t length = static_cast<std::size_t>(next - component);
 
-		void reset(void* ptr = nullptr) {
-			if (_ptr != nullptr) { delete _ptr; }
-			_ptr = ptr;
-		};
+			if (length == 2 && component[0] == '.' && component[1] == '.') {
+				while (end > root + 1 && buffer[end - 1] != '/') {
+					--end;
+				}
 
-		void* operator->(void) const { return _ptr; }
-		void* get(void) const { return _ptr; }
-	};
+				end -= end > root + 1;
+			} else if (length != 0 && !(length == 1 && component[0] == '.')) {
+				std::size_t separator = buffer[end - 1] != '/';
 
-	class scoped_handle {
-		private:
-			HANDLE _handle = nullptr;
+				if (separator + length > limit - end) {
+					return end + separator + length + std::char_traits<char>::length(next);
+				}
 
-			void safe_close_handle(void) {
-				if (_handle != INVALID_HANDLE_VALUE) {
-					::CloseHandle(_handle);
-					_handle = INVALID_HANDLE_VALUE;
+				if (separator != 0) {
+					buffer[end] = '/';
 				}
+
+				std::char_traits<char>::copy(buffer + end + separator, component, length);
+				end += separator + length;
 			}
-		public:
-			typedef HANDLE element_type;
 
-			explicit scoped_handle(HANDLE handle = INVALID_HANDLE_VALUE) : _handle(handle) {}
-			scoped_handle(const scoped_handle&) = delete; // non copyable
-			~scoped_handle(void) { safe_close_handle(); }
+			component = *next != '\0' ? next + 1 : next;
+		}
 
-			void reset(HANDLE handle = INVALID_HANDLE_VALUE) {
-				safe_close_handle();
-				_handle = handle;
-			}
+		out.resize(end);
+		return out.size();
+#endif
+	}
 
-			HANDLE get(void) const { return _handle; }
-			HANDLE *get_ptr(void) { return &_handle; }
-	};
+	template <typename T>
+	static std::string to_hex_string(T number) {
+		static_assert(std::is_integral<T>::value, "helpers::to_hex_string is only available for integral types");
+
+		constexpr std::size_t buffer_size = std::is_signed<T>::value ? (sizeof(T) * 2) + 1 : sizeof(T) * 2;
+		std::array<char, buffer_size> arr;
+
+		auto res = std::to_chars(arr.data(), arr.data() + arr.size(), number, 16);
+
+		return std::string(arr.data(), std::distance(arr.data(), res.ptr));
+	}
+
+	// hex::format_t flags, formats the two's complement bit pattern for signed types
+	template <typename T>
+	static std::string to_hex_string(T number, std::uint32_t format) {
+		static_assert(std::is_integral<T>::value, "helpers::to_hex_string is only available for integral types");
+
+		std::array<char, sizeof(T) * 2> arr;
+		std::size_t length = hex::format_integer(number, arr.data(), format);
+
+		return std::string(arr.data(), length);
+	}
+
+	// returns false on malformed input, error_position (when given) receives the offset of the first bad character
+	template <typename T>
+	static bool from_hex_string(const std::string& string, T& value, std::size_t* error_position = nullptr) {
+		static_assert(std::is_integral<T>::value, "helpers::from_hex_string is only available for integral types");
+
+		hex::parse_result_t<T> result = hex::parse<T>(string.data(), string.size());
+
+		if (error_position != nullptr) {
+			*error_position = result.position;
+		}
+
+		if (result.error != hex::none) {
+			return false;
+		}
+
+		value = result.value;
+		return true;
+	}
+
+	// zero on malformed input
+	template <typename T>
+	static T from_hex_string(const std::string& string) {
+		T result = T();
+		from_hex_string(string, result);
+
+		return result;
+	}
 
+	// always succeeds outside windows, the simulated backend has no privilege model
 	bool add_privilege(const std::string& name) {
+#if defined(_WIN32)
 		bool ret = false;
-		scoped_handle token_handle;
+		unique_handle token_handle;
 		TOKEN_PRIVILEGES privileges = {};
 
-		BOOL open_status = ::OpenProcessToken(::GetCurrentProcess(), TOKEN_ALL_ACCESS, token_handle.get_ptr());
+		BOOL open_status = ::OpenProcessToken(::GetCurrentProcess(), TOKEN_ALL_ACCESS, token_handle.put());
 
 		if (open_status) {
 			BOOL lookup_status = ::LookupPrivilegeValueA(nullptr, name.c_str(), &privileges.Privileges[0].Luid);
@@ -144,5 +298,9 @@ namespace helpers {
 		}
 
 		return ret;
+#else
+		(void)name;
+		return true;
+#endif
 	}
 }
\ No newline at end of file
@@ -0,0 +1,457 @@
+#pragma once
+
+#include "cpu_features.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <charconv>
+#include <limits>
+#include <type_traits>
+
+// buffer level hex encoding and decoding (ssse3/avx2 selected at runtime), checked integer parsing and a streaming hexdump writer
+
+namespace hex {
+
+	typedef enum _format_t {
+		lowercase = 0,
+		uppercase = 1 << 0,
+		zero_padded = 1 << 1,
+	} format_t;
+
+	typedef enum _error_t {
+		none,
+		empty_input,
+		invalid_digit,
+		odd_length,
+		value_overflow,
+
+		// number of entries in enum
+		n_error
+	} error_t;
+
+	typedef struct _decode_result_t {
+		error_t error;
+		std::size_t position; // offset of the first offending character (input length on success)
+	} decode_result_t, *pdecode_result_t;
+
+	template <typename T>
+	struct parse_result_t {
+		T value;
+		error_t error;
+		std::size_t position; // offset of the first offending character (input length on success)
+	};
+
+	static const char* error_name(error_t error) {
+		constexpr const char* names[] = {
+			"none",
+			"empty input",
+			"invalid hex digit",
+			"odd number of digits",
+			"value out of range",
+		};
+
+		return error < n_error ? names[error] : "unknown";
+	}
+
+	namespace detail {
+
+		static const char* digits(std::uint32_t format) {
+			return (format & uppercase) != 0 ? "0123456789ABCDEF" : "0123456789abcdef";
+		}
+
+		static void encode_scalar(const std::uint8_t* src, std::size_t length, char* dst, std::uint32_t format) {
+			const char* table = digits(format);
+
+			for (std::size_t i = 0; i < length; ++i) {
+				dst[i * 2] = table[src[i] >> 4];
+				dst[i * 2 + 1] = table[src[i] & 0x0F];
+			}
+		}
+
+#if defined(CPU_FEATURES_X86)
+		CPU_FEATURES_TARGET_SSSE3 static void encode_ssse3(const std::uint8_t* src, std::size_t length, char* dst, std::uint32_t format) {
+			const __m128i table = _mm_loadu_si128(reinterpret_cast<const __m128i*>(digits(format)));
+			const __m128i low_nibble = _mm_set1_epi8(0x0F);
+
+			std::size_t i = 0;
+
+			for (; i + 16 <= length; i += 16) {
+				__m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+				__m128i high = _mm_shuffle_epi8(table, _mm_and_si128(_mm_srli_epi16(bytes, 4), low_nibble));
+				__m128i low = _mm_shuffle_epi8(table, _mm_and_si128(bytes, low_nibble));
+
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i * 2), _mm_unpacklo_epi8(high, low));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i * 2 + 16), _mm_unpackhi_epi8(high, low));
+			}
+
+			encode_scalar(src + i, length - i, dst + i * 2, format);
+		}
+
+		CPU_FEATURES_TARGET_AVX2 static void encode_avx2(const std::uint8_t* src, std::size_t length, char* dst, std::uint32_t format) {
+			const __m256i table = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(digits(format))));
+			const __m256i low_nibble = _mm256_set1_epi8(0x0F);
+
+			std::size_t i = 0;
+
+			for (; i + 32 <= length; i += 32) {
+				__m256i bytes = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+				__m256i high = _mm256_shuffle_epi8(table, _mm256_and_si256(_mm256_srli_epi16(bytes, 4), low_nibble));
+				__m256i low = _mm256_shuffle_epi8(table, _mm256_and_si256(bytes, low_nibble));
+
+				// unpack works per 128 bits lane: first holds bytes 0-7 | 16-23, second 8-15 | 24-31
+				__m256i first = _mm256_unpacklo_epi8(high, low);
+				__m256i second = _mm256_unpackhi_epi8(high, low);
+
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i * 2), _mm256_permute2x128_si256(first, second, 0x20));
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i * 2 + 32), _mm256_permute2x128_si256(first, second, 0x31));
+			}
+
+			// gcc and clang emit no vzeroupper for target("avx2") functions, the sse tail and the caller would stall on the dirty upper halves
+			_mm256_zeroupper();
+			encode_ssse3(src + i, length - i, dst + i * 2, format);
+		}
+#endif
+
+		typedef void(*encode_fn)(const std::uint8_t*, std::size_t, char*, std::uint32_t);
+
+		static encode_fn select_encode(void) {
+#if defined(CPU_FEATURES_X86)
+			const cpu_features::features_t& features = cpu_features::get();
+
+			if (features.avx2) {
+				return &encode_avx2;
+			}
+
+			if (features.ssse3) {
+				return &encode_ssse3;
+			}
+#endif
+			return &encode_scalar;
+		}
+
+		static int digit_value(char c) {
+			if (c >= '0' && c <= '9') {
+				return c - '0';
+			}
+
+			char lower = static_cast<char>(c | 0x20);
+			if (lower >= 'a' && lower <= 'f') {
+				return lower - 'a' + 10;
+			}
+
+			return -1;
+		}
+
+		static decode_result_t decode_scalar(const char* src, std::size_t length, std::uint8_t* dst, std::size_t i = 0) {
+			for (; i < length; i += 2) {
+				int high = digit_value(src[i]);
+				if (high < 0) {
+					return { invalid_digit, i };
+				}
+
+				int low = digit_value(src[i + 1]);
+				if (low < 0) {
+					return { invalid_digit, i + 1 };
+				}
+
+				dst[i / 2] = static_cast<std::uint8_t>((high << 4) | low);
+			}
+
+			return { none, length };
+		}
+
+#if defined(CPU_FEATURES_X86)
+		// maps ascii hex digits to their value, bit n of valid is set when character n is a hex digit
+		CPU_FEATURES_TARGET_SSSE3 static __m128i nibbles_16(__m128i chars, std::uint32_t& valid) {
+			__m128i digit = _mm_sub_epi8(chars, _mm_set1_epi8('0'));
+			__m128i letter = _mm_sub_epi8(_mm_or_si128(chars, _mm_set1_epi8(0x20)), _mm_set1_epi8('a'));
+
+			// unsigned range checks: x <= n  <=>  min(x, n) == x
+			__m128i is_digit = _mm_cmpeq_epi8(_mm_min_epu8(digit, _mm_set1_epi8(9)), digit);
+			__m128i is_letter = _mm_cmpeq_epi8(_mm_min_epu8(letter, _mm_set1_epi8(5)), letter);
+
+			valid = static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_or_si128(is_digit, is_letter)));
+
+			return _mm_or_si128(_mm_and_si128(is_digit, digit), _mm_and_si128(is_letter, _mm_add_epi8(letter, _mm_set1_epi8(10))));
+		}
+
+		CPU_FEATURES_TARGET_SSSE3 static decode_result_t decode_ssse3(const char* src, std::size_t length, std::uint8_t* dst, std::size_t i = 0) {
+			// (first nibble * 16) + second nibble for every pair of characters
+			const __m128i weights = _mm_set1_epi16(0x0110);
+
+			for (; i + 16 <= length; i += 16) {
+				std::uint32_t valid = 0;
+				__m128i nibbles = nibbles_16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i)), valid);
+
+				if (valid != 0xFFFF) {
+					return { invalid_digit, i + cpu_features::count_trailing_zeros(~valid) };
+				}
+
+				__m128i bytes = _mm_maddubs_epi16(nibbles, weights);
+				_mm_storel_epi64(reinterpret_cast<__m128i*>(dst + i / 2), _mm_packus_epi16(bytes, bytes));
+			}
+
+			return decode_scalar(src, length, dst, i);
+		}
+
+		CPU_FEATURES_TARGET_AVX2 static decode_result_t decode_avx2(const char* src, std::size_t length, std::uint8_t* dst) {
+			const __m256i weights = _mm256_set1_epi16(0x0110);
+			const __m256i ten = _mm256_set1_epi8(10);
+
+			std::size_t i = 0;
+
+			for (; i + 32 <= length; i += 32) {
+				__m256i chars = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+				__m256i digit = _mm256_sub_epi8(chars, _mm256_set1_epi8('0'));
+				__m256i letter = _mm256_sub_epi8(_mm256_or_si256(chars, _mm256_set1_epi8(0x20)), _mm256_set1_epi8('a'));
+
+				__m256i is_digit = _mm256_cmpeq_epi8(_mm256_min_epu8(digit, _mm256_set1_epi8(9)), digit);
+				__m256i is_letter = _mm256_cmpeq_epi8(_mm256_min_epu8(letter, _mm256_set1_epi8(5)), letter);
+
+				std::uint32_t valid = static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_or_si256(is_digit, is_letter)));
+				if (valid != 0xFFFFFFFF) {
+					_mm256_zeroupper();
+					return { invalid_digit, i + cpu_features::count_trailing_zeros(~valid) };
+				}
+
+				__m256i nibbles = _mm256_or_si256(_mm256_and_si256(is_digit, digit), _mm256_and_si256(is_letter, _mm256_add_epi8(letter, ten)));
+				__m256i bytes = _mm256_maddubs_epi16(nibbles, weights);
+
+				// packus works per lane, keep the low quadword of each lane
+				__m256i packed = _mm256_permute4x64_epi64(_mm256_packus_epi16(bytes, bytes), 0x08);
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i / 2), _mm256_castsi256_si128(packed));
+			}
+
+			// no implicit vzeroupper, see encode_avx2
+			_mm256_zeroupper();
+			return decode_ssse3(src, length, dst, i);
+		}
+#endif
+
+		typedef decode_result_t(*decode_fn)(const char*, std::size_t, std::uint8_t*);
+
+		static decode_result_t decode_scalar_entry(const char* src, std::size_t length, std::uint8_t* dst) {
+			return decode_scalar(src, length, dst);
+		}
+
+#if defined(CPU_FEATURES_X86)
+		CPU_FEATURES_TARGET_SSSE3 static decode_result_t decode_ssse3_entry(const char* src, std::size_t length, std::uint8_t* dst) {
+			return decode_ssse3(src, length, dst);
+		}
+#endif
+
+		static decode_fn select_decode(void) {
+#if defined(CPU_FEATURES_X86)
+			const cpu_features::features_t& features = cpu_features::get();
+
+			if (features.avx2) {
+				return &decode_avx2;
+			}
+
+			if (features.ssse3) {
+				return &decode_ssse3_entry;
+			}
+#endif
+			return &decode_scalar_entry;
+		}
+	}
+
+	// writes exactly 2 * length characters to dst (no terminator)
+	static void encode(const void* src, std::size_t length, char* dst, std::uint32_t format = lowercase) {
+		static const detail::encode_fn fn = detail::select_encode();
+		fn(static_cast<const std::uint8_t*>(src), length, dst, format);
+	}
+
+	// decodes length hex characters (either case) into length / 2 bytes
+	static decode_result_t decode(const char* src, std::size_t length, void* dst) {
+		if ((length & 1) != 0) {
+			return { odd_length, length - 1 };
+		}
+
+		static const detail::decode_fn fn = detail::select_decode();
+		return fn(src, length, static_cast<std::uint8_t*>(dst));
+	}
+
+	// parses a whole string as a hex integer, with an optional 0x/0X prefix (after the sign for signed types)
+	template <typename T>
+	static parse_result_t<T> parse(const char* str, std::size_t length) {
+		static_assert(std::is_integral<T>::value, "hex::parse is only available for integral types");
+
+		parse_result_t<T> result = { T(), none, length };
+
+		const char* begin = str;
+		const char* end = str + length;
+
+		bool negative = std::is_signed<T>::value && begin != end && *begin == '-';
+		const char* digits = negative ? begin + 1 : begin;
+
+		if (end - digits >= 2 && digits[0] == '0' && (digits[1] | 0x20) == 'x') {
+			digits += 2;
+		}
+
+		if (digits == end) {
+			result.error = begin == end ? empty_input : invalid_digit;
+			result.position = static_cast<std::size_t>(digits - begin);
+			return result;
+		}
+
+		// from_chars accepts the sign only, the prefix has to be skipped by hand
+		typedef typename std::make_unsigned<T>::type unsigned_t;
+		unsigned_t magnitude = 0;
+
+		std::from_chars_result res = std::from_chars(digits, end, magnitude, 16);
+		if (res.ptr != end || res.ec == std::errc::invalid_argument) {
+			result.error = invalid_digit;
+			result.position = static_cast<std::size_t>(res.ptr - begin);
+			return result;
+		}
+
+		constexpr unsigned_t max_positive = static_cast<unsigned_t>(std::numeric_limits<T>::max());
+
+		if (res.ec == std::errc::result_out_of_range || (!negative && magnitude > max_positive) || (negative && magnitude > max_positive + 1)) {
+			result.error = value_overflow;
+			result.position = static_cast<std::size_t>(digits - begin);
+			return result;
+		}
+
+		result.value = static_cast<T>(negative ? static_cast<unsigned_t>(0) - magnitude : magnitude);
+		return result;
+	}
+
+	// formats the bit pattern of value, zero_padded always writes sizeof(T) * 2 digits
+	// returns the number of characters written, dst must hold sizeof(T) * 2 characters
+	template <typename T>
+	static std::size_t format_integer(T value, char* dst, std::uint32_t format = lowercase) {
+		static_assert(std::is_integral<T>::value, "hex::format_integer is only available for integral types");
+
+		typedef typename std::make_unsigned<T>::type unsigned_t;
+		constexpr std::size_t max_digits = sizeof(T) * 2;
+
+		const char* table = detail::digits(format);
+		unsigned_t bits = static_cast<unsigned_t>(value);
+
+		std::size_t count = max_digits;
+		if ((format & zero_padded) == 0) {
+			count = 1;
+			while (count < max_digits && (bits >> (count * 4)) != 0) {
+				++count;
+			}
+		}
+
+		for (std::size_t i = 0; i < count; ++i) {
+			dst[count - 1 - i] = table[(bits >> (i * 4)) & 0x0F];
+		}
+
+		return count;
+	}
+
+	// classic "offset  xx xx ... |ascii|" dump, fed incrementally and handed to Sink in large batches
+	// Sink is any callable taking (const char* data, std::size_t length)
+	template <typename Sink>
+	class dump_writer {
+		public:
+			static constexpr std::size_t bytes_per_line = 16;
+
+			explicit dump_writer(Sink sink, std::uint32_t format = lowercase, std::uint64_t base_offset = 0)
+				: _sink(sink), _format(format), _offset(base_offset) {}
+
+			dump_writer(const dump_writer&) = delete; // non copyable
+			~dump_writer(void) { flush(); }
+
+			void write(const void* data, std::size_t length) {
+				const std::uint8_t* bytes = static_cast<const std::uint8_t*>(data);
+
+				// complete a pending partial line first
+				if (_pending != 0) {
+					std::size_t count = length < bytes_per_line - _pending ? length : bytes_per_line - _pending;
+					std::memcpy(_line + _pending, bytes, count);
+					_pending += count;
+					bytes += count;
+					length -= count;
+
+					if (_pending < bytes_per_line) {
+						return;
+					}
+
+					emit_line(_line, bytes_per_line);
+					_pending = 0;
+				}
+
+				for (; length >= bytes_per_line; bytes += bytes_per_line, length -= bytes_per_line) {
+					emit_line(bytes, bytes_per_line);
+				}
+
+				std::memcpy(_line, bytes, length);
+				_pending = length;
+			}
+
+			// emits the trailing partial line and hands everything buffered to the sink
+			void flush(void) {
+				if (_pending != 0) {
+					emit_line(_line, _pending);
+					_pending = 0;
+				}
+
+				if (_used != 0) {
+					_sink(_buffer, _used);
+					_used = 0;
+				}
+			}
+
+		private:
+			// "0000000000000000  " + 16 * "xx " + " |" + 16 + "|\n"
+			static constexpr std::size_t line_length = 16 + 2 + bytes_per_line * 3 + 2 + bytes_per_line + 2;
+			static constexpr std::size_t buffer_lines = 64;
+
+			void emit_line(const std::uint8_t* bytes, std::size_t count) {
+				if (_used + line_length > sizeof(_buffer)) {
+					_sink(_buffer, _used);
+					_used = 0;
+				}
+
+				char* out = _buffer + _used;
+				char encoded[bytes_per_line * 2];
+
+				encode(bytes, count, encoded, _format);
+
+				out += format_integer(_offset, out, _format | zero_padded);
+				*out++ = ' ';
+				*out++ = ' ';
+
+				for (std::size_t i = 0; i < bytes_per_line; ++i) {
+					if (i < count) {
+						out[0] = encoded[i * 2];
+						out[1] = encoded[i * 2 + 1];
+					} else {
+						out[0] = ' ';
+						out[1] = ' ';
+					}
+
+					out[2] = ' ';
+					out += 3;
+				}
+
+				*out++ = ' ';
+				*out++ = '|';
+
+				for (std::size_t i = 0; i < count; ++i) {
+					*out++ = bytes[i] >= 0x20 && bytes[i] < 0x7F ? static_cast<char>(bytes[i]) : '.';
+				}
+
+				*out++ = '|';
+				*out++ = '\n';
+
+				_used = static_cast<std::size_t>(out - _buffer);
+				_offset += count;
+			}
+
+			Sink _sink;
+			std::uint32_t _format;
+			std::uint64_t _offset;
+			std::uint8_t _line[bytes_per_line] = {};
+			std::size_t _pending = 0;
+			char _buffer[line_length * buffer_lines] = {};
+			std::size_t _used = 0;
+	};
+}
@@ -0,0 +1,112 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+// hdr style histogram: values below 2^precision are counted exactly, larger values go to log2 buckets
+// split in 2^(precision - 1) linear sub buckets, bounding the relative error to 2^-(precision - 1)
+// recording is a handful of relaxed atomic operations, safe from any number of threads
+
+namespace histogram {
+
+	template <std::uint32_t Precision = 5>
+	class log_histogram {
+		public:
+			static_assert(Precision >= 2 && Precision <= 16, "histogram::log_histogram precision must be within [2, 16]");
+
+			static constexpr std::size_t linear_count = std::size_t(1) << Precision;
+			static constexpr std::size_t sub_bucket_count = std::size_t(1) << (Precision - 1);
+			static constexpr std::size_t bucket_count = linear_count + (64 - Precision) * sub_bucket_count;
+
+			log_histogram(void) = default;
+
+			log_histogram(const log_histogram&) = delete; // non copyable
+			log_histogram& operator= (const log_histogram&) = delete;
+
+			static std::size_t bucket_index(std::uint64_t value) {
+				if (value < linear_count) {
+					return static_cast<std::size_t>(value);
+				}
+
+				std::uint32_t shift = most_significant_bit(value) - (Precision - 1);
+				std::uint64_t top = value >> shift;
+
+				return linear_count + (shift - 1) * sub_bucket_count + static_cast<std::size_t>(top - sub_bucket_count);
+			}
+
+			// largest value counted in bucket index
+			static std::uint64_t bucket_upper_bound(std::size_t index) {
+				if (index < linear_count) {
+					return index;
+				}
+
+				std::size_t k = index - linear_count;
+				std::uint32_t shift = static_cast<std::uint32_t>(k / sub_bucket_count) + 1;
+				std::uint64_t top = (k % sub_bucket_count) + sub_bucket_count;
+
+				return ((top + 1) << shift) - 1;
+			}
+
+			void record(std::uint64_t value) {
+				_buckets[bucket_index(value)].fetch_add(1, std::memory_order_relaxed);
+				_count.fetch_add(1, std::memory_order_relaxed);
+				_sum.fetch_add(value, std::memory_order_relaxed);
+
+				std::uint64_t max = _max.load(std::memory_order_relaxed);
+				while (value > max && !_max.compare_exchange_weak(max, value, std::memory_order_relaxed)) {}
+
+				std::uint64_t min = _min.load(std::memory_order_relaxed);
+				while (value < min && !_min.compare_exchange_weak(min, value, std::memory_order_relaxed)) {}
+			}
+
+			std::uint64_t count(void) const { return _count.load(std::memory_order_relaxed); }
+			std::uint64_t sum(void) const { return _sum.load(std::memory_order_relaxed); }
+			std::uint64_t max(void) const { return _max.load(std::memory_order_relaxed); }
+			std::uint64_t min(void) const { return count() != 0 ? _min.load(std::memory_order_relaxed) : 0; }
+
+			// value at or below which `percentile` percent of the recorded values fall (upper bound of its bucket, capped to max)
+			std::uint64_t value_at_percentile(double percentile) const {
+				std::uint64_t total = count();
+				if (total == 0) {
+					return 0;
+				}
+
+				std::uint64_t target = static_cast<std::uint64_t>((percentile / 100.0) * static_cast<double>(total) + 0.5);
+				target = target == 0 ? 1 : (target > total ? total : target);
+
+				std::uint64_t seen = 0;
+				for (std::size_t i = 0; i < bucket_count; ++i) {
+					seen += _buckets[i].load(std::memory_order_relaxed);
+
+					if (seen >= target) {
+						std::uint64_t bound = bucket_upper_bound(i);
+						return bound < max() ? bound : max();
+					}
+				}
+
+				return max();
+			}
+
+		private:
+			static std::uint32_t most_significant_bit(std::uint64_t value) {
+#if defined(_MSC_VER)
+				unsigned long index = 0;
+				::_BitScanReverse64(&index, value);
+				return static_cast<std::uint32_t>(index);
+#else
+				return 63 - static_cast<std::uint32_t>(__builtin_clzll(value));
+#endif
+			}
+
+			std::atomic<std::uint64_t> _buckets[bucket_count] = {};
+			std::atomic<std::uint64_t> _count = { 0 };
+			std::atomic<std::uint64_t> _sum = { 0 };
+			std::atomic<std::uint64_t> _max = { 0 };
+			std::atomic<std::uint64_t> _min = { UINT64_MAX };
+	};
+}
@@ -1,12 +1,18 @@
 #pragma once
 
 #include "functor.hpp"
+#include "platform.hpp"
 
+#include <algorithm>
+#include <cassert>
 #include <string>
 #include <regex>
+#include <type_traits>
+#include <vector>
 
-#define NOMINMAX
-#include <windows.h>
+#if defined(__linux__) || defined(__APPLE__)
+#include <dlfcn.h>
+#endif
 
 // compact and light lazy loader version (no exception, no litterals, basic modules and imports management)
 
@@ -50,7 +56,7 @@ namespace lazy_loader_light {
 			return ::FreeLibrary(reinterpret_cast<HMODULE>(module_handle));
 		}
 	};
-#elif defined(__linux__) or defined(__APPLE__)
+#elif defined(__linux__) || defined(__APPLE__)
 	struct UnixLoader {
 		static std::uintptr_t load_module(const std::string& module_name) {
 			return reinterpret_cast<std::uintptr_t>(dlopen(module_name.c_str(), RTLD_NOW));
@@ -87,13 +93,13 @@ namespace lazy_loader_light {
 
 			template <typename ReturnType, typename ...Args>
 			ReturnType operator()(Args&&... args) const {
-				Functor<ReturnType(*)(Args ...)> functor(_ptr);
+				Functor<ReturnType(*)(std::decay_t<Args> ...)> functor(_ptr);
 				return functor(std::forward<Args>(args)...);
 			}
 
 			template <typename ReturnType, typename ...Args>
 			ReturnType call(Args&&... args) const {
-				Functor<ReturnType(*)(Args ...)> functor(_ptr);
+				Functor<ReturnType(*)(std::decay_t<Args> ...)> functor(_ptr);
 				return functor(std::forward<Args>(args)...);
 			}
 
@@ -145,7 +151,7 @@ namespace lazy_loader_light {
 					if (ptr == 0) {
 						std::string err = "cannot load function " + function_name;
 
-#if defined(__linux__) or defined(__APPLE__)
+#if defined(__linux__) || defined(__APPLE__)
 						err += " (" + std::string(dlerror()) + ")";
 #endif
 
@@ -275,7 +281,7 @@ namespace lazy_loader_light {
 					if (hmod == 0) {
 						std::string err = "cannot load module " + name;
 
-#if defined(__linux__) or defined(__APPLE__)
+#if defined(__linux__) || defined(__APPLE__)
 						err += " (" + std::string(dlerror()) + ")";
 #endif
 						return;
@@ -306,7 +312,7 @@ namespace lazy_loader_light {
 #if defined(_WIN64)
 	using lazymodule = basic_lazymodule<WindowsLoader>;
 	using lazymodulecollection = basic_lazymodulecollection<WindowsLoader>;
-#elif defined(__linux__) or defined(__APPLE__)
+#elif defined(__linux__) || defined(__APPLE__)
 	using lazymodule = basic_lazymodule<UnixLoader>;
 	using lazymodulecollection = basic_lazymodulecollection<UnixLoader>;
 #endif
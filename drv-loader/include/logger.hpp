@@ -0,0 +1,356 @@
+#pragma once
+
+#include <atomic>
+#include <charconv>
+#include <chrono>
+#include <condition_variable>
+#include <csignal>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+
+#if defined(_WIN32)
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+// asynchronous line logger: producers copy formatted lines into a lock-free ring, a background thread
+// writes them out in batches (info and below to stdout, warnings and errors to stderr)
+
+namespace logger {
+
+	typedef enum _level_t {
+		debug,
+		info,
+		warning,
+		error,
+
+		// number of entries in enum
+		n_level
+	} level_t;
+
+	// lines longer than this bypass the ring and are written synchronously
+	constexpr std::size_t max_line_length = 240;
+	constexpr std::size_t ring_size = 4096;
+
+	// the writer sleeps until this many lines are queued or max_latency has passed, so a burst of lines costs one wake up
+	constexpr std::size_t wake_threshold = ring_size / 4;
+	constexpr std::chrono::milliseconds max_latency(50);
+
+	static_assert((ring_size & (ring_size - 1)) == 0, "logger::ring_size must be a power of two");
+
+	namespace detail {
+
+		typedef struct _slot_t {
+			std::atomic<std::size_t> sequence;
+			std::uint32_t level;
+			std::uint32_t length;
+			char text[max_line_length];
+		} slot_t, *pslot_t;
+
+		static void write_fd(int fd, const char* data, std::size_t length) {
+			while (length != 0) {
+#if defined(_WIN32)
+				int written = ::_write(fd, data, static_cast<unsigned int>(length));
+#else
+				ssize_t written = ::write(fd, data, length);
+#endif
+				if (written <= 0) {
+					return;
+				}
+
+				data += written;
+				length -= static_cast<std::size_t>(written);
+			}
+		}
+
+		static int level_fd(std::uint32_t level) {
+			return level >= warning ? 2 : 1;
+		}
+
+		// bounded formatting into a caller buffer, keeps the total length even when truncating
+		typedef struct _line_t {
+			char* data;
+			std::size_t capacity;
+			std::size_t length;
+
+			void append(const char* str, std::size_t count) {
+				if (length < capacity) {
+					std::memcpy(data + length, str, count < capacity - length ? count : capacity - length);
+				}
+
+				length += count;
+			}
+		} line_t, *pline_t;
+
+		static void append(line_t& line, const char* str) { line.append(str, std::strlen(str)); }
+		static void append(line_t& line, const std::string& str) { line.append(str.data(), str.size()); }
+		static void append(line_t& line, std::string_view str) { line.append(str.data(), str.size()); }
+		static void append(line_t& line, char c) { line.append(&c, 1); }
+
+		template <typename T, typename = typename std::enable_if<std::is_integral<T>::value>::type>
+		static void append(line_t& line, T value) {
+			char digits[24];
+			std::to_chars_result res = std::to_chars(digits, digits + sizeof(digits), value);
+			line.append(digits, static_cast<std::size_t>(res.ptr - digits));
+		}
+	}
+
+	class async_logger {
+		public:
+			static async_logger& instance() {
+				static async_logger instance;
+				return instance;
+			}
+
+			void set_level(level_t level) {
+				_min_level.store(level, std::memory_order_relaxed);
+			}
+
+			bool enabled(level_t level) const {
+				return level >= _min_level.load(std::memory_order_relaxed);
+			}
+
+			// queues an already formatted line (without its trailing new line)
+			void write(level_t level, const char* text, std::size_t length) {
+				if (!enabled(level)) {
+					return;
+				}
+
+				if (length > max_line_length) {
+					write_direct(level, text, length);
+					return;
+				}
+
+				// the ring is full: help the writer instead of dropping the line
+				while (!try_enqueue(level, text, length)) {
+					flush();
+				}
+
+				if (queued() >= wake_threshold && _writer_sleeping.load() && _writer_sleeping.exchange(false)) {
+					std::lock_guard<std::mutex> lock(_wake_mutex);
+					_wake.notify_one();
+				}
+			}
+
+			// concatenates strings, characters and integers without touching the heap
+			template <typename ...Parts>
+			void log(level_t level, const Parts& ...parts) {
+				if (!enabled(level)) {
+					return;
+				}
+
+				char buffer[max_line_length];
+				detail::line_t line = { buffer, sizeof(buffer), 0 };
+				(detail::append(line, parts), ...);
+
+				if (line.length <= sizeof(buffer)) {
+					write(level, buffer, line.length);
+					return;
+				}
+
+				// rare oversized line, format it again without bounds
+				std::string text;
+				text.resize(line.length);
+				detail::line_t full = { text.data(), text.size(), 0 };
+				(detail::append(full, parts), ...);
+				write(level, text.data(), text.size());
+			}
+
+			// synchronously writes every queued line
+			void flush(void) {
+				std::lock_guard<std::mutex> lock(_consumer_mutex);
+				drain();
+			}
+
+			// flushes on std::terminate and fatal signals before the process dies
+			void install_crash_handlers(void) {
+				static std::terminate_handler previous = std::set_terminate([]() {
+					async_logger::instance().flush();
+
+					if (previous != nullptr) {
+						previous();
+					}
+
+					std::abort();
+				});
+
+				for (int sig : { SIGABRT, SIGSEGV, SIGILL, SIGFPE }) {
+					std::signal(sig, [](int signal_number) {
+						// best effort, the writer may hold the consumer lock already
+						if (async_logger::instance()._consumer_mutex.try_lock()) {
+							async_logger::instance().drain();
+							async_logger::instance()._consumer_mutex.unlock();
+						}
+
+						std::signal(signal_number, SIG_DFL);
+						std::raise(signal_number);
+					});
+				}
+			}
+
+		private:
+			async_logger(void) : _ring(new detail::slot_t[ring_size]) {
+				for (std::size_t i = 0; i < ring_size; ++i) {
+					_ring[i].sequence.store(i, std::memory_order_relaxed);
+				}
+
+				_writer = std::thread([this]() { run(); });
+			}
+
+			~async_logger(void) {
+				{
+					std::lock_guard<std::mutex> lock(_wake_mutex);
+					_running.store(false);
+				}
+
+				_wake.notify_one();
+
+				if (_writer.joinable()) {
+					_writer.join();
+				}
+
+				flush();
+			}
+
+			async_logger(const async_logger&) = delete;
+			async_logger& operator= (const async_logger&) = delete;
+
+			// bounded multi producer queue (Vyukov), every slot carries the position it expects next
+			bool try_enqueue(level_t level, const char* text, std::size_t length) {
+				std::size_t position = _enqueue_position.load(std::memory_order_relaxed);
+				detail::slot_t* slot = nullptr;
+
+				for (;;) {
+					slot = &_ring[position & (ring_size - 1)];
+					std::size_t sequence = slot->sequence.load(std::memory_order_acquire);
+					std::intptr_t difference = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(position);
+
+					if (difference == 0) {
+						if (_enqueue_position.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+							break;
+						}
+					} else if (difference < 0) {
+						return false;
+					} else {
+						position = _enqueue_position.load(std::memory_order_relaxed);
+					}
+				}
+
+				slot->level = level;
+				slot->length = static_cast<std::uint32_t>(length);
+				std::memcpy(slot->text, text, length);
+				slot->sequence.store(position + 1, std::memory_order_release);
+
+				return true;
+			}
+
+			// lines reserved by producers and not written yet, read without synchronization as a wake up hint
+			std::size_t queued(void) const {
+				return _enqueue_position.load(std::memory_order_relaxed) - _dequeue_position.load(std::memory_order_relaxed);
+			}
+
+			// consumer side, called with _consumer_mutex held
+			void drain(void) {
+				std::size_t used = 0;
+				std::size_t position = _dequeue_position.load(std::memory_order_relaxed);
+				int fd = 1;
+
+				// the position is published once at the end, producers only read it as a hint
+				for (;; ++position) {
+					detail::slot_t& slot = _ring[position & (ring_size - 1)];
+
+					if (slot.sequence.load(std::memory_order_acquire) != position + 1) {
+						break;
+					}
+
+					int slot_fd = detail::level_fd(slot.level);
+
+					// keep ordering between the two streams, and batch as much as fits
+					if (used != 0 && (slot_fd != fd || used + slot.length + 1 > sizeof(_batch))) {
+						detail::write_fd(fd, _batch, used);
+						used = 0;
+					}
+
+					fd = slot_fd;
+					std::memcpy(_batch + used, slot.text, slot.length);
+					used += slot.length;
+					_batch[used++] = '\n';
+
+					slot.sequence.store(position + ring_size, std::memory_order_release);
+				}
+
+				_dequeue_position.store(position, std::memory_order_relaxed);
+
+				if (used != 0) {
+					detail::write_fd(fd, _batch, used);
+				}
+			}
+
+			void write_direct(level_t level, const char* text, std::size_t length) {
+				std::lock_guard<std::mutex> lock(_consumer_mutex);
+				drain();
+
+				int fd = detail::level_fd(level);
+				detail::write_fd(fd, text, length);
+				detail::write_fd(fd, "\n", 1);
+			}
+
+			void run(void) {
+				while (_running.load()) {
+					flush();
+
+					std::unique_lock<std::mutex> lock(_wake_mutex);
+					_writer_sleeping.store(true);
+
+					// the timeout bounds the latency of the lines queued below the threshold
+					_wake.wait_for(lock, max_latency, [this]() { return !_running.load() || queued() >= wake_threshold; });
+					_writer_sleeping.store(false);
+				}
+			}
+
+			std::unique_ptr<detail::slot_t[]> _ring;
+			alignas(64) std::atomic<std::size_t> _enqueue_position = { 0 };
+			alignas(64) std::atomic<std::size_t> _dequeue_position = { 0 };
+			std::atomic<level_t> _min_level = { info };
+
+			std::mutex _consumer_mutex;
+			char _batch[64 * 1024];
+
+			std::mutex _wake_mutex;
+			std::condition_variable _wake;
+			std::atomic<bool> _writer_sleeping = { false };
+			std::atomic<bool> _running = { true };
+			std::thread _writer;
+	};
+
+	template <typename ...Parts>
+	static void log(level_t level, const Parts& ...parts) {
+		async_logger::instance().log(level, parts...);
+	}
+
+	template <typename ...Parts>
+	static void debug_line(const Parts& ...parts) { log(debug, parts...); }
+
+	template <typename ...Parts>
+	static void info_line(const Parts& ...parts) { log(info, parts...); }
+
+	template <typename ...Parts>
+	static void warning_line(const Parts& ...parts) { log(warning, parts...); }
+
+	template <typename ...Parts>
+	static void error_line(const Parts& ...parts) { log(error, parts...); }
+
+	static void flush(void) {
+		async_logger::instance().flush();
+	}
+}
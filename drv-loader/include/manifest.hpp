@@ -0,0 +1,144 @@
+#pragma once
+
+#include "drv-loader.hpp"
+
+#include <cstddef>
+#include <fstream>
+#include <string>
+#include <vector>
+
+// batch file for --manifest, one operation per line:
+//
+//   # operation  display name  [depends_on=names]  driver path (rest of the line, load only)
+//   load         MyDriver                          C:\drivers\my driver.sys
+//   load         MyFilter      depends_on=MyDriver C:\drivers\my filter.sys
+//   unload       OtherDriver
+//
+// fields are separated by spaces or tabs, blank lines and lines starting with '#' are skipped
+// depends_on takes comma separated display names, see scheduler.hpp for the ordering it implies
+
+namespace manifest {
+
+	typedef struct _parse_error_t {
+		std::size_t line; // 1 based, 0 when the file could not be read
+		const char* reason;
+	} parse_error_t, *pparse_error_t;
+
+	namespace detail {
+
+		static bool is_blank(char c) {
+			return c == ' ' || c == '\t' || c == '\r';
+		}
+
+		// next blank separated field of line starting at position, empty at the end of the line
+		static std::string next_field(const std::string& line, std::size_t& position) {
+			while (position < line.size() && is_blank(line[position])) {
+				++position;
+			}
+
+			std::size_t begin = position;
+			while (position < line.size() && !is_blank(line[position])) {
+				++position;
+			}
+
+			return line.substr(begin, position - begin);
+		}
+
+		// comma separated, false on an empty name
+		static bool split_names(const std::string& list, std::vector<std::string>& out) {
+			std::size_t begin = 0;
+
+			while (begin <= list.size()) {
+				std::size_t end = list.find(',', begin);
+				end = end == std::string::npos ? list.size() : end;
+
+				if (end == begin) {
+					return false;
+				}
+
+				out.push_back(list.substr(begin, end - begin));
+				begin = end + 1;
+			}
+
+			return true;
+		}
+
+		static std::string rest_of_line(const std::string& line, std::size_t position) {
+			while (position < line.size() && is_blank(line[position])) {
+				++position;
+			}
+
+			std::size_t end = line.size();
+			while (end > position && is_blank(line[end - 1])) {
+				--end;
+			}
+
+			return line.substr(position, end - position);
+		}
+	}
+
+	// appends one config per entry, every entry inherits the tolerated statuses of defaults
+	static bool parse(std::istream& input, const drv_loader::config_t& defaults, std::vector<drv_loader::config_t>& out, parse_error_t& error) {
+		std::string line;
+
+		for (std::size_t line_number = 1; std::getline(input, line); ++line_number) {
+			std::size_t position = 0;
+			std::string operation = detail::next_field(line, position);
+
+			if (operation.empty() || operation[0] == '#') {
+				continue;
+			}
+
+			drv_loader::config_t config = defaults;
+			config.display_name = detail::next_field(line, position);
+
+			constexpr char depends_on[] = "depends_on=";
+			std::size_t field_start = position;
+			std::string field = detail::next_field(line, position);
+
+			if (field.compare(0, sizeof(depends_on) - 1, depends_on) == 0) {
+				if (!detail::split_names(field.substr(sizeof(depends_on) - 1), config.depends_on)) {
+					error = { line_number, "empty name in depends_on" };
+					return false;
+				}
+			} else {
+				position = field_start;
+			}
+
+			config.file_path = detail::rest_of_line(line, position);
+
+			if (operation == "load") {
+				config.operation = drv_loader::loader_operation_t::load;
+			} else if (operation == "unload") {
+				config.operation = drv_loader::loader_operation_t::unload;
+			} else {
+				error = { line_number, "unrecognized operation" };
+				return false;
+			}
+
+			if (config.display_name.empty()) {
+				error = { line_number, "missing display name" };
+				return false;
+			}
+
+			if (config.operation == drv_loader::loader_operation_t::load && config.file_path.empty()) {
+				error = { line_number, "missing driver path" };
+				return false;
+			}
+
+			out.push_back(config);
+		}
+
+		return true;
+	}
+
+	static bool read(const std::string& path, const drv_loader::config_t& defaults, std::vector<drv_loader::config_t>& out, parse_error_t& error) {
+		std::ifstream input(path);
+		if (!input) {
+			error = { 0, "cannot open file" };
+			return false;
+		}
+
+		return parse(input, defaults, out, error);
+	}
+}
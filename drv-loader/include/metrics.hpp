@@ -0,0 +1,183 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+
+// hot path counters (one cache line each so concurrent workers do not false share) and their json / openmetrics export
+
+namespace metrics {
+
+	class alignas(64) counter {
+		public:
+			counter(void) = default;
+
+			counter(const counter&) = delete; // non copyable
+			counter& operator= (const counter&) = delete;
+
+			void increment(std::uint64_t amount = 1) {
+				_value.fetch_add(amount, std::memory_order_relaxed);
+			}
+
+			std::uint64_t value(void) const {
+				return _value.load(std::memory_order_relaxed);
+			}
+
+		private:
+			std::atomic<std::uint64_t> _value = { 0 };
+	};
+
+	// counts occurrences of (domain, code) pairs in a lock-free open addressing table
+	// pairs that do not fit anymore are accumulated in overflow()
+	template <std::size_t Capacity>
+	class code_counters {
+		public:
+			static_assert((Capacity & (Capacity - 1)) == 0, "metrics::code_counters capacity must be a power of two");
+
+			code_counters(void) = default;
+
+			code_counters(const code_counters&) = delete; // non copyable
+			code_counters& operator= (const code_counters&) = delete;
+
+			// domain must not be zero, a zero key marks an empty entry
+			void increment(std::uint32_t domain, std::uint32_t code) {
+				std::uint64_t key = (static_cast<std::uint64_t>(domain) << 32) | code;
+				std::size_t index = static_cast<std::size_t>((key * 0x9E3779B97F4A7C15ull) >> 32) & (Capacity - 1);
+
+				for (std::size_t probe = 0; probe < Capacity; ++probe) {
+					entry_t& entry = _entries[(index + probe) & (Capacity - 1)];
+					std::uint64_t current = entry.key.load(std::memory_order_acquire);
+
+					if (current == 0) {
+						std::uint64_t expected = 0;
+						if (entry.key.compare_exchange_strong(expected, key, std::memory_order_acq_rel)) {
+							current = key;
+						} else {
+							current = expected;
+						}
+					}
+
+					if (current == key) {
+						entry.count.fetch_add(1, std::memory_order_relaxed);
+						return;
+					}
+				}
+
+				_overflow.fetch_add(1, std::memory_order_relaxed);
+			}
+
+			// fn(std::uint32_t domain, std::uint32_t code, std::uint64_t count)
+			template <typename Fn>
+			void for_each(Fn fn) const {
+				for (const entry_t& entry : _entries) {
+					std::uint64_t key = entry.key.load(std::memory_order_acquire);
+
+					if (key != 0) {
+						fn(static_cast<std::uint32_t>(key >> 32), static_cast<std::uint32_t>(key), entry.count.load(std::memory_order_relaxed));
+					}
+				}
+			}
+
+			std::uint64_t overflow(void) const {
+				return _overflow.load(std::memory_order_relaxed);
+			}
+
+		private:
+			typedef struct _entry_t {
+				std::atomic<std::uint64_t> key;
+				std::atomic<std::uint64_t> count;
+			} entry_t, *pentry_t;
+
+			entry_t _entries[Capacity] = {};
+			std::atomic<std::uint64_t> _overflow = { 0 };
+	};
+
+	typedef enum _format_t {
+		json,
+		openmetrics,
+
+		// number of entries in enum
+		n_format
+	} format_t;
+
+	typedef struct _label_t {
+		const char* name;
+		const char* value;
+	} label_t, *plabel_t;
+
+	// writes counter families, names and label values are expected to need no escaping
+	//   json:        { "<family>": { "help": "...", "samples": [ { "labels": { ... }, "value": n } ] } }
+	//   openmetrics: # HELP / # TYPE lines then "<family>_total{...} n" samples, terminated by # EOF
+	class family_writer {
+		public:
+			family_writer(std::FILE* file, format_t format) : _file(file), _format(format) {
+				if (_format == json) {
+					std::fputs("{", _file);
+				}
+			}
+
+			family_writer(const family_writer&) = delete; // non copyable
+			family_writer& operator= (const family_writer&) = delete;
+
+			void family(const char* name, const char* help) {
+				close_family();
+
+				if (_format == json) {
+					std::fprintf(_file, "%s\n\"%s\": {\"help\": \"%s\", \"samples\": [", _families != 0 ? "," : "", name, help);
+				} else {
+					std::fprintf(_file, "# HELP %s %s\n# TYPE %s counter\n", name, help, name);
+				}
+
+				_name = name;
+				_samples = 0;
+				++_families;
+			}
+
+			void sample(std::uint64_t value, const label_t* labels = nullptr, std::size_t label_count = 0) {
+				if (_format == json) {
+					std::fputs(_samples != 0 ? ", {" : "{", _file);
+
+					if (label_count != 0) {
+						std::fputs("\"labels\": {", _file);
+
+						for (std::size_t i = 0; i < label_count; ++i) {
+							std::fprintf(_file, "%s\"%s\": \"%s\"", i != 0 ? ", " : "", labels[i].name, labels[i].value);
+						}
+
+						std::fputs("}, ", _file);
+					}
+
+					std::fprintf(_file, "\"value\": %llu}", static_cast<unsigned long long>(value));
+				} else {
+					std::fprintf(_file, "%s_total", _name);
+
+					for (std::size_t i = 0; i < label_count; ++i) {
+						std::fprintf(_file, "%s%s=\"%s\"", i == 0 ? "{" : ",", labels[i].name, labels[i].value);
+					}
+
+					std::fprintf(_file, "%s %llu\n", label_count != 0 ? "}" : "", static_cast<unsigned long long>(value));
+				}
+
+				++_samples;
+			}
+
+			void finish(void) {
+				close_family();
+				std::fputs(_format == json ? "\n}\n" : "# EOF\n", _file);
+			}
+
+		private:
+			void close_family(void) {
+				if (_format == json && _families != 0) {
+					std::fputs("]}", _file);
+				}
+			}
+
+			std::FILE* _file;
+			format_t _format;
+			const char* _name = nullptr;
+			std::size_t _families = 0;
+			std::size_t _samples = 0;
+	};
+}
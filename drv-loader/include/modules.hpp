@@ -0,0 +1,209 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+#include <vector>
+
+// read only view over the NtQuerySystemInformation(SystemModuleInformation) output (RTL_PROCESS_MODULES):
+//
+//   ULONG NumberOfModules;                       padded to pointer alignment
+//   RTL_PROCESS_MODULE_INFORMATION Modules[];    296 bytes each on x64, 284 on x86:
+//     HANDLE Section; PVOID MappedBase; PVOID ImageBase;
+//     ULONG ImageSize; ULONG Flags;
+//     USHORT LoadOrderIndex; USHORT InitOrderIndex; USHORT LoadCount; USHORT OffsetToFileName;
+//     UCHAR FullPathName[256];                   nul terminated, base name at OffsetToFileName
+//
+// fields are read with memcpy at fixed offsets, so a blob captured on another machine parses anywhere
+// module_index keeps the parsed entries with an open addressing table over their base names, for constant time lookups
+
+namespace modules {
+
+	// offsets of one pointer size, entries start at header_size
+	typedef struct _layout_t {
+		std::size_t header_size;
+		std::size_t entry_size;
+		std::size_t pointer_size;
+		std::size_t image_base;
+		std::size_t image_size;
+		std::size_t load_order_index;
+		std::size_t load_count;
+		std::size_t offset_to_file_name;
+		std::size_t full_path_name;
+	} layout_t, *playout_t;
+
+	constexpr layout_t layout_x64 = { 8, 296, 8, 16, 24, 32, 36, 38, 40 };
+	constexpr layout_t layout_x86 = { 4, 284, 4, 8, 12, 20, 24, 26, 28 };
+	constexpr layout_t host_layout = sizeof(void*) == 8 ? layout_x64 : layout_x86;
+
+	constexpr std::size_t max_full_path_name = 256;
+
+	typedef struct _module_t {
+		std::uint64_t image_base;
+		std::uint32_t image_size;
+		std::uint16_t load_order_index;
+		std::uint16_t load_count;
+		std::string_view full_path; // into the blob
+		std::string_view base_name; // suffix of full_path
+	} module_t, *pmodule_t;
+
+	namespace detail {
+
+		template <typename T>
+		static T read(const std::uint8_t* at) {
+			T value;
+			std::memcpy(&value, at, sizeof(T));
+			return value;
+		}
+	}
+
+	class module_list {
+		public:
+			module_list(void) = default;
+
+			// false when the blob is shorter than its module count claims, the list is then empty
+			bool assign(const std::uint8_t* blob, std::size_t size, const layout_t& layout = host_layout) {
+				_blob = blob;
+				_layout = &layout;
+				_count = 0;
+
+				if (size < layout.header_size) {
+					return false;
+				}
+
+				std::size_t count = detail::read<std::uint32_t>(blob);
+				if (count > (size - layout.header_size) / layout.entry_size) {
+					return false;
+				}
+
+				_count = count;
+				return true;
+			}
+
+			std::size_t size(void) const { return _count; }
+
+			// a malformed OffsetToFileName yields the full path as base name
+			module_t at(std::size_t index) const {
+				const std::uint8_t* entry = _blob + _layout->header_size + index * _layout->entry_size;
+				const char* path = reinterpret_cast<const char*>(entry + _layout->full_path_name);
+
+				module_t module = {};
+				module.image_base = _layout->pointer_size == 8 ? detail::read<std::uint64_t>(entry + _layout->image_base) : detail::read<std::uint32_t>(entry + _layout->image_base);
+				module.image_size = detail::read<std::uint32_t>(entry + _layout->image_size);
+				module.load_order_index = detail::read<std::uint16_t>(entry + _layout->load_order_index);
+				module.load_count = detail::read<std::uint16_t>(entry + _layout->load_count);
+
+				const void* nul = std::memchr(path, '\0', max_full_path_name);
+				module.full_path = std::string_view(path, nul != nullptr ? static_cast<const char*>(nul) - path : max_full_path_name);
+
+				std::size_t offset = detail::read<std::uint16_t>(entry + _layout->offset_to_file_name);
+				module.base_name = offset < module.full_path.size() ? module.full_path.substr(offset) : module.full_path;
+
+				return module;
+			}
+
+		private:
+			const std::uint8_t* _blob = nullptr;
+			const layout_t* _layout = &host_layout;
+			std::size_t _count = 0;
+	};
+
+	static char fold(char c) {
+		return (c >= 'A' && c <= 'Z') ? static_cast<char>(c - 'A' + 'a') : c;
+	}
+
+	// ascii case insensitive, like the kernel compares image paths
+	static bool equal_path(std::string_view lhs, std::string_view rhs) {
+		if (lhs.size() != rhs.size()) {
+			return false;
+		}
+
+		for (std::size_t i = 0; i < lhs.size(); ++i) {
+			if (fold(lhs[i]) != fold(rhs[i])) {
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	// fnv-1a of the folded name
+	static std::uint32_t hash_name(std::string_view name) {
+		std::uint32_t hash = 2166136261u;
+
+		for (char c : name) {
+			hash = (hash ^ static_cast<std::uint8_t>(fold(c))) * 16777619u;
+		}
+
+		return hash;
+	}
+
+	// the modules of a list by load order and by base name, views point into the blob which must outlive the index
+	// base names are unique in a kernel, should a blob repeat one the first module keeps it
+	class module_index {
+		public:
+			module_index(void) = default;
+
+			module_index(const module_index&) = delete; // non copyable
+			module_index& operator= (const module_index&) = delete;
+
+			void build(const module_list& list) {
+				std::size_t count = list.size();
+				std::size_t capacity = 1;
+
+				while (capacity < 2 * count) {
+					capacity *= 2;
+				}
+
+				_modules.clear();
+				_modules.reserve(count);
+				_hashes.clear();
+				_hashes.reserve(count);
+				_slots.assign(capacity, empty_slot);
+
+				for (std::size_t i = 0; i < count; ++i) {
+					_modules.push_back(list.at(i));
+					_hashes.push_back(hash_name(_modules.back().base_name));
+
+					std::size_t slot = probe(_modules.back().base_name, _hashes.back());
+					if (_slots[slot] == empty_slot) {
+						_slots[slot] = static_cast<std::uint32_t>(i);
+					}
+				}
+			}
+
+			std::size_t size(void) const { return _modules.size(); }
+			const module_t& at(std::size_t index) const { return _modules[index]; }
+
+			// case insensitive, nullptr when no module has this base name
+			const module_t* find(std::string_view base_name) const {
+				if (_modules.empty()) {
+					return nullptr;
+				}
+
+				std::uint32_t index = _slots[probe(base_name, hash_name(base_name))];
+				return index != empty_slot ? &_modules[index] : nullptr;
+			}
+
+		private:
+			static constexpr std::uint32_t empty_slot = 0xFFFFFFFF;
+
+			// slot holding base_name, or the empty slot ending its probe sequence; the table is at most half full
+			std::size_t probe(std::string_view base_name, std::uint32_t hash) const {
+				std::size_t mask = _slots.size() - 1;
+
+				for (std::size_t slot = hash & mask;; slot = (slot + 1) & mask) {
+					std::uint32_t index = _slots[slot];
+
+					if (index == empty_slot || (_hashes[index] == hash && equal_path(_modules[index].base_name, base_name))) {
+						return slot;
+					}
+				}
+			}
+
+			std::vector<module_t> _modules;
+			std::vector<std::uint32_t> _hashes; // of each module base name
+			std::vector<std::uint32_t> _slots; // module indices, power of two sized
+	};
+}
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <cstdint>
+#include <type_traits>
+
+// NTSTATUS decomposition, all accessors are constexpr shifts and masks
+//
+//   3 3 2 2 2 2 2 2 2 2 2 2 1 1 1 1 1 1 1 1 1 1
+//   1 0 9 8 7 6 5 4 3 2 1 0 9 8 7 6 5 4 3 2 1 0 9 8 7 6 5 4 3 2 1 0
+//  +---+-+-+-----------------------+-------------------------------+
+//  |Sev|C|R|     Facility          |               Code            |
+//  +---+-+-+-----------------------+-------------------------------+
+
+namespace nt {
+
+	typedef enum _severity_t {
+		severity_success,
+		severity_informational,
+		severity_warning,
+		severity_error,
+
+		// number of entries in enum
+		n_severity
+	} severity_t;
+
+	static const char* severity_name(severity_t severity) {
+		constexpr const char* names[] = {
+			"success",
+			"informational",
+			"warning",
+			"error",
+		};
+
+		return severity < n_severity ? names[severity] : "unknown";
+	}
+
+	// FACILITY_* values of ntstatus.hpp, without the prefix
+	constexpr const char* facility_name(std::uint32_t facility) {
+		constexpr const char* names[0x40] = {
+			"NONE", "DEBUGGER", "RPC_RUNTIME", "RPC_STUBS", "IO_ERROR_CODE", nullptr, nullptr, "NTWIN32",
+			"NTCERT", "NTSSPI", "TERMINAL_SERVER", "MUI_ERROR_CODE", nullptr, nullptr, nullptr, nullptr,
+			"USB_ERROR_CODE", "HID_ERROR_CODE", "FIREWIRE_ERROR_CODE", "CLUSTER_ERROR_CODE", "ACPI_ERROR_CODE", "SXS_ERROR_CODE", nullptr, nullptr,
+			nullptr, "TRANSACTION", "COMMONLOG", "VIDEO", "FILTER_MANAGER", "MONITOR", "GRAPHICS_KERNEL", nullptr,
+			"DRIVER_FRAMEWORK", "FVE_ERROR_CODE", "FWP_ERROR_CODE", "NDIS_ERROR_CODE", nullptr, nullptr, nullptr, nullptr,
+			nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr,
+			nullptr, nullptr, nullptr, nullptr, nullptr, "HYPERVISOR", "IPSEC", "VIRTUALIZATION",
+			"VOLMGR", "BCD_ERROR_CODE", nullptr, nullptr, "DIS", nullptr, "WIN32K_NTUSER", "WIN32K_NTGDI",
+		};
+
+		return facility < 0x40 && names[facility] != nullptr ? names[facility] : "unknown";
+	}
+
+	class nt_status {
+		public:
+			constexpr nt_status(void) : _value(0) {}
+
+			// accepts NTSTATUS (a 32 bits signed long on windows) as well as raw unsigned values
+			template <typename T, typename = typename std::enable_if<std::is_integral<T>::value>::type>
+			constexpr explicit nt_status(T value) : _value(static_cast<std::uint32_t>(value)) {}
+
+			constexpr std::uint32_t value(void) const { return _value; }
+
+			constexpr severity_t severity(void) const { return static_cast<severity_t>(_value >> 30); }
+			constexpr bool customer(void) const { return (_value & 0x20000000) != 0; }
+			constexpr std::uint32_t facility(void) const { return (_value >> 16) & 0xFFF; }
+			constexpr std::uint32_t code(void) const { return _value & 0xFFFF; }
+
+			// NT_SUCCESS: success and informational severities
+			constexpr bool is_success(void) const { return (_value & 0x80000000) == 0; }
+			constexpr bool is_informational(void) const { return severity() == severity_informational; }
+			constexpr bool is_warning(void) const { return severity() == severity_warning; }
+			constexpr bool is_error(void) const { return severity() == severity_error; }
+
+			constexpr const char* facility_name(void) const { return nt::facility_name(facility()); }
+
+			constexpr bool operator== (const nt_status& other) const { return _value == other._value; }
+			constexpr bool operator!= (const nt_status& other) const { return _value != other._value; }
+
+		private:
+			std::uint32_t _value;
+	};
+
+	static_assert(sizeof(nt_status) == sizeof(std::uint32_t), "nt::nt_status must stay a plain 32 bits value");
+}
@@ -0,0 +1,25 @@
+#pragma once
+
+// the NTSTATUS codes the loader compares against, so translation units do not parse the 18k lines of ntstatus.hpp
+// spelled exactly as in ntstatus.hpp: either header can be included before the other without redefinition warnings
+// names, messages and every other code are available through ntstatus_table.hpp
+
+#ifndef STATUS_SUCCESS
+#define STATUS_SUCCESS                          ((NTSTATUS)0x00000000L)
+#endif
+
+#ifndef STATUS_INFO_LENGTH_MISMATCH
+#define STATUS_INFO_LENGTH_MISMATCH      ((NTSTATUS)0xC0000004L)
+#endif
+
+#ifndef STATUS_OBJECT_NAME_NOT_FOUND
+#define STATUS_OBJECT_NAME_NOT_FOUND     ((NTSTATUS)0xC0000034L)
+#endif
+
+#ifndef STATUS_INSUFFICIENT_RESOURCES
+#define STATUS_INSUFFICIENT_RESOURCES    ((NTSTATUS)0xC000009AL)
+#endif
+
+#ifndef STATUS_IMAGE_ALREADY_LOADED
+#define STATUS_IMAGE_ALREADY_LOADED      ((NTSTATUS)0xC000010EL)
+#endif
@@ -0,0 +1,4021 @@
+#pragma once
+
+// generated by tools/gen_status_table.py from ntstatus.hpp, do not edit
+// 2008 entries, 2006 distinct codes
+
+#include <cstdint>
+
+#include "status_table.hpp"
+
+namespace ntstatus_table {
+
+	namespace detail {
+
+		constexpr const char page_0[] =
+			"STATUS_SUCCESSSTATUS_WAIT_0STATUS_WAIT_1STATUS_WAIT_2STATUS_WAIT_3STATUS_WAIT_63STATUS_ABANDONEDSTATUS_ABANDONED_WAIT_0STATUS_ABANDONED_WAIT_63"
+			"STATUS_USER_APCSTATUS_KERNEL_APCSTATUS_ALERTEDSTATUS_TIMEOUTSTATUS_PENDINGThe operation that was requested is pending completion."
+			"STATUS_REPARSEA reparse should be performed by the Object Manager since the name of the file resulted in a symbolic link."
+			"STATUS_MORE_ENTRIESReturned by enumeration APIs to indicate more information is available to successive calls.STATUS_NOT_ALL_ASSIGNED"
+			"Indicates not all privileges or groups referenced are assigned to the caller. This allows, for example, all privileges to be disabled without having to know exactly which privileges are assigned."
+			"STATUS_SOME_NOT_MAPPEDSome of the information to be translated has not been translated.STATUS_OPLOCK_BREAK_IN_PROGRESSAn open/create operation completed while an oplock break is underway."
+			"STATUS_VOLUME_MOUNTEDA new volume has been mounted by a file system.STATUS_RXACT_COMMITTEDThis success level status indicates that the transaction state already exists for the registry sub-tree, but that a transaction commit was previously aborted. The commit has now been completed."
+			"STATUS_NOTIFY_CLEANUPThis indicates that a notify change request has been completed due to closing the handle which made the notify change request."
+			"STATUS_NOTIFY_ENUM_DIRThis indicates that a notify change request is being completed and that the information is not being returned in the caller's buffer. The caller now needs to enumerate the files to find the changes."
+			"STATUS_NO_QUOTAS_FOR_ACCOUNT{No Quotas} No system quota limits are specifically set for this account.STATUS_PRIMARY_TRANSPORT_CONNECT_FAILED"
+			"{Connect Failure on Primary Transport} An attempt was made to connect to the remote server %hs on the primary transport, but the connection failed. The computer WAS able to connect on a secondary transport."
+			"STATUS_PAGE_FAULT_TRANSITIONPage fault was a transition fault.STATUS_PAGE_FAULT_DEMAND_ZEROPage fault was a demand zero fault."
+			"STATUS_PAGE_FAULT_COPY_ON_WRITESTATUS_PAGE_FAULT_GUARD_PAGESTATUS_PAGE_FAULT_PAGING_FILEPage fault was satisfied by reading from a secondary storage device."
+			"STATUS_CACHE_PAGE_LOCKEDCached page was locked during operation.STATUS_CRASH_DUMPCrash dump exists in paging file.STATUS_BUFFER_ALL_ZEROS"
+			"Specified buffer contains all zeros.STATUS_REPARSE_OBJECTSTATUS_RESOURCE_REQUIREMENTS_CHANGEDThe device has succeeded a query-stop and its resource requirements have changed."
+			"STATUS_TRANSLATION_COMPLETEThe translator has translated these resources into the global space and no further translations should be performed."
+			"STATUS_DS_MEMBERSHIP_EVALUATED_LOCALLYThe directory service evaluated group memberships locally, as it was unable to contact a global catalog server."
+			"STATUS_NOTHING_TO_TERMINATEA process being terminated has no threads to terminate.STATUS_PROCESS_NOT_IN_JOBThe specified process is not part of a job."
+			"STATUS_PROCESS_IN_JOBThe specified process is part of a job.STATUS_VOLSNAP_HIBERNATE_READY{Volume Shadow Copy Service} The system is now ready for hibernation."
+			"STATUS_FSFILTER_OP_COMPLETED_SUCCESSFULLYA file system or file system filter driver has successfully completed an FsFilter operation."
+			"STATUS_INTERRUPT_VECTOR_ALREADY_CONNECTEDThe specified interrupt vector was already connected.STATUS_INTERRUPT_STILL_CONNECTED"
+			"The specified interrupt vector is still connected.STATUS_PROCESS_CLONEDThe current process is a cloned process.STATUS_FILE_LOCKED_WITH_ONLY_READERS"
+			"The file was locked and all users of the file can only read.STATUS_FILE_LOCKED_WITH_WRITERSThe file was locked and at least one user of the file can write."
+			"STATUS_RESOURCEMANAGER_READ_ONLYThe specified ResourceManager made no changes or updates to the resource under this transaction."
+			"STATUS_RING_PREVIOUSLY_EMPTYThe specified ring buffer was empty before the packet was successfully inserted.STATUS_RING_PREVIOUSLY_FULL"
+			"The specified ring buffer was full before the packet was successfully removed.STATUS_RING_PREVIOUSLY_ABOVE_QUOTAThe specified ring buffer has dropped below its quota of outstanding transactions."
+			"STATUS_RING_NEWLY_EMPTYThe specified ring buffer has, with the removal of the current packet, now become empty.STATUS_RING_SIGNAL_OPPOSITE_ENDPOINT"
+			"The specified ring buffer was either previously empty or previously full which implies that the caller should signal the opposite endpoint."
+			"STATUS_OPLOCK_SWITCHED_TO_NEW_HANDLEThe oplock that was associated with this handle is now associated with a different handle."
+			"STATUS_OPLOCK_HANDLE_CLOSEDThe handle with which this oplock was associated has been closed.  The oplock is now broken.STATUS_WAIT_FOR_OPLOCK"
+			"An operation is blocked waiting for an oplock.DBG_EXCEPTION_HANDLEDDebugger handled exceptionDBG_CONTINUEDebugger continued"
+			"STATUS_FLT_IO_COMPLETEThe IO was completed by a filter.STATUS_DIS_ATTRIBUTE_BUILTAn attribute was successfully built.STATUS_OBJECT_NAME_EXISTS"
+			"{Object Exists} An attempt was made to create an object and the object name already existed.STATUS_THREAD_WAS_SUSPENDED{Thread Suspended} A thread termination occurred while the thread was suspended. The thread was resumed, and termination proceeded."
+			"STATUS_WORKING_SET_LIMIT_RANGE{Working Set Range Error} An attempt was made to set the working set minimum or maximum to values which are outside of the allowable range."
+			"STATUS_IMAGE_NOT_AT_BASE{Image Relocated} An image file could not be mapped at the address specified in the image file. Local fixups must be performed on this image."
+			"STATUS_RXACT_STATE_CREATEDThis informational level status indicates that a specified registry sub-tree transaction state did not yet exist and had to be created."
+			"STATUS_SEGMENT_NOTIFICATION{Segment Load} A virtual DOS machine (VDM) is loading, unloading, or moving an MS-DOS or Win16 program segment image. An exception is raised so a debugger can load, unload or track symbols and breakpoints within these 16-bit segments."
+			"STATUS_LOCAL_USER_SESSION_KEY{Local Session Key} A user session key was requested for a local RPC connection. The session key returned is a constant value and not unique to this connection."
+			"STATUS_BAD_CURRENT_DIRECTORY{Invalid Current Directory} The process cannot switch to the startup current directory %hs. Select OK to set current directory to %hs, or select CANCEL to exit."
+			"STATUS_SERIAL_MORE_WRITES{Serial IOCTL Complete} A serial I/O operation was completed by another write to a serial port. (The IOCTL_SERIAL_XOFF_COUNTER reached zero.)"
+			"STATUS_REGISTRY_RECOVERED{Registry Recovery} One of the files containing the system's Registry data had to be recovered by use of a log or alternate copy. The recovery was successful."
+			"STATUS_FT_READ_RECOVERY_FROM_BACKUP{Redundant Read} To satisfy a read request, the NT fault-tolerant file system successfully read the requested data from a redundant copy. This was done because the file system encountered a failure on a member of the fault-tolerant volume, but was unable to reassign the failing area of the device."
+			"STATUS_FT_WRITE_RECOVERY{Redundant Write} To satisfy a write request, the NT fault-tolerant file system successfully wrote a redundant copy of the information. This was done because the file system encountered a failure on a member of the fault-tolerant volume, but was not able to reassign the failing area of the device."
+			"STATUS_SERIAL_COUNTER_TIMEOUT{Serial IOCTL Timeout} A serial I/O operation completed because the time-out period expired. (The IOCTL_SERIAL_XOFF_COUNTER had not reached zero.)"
+			"STATUS_NULL_LM_PASSWORD{Password Too Complex} The Windows password is too complex to be converted to a LAN Manager password. The LAN Manager password returned is a NULL string."
+			"STATUS_IMAGE_MACHINE_TYPE_MISMATCH{Machine Type Mismatch} The image file %hs is valid, but is for a machine type other than the current machine. Select OK to continue, or CANCEL to fail the DLL load."
+			"STATUS_RECEIVE_PARTIAL{Partial Data Received} The network transport returned partial data to its client. The remaining data will be sent later."
+			"STATUS_RECEIVE_EXPEDITED{Expedited Data Received} The network transport returned data to its client that was marked as expedited by the remote system."
+			"STATUS_RECEIVE_PARTIAL_EXPEDITED{Partial Expedited Data Received} The network transport returned partial data to its client and this data was marked as expedited by the remote system. The remaining data will be sent later."
+			"STATUS_EVENT_DONE{TDI Event Done} The TDI indication has completed successfully.STATUS_EVENT_PENDING{TDI Event Pending} The TDI indication has entered the pending state."
+			"STATUS_CHECKING_FILE_SYSTEMChecking file system on %wZSTATUS_FATAL_APP_EXIT{Fatal Application Exit} %hsSTATUS_PREDEFINED_HANDLE"
+			"The specified registry key is referenced by a predefined handle.STATUS_WAS_UNLOCKED{Page Unlocked} The page protection of a locked page was changed to 'No Access' and the page was unlocked from memory and from the process."
+			"STATUS_SERVICE_NOTIFICATION%hsSTATUS_WAS_LOCKED{Page Locked} One of the pages to lock was already locked.STATUS_LOG_HARD_ERROR"
+			"Application popup: %1 : %2STATUS_ALREADY_WIN32STATUS_WX86_UNSIMULATEException status code used by Win32 x86 emulation subsystem."
+			"STATUS_WX86_CONTINUESTATUS_WX86_SINGLE_STEPSTATUS_WX86_BREAKPOINTSTATUS_WX86_EXCEPTION_CONTINUESTATUS_WX86_EXCEPTION_LASTCHANCE"
+			"STATUS_WX86_EXCEPTION_CHAINSTATUS_IMAGE_MACHINE_TYPE_MISMATCH_EXE{Machine Type Mismatch} The image file %hs is valid, but is for a machine type other than the current machine."
+			"STATUS_NO_YIELD_PERFORMEDA yield execution was performed and no thread was available to run.STATUS_TIMER_RESUME_IGNOREDThe resumable flag to a timer API was ignored."
+			"STATUS_ARBITRATION_UNHANDLEDThe arbiter has deferred arbitration of these resources to its parentSTATUS_CARDBUS_NOT_SUPPORTED"
+			"The device \"%hs\" has detected a CardBus card in its slot, but the firmware on this system is not configured to allow the CardBus controller to be run in CardBus mode. The operating system will currently accept only 16-bit (R2) pc-cards on this controller."
+			"STATUS_WX86_CREATEWX86TIBSTATUS_MP_PROCESSOR_MISMATCHThe CPUs in this multiprocessor system are not all the same revision level. To use all processors the operating system restricts itself to the features of the least capable processor in the system. Should problems occur with this system, contact the CPU manufacturer to see if this mix of processors is supported."
+			"STATUS_HIBERNATEDThe system was put into hibernation.STATUS_RESUME_HIBERNATIONThe system was resumed from hibernation.STATUS_FIRMWARE_UPDATED"
+			"Windows has detected that the system firmware (BIOS) was updated [previous firmware date = %2, current firmware date %3]."
+			"STATUS_DRIVERS_LEAKING_LOCKED_PAGESA device driver is leaking locked I/O pages causing system degradation. The system has automatically enabled tracking code in order to try and catch the culprit."
+			"STATUS_MESSAGE_RETRIEVEDThe ALPC message being canceled has already been retrieved from the queue on the other side.STATUS_SYSTEM_POWERSTATE_TRANSITION"
+			"The system power state is transitioning from %2 to %3.STATUS_ALPC_CHECK_COMPLETION_LISTThe receive operation was successful. Check the ALPC completion list for the received message."
+			"STATUS_SYSTEM_POWERSTATE_COMPLEX_TRANSITIONThe system power state is transitioning from %2 to %3 but could enter %4.STATUS_ACCESS_AUDIT_BY_POLICY"
+			"Access to %1 is monitored by policy rule %2.STATUS_ABANDON_HIBERFILEA valid hibernation file has been invalidated and should be abandoned."
+			"STATUS_BIZRULES_NOT_ENABLEDBusiness rule scripts are disabled for the calling application.STATUS_WAKE_SYSTEMThe system has awoken"
+			"STATUS_DS_SHUTTING_DOWNThe Directory Service is shutting down.DBG_REPLY_LATERDebugger will reply later.DBG_UNABLE_TO_PROVIDE_HANDLE"
+			"Debugger cannot provide handle.DBG_TERMINATE_THREADDebugger terminated thread.DBG_TERMINATE_PROCESSDebugger terminated process."
+			"DBG_CONTROL_CDebugger got control C.DBG_PRINTEXCEPTION_CDebugger printed exception on control C.DBG_RIPEXCEPTIONDebugger received RIP exception."
+			"DBG_CONTROL_BREAKDebugger received control break.DBG_COMMAND_EXCEPTIONDebugger command communication exception.RPC_NT_UUID_LOCAL_ONLY"
+			"A UUID that is valid only on this computer has been allocated.RPC_NT_SEND_INCOMPLETESome data remains to be sent in the request buffer."
+			"STATUS_CTX_CDM_CONNECTThe Client Drive Mapping Service Has Connected on Terminal Connection.STATUS_CTX_CDM_DISCONNECTThe Client Drive Mapping Service Has Disconnected on Terminal Connection."
+			"STATUS_SXS_RELEASE_ACTIVATION_CONTEXTA kernel mode component is releasing a reference on an activation context.STATUS_HEURISTIC_DAMAGE_POSSIBLE"
+			"The attempt to commit the Transaction completed, but it is possible that some portion of the transaction tree did not commit successfully due to heuristics.  Therefore it is possible that some data modified in the transaction may not have committed, resulting in transactional inconsistency.  If possible, check the consistency of the associated data."
+			"STATUS_RECOVERY_NOT_NEEDEDThe transactional resource manager is already consistent. Recovery is not needed.STATUS_RM_ALREADY_STARTED"
+			"The transactional resource manager has already been started.STATUS_LOG_NO_RESTARTLog service encountered a log stream with no restart area."
+			"STATUS_VIDEO_DRIVER_DEBUG_REPORT_REQUEST{Display Driver Recovered From Failure} The %hs display driver has detected and recovered from a failure. Some graphical operations may have failed. The next time you reboot the machine a dialog will be displayed giving you a chance to upload data about this failure to Microsoft."
+			"STATUS_GRAPHICS_PARTIAL_DATA_POPULATEDSpecified buffer is not big enough to contain entire requested dataset. Partial data populated upto the size of the buffer. Caller needs to provide buffer of size as specified in the partially populated buffer's content (interface specific)."
+			"STATUS_GRAPHICS_MODE_NOT_PINNEDNo mode is pinned on the specified VidPN source/target.STATUS_GRAPHICS_NO_PREFERRED_MODESpecified mode set does not specify preference for one of its modes."
+			"STATUS_GRAPHICS_DATASET_IS_EMPTYSpecified data set (e.g. mode set, frequency range set, descriptor set, topology, etc.) is empty."
+			"STATUS_GRAPHICS_NO_MORE_ELEMENTS_IN_DATASETSpecified data set (e.g. mode set, frequency range set, descriptor set, topology, etc.) does not contain any more elements."
+			"STATUS_GRAPHICS_PATH_CONTENT_GEOMETRY_TRANSFORMATION_NOT_PINNEDSpecified content transformation is not pinned on the specified VidPN present path."
+			"STATUS_GRAPHICS_UNKNOWN_CHILD_STATUSChild device presence was not reliably detected.STATUS_GRAPHICS_LEADLINK_START_DEFERRED"
+			"Starting the leadlink adapter has been deferred temporarily.STATUS_GRAPHICS_POLLING_TOO_FREQUENTLYThe display adapter is being polled for children too frequently at the same polling level."
+			"STATUS_GRAPHICS_START_DEFERREDStarting the adapter has been deferred temporarily.STATUS_NDIS_INDICATION_REQUIREDThe request will be completed later by NDIS status indication."
+			"STATUS_GUARD_PAGE_VIOLATION{EXCEPTION} Guard Page Exception A page of memory that marks the end of a data structure, such as a stack or an array, has been accessed."
+			"STATUS_DATATYPE_MISALIGNMENT{EXCEPTION} Alignment Fault A datatype misalignment was detected in a load or store instruction."
+			"STATUS_BREAKPOINT{EXCEPTION} Breakpoint A breakpoint has been reached.STATUS_SINGLE_STEP{EXCEPTION} Single Step A single step or trace operation has just been completed."
+			"STATUS_BUFFER_OVERFLOW{Buffer Overflow} The data was too large to fit into the specified buffer.STATUS_NO_MORE_FILES{No More Files} No more files were found which match the file specification."
+			"STATUS_WAKE_SYSTEM_DEBUGGER{Kernel Debugger Awakened} the system debugger was awakened by an interrupt.STATUS_HANDLES_CLOSED"
+			"{Handles Closed} Handles to objects have been automatically closed as a result of the requested operation.STATUS_NO_INHERITANCE"
+			"{Non-Inheritable ACL} An access control list (ACL) contains no components that can be inherited.STATUS_GUID_SUBSTITUTION_MADE"
+			"{GUID Substitution} During the translation of a global identifier (GUID) to a Windows security ID (SID), no administratively-defined GUID prefix was found. A substitute prefix was used, which will not compromise system security. However, this may provide a more restrictive access than intended."
+			"STATUS_PARTIAL_COPY{Partial Copy} Due to protection conflicts not all the requested bytes could be copied.STATUS_DEVICE_PAPER_EMPTY"
+			"{Out of Paper} The printer is out of paper.STATUS_DEVICE_POWERED_OFF{Device Power Is Off} The printer power has been turned off."
+			"STATUS_DEVICE_OFF_LINE{Device Offline} The printer has been taken offline.STATUS_DEVICE_BUSY{Device Busy} The device is currently busy."
+			"STATUS_NO_MORE_EAS{No More EAs} No more extended attributes (EAs) were found for the file.STATUS_INVALID_EA_NAME{Illegal EA} The specified extended attribute (EA) name contains at least one illegal character."
+			"STATUS_EA_LIST_INCONSISTENT{Inconsistent EA List} The extended attribute (EA) list is inconsistent.STATUS_INVALID_EA_FLAG"
+			"{Invalid EA Flag} An invalid extended attribute (EA) flag was set.STATUS_VERIFY_REQUIRED{Verifying Disk} The media has changed and a verify operation is in progress so no reads or writes may be performed to the device, except those used in the verify operation."
+			"STATUS_EXTRANEOUS_INFORMATION{Too Much Information} The specified access control list (ACL) contained more information than was expected."
+			"STATUS_RXACT_COMMIT_NECESSARYThis warning level status indicates that the transaction state already exists for the registry sub-tree, but that a transaction commit was previously aborted. The commit has NOT been completed, but has not been rolled back either (so it may still be committed if desired)."
+			"STATUS_NO_MORE_ENTRIES{No More Entries} No more entries are available from an enumeration operation.STATUS_FILEMARK_DETECTED"
+			"{Filemark Found} A filemark was detected.STATUS_MEDIA_CHANGED{Media Changed} The media may have changed.STATUS_BUS_RESET"
+			"{I/O Bus Reset} An I/O bus reset was detected.STATUS_END_OF_MEDIA{End of Media} The end of the media was encountered.STATUS_BEGINNING_OF_MEDIA"
+			"Beginning of tape or partition has been detected.STATUS_MEDIA_CHECKSTATUS_SETMARK_DETECTEDA tape access reached a setmark."
+			"STATUS_NO_DATA_DETECTEDDuring a tape access, the end of the data written is reached.STATUS_REDIRECTOR_HAS_OPEN_HANDLESThe redirector is in use and cannot be unloaded."
+			"STATUS_SERVER_HAS_OPEN_HANDLESThe server is in use and cannot be unloaded.STATUS_ALREADY_DISCONNECTEDThe specified connection has already been disconnected."
+			"STATUS_LONGJUMPA long jump has been executed.STATUS_CLEANER_CARTRIDGE_INSTALLEDA cleaner cartridge is present in the tape library."
+			"STATUS_PLUGPLAY_QUERY_VETOEDThe Plug and Play query operation was not successful.STATUS_UNWIND_CONSOLIDATEA frame consolidation has been executed."
+			"STATUS_REGISTRY_HIVE_RECOVERED{Registry Hive Recovered} Registry hive (file): %hs was corrupted and it has been recovered. Some data might have been lost."
+			"STATUS_DLL_MIGHT_BE_INSECUREThe application is attempting to run executable code from the module %hs. This may be insecure. An alternative, %hs, is available. Should the application use the secure module %hs\?"
+			"STATUS_DLL_MIGHT_BE_INCOMPATIBLEThe application is loading executable code from the module %hs. This is secure, but may be incompatible with previous releases of the operating system. An alternative, %hs, is available. Should the application use the secure module %hs\?"
+			"STATUS_STOPPED_ON_SYMLINKThe create operation stopped after reaching a symbolic link.STATUS_CANNOT_GRANT_REQUESTED_OPLOCK"
+			"An oplock of the requested level cannot be granted.  An oplock of a lower level may be available.STATUS_NO_ACE_CONDITION"
+			"{No ACE Condition} The specified access control entry (ACE) does not contain a condition.STATUS_DEVICE_REQUIRES_CLEANING"
+			"The device has indicated that cleaning is necessary.STATUS_DEVICE_DOOR_OPENThe device has indicated that it's door is open. Further operations require it closed and secured."
+			"STATUS_DATA_LOST_REPAIRWindows discovered a corruption in the file \"%hs\". This file has now been repaired. Please check if any data in the file was lost because of the corruption."
+			"DBG_EXCEPTION_NOT_HANDLEDDebugger did not handle the exception.STATUS_CLUSTER_NODE_ALREADY_UPThe cluster node is already up."
+			"STATUS_CLUSTER_NODE_ALREADY_DOWNThe cluster node is already down.STATUS_CLUSTER_NETWORK_ALREADY_ONLINEThe cluster network is already online."
+			"STATUS_CLUSTER_NETWORK_ALREADY_OFFLINEThe cluster network is already offline.STATUS_CLUSTER_NODE_ALREADY_MEMBERThe cluster node is already a member of the cluster."
+			"STATUS_COULD_NOT_RESIZE_LOGThe log could not be set to the requested size.STATUS_NO_TXF_METADATAThere is no transaction metadata on the file."
+			"STATUS_CANT_RECOVER_WITH_HANDLE_OPENThe file can't be recovered because there is a handle still open on it.STATUS_TXF_METADATA_ALREADY_PRESENT"
+			"Transaction metadata is already present on this file and cannot be superseded.STATUS_TRANSACTION_SCOPE_CALLBACKS_NOT_SET"
+			"A transaction scope could not be entered because the scope handler has not been initialized.STATUS_VIDEO_HUNG_DISPLAY_DRIVER_THREAD_RECOVERED"
+			"{Display Driver Stopped Responding and recovered} The %hs display driver has stopped working normally. The recovery had been performed."
+			"STATUS_FLT_BUFFER_TOO_SMALL{Buffer too small} The buffer is too small to contain the entry. No information has been written to the buffer."
+			"STATUS_FVE_PARTIAL_METADATAVolume Metadata read or write is incomplete.STATUS_FVE_TRANSIENT_STATEBitLocker encryption keys were ignored because the volume was in a transient state."
+			"STATUS_VID_REMOTE_NODE_PARENT_GPA_PAGES_USEDA virtual machine is running with its memory allocated across multiple NUMA nodes. This does not indicate a problem unless the performance of your virtual machine is unusually slow. If you are experiencing performance problems, you may need to modify the NUMA configuration. For detailed information, see http://go.microsoft.com/fwlink/\?LinkId=92362."
+			"STATUS_VOLMGR_INCOMPLETE_REGENERATIONThe regeneration operation was not able to copy all data from the active plexes due to bad sectors."
+			"STATUS_VOLMGR_INCOMPLETE_DISK_MIGRATIONOne or more disks were not fully migrated to the target pack. They may or may not require reimport after fixing the hardware problems."
+			"STATUS_BCD_NOT_ALL_ENTRIES_IMPORTEDSome BCD entries were not imported correctly from the BCD store.STATUS_BCD_NOT_ALL_ENTRIES_SYNCHRONIZED"
+			"Some BCD entries were not synchronized correctly with the firmware.STATUS_QUERY_STORAGE_ERRORThe virtualization storage subsystem has generated an error."
+			"STATUS_UNSUCCESSFUL{Operation Failed} The requested operation was unsuccessful.STATUS_NOT_IMPLEMENTED{Not Implemented} The requested operation is not implemented."
+			"STATUS_INVALID_INFO_CLASS{Invalid Parameter} The specified information class is not a valid information class for the specified object."
+			"STATUS_INFO_LENGTH_MISMATCHThe specified information record length does not match the length required for the specified information class."
+			"STATUS_ACCESS_VIOLATIONThe instruction at 0x%08lx referenced memory at 0x%08lx. The memory could not be %s.STATUS_IN_PAGE_ERROR"
+			"The instruction at 0x%p referenced memory at 0x%p. The required data was not placed into memory because of an I/O error status of 0x%x."
+			"STATUS_PAGEFILE_QUOTAThe pagefile quota for the process has been exhausted.STATUS_INVALID_HANDLEAn invalid HANDLE was specified."
+			"STATUS_BAD_INITIAL_STACKAn invalid initial stack was specified in a call to NtCreateThread.STATUS_BAD_INITIAL_PCAn invalid initial start address was specified in a call to NtCreateThread."
+			"STATUS_INVALID_CIDAn invalid Client ID was specified.STATUS_TIMER_NOT_CANCELEDAn attempt was made to cancel or set a timer that has an associated APC and the subject thread is not the thread that originally set the timer with an associated APC routine."
+			"STATUS_INVALID_PARAMETERAn invalid parameter was passed to a service or function.STATUS_NO_SUCH_DEVICEA device which does not exist was specified."
+			"STATUS_NO_SUCH_FILE{File Not Found} The file %hs does not exist.STATUS_INVALID_DEVICE_REQUESTThe specified request is not a valid operation for the target device."
+			"STATUS_END_OF_FILEThe end-of-file marker has been reached. There is no valid data in the file beyond this marker.STATUS_WRONG_VOLUME"
+			"{Wrong Volume} The wrong volume is in the drive. Please insert volume %hs into drive %hs.STATUS_NO_MEDIA_IN_DEVICE{No Disk} There is no disk in the drive. Please insert a disk into drive %hs."
+			"STATUS_UNRECOGNIZED_MEDIA{Unknown Disk Format} The disk in drive %hs is not formatted properly. Please check the disk, and reformat if necessary."
+			"STATUS_NONEXISTENT_SECTOR{Sector Not Found} The specified sector does not exist.STATUS_MORE_PROCESSING_REQUIRED{Still Busy} The specified I/O request packet (IRP) cannot be disposed of because the I/O operation is not complete."
+			"STATUS_NO_MEMORY{Not Enough Quota} Not enough virtual memory or paging file quota is available to complete the specified operation."
+			"STATUS_CONFLICTING_ADDRESSES{Conflicting Address Range} The specified address range conflicts with the address space.STATUS_NOT_MAPPED_VIEW"
+			"Address range to unmap is not a mapped view.STATUS_UNABLE_TO_FREE_VMVirtual memory cannot be freed.STATUS_UNABLE_TO_DELETE_SECTION"
+			"Specified section cannot be deleted.STATUS_INVALID_SYSTEM_SERVICEAn invalid system service was specified in a system service call."
+			"STATUS_ILLEGAL_INSTRUCTION{EXCEPTION} Illegal Instruction An attempt was made to execute an illegal instruction.STATUS_INVALID_LOCK_SEQUENCE"
+			"{Invalid Lock Sequence} An attempt was made to execute an invalid lock sequence.STATUS_INVALID_VIEW_SIZE{Invalid Mapping} An attempt was made to create a view for a section which is bigger than the section."
+			"STATUS_INVALID_FILE_FOR_SECTION{Bad File} The attributes of the specified mapping file for a section of memory cannot be read."
+			"STATUS_ALREADY_COMMITTED{Already Committed} The specified address range is already committed.STATUS_ACCESS_DENIED{Access Denied} A process has requested access to an object, but has not been granted those access rights."
+			"STATUS_BUFFER_TOO_SMALL{Buffer Too Small} The buffer is too small to contain the entry. No information has been written to the buffer."
+			"STATUS_OBJECT_TYPE_MISMATCH{Wrong Type} There is a mismatch between the type of object required by the requested operation and the type of object that is specified in the request."
+			"STATUS_NONCONTINUABLE_EXCEPTION{EXCEPTION} Cannot Continue Windows cannot continue from this exception.STATUS_INVALID_DISPOSITION"
+			"An invalid exception disposition was returned by an exception handler.STATUS_UNWINDUnwind exception code.STATUS_BAD_STACK"
+			"An invalid or unaligned stack was encountered during an unwind operation.STATUS_INVALID_UNWIND_TARGETAn invalid unwind target was encountered during an unwind operation."
+			"STATUS_NOT_LOCKEDAn attempt was made to unlock a page of memory which was not locked.STATUS_PARITY_ERRORDevice parity error on I/O operation."
+			"STATUS_UNABLE_TO_DECOMMIT_VMAn attempt was made to decommit uncommitted virtual memory.STATUS_NOT_COMMITTEDAn attempt was made to change the attributes on memory that has not been committed."
+			"STATUS_INVALID_PORT_ATTRIBUTESInvalid Object Attributes specified to NtCreatePort or invalid Port Attributes specified to NtConnectPort"
+			"STATUS_PORT_MESSAGE_TOO_LONGLength of message passed to NtRequestPort or NtRequestWaitReplyPort was longer than the maximum message allowed by the port."
+			"STATUS_INVALID_PARAMETER_MIXAn invalid combination of parameters was specified.STATUS_INVALID_QUOTA_LOWERAn attempt was made to lower a quota limit below the current usage."
+			"STATUS_DISK_CORRUPT_ERROR{Corrupt Disk} The file system structure on the disk is corrupt and unusable. Please run the Chkdsk utility on the volume %hs."
+			"STATUS_OBJECT_NAME_INVALIDObject Name invalid.STATUS_OBJECT_NAME_NOT_FOUNDObject Name not found.STATUS_OBJECT_NAME_COLLISION"
+			"Object Name already exists.STATUS_PORT_DISCONNECTEDAttempt to send a message to a disconnected communication port.STATUS_DEVICE_ALREADY_ATTACHED"
+			"An attempt was made to attach to a device that was already attached to another device.STATUS_OBJECT_PATH_INVALIDObject Path Component was not a directory object."
+			"STATUS_OBJECT_PATH_NOT_FOUND{Path Not Found} The path %hs does not exist.STATUS_OBJECT_PATH_SYNTAX_BADSTATUS_DATA_OVERRUN"
+			"{Data Overrun} A data overrun error occurred.STATUS_DATA_LATE_ERROR{Data Late} A data late error occurred.STATUS_DATA_ERROR"
+			"{Data Error} An error in reading or writing data occurred.STATUS_CRC_ERROR{Bad CRC} A cyclic redundancy check (CRC) checksum error occurred."
+			"STATUS_SECTION_TOO_BIG{Section Too Large} The specified section is too big to map the file.STATUS_PORT_CONNECTION_REFUSED"
+			"The NtConnectPort request is refused.STATUS_INVALID_PORT_HANDLEThe type of port handle is invalid for the operation requested."
+			"STATUS_SHARING_VIOLATIONA file cannot be opened because the share access flags are incompatible.STATUS_QUOTA_EXCEEDEDInsufficient quota exists to complete the operation"
+			"STATUS_INVALID_PAGE_PROTECTIONThe specified page protection was not valid.STATUS_MUTANT_NOT_OWNEDAn attempt to release a mutant object was made by a thread that was not the owner of the mutant object."
+			"STATUS_SEMAPHORE_LIMIT_EXCEEDEDAn attempt was made to release a semaphore such that its maximum count would have been exceeded."
+			"STATUS_PORT_ALREADY_SETAn attempt to set a process's DebugPort or ExceptionPort was made, but a port already exists in the process or an attempt to set a file's CompletionPort made, but a port was already set in the file or an attempt to set an ALPC port's associated completion port was made, but it is already set."
+			"STATUS_SECTION_NOT_IMAGEAn attempt was made to query image information on a section which does not map an image.STATUS_SUSPEND_COUNT_EXCEEDED"
+			"An attempt was made to suspend a thread whose suspend count was at its maximum.STATUS_THREAD_IS_TERMINATINGAn attempt was made to access a thread that has begun termination."
+			"STATUS_BAD_WORKING_SET_LIMITAn attempt was made to set the working set limit to an invalid value (minimum greater than maximum, etc)."
+			"STATUS_INCOMPATIBLE_FILE_MAPA section was created to map a file which is not compatible to an already existing section which maps the same file."
+			"STATUS_SECTION_PROTECTIONA view to a section specifies a protection which is incompatible with the initial view's protection."
+			"STATUS_EAS_NOT_SUPPORTEDAn operation involving EAs failed because the file system does not support EAs.STATUS_EA_TOO_LARGE"
+			"An EA operation failed because EA set is too large.STATUS_NONEXISTENT_EA_ENTRYAn EA operation failed because the name or EA index is invalid."
+			"STATUS_NO_EAS_ON_FILEThe file for which EAs were requested has no EAs.STATUS_EA_CORRUPT_ERRORThe EA is corrupt and non-readable."
+			"STATUS_FILE_LOCK_CONFLICTA requested read/write cannot be granted due to a conflicting file lock.STATUS_LOCK_NOT_GRANTED"
+			"A requested file lock cannot be granted due to other existing locks.STATUS_DELETE_PENDINGA non close operation has been requested of a file object with a delete pending."
+			"STATUS_CTL_FILE_NOT_SUPPORTEDAn attempt was made to set the control attribute on a file. This attribute is not supported in the target file system."
+			"STATUS_UNKNOWN_REVISIONIndicates a revision number encountered or specified is not one known by the service. It may be a more recent revision than the service is aware of."
+			"STATUS_REVISION_MISMATCHIndicates two revision levels are incompatible.STATUS_INVALID_OWNERIndicates a particular Security ID may not be assigned as the owner of an object."
+			"STATUS_INVALID_PRIMARY_GROUPIndicates a particular Security ID may not be assigned as the primary group of an object.STATUS_NO_IMPERSONATION_TOKEN"
+			"An attempt has been made to operate on an impersonation token by a thread that is not currently impersonating a client.STATUS_CANT_DISABLE_MANDATORY"
+			"A mandatory group may not be disabled.STATUS_NO_LOGON_SERVERSThere are currently no logon servers available to service the logon request."
+			"STATUS_NO_SUCH_LOGON_SESSIONA specified logon session does not exist. It may already have been terminated.STATUS_NO_SUCH_PRIVILEGE"
+			"A specified privilege does not exist.STATUS_PRIVILEGE_NOT_HELDA required privilege is not held by the client.STATUS_INVALID_ACCOUNT_NAME"
+			"The name provided is not a properly formed account name.STATUS_USER_EXISTSThe specified account already exists.STATUS_NO_SUCH_USER"
+			"The specified account does not exist.STATUS_GROUP_EXISTSThe specified group already exists.STATUS_NO_SUCH_GROUPThe specified group does not exist."
+			"STATUS_MEMBER_IN_GROUPThe specified user account is already in the specified group account. Also used to indicate a group cannot be deleted because it contains a member."
+			"STATUS_MEMBER_NOT_IN_GROUPThe specified user account is not a member of the specified group account.STATUS_LAST_ADMINIndicates the requested operation would disable or delete the last remaining administration account. This is not allowed to prevent creating a situation in which the system cannot be administrated."
+			"STATUS_WRONG_PASSWORDWhen trying to update a password, this return status indicates that the value provided as the current password is not correct."
+			"STATUS_ILL_FORMED_PASSWORDWhen trying to update a password, this return status indicates that the value provided for the new password contains values that are not allowed in passwords."
+			"STATUS_PASSWORD_RESTRICTIONWhen trying to update a password, this status indicates that some password update rule has been violated. For example, the password may not meet length criteria."
+			"STATUS_LOGON_FAILUREThe attempted logon is invalid. This is either due to a bad username or authentication information.STATUS_ACCOUNT_RESTRICTION"
+			"Indicates a referenced user name and authentication information are valid, but some user account restriction has prevented successful authentication (such as time-of-day restrictions)."
+			"STATUS_INVALID_LOGON_HOURSThe user account has time restrictions and may not be logged onto at this time.STATUS_INVALID_WORKSTATION"
+			"The user account is restricted such that it may not be used to log on from the source workstation.STATUS_PASSWORD_EXPIRED"
+			"The user account's password has expired.STATUS_ACCOUNT_DISABLEDThe referenced account is currently disabled and may not be logged on to."
+			"STATUS_NONE_MAPPEDNone of the information to be translated has been translated.STATUS_TOO_MANY_LUIDS_REQUESTEDThe number of LUIDs requested may not be allocated with a single allocation."
+			"STATUS_LUIDS_EXHAUSTEDIndicates there are no more LUIDs to allocate.STATUS_INVALID_SUB_AUTHORITYIndicates the sub-authority value is invalid for the particular use."
+			"STATUS_INVALID_ACLIndicates the ACL structure is not valid.STATUS_INVALID_SIDIndicates the SID structure is not valid.STATUS_INVALID_SECURITY_DESCR"
+			"Indicates the SECURITY_DESCRIPTOR structure is not valid.STATUS_PROCEDURE_NOT_FOUNDIndicates the specified procedure address cannot be found in the DLL."
+			"STATUS_INVALID_IMAGE_FORMAT{Bad Image} %hs is either not designed to run on Windows or it contains an error. Try installing the program again using the original installation media or contact your system administrator or the software vendor for support."
+			"STATUS_NO_TOKENAn attempt was made to reference a token that doesn't exist. This is typically done by referencing the token associated with a thread when the thread is not impersonating a client."
+			"STATUS_BAD_INHERITANCE_ACLIndicates that an attempt to build either an inherited ACL or ACE was not successful. This can be caused by a number of things. One of the more probable causes is the replacement of a CreatorId with an SID that didn't fit into the ACE or ACL."
+			"STATUS_RANGE_NOT_LOCKEDThe range specified in NtUnlockFile was not locked.STATUS_DISK_FULLAn operation failed because the disk was full."
+			"STATUS_SERVER_DISABLEDThe GUID allocation server is [already] disabled at the moment.STATUS_SERVER_NOT_DISABLEDThe GUID allocation server is [already] enabled at the moment."
+			"STATUS_TOO_MANY_GUIDS_REQUESTEDToo many GUIDs were requested from the allocation server at once.STATUS_GUIDS_EXHAUSTEDThe GUIDs could not be allocated because the Authority Agent was exhausted."
+			"STATUS_INVALID_ID_AUTHORITYThe value provided was an invalid value for an identifier authority.STATUS_AGENTS_EXHAUSTEDThere are no more authority agent values available for the given identifier authority value."
+			"STATUS_INVALID_VOLUME_LABELAn invalid volume label has been specified.STATUS_SECTION_NOT_EXTENDEDA mapped section could not be extended."
+			"STATUS_NOT_MAPPED_DATASpecified section to flush does not map a data file.STATUS_RESOURCE_DATA_NOT_FOUNDIndicates the specified image file did not contain a resource section."
+			"STATUS_RESOURCE_TYPE_NOT_FOUNDIndicates the specified resource type cannot be found in the image file.STATUS_RESOURCE_NAME_NOT_FOUND"
+			"Indicates the specified resource name cannot be found in the image file.STATUS_ARRAY_BOUNDS_EXCEEDED{EXCEPTION} Array bounds exceeded."
+			"STATUS_FLOAT_DENORMAL_OPERAND{EXCEPTION} Floating-point denormal operand.STATUS_FLOAT_DIVIDE_BY_ZERO{EXCEPTION} Floating-point division by zero."
+			"STATUS_FLOAT_INEXACT_RESULT{EXCEPTION} Floating-point inexact result.STATUS_FLOAT_INVALID_OPERATION{EXCEPTION} Floating-point invalid operation."
+			"STATUS_FLOAT_OVERFLOW{EXCEPTION} Floating-point overflow.STATUS_FLOAT_STACK_CHECK{EXCEPTION} Floating-point stack check."
+			"STATUS_FLOAT_UNDERFLOW{EXCEPTION} Floating-point underflow.STATUS_INTEGER_DIVIDE_BY_ZERO{EXCEPTION} Integer division by zero."
+			"STATUS_INTEGER_OVERFLOW{EXCEPTION} Integer overflow.STATUS_PRIVILEGED_INSTRUCTION{EXCEPTION} Privileged instruction.STATUS_TOO_MANY_PAGING_FILES"
+			"An attempt was made to install more paging files than the system supports.STATUS_FILE_INVALIDThe volume for a file has been externally altered such that the opened file is no longer valid."
+			"STATUS_ALLOTTED_SPACE_EXCEEDEDWhen a block of memory is allotted for future updates, such as the memory allocated to hold discretionary access control and primary group information, successive updates may exceed the amount of memory originally allotted. Since quota may already have been charged to several processes which have handles to the object, it is not reasonable to alter the size of the allocated memory. Instead, a request that requires more memory than has been allotted must fail and the STATUS_ALLOTED_SPACE_EXCEEDED error returned."
+			"STATUS_INSUFFICIENT_RESOURCESInsufficient system resources exist to complete the API.STATUS_DFS_EXIT_PATH_FOUNDAn attempt has been made to open a DFS exit path control file."
+			"STATUS_DEVICE_DATA_ERRORSTATUS_DEVICE_NOT_CONNECTEDSTATUS_DEVICE_POWER_FAILURESTATUS_FREE_VM_NOT_AT_BASEVirtual memory cannot be freed as base address is not the base of the region and a region size of zero was specified."
+			"STATUS_MEMORY_NOT_ALLOCATEDAn attempt was made to free virtual memory which is not allocated.STATUS_WORKING_SET_QUOTAThe working set is not big enough to allow the requested pages to be locked."
+			"STATUS_MEDIA_WRITE_PROTECTED{Write Protect Error} The disk cannot be written to because it is write protected. Please remove the write protection from the volume %hs in drive %hs."
+			"STATUS_DEVICE_NOT_READY{Drive Not Ready} The drive is not ready for use; its door may be open. Please check drive %hs and make sure that a disk is inserted and that the drive door is closed."
+			"STATUS_INVALID_GROUP_ATTRIBUTESThe specified attributes are invalid, or incompatible with the attributes for the group as a whole."
+			"STATUS_BAD_IMPERSONATION_LEVELA specified impersonation level is invalid. Also used to indicate a required impersonation level was not provided."
+			"STATUS_CANT_OPEN_ANONYMOUSAn attempt was made to open an Anonymous level token. Anonymous tokens may not be opened.STATUS_BAD_VALIDATION_CLASS"
+			"The validation information class requested was invalid.STATUS_BAD_TOKEN_TYPEThe type of a token object is inappropriate for its attempted use."
+			"STATUS_BAD_MASTER_BOOT_RECORDSTATUS_INSTRUCTION_MISALIGNMENTAn attempt was made to execute an instruction at an unaligned address and the host system does not support unaligned instruction references."
+			"STATUS_INSTANCE_NOT_AVAILABLEThe maximum named pipe instance count has been reached.STATUS_PIPE_NOT_AVAILABLEAn instance of a named pipe cannot be found in the listening state."
+			"STATUS_INVALID_PIPE_STATEThe named pipe is not in the connected or closing state.STATUS_PIPE_BUSYThe specified pipe is set to complete operations and there are current I/O operations queued so it cannot be changed to queue operations."
+			"STATUS_ILLEGAL_FUNCTIONThe specified handle is not open to the server end of the named pipe.STATUS_PIPE_DISCONNECTEDThe specified named pipe is in the disconnected state."
+			"STATUS_PIPE_CLOSINGThe specified named pipe is in the closing state.STATUS_PIPE_CONNECTEDThe specified named pipe is in the connected state."
+			"STATUS_PIPE_LISTENINGThe specified named pipe is in the listening state.STATUS_INVALID_READ_MODEThe specified named pipe is not in message mode."
+			"STATUS_IO_TIMEOUT{Device Timeout} The specified I/O operation on %hs was not completed before the time-out period expired."
+			"STATUS_FILE_FORCED_CLOSEDThe specified file has been closed by another process.STATUS_PROFILING_NOT_STARTEDProfiling not started."
+			"STATUS_PROFILING_NOT_STOPPEDProfiling not stopped.STATUS_COULD_NOT_INTERPRETThe passed ACL did not contain the minimum required information."
+			"STATUS_FILE_IS_A_DIRECTORYThe file that was specified as a target is a directory and the caller specified that it could be anything but a directory."
+			"STATUS_NOT_SUPPORTEDThe request is not supported.STATUS_REMOTE_NOT_LISTENINGThis remote computer is not listening.STATUS_DUPLICATE_NAME"
+			"A duplicate name exists on the network.STATUS_BAD_NETWORK_PATHThe network path cannot be located.STATUS_NETWORK_BUSYThe network is busy."
+			"STATUS_DEVICE_DOES_NOT_EXISTThis device does not exist.STATUS_TOO_MANY_COMMANDSThe network BIOS command limit has been reached."
+			"STATUS_ADAPTER_HARDWARE_ERRORAn I/O adapter hardware error has occurred.STATUS_INVALID_NETWORK_RESPONSEThe network responded incorrectly."
+			"STATUS_UNEXPECTED_NETWORK_ERRORAn unexpected network error occurred.STATUS_BAD_REMOTE_ADAPTERThe remote adapter is not compatible."
+			"STATUS_PRINT_QUEUE_FULLThe printer queue is full.STATUS_NO_SPOOL_SPACESpace to store the file waiting to be printed is not available on the server."
+			"STATUS_PRINT_CANCELLEDThe requested print file has been canceled.STATUS_NETWORK_NAME_DELETEDThe network name was deleted."
+			"STATUS_NETWORK_ACCESS_DENIEDNetwork access is denied.STATUS_BAD_DEVICE_TYPE{Incorrect Network Resource Type} The specified device type (LPT, for example) conflicts with the actual device type on the remote resource."
+			"STATUS_BAD_NETWORK_NAME{Network Name Not Found} The specified share name cannot be found on the remote server.STATUS_TOO_MANY_NAMES"
+			"The name limit for the local computer network adapter card was exceeded.STATUS_TOO_MANY_SESSIONSThe network BIOS session limit was exceeded."
+			"STATUS_SHARING_PAUSEDFile sharing has been temporarily paused.STATUS_REQUEST_NOT_ACCEPTEDNo more connections can be made to this remote computer at this time because there are already as many connections as the computer can accept."
+			"STATUS_REDIRECTOR_PAUSEDPrint or disk redirection is temporarily paused.STATUS_NET_WRITE_FAULTA network data fault occurred."
+			"STATUS_PROFILING_AT_LIMITThe number of active profiling objects is at the maximum and no more may be started.STATUS_NOT_SAME_DEVICE"
+			"{Incorrect Volume} The target file of a rename request is located on a different device than the source of the rename request."
+			"STATUS_FILE_RENAMEDThe file specified has been renamed and thus cannot be modified.STATUS_VIRTUAL_CIRCUIT_CLOSED{Network Request Timeout} The session with a remote server has been disconnected because the time-out interval for a request has expired."
+			"STATUS_NO_SECURITY_ON_OBJECTIndicates an attempt was made to operate on the security of an object that does not have security associated with it."
+			"STATUS_CANT_WAITUsed to indicate that an operation cannot continue without blocking for I/O.STATUS_PIPE_EMPTYUsed to indicate that a read operation was done on an empty pipe."
+			"STATUS_CANT_ACCESS_DOMAIN_INFOConfiguration information could not be read from the domain controller, either because the machine is unavailable, or access has been denied."
+			"STATUS_CANT_TERMINATE_SELFIndicates that a thread attempted to terminate itself by default (called NtTerminateThread with NULL) and it was the last thread in the current process."
+			"STATUS_INVALID_SERVER_STATEIndicates the Sam Server was in the wrong state to perform the desired operation.STATUS_INVALID_DOMAIN_STATE"
+			"Indicates the Domain was in the wrong state to perform the desired operation.STATUS_INVALID_DOMAIN_ROLEThis operation is only allowed for the Primary Domain Controller of the domain."
+			"STATUS_NO_SUCH_DOMAINThe specified Domain did not exist.STATUS_DOMAIN_EXISTSThe specified Domain already exists.STATUS_DOMAIN_LIMIT_EXCEEDED"
+			"An attempt was made to exceed the limit on the number of domains per server for this release.STATUS_OPLOCK_NOT_GRANTEDError status returned when oplock request is denied."
+			"STATUS_INVALID_OPLOCK_PROTOCOLError status returned when an invalid oplock acknowledgment is received by a file system.STATUS_INTERNAL_DB_CORRUPTION"
+			"This error indicates that the requested operation cannot be completed due to a catastrophic media failure or on-disk data structure corruption."
+			"STATUS_INTERNAL_ERRORAn internal error occurred.STATUS_GENERIC_NOT_MAPPEDIndicates generic access types were contained in an access mask which should already be mapped to non-generic access types."
+			"STATUS_BAD_DESCRIPTOR_FORMATIndicates a security descriptor is not in the necessary format (absolute or self-relative).STATUS_INVALID_USER_BUFFER"
+			"An access to a user buffer failed at an \"expected\" point in time. This code is defined since the caller does not want to accept STATUS_ACCESS_VIOLATION in its filter."
+			"STATUS_UNEXPECTED_IO_ERRORIf an I/O error is returned which is not defined in the standard FsRtl filter, it is converted to the following error which is guaranteed to be in the filter. In this case information is lost, however, the filter correctly handles the exception."
+			"STATUS_UNEXPECTED_MM_CREATE_ERRIf an MM error is returned which is not defined in the standard FsRtl filter, it is converted to one of the following errors which is guaranteed to be in the filter. In this case information is lost, however, the filter correctly handles the exception."
+			"STATUS_UNEXPECTED_MM_MAP_ERRORSTATUS_UNEXPECTED_MM_EXTEND_ERRSTATUS_NOT_LOGON_PROCESSThe requested action is restricted for use by logon processes only. The calling process has not registered as a logon process."
+			"STATUS_LOGON_SESSION_EXISTSAn attempt has been made to start a new session manager or LSA logon session with an ID that is already in use."
+			"STATUS_INVALID_PARAMETER_1An invalid parameter was passed to a service or function as the first argument.STATUS_INVALID_PARAMETER_2"
+			"An invalid parameter was passed to a service or function as the second argument.STATUS_INVALID_PARAMETER_3An invalid parameter was passed to a service or function as the third argument."
+			"STATUS_INVALID_PARAMETER_4An invalid parameter was passed to a service or function as the fourth argument.STATUS_INVALID_PARAMETER_5"
+			"An invalid parameter was passed to a service or function as the fifth argument.STATUS_INVALID_PARAMETER_6An invalid parameter was passed to a service or function as the sixth argument."
+			"STATUS_INVALID_PARAMETER_7An invalid parameter was passed to a service or function as the seventh argument.STATUS_INVALID_PARAMETER_8"
+			"An invalid parameter was passed to a service or function as the eighth argument.STATUS_INVALID_PARAMETER_9An invalid parameter was passed to a service or function as the ninth argument."
+			"STATUS_INVALID_PARAMETER_10An invalid parameter was passed to a service or function as the tenth argument.STATUS_INVALID_PARAMETER_11"
+			"An invalid parameter was passed to a service or function as the eleventh argument.STATUS_INVALID_PARAMETER_12An invalid parameter was passed to a service or function as the twelfth argument."
+			"STATUS_REDIRECTOR_NOT_STARTEDAn attempt was made to access a network file, but the network software was not yet started."
+			"STATUS_REDIRECTOR_STARTEDAn attempt was made to start the redirector, but the redirector has already been started.STATUS_STACK_OVERFLOW"
+			"A new guard page for the stack cannot be created.STATUS_NO_SUCH_PACKAGEA specified authentication package is unknown.STATUS_BAD_FUNCTION_TABLE"
+			"A malformed function table was encountered during an unwind operation.STATUS_VARIABLE_NOT_FOUNDIndicates the specified environment variable name was not found in the specified environment block."
+			"STATUS_DIRECTORY_NOT_EMPTYIndicates that the directory trying to be deleted is not empty.STATUS_FILE_CORRUPT_ERROR{Corrupt File} The file or directory %hs is corrupt and unreadable. Please run the Chkdsk utility."
+			"STATUS_NOT_A_DIRECTORYA requested opened file is not a directory.STATUS_BAD_LOGON_SESSION_STATEThe logon session is not in a state that is consistent with the requested operation."
+			"STATUS_LOGON_SESSION_COLLISIONAn internal LSA error has occurred. An authentication package has requested the creation of a Logon Session but the ID of an already existing Logon Session has been specified."
+			"STATUS_NAME_TOO_LONGA specified name string is too long for its intended use.STATUS_FILES_OPENThe user attempted to force close the files on a redirected drive, but there were opened files on the drive, and the user did not specify a sufficient level of force."
+			"STATUS_CONNECTION_IN_USEThe user attempted to force close the files on a redirected drive, but there were opened directories on the drive, and the user did not specify a sufficient level of force."
+			"STATUS_MESSAGE_NOT_FOUNDRtlFindMessage could not locate the requested message ID in the message table resource.STATUS_PROCESS_IS_TERMINATING"
+			"An attempt was made to access an exiting process.STATUS_INVALID_LOGON_TYPEIndicates an invalid value has been provided for the LogonType requested."
+			"STATUS_NO_GUID_TRANSLATIONIndicates that an attempt was made to assign protection to a file system file or directory and one of the SIDs in the security descriptor could not be translated into a GUID that could be stored by the file system. This causes the protection attempt to fail, which may cause a file creation attempt to fail."
+			"STATUS_CANNOT_IMPERSONATEIndicates that an attempt has been made to impersonate via a named pipe that has not yet been read from."
+			"STATUS_IMAGE_ALREADY_LOADEDIndicates that the specified image is already loaded.STATUS_ABIOS_NOT_PRESENTSTATUS_ABIOS_LID_NOT_EXIST"
+			"STATUS_ABIOS_LID_ALREADY_OWNEDSTATUS_ABIOS_NOT_LID_OWNERSTATUS_ABIOS_INVALID_COMMANDSTATUS_ABIOS_INVALID_LIDSTATUS_ABIOS_SELECTOR_NOT_AVAILABLE"
+			"STATUS_ABIOS_INVALID_SELECTORSTATUS_NO_LDTIndicates that an attempt was made to change the size of the LDT for a process that has no LDT."
+			"STATUS_INVALID_LDT_SIZEIndicates that an attempt was made to grow an LDT by setting its size, or that the size was not an even number of selectors."
+			"STATUS_INVALID_LDT_OFFSETIndicates that the starting value for the LDT information was not an integral multiple of the selector size."
+			"STATUS_INVALID_LDT_DESCRIPTORIndicates that the user supplied an invalid descriptor when trying to set up Ldt descriptors."
+			"STATUS_INVALID_IMAGE_NE_FORMATThe specified image file did not have the correct format. It appears to be NE format.STATUS_RXACT_INVALID_STATE"
+			"Indicates that the transaction state of a registry sub-tree is incompatible with the requested operation. For example, a request has been made to start a new transaction with one already in progress, or a request has been made to apply a transaction when one is not currently in progress."
+			"STATUS_RXACT_COMMIT_FAILUREIndicates an error has occurred during a registry transaction commit. The database has been left in an unknown, but probably inconsistent, state. The state of the registry transaction is left as COMMITTING."
+			"STATUS_MAPPED_FILE_SIZE_ZEROAn attempt was made to map a file of size zero with the maximum size specified as zero.STATUS_TOO_MANY_OPENED_FILES"
+			"Too many files are opened on a remote server. This error should only be returned by the Windows redirector on a remote drive."
+			"STATUS_CANCELLEDThe I/O request was canceled.STATUS_CANNOT_DELETEAn attempt has been made to remove a file or directory that cannot be deleted."
+			"STATUS_INVALID_COMPUTER_NAMEIndicates a name specified as a remote computer name is syntactically invalid.STATUS_FILE_DELETED"
+			"An I/O request other than close was performed on a file after it has been deleted, which can only happen to a request which did not complete before the last handle was closed via NtClose."
+			"STATUS_SPECIAL_ACCOUNTIndicates an operation has been attempted on a built-in (special) SAM account which is incompatible with built-in accounts. For example, built-in accounts cannot be deleted."
+			"STATUS_SPECIAL_GROUPThe operation requested may not be performed on the specified group because it is a built-in special group."
+			"STATUS_SPECIAL_USERThe operation requested may not be performed on the specified user because it is a built-in special user."
+			"STATUS_MEMBERS_PRIMARY_GROUPIndicates a member cannot be removed from a group because the group is currently the member's primary group."
+			"STATUS_FILE_CLOSEDAn I/O request other than close and several other special case operations was attempted using a file object that had already been closed."
+			"STATUS_TOO_MANY_THREADSIndicates a process has too many threads to perform the requested action. For example, assignment of a primary token may only be performed when a process has zero or one threads."
+			"STATUS_THREAD_NOT_IN_PROCESSAn attempt was made to operate on a thread within a specific process, but the thread specified is not in the process specified."
+			"STATUS_TOKEN_ALREADY_IN_USEAn attempt was made to establish a token for use as a primary token but the token is already in use. A token can only be the primary token of one process at a time."
+			"STATUS_PAGEFILE_QUOTA_EXCEEDEDPage file quota was exceeded.STATUS_COMMITMENT_LIMIT{Out of Virtual Memory} Your system is low on virtual memory. To ensure that Windows runs properly, increase the size of your virtual memory paging file. For more information, see Help."
+			"STATUS_INVALID_IMAGE_LE_FORMATThe specified image file did not have the correct format, it appears to be LE format.STATUS_INVALID_IMAGE_NOT_MZ"
+			"The specified image file did not have the correct format, it did not have an initial MZ.STATUS_INVALID_IMAGE_PROTECTThe specified image file did not have the correct format, it did not have a proper e_lfarlc in the MZ header."
+			"STATUS_INVALID_IMAGE_WIN_16The specified image file did not have the correct format, it appears to be a 16-bit Windows image."
+			"STATUS_LOGON_SERVER_CONFLICTThe Netlogon service cannot start because another Netlogon service running in the domain conflicts with the specified role."
+			"STATUS_TIME_DIFFERENCE_AT_DCThe time at the Primary Domain Controller is different than the time at the Backup Domain Controller or member server by too large an amount."
+			"STATUS_SYNCHRONIZATION_REQUIREDThe SAM database on a Windows Server is significantly out of synchronization with the copy on the Domain Controller. A complete synchronization is required."
+			"STATUS_DLL_NOT_FOUNDThe program can't start because %hs is missing from your computer. Try reinstalling the program to fix this problem."
+			"STATUS_OPEN_FAILEDThe NtCreateFile API failed. This error should never be returned to an application, it is a place holder for the Windows Lan Manager Redirector to use in its internal error mapping routines."
+			"STATUS_IO_PRIVILEGE_FAILED{Privilege Failed} The I/O permissions for the process could not be changed.STATUS_ORDINAL_NOT_FOUND"
+			"{Ordinal Not Found} The ordinal %ld could not be located in the dynamic link library %hs.STATUS_ENTRYPOINT_NOT_FOUND{Entry Point Not Found} The procedure entry point %hs could not be located in the dynamic link library %hs."
+			"STATUS_CONTROL_C_EXIT{Application Exit by CTRL+C} The application terminated as a result of a CTRL+C.STATUS_LOCAL_DISCONNECT"
+			"{Virtual Circuit Closed} The network transport on your computer has closed a network connection. There may or may not be I/O requests outstanding."
+			"STATUS_REMOTE_DISCONNECT{Virtual Circuit Closed} The network transport on a remote computer has closed a network connection. There may or may not be I/O requests outstanding."
+			"STATUS_REMOTE_RESOURCES{Insufficient Resources on Remote Computer} The remote computer has insufficient resources to complete the network request. For instance, there may not be enough memory available on the remote computer to carry out the request at this time."
+			"STATUS_LINK_FAILED{Virtual Circuit Closed} An existing connection (virtual circuit) has been broken at the remote computer. There is probably something wrong with the network software protocol or the network hardware on the remote computer."
+			"STATUS_LINK_TIMEOUT{Virtual Circuit Closed} The network transport on your computer has closed a network connection because it had to wait too long for a response from the remote computer."
+			"STATUS_INVALID_CONNECTIONThe connection handle given to the transport was invalid.STATUS_INVALID_ADDRESSThe address handle given to the transport was invalid."
+			"STATUS_DLL_INIT_FAILED{DLL Initialization Failed} Initialization of the dynamic link library %hs failed. The process is terminating abnormally."
+			"STATUS_MISSING_SYSTEMFILE{Missing System File} The required system file %hs is bad or missing.STATUS_UNHANDLED_EXCEPTION"
+			"{Application Error} The exception %s (0x%08lx) occurred in the application at location 0x%08lx.STATUS_APP_INIT_FAILURE{Application Error} The application was unable to start correctly (0x%lx). Click OK to close the application."
+			"STATUS_PAGEFILE_CREATE_FAILED{Unable to Create Paging File} The creation of the paging file %hs failed (%lx). The requested size was %ld."
+			"STATUS_NO_PAGEFILE{No Paging File Specified} No paging file was specified in the system configuration.STATUS_INVALID_LEVEL"
+			"{Incorrect System Call Level} An invalid level was passed into the specified system call.STATUS_WRONG_PASSWORD_CORE{Incorrect Password to LAN Manager Server} You specified an incorrect password to a LAN Manager 2.x or MS-NET server."
+			"STATUS_ILLEGAL_FLOAT_CONTEXT{EXCEPTION} A real-mode application issued a floating-point instruction and floating-point hardware is not present."
+			"STATUS_PIPE_BROKENThe pipe operation has failed because the other end of the pipe has been closed.STATUS_REGISTRY_CORRUPT"
+			"{The Registry Is Corrupt} The structure of one of the files that contains Registry data is corrupt, or the image of the file in memory is corrupt, or the file could not be recovered because the alternate copy or log was absent or corrupt."
+			"STATUS_REGISTRY_IO_FAILEDAn I/O operation initiated by the Registry failed unrecoverably. The Registry could not read in, or write out, or flush, one of the files that contain the system's image of the Registry."
+			"STATUS_NO_EVENT_PAIRAn event pair synchronization operation was performed using the thread specific client/server event pair object, but no event pair object was associated with the thread."
+			"STATUS_UNRECOGNIZED_VOLUMEThe volume does not contain a recognized file system. Please make sure that all required file system drivers are loaded and that the volume is not corrupt."
+			"STATUS_SERIAL_NO_DEVICE_INITEDNo serial device was successfully initialized. The serial driver will unload.STATUS_NO_SUCH_ALIAS"
+			"The specified local group does not exist.STATUS_MEMBER_NOT_IN_ALIASThe specified account name is not a member of the group."
+			"STATUS_MEMBER_IN_ALIASThe specified account name is already a member of the group.STATUS_ALIAS_EXISTSThe specified local group already exists."
+			"STATUS_LOGON_NOT_GRANTEDA requested type of logon (e.g., Interactive, Network, Service) is not granted by the target system's local security policy. Please ask the system administrator to grant the necessary form of logon."
+			"STATUS_TOO_MANY_SECRETSThe maximum number of secrets that may be stored in a single system has been exceeded. The length and number of secrets is limited to satisfy United States State Department export restrictions."
+			"STATUS_SECRET_TOO_LONGThe length of a secret exceeds the maximum length allowed. The length and number of secrets is limited to satisfy United States State Department export restrictions."
+			"STATUS_INTERNAL_DB_ERRORThe Local Security Authority (LSA) database contains an internal inconsistency.STATUS_FULLSCREEN_MODE"
+			"The requested operation cannot be performed in fullscreen mode.STATUS_TOO_MANY_CONTEXT_IDSDuring a logon attempt, the user's security context accumulated too many security IDs. This is a very unusual situation. Remove the user from some global or local groups to reduce the number of security ids to incorporate into the security context."
+			"STATUS_LOGON_TYPE_NOT_GRANTEDA user has requested a type of logon (e.g., interactive or network) that has not been granted. An administrator has control over who may logon interactively and through the network."
+			"STATUS_NOT_REGISTRY_FILEThe system has attempted to load or restore a file into the registry, and the specified file is not in the format of a registry file."
+			"STATUS_NT_CROSS_ENCRYPTION_REQUIREDAn attempt was made to change a user password in the security account manager without providing the necessary Windows cross-encrypted password."
+			"STATUS_DOMAIN_CTRLR_CONFIG_ERRORA Windows Server has an incorrect configuration.STATUS_FT_MISSING_MEMBERAn attempt was made to explicitly access the secondary copy of information via a device control to the Fault Tolerance driver and the secondary copy is not present in the system."
+			"STATUS_ILL_FORMED_SERVICE_ENTRYA configuration registry node representing a driver service entry was ill-formed and did not contain required value entries."
+			"STATUS_ILLEGAL_CHARACTERAn illegal character was encountered. For a multi-byte character set this includes a lead byte without a succeeding trail byte. For the Unicode character set this includes the characters 0xFFFF and 0xFFFE."
+			"STATUS_UNMAPPABLE_CHARACTERNo mapping for the Unicode character exists in the target multi-byte code page.STATUS_UNDEFINED_CHARACTER"
+			"The Unicode character is not defined in the Unicode character set installed on the system.STATUS_FLOPPY_VOLUMEThe paging file cannot be created on a floppy diskette."
+			"STATUS_FLOPPY_ID_MARK_NOT_FOUND{Floppy Disk Error} While accessing a floppy disk, an ID address mark was not found.STATUS_FLOPPY_WRONG_CYLINDER"
+			"{Floppy Disk Error} While accessing a floppy disk, the track address from the sector ID field was found to be different than the track address maintained by the controller."
+			"STATUS_FLOPPY_UNKNOWN_ERROR{Floppy Disk Error} The floppy disk controller reported an error that is not recognized by the floppy disk driver."
+			"STATUS_FLOPPY_BAD_REGISTERS{Floppy Disk Error} While accessing a floppy-disk, the controller returned inconsistent results via its registers."
+			"STATUS_DISK_RECALIBRATE_FAILED{Hard Disk Error} While accessing the hard disk, a recalibrate operation failed, even after retries."
+			"STATUS_DISK_OPERATION_FAILED{Hard Disk Error} While accessing the hard disk, a disk operation failed even after retries."
+			"STATUS_DISK_RESET_FAILED{Hard Disk Error} While accessing the hard disk, a disk controller reset was needed, but even that failed."
+			"STATUS_SHARED_IRQ_BUSYAn attempt was made to open a device that was sharing an IRQ with other devices. At least one other device that uses that IRQ was already opened. Two concurrent opens of devices that share an IRQ and only work via interrupts is not supported for the particular bus type that the devices use."
+			"STATUS_FT_ORPHANING{FT Orphaning} A disk that is part of a fault-tolerant volume can no longer be accessed.STATUS_BIOS_FAILED_TO_CONNECT_INTERRUPT"
+			"The system bios failed to connect a system interrupt to the device or bus for which the device is connected.STATUS_PARTITION_FAILURE"
+			"Tape could not be partitioned.STATUS_INVALID_BLOCK_LENGTHWhen accessing a new tape of a multivolume partition, the current blocksize is incorrect."
+			"STATUS_DEVICE_NOT_PARTITIONEDTape partition information could not be found when loading a tape.STATUS_UNABLE_TO_LOCK_MEDIA"
+			"Attempt to lock the eject media mechanism fails.STATUS_UNABLE_TO_UNLOAD_MEDIAUnload media fails.STATUS_EOM_OVERFLOWPhysical end of tape was detected."
+			"STATUS_NO_MEDIA{No Media} There is no media in the drive. Please insert media into drive %hs.STATUS_NO_SUCH_MEMBERA member could not be added to or removed from the local group because the member does not exist."
+			"STATUS_INVALID_MEMBERA new member could not be added to a local group because the member has the wrong account type.STATUS_KEY_DELETED"
+			"Illegal operation attempted on a registry key which has been marked for deletion.STATUS_NO_LOG_SPACESystem could not allocate required space in a registry log."
+			"STATUS_TOO_MANY_SIDSToo many Sids have been specified.STATUS_LM_CROSS_ENCRYPTION_REQUIREDAn attempt was made to change a user password in the security account manager without providing the necessary LM cross-encrypted password."
+			"STATUS_KEY_HAS_CHILDRENAn attempt was made to create a symbolic link in a registry key that already has subkeys or values."
+			"STATUS_CHILD_MUST_BE_VOLATILEAn attempt was made to create a Stable subkey under a Volatile parent key.STATUS_DEVICE_CONFIGURATION_ERROR"
+			"The I/O device is configured incorrectly or the configuration parameters to the driver are incorrect.STATUS_DRIVER_INTERNAL_ERROR"
+			"An error was detected between two drivers or within an I/O driver.STATUS_INVALID_DEVICE_STATEThe device is not in a valid state to perform this request."
+			"STATUS_IO_DEVICE_ERRORThe I/O device reported an I/O error.STATUS_DEVICE_PROTOCOL_ERRORA protocol error was detected between the driver and the device."
+			"STATUS_BACKUP_CONTROLLERSTATUS_LOG_FILE_FULL";
+
+		constexpr const char page_1[] =
+			"Log file space is insufficient to support this operation.STATUS_TOO_LATEA write operation was attempted to a volume after it was dismounted."
+			"STATUS_NO_TRUST_LSA_SECRETThe workstation does not have a trust secret for the primary domain in the local LSA database."
+			"STATUS_NO_TRUST_SAM_ACCOUNTThe SAM database on the Windows Server does not have a computer account for this workstation trust relationship."
+			"STATUS_TRUSTED_DOMAIN_FAILUREThe logon request failed because the trust relationship between the primary domain and the trusted domain failed."
+			"STATUS_TRUSTED_RELATIONSHIP_FAILUREThe logon request failed because the trust relationship between this workstation and the primary domain failed."
+			"STATUS_EVENTLOG_FILE_CORRUPTThe Eventlog log file is corrupt.STATUS_EVENTLOG_CANT_STARTNo Eventlog log file could be opened. The Eventlog service did not start."
+			"STATUS_TRUST_FAILUREThe network logon failed. This may be because the validation authority can't be reached.STATUS_MUTANT_LIMIT_EXCEEDED"
+			"An attempt was made to acquire a mutant such that its maximum count would have been exceeded.STATUS_NETLOGON_NOT_STARTED"
+			"An attempt was made to logon, but the netlogon service was not started.STATUS_ACCOUNT_EXPIREDThe user's account has expired."
+			"STATUS_POSSIBLE_DEADLOCK{EXCEPTION} Possible deadlock condition.STATUS_NETWORK_CREDENTIAL_CONFLICTMultiple connections to a server or shared resource by the same user, using more than one user name, are not allowed. Disconnect all previous connections to the server or shared resource and try again."
+			"STATUS_REMOTE_SESSION_LIMITAn attempt was made to establish a session to a network server, but there are already too many sessions established to that server."
+			"STATUS_EVENTLOG_FILE_CHANGEDThe log file has changed between reads.STATUS_NOLOGON_INTERDOMAIN_TRUST_ACCOUNTThe account used is an Interdomain Trust account. Use your global user account or local user account to access this server."
+			"STATUS_NOLOGON_WORKSTATION_TRUST_ACCOUNTThe account used is a Computer Account. Use your global user account or local user account to access this server."
+			"STATUS_NOLOGON_SERVER_TRUST_ACCOUNTThe account used is an Server Trust account. Use your global user account or local user account to access this server."
+			"STATUS_DOMAIN_TRUST_INCONSISTENTThe name or SID of the domain specified is inconsistent with the trust information for that domain."
+			"STATUS_FS_DRIVER_REQUIREDA volume has been accessed for which a file system driver is required that has not yet been loaded."
+			"STATUS_IMAGE_ALREADY_LOADED_AS_DLLIndicates that the specified image is already loaded as a DLL.STATUS_INCOMPATIBLE_WITH_GLOBAL_SHORT_NAME_REGISTRY_SETTING"
+			"Short name settings may not be changed on this volume due to the global registry setting.STATUS_SHORT_NAMES_NOT_ENABLED_ON_VOLUME"
+			"Short names are not enabled on this volume.STATUS_SECURITY_STREAM_IS_INCONSISTENTThe security stream for the given volume is in an inconsistent state. Please run CHKDSK on the volume."
+			"STATUS_INVALID_LOCK_RANGEA requested file lock operation cannot be processed due to an invalid byte range.STATUS_INVALID_ACE_CONDITION"
+			"{Invalid ACE Condition} The specified access control entry (ACE) contains an invalid condition.STATUS_IMAGE_SUBSYSTEM_NOT_PRESENT"
+			"The subsystem needed to support the image type is not present.STATUS_NOTIFICATION_GUID_ALREADY_DEFINED{Invalid ACE Condition} The specified file already has a notification GUID associated with it."
+			"STATUS_NETWORK_OPEN_RESTRICTIONA remote open failed because the network open restrictions were not satisfied.STATUS_NO_USER_SESSION_KEY"
+			"There is no user session key for the specified logon session.STATUS_USER_SESSION_DELETEDThe remote user session has been deleted."
+			"STATUS_RESOURCE_LANG_NOT_FOUNDIndicates the specified resource language ID cannot be found in the image file.STATUS_INSUFF_SERVER_RESOURCES"
+			"Insufficient server resources exist to complete the request.STATUS_INVALID_BUFFER_SIZEThe size of the buffer is invalid for the specified operation."
+			"STATUS_INVALID_ADDRESS_COMPONENTThe transport rejected the network address specified as invalid.STATUS_INVALID_ADDRESS_WILDCARD"
+			"The transport rejected the network address specified due to an invalid use of a wildcard.STATUS_TOO_MANY_ADDRESSESThe transport address could not be opened because all the available addresses are in use."
+			"STATUS_ADDRESS_ALREADY_EXISTSThe transport address could not be opened because it already exists.STATUS_ADDRESS_CLOSEDThe transport address is now closed."
+			"STATUS_CONNECTION_DISCONNECTEDThe transport connection is now disconnected.STATUS_CONNECTION_RESETThe transport connection has been reset."
+			"STATUS_TOO_MANY_NODESThe transport cannot dynamically acquire any more nodes.STATUS_TRANSACTION_ABORTEDThe transport aborted a pending transaction."
+			"STATUS_TRANSACTION_TIMED_OUTThe transport timed out a request waiting for a response.STATUS_TRANSACTION_NO_RELEASEThe transport did not receive a release for a pending response."
+			"STATUS_TRANSACTION_NO_MATCHThe transport did not find a transaction matching the specific token.STATUS_TRANSACTION_RESPONDED"
+			"The transport had previously responded to a transaction request.STATUS_TRANSACTION_INVALID_IDThe transport does not recognized the transaction request identifier specified."
+			"STATUS_TRANSACTION_INVALID_TYPEThe transport does not recognize the transaction request type specified.STATUS_NOT_SERVER_SESSION"
+			"The transport can only process the specified request on the server side of a session.STATUS_NOT_CLIENT_SESSIONThe transport can only process the specified request on the client side of a session."
+			"STATUS_CANNOT_LOAD_REGISTRY_FILE{Registry File Failure} The registry cannot load the hive (file): %hs or its log or alternate. It is corrupt, absent, or not writable."
+			"STATUS_DEBUG_ATTACH_FAILED{Unexpected Failure in DebugActiveProcess} An unexpected failure occurred while processing a DebugActiveProcess API request. You may choose OK to terminate the process, or Cancel to ignore the error."
+			"STATUS_SYSTEM_PROCESS_TERMINATED{Fatal System Error} The %hs system process terminated unexpectedly with a status of 0x%08x (0x%08x 0x%08x). The system has been shut down."
+			"STATUS_DATA_NOT_ACCEPTED{Data Not Accepted} The TDI client could not handle the data received during an indication.STATUS_NO_BROWSER_SERVERS_FOUND"
+			"{Unable to Retrieve Browser Server List} The list of servers for this workgroup is not currently available.STATUS_VDM_HARD_ERROR"
+			"NTVDM encountered a hard error.STATUS_DRIVER_CANCEL_TIMEOUT{Cancel Timeout} The driver %hs failed to complete a cancelled I/O request in the allotted time."
+			"STATUS_REPLY_MESSAGE_MISMATCH{Reply Message Mismatch} An attempt was made to reply to an LPC message, but the thread specified by the client ID in the message was not waiting on that message."
+			"STATUS_MAPPED_ALIGNMENT{Mapped View Alignment Incorrect} An attempt was made to map a view of a file, but either the specified base address or the offset into the file were not aligned on the proper allocation granularity."
+			"STATUS_IMAGE_CHECKSUM_MISMATCH{Bad Image Checksum} The image %hs is possibly corrupt. The header checksum does not match the computed checksum."
+			"STATUS_LOST_WRITEBEHIND_DATA{Delayed Write Failed} Windows was unable to save all the data for the file %hs. The data has been lost. This error may be caused by a failure of your computer hardware or network connection. Please try to save this file elsewhere."
+			"STATUS_CLIENT_SERVER_PARAMETERS_INVALIDThe parameter(s) passed to the server in the client/server shared memory window were invalid. Too much data may have been put in the shared memory window."
+			"STATUS_PASSWORD_MUST_CHANGEThe user's password must be changed before logging on the first time.STATUS_NOT_FOUNDThe object was not found."
+			"STATUS_NOT_TINY_STREAMThe stream is not a tiny stream.STATUS_RECOVERY_FAILUREA transaction recover failed.STATUS_STACK_OVERFLOW_READ"
+			"The request must be handled by the stack overflow code.STATUS_FAIL_CHECKA consistency check failed.STATUS_DUPLICATE_OBJECTID"
+			"The attempt to insert the ID in the index failed because the ID is already in the index.STATUS_OBJECTID_EXISTSThe attempt to set the object's ID failed because the object already has an ID."
+			"STATUS_CONVERT_TO_LARGEInternal OFS status codes indicating how an allocation operation is handled. Either it is retried after the containing onode is moved or the extent stream is converted to a large stream."
+			"STATUS_RETRYThe request needs to be retried.STATUS_FOUND_OUT_OF_SCOPEThe attempt to find the object found an object matching by ID on the volume but it is out of the scope of the handle used for the operation."
+			"STATUS_ALLOCATE_BUCKETThe bucket array must be grown. Retry transaction after doing so.STATUS_PROPSET_NOT_FOUNDThe property set specified does not exist on the object."
+			"STATUS_MARSHALL_OVERFLOWThe user/kernel marshalling buffer has overflowed.STATUS_INVALID_VARIANTThe supplied variant structure contains invalid data."
+			"STATUS_DOMAIN_CONTROLLER_NOT_FOUNDCould not find a domain controller for this domain.STATUS_ACCOUNT_LOCKED_OUTThe user account has been automatically locked because too many invalid logon attempts or password change attempts have been requested."
+			"STATUS_HANDLE_NOT_CLOSABLENtClose was called on a handle that was protected from close via NtSetInformationObject.STATUS_CONNECTION_REFUSED"
+			"The transport connection attempt was refused by the remote system.STATUS_GRACEFUL_DISCONNECTThe transport connection was gracefully closed."
+			"STATUS_ADDRESS_ALREADY_ASSOCIATEDThe transport endpoint already has an address associated with it.STATUS_ADDRESS_NOT_ASSOCIATED"
+			"An address has not yet been associated with the transport endpoint.STATUS_CONNECTION_INVALIDAn operation was attempted on a nonexistent transport connection."
+			"STATUS_CONNECTION_ACTIVEAn invalid operation was attempted on an active transport connection.STATUS_NETWORK_UNREACHABLEThe remote network is not reachable by the transport."
+			"STATUS_HOST_UNREACHABLEThe remote system is not reachable by the transport.STATUS_PROTOCOL_UNREACHABLEThe remote system does not support the transport protocol."
+			"STATUS_PORT_UNREACHABLENo service is operating at the destination port of the transport on the remote system.STATUS_REQUEST_ABORTED"
+			"The request was aborted.STATUS_CONNECTION_ABORTEDThe transport connection was aborted by the local system.STATUS_BAD_COMPRESSION_BUFFER"
+			"The specified buffer contains ill-formed data.STATUS_USER_MAPPED_FILEThe requested operation cannot be performed on a file with a user mapped section open."
+			"STATUS_AUDIT_FAILED{Audit Failed} An attempt to generate a security audit failed.STATUS_TIMER_RESOLUTION_NOT_SETThe timer resolution was not previously set by the current process."
+			"STATUS_CONNECTION_COUNT_LIMITA connection to the server could not be made because the limit on the number of concurrent connections for this account has been reached."
+			"STATUS_LOGIN_TIME_RESTRICTIONAttempting to login during an unauthorized time of day for this account.STATUS_LOGIN_WKSTA_RESTRICTION"
+			"The account is not authorized to login from this station.STATUS_IMAGE_MP_UP_MISMATCH{UP/MP Image Mismatch} The image %hs has been modified for use on a uniprocessor system, but you are running it on a multiprocessor machine. Please reinstall the image file."
+			"STATUS_INSUFFICIENT_LOGON_INFOThere is insufficient account information to log you on.STATUS_BAD_DLL_ENTRYPOINT{Invalid DLL Entrypoint} The dynamic link library %hs is not written correctly. The stack pointer has been left in an inconsistent state. The entrypoint should be declared as WINAPI or STDCALL. Select YES to fail the DLL load. Select NO to continue execution. Selecting NO may cause the application to operate incorrectly."
+			"STATUS_BAD_SERVICE_ENTRYPOINT{Invalid Service Callback Entrypoint} The %hs service is not written correctly. The stack pointer has been left in an inconsistent state. The callback entrypoint should be declared as WINAPI or STDCALL. Selecting OK will cause the service to continue operation. However, the service process may operate incorrectly."
+			"STATUS_LPC_REPLY_LOSTThe server received the messages but did not send a reply.STATUS_IP_ADDRESS_CONFLICT1There is an IP address conflict with another system on the network"
+			"STATUS_IP_ADDRESS_CONFLICT2STATUS_REGISTRY_QUOTA_LIMIT{Low On Registry Space} The system has reached the maximum size allowed for the system part of the registry. Additional storage requests will be ignored."
+			"STATUS_PATH_NOT_COVEREDThe contacted server does not support the indicated part of the DFS namespace.STATUS_NO_CALLBACK_ACTIVE"
+			"A callback return system service cannot be executed when no callback is active.STATUS_LICENSE_QUOTA_EXCEEDEDThe service being accessed is licensed for a particular number of connections. No more connections can be made to the service at this time because there are already as many connections as the service can accept."
+			"STATUS_PWD_TOO_SHORTThe password provided is too short to meet the policy of your user account. Please choose a longer password."
+			"STATUS_PWD_TOO_RECENTThe policy of your user account does not allow you to change passwords too frequently. This is done to prevent users from changing back to a familiar, but potentially discovered, password. If you feel your password has been compromised then please contact your administrator immediately to have a new one assigned."
+			"STATUS_PWD_HISTORY_CONFLICTYou have attempted to change your password to one that you have used in the past. The policy of your user account does not allow this. Please select a password that you have not previously used."
+			"STATUS_PLUGPLAY_NO_DEVICEYou have attempted to load a legacy device driver while its device instance had been disabled.STATUS_UNSUPPORTED_COMPRESSION"
+			"The specified compression format is unsupported.STATUS_INVALID_HW_PROFILEThe specified hardware profile configuration is invalid."
+			"STATUS_INVALID_PLUGPLAY_DEVICE_PATHThe specified Plug and Play registry device path is invalid.STATUS_DRIVER_ORDINAL_NOT_FOUND"
+			"{Driver Entry Point Not Found} The %hs device driver could not locate the ordinal %ld in driver %hs.STATUS_DRIVER_ENTRYPOINT_NOT_FOUND"
+			"{Driver Entry Point Not Found} The %hs device driver could not locate the entry point %hs in driver %hs.STATUS_RESOURCE_NOT_OWNED"
+			"{Application Error} The application attempted to release a resource it did not own. Click OK to terminate the application."
+			"STATUS_TOO_MANY_LINKSAn attempt was made to create more links on a file than the file system supports.STATUS_QUOTA_LIST_INCONSISTENT"
+			"The specified quota list is internally inconsistent with its descriptor.STATUS_FILE_IS_OFFLINEThe specified file has been relocated to offline storage."
+			"STATUS_EVALUATION_EXPIRATION{Windows Evaluation Notification} The evaluation period for this installation of Windows has expired. This system will shutdown in 1 hour. To restore access to this installation of Windows, please upgrade this installation using a licensed distribution of this product."
+			"STATUS_ILLEGAL_DLL_RELOCATION{Illegal System DLL Relocation} The system DLL %hs was relocated in memory. The application will not run properly. The relocation occurred because the DLL %hs occupied an address range reserved for Windows system DLLs. The vendor supplying the DLL should be contacted for a new DLL."
+			"STATUS_LICENSE_VIOLATION{License Violation} The system has detected tampering with your registered product type. This is a violation of your software license. Tampering with product type is not permitted."
+			"STATUS_DLL_INIT_FAILED_LOGOFF{DLL Initialization Failed} The application failed to initialize because the window station is shutting down."
+			"STATUS_DRIVER_UNABLE_TO_LOAD{Unable to Load Device Driver} %hs device driver could not be loaded. Error Status was 0x%xSTATUS_DFS_UNAVAILABLE"
+			"DFS is unavailable on the contacted server.STATUS_VOLUME_DISMOUNTEDAn operation was attempted to a volume after it was dismounted."
+			"STATUS_WX86_INTERNAL_ERRORAn internal error occurred in the Win32 x86 emulation subsystem.STATUS_WX86_FLOAT_STACK_CHECKWin32 x86 emulation subsystem Floating-point stack check."
+			"STATUS_VALIDATE_CONTINUEThe validation process needs to continue on to the next step.STATUS_NO_MATCHThere was no match for the specified key in the index."
+			"STATUS_NO_MORE_MATCHESThere are no more matches for the current index enumeration.STATUS_NOT_A_REPARSE_POINTThe NTFS file or directory is not a reparse point."
+			"STATUS_IO_REPARSE_TAG_INVALIDThe Windows I/O reparse tag passed for the NTFS reparse point is invalid.STATUS_IO_REPARSE_TAG_MISMATCH"
+			"The Windows I/O reparse tag does not match the one present in the NTFS reparse point.STATUS_IO_REPARSE_DATA_INVALIDThe user data passed for the NTFS reparse point is invalid."
+			"STATUS_IO_REPARSE_TAG_NOT_HANDLEDThe layered file system driver for this IO tag did not handle it when needed.STATUS_REPARSE_POINT_NOT_RESOLVED"
+			"The NTFS symbolic link could not be resolved even though the initial file name is valid.STATUS_DIRECTORY_IS_A_REPARSE_POINT"
+			"The NTFS directory is a reparse point.STATUS_RANGE_LIST_CONFLICTThe range could not be added to the range list because of a conflict."
+			"STATUS_SOURCE_ELEMENT_EMPTYThe specified medium changer source element contains no media.STATUS_DESTINATION_ELEMENT_FULL"
+			"The specified medium changer destination element already contains media.STATUS_ILLEGAL_ELEMENT_ADDRESSThe specified medium changer element does not exist."
+			"STATUS_MAGAZINE_NOT_PRESENTThe specified element is contained within a magazine that is no longer present.STATUS_REINITIALIZATION_NEEDED"
+			"The device requires reinitialization due to hardware errors.STATUS_ENCRYPTION_FAILEDThe file encryption attempt failed.STATUS_DECRYPTION_FAILED"
+			"The file decryption attempt failed.STATUS_RANGE_NOT_FOUNDThe specified range could not be found in the range list.STATUS_NO_RECOVERY_POLICY"
+			"There is no encryption recovery policy configured for this system.STATUS_NO_EFSThe required encryption driver is not loaded for this system."
+			"STATUS_WRONG_EFSThe file was encrypted with a different encryption driver than is currently loaded.STATUS_NO_USER_KEYSThere are no EFS keys defined for the user."
+			"STATUS_FILE_NOT_ENCRYPTEDThe specified file is not encrypted.STATUS_NOT_EXPORT_FORMATThe specified file is not in the defined EFS export format."
+			"STATUS_FILE_ENCRYPTEDThe specified file is encrypted and the user does not have the ability to decrypt it.STATUS_WMI_GUID_NOT_FOUND"
+			"The guid passed was not recognized as valid by a WMI data provider.STATUS_WMI_INSTANCE_NOT_FOUNDThe instance name passed was not recognized as valid by a WMI data provider."
+			"STATUS_WMI_ITEMID_NOT_FOUNDThe data item id passed was not recognized as valid by a WMI data provider.STATUS_WMI_TRY_AGAIN"
+			"The WMI request could not be completed and should be retried.STATUS_SHARED_POLICYThe policy object is shared and can only be modified at the root"
+			"STATUS_POLICY_OBJECT_NOT_FOUNDThe policy object does not exist when it shouldSTATUS_POLICY_ONLY_IN_DSThe requested policy information only lives in the Ds"
+			"STATUS_VOLUME_NOT_UPGRADEDThe volume must be upgraded to enable this featureSTATUS_REMOTE_STORAGE_NOT_ACTIVEThe remote storage service is not operational at this time."
+			"STATUS_REMOTE_STORAGE_MEDIA_ERRORThe remote storage service encountered a media error.STATUS_NO_TRACKING_SERVICEThe tracking (workstation) service is not running."
+			"STATUS_SERVER_SID_MISMATCHThe server process is running under a SID different than that required by client.STATUS_DS_NO_ATTRIBUTE_OR_VALUE"
+			"The specified directory service attribute or value does not exist.STATUS_DS_INVALID_ATTRIBUTE_SYNTAXThe attribute syntax specified to the directory service is invalid."
+			"STATUS_DS_ATTRIBUTE_TYPE_UNDEFINEDThe attribute type specified to the directory service is not defined.STATUS_DS_ATTRIBUTE_OR_VALUE_EXISTS"
+			"The specified directory service attribute or value already exists.STATUS_DS_BUSYThe directory service is busy.STATUS_DS_UNAVAILABLE"
+			"The directory service is not available.STATUS_DS_NO_RIDS_ALLOCATEDThe directory service was unable to allocate a relative identifier."
+			"STATUS_DS_NO_MORE_RIDSThe directory service has exhausted the pool of relative identifiers.STATUS_DS_INCORRECT_ROLE_OWNER"
+			"The requested operation could not be performed because the directory service is not the master for that type of operation."
+			"STATUS_DS_RIDMGR_INIT_ERRORThe directory service was unable to initialize the subsystem that allocates relative identifiers."
+			"STATUS_DS_OBJ_CLASS_VIOLATIONThe requested operation did not satisfy one or more constraints associated with the class of the object."
+			"STATUS_DS_CANT_ON_NON_LEAFThe directory service can perform the requested operation only on a leaf object.STATUS_DS_CANT_ON_RDN"
+			"The directory service cannot perform the requested operation on the Relatively Defined Name (RDN) attribute of an object."
+			"STATUS_DS_CANT_MOD_OBJ_CLASSThe directory service detected an attempt to modify the object class of an object.STATUS_DS_CROSS_DOM_MOVE_FAILED"
+			"An error occurred while performing a cross domain move operation.STATUS_DS_GC_NOT_AVAILABLEUnable to Contact the Global Catalog Server."
+			"STATUS_DIRECTORY_SERVICE_REQUIREDThe requested operation requires a directory service, and none was available.STATUS_REPARSE_ATTRIBUTE_CONFLICT"
+			"The reparse attribute cannot be set as it is incompatible with an existing attribute.STATUS_CANT_ENABLE_DENY_ONLYA group marked use for deny only cannot be enabled."
+			"STATUS_FLOAT_MULTIPLE_FAULTS{EXCEPTION} Multiple floating point faults.STATUS_FLOAT_MULTIPLE_TRAPS{EXCEPTION} Multiple floating point traps."
+			"STATUS_DEVICE_REMOVEDThe device has been removed.STATUS_JOURNAL_DELETE_IN_PROGRESSThe volume change journal is being deleted."
+			"STATUS_JOURNAL_NOT_ACTIVEThe volume change journal is not active.STATUS_NOINTERFACEThe requested interface is not supported."
+			"STATUS_DS_ADMIN_LIMIT_EXCEEDEDA directory service resource limit has been exceeded.STATUS_DRIVER_FAILED_SLEEP{System Standby Failed} The driver %hs does not support standby mode. Updating this driver may allow the system to go to standby mode."
+			"STATUS_MUTUAL_AUTHENTICATION_FAILEDMutual Authentication failed. The server's password is out of date at the domain controller."
+			"STATUS_CORRUPT_SYSTEM_FILEThe system file %1 has become corrupt and has been replaced.STATUS_DATATYPE_MISALIGNMENT_ERROR"
+			"{EXCEPTION} Alignment Error A datatype misalignment error was detected in a load or store instruction.STATUS_WMI_READ_ONLY"
+			"The WMI data item or data block is read only.STATUS_WMI_SET_FAILUREThe WMI data item or data block could not be changed."
+			"STATUS_COMMITMENT_MINIMUM{Virtual Memory Minimum Too Low} Your system is low on virtual memory. Windows is increasing the size of your virtual memory paging file. During this process, memory requests for some applications may be denied. For more information, see Help."
+			"STATUS_REG_NAT_CONSUMPTION{EXCEPTION} Register NaT consumption faults. A NaT value is consumed on a non speculative instruction."
+			"STATUS_TRANSPORT_FULLThe medium changer's transport element contains media, which is causing the operation to fail.STATUS_DS_SAM_INIT_FAILURE"
+			"Security Accounts Manager initialization failed because of the following error: %hs Error Status: 0x%x. Please shutdown this system and reboot into Directory Services Restore Mode, check the event log for more detailed information."
+			"STATUS_ONLY_IF_CONNECTEDThis operation is supported only when you are connected to the server.STATUS_DS_SENSITIVE_GROUP_VIOLATION"
+			"Only an administrator can modify the membership list of an administrative group.STATUS_PNP_RESTART_ENUMERATIONA device was removed so enumeration must be restarted."
+			"STATUS_JOURNAL_ENTRY_DELETEDThe journal entry has been deleted from the journal.STATUS_DS_CANT_MOD_PRIMARYGROUPIDCannot change the primary group ID of a domain controller account."
+			"STATUS_SYSTEM_IMAGE_BAD_SIGNATURE{Fatal System Error} The system image %s is not properly signed. The file has been replaced with the signed file. The system has been shut down."
+			"STATUS_PNP_REBOOT_REQUIREDDevice will not start without a reboot.STATUS_POWER_STATE_INVALIDCurrent device power state cannot support this request."
+			"STATUS_DS_INVALID_GROUP_TYPEThe specified group type is invalid.STATUS_DS_NO_NEST_GLOBALGROUP_IN_MIXEDDOMAINIn mixed domain no nesting of global group if group is security enabled."
+			"STATUS_DS_NO_NEST_LOCALGROUP_IN_MIXEDDOMAINIn mixed domain, cannot nest local groups with other local groups, if the group is security enabled."
+			"STATUS_DS_GLOBAL_CANT_HAVE_LOCAL_MEMBERA global group cannot have a local group as a member.STATUS_DS_GLOBAL_CANT_HAVE_UNIVERSAL_MEMBER"
+			"A global group cannot have a universal group as a member.STATUS_DS_UNIVERSAL_CANT_HAVE_LOCAL_MEMBERA universal group cannot have a local group as a member."
+			"STATUS_DS_GLOBAL_CANT_HAVE_CROSSDOMAIN_MEMBERA global group cannot have a cross domain member.STATUS_DS_LOCAL_CANT_HAVE_CROSSDOMAIN_LOCAL_MEMBER"
+			"A local group cannot have another cross domain local group as a member.STATUS_DS_HAVE_PRIMARY_MEMBERSCannot change to security disabled group because of having primary members in this group."
+			"STATUS_WMI_NOT_SUPPORTEDThe WMI operation is not supported by the data block or method.STATUS_INSUFFICIENT_POWERThere is not enough power to complete the requested operation."
+			"STATUS_SAM_NEED_BOOTKEY_PASSWORDSecurity Account Manager needs to get the boot password.STATUS_SAM_NEED_BOOTKEY_FLOPPYSecurity Account Manager needs to get the boot key from floppy disk."
+			"STATUS_DS_CANT_STARTDirectory Service cannot start.STATUS_DS_INIT_FAILUREDirectory Services could not start because of the following error: %hs Error Status: 0x%x. Please shutdown this system and reboot into Directory Services Restore Mode, check the event log for more detailed information."
+			"STATUS_SAM_INIT_FAILURESecurity Accounts Manager initialization failed because of the following error: %hs Error Status: 0x%x. Please click OK to shutdown this system and reboot into Safe Mode, check the event log for more detailed information."
+			"STATUS_DS_GC_REQUIREDThe requested operation can be performed only on a global catalog server.STATUS_DS_LOCAL_MEMBER_OF_LOCAL_ONLY"
+			"A local group can only be a member of other local groups in the same domain.STATUS_DS_NO_FPO_IN_UNIVERSAL_GROUPSForeign security principals cannot be members of universal groups."
+			"STATUS_DS_MACHINE_ACCOUNT_QUOTA_EXCEEDEDYour computer could not be joined to the domain. You have exceeded the maximum number of computer accounts you are allowed to create in this domain. Contact your system administrator to have this limit reset or increased."
+			"STATUS_MULTIPLE_FAULT_VIOLATIONSTATUS_CURRENT_DOMAIN_NOT_ALLOWEDThis operation cannot be performed on the current domain."
+			"STATUS_CANNOT_MAKEThe directory or file cannot be created.STATUS_SYSTEM_SHUTDOWNThe system is in the process of shutting down."
+			"STATUS_DS_INIT_FAILURE_CONSOLEDirectory Services could not start because of the following error: %hs Error Status: 0x%x. Please click OK to shutdown the system. You can use the recovery console to diagnose the system further."
+			"STATUS_DS_SAM_INIT_FAILURE_CONSOLESecurity Accounts Manager initialization failed because of the following error: %hs Error Status: 0x%x. Please click OK to shutdown the system. You can use the recovery console to diagnose the system further."
+			"STATUS_UNFINISHED_CONTEXT_DELETEDA security context was deleted before the context was completed. This is considered a logon failure."
+			"STATUS_NO_TGT_REPLYThe client is trying to negotiate a context and the server requires user-to-user but didn't send a TGT reply."
+			"STATUS_OBJECTID_NOT_FOUNDAn object ID was not found in the file.STATUS_NO_IP_ADDRESSESUnable to accomplish the requested task because the local machine does not have any IP addresses."
+			"STATUS_WRONG_CREDENTIAL_HANDLEThe supplied credential handle does not match the credential associated with the security context."
+			"STATUS_CRYPTO_SYSTEM_INVALIDThe crypto system or checksum function is invalid because a required function is unavailable."
+			"STATUS_MAX_REFERRALS_EXCEEDEDThe number of maximum ticket referrals has been exceeded.STATUS_MUST_BE_KDCThe local machine must be a Kerberos KDC (domain controller) and it is not."
+			"STATUS_STRONG_CRYPTO_NOT_SUPPORTEDThe other end of the security negotiation is requires strong crypto but it is not supported on the local machine."
+			"STATUS_TOO_MANY_PRINCIPALSThe KDC reply contained more than one principal name.STATUS_NO_PA_DATAExpected to find PA data for a hint of what etype to use, but it was not found."
+			"STATUS_PKINIT_NAME_MISMATCHThe client certificate does not contain a valid UPN, or does not match the client name in the logon request. Please contact your administrator."
+			"STATUS_SMARTCARD_LOGON_REQUIREDSmartcard logon is required and was not used.STATUS_KDC_INVALID_REQUESTAn invalid request was sent to the KDC."
+			"STATUS_KDC_UNABLE_TO_REFERThe KDC was unable to generate a referral for the service requested.STATUS_KDC_UNKNOWN_ETYPEThe encryption type requested is not supported by the KDC."
+			"STATUS_SHUTDOWN_IN_PROGRESSA system shutdown is in progress.STATUS_SERVER_SHUTDOWN_IN_PROGRESSThe server machine is shutting down."
+			"STATUS_NOT_SUPPORTED_ON_SBSThis operation is not supported on a computer running Windows Server 2003 for Small Business Server"
+			"STATUS_WMI_GUID_DISCONNECTEDThe WMI GUID is no longer availableSTATUS_WMI_ALREADY_DISABLEDCollection or events for the WMI GUID is already disabled."
+			"STATUS_WMI_ALREADY_ENABLEDCollection or events for the WMI GUID is already enabled.STATUS_MFT_TOO_FRAGMENTEDThe Master File Table on the volume is too fragmented to complete this operation."
+			"STATUS_COPY_PROTECTION_FAILURECopy protection failure.STATUS_CSS_AUTHENTICATION_FAILURECopy protection error - DVD CSS Authentication failed."
+			"STATUS_CSS_KEY_NOT_PRESENTCopy protection error - The given sector does not contain a valid key.STATUS_CSS_KEY_NOT_ESTABLISHED"
+			"Copy protection error - DVD session key not established.STATUS_CSS_SCRAMBLED_SECTORCopy protection error - The read failed because the sector is encrypted."
+			"STATUS_CSS_REGION_MISMATCHCopy protection error - The given DVD's region does not correspond to the region setting of the drive."
+			"STATUS_CSS_RESETS_EXHAUSTEDCopy protection error - The drive's region setting may be permanent.STATUS_PKINIT_FAILUREThe Kerberos protocol encountered an error while validating the KDC certificate during smartcard Logon. There is more information in the system event log."
+			"STATUS_SMARTCARD_SUBSYSTEM_FAILUREThe Kerberos protocol encountered an error while attempting to utilize the smartcard subsystem."
+			"STATUS_NO_KERB_KEYThe target server does not have acceptable Kerberos credentials.STATUS_HOST_DOWNThe transport determined that the remote system is down."
+			"STATUS_UNSUPPORTED_PREAUTHAn unsupported preauthentication mechanism was presented to the Kerberos package.STATUS_EFS_ALG_BLOB_TOO_BIG"
+			"The encryption algorithm used on the source file needs a bigger key buffer than the one used on the destination file.STATUS_PORT_NOT_SET"
+			"An attempt to remove a process's DebugPort was made, but a port was not already associated with the process.STATUS_DEBUGGER_INACTIVE"
+			"Debugger Inactive: Windows may have been started without kernel debugging enabled.STATUS_DS_VERSION_CHECK_FAILUREThis version of Windows is not compatible with the behavior version of directory forest, domain or domain controller."
+			"STATUS_AUDITING_DISABLEDThe specified event is currently not being audited.STATUS_PRENT4_MACHINE_ACCOUNTThe machine account was created pre-NT4. The account needs to be recreated."
+			"STATUS_DS_AG_CANT_HAVE_UNIVERSAL_MEMBERA account group cannot have a universal group as a member.STATUS_INVALID_IMAGE_WIN_32"
+			"The specified image file did not have the correct format, it appears to be a 32-bit Windows image.STATUS_INVALID_IMAGE_WIN_64"
+			"The specified image file did not have the correct format, it appears to be a 64-bit Windows image.STATUS_BAD_BINDINGSClient's supplied SSPI channel bindings were incorrect."
+			"STATUS_NETWORK_SESSION_EXPIREDThe client's session has expired, so the client must reauthenticate to continue accessing the remote resources."
+			"STATUS_APPHELP_BLOCKAppHelp dialog canceled thus preventing the application from starting.STATUS_ALL_SIDS_FILTEREDThe SID filtering operation removed all SIDs."
+			"STATUS_NOT_SAFE_MODE_DRIVERThe driver was not loaded because the system is booting into safe mode.STATUS_ACCESS_DISABLED_BY_POLICY_DEFAULT"
+			"Access to %1 has been restricted by your Administrator by the default software restriction policy level.STATUS_ACCESS_DISABLED_BY_POLICY_PATH"
+			"Access to %1 has been restricted by your Administrator by location with policy rule %2 placed on path %3STATUS_ACCESS_DISABLED_BY_POLICY_PUBLISHER"
+			"Access to %1 has been restricted by your Administrator by software publisher policy.STATUS_ACCESS_DISABLED_BY_POLICY_OTHER"
+			"Access to %1 has been restricted by your Administrator by policy rule %2.STATUS_FAILED_DRIVER_ENTRYThe driver was not loaded because it failed it's initialization call."
+			"STATUS_DEVICE_ENUMERATION_ERRORThe \"%hs\" encountered an error while applying power or reading the device configuration. This may be caused by a failure of your hardware or by a poor connection."
+			"STATUS_MOUNT_POINT_NOT_RESOLVEDThe create operation failed because the name contained at least one mount point which resolves to a volume to which the specified device object is not attached."
+			"STATUS_INVALID_DEVICE_OBJECT_PARAMETERThe device object parameter is either not a valid device object or is not attached to the volume specified by the file name."
+			"STATUS_MCA_OCCUREDA Machine Check Error has occurred. Please check the system eventlog for additional information.STATUS_DRIVER_BLOCKED_CRITICAL"
+			"Driver %2 has been blocked from loading.STATUS_DRIVER_BLOCKEDSTATUS_DRIVER_DATABASE_ERRORThere was error [%2] processing the driver database."
+			"STATUS_SYSTEM_HIVE_TOO_LARGESystem hive size has exceeded its limit.STATUS_INVALID_IMPORT_OF_NON_DLLA dynamic link library (DLL) referenced a module that was neither a DLL nor the process's executable image."
+			"STATUS_NO_SECRETSThe local account store does not contain secret material for the specified account.STATUS_ACCESS_DISABLED_NO_SAFER_UI_BY_POLICY"
+			"STATUS_FAILED_STACK_SWITCHThe system was not able to allocate enough memory to perform a stack switch.STATUS_HEAP_CORRUPTION"
+			"A heap has been corrupted.STATUS_SMARTCARD_WRONG_PINAn incorrect PIN was presented to the smart cardSTATUS_SMARTCARD_CARD_BLOCKED"
+			"The smart card is blockedSTATUS_SMARTCARD_CARD_NOT_AUTHENTICATEDNo PIN was presented to the smart cardSTATUS_SMARTCARD_NO_CARD"
+			"No smart card availableSTATUS_SMARTCARD_NO_KEY_CONTAINERThe requested key container does not exist on the smart cardSTATUS_SMARTCARD_NO_CERTIFICATE"
+			"The requested certificate does not exist on the smart cardSTATUS_SMARTCARD_NO_KEYSETThe requested keyset does not existSTATUS_SMARTCARD_IO_ERROR"
+			"A communication error with the smart card has been detected.STATUS_DOWNGRADE_DETECTEDThe system detected a possible attempt to compromise security. Please ensure that you can contact the server that authenticated you."
+			"STATUS_SMARTCARD_CERT_REVOKEDThe smartcard certificate used for authentication has been revoked. Please contact your system administrator. There may be additional information in the event log."
+			"STATUS_ISSUING_CA_UNTRUSTEDAn untrusted certificate authority was detected While processing the smartcard certificate used for authentication. Please contact your system administrator."
+			"STATUS_REVOCATION_OFFLINE_CThe revocation status of the smartcard certificate used for authentication could not be determined. Please contact your system administrator."
+			"STATUS_PKINIT_CLIENT_FAILUREThe smartcard certificate used for authentication was not trusted. Please contact your system administrator."
+			"STATUS_SMARTCARD_CERT_EXPIREDThe smartcard certificate used for authentication has expired. Please contact your system administrator."
+			"STATUS_DRIVER_FAILED_PRIOR_UNLOADThe driver could not be loaded because a previous version of the driver is still in memory."
+			"STATUS_SMARTCARD_SILENT_CONTEXTThe smartcard provider could not perform the action since the context was acquired as silent."
+			"STATUS_PER_USER_TRUST_QUOTA_EXCEEDEDThe current user's delegated trust creation quota has been exceeded.STATUS_ALL_USER_TRUST_QUOTA_EXCEEDED"
+			"The total delegated trust creation quota has been exceeded.STATUS_USER_DELETE_TRUST_QUOTA_EXCEEDEDThe current user's delegated trust deletion quota has been exceeded."
+			"STATUS_DS_NAME_NOT_UNIQUEThe requested name already exists as a unique identifier.STATUS_DS_DUPLICATE_ID_FOUNDThe requested object has a non-unique identifier and cannot be retrieved."
+			"STATUS_DS_GROUP_CONVERSION_ERRORThe group cannot be converted due to attribute restrictions on the requested group type."
+			"STATUS_VOLSNAP_PREPARE_HIBERNATE{Volume Shadow Copy Service} Please wait while the Volume Shadow Copy Service prepares volume %hs for hibernation."
+			"STATUS_USER2USER_REQUIREDKerberos sub-protocol User2User is required.STATUS_STACK_BUFFER_OVERRUNThe system detected an overrun of a stack-based buffer in this application. This overrun could potentially allow a malicious user to gain control of this application."
+			"STATUS_NO_S4U_PROT_SUPPORTThe Kerberos subsystem encountered an error. A service for user protocol request was made against a domain controller which does not support service for user."
+			"STATUS_CROSSREALM_DELEGATION_FAILUREAn attempt was made by this server to make a Kerberos constrained delegation request for a target outside of the server's realm. This is not supported, and indicates a misconfiguration on this server's allowed to delegate to list. Please contact your administrator."
+			"STATUS_REVOCATION_OFFLINE_KDCThe revocation status of the domain controller certificate used for smartcard authentication could not be determined. There is additional information in the system event log. Please contact your system administrator."
+			"STATUS_ISSUING_CA_UNTRUSTED_KDCAn untrusted certificate authority was detected while processing the domain controller certificate used for authentication. There is additional information in the system event log. Please contact your system administrator."
+			"STATUS_KDC_CERT_EXPIREDThe domain controller certificate used for smartcard logon has expired. Please contact your system administrator with the contents of your system event log."
+			"STATUS_KDC_CERT_REVOKEDThe domain controller certificate used for smartcard logon has been revoked. Please contact your system administrator with the contents of your system event log."
+			"STATUS_PARAMETER_QUOTA_EXCEEDEDData present in one of the parameters is more than the function can operate on.STATUS_HIBERNATION_FAILURE"
+			"The system has failed to hibernate (The error code is %hs). Hibernation will be disabled until the system is restarted.STATUS_DELAY_LOAD_FAILED"
+			"An attempt to delay-load a .dll or get a function address in a delay-loaded .dll failed.STATUS_AUTHENTICATION_FIREWALL_FAILED"
+			"Logon Failure: The machine you are logging onto is protected by an authentication firewall. The specified account is not allowed to authenticate to the machine."
+			"STATUS_VDM_DISALLOWED%hs is a 16-bit application. You do not have permissions to execute 16-bit applications. Check your permissions with your system administrator."
+			"STATUS_HUNG_DISPLAY_DRIVER_THREAD{Display Driver Stopped Responding} The %hs display driver has stopped working normally. Save your work and reboot the system to restore full display functionality. The next time you reboot the machine a dialog will be displayed giving you a chance to report this failure to Microsoft."
+			"STATUS_INSUFFICIENT_RESOURCE_FOR_SPECIFIED_SHARED_SECTION_SIZEThe Desktop heap encountered an error while allocating session memory. There is more information in the system event log."
+			"STATUS_INVALID_CRUNTIME_PARAMETERAn invalid parameter was passed to a C runtime function.STATUS_NTLM_BLOCKEDThe authentication failed since NTLM was blocked."
+			"STATUS_DS_SRC_SID_EXISTS_IN_FORESTThe source object's SID already exists in destination forest.STATUS_DS_DOMAIN_NAME_EXISTS_IN_FOREST"
+			"The domain name of the trusted domain already exists in the forest.STATUS_DS_FLAT_NAME_EXISTS_IN_FORESTThe flat name of the trusted domain already exists in the forest."
+			"STATUS_INVALID_USER_PRINCIPAL_NAMEThe User Principal Name (UPN) is invalid.STATUS_FATAL_USER_CALLBACK_EXCEPTIONAn unhandled exception was encountered during a user callback."
+			"STATUS_ASSERTION_FAILUREAn assertion failure has occurred.STATUS_VERIFIER_STOPApplication verifier has found an error in the current process."
+			"STATUS_CALLBACK_POP_STACKAn exception has occurred in a user mode callback and the kernel callback frame should be removed."
+			"STATUS_INCOMPATIBLE_DRIVER_BLOCKED%2 has been blocked from loading due to incompatibility with this system. Please contact your software vendor for a compatible version of the driver."
+			"STATUS_HIVE_UNLOADEDIllegal operation attempted on a registry key which has already been unloaded.STATUS_COMPRESSION_DISABLED"
+			"Compression is disabled for this volume.STATUS_FILE_SYSTEM_LIMITATIONThe requested operation could not be completed due to a file system limitation"
+			"STATUS_INVALID_IMAGE_HASHWindows cannot verify the digital signature for this file. A recent hardware or software change might have installed a file that is signed incorrectly or damaged, or that might be malicious software from an unknown source."
+			"STATUS_NOT_CAPABLEThe implementation is not capable of performing the request.STATUS_REQUEST_OUT_OF_SEQUENCEThe requested operation is out of order with respect to other operations."
+			"STATUS_IMPLEMENTATION_LIMITAn operation attempted to exceed an implementation-defined limit.STATUS_ELEVATION_REQUIREDThe requested operation requires elevation."
+			"STATUS_NO_SECURITY_CONTEXTThe required security context does not exist.STATUS_PKU2U_CERT_FAILUREThe PKU2U protocol encountered an error while attempting to utilize the associated certificates."
+			"STATUS_BEYOND_VDLThe operation was attempted beyond the valid data length of the file.STATUS_ENCOUNTERED_WRITE_IN_PROGRESS"
+			"The attempted write operation encountered a write already in progress for some portion of the range.STATUS_PTE_CHANGEDThe page fault mappings changed in the middle of processing a fault so the operation must be retried."
+			"STATUS_PURGE_FAILEDThe attempt to purge this file from memory failed to purge some or all the data from memory.STATUS_CRED_REQUIRES_CONFIRMATION"
+			"The requested credential requires confirmation.STATUS_CS_ENCRYPTION_INVALID_SERVER_RESPONSEThe remote server sent an invalid response for a file being opened with Client Side Encryption."
+			"STATUS_CS_ENCRYPTION_UNSUPPORTED_SERVERClient Side Encryption is not supported by the remote server even though it claims to support it."
+			"STATUS_CS_ENCRYPTION_EXISTING_ENCRYPTED_FILEFile is encrypted and should be opened in Client Side Encryption mode.STATUS_CS_ENCRYPTION_NEW_ENCRYPTED_FILE"
+			"A new encrypted file is being created and a $EFS needs to be provided.STATUS_CS_ENCRYPTION_FILE_NOT_CSEThe SMB client requested a CSE FSCTL on a non-CSE file."
+			"STATUS_INVALID_LABELIndicates a particular Security ID may not be assigned as the label of an object.STATUS_DRIVER_PROCESS_TERMINATED"
+			"The process hosting the driver for this device has terminated.STATUS_AMBIGUOUS_SYSTEM_DEVICEThe requested system device cannot be identified due to multiple indistinguishable devices potentially matching the identification criteria."
+			"STATUS_SYSTEM_DEVICE_NOT_FOUNDThe requested system device cannot be found.STATUS_RESTART_BOOT_APPLICATIONThis boot application must be restarted."
+			"STATUS_INSUFFICIENT_NVRAM_RESOURCESInsufficient NVRAM resources exist to complete the API.  A reboot might be required.STATUS_INVALID_TASK_NAME"
+			"The specified task name is invalid.STATUS_INVALID_TASK_INDEXThe specified task index is invalid.STATUS_THREAD_ALREADY_IN_TASK"
+			"The specified thread is already joining a task.STATUS_CALLBACK_BYPASSA callback has requested to bypass native code.STATUS_FAIL_FAST_EXCEPTION"
+			"{Fail Fast Exception} A fail fast exception occurred. Exception handlers will not be invoked and the process will be terminated immediately."
+			"STATUS_IMAGE_CERT_REVOKEDWindows cannot verify the digital signature for this file. The signing certificate for this file has been revoked."
+			"STATUS_PORT_CLOSEDThe ALPC port is closed.STATUS_MESSAGE_LOSTThe ALPC message requested is no longer available.STATUS_INVALID_MESSAGE"
+			"The ALPC message supplied is invalid.STATUS_REQUEST_CANCELEDThe ALPC message has been canceled.STATUS_RECURSIVE_DISPATCH"
+			"Invalid recursive dispatch attempt.STATUS_LPC_RECEIVE_BUFFER_EXPECTEDNo receive buffer has been supplied in a synchrounus request."
+			"STATUS_LPC_INVALID_CONNECTION_USAGEThe connection port is used in an invalid context.STATUS_LPC_REQUESTS_NOT_ALLOWEDThe ALPC port does not accept new request messages."
+			"STATUS_RESOURCE_IN_USEThe resource requested is already in use.STATUS_HARDWARE_MEMORY_ERRORThe hardware has reported an uncorrectable memory error."
+			"STATUS_THREADPOOL_HANDLE_EXCEPTIONStatus 0x%08x was returned, waiting on handle 0x%x for wait 0x%p, in waiter 0x%p.STATUS_THREADPOOL_SET_EVENT_ON_COMPLETION_FAILED"
+			"After a callback to 0x%p(0x%p), a completion call to SetEvent(0x%p) failed with status 0x%08x.STATUS_THREADPOOL_RELEASE_SEMAPHORE_ON_COMPLETION_FAILED"
+			"After a callback to 0x%p(0x%p), a completion call to ReleaseSemaphore(0x%p, %d) failed with status 0x%08x.STATUS_THREADPOOL_RELEASE_MUTEX_ON_COMPLETION_FAILED"
+			"After a callback to 0x%p(0x%p), a completion call to ReleaseMutex(%p) failed with status 0x%08x.STATUS_THREADPOOL_FREE_LIBRARY_ON_COMPLETION_FAILED"
+			"After a callback to 0x%p(0x%p), an completion call to FreeLibrary(%p) failed with status 0x%08x.STATUS_THREADPOOL_RELEASED_DURING_OPERATION"
+			"The threadpool 0x%p was released while a thread was posting a callback to 0x%p(0x%p) to it.STATUS_CALLBACK_RETURNED_WHILE_IMPERSONATING"
+			"A threadpool worker thread is impersonating a client, after a callback to 0x%p(0x%p). This is unexpected, indicating that the callback is missing a call to revert the impersonation."
+			"STATUS_APC_RETURNED_WHILE_IMPERSONATINGA threadpool worker thread is impersonating a client, after executing an APC. This is unexpected, indicating that the APC is missing a call to revert the impersonation."
+			"STATUS_PROCESS_IS_PROTECTEDEither the target process, or the target thread's containing process, is a protected process."
+			"STATUS_MCA_EXCEPTIONA Thread is getting dispatched with MCA EXCEPTION because of MCA.STATUS_CERTIFICATE_MAPPING_NOT_UNIQUE"
+			"The client certificate account mapping is not unique.STATUS_SYMLINK_CLASS_DISABLEDThe symbolic link cannot be followed because its type is disabled."
+			"STATUS_INVALID_IDN_NORMALIZATIONIndicates that the specified string is not valid for IDN normalization.STATUS_NO_UNICODE_TRANSLATION"
+			"STATUS_ALREADY_REGISTEREDThe provided callback is already registered.STATUS_CONTEXT_MISMATCHThe provided context did not match the target."
+			"STATUS_PORT_ALREADY_HAS_COMPLETION_LISTThe specified port already has a completion list.STATUS_CALLBACK_RETURNED_THREAD_PRIORITY"
+			"A threadpool worker thread enter a callback at thread base priority 0x%x and exited at priority 0x%x. This is unexpected, indicating that the callback missed restoring the priority."
+			"STATUS_INVALID_THREADAn invalid thread, handle %p, is specified for this operation. Possibly, a threadpool worker thread was specified."
+			"STATUS_CALLBACK_RETURNED_TRANSACTIONA threadpool worker thread enter a callback, which left transaction state. This is unexpected, indicating that the callback missed clearing the transaction."
+			"STATUS_CALLBACK_RETURNED_LDR_LOCKA threadpool worker thread enter a callback, which left the loader lock held. This is unexpected, indicating that the callback missed releasing the lock."
+			"STATUS_CALLBACK_RETURNED_LANGA threadpool worker thread enter a callback, which left with preferred languages set. This is unexpected, indicating that the callback missed clearing them."
+			"STATUS_CALLBACK_RETURNED_PRI_BACKA threadpool worker thread enter a callback, which left with background priorities set. This is unexpected, indicating that the callback missed restoring the original priorities."
+			"STATUS_CALLBACK_RETURNED_THREAD_AFFINITYA threadpool worker thread enter a callback at thread affinity %p and exited at affinity %p. This is unexpected, indicating that the callback missed restoring the priority."
+			"STATUS_DISK_REPAIR_DISABLEDThe attempted operation required self healing to be enabled.STATUS_DS_DOMAIN_RENAME_IN_PROGRESS"
+			"The Directory Service cannot perform the requested operation because a domain rename operation is in progress.STATUS_DISK_QUOTA_EXCEEDED"
+			"The requested file operation failed because the storage quota was exceeded. To free up disk space, move files to a different location or delete unnecessary files. For more information, contact your system administrator."
+			"STATUS_CONTENT_BLOCKEDThe requested file operation failed because the storage policy blocks that type of file. For more information, contact your system administrator."
+			"STATUS_BAD_CLUSTERSThe operation could not be completed due to bad clusters on disk.STATUS_VOLUME_DIRTYThe operation could not be completed because the volume is dirty. Please run chkdsk and try again."
+			"STATUS_FILE_CHECKED_OUTThis file is checked out or locked for editing by another user.STATUS_CHECKOUT_REQUIREDThe file must be checked out before saving changes."
+			"STATUS_BAD_FILE_TYPEThe file type being saved or retrieved has been blocked.STATUS_FILE_TOO_LARGEThe file size exceeds the limit allowed and cannot be saved."
+			"STATUS_FORMS_AUTH_REQUIREDAccess Denied. Before opening files in this location, you must first browse to the web site and select the option to login automatically."
+			"STATUS_VIRUS_INFECTEDOperation did not complete successfully because the file contains a virus.STATUS_VIRUS_DELETEDThis file contains a virus and cannot be opened. Due to the nature of this virus, the file has been removed from this location."
+			"STATUS_BAD_MCFG_TABLEThe resources required for this device conflict with the MCFG table.STATUS_CANNOT_BREAK_OPLOCKThe operation did not complete successfully because it would cause an oplock to be broken. The caller has requested that existing oplocks not be broken."
+			"STATUS_WOW_ASSERTIONWOW Assertion Error.STATUS_INVALID_SIGNATUREThe cryptographic signature is invalid.STATUS_HMAC_NOT_SUPPORTED"
+			"The cryptographic provider does not support HMAC.STATUS_AUTH_TAG_MISMATCHThe computed authentication tag did not match the input authentication tag."
+			"STATUS_IPSEC_QUEUE_OVERFLOWThe IPSEC queue overflowed.STATUS_ND_QUEUE_OVERFLOWThe neighbor discovery queue overflowed.STATUS_HOPLIMIT_EXCEEDED"
+			"An ICMP hop limit exceeded error was received.STATUS_PROTOCOL_NOT_SUPPORTEDThe protocol is not installed on the local machine."
+			"STATUS_FASTPATH_REJECTEDAn operation or data has been rejected while on the network fast path.STATUS_LOST_WRITEBEHIND_DATA_NETWORK_DISCONNECTED"
+			"{Delayed Write Failed} Windows was unable to save all the data for the file %hs; the data has been lost. This error may be caused by network connectivity issues. Please try to save this file elsewhere."
+			"STATUS_LOST_WRITEBEHIND_DATA_NETWORK_SERVER_ERROR{Delayed Write Failed} Windows was unable to save all the data for the file %hs; the data has been lost. This error was returned by the server on which the file exists. Please try to save this file elsewhere."
+			"STATUS_LOST_WRITEBEHIND_DATA_LOCAL_DISK_ERROR{Delayed Write Failed} Windows was unable to save all the data for the file %hs; the data has been lost. This error may be caused if the device has been removed or the media is write-protected."
+			"STATUS_XML_PARSE_ERRORWindows was unable to parse the requested XML data.STATUS_XMLDSIG_ERRORAn error was encountered while processing an XML digital signature."
+			"STATUS_WRONG_COMPARTMENTIndicates that the caller made the connection request in the wrong routing compartment.STATUS_AUTHIP_FAILURE"
+			"Indicates that there was an AuthIP failure when attempting to connect to the remote host.STATUS_DS_OID_MAPPED_GROUP_CANT_HAVE_MEMBERS"
+			"OID mapped groups cannot have members.STATUS_DS_OID_NOT_FOUNDThe specified OID cannot be found.STATUS_HASH_NOT_SUPPORTED"
+			"Hash generation for the specified version and hash type is not enabled on server.STATUS_HASH_NOT_PRESENTThe hash requests is not present or not up to date with the current file contents."
+			"DBG_NO_STATE_CHANGEDebugger did not perform a state change.DBG_APP_NOT_IDLEDebugger has found the application is not idle."
+			"RPC_NT_INVALID_STRING_BINDINGThe string binding is invalid.RPC_NT_WRONG_KIND_OF_BINDINGThe binding handle is not the correct type."
+			"RPC_NT_INVALID_BINDINGThe binding handle is invalid.RPC_NT_PROTSEQ_NOT_SUPPORTEDThe RPC protocol sequence is not supported."
+			"RPC_NT_INVALID_RPC_PROTSEQThe RPC protocol sequence is invalid.RPC_NT_INVALID_STRING_UUIDThe string UUID is invalid.RPC_NT_INVALID_ENDPOINT_FORMAT"
+			"The endpoint format is invalid.RPC_NT_INVALID_NET_ADDRThe network address is invalid.RPC_NT_NO_ENDPOINT_FOUNDNo endpoint was found."
+			"RPC_NT_INVALID_TIMEOUTThe timeout value is invalid.RPC_NT_OBJECT_NOT_FOUNDThe object UUID was not found.RPC_NT_ALREADY_REGISTERED"
+			"The object UUID has already been registered.RPC_NT_TYPE_ALREADY_REGISTEREDThe type UUID has already been registered.RPC_NT_ALREADY_LISTENING"
+			"The RPC server is already listening.RPC_NT_NO_PROTSEQS_REGISTEREDNo protocol sequences have been registered.RPC_NT_NOT_LISTENING"
+			"The RPC server is not listening.RPC_NT_UNKNOWN_MGR_TYPEThe manager type is unknown.RPC_NT_UNKNOWN_IFThe interface is unknown."
+			"RPC_NT_NO_BINDINGSThere are no bindings.RPC_NT_NO_PROTSEQSThere are no protocol sequences.RPC_NT_CANT_CREATE_ENDPOINTThe endpoint cannot be created."
+			"RPC_NT_OUT_OF_RESOURCESNot enough resources are available to complete this operation.RPC_NT_SERVER_UNAVAILABLEThe RPC server is unavailable."
+			"RPC_NT_SERVER_TOO_BUSYThe RPC server is too busy to complete this operation.RPC_NT_INVALID_NETWORK_OPTIONSThe network options are invalid."
+			"RPC_NT_NO_CALL_ACTIVEThere are no remote procedure calls active on this thread.RPC_NT_CALL_FAILEDThe remote procedure call failed."
+			"RPC_NT_CALL_FAILED_DNEThe remote procedure call failed and did not execute.RPC_NT_PROTOCOL_ERRORAn RPC protocol error occurred."
+			"RPC_NT_UNSUPPORTED_TRANS_SYNThe transfer syntax is not supported by the RPC server.RPC_NT_UNSUPPORTED_TYPEThe type UUID is not supported."
+			"RPC_NT_INVALID_TAGThe tag is invalid.RPC_NT_INVALID_BOUNDThe array bounds are invalid.RPC_NT_NO_ENTRY_NAMEThe binding does not contain an entry name."
+			"RPC_NT_INVALID_NAME_SYNTAXThe name syntax is invalid.RPC_NT_UNSUPPORTED_NAME_SYNTAXThe name syntax is not supported.RPC_NT_UUID_NO_ADDRESS"
+			"No network address is available to use to construct a UUID.RPC_NT_DUPLICATE_ENDPOINTThe endpoint is a duplicate.RPC_NT_UNKNOWN_AUTHN_TYPE"
+			"The authentication type is unknown.RPC_NT_MAX_CALLS_TOO_SMALLThe maximum number of calls is too small.RPC_NT_STRING_TOO_LONG"
+			"The string is too long.RPC_NT_PROTSEQ_NOT_FOUNDThe RPC protocol sequence was not found.RPC_NT_PROCNUM_OUT_OF_RANGEThe procedure number is out of range."
+			"RPC_NT_BINDING_HAS_NO_AUTHThe binding does not contain any authentication information.RPC_NT_UNKNOWN_AUTHN_SERVICEThe authentication service is unknown."
+			"RPC_NT_UNKNOWN_AUTHN_LEVELThe authentication level is unknown.RPC_NT_INVALID_AUTH_IDENTITYThe security context is invalid."
+			"RPC_NT_UNKNOWN_AUTHZ_SERVICEThe authorization service is unknown.EPT_NT_INVALID_ENTRYThe entry is invalid.EPT_NT_CANT_PERFORM_OP"
+			"The operation cannot be performed.EPT_NT_NOT_REGISTEREDThere are no more endpoints available from the endpoint mapper.RPC_NT_NOTHING_TO_EXPORT"
+			"No interfaces have been exported.RPC_NT_INCOMPLETE_NAMEThe entry name is incomplete.RPC_NT_INVALID_VERS_OPTIONThe version option is invalid."
+			"RPC_NT_NO_MORE_MEMBERSThere are no more members.RPC_NT_NOT_ALL_OBJS_UNEXPORTEDThere is nothing to unexport.RPC_NT_INTERFACE_NOT_FOUND"
+			"The interface was not found.RPC_NT_ENTRY_ALREADY_EXISTSThe entry already exists.RPC_NT_ENTRY_NOT_FOUNDThe entry is not found."
+			"RPC_NT_NAME_SERVICE_UNAVAILABLEThe name service is unavailable.RPC_NT_INVALID_NAF_IDThe network address family is invalid."
+			"RPC_NT_CANNOT_SUPPORTThe requested operation is not supported.RPC_NT_NO_CONTEXT_AVAILABLENo security context is available to allow impersonation."
+			"RPC_NT_INTERNAL_ERRORAn internal error occurred in RPC.RPC_NT_ZERO_DIVIDEThe RPC server attempted an integer divide by zero."
+			"RPC_NT_ADDRESS_ERRORAn addressing error occurred in the RPC server.RPC_NT_FP_DIV_ZEROA floating point operation at the RPC server caused a divide by zero."
+			"RPC_NT_FP_UNDERFLOWA floating point underflow occurred at the RPC server.RPC_NT_FP_OVERFLOWA floating point overflow occurred at the RPC server."
+			"RPC_NT_CALL_IN_PROGRESSA remote procedure call is already in progress for this thread.RPC_NT_NO_MORE_BINDINGSThere are no more bindings."
+			"RPC_NT_GROUP_MEMBER_NOT_FOUNDThe group member was not found.EPT_NT_CANT_CREATEThe endpoint mapper database entry could not be created."
+			"RPC_NT_INVALID_OBJECTThe object UUID is the nil UUID.RPC_NT_NO_INTERFACESNo interfaces have been registered.RPC_NT_CALL_CANCELLED"
+			"The remote procedure call was cancelled.RPC_NT_BINDING_INCOMPLETEThe binding handle does not contain all required information."
+			"RPC_NT_COMM_FAILUREA communications failure occurred during a remote procedure call.RPC_NT_UNSUPPORTED_AUTHN_LEVELThe requested authentication level is not supported."
+			"RPC_NT_NO_PRINC_NAMENo principal name registered.RPC_NT_NOT_RPC_ERRORThe error specified is not a valid Windows RPC error code."
+			"RPC_NT_SEC_PKG_ERRORA security package specific error occurred.RPC_NT_NOT_CANCELLEDThread is not cancelled.RPC_NT_INVALID_ASYNC_HANDLE"
+			"Invalid asynchronous remote procedure call handle.RPC_NT_INVALID_ASYNC_CALLInvalid asynchronous RPC call handle for this operation."
+			"RPC_NT_PROXY_ACCESS_DENIEDAccess to the HTTP proxy is denied.RPC_NT_COOKIE_AUTH_FAILEDHTTP proxy server rejected the connection because the cookie authentication failed."
+			"RPC_NT_NO_MORE_ENTRIESThe list of RPC servers available for auto-handle binding has been exhausted.RPC_NT_SS_CHAR_TRANS_OPEN_FAIL"
+			"The file designated by DCERPCCHARTRANS cannot be opened.RPC_NT_SS_CHAR_TRANS_SHORT_FILEThe file containing the character translation table has fewer than 512 bytes."
+			"RPC_NT_SS_IN_NULL_CONTEXTA null context handle is passed as an [in] parameter.RPC_NT_SS_CONTEXT_MISMATCHThe context handle does not match any known context handles."
+			"RPC_NT_SS_CONTEXT_DAMAGEDThe context handle changed during a call.RPC_NT_SS_HANDLES_MISMATCHThe binding handles passed to a remote procedure call do not match."
+			"RPC_NT_SS_CANNOT_GET_CALL_HANDLEThe stub is unable to get the call handle.RPC_NT_NULL_REF_POINTERA null reference pointer was passed to the stub."
+			"RPC_NT_ENUM_VALUE_OUT_OF_RANGEThe enumeration value is out of range.RPC_NT_BYTE_COUNT_TOO_SMALLThe byte count is too small."
+			"RPC_NT_BAD_STUB_DATAThe stub received bad data.RPC_NT_INVALID_ES_ACTIONInvalid operation on the encoding/decoding handle."
+			"RPC_NT_WRONG_ES_VERSIONIncompatible version of the serializing package.RPC_NT_WRONG_STUB_VERSIONIncompatible version of the RPC stub."
+			"RPC_NT_INVALID_PIPE_OBJECTThe RPC pipe object is invalid or corrupted.RPC_NT_INVALID_PIPE_OPERATIONAn invalid operation was attempted on an RPC pipe object."
+			"RPC_NT_WRONG_PIPE_VERSIONUnsupported RPC pipe version.RPC_NT_PIPE_CLOSEDThe RPC pipe object has already been closed.RPC_NT_PIPE_DISCIPLINE_ERROR"
+			"The RPC call completed before all pipes were processed.RPC_NT_PIPE_EMPTYNo more data is available from the RPC pipe.STATUS_PNP_BAD_MPS_TABLE"
+			"A device is missing in the system BIOS MPS table. This device will not be used. Please contact your system vendor for system BIOS update."
+			"STATUS_PNP_TRANSLATION_FAILEDA translator failed to translate resources.STATUS_PNP_IRQ_TRANSLATION_FAILEDA IRQ translator failed to translate resources."
+			"STATUS_PNP_INVALID_IDDriver %2 returned invalid ID for a child device (%3).STATUS_IO_REISSUE_AS_CACHEDReissue the given operation as a cached IO operation"
+			"STATUS_CTX_WINSTATION_NAME_INVALIDSession name %1 is invalid.STATUS_CTX_INVALID_PDThe protocol driver %1 is invalid.STATUS_CTX_PD_NOT_FOUND"
+			"The protocol driver %1 was not found in the system path.STATUS_CTX_CLOSE_PENDINGA close operation is pending on the Terminal Connection."
+			"STATUS_CTX_NO_OUTBUFThere are no free output buffers available.STATUS_CTX_MODEM_INF_NOT_FOUNDThe MODEM.INF file was not found."
+			"STATUS_CTX_INVALID_MODEMNAMEThe modem (%1) was not found in MODEM.INF.STATUS_CTX_RESPONSE_ERRORThe modem did not accept the command sent to it. Verify the configured modem name matches the attached modem."
+			"STATUS_CTX_MODEM_RESPONSE_TIMEOUTThe modem did not respond to the command sent to it. Verify the modem is properly cabled and powered on."
+			"STATUS_CTX_MODEM_RESPONSE_NO_CARRIERCarrier detect has failed or carrier has been dropped due to disconnect.STATUS_CTX_MODEM_RESPONSE_NO_DIALTONE"
+			"Dial tone not detected within required time. Verify phone cable is properly attached and functional.STATUS_CTX_MODEM_RESPONSE_BUSY"
+			"Busy signal detected at remote site on callback.STATUS_CTX_MODEM_RESPONSE_VOICEVoice detected at remote site on callback."
+			"STATUS_CTX_TD_ERRORTransport driver errorSTATUS_CTX_LICENSE_CLIENT_INVALIDThe client you are using is not licensed to use this system. Your logon request is denied."
+			"STATUS_CTX_LICENSE_NOT_AVAILABLEThe system has reached its licensed logon limit. Please try again later.STATUS_CTX_LICENSE_EXPIRED"
+			"The system license has expired. Your logon request is denied.STATUS_CTX_WINSTATION_NOT_FOUNDThe specified session cannot be found."
+			"STATUS_CTX_WINSTATION_NAME_COLLISIONThe specified session name is already in use.STATUS_CTX_WINSTATION_BUSYThe task you are trying to do can't be completed because Remote Desktop Services is currently busy. Please try again in a few minutes. Other users should still be able to log on."
+			"STATUS_CTX_BAD_VIDEO_MODEAn attempt has been made to connect to a session whose video mode is not supported by the current client."
+			"STATUS_CTX_GRAPHICS_INVALIDThe application attempted to enable DOS graphics mode. DOS graphics mode is not supported.STATUS_CTX_NOT_CONSOLE"
+			"The requested operation can be performed only on the system console. This is most often the result of a driver or system DLL requiring direct console access."
+			"STATUS_CTX_CLIENT_QUERY_TIMEOUTThe client failed to respond to the server connect message.STATUS_CTX_CONSOLE_DISCONNECTDisconnecting the console session is not supported."
+			"STATUS_CTX_CONSOLE_CONNECTReconnecting a disconnected session to the console is not supported.STATUS_CTX_SHADOW_DENIEDThe request to control another session remotely was denied."
+			"STATUS_CTX_WINSTATION_ACCESS_DENIEDA process has requested access to a session, but has not been granted those access rights."
+			"STATUS_CTX_INVALID_WDThe Terminal Connection driver %1 is invalid.STATUS_CTX_WD_NOT_FOUNDThe Terminal Connection driver %1 was not found in the system path."
+			"STATUS_CTX_SHADOW_INVALIDThe requested session cannot be controlled remotely. You cannot control your own session, a session that is trying to control your session, a session that has no user logged on, nor control other sessions from the console."
+			"STATUS_CTX_SHADOW_DISABLEDThe requested session is not configured to allow remote control.STATUS_RDP_PROTOCOL_ERRORThe RDP protocol component %2 detected an error in the protocol stream and has disconnected the client."
+			"STATUS_CTX_CLIENT_LICENSE_NOT_SETYour request to connect to this Terminal server has been rejected. Your Terminal Server Client license number has not been entered for this copy of the Terminal Client. Please call your system administrator for help in entering a valid, unique license number for this Terminal Server Client. Click OK to continue."
+			"STATUS_CTX_CLIENT_LICENSE_IN_USEYour request to connect to this Terminal server has been rejected. Your Terminal Server Client license number is currently being used by another user. Please call your system administrator to obtain a new copy of the Terminal Server Client with a valid, unique license number. Click OK to continue."
+			"STATUS_CTX_SHADOW_ENDED_BY_MODE_CHANGEThe remote control of the console was terminated because the display mode was changed. Changing the display mode in a remote control session is not supported."
+			"STATUS_CTX_SHADOW_NOT_RUNNINGRemote control could not be terminated because the specified session is not currently being remotely controlled."
+			"STATUS_CTX_LOGON_DISABLEDYour interactive logon privilege has been disabled. Please contact your system administrator.STATUS_CTX_SECURITY_LAYER_ERROR"
+			"The Terminal Server security layer detected an error in the protocol stream and has disconnected the client. Client IP: %2."
+			"STATUS_TS_INCOMPATIBLE_SESSIONSThe target session is incompatible with the current session.STATUS_TS_VIDEO_SUBSYSTEM_ERROR"
+			"Windows can't connect to your session because a problem occurred in the Windows video subsystem. Try connecting again later, or contact the server administrator for assistance."
+			"STATUS_MUI_FILE_NOT_FOUNDThe resource loader failed to find MUI file.STATUS_MUI_INVALID_FILEThe resource loader failed to load MUI file because the file fail to pass validation."
+			"STATUS_MUI_INVALID_RC_CONFIGThe RC Manifest is corrupted with garbage data or unsupported version or missing required item."
+			"STATUS_MUI_INVALID_LOCALE_NAMEThe RC Manifest has invalid culture name.STATUS_MUI_INVALID_ULTIMATEFALLBACK_NAMEThe RC Manifest has invalid ultimatefallback name."
+			"STATUS_MUI_FILE_NOT_LOADEDThe resource loader cache doesn't have loaded MUI entry.STATUS_RESOURCE_ENUM_USER_STOPUser stopped resource enumeration."
+			"STATUS_CLUSTER_INVALID_NODEThe cluster node is not valid.STATUS_CLUSTER_NODE_EXISTSThe cluster node already exists.STATUS_CLUSTER_JOIN_IN_PROGRESS"
+			"A node is in the process of joining the cluster.STATUS_CLUSTER_NODE_NOT_FOUNDThe cluster node was not found.STATUS_CLUSTER_LOCAL_NODE_NOT_FOUND"
+			"The cluster local node information was not found.STATUS_CLUSTER_NETWORK_EXISTSThe cluster network already exists.STATUS_CLUSTER_NETWORK_NOT_FOUND"
+			"The cluster network was not found.STATUS_CLUSTER_NETINTERFACE_EXISTSThe cluster network interface already exists.STATUS_CLUSTER_NETINTERFACE_NOT_FOUND"
+			"";
+
+		constexpr const char page_2[] =
+			"The cluster network interface was not found.STATUS_CLUSTER_INVALID_REQUESTThe cluster request is not valid for this object."
+			"STATUS_CLUSTER_INVALID_NETWORK_PROVIDERThe cluster network provider is not valid.STATUS_CLUSTER_NODE_DOWNThe cluster node is down."
+			"STATUS_CLUSTER_NODE_UNREACHABLEThe cluster node is not reachable.STATUS_CLUSTER_NODE_NOT_MEMBERThe cluster node is not a member of the cluster."
+			"STATUS_CLUSTER_JOIN_NOT_IN_PROGRESSA cluster join operation is not in progress.STATUS_CLUSTER_INVALID_NETWORKThe cluster network is not valid."
+			"STATUS_CLUSTER_NO_NET_ADAPTERSNo network adapters are available.STATUS_CLUSTER_NODE_UPThe cluster node is up.STATUS_CLUSTER_NODE_PAUSED"
+			"The cluster node is paused.STATUS_CLUSTER_NODE_NOT_PAUSEDThe cluster node is not paused.STATUS_CLUSTER_NO_SECURITY_CONTEXT"
+			"No cluster security context is available.STATUS_CLUSTER_NETWORK_NOT_INTERNALThe cluster network is not configured for internal cluster communication."
+			"STATUS_CLUSTER_POISONEDThe cluster node has been poisoned.STATUS_CLUSTER_NON_CSV_PATHThe path does not belong to a cluster shared volume."
+			"STATUS_CLUSTER_CSV_VOLUME_NOT_LOCALThe cluster shared volume is not locally mounted.STATUS_ACPI_INVALID_OPCODEAn attempt was made to run an invalid AML opcode"
+			"STATUS_ACPI_STACK_OVERFLOWThe AML Interpreter Stack has overflowedSTATUS_ACPI_ASSERT_FAILEDAn inconsistent state has occurred"
+			"STATUS_ACPI_INVALID_INDEXAn attempt was made to access an array outside of its boundsSTATUS_ACPI_INVALID_ARGUMENTA required argument was not specified"
+			"STATUS_ACPI_FATALA fatal error has occurredSTATUS_ACPI_INVALID_SUPERNAMEAn invalid SuperName was specifiedSTATUS_ACPI_INVALID_ARGTYPE"
+			"An argument with an incorrect type was specifiedSTATUS_ACPI_INVALID_OBJTYPEAn object with an incorrect type was specified"
+			"STATUS_ACPI_INVALID_TARGETTYPEA target with an incorrect type was specifiedSTATUS_ACPI_INCORRECT_ARGUMENT_COUNTAn incorrect number of arguments were specified"
+			"STATUS_ACPI_ADDRESS_NOT_MAPPEDAn address failed to translateSTATUS_ACPI_INVALID_EVENTTYPEAn incorrect event type was specified"
+			"STATUS_ACPI_HANDLER_COLLISIONA handler for the target already existsSTATUS_ACPI_INVALID_DATAInvalid data for the target was specified"
+			"STATUS_ACPI_INVALID_REGIONAn invalid region for the target was specifiedSTATUS_ACPI_INVALID_ACCESS_SIZEAn attempt was made to access a field outside of the defined range"
+			"STATUS_ACPI_ACQUIRE_GLOBAL_LOCKThe Global system lock could not be acquiredSTATUS_ACPI_ALREADY_INITIALIZEDAn attempt was made to reinitialize the ACPI subsystem"
+			"STATUS_ACPI_NOT_INITIALIZEDThe ACPI subsystem has not been initializedSTATUS_ACPI_INVALID_MUTEX_LEVELAn incorrect mutex was specified"
+			"STATUS_ACPI_MUTEX_NOT_OWNEDThe mutex is not currently ownedSTATUS_ACPI_MUTEX_NOT_OWNERAn attempt was made to access the mutex by a process that was not the owner"
+			"STATUS_ACPI_RS_ACCESSAn error occurred during an access to Region SpaceSTATUS_ACPI_INVALID_TABLEAn attempt was made to use an incorrect table"
+			"STATUS_ACPI_REG_HANDLER_FAILEDThe registration of an ACPI event failedSTATUS_ACPI_POWER_REQUEST_FAILEDAn ACPI Power Object failed to transition state"
+			"STATUS_SXS_SECTION_NOT_FOUNDThe requested section is not present in the activation context.STATUS_SXS_CANT_GEN_ACTCTXWindows was not able to process the application binding information. Please refer to your System Event Log for further information."
+			"STATUS_SXS_INVALID_ACTCTXDATA_FORMATThe application binding data format is invalid.STATUS_SXS_ASSEMBLY_NOT_FOUNDThe referenced assembly is not installed on your system."
+			"STATUS_SXS_MANIFEST_FORMAT_ERRORThe manifest file does not begin with the required tag and format information.STATUS_SXS_MANIFEST_PARSE_ERROR"
+			"The manifest file contains one or more syntax errors.STATUS_SXS_ACTIVATION_CONTEXT_DISABLEDThe application attempted to activate a disabled activation context."
+			"STATUS_SXS_KEY_NOT_FOUNDThe requested lookup key was not found in any active activation context.STATUS_SXS_VERSION_CONFLICT"
+			"A component version required by the application conflicts with another component version already active.STATUS_SXS_WRONG_SECTION_TYPE"
+			"The type requested activation context section does not match the query API used.STATUS_SXS_THREAD_QUERIES_DISABLEDLack of system resources has required isolated activation to be disabled for the current thread of execution."
+			"STATUS_SXS_ASSEMBLY_MISSINGThe referenced assembly could not be found.STATUS_SXS_PROCESS_DEFAULT_ALREADY_SETAn attempt to set the process default activation context failed because the process default activation context was already set."
+			"STATUS_SXS_EARLY_DEACTIVATIONThe activation context being deactivated is not the most recently activated one.STATUS_SXS_INVALID_DEACTIVATION"
+			"The activation context being deactivated is not active for the current thread of execution.STATUS_SXS_MULTIPLE_DEACTIVATION"
+			"The activation context being deactivated has already been deactivated.STATUS_SXS_SYSTEM_DEFAULT_ACTIVATION_CONTEXT_EMPTY"
+			"The activation context of system default assembly could not be generated.STATUS_SXS_PROCESS_TERMINATION_REQUESTEDA component used by the isolation facility has requested to terminate the process."
+			"STATUS_SXS_CORRUPT_ACTIVATION_STACKThe activation context activation stack for the running thread of execution is corrupt."
+			"STATUS_SXS_CORRUPTIONThe application isolation metadata for this process or thread has become corrupt.STATUS_SXS_INVALID_IDENTITY_ATTRIBUTE_VALUE"
+			"The value of an attribute in an identity is not within the legal range.STATUS_SXS_INVALID_IDENTITY_ATTRIBUTE_NAMEThe name of an attribute in an identity is not within the legal range."
+			"STATUS_SXS_IDENTITY_DUPLICATE_ATTRIBUTEAn identity contains two definitions for the same attribute.STATUS_SXS_IDENTITY_PARSE_ERROR"
+			"The identity string is malformed. This may be due to a trailing comma, more than two unnamed attributes, missing attribute name or missing attribute value."
+			"STATUS_SXS_COMPONENT_STORE_CORRUPTThe component store has been corrupted.STATUS_SXS_FILE_HASH_MISMATCHA component's file does not match the verification information present in the component manifest."
+			"STATUS_SXS_MANIFEST_IDENTITY_SAME_BUT_CONTENTS_DIFFERENTThe identities of the manifests are identical but their contents are different."
+			"STATUS_SXS_IDENTITIES_DIFFERENTThe component identities are different.STATUS_SXS_ASSEMBLY_IS_NOT_A_DEPLOYMENTThe assembly is not a deployment."
+			"STATUS_SXS_FILE_NOT_PART_OF_ASSEMBLYThe file is not a part of the assembly.STATUS_ADVANCED_INSTALLER_FAILEDAn advanced installer failed during setup or servicing."
+			"STATUS_XML_ENCODING_MISMATCHThe character encoding in the XML declaration did not match the encoding used in the document."
+			"STATUS_SXS_MANIFEST_TOO_BIGThe size of the manifest exceeds the maximum allowed.STATUS_SXS_SETTING_NOT_REGISTEREDThe setting is not registered."
+			"STATUS_SXS_TRANSACTION_CLOSURE_INCOMPLETEOne or more required members of the transaction are not present.STATUS_SMI_PRIMITIVE_INSTALLER_FAILED"
+			"The SMI primitive installer failed during setup or servicing.STATUS_GENERIC_COMMAND_FAILEDA generic command executable returned a result that indicates failure."
+			"STATUS_SXS_FILE_HASH_MISSINGA component is missing file verification information in its manifest.STATUS_TRANSACTIONAL_CONFLICT"
+			"The function attempted to use a name that is reserved for use by another transaction.STATUS_INVALID_TRANSACTIONThe transaction handle associated with this operation is not valid."
+			"STATUS_TRANSACTION_NOT_ACTIVEThe requested operation was made in the context of a transaction that is no longer active.STATUS_TM_INITIALIZATION_FAILED"
+			"The Transaction Manager was unable to be successfully initialized. Transacted operations are not supported.STATUS_RM_NOT_ACTIVE"
+			"Transaction support within the specified resource manager is not started or was shut down due to an error.STATUS_RM_METADATA_CORRUPT"
+			"The metadata of the RM has been corrupted. The RM will not function.STATUS_TRANSACTION_NOT_JOINEDThe resource manager has attempted to prepare a transaction that it has not successfully joined."
+			"STATUS_DIRECTORY_NOT_RMThe specified directory does not contain a file system resource manager.STATUS_TRANSACTIONS_UNSUPPORTED_REMOTE"
+			"The remote server or share does not support transacted file operations.STATUS_LOG_RESIZE_INVALID_SIZEThe requested log size for the file system resource manager is invalid."
+			"STATUS_REMOTE_FILE_VERSION_MISMATCHThe remote server sent mismatching version number or Fid for a file opened with transactions."
+			"STATUS_CRM_PROTOCOL_ALREADY_EXISTSThe RM tried to register a protocol that already exists.STATUS_TRANSACTION_PROPAGATION_FAILED"
+			"The attempt to propagate the Transaction failed.STATUS_CRM_PROTOCOL_NOT_FOUNDThe requested propagation protocol was not registered as a CRM."
+			"STATUS_TRANSACTION_SUPERIOR_EXISTSThe Transaction object already has a superior enlistment, and the caller attempted an operation that would have created a new superior. Only a single superior enlistment is allowed."
+			"STATUS_TRANSACTION_REQUEST_NOT_VALIDThe requested operation is not valid on the Transaction object in its current state."
+			"STATUS_TRANSACTION_NOT_REQUESTEDThe caller has called a response API, but the response is not expected because the TM did not issue the corresponding request to the caller."
+			"STATUS_TRANSACTION_ALREADY_ABORTEDIt is too late to perform the requested operation, since the Transaction has already been aborted."
+			"STATUS_TRANSACTION_ALREADY_COMMITTEDIt is too late to perform the requested operation, since the Transaction has already been committed."
+			"STATUS_TRANSACTION_INVALID_MARSHALL_BUFFERThe buffer passed in to NtPushTransaction or NtPullTransaction is not in a valid format."
+			"STATUS_CURRENT_TRANSACTION_NOT_VALIDThe current transaction context associated with the thread is not a valid handle to a transaction object."
+			"STATUS_LOG_GROWTH_FAILEDAn attempt to create space in the transactional resource manager's log failed. The failure status has been recorded in the event log."
+			"STATUS_OBJECT_NO_LONGER_EXISTSThe object (file, stream, link) corresponding to the handle has been deleted by a transaction savepoint rollback."
+			"STATUS_STREAM_MINIVERSION_NOT_FOUNDThe specified file miniversion was not found for this transacted file open.STATUS_STREAM_MINIVERSION_NOT_VALID"
+			"The specified file miniversion was found but has been invalidated. Most likely cause is a transaction savepoint rollback."
+			"STATUS_MINIVERSION_INACCESSIBLE_FROM_SPECIFIED_TRANSACTIONA miniversion may only be opened in the context of the transaction that created it."
+			"STATUS_CANT_OPEN_MINIVERSION_WITH_MODIFY_INTENTIt is not possible to open a miniversion with modify access.STATUS_CANT_CREATE_MORE_STREAM_MINIVERSIONS"
+			"It is not possible to create any more miniversions for this stream.STATUS_HANDLE_NO_LONGER_VALIDThe handle has been invalidated by a transaction. The most likely cause is the presence of memory mapping on a file or an open handle when the transaction ended or rolled back to savepoint."
+			"STATUS_LOG_CORRUPTION_DETECTEDThe log data is corrupt.STATUS_RM_DISCONNECTEDThe transaction outcome is unavailable because the resource manager responsible for it has disconnected."
+			"STATUS_ENLISTMENT_NOT_SUPERIORThe request was rejected because the enlistment in question is not a superior enlistment.STATUS_FILE_IDENTITY_NOT_PERSISTENT"
+			"The file cannot be opened transactionally, because its identity depends on the outcome of an unresolved transaction.STATUS_CANT_BREAK_TRANSACTIONAL_DEPENDENCY"
+			"The operation cannot be performed because another transaction is depending on the fact that this property will not change."
+			"STATUS_CANT_CROSS_RM_BOUNDARYThe operation would involve a single file with two transactional resource managers and is therefore not allowed."
+			"STATUS_TXF_DIR_NOT_EMPTYThe $Txf directory must be empty for this operation to succeed.STATUS_INDOUBT_TRANSACTIONS_EXIST"
+			"The operation would leave a transactional resource manager in an inconsistent state and is therefore not allowed.STATUS_TM_VOLATILE"
+			"The operation could not be completed because the transaction manager does not have a log.STATUS_ROLLBACK_TIMER_EXPIREDA rollback could not be scheduled because a previously scheduled rollback has already executed or been queued for execution."
+			"STATUS_TXF_ATTRIBUTE_CORRUPTThe transactional metadata attribute on the file or directory %hs is corrupt and unreadable."
+			"STATUS_EFS_NOT_ALLOWED_IN_TRANSACTIONThe encryption operation could not be completed because a transaction is active.STATUS_TRANSACTIONAL_OPEN_NOT_ALLOWED"
+			"This object is not allowed to be opened in a transaction.STATUS_TRANSACTED_MAPPING_UNSUPPORTED_REMOTEMemory mapping (creating a mapped section) a remote file under a transaction is not supported."
+			"STATUS_TRANSACTION_REQUIRED_PROMOTIONPromotion was required in order to allow the resource manager to enlist, but the transaction was set to disallow it."
+			"STATUS_CANNOT_EXECUTE_FILE_IN_TRANSACTIONThis file is open for modification in an unresolved transaction and may be opened for execute only by a transacted reader."
+			"STATUS_TRANSACTIONS_NOT_FROZENThe request to thaw frozen transactions was ignored because transactions had not previously been frozen."
+			"STATUS_TRANSACTION_FREEZE_IN_PROGRESSTransactions cannot be frozen because a freeze is already in progress.STATUS_NOT_SNAPSHOT_VOLUME"
+			"The target volume is not a snapshot volume. This operation is only valid on a volume mounted as a snapshot.STATUS_NO_SAVEPOINT_WITH_OPEN_FILES"
+			"The savepoint operation failed because files are open on the transaction. This is not permitted.STATUS_SPARSE_NOT_ALLOWED_IN_TRANSACTION"
+			"The sparse operation could not be completed because a transaction is active on the file.STATUS_TM_IDENTITY_MISMATCHThe call to create a TransactionManager object failed because the Tm Identity stored in the logfile does not match the Tm Identity that was passed in as an argument."
+			"STATUS_FLOATED_SECTIONI/O was attempted on a section object that has been floated as a result of a transaction ending. There is no valid data."
+			"STATUS_CANNOT_ACCEPT_TRANSACTED_WORKThe transactional resource manager cannot currently accept transacted work due to a transient condition such as low resources."
+			"STATUS_CANNOT_ABORT_TRANSACTIONSThe transactional resource manager had too many tranactions outstanding that could not be aborted. The transactional resource manger has been shut down."
+			"STATUS_TRANSACTION_NOT_FOUNDThe specified Transaction was unable to be opened, because it was not found.STATUS_RESOURCEMANAGER_NOT_FOUND"
+			"The specified ResourceManager was unable to be opened, because it was not found.STATUS_ENLISTMENT_NOT_FOUNDThe specified Enlistment was unable to be opened, because it was not found."
+			"STATUS_TRANSACTIONMANAGER_NOT_FOUNDThe specified TransactionManager was unable to be opened, because it was not found.STATUS_TRANSACTIONMANAGER_NOT_ONLINE"
+			"The object specified could not be created or opened, because its associated TransactionManager is not online.  The TransactionManager must be brought fully Online by calling RecoverTransactionManager to recover to the end of its LogFile before objects in its Transaction or ResourceManager namespaces can be opened.  In addition, errors in writing records to its LogFile can cause a TransactionManager to go offline."
+			"STATUS_TRANSACTIONMANAGER_RECOVERY_NAME_COLLISIONThe specified TransactionManager was unable to create the objects contained in its logfile in the Ob namespace. Therefore, the TransactionManager was unable to recover."
+			"STATUS_TRANSACTION_NOT_ROOTThe call to create a superior Enlistment on this Transaction object could not be completed, because the Transaction object specified for the enlistment is a subordinate branch of the Transaction. Only the root of the Transaction can be enlisted on as a superior."
+			"STATUS_TRANSACTION_OBJECT_EXPIREDBecause the associated transaction manager or resource manager has been closed, the handle is no longer valid."
+			"STATUS_COMPRESSION_NOT_ALLOWED_IN_TRANSACTIONThe compression operation could not be completed because a transaction is active on the file."
+			"STATUS_TRANSACTION_RESPONSE_NOT_ENLISTEDThe specified operation could not be performed on this Superior enlistment, because the enlistment was not created with the corresponding completion response in the NotificationMask."
+			"STATUS_TRANSACTION_RECORD_TOO_LONGThe specified operation could not be performed, because the record that would be logged was too long. This can occur because of two conditions:  either there are too many Enlistments on this Transaction, or the combined RecoveryInformation being logged on behalf of those Enlistments is too long."
+			"STATUS_NO_LINK_TRACKING_IN_TRANSACTIONThe link tracking operation could not be completed because a transaction is active."
+			"STATUS_OPERATION_NOT_SUPPORTED_IN_TRANSACTIONThis operation cannot be performed in a transaction.STATUS_TRANSACTION_INTEGRITY_VIOLATED"
+			"The kernel transaction manager had to abort or forget the transaction because it blocked forward progress.STATUS_TRANSACTIONMANAGER_IDENTITY_MISMATCH"
+			"The TransactionManager identity that was supplied did not match the one recorded in the TransactionManager's log file.STATUS_RM_CANNOT_BE_FROZEN_FOR_SNAPSHOT"
+			"This snapshot operation cannot continue because a transactional resource manager cannot be frozen in its current state.  Please try again."
+			"STATUS_TRANSACTION_MUST_WRITETHROUGHThe transaction cannot be enlisted on with the specified EnlistmentMask, because the transaction has already completed the PrePrepare phase.  In order to ensure correctness, the ResourceManager must switch to a write-through mode and cease caching data within this transaction.  Enlisting for only subsequent transaction phases may still succeed."
+			"STATUS_TRANSACTION_NO_SUPERIORThe transaction does not have a superior enlistment.STATUS_EXPIRED_HANDLEThe handle is no longer properly associated with its transaction.  It may have been opened in a transactional resource manager that was subsequently forced to restart.  Please close the handle and open a new one."
+			"STATUS_TRANSACTION_NOT_ENLISTEDThe specified operation could not be performed because the resource manager is not enlisted in the transaction."
+			"STATUS_LOG_SECTOR_INVALIDLog service found an invalid log sector.STATUS_LOG_SECTOR_PARITY_INVALIDLog service encountered a log sector with invalid block parity."
+			"STATUS_LOG_SECTOR_REMAPPEDLog service encountered a remapped log sector.STATUS_LOG_BLOCK_INCOMPLETELog service encountered a partial or incomplete log block."
+			"STATUS_LOG_INVALID_RANGELog service encountered an attempt access data outside the active log range.STATUS_LOG_BLOCKS_EXHAUSTED"
+			"Log service user log marshalling buffers are exhausted.STATUS_LOG_READ_CONTEXT_INVALIDLog service encountered an attempt read from a marshalling area with an invalid read context."
+			"STATUS_LOG_RESTART_INVALIDLog service encountered an invalid log restart area.STATUS_LOG_BLOCK_VERSIONLog service encountered an invalid log block version."
+			"STATUS_LOG_BLOCK_INVALIDLog service encountered an invalid log block.STATUS_LOG_READ_MODE_INVALIDLog service encountered an attempt to read the log with an invalid read mode."
+			"STATUS_LOG_METADATA_CORRUPTLog service encountered a corrupted metadata file.STATUS_LOG_METADATA_INVALIDLog service encountered a metadata file that could not be created by the log file system."
+			"STATUS_LOG_METADATA_INCONSISTENTLog service encountered a metadata file with inconsistent data.STATUS_LOG_RESERVATION_INVALID"
+			"Log service encountered an attempt to erroneously allocate or dispose reservation space.STATUS_LOG_CANT_DELETELog service cannot delete log file or file system container."
+			"STATUS_LOG_CONTAINER_LIMIT_EXCEEDEDLog service has reached the maximum allowable containers allocated to a log file.STATUS_LOG_START_OF_LOG"
+			"Log service has attempted to read or write backwards past the start of the log.STATUS_LOG_POLICY_ALREADY_INSTALLEDLog policy could not be installed because a policy of the same type is already present."
+			"STATUS_LOG_POLICY_NOT_INSTALLEDLog policy in question was not installed at the time of the request.STATUS_LOG_POLICY_INVALID"
+			"The installed set of policies on the log is invalid.STATUS_LOG_POLICY_CONFLICTA policy on the log in question prevented the operation from completing."
+			"STATUS_LOG_PINNED_ARCHIVE_TAILLog space cannot be reclaimed because the log is pinned by the archive tail.STATUS_LOG_RECORD_NONEXISTENT"
+			"Log record is not a record in the log file.STATUS_LOG_RECORDS_RESERVED_INVALIDNumber of reserved log records or the adjustment of the number of reserved log records is invalid."
+			"STATUS_LOG_SPACE_RESERVED_INVALIDReserved log space or the adjustment of the log space is invalid.STATUS_LOG_TAIL_INVALID"
+			"A new or existing archive tail or base of the active log is invalid.STATUS_LOG_FULLLog space is exhausted.STATUS_LOG_MULTIPLEXED"
+			"Log is multiplexed, no direct writes to the physical log is allowed.STATUS_LOG_DEDICATEDThe operation failed because the log is a dedicated log."
+			"STATUS_LOG_ARCHIVE_NOT_IN_PROGRESSThe operation requires an archive context.STATUS_LOG_ARCHIVE_IN_PROGRESSLog archival is in progress."
+			"STATUS_LOG_EPHEMERALThe operation requires a non-ephemeral log, but the log is ephemeral.STATUS_LOG_NOT_ENOUGH_CONTAINERS"
+			"The log must have at least two containers before it can be read from or written to.STATUS_LOG_CLIENT_ALREADY_REGISTEREDA log client has already registered on the stream."
+			"STATUS_LOG_CLIENT_NOT_REGISTEREDA log client has not been registered on the stream.STATUS_LOG_FULL_HANDLER_IN_PROGRESSA request has already been made to handle the log full condition."
+			"STATUS_LOG_CONTAINER_READ_FAILEDLog service encountered an error when attempting to read from a log container.STATUS_LOG_CONTAINER_WRITE_FAILED"
+			"Log service encountered an error when attempting to write to a log container.STATUS_LOG_CONTAINER_OPEN_FAILEDLog service encountered an error when attempting open a log container."
+			"STATUS_LOG_CONTAINER_STATE_INVALIDLog service encountered an invalid container state when attempting a requested action."
+			"STATUS_LOG_STATE_INVALIDLog service is not in the correct state to perform a requested action.STATUS_LOG_PINNEDLog space cannot be reclaimed because the log is pinned."
+			"STATUS_LOG_METADATA_FLUSH_FAILEDLog metadata flush failed.STATUS_LOG_INCONSISTENT_SECURITYSecurity on the log and its containers is inconsistent."
+			"STATUS_LOG_APPENDED_FLUSH_FAILEDRecords were appended to the log or reservation changes were made, but the log could not be flushed."
+			"STATUS_LOG_PINNED_RESERVATIONThe log is pinned due to reservation consuming most of the log space. Free some reserved records to make space available."
+			"STATUS_VIDEO_HUNG_DISPLAY_DRIVER_THREAD{Display Driver Stopped Responding} The %hs display driver has stopped working normally. Save your work and reboot the system to restore full display functionality. The next time you reboot the machine a dialog will be displayed giving you a chance to upload data about this failure to Microsoft."
+			"STATUS_FLT_NO_HANDLER_DEFINEDA handler was not defined by the filter for this operation.STATUS_FLT_CONTEXT_ALREADY_DEFINED"
+			"A context is already defined for this object.STATUS_FLT_INVALID_ASYNCHRONOUS_REQUESTAsynchronous requests are not valid for this operation."
+			"STATUS_FLT_DISALLOW_FAST_IOInternal error code used by the filter manager to determine if a fastio operation should be forced down the IRP path. Mini-filters should never return this value."
+			"STATUS_FLT_INVALID_NAME_REQUESTAn invalid name request was made. The name requested cannot be retrieved at this time.STATUS_FLT_NOT_SAFE_TO_POST_OPERATION"
+			"Posting this operation to a worker thread for further processing is not safe at this time because it could lead to a system deadlock."
+			"STATUS_FLT_NOT_INITIALIZEDThe Filter Manager was not initialized when a filter tried to register. Make sure that the Filter Manager is getting loaded as a driver."
+			"STATUS_FLT_FILTER_NOT_READYThe filter is not ready for attachment to volumes because it has not finished initializing (FltStartFiltering has not been called)."
+			"STATUS_FLT_POST_OPERATION_CLEANUPThe filter must cleanup any operation specific context at this time because it is being removed from the system before the operation is completed by the lower drivers."
+			"STATUS_FLT_INTERNAL_ERRORThe Filter Manager had an internal error from which it cannot recover, therefore the operation has been failed. This is usually the result of a filter returning an invalid value from a pre-operation callback."
+			"STATUS_FLT_DELETING_OBJECTThe object specified for this action is in the process of being deleted, therefore the action requested cannot be completed at this time."
+			"STATUS_FLT_MUST_BE_NONPAGED_POOLNon-paged pool must be used for this type of context.STATUS_FLT_DUPLICATE_ENTRYA duplicate handler definition has been provided for an operation."
+			"STATUS_FLT_CBDQ_DISABLEDThe callback data queue has been disabled.STATUS_FLT_DO_NOT_ATTACHDo not attach the filter to the volume at this time."
+			"STATUS_FLT_DO_NOT_DETACHDo not detach the filter from the volume at this time.STATUS_FLT_INSTANCE_ALTITUDE_COLLISIONAn instance already exists at this altitude on the volume specified."
+			"STATUS_FLT_INSTANCE_NAME_COLLISIONAn instance already exists with this name on the volume specified.STATUS_FLT_FILTER_NOT_FOUND"
+			"The system could not find the filter specified.STATUS_FLT_VOLUME_NOT_FOUNDThe system could not find the volume specified."
+			"STATUS_FLT_INSTANCE_NOT_FOUNDThe system could not find the instance specified.STATUS_FLT_CONTEXT_ALLOCATION_NOT_FOUNDNo registered context allocation definition was found for the given request."
+			"STATUS_FLT_INVALID_CONTEXT_REGISTRATIONAn invalid parameter was specified during context registration.STATUS_FLT_NAME_CACHE_MISS"
+			"The name requested was not found in Filter Manager's name cache and could not be retrieved from the file system.STATUS_FLT_NO_DEVICE_OBJECT"
+			"The requested device object does not exist for the given volume.STATUS_FLT_VOLUME_ALREADY_MOUNTEDThe specified volume is already mounted."
+			"STATUS_FLT_ALREADY_ENLISTEDThe specified Transaction Context is already enlisted in a transactionSTATUS_FLT_CONTEXT_ALREADY_LINKED"
+			"The specifiec context is already attached to another objectSTATUS_FLT_NO_WAITER_FOR_REPLYNo waiter is present for the filter's reply to this message."
+			"STATUS_MONITOR_NO_DESCRIPTORMonitor descriptor could not be obtained.STATUS_MONITOR_UNKNOWN_DESCRIPTOR_FORMATFormat of the obtained monitor descriptor is not supported by this release."
+			"STATUS_MONITOR_INVALID_DESCRIPTOR_CHECKSUMChecksum of the obtained monitor descriptor is invalid.STATUS_MONITOR_INVALID_STANDARD_TIMING_BLOCK"
+			"Monitor descriptor contains an invalid standard timing block.STATUS_MONITOR_WMI_DATABLOCK_REGISTRATION_FAILEDWMI data block registration failed for one of the MSMonitorClass WMI subclasses."
+			"STATUS_MONITOR_INVALID_SERIAL_NUMBER_MONDSC_BLOCKProvided monitor descriptor block is either corrupted or does not contain monitor's detailed serial number."
+			"STATUS_MONITOR_INVALID_USER_FRIENDLY_MONDSC_BLOCKProvided monitor descriptor block is either corrupted or does not contain monitor's user friendly name."
+			"STATUS_MONITOR_NO_MORE_DESCRIPTOR_DATAThere is no monitor descriptor data at the specified (offset, size) region.STATUS_MONITOR_INVALID_DETAILED_TIMING_BLOCK"
+			"Monitor descriptor contains an invalid detailed timing block.STATUS_MONITOR_INVALID_MANUFACTURE_DATEMonitor descriptor contains invalid manufacture date."
+			"STATUS_GRAPHICS_NOT_EXCLUSIVE_MODE_OWNERExclusive mode ownership is needed to create unmanaged primary allocation.STATUS_GRAPHICS_INSUFFICIENT_DMA_BUFFER"
+			"The driver needs more DMA buffer space in order to complete the requested operation.STATUS_GRAPHICS_INVALID_DISPLAY_ADAPTER"
+			"Specified display adapter handle is invalid.STATUS_GRAPHICS_ADAPTER_WAS_RESETSpecified display adapter and all of its state has been reset."
+			"STATUS_GRAPHICS_INVALID_DRIVER_MODELThe driver stack doesn't match the expected driver model.STATUS_GRAPHICS_PRESENT_MODE_CHANGED"
+			"Present happened but ended up into the changed desktop modeSTATUS_GRAPHICS_PRESENT_OCCLUDEDNothing to present due to desktop occlusion"
+			"STATUS_GRAPHICS_PRESENT_DENIEDNot able to present due to denial of desktop accessSTATUS_GRAPHICS_CANNOTCOLORCONVERTNot able to present with color convertion"
+			"STATUS_GRAPHICS_DRIVER_MISMATCHThe kernel driver detected a version mismatch between it and the user mode driver.STATUS_GRAPHICS_PRESENT_REDIRECTION_DISABLED"
+			"Present redirection is disabled (desktop windowing management subsystem is off).STATUS_GRAPHICS_PRESENT_UNOCCLUDEDPrevious exclusive VidPn source owner has released its ownership"
+			"STATUS_GRAPHICS_NO_VIDEO_MEMORYNot enough video memory available to complete the operation.STATUS_GRAPHICS_CANT_LOCK_MEMORY"
+			"Couldn't probe and lock the underlying memory of an allocation.STATUS_GRAPHICS_ALLOCATION_BUSYThe allocation is currently busy."
+			"STATUS_GRAPHICS_TOO_MANY_REFERENCESAn object being referenced has already reached the maximum reference count and can't be referenced any further."
+			"STATUS_GRAPHICS_TRY_AGAIN_LATERA problem couldn't be solved due to some currently existing condition. The problem should be tried again later."
+			"STATUS_GRAPHICS_TRY_AGAIN_NOWA problem couldn't be solved due to some currently existing condition. The problem should be tried again immediately."
+			"STATUS_GRAPHICS_ALLOCATION_INVALIDThe allocation is invalid.STATUS_GRAPHICS_UNSWIZZLING_APERTURE_UNAVAILABLENo more unswizzling aperture are currently available."
+			"STATUS_GRAPHICS_UNSWIZZLING_APERTURE_UNSUPPORTEDThe current allocation can't be unswizzled by an aperture.STATUS_GRAPHICS_CANT_EVICT_PINNED_ALLOCATION"
+			"The request failed because a pinned allocation can't be evicted.STATUS_GRAPHICS_INVALID_ALLOCATION_USAGEThe allocation can't be used from it's current segment location for the specified operation."
+			"STATUS_GRAPHICS_CANT_RENDER_LOCKED_ALLOCATIONA locked allocation can't be used in the current command buffer.STATUS_GRAPHICS_ALLOCATION_CLOSED"
+			"The allocation being referenced has been closed permanently.STATUS_GRAPHICS_INVALID_ALLOCATION_INSTANCEAn invalid allocation instance is being referenced."
+			"STATUS_GRAPHICS_INVALID_ALLOCATION_HANDLEAn invalid allocation handle is being referenced.STATUS_GRAPHICS_WRONG_ALLOCATION_DEVICE"
+			"The allocation being referenced doesn't belong to the current device.STATUS_GRAPHICS_ALLOCATION_CONTENT_LOSTThe specified allocation lost its content."
+			"STATUS_GRAPHICS_GPU_EXCEPTION_ON_DEVICEGPU exception is detected on the given device. The device is not able to be scheduled."
+			"STATUS_GRAPHICS_INVALID_VIDPN_TOPOLOGYSpecified VidPN topology is invalid.STATUS_GRAPHICS_VIDPN_TOPOLOGY_NOT_SUPPORTEDSpecified VidPN topology is valid but is not supported by this model of the display adapter."
+			"STATUS_GRAPHICS_VIDPN_TOPOLOGY_CURRENTLY_NOT_SUPPORTEDSpecified VidPN topology is valid but is not supported by the display adapter at this time, due to current allocation of its resources."
+			"STATUS_GRAPHICS_INVALID_VIDPNSpecified VidPN handle is invalid.STATUS_GRAPHICS_INVALID_VIDEO_PRESENT_SOURCESpecified video present source is invalid."
+			"STATUS_GRAPHICS_INVALID_VIDEO_PRESENT_TARGETSpecified video present target is invalid.STATUS_GRAPHICS_VIDPN_MODALITY_NOT_SUPPORTED"
+			"Specified VidPN modality is not supported (e.g. at least two of the pinned modes are not cofunctional).STATUS_GRAPHICS_INVALID_VIDPN_SOURCEMODESET"
+			"Specified VidPN source mode set is invalid.STATUS_GRAPHICS_INVALID_VIDPN_TARGETMODESETSpecified VidPN target mode set is invalid."
+			"STATUS_GRAPHICS_INVALID_FREQUENCYSpecified video signal frequency is invalid.STATUS_GRAPHICS_INVALID_ACTIVE_REGIONSpecified video signal active region is invalid."
+			"STATUS_GRAPHICS_INVALID_TOTAL_REGIONSpecified video signal total region is invalid.STATUS_GRAPHICS_INVALID_VIDEO_PRESENT_SOURCE_MODE"
+			"Specified video present source mode is invalid.STATUS_GRAPHICS_INVALID_VIDEO_PRESENT_TARGET_MODESpecified video present target mode is invalid."
+			"STATUS_GRAPHICS_PINNED_MODE_MUST_REMAIN_IN_SETPinned mode must remain in the set on VidPN's cofunctional modality enumeration."
+			"STATUS_GRAPHICS_PATH_ALREADY_IN_TOPOLOGYSpecified video present path is already in VidPN's topology.STATUS_GRAPHICS_MODE_ALREADY_IN_MODESET"
+			"Specified mode is already in the mode set.STATUS_GRAPHICS_INVALID_VIDEOPRESENTSOURCESETSpecified video present source set is invalid."
+			"STATUS_GRAPHICS_INVALID_VIDEOPRESENTTARGETSETSpecified video present target set is invalid.STATUS_GRAPHICS_SOURCE_ALREADY_IN_SET"
+			"Specified video present source is already in the video present source set.STATUS_GRAPHICS_TARGET_ALREADY_IN_SETSpecified video present target is already in the video present target set."
+			"STATUS_GRAPHICS_INVALID_VIDPN_PRESENT_PATHSpecified VidPN present path is invalid.STATUS_GRAPHICS_NO_RECOMMENDED_VIDPN_TOPOLOGY"
+			"Miniport has no recommendation for augmentation of the specified VidPN's topology.STATUS_GRAPHICS_INVALID_MONITOR_FREQUENCYRANGESET"
+			"Specified monitor frequency range set is invalid.STATUS_GRAPHICS_INVALID_MONITOR_FREQUENCYRANGESpecified monitor frequency range is invalid."
+			"STATUS_GRAPHICS_FREQUENCYRANGE_NOT_IN_SETSpecified frequency range is not in the specified monitor frequency range set.STATUS_GRAPHICS_FREQUENCYRANGE_ALREADY_IN_SET"
+			"Specified frequency range is already in the specified monitor frequency range set.STATUS_GRAPHICS_STALE_MODESETSpecified mode set is stale. Please reacquire the new mode set."
+			"STATUS_GRAPHICS_INVALID_MONITOR_SOURCEMODESETSpecified monitor source mode set is invalid.STATUS_GRAPHICS_INVALID_MONITOR_SOURCE_MODE"
+			"Specified monitor source mode is invalid.STATUS_GRAPHICS_NO_RECOMMENDED_FUNCTIONAL_VIDPNMiniport does not have any recommendation regarding the request to provide a functional VidPN given the current display adapter configuration."
+			"STATUS_GRAPHICS_MODE_ID_MUST_BE_UNIQUEID of the specified mode is already used by another mode in the set.STATUS_GRAPHICS_EMPTY_ADAPTER_MONITOR_MODE_SUPPORT_INTERSECTION"
+			"System failed to determine a mode that is supported by both the display adapter and the monitor connected to it.STATUS_GRAPHICS_VIDEO_PRESENT_TARGETS_LESS_THAN_SOURCES"
+			"Number of video present targets must be greater than or equal to the number of video present sources.STATUS_GRAPHICS_PATH_NOT_IN_TOPOLOGY"
+			"Specified present path is not in VidPN's topology.STATUS_GRAPHICS_ADAPTER_MUST_HAVE_AT_LEAST_ONE_SOURCEDisplay adapter must have at least one video present source."
+			"STATUS_GRAPHICS_ADAPTER_MUST_HAVE_AT_LEAST_ONE_TARGETDisplay adapter must have at least one video present target.STATUS_GRAPHICS_INVALID_MONITORDESCRIPTORSET"
+			"Specified monitor descriptor set is invalid.STATUS_GRAPHICS_INVALID_MONITORDESCRIPTORSpecified monitor descriptor is invalid."
+			"STATUS_GRAPHICS_MONITORDESCRIPTOR_NOT_IN_SETSpecified descriptor is not in the specified monitor descriptor set.STATUS_GRAPHICS_MONITORDESCRIPTOR_ALREADY_IN_SET"
+			"Specified descriptor is already in the specified monitor descriptor set.STATUS_GRAPHICS_MONITORDESCRIPTOR_ID_MUST_BE_UNIQUE"
+			"ID of the specified monitor descriptor is already used by another descriptor in the set.STATUS_GRAPHICS_INVALID_VIDPN_TARGET_SUBSET_TYPE"
+			"Specified video present target subset type is invalid.STATUS_GRAPHICS_RESOURCES_NOT_RELATEDTwo or more of the specified resources are not related to each other, as defined by the interface semantics."
+			"STATUS_GRAPHICS_SOURCE_ID_MUST_BE_UNIQUEID of the specified video present source is already used by another source in the set."
+			"STATUS_GRAPHICS_TARGET_ID_MUST_BE_UNIQUEID of the specified video present target is already used by another target in the set."
+			"STATUS_GRAPHICS_NO_AVAILABLE_VIDPN_TARGETSpecified VidPN source cannot be used because there is no available VidPN target to connect it to."
+			"STATUS_GRAPHICS_MONITOR_COULD_NOT_BE_ASSOCIATED_WITH_ADAPTERNewly arrived monitor could not be associated with a display adapter."
+			"STATUS_GRAPHICS_NO_VIDPNMGRDisplay adapter in question does not have an associated VidPN manager.STATUS_GRAPHICS_NO_ACTIVE_VIDPN"
+			"VidPN manager of the display adapter in question does not have an active VidPN.STATUS_GRAPHICS_STALE_VIDPN_TOPOLOGYSpecified VidPN topology is stale. Please reacquire the new topology."
+			"STATUS_GRAPHICS_MONITOR_NOT_CONNECTEDThere is no monitor connected on the specified video present target.STATUS_GRAPHICS_SOURCE_NOT_IN_TOPOLOGY"
+			"Specified source is not part of the specified VidPN's topology.STATUS_GRAPHICS_INVALID_PRIMARYSURFACE_SIZESpecified primary surface size is invalid."
+			"STATUS_GRAPHICS_INVALID_VISIBLEREGION_SIZESpecified visible region size is invalid.STATUS_GRAPHICS_INVALID_STRIDESpecified stride is invalid."
+			"STATUS_GRAPHICS_INVALID_PIXELFORMATSpecified pixel format is invalid.STATUS_GRAPHICS_INVALID_COLORBASISSpecified color basis is invalid."
+			"STATUS_GRAPHICS_INVALID_PIXELVALUEACCESSMODESpecified pixel value access mode is invalid.STATUS_GRAPHICS_TARGET_NOT_IN_TOPOLOGY"
+			"Specified target is not part of the specified VidPN's topology.STATUS_GRAPHICS_NO_DISPLAY_MODE_MANAGEMENT_SUPPORTFailed to acquire display mode management interface."
+			"STATUS_GRAPHICS_VIDPN_SOURCE_IN_USESpecified VidPN source is already owned by a DMM client and cannot be used until that client releases it."
+			"STATUS_GRAPHICS_CANT_ACCESS_ACTIVE_VIDPNSpecified VidPN is active and cannot be accessed.STATUS_GRAPHICS_INVALID_PATH_IMPORTANCE_ORDINAL"
+			"Specified VidPN present path importance ordinal is invalid.STATUS_GRAPHICS_INVALID_PATH_CONTENT_GEOMETRY_TRANSFORMATIONSpecified VidPN present path content geometry transformation is invalid."
+			"STATUS_GRAPHICS_PATH_CONTENT_GEOMETRY_TRANSFORMATION_NOT_SUPPORTEDSpecified content geometry transformation is not supported on the respective VidPN present path."
+			"STATUS_GRAPHICS_INVALID_GAMMA_RAMPSpecified gamma ramp is invalid.STATUS_GRAPHICS_GAMMA_RAMP_NOT_SUPPORTEDSpecified gamma ramp is not supported on the respective VidPN present path."
+			"STATUS_GRAPHICS_MULTISAMPLING_NOT_SUPPORTEDMulti-sampling is not supported on the respective VidPN present path.STATUS_GRAPHICS_MODE_NOT_IN_MODESET"
+			"Specified mode is not in the specified mode set.STATUS_GRAPHICS_INVALID_VIDPN_TOPOLOGY_RECOMMENDATION_REASONSpecified VidPN topology recommendation reason is invalid."
+			"STATUS_GRAPHICS_INVALID_PATH_CONTENT_TYPESpecified VidPN present path content type is invalid.STATUS_GRAPHICS_INVALID_COPYPROTECTION_TYPE"
+			"Specified VidPN present path copy protection type is invalid.STATUS_GRAPHICS_UNASSIGNED_MODESET_ALREADY_EXISTSNo more than one unassigned mode set can exist at any given time for a given VidPN source/target."
+			"STATUS_GRAPHICS_INVALID_SCANLINE_ORDERINGSpecified scanline ordering type is invalid.STATUS_GRAPHICS_TOPOLOGY_CHANGES_NOT_ALLOWED"
+			"Topology changes are not allowed for the specified VidPN.STATUS_GRAPHICS_NO_AVAILABLE_IMPORTANCE_ORDINALSAll available importance ordinals are already used in specified topology."
+			"STATUS_GRAPHICS_INCOMPATIBLE_PRIVATE_FORMATSpecified primary surface has a different private format attribute than the current primary surface"
+			"STATUS_GRAPHICS_INVALID_MODE_PRUNING_ALGORITHMSpecified mode pruning algorithm is invalidSTATUS_GRAPHICS_INVALID_MONITOR_CAPABILITY_ORIGIN"
+			"Specified monitor capability origin is invalid.STATUS_GRAPHICS_INVALID_MONITOR_FREQUENCYRANGE_CONSTRAINTSpecified monitor frequency range constraint is invalid."
+			"STATUS_GRAPHICS_MAX_NUM_PATHS_REACHEDMaximum supported number of present paths has been reached.STATUS_GRAPHICS_CANCEL_VIDPN_TOPOLOGY_AUGMENTATION"
+			"Miniport requested that augmentation be cancelled for the specified source of the specified VidPN's topology.STATUS_GRAPHICS_INVALID_CLIENT_TYPE"
+			"Specified client type was not recognized.STATUS_GRAPHICS_CLIENTVIDPN_NOT_SETClient VidPN is not set on this adapter (e.g. no user mode initiated mode changes took place on this adapter yet)."
+			"STATUS_GRAPHICS_SPECIFIED_CHILD_ALREADY_CONNECTEDSpecified display adapter child device already has an external device connected to it."
+			"STATUS_GRAPHICS_CHILD_DESCRIPTOR_NOT_SUPPORTEDSpecified display adapter child device does not support descriptor exposure."
+			"STATUS_GRAPHICS_NOT_A_LINKED_ADAPTERThe display adapter is not linked to any other adapters.STATUS_GRAPHICS_LEADLINK_NOT_ENUMERATED"
+			"Lead adapter in a linked configuration was not enumerated yet.STATUS_GRAPHICS_CHAINLINKS_NOT_ENUMERATEDSome chain adapters in a linked configuration were not enumerated yet."
+			"STATUS_GRAPHICS_ADAPTER_CHAIN_NOT_READYThe chain of linked adapters is not ready to start because of an unknown failure."
+			"STATUS_GRAPHICS_CHAINLINKS_NOT_STARTEDAn attempt was made to start a lead link display adapter when the chain links were not started yet."
+			"STATUS_GRAPHICS_CHAINLINKS_NOT_POWERED_ONAn attempt was made to power up a lead link display adapter when the chain links were powered down."
+			"STATUS_GRAPHICS_INCONSISTENT_DEVICE_LINK_STATEThe adapter link was found to be in an inconsistent state. Not all adapters are in an expected PNP/Power state."
+			"STATUS_GRAPHICS_NOT_POST_DEVICE_DRIVERThe driver trying to start is not the same as the driver for the POSTed display adapter."
+			"STATUS_GRAPHICS_ADAPTER_ACCESS_NOT_EXCLUDEDAn operation is being attempted that requires the display adapter to be in a quiescent state."
+			"STATUS_GRAPHICS_OPM_NOT_SUPPORTEDThe driver does not support OPM.STATUS_GRAPHICS_COPP_NOT_SUPPORTEDThe driver does not support COPP."
+			"STATUS_GRAPHICS_UAB_NOT_SUPPORTEDThe driver does not support UAB.STATUS_GRAPHICS_OPM_INVALID_ENCRYPTED_PARAMETERSThe specified encrypted parameters are invalid."
+			"STATUS_GRAPHICS_OPM_NO_PROTECTED_OUTPUTS_EXISTThe GDI display device passed to this function does not have any active protected outputs."
+			"STATUS_GRAPHICS_OPM_INTERNAL_ERRORAn internal error caused an operation to fail.STATUS_GRAPHICS_OPM_INVALID_HANDLEThe function failed because the caller passed in an invalid OPM user mode handle."
+			"STATUS_GRAPHICS_PVP_INVALID_CERTIFICATE_LENGTHA certificate could not be returned because the certificate buffer passed to the function was too small."
+			"STATUS_GRAPHICS_OPM_SPANNING_MODE_ENABLEDThe DxgkDdiOpmCreateProtectedOutput function could not create a protected output because the Video Present Target is in spanning mode."
+			"STATUS_GRAPHICS_OPM_THEATER_MODE_ENABLEDThe DxgkDdiOpmCreateProtectedOutput function could not create a protected output because the Video Present Target is in theater mode."
+			"STATUS_GRAPHICS_PVP_HFS_FAILEDThe function failed because the display adapter's Hardware Functionality Scan failed to validate the graphics hardware."
+			"STATUS_GRAPHICS_OPM_INVALID_SRMThe HDCP System Renewability Message passed to this function did not comply with section 5 of the HDCP 1.1 specification."
+			"STATUS_GRAPHICS_OPM_OUTPUT_DOES_NOT_SUPPORT_HDCPThe protected output cannot enable the High-bandwidth Digital Content Protection (HDCP) System because it does not support HDCP."
+			"STATUS_GRAPHICS_OPM_OUTPUT_DOES_NOT_SUPPORT_ACPThe protected output cannot enable Analogue Copy Protection (ACP) because it does not support ACP."
+			"STATUS_GRAPHICS_OPM_OUTPUT_DOES_NOT_SUPPORT_CGMSAThe protected output cannot enable the Content Generation Management System Analogue (CGMS-A) protection technology because it does not support CGMS-A."
+			"STATUS_GRAPHICS_OPM_HDCP_SRM_NEVER_SETThe DxgkDdiOPMGetInformation function cannot return the version of the SRM being used because the application never successfully passed an SRM to the protected output."
+			"STATUS_GRAPHICS_OPM_RESOLUTION_TOO_HIGHThe DxgkDdiOPMConfigureProtectedOutput function cannot enable the specified output protection technology because the output's screen resolution is too high."
+			"STATUS_GRAPHICS_OPM_ALL_HDCP_HARDWARE_ALREADY_IN_USEThe DxgkDdiOPMConfigureProtectedOutput function cannot enable HDCP because the display adapter's HDCP hardware is already being used by other physical outputs."
+			"STATUS_GRAPHICS_OPM_PROTECTED_OUTPUT_NO_LONGER_EXISTSThe operating system asynchronously destroyed this OPM protected output because the operating system's state changed. This error typically occurs because the monitor PDO associated with this protected output was removed, the monitor PDO associated with this protected output was stopped, or the protected output's session became a non-console session."
+			"STATUS_GRAPHICS_OPM_PROTECTED_OUTPUT_DOES_NOT_HAVE_COPP_SEMANTICSEither the DxgkDdiOPMGetCOPPCompatibleInformation, DxgkDdiOPMGetInformation, or DxgkDdiOPMConfigureProtectedOutput function failed. This error is returned when the caller tries to use a COPP specific command while the protected output has OPM semantics only."
+			"STATUS_GRAPHICS_OPM_INVALID_INFORMATION_REQUESTThe DxgkDdiOPMGetInformation and DxgkDdiOPMGetCOPPCompatibleInformation functions return this error code if the passed in sequence number is not the expected sequence number or the passed in OMAC value is invalid."
+			"STATUS_GRAPHICS_OPM_DRIVER_INTERNAL_ERRORThe function failed because an unexpected error occurred inside of a display driver."
+			"STATUS_GRAPHICS_OPM_PROTECTED_OUTPUT_DOES_NOT_HAVE_OPM_SEMANTICSEither the DxgkDdiOPMGetCOPPCompatibleInformation, DxgkDdiOPMGetInformation, or DxgkDdiOPMConfigureProtectedOutput function failed. This error is returned when the caller tries to use an OPM specific command while the protected output has COPP semantics only."
+			"STATUS_GRAPHICS_OPM_SIGNALING_NOT_SUPPORTEDThe DxgkDdiOPMGetCOPPCompatibleInformation and DxgkDdiOPMConfigureProtectedOutput functions return this error if the display driver does not support the DXGKMDT_OPM_GET_ACP_AND_CGMSA_SIGNALING and DXGKMDT_OPM_SET_ACP_AND_CGMSA_SIGNALING GUIDs."
+			"STATUS_GRAPHICS_OPM_INVALID_CONFIGURATION_REQUESTThe DxgkDdiOPMConfigureProtectedOutput function returns this error code if the passed in sequence number is not the expected sequence number or the passed in OMAC value is invalid."
+			"STATUS_GRAPHICS_I2C_NOT_SUPPORTEDThe monitor connected to the specified video output does not have an I2C bus.STATUS_GRAPHICS_I2C_DEVICE_DOES_NOT_EXIST"
+			"No device on the I2C bus has the specified address.STATUS_GRAPHICS_I2C_ERROR_TRANSMITTING_DATAAn error occurred while transmitting data to the device on the I2C bus."
+			"STATUS_GRAPHICS_I2C_ERROR_RECEIVING_DATAAn error occurred while receiving data from the device on the I2C bus.STATUS_GRAPHICS_DDCCI_VCP_NOT_SUPPORTED"
+			"The monitor does not support the specified VCP code.STATUS_GRAPHICS_DDCCI_INVALID_DATAThe data received from the monitor is invalid."
+			"STATUS_GRAPHICS_DDCCI_MONITOR_RETURNED_INVALID_TIMING_STATUS_BYTEThe function failed because a monitor returned an invalid Timing Status byte when the operating system used the DDC/CI Get Timing Report & Timing Message command to get a timing report from a monitor."
+			"STATUS_GRAPHICS_DDCCI_INVALID_CAPABILITIES_STRINGA monitor returned a DDC/CI capabilities string which did not comply with the ACCESS.bus 3.0, DDC/CI 1.1, or MCCS 2 Revision 1 specification."
+			"STATUS_GRAPHICS_MCA_INTERNAL_ERRORSTATUS_GRAPHICS_DDCCI_INVALID_MESSAGE_COMMANDAn operation failed because a DDC/CI message had an invalid value in its command field."
+			"STATUS_GRAPHICS_DDCCI_INVALID_MESSAGE_LENGTHAn error occurred because the field length of a DDC/CI message contained an invalid value."
+			"STATUS_GRAPHICS_DDCCI_INVALID_MESSAGE_CHECKSUMAn error occurred because the checksum field in a DDC/CI message did not match the message's computed checksum value. This error implies that the data was corrupted while it was being transmitted from a monitor to a computer."
+			"STATUS_GRAPHICS_INVALID_PHYSICAL_MONITOR_HANDLEThis function failed because an invalid monitor handle was passed to it.STATUS_GRAPHICS_MONITOR_NO_LONGER_EXISTS"
+			"The operating system asynchronously destroyed the monitor which corresponds to this handle because the operating system's state changed. This error typically occurs because the monitor PDO associated with this handle was removed, the monitor PDO associated with this handle was stopped, or a display mode change occurred. A display mode change occurs when windows sends a WM_DISPLAYCHANGE windows message to applications."
+			"STATUS_GRAPHICS_ONLY_CONSOLE_SESSION_SUPPORTEDThis function can only be used if a program is running in the local console session. It cannot be used if a program is running on a remote desktop session or on a terminal server session."
+			"STATUS_GRAPHICS_NO_DISPLAY_DEVICE_CORRESPONDS_TO_NAMEThis function cannot find an actual GDI display device which corresponds to the specified GDI display device name."
+			"STATUS_GRAPHICS_DISPLAY_DEVICE_NOT_ATTACHED_TO_DESKTOPThe function failed because the specified GDI display device was not attached to the Windows desktop."
+			"STATUS_GRAPHICS_MIRRORING_DEVICES_NOT_SUPPORTEDThis function does not support GDI mirroring display devices because GDI mirroring display devices do not have any physical monitors associated with them."
+			"STATUS_GRAPHICS_INVALID_POINTERThe function failed because an invalid pointer parameter was passed to it. A pointer parameter is invalid if it is NULL, it points to an invalid address, it points to a kernel mode address or it is not correctly aligned."
+			"STATUS_GRAPHICS_NO_MONITORS_CORRESPOND_TO_DISPLAY_DEVICEThis function failed because the GDI device passed to it did not have any monitors associated with it."
+			"STATUS_GRAPHICS_PARAMETER_ARRAY_TOO_SMALLAn array passed to the function cannot hold all of the data that the function must copy into the array."
+			"STATUS_GRAPHICS_INTERNAL_ERRORSTATUS_GRAPHICS_SESSION_TYPE_CHANGE_IN_PROGRESSThe function failed because the current session is changing its type. This function cannot be called when the current session is changing its type. There are currently three types of sessions: console, disconnected and remote."
+			"STATUS_FVE_LOCKED_VOLUMEThis volume is locked by BitLocker Drive Encryption.STATUS_FVE_NOT_ENCRYPTEDThe volume is not encrypted, no key is available."
+			"STATUS_FVE_BAD_INFORMATIONThe control block for the encrypted volume is not valid.STATUS_FVE_TOO_SMALLThe volume cannot be encrypted because it does not have enough free space."
+			"STATUS_FVE_FAILED_WRONG_FSThe volume cannot be encrypted because the file system is not supported.STATUS_FVE_BAD_PARTITION_SIZE"
+			"The file system size is larger than the partition size in the partition table.STATUS_FVE_FS_NOT_EXTENDEDThe file system does not extend to the end of the volume."
+			"STATUS_FVE_FS_MOUNTEDThis operation cannot be performed while a file system is mounted on the volume.STATUS_FVE_NO_LICENSE"
+			"BitLocker Drive Encryption is not included with this version of Windows.STATUS_FVE_ACTION_NOT_ALLOWEDRequested action not allowed in the current volume state."
+			"STATUS_FVE_BAD_DATAData supplied is malformed.STATUS_FVE_VOLUME_NOT_BOUNDThe volume is not bound to the system.STATUS_FVE_NOT_DATA_VOLUME"
+			"That volume is not a data volume.STATUS_FVE_CONV_READ_ERRORA read operation failed while converting the volume.STATUS_FVE_CONV_WRITE_ERROR"
+			"A write operation failed while converting the volume.STATUS_FVE_OVERLAPPED_UPDATEThe control block for the encrypted volume was updated by another thread. Try again."
+			"STATUS_FVE_FAILED_SECTOR_SIZEThe encryption algorithm does not support the sector size of that volume.STATUS_FVE_FAILED_AUTHENTICATION"
+			"BitLocker recovery authentication failed.STATUS_FVE_NOT_OS_VOLUMEThat volume is not the OS volume.STATUS_FVE_KEYFILE_NOT_FOUND"
+			"The BitLocker startup key or recovery password could not be read from external media.STATUS_FVE_KEYFILE_INVALIDThe BitLocker startup key or recovery password file is corrupt or invalid."
+			"STATUS_FVE_KEYFILE_NO_VMKThe BitLocker encryption key could not be obtained from the startup key or recovery password.STATUS_FVE_TPM_DISABLED"
+			"The Trusted Platform Module (TPM) is disabled.STATUS_FVE_TPM_SRK_AUTH_NOT_ZEROThe authorization data for the Storage Root Key (SRK) of the Trusted Platform Module (TPM) is not zero."
+			"STATUS_FVE_TPM_INVALID_PCRThe system boot information changed or the Trusted Platform Module (TPM) locked out access to BitLocker encryption keys until the computer is restarted."
+			"STATUS_FVE_TPM_NO_VMKThe BitLocker encryption key could not be obtained from the Trusted Platform Module (TPM).STATUS_FVE_PIN_INVALID"
+			"The BitLocker encryption key could not be obtained from the Trusted Platform Module (TPM) and PIN.STATUS_FVE_AUTH_INVALID_APPLICATION"
+			"A boot application hash does not match the hash computed when BitLocker was turned on.STATUS_FVE_AUTH_INVALID_CONFIGThe Boot Configuration Data (BCD) settings are not supported or have changed since BitLocker was enabled."
+			"STATUS_FVE_DEBUGGER_ENABLEDBoot debugging is enabled. Run bcdedit to turn it off.STATUS_FVE_DRY_RUN_FAILEDThe BitLocker encryption key could not be obtained."
+			"STATUS_FVE_BAD_METADATA_POINTERThe metadata disk region pointer is incorrect.STATUS_FVE_OLD_METADATA_COPYThe backup copy of the metadata is out of date."
+			"STATUS_FVE_REBOOT_REQUIREDNo action was taken as a system reboot is required.STATUS_FVE_RAW_ACCESSNo action was taken as BitLocker Drive Encryption is in RAW access mode."
+			"STATUS_FVE_RAW_BLOCKEDBitLocker Drive Encryption cannot enter raw access mode for this volume.STATUS_FVE_NO_AUTOUNLOCK_MASTER_KEY"
+			"The auto-unlock master key was not available from the operating system volume. Retry the operation using the BitLocker WMI interface."
+			"STATUS_FVE_MOR_FAILEDThe system firmware failed to enable clearing of system memory on reboot.STATUS_FVE_NO_FEATURE_LICENSE"
+			"This feature of BitLocker Drive Encryption is not included with this version of Windows.STATUS_FVE_POLICY_USER_DISABLE_RDV_NOT_ALLOWED"
+			"Group policy does not permit turning off BitLocker Drive Encryption on roaming data volumes.STATUS_FVE_CONV_RECOVERY_FAILED"
+			"Bitlocker Drive Encryption failed to recover from aborted conversion. This could be due to either all conversion logs being corrupted or the media being write-protected."
+			"STATUS_FVE_VIRTUALIZED_SPACE_TOO_BIGThe requested virtualization size is too big.STATUS_FVE_INVALID_DATUM_TYPEThe management information stored on the drive contained an unknown type. If you are using an old version of Windows, try accessing the drive from the latest version."
+			"STATUS_FVE_VOLUME_TOO_SMALLThe drive is too small to be protected using BitLocker Drive Encryption.STATUS_FVE_ENH_PIN_INVALID"
+			"The BitLocker encryption key could not be obtained from the Trusted Platform Module (TPM) and enhanced PIN. Try using a PIN containing only numerals."
+			"STATUS_FWP_CALLOUT_NOT_FOUNDThe callout does not exist.STATUS_FWP_CONDITION_NOT_FOUNDThe filter condition does not exist."
+			"STATUS_FWP_FILTER_NOT_FOUNDThe filter does not exist.STATUS_FWP_LAYER_NOT_FOUNDThe layer does not exist.STATUS_FWP_PROVIDER_NOT_FOUND"
+			"The provider does not exist.STATUS_FWP_PROVIDER_CONTEXT_NOT_FOUNDThe provider context does not exist.STATUS_FWP_SUBLAYER_NOT_FOUND"
+			"The sublayer does not exist.STATUS_FWP_NOT_FOUNDThe object does not exist.STATUS_FWP_ALREADY_EXISTSAn object with that GUID or LUID already exists."
+			"STATUS_FWP_IN_USEThe object is referenced by other objects so cannot be deleted.STATUS_FWP_DYNAMIC_SESSION_IN_PROGRESSThe call is not allowed from within a dynamic session."
+			"STATUS_FWP_WRONG_SESSIONThe call was made from the wrong session so cannot be completed.STATUS_FWP_NO_TXN_IN_PROGRESSThe call must be made from within an explicit transaction."
+			"STATUS_FWP_TXN_IN_PROGRESSThe call is not allowed from within an explicit transaction.STATUS_FWP_TXN_ABORTEDThe explicit transaction has been forcibly cancelled."
+			"STATUS_FWP_SESSION_ABORTEDThe session has been cancelled.STATUS_FWP_INCOMPATIBLE_TXNThe call is not allowed from within a read-only transaction."
+			"STATUS_FWP_TIMEOUTThe call timed out while waiting to acquire the transaction lock.STATUS_FWP_NET_EVENTS_DISABLEDCollection of network diagnostic events is disabled."
+			"STATUS_FWP_INCOMPATIBLE_LAYERThe operation is not supported by the specified layer.STATUS_FWP_KM_CLIENTS_ONLYThe call is allowed for kernel-mode callers only."
+			"STATUS_FWP_LIFETIME_MISMATCHThe call tried to associate two objects with incompatible lifetimes.STATUS_FWP_BUILTIN_OBJECT"
+			"The object is built in so cannot be deleted.STATUS_FWP_TOO_MANY_CALLOUTSThe maximum number of callouts has been reached."
+			"STATUS_FWP_NOTIFICATION_DROPPEDA notification could not be delivered because a message queue is at its maximum capacity."
+			"STATUS_FWP_TRAFFIC_MISMATCHThe traffic parameters do not match those for the security association context.STATUS_FWP_INCOMPATIBLE_SA_STATE"
+			"The call is not allowed for the current security association state.STATUS_FWP_NULL_POINTERA required pointer is null.STATUS_FWP_INVALID_ENUMERATOR"
+			"An enumerator is not valid.STATUS_FWP_INVALID_FLAGSThe flags field contains an invalid value.STATUS_FWP_INVALID_NET_MASK"
+			"A network mask is not valid.STATUS_FWP_INVALID_RANGEAn FWP_RANGE is not valid.STATUS_FWP_INVALID_INTERVALThe time interval is not valid."
+			"STATUS_FWP_ZERO_LENGTH_ARRAYAn array that must contain at least one element is zero length.STATUS_FWP_NULL_DISPLAY_NAMEThe displayData.name field cannot be null."
+			"STATUS_FWP_INVALID_ACTION_TYPEThe action type is not one of the allowed action types for a filter.STATUS_FWP_INVALID_WEIGHT"
+			"The filter weight is not valid.STATUS_FWP_MATCH_TYPE_MISMATCHA filter condition contains a match type that is not compatible with the operands."
+			"STATUS_FWP_TYPE_MISMATCHAn FWP_VALUE or FWPM_CONDITION_VALUE is of the wrong type.STATUS_FWP_OUT_OF_BOUNDSAn integer value is outside the allowed range."
+			"STATUS_FWP_RESERVEDA reserved field is non-zero.STATUS_FWP_DUPLICATE_CONDITIONA filter cannot contain multiple conditions operating on a single field."
+			"STATUS_FWP_DUPLICATE_KEYMODA policy cannot contain the same keying module more than once.STATUS_FWP_ACTION_INCOMPATIBLE_WITH_LAYER"
+			"The action type is not compatible with the layer.STATUS_FWP_ACTION_INCOMPATIBLE_WITH_SUBLAYERThe action type is not compatible with the sublayer."
+			"STATUS_FWP_CONTEXT_INCOMPATIBLE_WITH_LAYERThe raw context or the provider context is not compatible with the layer.STATUS_FWP_CONTEXT_INCOMPATIBLE_WITH_CALLOUT"
+			"The raw context or the provider context is not compatible with the callout.STATUS_FWP_INCOMPATIBLE_AUTH_METHODThe authentication method is not compatible with the policy type."
+			"STATUS_FWP_INCOMPATIBLE_DH_GROUPThe Diffie-Hellman group is not compatible with the policy type.STATUS_FWP_EM_NOT_SUPPORTED"
+			"An IKE policy cannot contain an Extended Mode policy.STATUS_FWP_NEVER_MATCHThe enumeration template or subscription will never match any objects."
+			"STATUS_FWP_PROVIDER_CONTEXT_MISMATCHThe provider context is of the wrong type.STATUS_FWP_INVALID_PARAMETERThe parameter is incorrect."
+			"STATUS_FWP_TOO_MANY_SUBLAYERSThe maximum number of sublayers has been reached.STATUS_FWP_CALLOUT_NOTIFICATION_FAILEDThe notification function for a callout returned an error."
+			"STATUS_FWP_INVALID_AUTH_TRANSFORMThe IPsec authentication transform is not valid.STATUS_FWP_INVALID_CIPHER_TRANSFORMThe IPsec cipher transform is not valid."
+			"STATUS_FWP_INCOMPATIBLE_CIPHER_TRANSFORMThe IPsec cipher transform is not compatible with the policy.STATUS_FWP_INVALID_TRANSFORM_COMBINATION"
+			"The combination of IPsec transform types is not valid.STATUS_FWP_DUPLICATE_AUTH_METHODA policy cannot contain the same auth method more than once."
+			"STATUS_FWP_TCPIP_NOT_READYThe TCP/IP stack is not ready.STATUS_FWP_INJECT_HANDLE_CLOSINGThe injection handle is being closed by another thread."
+			"STATUS_FWP_INJECT_HANDLE_STALEThe injection handle is stale.STATUS_FWP_CANNOT_PENDThe classify cannot be pended.STATUS_FWP_DROP_NOICMP"
+			"The packet should be dropped, no ICMP should be sent.STATUS_NDIS_CLOSINGThe binding to the network interface is being closed."
+			"STATUS_NDIS_BAD_VERSIONAn invalid version was specified.STATUS_NDIS_BAD_CHARACTERISTICSAn invalid characteristics table was used."
+			"STATUS_NDIS_ADAPTER_NOT_FOUNDFailed to find the network interface or network interface is not ready.STATUS_NDIS_OPEN_FAILED"
+			"Failed to open the network interface.STATUS_NDIS_DEVICE_FAILEDNetwork interface has encountered an internal unrecoverable failure."
+			"STATUS_NDIS_MULTICAST_FULLThe multicast list on the network interface is full.STATUS_NDIS_MULTICAST_EXISTSAn attempt was made to add a duplicate multicast address to the list."
+			"STATUS_NDIS_MULTICAST_NOT_FOUNDAt attempt was made to remove a multicast address that was never added.STATUS_NDIS_REQUEST_ABORTED"
+			"Netowork interface aborted the request.STATUS_NDIS_RESET_IN_PROGRESSNetwork interface can not process the request because it is being reset."
+			"STATUS_NDIS_INVALID_PACKETAn attempt was made to send an invalid packet on a network interface.STATUS_NDIS_INVALID_DEVICE_REQUEST"
+			"STATUS_NDIS_ADAPTER_NOT_READYNetwork interface is not ready to complete this operation.STATUS_NDIS_INVALID_LENGTHThe length of the buffer submitted for this operation is not valid."
+			"STATUS_NDIS_INVALID_DATAThe data used for this operation is not valid.STATUS_NDIS_BUFFER_TOO_SHORTThe length of buffer submitted for this operation is too small."
+			"STATUS_NDIS_INVALID_OIDNetwork interface does not support this OID (Object Identifier)STATUS_NDIS_ADAPTER_REMOVEDThe network interface has been removed."
+			"STATUS_NDIS_UNSUPPORTED_MEDIANetwork interface does not support this media type.STATUS_NDIS_GROUP_ADDRESS_IN_USEAn attempt was made to remove a token ring group address that is in use by other components."
+			"STATUS_NDIS_FILE_NOT_FOUNDAn attempt was made to map a file that can not be found.STATUS_NDIS_ERROR_READING_FILEAn error occured while NDIS tried to map the file."
+			"STATUS_NDIS_ALREADY_MAPPEDAn attempt was made to map a file that is alreay mapped.STATUS_NDIS_RESOURCE_CONFLICTAn attempt to allocate a hardware resource failed because the resource is used by another component."
+			"STATUS_NDIS_MEDIA_DISCONNECTEDThe I/O operation failed because network media is disconnected or wireless access point is out of range."
+			"STATUS_NDIS_INVALID_ADDRESSThe network address used in the request is invalid.STATUS_NDIS_PAUSEDThe offload operation on the network interface has been paused."
+			"STATUS_NDIS_INTERFACE_NOT_FOUNDNetwork interface was not found.STATUS_NDIS_UNSUPPORTED_REVISIONThe revision number specified in the structure is not supported."
+			"STATUS_NDIS_INVALID_PORTThe specified port does not exist on this network interface.STATUS_NDIS_INVALID_PORT_STATEThe current state of the specified port on this network interface does not support the requested operation."
+			"STATUS_NDIS_LOW_POWER_STATEThe miniport adapter is in lower power state.STATUS_NDIS_NOT_SUPPORTEDNetword interface does not support this request."
+			"STATUS_NDIS_OFFLOAD_POLICYThe TCP connection is not offloadable because of a local policy setting.STATUS_NDIS_OFFLOAD_CONNECTION_REJECTED"
+			"The TCP connection is not offloadable by the Chimney offload target.STATUS_NDIS_OFFLOAD_PATH_REJECTEDThe IP Path object is not in an offloadable state."
+			"STATUS_NDIS_DOT11_AUTO_CONFIG_ENABLEDThe wireless local area network interface is in auto configuration mode and doesn't support the requested parameter change operation."
+			"STATUS_NDIS_DOT11_MEDIA_IN_USEThe wireless local area network interface is busy and can not perform the requested operation."
+			"STATUS_NDIS_DOT11_POWER_STATE_INVALIDThe wireless local area network interface is power down and doesn't support the requested operation."
+			"STATUS_NDIS_PM_WOL_PATTERN_LIST_FULLThe list of wake on LAN patterns is full.STATUS_NDIS_PM_PROTOCOL_OFFLOAD_LIST_FULLThe list of low power protocol offloads is full."
+			"STATUS_HV_INVALID_HYPERCALL_CODEThe hypervisor does not support the operation because the specified hypercall code is not supported."
+			"STATUS_HV_INVALID_HYPERCALL_INPUTThe hypervisor does not support the operation because the encoding for the hypercall input register is not supported."
+			"STATUS_HV_INVALID_ALIGNMENTThe hypervisor could not perform the operation beacuse a parameter has an invalid alignment.STATUS_HV_INVALID_PARAMETER"
+			"The hypervisor could not perform the operation beacuse an invalid parameter was specified.STATUS_HV_ACCESS_DENIEDAccess to the specified object was denied."
+			"STATUS_HV_INVALID_PARTITION_STATEThe hypervisor could not perform the operation because the partition is entering or in an invalid state."
+			"STATUS_HV_OPERATION_DENIEDThe operation is not allowed in the current state.STATUS_HV_UNKNOWN_PROPERTYThe hypervisor does not recognize the specified partition property."
+			"STATUS_HV_PROPERTY_VALUE_OUT_OF_RANGEThe specified value of a partition property is out of range or violates an invariant."
+			"STATUS_HV_INSUFFICIENT_MEMORYThere is not enough memory in the hypervisor pool to complete the operation.STATUS_HV_PARTITION_TOO_DEEP"
+			"The maximum partition depth has been exceeded for the partition hierarchy.STATUS_HV_INVALID_PARTITION_IDA partition with the specified partition Id does not exist."
+			"STATUS_HV_INVALID_VP_INDEXThe hypervisor could not perform the operation because the specified VP index is invalid.STATUS_HV_INVALID_PORT_ID"
+			"The hypervisor could not perform the operation because the specified port identifier is invalid.STATUS_HV_INVALID_CONNECTION_ID"
+			"The hypervisor could not perform the operation because the specified connection identifier is invalid.STATUS_HV_INSUFFICIENT_BUFFERS"
+			"Not enough buffers were supplied to send a message.STATUS_HV_NOT_ACKNOWLEDGEDThe previous virtual interrupt has not been acknowledged."
+			"STATUS_HV_ACKNOWLEDGEDThe previous virtual interrupt has already been acknowledged.STATUS_HV_INVALID_SAVE_RESTORE_STATEThe indicated partition is not in a valid state for saving or restoring."
+			"STATUS_HV_INVALID_SYNIC_STATEThe hypervisor could not complete the operation because a required feature of the synthetic interrupt controller (SynIC) was disabled."
+			"STATUS_HV_OBJECT_IN_USEThe hypervisor could not perform the operation because the object or value was either already in use or being used for a purpose that would not permit completing the operation."
+			"STATUS_HV_INVALID_PROXIMITY_DOMAIN_INFOThe proximity domain information is invalid.STATUS_HV_NO_DATAAn attempt to retrieve debugging data failed because none was available."
+			"STATUS_HV_INACTIVEThe physical connection being used for debuggging has not recorded any receive activity since the last operation."
+			"STATUS_HV_NO_RESOURCESThere are not enough resources to complete the operation.STATUS_HV_FEATURE_UNAVAILABLEA hypervisor feature is not available to the user."
+			"STATUS_HV_NOT_PRESENTNo hypervisor is present on this system.STATUS_IPSEC_BAD_SPIThe SPI in the packet does not match a valid IPsec SA."
+			"STATUS_IPSEC_SA_LIFETIME_EXPIRED";
+
+		constexpr const char page_3[] =
+			"Packet was received on an IPsec SA whose lifetime has expired.STATUS_IPSEC_WRONG_SAPacket was received on an IPsec SA that does not match the packet characteristics."
+			"STATUS_IPSEC_REPLAY_CHECK_FAILEDPacket sequence number replay check failed.STATUS_IPSEC_INVALID_PACKETIPsec header and/or trailer in the packet is invalid."
+			"STATUS_IPSEC_INTEGRITY_CHECK_FAILEDIPsec integrity check failed.STATUS_IPSEC_CLEAR_TEXT_DROPIPsec dropped a clear text packet."
+			"STATUS_IPSEC_AUTH_FIREWALL_DROPIPsec dropped an incoming ESP packet in authenticated firewall mode. This drop is benign."
+			"STATUS_IPSEC_THROTTLE_DROPIPsec dropped a packet due to DoS throttling.STATUS_IPSEC_DOSP_BLOCKIPsec DoS Protection matched an explicit block rule."
+			"STATUS_IPSEC_DOSP_RECEIVED_MULTICASTIPsec DoS Protection received an IPsec specific multicast packet which is not allowed."
+			"STATUS_IPSEC_DOSP_INVALID_PACKETIPsec DoS Protection received an incorrectly formatted packet.STATUS_IPSEC_DOSP_STATE_LOOKUP_FAILED"
+			"IPsec DoS Protection failed to look up state.STATUS_IPSEC_DOSP_MAX_ENTRIESIPsec DoS Protection failed to create state because the maximum number of entries allowed by policy has been reached."
+			"STATUS_IPSEC_DOSP_KEYMOD_NOT_ALLOWEDIPsec DoS Protection received an IPsec negotiation packet for a keying module which is not allowed by policy."
+			"STATUS_IPSEC_DOSP_MAX_PER_IP_RATELIMIT_QUEUESIPsec DoS Protection failed to create a per internal IP rate limit queue because the maximum number of queues allowed by policy has been reached."
+			"STATUS_VID_DUPLICATE_HANDLERThe handler for the virtualization infrastructure driver is already registered. Restarting the virtual machine may fix the problem. If the problem persists, try restarting the physical computer."
+			"STATUS_VID_TOO_MANY_HANDLERSThe number of registered handlers for the virtualization infrastructure driver exceeded the maximum. Restarting the virtual machine may fix the problem. If the problem persists, try restarting the physical computer."
+			"STATUS_VID_QUEUE_FULLThe message queue for the virtualization infrastructure driver is full and cannot accept new messages. Restarting the virtual machine may fix the problem. If the problem persists, try restarting the physical computer."
+			"STATUS_VID_HANDLER_NOT_PRESENTNo handler exists to handle the message for the virtualization infrastructure driver. Restarting the virtual machine may fix the problem. If the problem persists, try restarting the physical computer."
+			"STATUS_VID_INVALID_OBJECT_NAMEThe name of the partition or message queue for the virtualization infrastructure driver is invalid. Restarting the virtual machine may fix the problem. If the problem persists, try restarting the physical computer."
+			"STATUS_VID_PARTITION_NAME_TOO_LONGThe partition name of the virtualization infrastructure driver exceeds the maximum.STATUS_VID_MESSAGE_QUEUE_NAME_TOO_LONG"
+			"The message queue name of the virtualization infrastructure driver exceeds the maximum.STATUS_VID_PARTITION_ALREADY_EXISTS"
+			"Cannot create the partition for the virtualization infrastructure driver because another partition with the same name already exists."
+			"STATUS_VID_PARTITION_DOES_NOT_EXISTThe virtualization infrastructure driver has encountered an error. The requested partition does not exist. Restarting the virtual machine may fix the problem. If the problem persists, try restarting the physical computer."
+			"STATUS_VID_PARTITION_NAME_NOT_FOUNDThe virtualization infrastructure driver has encountered an error. Could not find the requested partition. Restarting the virtual machine may fix the problem. If the problem persists, try restarting the physical computer."
+			"STATUS_VID_MESSAGE_QUEUE_ALREADY_EXISTSA message queue with the same name already exists for the virtualization infrastructure driver."
+			"STATUS_VID_EXCEEDED_MBP_ENTRY_MAP_LIMITThe memory block page for the virtualization infrastructure driver cannot be mapped because the page map limit has been reached. Restarting the virtual machine may fix the problem. If the problem persists, try restarting the physical computer."
+			"STATUS_VID_MB_STILL_REFERENCEDThe memory block for the virtualization infrastructure driver is still being used and cannot be destroyed."
+			"STATUS_VID_CHILD_GPA_PAGE_SET_CORRUPTEDCannot unlock the page array for the guest operating system memory address because it does not match a previous lock request. Restarting the virtual machine may fix the problem. If the problem persists, try restarting the physical computer."
+			"STATUS_VID_INVALID_NUMA_SETTINGSThe non-uniform memory access (NUMA) node settings do not match the system NUMA topology. In order to start the virtual machine, you will need to modify the NUMA configuration. For detailed information, see http://go.microsoft.com/fwlink/\?LinkId=92362."
+			"STATUS_VID_INVALID_NUMA_NODE_INDEXThe non-uniform memory access (NUMA) node index does not match a valid index in the system NUMA topology."
+			"STATUS_VID_NOTIFICATION_QUEUE_ALREADY_ASSOCIATEDThe memory block for the virtualization infrastructure driver is already associated with a message queue."
+			"STATUS_VID_INVALID_MEMORY_BLOCK_HANDLEThe handle is not a valid memory block handle for the virtualization infrastructure driver."
+			"STATUS_VID_PAGE_RANGE_OVERFLOWThe request exceeded the memory block page limit for the virtualization infrastructure driver. Restarting the virtual machine may fix the problem. If the problem persists, try restarting the physical computer."
+			"STATUS_VID_INVALID_MESSAGE_QUEUE_HANDLEThe handle is not a valid message queue handle for the virtualization infrastructure driver."
+			"STATUS_VID_INVALID_GPA_RANGE_HANDLEThe handle is not a valid page range handle for the virtualization infrastructure driver."
+			"STATUS_VID_NO_MEMORY_BLOCK_NOTIFICATION_QUEUECannot install client notifications because no message queue for the virtualization infrastructure driver is associated with the memory block."
+			"STATUS_VID_MEMORY_BLOCK_LOCK_COUNT_EXCEEDEDThe request to lock or map a memory block page failed because the virtualization infrastructure driver memory block limit has been reached. Restarting the virtual machine may fix the problem. If the problem persists, try restarting the physical computer."
+			"STATUS_VID_INVALID_PPM_HANDLEThe handle is not a valid parent partition mapping handle for the virtualization infrastructure driver."
+			"STATUS_VID_MBPS_ARE_LOCKEDNotifications cannot be created on the memory block because it is use.STATUS_VID_MESSAGE_QUEUE_CLOSED"
+			"The message queue for the virtualization infrastructure driver has been closed. Restarting the virtual machine may fix the problem. If the problem persists, try restarting the physical computer."
+			"STATUS_VID_VIRTUAL_PROCESSOR_LIMIT_EXCEEDEDCannot add a virtual processor to the partition because the maximum has been reached."
+			"STATUS_VID_STOP_PENDINGCannot stop the virtual processor immediately because of a pending intercept.STATUS_VID_INVALID_PROCESSOR_STATE"
+			"Invalid state for the virtual processor. Restarting the virtual machine may fix the problem. If the problem persists, try restarting the physical computer."
+			"STATUS_VID_EXCEEDED_KM_CONTEXT_COUNT_LIMITThe maximum number of kernel mode clients for the virtualization infrastructure driver has been reached. Restarting the virtual machine may fix the problem. If the problem persists, try restarting the physical computer."
+			"STATUS_VID_KM_INTERFACE_ALREADY_INITIALIZEDThis kernel mode interface for the virtualization infrastructure driver has already been initialized. Restarting the virtual machine may fix the problem. If the problem persists, try restarting the physical computer."
+			"STATUS_VID_MB_PROPERTY_ALREADY_SET_RESETCannot set or reset the memory block property more than once for the virtualization infrastructure driver. Restarting the virtual machine may fix the problem. If the problem persists, try restarting the physical computer."
+			"STATUS_VID_MMIO_RANGE_DESTROYEDThe memory mapped I/O for this page range no longer exists. Restarting the virtual machine may fix the problem. If the problem persists, try restarting the physical computer."
+			"STATUS_VID_INVALID_CHILD_GPA_PAGE_SETThe lock or unlock request uses an invalid guest operating system memory address. Restarting the virtual machine may fix the problem. If the problem persists, try restarting the physical computer."
+			"STATUS_VID_RESERVE_PAGE_SET_IS_BEING_USEDCannot destroy or reuse the reserve page set for the virtualization infrastructure driver because it is in use. Restarting the virtual machine may fix the problem. If the problem persists, try restarting the physical computer."
+			"STATUS_VID_RESERVE_PAGE_SET_TOO_SMALLThe reserve page set for the virtualization infrastructure driver is too small to use in the lock request. Restarting the virtual machine may fix the problem. If the problem persists, try restarting the physical computer."
+			"STATUS_VID_MBP_ALREADY_LOCKED_USING_RESERVED_PAGECannot lock or map the memory block page for the virtualization infrastructure driver because it has already been locked using a reserve page set page. Restarting the virtual machine may fix the problem. If the problem persists, try restarting the physical computer."
+			"STATUS_VID_MBP_COUNT_EXCEEDED_LIMITCannot create the memory block for the virtualization infrastructure driver because the requested number of pages exceeded the limit. Restarting the virtual machine may fix the problem. If the problem persists, try restarting the physical computer."
+			"STATUS_VID_SAVED_STATE_CORRUPTCannot restore this virtual machine because the saved state data cannot be read. Delete the saved state data and then try to start the virtual machine."
+			"STATUS_VID_SAVED_STATE_UNRECOGNIZED_ITEMCannot restore this virtual machine because an item read from the saved state data is not recognized. Delete the saved state data and then try to start the virtual machine."
+			"STATUS_VID_SAVED_STATE_INCOMPATIBLECannot restore this virtual machine to the saved state because of hypervisor incompatibility. Delete the saved state data and then try to start the virtual machine."
+			"STATUS_VOLMGR_DATABASE_FULLThe configuration database is full.STATUS_VOLMGR_DISK_CONFIGURATION_CORRUPTEDThe configuration data on the disk is corrupted."
+			"STATUS_VOLMGR_DISK_CONFIGURATION_NOT_IN_SYNCThe configuration on the disk is not insync with the in-memory configuration."
+			"STATUS_VOLMGR_PACK_CONFIG_UPDATE_FAILEDA majority of disks failed to be updated with the new configuration.STATUS_VOLMGR_DISK_CONTAINS_NON_SIMPLE_VOLUME"
+			"The disk contains non-simple volumes.STATUS_VOLMGR_DISK_DUPLICATEThe same disk was specified more than once in the migration list."
+			"STATUS_VOLMGR_DISK_DYNAMICThe disk is already dynamic.STATUS_VOLMGR_DISK_ID_INVALIDThe specified disk id is invalid. There are no disks with the specified disk id."
+			"STATUS_VOLMGR_DISK_INVALIDThe specified disk is an invalid disk. Operation cannot complete on an invalid disk.STATUS_VOLMGR_DISK_LAST_VOTER"
+			"The specified disk(s) cannot be removed since it is the last remaining voter.STATUS_VOLMGR_DISK_LAYOUT_INVALIDThe specified disk has an invalid disk layout."
+			"STATUS_VOLMGR_DISK_LAYOUT_NON_BASIC_BETWEEN_BASIC_PARTITIONSThe disk layout contains non-basic partitions which appear after basic paritions. This is an invalid disk layout."
+			"STATUS_VOLMGR_DISK_LAYOUT_NOT_CYLINDER_ALIGNEDThe disk layout contains partitions which are not cylinder aligned.STATUS_VOLMGR_DISK_LAYOUT_PARTITIONS_TOO_SMALL"
+			"The disk layout contains partitions which are samller than the minimum size.STATUS_VOLMGR_DISK_LAYOUT_PRIMARY_BETWEEN_LOGICAL_PARTITIONS"
+			"The disk layout contains primary partitions in between logical drives. This is an invalid disk layout.STATUS_VOLMGR_DISK_LAYOUT_TOO_MANY_PARTITIONS"
+			"The disk layout contains more than the maximum number of supported partitions.STATUS_VOLMGR_DISK_MISSINGThe specified disk is missing. The operation cannot complete on a missing disk."
+			"STATUS_VOLMGR_DISK_NOT_EMPTYThe specified disk is not empty.STATUS_VOLMGR_DISK_NOT_ENOUGH_SPACEThere is not enough usable space for this operation."
+			"STATUS_VOLMGR_DISK_REVECTORING_FAILEDThe force revectoring of bad sectors failed.STATUS_VOLMGR_DISK_SECTOR_SIZE_INVALIDThe specified disk has an invalid sector size."
+			"STATUS_VOLMGR_DISK_SET_NOT_CONTAINEDThe specified disk set contains volumes which exist on disks outside of the set.STATUS_VOLMGR_DISK_USED_BY_MULTIPLE_MEMBERS"
+			"A disk in the volume layout provides extents to more than one member of a plex.STATUS_VOLMGR_DISK_USED_BY_MULTIPLE_PLEXES"
+			"A disk in the volume layout provides extents to more than one plex.STATUS_VOLMGR_DYNAMIC_DISK_NOT_SUPPORTEDDynamic disks are not supported on this system."
+			"STATUS_VOLMGR_EXTENT_ALREADY_USEDThe specified extent is already used by other volumes.STATUS_VOLMGR_EXTENT_NOT_CONTIGUOUS"
+			"The specified volume is retained and can only be extended into a contiguous extent. The specified extent to grow the volume is not contiguous with the specified volume."
+			"STATUS_VOLMGR_EXTENT_NOT_IN_PUBLIC_REGIONThe specified volume extent is not within the public region of the disk.STATUS_VOLMGR_EXTENT_NOT_SECTOR_ALIGNED"
+			"The specifed volume extent is not sector aligned.STATUS_VOLMGR_EXTENT_OVERLAPS_EBR_PARTITIONThe specified parition overlaps an EBR (the first track of an extended partition on a MBR disks)."
+			"STATUS_VOLMGR_EXTENT_VOLUME_LENGTHS_DO_NOT_MATCHThe specified extent lengths cannot be used to construct a volume with specified length."
+			"STATUS_VOLMGR_FAULT_TOLERANT_NOT_SUPPORTEDThe system does not support fault tolerant volumes.STATUS_VOLMGR_INTERLEAVE_LENGTH_INVALID"
+			"The specified interleave length is invalid.STATUS_VOLMGR_MAXIMUM_REGISTERED_USERSThere is already a maximum number of registered users."
+			"STATUS_VOLMGR_MEMBER_IN_SYNCThe specified member is already in-sync with the other active members. It does not need to be regenerated."
+			"STATUS_VOLMGR_MEMBER_INDEX_DUPLICATEThe same member index was specified more than once.STATUS_VOLMGR_MEMBER_INDEX_INVALID"
+			"The specified member index is greater or equal than the number of members in the volume plex.STATUS_VOLMGR_MEMBER_MISSING"
+			"The specified member is missing. It cannot be regenerated.STATUS_VOLMGR_MEMBER_NOT_DETACHEDThe specified member is not detached. Cannot replace a member which is not detached."
+			"STATUS_VOLMGR_MEMBER_REGENERATINGThe specified member is already regenerating.STATUS_VOLMGR_ALL_DISKS_FAILEDAll disks belonging to the pack failed."
+			"STATUS_VOLMGR_NO_REGISTERED_USERSThere are currently no registered users for notifications. The task number is irrelevant unless there are registered users."
+			"STATUS_VOLMGR_NO_SUCH_USERThe specified notification user does not exist. Failed to unregister user for notifications.STATUS_VOLMGR_NOTIFICATION_RESET"
+			"The notifications have been reset. Notifications for the current user are invalid. Unregister and re-register for notifications."
+			"STATUS_VOLMGR_NUMBER_OF_MEMBERS_INVALIDThe specified number of members is invalid.STATUS_VOLMGR_NUMBER_OF_PLEXES_INVALID"
+			"The specified number of plexes is invalid.STATUS_VOLMGR_PACK_DUPLICATEThe specified source and target packs are identical."
+			"STATUS_VOLMGR_PACK_ID_INVALIDThe specified pack id is invalid. There are no packs with the specified pack id.STATUS_VOLMGR_PACK_INVALID"
+			"The specified pack is the invalid pack. The operation cannot complete with the invalid pack.STATUS_VOLMGR_PACK_NAME_INVALID"
+			"The specified pack name is invalid.STATUS_VOLMGR_PACK_OFFLINEThe specified pack is offline.STATUS_VOLMGR_PACK_HAS_QUORUM"
+			"The specified pack already has a quorum of healthy disks.STATUS_VOLMGR_PACK_WITHOUT_QUORUMThe pack does not have a quorum of healthy disks."
+			"STATUS_VOLMGR_PARTITION_STYLE_INVALIDThe specified disk has an unsupported partition style. Only MBR and GPT partition styles are supported."
+			"STATUS_VOLMGR_PARTITION_UPDATE_FAILEDFailed to update the disk's partition layout.STATUS_VOLMGR_PLEX_IN_SYNCThe specified plex is already in-sync with the other active plexes. It does not need to be regenerated."
+			"STATUS_VOLMGR_PLEX_INDEX_DUPLICATEThe same plex index was specified more than once.STATUS_VOLMGR_PLEX_INDEX_INVALIDThe specified plex index is greater or equal than the number of plexes in the volume."
+			"STATUS_VOLMGR_PLEX_LAST_ACTIVEThe specified plex is the last active plex in the volume. The plex cannot be removed or else the volume will go offline."
+			"STATUS_VOLMGR_PLEX_MISSINGThe specified plex is missing.STATUS_VOLMGR_PLEX_REGENERATINGThe specified plex is currently regenerating."
+			"STATUS_VOLMGR_PLEX_TYPE_INVALIDThe specified plex type is invalid.STATUS_VOLMGR_PLEX_NOT_RAID5The operation is only supported on RAID-5 plexes."
+			"STATUS_VOLMGR_PLEX_NOT_SIMPLEThe operation is only supported on simple plexes.STATUS_VOLMGR_STRUCTURE_SIZE_INVALIDThe Size fields in the VM_VOLUME_LAYOUT input structure are incorrectly set."
+			"STATUS_VOLMGR_TOO_MANY_NOTIFICATION_REQUESTSThere is already a pending request for notifications. Wait for the existing request to return before requesting for more notifications."
+			"STATUS_VOLMGR_TRANSACTION_IN_PROGRESSThere is currently a transaction in process.STATUS_VOLMGR_UNEXPECTED_DISK_LAYOUT_CHANGE"
+			"An unexpected layout change occurred outside of the volume manager.STATUS_VOLMGR_VOLUME_CONTAINS_MISSING_DISKThe specified volume contains a missing disk."
+			"STATUS_VOLMGR_VOLUME_ID_INVALIDThe specified volume id is invalid. There are no volumes with the specified volume id.STATUS_VOLMGR_VOLUME_LENGTH_INVALID"
+			"The specified volume length is invalid.STATUS_VOLMGR_VOLUME_LENGTH_NOT_SECTOR_SIZE_MULTIPLEThe specified size for the volume is not a multiple of the sector size."
+			"STATUS_VOLMGR_VOLUME_NOT_MIRROREDThe operation is only supported on mirrored volumes.STATUS_VOLMGR_VOLUME_NOT_RETAINEDThe specified volume does not have a retain partition."
+			"STATUS_VOLMGR_VOLUME_OFFLINEThe specified volume is offline.STATUS_VOLMGR_VOLUME_RETAINEDThe specified volume already has a retain partition."
+			"STATUS_VOLMGR_NUMBER_OF_EXTENTS_INVALIDThe specified number of extents is invalid.STATUS_VOLMGR_DIFFERENT_SECTOR_SIZEAll disks participating to the volume must have the same sector size."
+			"STATUS_VOLMGR_BAD_BOOT_DISKThe boot disk experienced failures.STATUS_VOLMGR_PACK_CONFIG_OFFLINEThe configuration of the pack is offline."
+			"STATUS_VOLMGR_PACK_CONFIG_ONLINEThe configuration of the pack is online.STATUS_VOLMGR_NOT_PRIMARY_PACKThe specified pack is not the primary pack."
+			"STATUS_VOLMGR_PACK_LOG_UPDATE_FAILEDAll disks failed to be updated with the new content of the log.STATUS_VOLMGR_NUMBER_OF_DISKS_IN_PLEX_INVALID"
+			"The specified number of disks in a plex is invalid.STATUS_VOLMGR_NUMBER_OF_DISKS_IN_MEMBER_INVALIDThe specified number of disks in a plex member is invalid."
+			"STATUS_VOLMGR_VOLUME_MIRROREDThe operation is not supported on mirrored volumes.STATUS_VOLMGR_PLEX_NOT_SIMPLE_SPANNEDThe operation is only supported on simple and spanned plexes."
+			"STATUS_VOLMGR_NO_VALID_LOG_COPIESThe pack has no valid log copies.STATUS_VOLMGR_PRIMARY_PACK_PRESENTA primary pack is already present."
+			"STATUS_VOLMGR_NUMBER_OF_DISKS_INVALIDThe specified number of disks is invalid.STATUS_VOLMGR_MIRROR_NOT_SUPPORTEDThe system does not support mirrored volumes."
+			"STATUS_VOLMGR_RAID5_NOT_SUPPORTEDThe system does not support RAID-5 volumes.STATUS_BCD_TOO_MANY_ELEMENTSEntries enumerated have exceeded the allowed threshold."
+			"STATUS_VHD_DRIVE_FOOTER_MISSINGThe virtual hard disk is corrupted. The virtual hard disk drive footer is missing.STATUS_VHD_DRIVE_FOOTER_CHECKSUM_MISMATCH"
+			"The virtual hard disk is corrupted. The virtual hard disk drive footer checksum does not match the on-disk checksum.STATUS_VHD_DRIVE_FOOTER_CORRUPT"
+			"The virtual hard disk is corrupted. The virtual hard disk drive footer in the virtual hard disk is corrupted.STATUS_VHD_FORMAT_UNKNOWN"
+			"The system does not recognize the file format of this virtual hard disk.STATUS_VHD_FORMAT_UNSUPPORTED_VERSIONThe version does not support this version of the file format."
+			"STATUS_VHD_SPARSE_HEADER_CHECKSUM_MISMATCHThe virtual hard disk is corrupted. The sparse header checksum does not match the on-disk checksum."
+			"STATUS_VHD_SPARSE_HEADER_UNSUPPORTED_VERSIONThe system does not support this version of the virtual hard disk.This version of the sparse header is not supported."
+			"STATUS_VHD_SPARSE_HEADER_CORRUPTThe virtual hard disk is corrupted. The sparse header in the virtual hard disk is corrupt."
+			"STATUS_VHD_BLOCK_ALLOCATION_FAILUREFailed to write to the virtual hard disk failed because the system failed to allocate a new block in the virtual hard disk."
+			"STATUS_VHD_BLOCK_ALLOCATION_TABLE_CORRUPTThe virtual hard disk is corrupted. The block allocation table in the virtual hard disk is corrupt."
+			"STATUS_VHD_INVALID_BLOCK_SIZEThe system does not support this version of the virtual hard disk. The block size is invalid."
+			"STATUS_VHD_BITMAP_MISMATCHThe virtual hard disk is corrupted. The block bitmap does not match with the block data present in the virtual hard disk."
+			"STATUS_VHD_PARENT_VHD_NOT_FOUNDThe chain of virtual hard disks is broken. The system cannot locate the parent virtual hard disk for the differencing disk."
+			"STATUS_VHD_CHILD_PARENT_ID_MISMATCHThe chain of virtual hard disks is corrupted. There is a mismatch in the identifiers of the parent virtual hard disk and differencing disk."
+			"STATUS_VHD_CHILD_PARENT_TIMESTAMP_MISMATCHThe chain of virtual hard disks is corrupted. The time stamp of the parent virtual hard disk does not match the time stamp of the differencing disk."
+			"STATUS_VHD_METADATA_READ_FAILUREFailed to read the metadata of the virtual hard disk.STATUS_VHD_METADATA_WRITE_FAILUREFailed to write to the metadata of the virtual hard disk."
+			"STATUS_VHD_INVALID_SIZEThe size of the virtual hard disk is not valid.STATUS_VHD_INVALID_FILE_SIZEThe file size of this virtual hard disk is not valid."
+			"STATUS_VIRTDISK_PROVIDER_NOT_FOUNDA virtual disk support provider for the specified file was not found.STATUS_VIRTDISK_NOT_VIRTUAL_DISK"
+			"The specified disk is not a virtual disk.STATUS_VHD_PARENT_VHD_ACCESS_DENIEDThe chain of virtual hard disks is inaccessible. The process has not been granted access rights to the parent virtual hard disk for the differencing disk."
+			"STATUS_VHD_CHILD_PARENT_SIZE_MISMATCHThe chain of virtual hard disks is corrupted. There is a mismatch in the virtual sizes of the parent virtual hard disk and differencing disk."
+			"STATUS_VHD_DIFFERENCING_CHAIN_CYCLE_DETECTEDThe chain of virtual hard disks is corrupted. A differencing disk is indicated in its own parent chain."
+			"STATUS_VHD_DIFFERENCING_CHAIN_ERROR_IN_PARENTThe chain of virtual hard disks is inaccessible. There was an error opening a virtual hard disk further up the chain."
+			"STATUS_VIRTUAL_DISK_LIMITATIONThe requested operation could not be completed due to a virtual disk system limitation.  Virtual disks are only supported on NTFS volumes and must be both uncompressed and unencrypted."
+			"STATUS_VHD_INVALID_TYPEThe requested operation cannot be performed on a virtual disk of this type.STATUS_VHD_INVALID_STATE"
+			"The requested operation cannot be performed on the virtual disk in its current state.STATUS_VIRTDISK_UNSUPPORTED_DISK_SECTOR_SIZE"
+			"The sector size of the physical disk on which the virtual disk resides is not supported.STATUS_DIS_NOT_PRESENTThe Derived Indexed Store is not present (or currently loaded) on this system."
+			"STATUS_DIS_ATTRIBUTE_NOT_FOUNDThe Attribute was not found in the store for a given object.STATUS_DIS_UNRECOGNIZED_ATTRIBUTE"
+			"This is not a recognized built-in attribute.STATUS_DIS_PARTIAL_DATAPartial data was successfully returned, some attributes need to be calculated from elsewhere."
+			"";
+
+		constexpr const char* pages[4] = { page_0, page_1, page_2, page_3 };
+
+		constexpr status_table::entry_t entries[2008] = {
+			{ 0x00000000, 0x000000, 0x00000E, 14, 0 }, // STATUS_SUCCESS
+			{ 0x00000000, 0x00000E, 0x00000E, 13, 13 }, // STATUS_WAIT_0
+			{ 0x00000001, 0x00001B, 0x00001B, 13, 13 }, // STATUS_WAIT_1
+			{ 0x00000002, 0x000028, 0x000028, 13, 13 }, // STATUS_WAIT_2
+			{ 0x00000003, 0x000035, 0x000035, 13, 13 }, // STATUS_WAIT_3
+			{ 0x0000003F, 0x000042, 0x000042, 14, 14 }, // STATUS_WAIT_63
+			{ 0x00000080, 0x000050, 0x00000E, 16, 0 }, // STATUS_ABANDONED
+			{ 0x00000080, 0x000060, 0x000060, 23, 23 }, // STATUS_ABANDONED_WAIT_0
+			{ 0x000000BF, 0x000077, 0x000077, 24, 24 }, // STATUS_ABANDONED_WAIT_63
+			{ 0x000000C0, 0x00008F, 0x00008F, 15, 15 }, // STATUS_USER_APC
+			{ 0x00000100, 0x00009E, 0x00009E, 17, 17 }, // STATUS_KERNEL_APC
+			{ 0x00000101, 0x0000AF, 0x0000AF, 14, 14 }, // STATUS_ALERTED
+			{ 0x00000102, 0x0000BD, 0x0000BD, 14, 14 }, // STATUS_TIMEOUT
+			{ 0x00000103, 0x0000CB, 0x0000D9, 14, 55 }, // STATUS_PENDING
+			{ 0x00000104, 0x000110, 0x00011E, 14, 107 }, // STATUS_REPARSE
+			{ 0x00000105, 0x000189, 0x00019C, 19, 91 }, // STATUS_MORE_ENTRIES
+			{ 0x00000106, 0x0001F7, 0x00020E, 23, 195 }, // STATUS_NOT_ALL_ASSIGNED
+			{ 0x00000107, 0x0002D1, 0x0002E7, 22, 65 }, // STATUS_SOME_NOT_MAPPED
+			{ 0x00000108, 0x000328, 0x000347, 31, 69 }, // STATUS_OPLOCK_BREAK_IN_PROGRESS
+			{ 0x00000109, 0x00038C, 0x0003A1, 21, 47 }, // STATUS_VOLUME_MOUNTED
+			{ 0x0000010A, 0x0003D0, 0x0003E6, 22, 193 }, // STATUS_RXACT_COMMITTED
+			{ 0x0000010B, 0x0004A7, 0x0004BC, 21, 126 }, // STATUS_NOTIFY_CLEANUP
+			{ 0x0000010C, 0x00053A, 0x000550, 22, 198 }, // STATUS_NOTIFY_ENUM_DIR
+			{ 0x0000010D, 0x000616, 0x000632, 28, 73 }, // STATUS_NO_QUOTAS_FOR_ACCOUNT
+			{ 0x0000010E, 0x00067B, 0x0006A2, 39, 206 }, // STATUS_PRIMARY_TRANSPORT_CONNECT_FAILED
+			{ 0x00000110, 0x000770, 0x00078C, 28, 34 }, // STATUS_PAGE_FAULT_TRANSITION
+			{ 0x00000111, 0x0007AE, 0x0007CB, 29, 35 }, // STATUS_PAGE_FAULT_DEMAND_ZERO
+			{ 0x00000112, 0x0007EE, 0x0007CB, 31, 35 }, // STATUS_PAGE_FAULT_COPY_ON_WRITE
+			{ 0x00000113, 0x00080D, 0x0007CB, 28, 35 }, // STATUS_PAGE_FAULT_GUARD_PAGE
+			{ 0x00000114, 0x000829, 0x000846, 29, 68 }, // STATUS_PAGE_FAULT_PAGING_FILE
+			{ 0x00000115, 0x00088A, 0x0008A2, 24, 40 }, // STATUS_CACHE_PAGE_LOCKED
+			{ 0x00000116, 0x0008CA, 0x0008DB, 17, 33 }, // STATUS_CRASH_DUMP
+			{ 0x00000117, 0x0008FC, 0x000913, 23, 36 }, // STATUS_BUFFER_ALL_ZEROS
+			{ 0x00000118, 0x000937, 0x00011E, 21, 107 }, // STATUS_REPARSE_OBJECT
+			{ 0x00000119, 0x00094C, 0x000970, 36, 81 }, // STATUS_RESOURCE_REQUIREMENTS_CHANGED
+			{ 0x00000120, 0x0009C1, 0x0009DC, 27, 116 }, // STATUS_TRANSLATION_COMPLETE
+			{ 0x00000121, 0x000A50, 0x000A76, 38, 111 }, // STATUS_DS_MEMBERSHIP_EVALUATED_LOCALLY
+			{ 0x00000122, 0x000AE5, 0x000B00, 27, 55 }, // STATUS_NOTHING_TO_TERMINATE
+			{ 0x00000123, 0x000B37, 0x000B50, 25, 43 }, // STATUS_PROCESS_NOT_IN_JOB
+			{ 0x00000124, 0x000B7B, 0x000B90, 21, 39 }, // STATUS_PROCESS_IN_JOB
+			{ 0x00000125, 0x000BB7, 0x000BD5, 30, 69 }, // STATUS_VOLSNAP_HIBERNATE_READY
+			{ 0x00000126, 0x000C1A, 0x000C43, 41, 92 }, // STATUS_FSFILTER_OP_COMPLETED_SUCCESSFULLY
+			{ 0x00000127, 0x000C9F, 0x000CC8, 41, 53 }, // STATUS_INTERRUPT_VECTOR_ALREADY_CONNECTED
+			{ 0x00000128, 0x000CFD, 0x000D1D, 32, 50 }, // STATUS_INTERRUPT_STILL_CONNECTED
+			{ 0x00000129, 0x000D4F, 0x000D64, 21, 40 }, // STATUS_PROCESS_CLONED
+			{ 0x0000012A, 0x000D8C, 0x000DB0, 36, 60 }, // STATUS_FILE_LOCKED_WITH_ONLY_READERS
+			{ 0x0000012B, 0x000DEC, 0x000E0B, 31, 64 }, // STATUS_FILE_LOCKED_WITH_WRITERS
+			{ 0x00000202, 0x000E4B, 0x000E6B, 32, 96 }, // STATUS_RESOURCEMANAGER_READ_ONLY
+			{ 0x00000210, 0x000ECB, 0x000EE7, 28, 80 }, // STATUS_RING_PREVIOUSLY_EMPTY
+			{ 0x00000211, 0x000F37, 0x000F52, 27, 78 }, // STATUS_RING_PREVIOUSLY_FULL
+			{ 0x00000212, 0x000FA0, 0x000FC2, 34, 82 }, // STATUS_RING_PREVIOUSLY_ABOVE_QUOTA
+			{ 0x00000213, 0x001014, 0x00102B, 23, 88 }, // STATUS_RING_NEWLY_EMPTY
+			{ 0x00000214, 0x001083, 0x0010A7, 36, 139 }, // STATUS_RING_SIGNAL_OPPOSITE_ENDPOINT
+			{ 0x00000215, 0x001132, 0x001156, 36, 90 }, // STATUS_OPLOCK_SWITCHED_TO_NEW_HANDLE
+			{ 0x00000216, 0x0011B0, 0x0011CB, 27, 92 }, // STATUS_OPLOCK_HANDLE_CLOSED
+			{ 0x00000367, 0x001227, 0x00123D, 22, 46 }, // STATUS_WAIT_FOR_OPLOCK
+			{ 0x00010001, 0x00126B, 0x001280, 21, 26 }, // DBG_EXCEPTION_HANDLED
+			{ 0x00010002, 0x00129A, 0x0012A6, 12, 18 }, // DBG_CONTINUE
+			{ 0x001C0001, 0x0012B8, 0x0012CE, 22, 33 }, // STATUS_FLT_IO_COMPLETE
+			{ 0x003C0001, 0x0012EF, 0x001309, 26, 36 }, // STATUS_DIS_ATTRIBUTE_BUILT
+			{ 0x40000000, 0x00132D, 0x001346, 25, 92 }, // STATUS_OBJECT_NAME_EXISTS
+			{ 0x40000001, 0x0013A2, 0x0013BD, 27, 131 }, // STATUS_THREAD_WAS_SUSPENDED
+			{ 0x40000002, 0x001440, 0x00145E, 30, 139 }, // STATUS_WORKING_SET_LIMIT_RANGE
+			{ 0x40000003, 0x0014E9, 0x001501, 24, 141 }, // STATUS_IMAGE_NOT_AT_BASE
+			{ 0x40000004, 0x00158E, 0x0015A8, 26, 135 }, // STATUS_RXACT_STATE_CREATED
+			{ 0x40000005, 0x00162F, 0x00164A, 27, 234 }, // STATUS_SEGMENT_NOTIFICATION
+			{ 0x40000006, 0x001734, 0x001751, 29, 160 }, // STATUS_LOCAL_USER_SESSION_KEY
+			{ 0x40000007, 0x0017F1, 0x00180D, 28, 160 }, // STATUS_BAD_CURRENT_DIRECTORY
+			{ 0x40000008, 0x0018AD, 0x0018C6, 25, 141 }, // STATUS_SERIAL_MORE_WRITES
+			{ 0x40000009, 0x001953, 0x00196C, 25, 158 }, // STATUS_REGISTRY_RECOVERED
+			{ 0x4000000A, 0x001A0A, 0x001A2D, 35, 298 }, // STATUS_FT_READ_RECOVERY_FROM_BACKUP
+			{ 0x4000000B, 0x001B57, 0x001B6F, 24, 298 }, // STATUS_FT_WRITE_RECOVERY
+			{ 0x4000000C, 0x001C99, 0x001CB6, 29, 146 }, // STATUS_SERIAL_COUNTER_TIMEOUT
+			{ 0x4000000D, 0x001D48, 0x001D5F, 23, 153 }, // STATUS_NULL_LM_PASSWORD
+			{ 0x4000000E, 0x001DF8, 0x001E1A, 34, 165 }, // STATUS_IMAGE_MACHINE_TYPE_MISMATCH
+			{ 0x4000000F, 0x001EBF, 0x001ED5, 22, 121 }, // STATUS_RECEIVE_PARTIAL
+			{ 0x40000010, 0x001F4E, 0x001F66, 24, 126 }, // STATUS_RECEIVE_EXPEDITED
+			{ 0x40000011, 0x001FE4, 0x002004, 32, 190 }, // STATUS_RECEIVE_PARTIAL_EXPEDITED
+			{ 0x40000012, 0x0020C2, 0x0020D3, 17, 63 }, // STATUS_EVENT_DONE
+			{ 0x40000013, 0x002112, 0x002126, 20, 69 }, // STATUS_EVENT_PENDING
+			{ 0x40000014, 0x00216B, 0x002186, 27, 27 }, // STATUS_CHECKING_FILE_SYSTEM
+			{ 0x40000015, 0x0021A1, 0x0021B6, 21, 28 }, // STATUS_FATAL_APP_EXIT
+			{ 0x40000016, 0x0021D2, 0x0021EA, 24, 64 }, // STATUS_PREDEFINED_HANDLE
+			{ 0x40000017, 0x00222A, 0x00223D, 19, 139 }, // STATUS_WAS_UNLOCKED
+			{ 0x40000018, 0x0022C8, 0x0022E3, 27, 3 }, // STATUS_SERVICE_NOTIFICATION
+			{ 0x40000019, 0x0022E6, 0x0022F7, 17, 58 }, // STATUS_WAS_LOCKED
+			{ 0x4000001A, 0x002331, 0x002346, 21, 26 }, // STATUS_LOG_HARD_ERROR
+			{ 0x4000001B, 0x002360, 0x002360, 20, 20 }, // STATUS_ALREADY_WIN32
+			{ 0x4000001C, 0x002374, 0x00238A, 22, 60 }, // STATUS_WX86_UNSIMULATE
+			{ 0x4000001D, 0x0023C6, 0x00238A, 20, 60 }, // STATUS_WX86_CONTINUE
+			{ 0x4000001E, 0x0023DA, 0x00238A, 23, 60 }, // STATUS_WX86_SINGLE_STEP
+			{ 0x4000001F, 0x0023F1, 0x00238A, 22, 60 }, // STATUS_WX86_BREAKPOINT
+			{ 0x40000020, 0x002407, 0x00238A, 30, 60 }, // STATUS_WX86_EXCEPTION_CONTINUE
+			{ 0x40000021, 0x002425, 0x00238A, 32, 60 }, // STATUS_WX86_EXCEPTION_LASTCHANCE
+			{ 0x40000022, 0x002445, 0x00238A, 27, 60 }, // STATUS_WX86_EXCEPTION_CHAIN
+			{ 0x40000023, 0x002460, 0x002486, 38, 110 }, // STATUS_IMAGE_MACHINE_TYPE_MISMATCH_EXE
+			{ 0x40000024, 0x0024F4, 0x00250D, 25, 67 }, // STATUS_NO_YIELD_PERFORMED
+			{ 0x40000025, 0x002550, 0x00256B, 27, 46 }, // STATUS_TIMER_RESUME_IGNORED
+			{ 0x40000026, 0x002599, 0x0025B5, 28, 69 }, // STATUS_ARBITRATION_UNHANDLED
+			{ 0x40000027, 0x0025FA, 0x002616, 28, 255 }, // STATUS_CARDBUS_NOT_SUPPORTED
+			{ 0x40000028, 0x002715, 0x00238A, 25, 60 }, // STATUS_WX86_CREATEWX86TIB
+			{ 0x40000029, 0x00272E, 0x00274A, 28, 313 }, // STATUS_MP_PROCESSOR_MISMATCH
+			{ 0x4000002A, 0x002883, 0x002894, 17, 36 }, // STATUS_HIBERNATED
+			{ 0x4000002B, 0x0028B8, 0x0028D1, 25, 40 }, // STATUS_RESUME_HIBERNATION
+			{ 0x4000002C, 0x0028F9, 0x002910, 23, 121 }, // STATUS_FIRMWARE_UPDATED
+			{ 0x4000002D, 0x002989, 0x0029AC, 35, 161 }, // STATUS_DRIVERS_LEAKING_LOCKED_PAGES
+			{ 0x4000002E, 0x002A4D, 0x002A65, 24, 92 }, // STATUS_MESSAGE_RETRIEVED
+			{ 0x4000002F, 0x002AC1, 0x002AE4, 35, 54 }, // STATUS_SYSTEM_POWERSTATE_TRANSITION
+			{ 0x40000030, 0x002B1A, 0x002B3B, 33, 94 }, // STATUS_ALPC_CHECK_COMPLETION_LIST
+			{ 0x40000031, 0x002B99, 0x002BC4, 43, 73 }, // STATUS_SYSTEM_POWERSTATE_COMPLEX_TRANSITION
+			{ 0x40000032, 0x002C0D, 0x002C2A, 29, 44 }, // STATUS_ACCESS_AUDIT_BY_POLICY
+			{ 0x40000033, 0x002C56, 0x002C6E, 24, 70 }, // STATUS_ABANDON_HIBERFILE
+			{ 0x40000034, 0x002CB4, 0x002CCF, 27, 63 }, // STATUS_BIZRULES_NOT_ENABLED
+			{ 0x40000294, 0x002D0E, 0x002D20, 18, 21 }, // STATUS_WAKE_SYSTEM
+			{ 0x40000370, 0x002D35, 0x002D4C, 23, 39 }, // STATUS_DS_SHUTTING_DOWN
+			{ 0x40010001, 0x002D73, 0x002D82, 15, 26 }, // DBG_REPLY_LATER
+			{ 0x40010002, 0x002D9C, 0x002DB8, 28, 31 }, // DBG_UNABLE_TO_PROVIDE_HANDLE
+			{ 0x40010003, 0x002DD7, 0x002DEB, 20, 27 }, // DBG_TERMINATE_THREAD
+			{ 0x40010004, 0x002E06, 0x002E1B, 21, 28 }, // DBG_TERMINATE_PROCESS
+			{ 0x40010005, 0x002E37, 0x002E44, 13, 23 }, // DBG_CONTROL_C
+			{ 0x40010006, 0x002E5B, 0x002E6F, 20, 40 }, // DBG_PRINTEXCEPTION_C
+			{ 0x40010007, 0x002E97, 0x002EA7, 16, 32 }, // DBG_RIPEXCEPTION
+			{ 0x40010008, 0x002EC7, 0x002ED8, 17, 32 }, // DBG_CONTROL_BREAK
+			{ 0x40010009, 0x002EF8, 0x002F0D, 21, 41 }, // DBG_COMMAND_EXCEPTION
+			{ 0x40020056, 0x002F36, 0x002F4C, 22, 62 }, // RPC_NT_UUID_LOCAL_ONLY
+			{ 0x400200AF, 0x002F8A, 0x002FA0, 22, 51 }, // RPC_NT_SEND_INCOMPLETE
+			{ 0x400A0004, 0x002FD3, 0x002FE9, 22, 70 }, // STATUS_CTX_CDM_CONNECT
+			{ 0x400A0005, 0x00302F, 0x003048, 25, 73 }, // STATUS_CTX_CDM_DISCONNECT
+			{ 0x4015000D, 0x003091, 0x0030B6, 37, 74 }, // STATUS_SXS_RELEASE_ACTIVATION_CONTEXT
+			{ 0x40190001, 0x003100, 0x003120, 32, 351 }, // STATUS_HEURISTIC_DAMAGE_POSSIBLE
+			{ 0x40190034, 0x00327F, 0x003299, 26, 81 }, // STATUS_RECOVERY_NOT_NEEDED
+			{ 0x40190035, 0x0032EA, 0x003303, 25, 60 }, // STATUS_RM_ALREADY_STARTED
+			{ 0x401A000C, 0x00333F, 0x003354, 21, 58 }, // STATUS_LOG_NO_RESTART
+			{ 0x401B00EC, 0x00338E, 0x0033B6, 40, 280 }, // STATUS_VIDEO_DRIVER_DEBUG_REPORT_REQUEST
+			{ 0x401E000A, 0x0034CE, 0x0034F4, 38, 241 }, // STATUS_GRAPHICS_PARTIAL_DATA_POPULATED
+			{ 0x401E0307, 0x0035E5, 0x003604, 31, 55 }, // STATUS_GRAPHICS_MODE_NOT_PINNED
+			{ 0x401E031E, 0x00363B, 0x00365C, 33, 68 }, // STATUS_GRAPHICS_NO_PREFERRED_MODE
+			{ 0x401E034B, 0x0036A0, 0x0036C0, 32, 97 }, // STATUS_GRAPHICS_DATASET_IS_EMPTY
+			{ 0x401E034C, 0x003721, 0x00374C, 43, 123 }, // STATUS_GRAPHICS_NO_MORE_ELEMENTS_IN_DATASET
+			{ 0x401E0351, 0x0037C7, 0x003806, 63, 83 }, // STATUS_GRAPHICS_PATH_CONTENT_GEOMETRY_TRANSFORMATION_NOT_PINNED
+			{ 0x401E042F, 0x003859, 0x00387D, 36, 48 }, // STATUS_GRAPHICS_UNKNOWN_CHILD_STATUS
+			{ 0x401E0437, 0x0038AD, 0x0038D4, 39, 60 }, // STATUS_GRAPHICS_LEADLINK_START_DEFERRED
+			{ 0x401E0439, 0x003910, 0x003936, 38, 90 }, // STATUS_GRAPHICS_POLLING_TOO_FREQUENTLY
+			{ 0x401E043A, 0x003990, 0x0039AE, 30, 51 }, // STATUS_GRAPHICS_START_DEFERRED
+			{ 0x40230001, 0x0039E1, 0x003A00, 31, 62 }, // STATUS_NDIS_INDICATION_REQUIRED
+			{ 0x80000001, 0x003A3E, 0x003A59, 27, 137 }, // STATUS_GUARD_PAGE_VIOLATION
+			{ 0x80000002, 0x003AE2, 0x003AFE, 28, 96 }, // STATUS_DATATYPE_MISALIGNMENT
+			{ 0x80000003, 0x003B5E, 0x003B6F, 17, 53 }, // STATUS_BREAKPOINT
+			{ 0x80000004, 0x003BA4, 0x003BB6, 18, 81 }, // STATUS_SINGLE_STEP
+			{ 0x80000005, 0x003C07, 0x003C1D, 22, 74 }, // STATUS_BUFFER_OVERFLOW
+			{ 0x80000006, 0x003C67, 0x003C7B, 20, 76 }, // STATUS_NO_MORE_FILES
+			{ 0x80000007, 0x003CC7, 0x003CE2, 27, 76 }, // STATUS_WAKE_SYSTEM_DEBUGGER
+			{ 0x8000000A, 0x003D2E, 0x003D43, 21, 106 }, // STATUS_HANDLES_CLOSED
+			{ 0x8000000B, 0x003DAD, 0x003DC2, 21, 96 }, // STATUS_NO_INHERITANCE
+			{ 0x8000000C, 0x003E22, 0x003E3F, 29, 295 }, // STATUS_GUID_SUBSTITUTION_MADE
+			{ 0x8000000D, 0x003F66, 0x003F79, 19, 87 }, // STATUS_PARTIAL_COPY
+			{ 0x8000000E, 0x003FD0, 0x003FE9, 25, 43 }, // STATUS_DEVICE_PAPER_EMPTY
+			{ 0x8000000F, 0x004014, 0x00402D, 25, 60 }, // STATUS_DEVICE_POWERED_OFF
+			{ 0x80000010, 0x004069, 0x00407F, 22, 52 }, // STATUS_DEVICE_OFF_LINE
+			{ 0x80000011, 0x0040B3, 0x0040C5, 18, 43 }, // STATUS_DEVICE_BUSY
+			{ 0x80000012, 0x0040F0, 0x004102, 18, 72 }, // STATUS_NO_MORE_EAS
+			{ 0x80000013, 0x00414A, 0x004160, 22, 96 }, // STATUS_INVALID_EA_NAME
+			{ 0x80000014, 0x0041C0, 0x0041DB, 27, 72 }, // STATUS_EA_LIST_INCONSISTENT
+			{ 0x80000015, 0x004223, 0x004239, 22, 66 }, // STATUS_INVALID_EA_FLAG
+			{ 0x80000016, 0x00427B, 0x004291, 22, 173 }, // STATUS_VERIFY_REQUIRED
+			{ 0x80000017, 0x00433E, 0x00435B, 29, 108 }, // STATUS_EXTRANEOUS_INFORMATION
+			{ 0x80000018, 0x0043C7, 0x0043E4, 29, 272 }, // STATUS_RXACT_COMMIT_NECESSARY
+			{ 0x8000001A, 0x0044F4, 0x00450A, 22, 78 }, // STATUS_NO_MORE_ENTRIES
+			{ 0x8000001B, 0x004558, 0x004570, 24, 41 }, // STATUS_FILEMARK_DETECTED
+			{ 0x8000001C, 0x004599, 0x0045AD, 20, 43 }, // STATUS_MEDIA_CHANGED
+			{ 0x8000001D, 0x0045D8, 0x0045E8, 16, 46 }, // STATUS_BUS_RESET
+			{ 0x8000001E, 0x004616, 0x004629, 19, 52 }, // STATUS_END_OF_MEDIA
+			{ 0x8000001F, 0x00465D, 0x004676, 25, 49 }, // STATUS_BEGINNING_OF_MEDIA
+			{ 0x80000020, 0x0046A7, 0x0045AD, 18, 43 }, // STATUS_MEDIA_CHECK
+			{ 0x80000021, 0x0046B9, 0x0046D0, 23, 32 }, // STATUS_SETMARK_DETECTED
+			{ 0x80000022, 0x0046F0, 0x004707, 23, 61 }, // STATUS_NO_DATA_DETECTED
+			{ 0x80000023, 0x004744, 0x004766, 34, 48 }, // STATUS_REDIRECTOR_HAS_OPEN_HANDLES
+			{ 0x80000024, 0x004796, 0x0047B4, 30, 44 }, // STATUS_SERVER_HAS_OPEN_HANDLES
+			{ 0x80000025, 0x0047E0, 0x0047FB, 27, 55 }, // STATUS_ALREADY_DISCONNECTED
+			{ 0x80000026, 0x004832, 0x004841, 15, 30 }, // STATUS_LONGJUMP
+			{ 0x80000027, 0x00485F, 0x004881, 34, 51 }, // STATUS_CLEANER_CARTRIDGE_INSTALLED
+			{ 0x80000028, 0x0048B4, 0x0048D0, 28, 53 }, // STATUS_PLUGPLAY_QUERY_VETOED
+			{ 0x80000029, 0x004905, 0x00491E, 25, 40 }, // STATUS_UNWIND_CONSOLIDATE
+			{ 0x8000002A, 0x004946, 0x004964, 30, 124 }, // STATUS_REGISTRY_HIVE_RECOVERED
+			{ 0x8000002B, 0x0049E0, 0x0049FC, 28, 180 }, // STATUS_DLL_MIGHT_BE_INSECURE
+			{ 0x8000002C, 0x004AB0, 0x004AD0, 32, 236 }, // STATUS_DLL_MIGHT_BE_INCOMPATIBLE
+			{ 0x8000002D, 0x004BBC, 0x004BD5, 25, 60 }, // STATUS_STOPPED_ON_SYMLINK
+			{ 0x8000002E, 0x004C11, 0x004C35, 36, 97 }, // STATUS_CANNOT_GRANT_REQUESTED_OPLOCK
+			{ 0x8000002F, 0x004C96, 0x004CAD, 23, 89 }, // STATUS_NO_ACE_CONDITION
+			{ 0x80000288, 0x004D06, 0x004D25, 31, 52 }, // STATUS_DEVICE_REQUIRES_CLEANING
+			{ 0x80000289, 0x004D59, 0x004D70, 23, 98 }, // STATUS_DEVICE_DOOR_OPEN
+			{ 0x80000803, 0x004DD2, 0x004DE9, 23, 156 }, // STATUS_DATA_LOST_REPAIR
+			{ 0x80010001, 0x004E85, 0x004E9E, 25, 38 }, // DBG_EXCEPTION_NOT_HANDLED
+			{ 0x80130001, 0x004EC4, 0x004EE2, 30, 31 }, // STATUS_CLUSTER_NODE_ALREADY_UP
+			{ 0x80130002, 0x004F01, 0x004F21, 32, 33 }, // STATUS_CLUSTER_NODE_ALREADY_DOWN
+			{ 0x80130003, 0x004F42, 0x004F67, 37, 38 }, // STATUS_CLUSTER_NETWORK_ALREADY_ONLINE
+			{ 0x80130004, 0x004F8D, 0x004FB3, 38, 39 }, // STATUS_CLUSTER_NETWORK_ALREADY_OFFLINE
+			{ 0x80130005, 0x004FDA, 0x004FFC, 34, 52 }, // STATUS_CLUSTER_NODE_ALREADY_MEMBER
+			{ 0x80190009, 0x005030, 0x00504B, 27, 47 }, // STATUS_COULD_NOT_RESIZE_LOG
+			{ 0x80190029, 0x00507A, 0x005090, 22, 45 }, // STATUS_NO_TXF_METADATA
+			{ 0x80190031, 0x0050BD, 0x0050E1, 36, 71 }, // STATUS_CANT_RECOVER_WITH_HANDLE_OPEN
+			{ 0x80190041, 0x005128, 0x00514B, 35, 78 }, // STATUS_TXF_METADATA_ALREADY_PRESENT
+			{ 0x80190042, 0x005199, 0x0051C3, 42, 92 }, // STATUS_TRANSACTION_SCOPE_CALLBACKS_NOT_SET
+			{ 0x801B00EB, 0x00521F, 0x005250, 49, 135 }, // STATUS_VIDEO_HUNG_DISPLAY_DRIVER_THREAD_RECOVERED
+			{ 0x801C0001, 0x0052D7, 0x0052F2, 27, 111 }, // STATUS_FLT_BUFFER_TOO_SMALL
+			{ 0x80210001, 0x005361, 0x00537C, 27, 44 }, // STATUS_FVE_PARTIAL_METADATA
+			{ 0x80210002, 0x0053A8, 0x0053C2, 26, 83 }, // STATUS_FVE_TRANSIENT_STATE
+			{ 0x80370001, 0x005415, 0x005441, 44, 350 }, // STATUS_VID_REMOTE_NODE_PARENT_GPA_PAGES_USED
+			{ 0x80380001, 0x00559F, 0x0055C4, 37, 99 }, // STATUS_VOLMGR_INCOMPLETE_REGENERATION
+			{ 0x80380002, 0x005627, 0x00564E, 39, 134 }, // STATUS_VOLMGR_INCOMPLETE_DISK_MIGRATION
+			{ 0x80390001, 0x0056D4, 0x0056F7, 35, 64 }, // STATUS_BCD_NOT_ALL_ENTRIES_IMPORTED
+			{ 0x80390003, 0x005737, 0x00575E, 39, 67 }, // STATUS_BCD_NOT_ALL_ENTRIES_SYNCHRONIZED
+			{ 0x803A0001, 0x0057A1, 0x0057BB, 26, 60 }, // STATUS_QUERY_STORAGE_ERROR
+			{ 0xC0000001, 0x0057F7, 0x00580A, 19, 60 }, // STATUS_UNSUCCESSFUL
+			{ 0xC0000002, 0x005846, 0x00585C, 22, 61 }, // STATUS_NOT_IMPLEMENTED
+			{ 0xC0000003, 0x005899, 0x0058B2, 25, 110 }, // STATUS_INVALID_INFO_CLASS
+			{ 0xC0000004, 0x005920, 0x00593B, 27, 111 }, // STATUS_INFO_LENGTH_MISMATCH
+			{ 0xC0000005, 0x0059AA, 0x0059C1, 23, 84 }, // STATUS_ACCESS_VIOLATION
+			{ 0xC0000006, 0x005A15, 0x005A29, 20, 135 }, // STATUS_IN_PAGE_ERROR
+			{ 0xC0000007, 0x005AB0, 0x005AC5, 21, 54 }, // STATUS_PAGEFILE_QUOTA
+			{ 0xC0000008, 0x005AFB, 0x005B10, 21, 32 }, // STATUS_INVALID_HANDLE
+			{ 0xC0000009, 0x005B30, 0x005B48, 24, 67 }, // STATUS_BAD_INITIAL_STACK
+			{ 0xC000000A, 0x005B8B, 0x005BA0, 21, 75 }, // STATUS_BAD_INITIAL_PC
+			{ 0xC000000B, 0x005BEB, 0x005BFD, 18, 35 }, // STATUS_INVALID_CID
+			{ 0xC000000C, 0x005C20, 0x005C39, 25, 174 }, // STATUS_TIMER_NOT_CANCELED
+			{ 0xC000000D, 0x005CE7, 0x005CFF, 24, 57 }, // STATUS_INVALID_PARAMETER
+			{ 0xC000000E, 0x005D38, 0x005D4D, 21, 44 }, // STATUS_NO_SUCH_DEVICE
+			{ 0xC000000F, 0x005D79, 0x005D8C, 19, 45 }, // STATUS_NO_SUCH_FILE
+			{ 0xC0000010, 0x005DB9, 0x005DD6, 29, 69 }, // STATUS_INVALID_DEVICE_REQUEST
+			{ 0xC0000011, 0x005E1B, 0x005E2D, 18, 95 }, // STATUS_END_OF_FILE
+			{ 0xC0000012, 0x005E8C, 0x005E9F, 19, 89 }, // STATUS_WRONG_VOLUME
+			{ 0xC0000013, 0x005EF8, 0x005F11, 25, 77 }, // STATUS_NO_MEDIA_IN_DEVICE
+			{ 0xC0000014, 0x005F5E, 0x005F77, 25, 120 }, // STATUS_UNRECOGNIZED_MEDIA
+			{ 0xC0000015, 0x005FEF, 0x006008, 25, 55 }, // STATUS_NONEXISTENT_SECTOR
+			{ 0xC0000016, 0x00603F, 0x00605E, 31, 116 }, // STATUS_MORE_PROCESSING_REQUIRED
+			{ 0xC0000017, 0x0060D2, 0x0060E2, 16, 115 }, // STATUS_NO_MEMORY
+			{ 0xC0000018, 0x006155, 0x006171, 28, 89 }, // STATUS_CONFLICTING_ADDRESSES
+			{ 0xC0000019, 0x0061CA, 0x0061E0, 22, 44 }, // STATUS_NOT_MAPPED_VIEW
+			{ 0xC000001A, 0x00620C, 0x006224, 24, 31 }, // STATUS_UNABLE_TO_FREE_VM
+			{ 0xC000001B, 0x006243, 0x006262, 31, 36 }, // STATUS_UNABLE_TO_DELETE_SECTION
+			{ 0xC000001C, 0x006286, 0x0062A3, 29, 65 }, // STATUS_INVALID_SYSTEM_SERVICE
+			{ 0xC000001D, 0x0062E4, 0x0062FE, 26, 86 }, // STATUS_ILLEGAL_INSTRUCTION
+			{ 0xC000001E, 0x006354, 0x006370, 28, 80 }, // STATUS_INVALID_LOCK_SEQUENCE
+			{ 0xC000001F, 0x0063C0, 0x0063D8, 24, 102 }, // STATUS_INVALID_VIEW_SIZE
+			{ 0xC0000020, 0x00643E, 0x00645D, 31, 95 }, // STATUS_INVALID_FILE_FOR_SECTION
+			{ 0xC0000021, 0x0064BC, 0x0064D4, 24, 69 }, // STATUS_ALREADY_COMMITTED
+			{ 0xC0000022, 0x006519, 0x00652D, 20, 106 }, // STATUS_ACCESS_DENIED
+			{ 0xC0000023, 0x006597, 0x0065AE, 23, 111 }, // STATUS_BUFFER_TOO_SMALL
+			{ 0xC0000024, 0x00661D, 0x006638, 27, 152 }, // STATUS_OBJECT_TYPE_MISMATCH
+			{ 0xC0000025, 0x0066D0, 0x0066EF, 31, 72 }, // STATUS_NONCONTINUABLE_EXCEPTION
+			{ 0xC0000026, 0x006737, 0x006751, 26, 70 }, // STATUS_INVALID_DISPOSITION
+			{ 0xC0000027, 0x006797, 0x0067A4, 13, 22 }, // STATUS_UNWIND
+			{ 0xC0000028, 0x0067BA, 0x0067CA, 16, 73 }, // STATUS_BAD_STACK
+			{ 0xC0000029, 0x006813, 0x00682F, 28, 68 }, // STATUS_INVALID_UNWIND_TARGET
+			{ 0xC000002A, 0x006873, 0x006884, 17, 68 }, // STATUS_NOT_LOCKED
+			{ 0xC000002B, 0x0068C8, 0x0068DB, 19, 37 }, // STATUS_PARITY_ERROR
+			{ 0xC000002C, 0x006900, 0x00691C, 28, 59 }, // STATUS_UNABLE_TO_DECOMMIT_VM
+			{ 0xC000002D, 0x006957, 0x00696B, 20, 83 }, // STATUS_NOT_COMMITTED
+			{ 0xC000002E, 0x0069BE, 0x0069DC, 30, 105 }, // STATUS_INVALID_PORT_ATTRIBUTES
+			{ 0xC000002F, 0x006A45, 0x006A61, 28, 124 }, // STATUS_PORT_MESSAGE_TOO_LONG
+			{ 0xC0000030, 0x006ADD, 0x006AF9, 28, 51 }, // STATUS_INVALID_PARAMETER_MIX
+			{ 0xC0000031, 0x006B2C, 0x006B46, 26, 67 }, // STATUS_INVALID_QUOTA_LOWER
+			{ 0xC0000032, 0x006B89, 0x006BA2, 25, 126 }, // STATUS_DISK_CORRUPT_ERROR
+			{ 0xC0000033, 0x006C20, 0x006C3A, 26, 20 }, // STATUS_OBJECT_NAME_INVALID
+			{ 0xC0000034, 0x006C4E, 0x006C6A, 28, 22 }, // STATUS_OBJECT_NAME_NOT_FOUND
+			{ 0xC0000035, 0x006C80, 0x006C9C, 28, 27 }, // STATUS_OBJECT_NAME_COLLISION
+			{ 0xC0000037, 0x006CB7, 0x006CCF, 24, 63 }, // STATUS_PORT_DISCONNECTED
+			{ 0xC0000038, 0x006D0E, 0x006D2C, 30, 86 }, // STATUS_DEVICE_ALREADY_ATTACHED
+			{ 0xC0000039, 0x006D82, 0x006D9C, 26, 49 }, // STATUS_OBJECT_PATH_INVALID
+			{ 0xC000003A, 0x006DCD, 0x006DE9, 28, 45 }, // STATUS_OBJECT_PATH_NOT_FOUND
+			{ 0xC000003B, 0x006E16, 0x006D9C, 29, 49 }, // STATUS_OBJECT_PATH_SYNTAX_BAD
+			{ 0xC000003C, 0x006E33, 0x006E46, 19, 45 }, // STATUS_DATA_OVERRUN
+			{ 0xC000003D, 0x006E73, 0x006E89, 22, 39 }, // STATUS_DATA_LATE_ERROR
+			{ 0xC000003E, 0x006EB0, 0x006EC1, 17, 58 }, // STATUS_DATA_ERROR
+			{ 0xC000003F, 0x006EFB, 0x006F0B, 16, 66 }, // STATUS_CRC_ERROR
+			{ 0xC0000040, 0x006F4D, 0x006F63, 22, 69 }, // STATUS_SECTION_TOO_BIG
+			{ 0xC0000041, 0x006FA8, 0x006FC6, 30, 37 }, // STATUS_PORT_CONNECTION_REFUSED
+			{ 0xC0000042, 0x006FEB, 0x007005, 26, 63 }, // STATUS_INVALID_PORT_HANDLE
+			{ 0xC0000043, 0x007044, 0x00705C, 24, 72 }, // STATUS_SHARING_VIOLATION
+			{ 0xC0000044, 0x0070A4, 0x0070B9, 21, 51 }, // STATUS_QUOTA_EXCEEDED
+			{ 0xC0000045, 0x0070EC, 0x00710A, 30, 44 }, // STATUS_INVALID_PAGE_PROTECTION
+			{ 0xC0000046, 0x007136, 0x00714D, 23, 103 }, // STATUS_MUTANT_NOT_OWNED
+			{ 0xC0000047, 0x0071B4, 0x0071D3, 31, 96 }, // STATUS_SEMAPHORE_LIMIT_EXCEEDED
+			{ 0xC0000048, 0x007233, 0x00724A, 23, 293 }, // STATUS_PORT_ALREADY_SET
+			{ 0xC0000049, 0x00736F, 0x007387, 24, 88 }, // STATUS_SECTION_NOT_IMAGE
+			{ 0xC000004A, 0x0073DF, 0x0073FC, 29, 79 }, // STATUS_SUSPEND_COUNT_EXCEEDED
+			{ 0xC000004B, 0x00744B, 0x007467, 28, 66 }, // STATUS_THREAD_IS_TERMINATING
+			{ 0xC000004C, 0x0074A9, 0x0074C5, 28, 105 }, // STATUS_BAD_WORKING_SET_LIMIT
+			{ 0xC000004D, 0x00752E, 0x00754A, 28, 116 }, // STATUS_INCOMPATIBLE_FILE_MAP
+			{ 0xC000004E, 0x0075BE, 0x0075D7, 25, 100 }, // STATUS_SECTION_PROTECTION
+			{ 0xC000004F, 0x00763B, 0x007653, 24, 79 }, // STATUS_EAS_NOT_SUPPORTED
+			{ 0xC0000050, 0x0076A2, 0x0076B5, 19, 51 }, // STATUS_EA_TOO_LARGE
+			{ 0xC0000051, 0x0076E8, 0x007703, 27, 63 }, // STATUS_NONEXISTENT_EA_ENTRY
+			{ 0xC0000052, 0x007742, 0x007757, 21, 49 }, // STATUS_NO_EAS_ON_FILE
+			{ 0xC0000053, 0x007788, 0x00779F, 23, 35 }, // STATUS_EA_CORRUPT_ERROR
+			{ 0xC0000054, 0x0077C2, 0x0077DB, 25, 72 }, // STATUS_FILE_LOCK_CONFLICT
+			{ 0xC0000055, 0x007823, 0x00783A, 23, 68 }, // STATUS_LOCK_NOT_GRANTED
+			{ 0xC0000056, 0x00787E, 0x007893, 21, 80 }, // STATUS_DELETE_PENDING
+			{ 0xC0000057, 0x0078E3, 0x007900, 29, 118 }, // STATUS_CTL_FILE_NOT_SUPPORTED
+			{ 0xC0000058, 0x007976, 0x00798D, 23, 148 }, // STATUS_UNKNOWN_REVISION
+			{ 0xC0000059, 0x007A21, 0x007A39, 24, 47 }, // STATUS_REVISION_MISMATCH
+			{ 0xC000005A, 0x007A68, 0x007A7C, 20, 81 }, // STATUS_INVALID_OWNER
+			{ 0xC000005B, 0x007ACD, 0x007AE9, 28, 89 }, // STATUS_INVALID_PRIMARY_GROUP
+			{ 0xC000005C, 0x007B42, 0x007B5F, 29, 119 }, // STATUS_NO_IMPERSONATION_TOKEN
+			{ 0xC000005D, 0x007BD6, 0x007BF3, 29, 38 }, // STATUS_CANT_DISABLE_MANDATORY
+			{ 0xC000005E, 0x007C19, 0x007C30, 23, 76 }, // STATUS_NO_LOGON_SERVERS
+			{ 0xC000005F, 0x007C7C, 0x007C98, 28, 78 }, // STATUS_NO_SUCH_LOGON_SESSION
+			{ 0xC0000060, 0x007CE6, 0x007CFE, 24, 37 }, // STATUS_NO_SUCH_PRIVILEGE
+			{ 0xC0000061, 0x007D23, 0x007D3C, 25, 47 }, // STATUS_PRIVILEGE_NOT_HELD
+			{ 0xC0000062, 0x007D6B, 0x007D86, 27, 56 }, // STATUS_INVALID_ACCOUNT_NAME
+			{ 0xC0000063, 0x007DBE, 0x007DD0, 18, 37 }, // STATUS_USER_EXISTS
+			{ 0xC0000064, 0x007DF5, 0x007E08, 19, 37 }, // STATUS_NO_SUCH_USER
+			{ 0xC0000065, 0x007E2D, 0x007E40, 19, 35 }, // STATUS_GROUP_EXISTS
+			{ 0xC0000066, 0x007E63, 0x007E77, 20, 35 }, // STATUS_NO_SUCH_GROUP
+			{ 0xC0000067, 0x007E9A, 0x007EB0, 22, 147 }, // STATUS_MEMBER_IN_GROUP
+			{ 0xC0000068, 0x007F43, 0x007F5D, 26, 74 }, // STATUS_MEMBER_NOT_IN_GROUP
+			{ 0xC0000069, 0x007FA7, 0x007FB8, 17, 197 }, // STATUS_LAST_ADMIN
+			{ 0xC000006A, 0x00807D, 0x008092, 21, 126 }, // STATUS_WRONG_PASSWORD
+			{ 0xC000006B, 0x008110, 0x00812A, 26, 158 }, // STATUS_ILL_FORMED_PASSWORD
+			{ 0xC000006C, 0x0081C8, 0x0081E3, 27, 161 }, // STATUS_PASSWORD_RESTRICTION
+			{ 0xC000006D, 0x008284, 0x008298, 20, 99 }, // STATUS_LOGON_FAILURE
+			{ 0xC000006E, 0x0082FB, 0x008315, 26, 184 }, // STATUS_ACCOUNT_RESTRICTION
+			{ 0xC000006F, 0x0083CD, 0x0083E7, 26, 79 }, // STATUS_INVALID_LOGON_HOURS
+			{ 0xC0000070, 0x008436, 0x008450, 26, 98 }, // STATUS_INVALID_WORKSTATION
+			{ 0xC0000071, 0x0084B2, 0x0084C9, 23, 40 }, // STATUS_PASSWORD_EXPIRED
+			{ 0xC0000072, 0x0084F1, 0x008508, 23, 73 }, // STATUS_ACCOUNT_DISABLED
+			{ 0xC0000073, 0x008551, 0x008563, 18, 61 }, // STATUS_NONE_MAPPED
+			{ 0xC0000074, 0x0085A0, 0x0085BF, 31, 76 }, // STATUS_TOO_MANY_LUIDS_REQUESTED
+			{ 0xC0000075, 0x00860B, 0x008621, 22, 46 }, // STATUS_LUIDS_EXHAUSTED
+			{ 0xC0000076, 0x00864F, 0x00866B, 28, 68 }, // STATUS_INVALID_SUB_AUTHORITY
+			{ 0xC0000077, 0x0086AF, 0x0086C1, 18, 41 }, // STATUS_INVALID_ACL
+			{ 0xC0000078, 0x0086EA, 0x0086FC, 18, 41 }, // STATUS_INVALID_SID
+			{ 0xC0000079, 0x008725, 0x008742, 29, 57 }, // STATUS_INVALID_SECURITY_DESCR
+			{ 0xC000007A, 0x00877B, 0x008795, 26, 69 }, // STATUS_PROCEDURE_NOT_FOUND
+			{ 0xC000007B, 0x0087DA, 0x0087F5, 27, 225 }, // STATUS_INVALID_IMAGE_FORMAT
+			{ 0xC000007C, 0x0088D6, 0x0088E5, 15, 180 }, // STATUS_NO_TOKEN
+			{ 0xC000007D, 0x008999, 0x0089B3, 26, 242 }, // STATUS_BAD_INHERITANCE_ACL
+			{ 0xC000007E, 0x008AA5, 0x008ABC, 23, 51 }, // STATUS_RANGE_NOT_LOCKED
+			{ 0xC000007F, 0x008AEF, 0x008AFF, 16, 46 }, // STATUS_DISK_FULL
+			{ 0xC0000080, 0x008B2D, 0x008B43, 22, 63 }, // STATUS_SERVER_DISABLED
+			{ 0xC0000081, 0x008B82, 0x008B9C, 26, 62 }, // STATUS_SERVER_NOT_DISABLED
+			{ 0xC0000082, 0x008BDA, 0x008BF9, 31, 65 }, // STATUS_TOO_MANY_GUIDS_REQUESTED
+			{ 0xC0000083, 0x008C3A, 0x008C50, 22, 75 }, // STATUS_GUIDS_EXHAUSTED
+			{ 0xC0000084, 0x008C9B, 0x008CB6, 27, 68 }, // STATUS_INVALID_ID_AUTHORITY
+			{ 0xC0000085, 0x008CFA, 0x008D11, 23, 92 }, // STATUS_AGENTS_EXHAUSTED
+			{ 0xC0000086, 0x008D6D, 0x008D88, 27, 43 }, // STATUS_INVALID_VOLUME_LABEL
+			{ 0xC0000087, 0x008DB3, 0x008DCE, 27, 39 }, // STATUS_SECTION_NOT_EXTENDED
+			{ 0xC0000088, 0x008DF5, 0x008E0B, 22, 52 }, // STATUS_NOT_MAPPED_DATA
+			{ 0xC0000089, 0x008E3F, 0x008E5D, 30, 70 }, // STATUS_RESOURCE_DATA_NOT_FOUND
+			{ 0xC000008A, 0x008EA3, 0x008EC1, 30, 72 }, // STATUS_RESOURCE_TYPE_NOT_FOUND
+			{ 0xC000008B, 0x008F09, 0x008F27, 30, 72 }, // STATUS_RESOURCE_NAME_NOT_FOUND
+			{ 0xC000008C, 0x008F6F, 0x008F8B, 28, 34 }, // STATUS_ARRAY_BOUNDS_EXCEEDED
+			{ 0xC000008D, 0x008FAD, 0x008FCA, 29, 44 }, // STATUS_FLOAT_DENORMAL_OPERAND
+			{ 0xC000008E, 0x008FF6, 0x009011, 27, 44 }, // STATUS_FLOAT_DIVIDE_BY_ZERO
+			{ 0xC000008F, 0x00903D, 0x009058, 27, 42 }, // STATUS_FLOAT_INEXACT_RESULT
+			{ 0xC0000090, 0x009082, 0x0090A0, 30, 45 }, // STATUS_FLOAT_INVALID_OPERATION
+			{ 0xC0000091, 0x0090CD, 0x0090E2, 21, 36 }, // STATUS_FLOAT_OVERFLOW
+			{ 0xC0000092, 0x009106, 0x00911E, 24, 39 }, // STATUS_FLOAT_STACK_CHECK
+			{ 0xC0000093, 0x009145, 0x00915B, 22, 37 }, // STATUS_FLOAT_UNDERFLOW
+			{ 0xC0000094, 0x009180, 0x00919D, 29, 37 }, // STATUS_INTEGER_DIVIDE_BY_ZERO
+			{ 0xC0000095, 0x0091C2, 0x0091D9, 23, 29 }, // STATUS_INTEGER_OVERFLOW
+			{ 0xC0000096, 0x0091F6, 0x009213, 29, 35 }, // STATUS_PRIVILEGED_INSTRUCTION
+			{ 0xC0000097, 0x009236, 0x009252, 28, 74 }, // STATUS_TOO_MANY_PAGING_FILES
+			{ 0xC0000098, 0x00929C, 0x0092AF, 19, 95 }, // STATUS_FILE_INVALID
+			{ 0xC0000099, 0x00930E, 0x00932C, 30, 516 }, // STATUS_ALLOTTED_SPACE_EXCEEDED
+			{ 0xC000009A, 0x009530, 0x00954D, 29, 56 }, // STATUS_INSUFFICIENT_RESOURCES
+			{ 0xC000009B, 0x009585, 0x00959F, 26, 62 }, // STATUS_DFS_EXIT_PATH_FOUND
+			{ 0xC000009C, 0x0095DD, 0x0095DD, 24, 24 }, // STATUS_DEVICE_DATA_ERROR
+			{ 0xC000009D, 0x0095F5, 0x0095F5, 27, 27 }, // STATUS_DEVICE_NOT_CONNECTED
+			{ 0xC000009E, 0x009610, 0x009610, 27, 27 }, // STATUS_DEVICE_POWER_FAILURE
+			{ 0xC000009F, 0x00962B, 0x009645, 26, 117 }, // STATUS_FREE_VM_NOT_AT_BASE
+			{ 0xC00000A0, 0x0096BA, 0x0096D5, 27, 66 }, // STATUS_MEMORY_NOT_ALLOCATED
+			{ 0xC00000A1, 0x009717, 0x00972F, 24, 76 }, // STATUS_WORKING_SET_QUOTA
+			{ 0xC00000A2, 0x00977B, 0x009797, 28, 151 }, // STATUS_MEDIA_WRITE_PROTECTED
+			{ 0xC00000A3, 0x00982E, 0x009845, 23, 167 }, // STATUS_DEVICE_NOT_READY
+			{ 0xC00000A4, 0x0098EC, 0x00990B, 31, 99 }, // STATUS_INVALID_GROUP_ATTRIBUTES
+			{ 0xC00000A5, 0x00996E, 0x00998C, 30, 114 }, // STATUS_BAD_IMPERSONATION_LEVEL
+			{ 0xC00000A6, 0x0099FE, 0x009A18, 26, 89 }, // STATUS_CANT_OPEN_ANONYMOUS
+			{ 0xC00000A7, 0x009A71, 0x009A8C, 27, 55 }, // STATUS_BAD_VALIDATION_CLASS
+			{ 0xC00000A8, 0x009AC3, 0x009AD8, 21, 66 }, // STATUS_BAD_TOKEN_TYPE
+			{ 0xC00000A9, 0x009B1A, 0x009AD8, 29, 66 }, // STATUS_BAD_MASTER_BOOT_RECORD
+			{ 0xC00000AA, 0x009B37, 0x009B56, 31, 140 }, // STATUS_INSTRUCTION_MISALIGNMENT
+			{ 0xC00000AB, 0x009BE2, 0x009BFF, 29, 55 }, // STATUS_INSTANCE_NOT_AVAILABLE
+			{ 0xC00000AC, 0x009C36, 0x009C4F, 25, 67 }, // STATUS_PIPE_NOT_AVAILABLE
+			{ 0xC00000AD, 0x009C92, 0x009CAB, 25, 56 }, // STATUS_INVALID_PIPE_STATE
+			{ 0xC00000AE, 0x009CE3, 0x009CF3, 16, 137 }, // STATUS_PIPE_BUSY
+			{ 0xC00000AF, 0x009D7C, 0x009D93, 23, 69 }, // STATUS_ILLEGAL_FUNCTION
+			{ 0xC00000B0, 0x009DD8, 0x009DF0, 24, 54 }, // STATUS_PIPE_DISCONNECTED
+			{ 0xC00000B1, 0x009E26, 0x009E39, 19, 49 }, // STATUS_PIPE_CLOSING
+			{ 0xC00000B2, 0x009E6A, 0x009E7F, 21, 51 }, // STATUS_PIPE_CONNECTED
+			{ 0xC00000B3, 0x009EB2, 0x009EC7, 21, 51 }, // STATUS_PIPE_LISTENING
+			{ 0xC00000B4, 0x009EFA, 0x009F12, 24, 48 }, // STATUS_INVALID_READ_MODE
+			{ 0xC00000B5, 0x009F42, 0x009F53, 17, 105 }, // STATUS_IO_TIMEOUT
+			{ 0xC00000B6, 0x009FBC, 0x009FD5, 25, 54 }, // STATUS_FILE_FORCED_CLOSED
+			{ 0xC00000B7, 0x00A00B, 0x00A027, 28, 22 }, // STATUS_PROFILING_NOT_STARTED
+			{ 0xC00000B8, 0x00A03D, 0x00A059, 28, 22 }, // STATUS_PROFILING_NOT_STOPPED
+			{ 0xC00000B9, 0x00A06F, 0x00A089, 26, 64 }, // STATUS_COULD_NOT_INTERPRET
+			{ 0xC00000BA, 0x00A0C9, 0x00A0E3, 26, 122 }, // STATUS_FILE_IS_A_DIRECTORY
+			{ 0xC00000BB, 0x00A15D, 0x00A171, 20, 29 }, // STATUS_NOT_SUPPORTED
+			{ 0xC00000BC, 0x00A18E, 0x00A1A9, 27, 38 }, // STATUS_REMOTE_NOT_LISTENING
+			{ 0xC00000BD, 0x00A1CF, 0x00A1E4, 21, 39 }, // STATUS_DUPLICATE_NAME
+			{ 0xC00000BE, 0x00A20B, 0x00A222, 23, 35 }, // STATUS_BAD_NETWORK_PATH
+			{ 0xC00000BF, 0x00A245, 0x00A258, 19, 20 }, // STATUS_NETWORK_BUSY
+			{ 0xC00000C0, 0x00A26C, 0x00A288, 28, 27 }, // STATUS_DEVICE_DOES_NOT_EXIST
+			{ 0xC00000C1, 0x00A2A3, 0x00A2BB, 24, 48 }, // STATUS_TOO_MANY_COMMANDS
+			{ 0xC00000C2, 0x00A2EB, 0x00A308, 29, 43 }, // STATUS_ADAPTER_HARDWARE_ERROR
+			{ 0xC00000C3, 0x00A333, 0x00A352, 31, 34 }, // STATUS_INVALID_NETWORK_RESPONSE
+			{ 0xC00000C4, 0x00A374, 0x00A393, 31, 37 }, // STATUS_UNEXPECTED_NETWORK_ERROR
+			{ 0xC00000C5, 0x00A3B8, 0x00A3D1, 25, 37 }, // STATUS_BAD_REMOTE_ADAPTER
+			{ 0xC00000C6, 0x00A3F6, 0x00A40D, 23, 26 }, // STATUS_PRINT_QUEUE_FULL
+			{ 0xC00000C7, 0x00A427, 0x00A43C, 21, 77 }, // STATUS_NO_SPOOL_SPACE
+			{ 0xC00000C8, 0x00A489, 0x00A49F, 22, 43 }, // STATUS_PRINT_CANCELLED
+			{ 0xC00000C9, 0x00A4CA, 0x00A4E5, 27, 29 }, // STATUS_NETWORK_NAME_DELETED
+			{ 0xC00000CA, 0x00A502, 0x00A51E, 28, 25 }, // STATUS_NETWORK_ACCESS_DENIED
+			{ 0xC00000CB, 0x00A537, 0x00A54D, 22, 140 }, // STATUS_BAD_DEVICE_TYPE
+			{ 0xC00000CC, 0x00A5D9, 0x00A5F0, 23, 87 }, // STATUS_BAD_NETWORK_NAME
+			{ 0xC00000CD, 0x00A647, 0x00A65C, 21, 72 }, // STATUS_TOO_MANY_NAMES
+			{ 0xC00000CE, 0x00A6A4, 0x00A6BC, 24, 44 }, // STATUS_TOO_MANY_SESSIONS
+			{ 0xC00000CF, 0x00A6E8, 0x00A6FD, 21, 41 }, // STATUS_SHARING_PAUSED
+			{ 0xC00000D0, 0x00A726, 0x00A741, 27, 142 }, // STATUS_REQUEST_NOT_ACCEPTED
+			{ 0xC00000D1, 0x00A7CF, 0x00A7E7, 24, 48 }, // STATUS_REDIRECTOR_PAUSED
+			{ 0xC00000D2, 0x00A817, 0x00A82D, 22, 30 }, // STATUS_NET_WRITE_FAULT
+			{ 0xC00000D3, 0x00A84B, 0x00A864, 25, 84 }, // STATUS_PROFILING_AT_LIMIT
+			{ 0xC00000D4, 0x00A8B8, 0x00A8CE, 22, 126 }, // STATUS_NOT_SAME_DEVICE
+			{ 0xC00000D5, 0x00A94C, 0x00A95F, 19, 64 }, // STATUS_FILE_RENAMED
+			{ 0xC00000D6, 0x00A99F, 0x00A9BC, 29, 137 }, // STATUS_VIRTUAL_CIRCUIT_CLOSED
+			{ 0xC00000D7, 0x00AA45, 0x00AA61, 28, 117 }, // STATUS_NO_SECURITY_ON_OBJECT
+			{ 0xC00000D8, 0x00AAD6, 0x00AAE6, 16, 76 }, // STATUS_CANT_WAIT
+			{ 0xC00000D9, 0x00AB32, 0x00AB43, 17, 65 }, // STATUS_PIPE_EMPTY
+			{ 0xC00000DA, 0x00AB84, 0x00ABA2, 30, 141 }, // STATUS_CANT_ACCESS_DOMAIN_INFO
+			{ 0xC00000DB, 0x00AC2F, 0x00AC49, 26, 152 }, // STATUS_CANT_TERMINATE_SELF
+			{ 0xC00000DC, 0x00ACE1, 0x00ACFC, 27, 81 }, // STATUS_INVALID_SERVER_STATE
+			{ 0xC00000DD, 0x00AD4D, 0x00AD68, 27, 77 }, // STATUS_INVALID_DOMAIN_STATE
+			{ 0xC00000DE, 0x00ADB5, 0x00ADCF, 26, 79 }, // STATUS_INVALID_DOMAIN_ROLE
+			{ 0xC00000DF, 0x00AE1E, 0x00AE33, 21, 35 }, // STATUS_NO_SUCH_DOMAIN
+			{ 0xC00000E0, 0x00AE56, 0x00AE6A, 20, 36 }, // STATUS_DOMAIN_EXISTS
+			{ 0xC00000E1, 0x00AE8E, 0x00AEAA, 28, 93 }, // STATUS_DOMAIN_LIMIT_EXCEEDED
+			{ 0xC00000E2, 0x00AF07, 0x00AF20, 25, 52 }, // STATUS_OPLOCK_NOT_GRANTED
+			{ 0xC00000E3, 0x00AF54, 0x00AF72, 30, 89 }, // STATUS_INVALID_OPLOCK_PROTOCOL
+			{ 0xC00000E4, 0x00AFCB, 0x00AFE8, 29, 143 }, // STATUS_INTERNAL_DB_CORRUPTION
+			{ 0xC00000E5, 0x00B077, 0x00B08C, 21, 27 }, // STATUS_INTERNAL_ERROR
+			{ 0xC00000E6, 0x00B0A7, 0x00B0C0, 25, 123 }, // STATUS_GENERIC_NOT_MAPPED
+			{ 0xC00000E7, 0x00B13B, 0x00B157, 28, 91 }, // STATUS_BAD_DESCRIPTOR_FORMAT
+			{ 0xC00000E8, 0x00B1B2, 0x00B1CC, 26, 166 }, // STATUS_INVALID_USER_BUFFER
+			{ 0xC00000E9, 0x00B272, 0x00B28C, 26, 245 }, // STATUS_UNEXPECTED_IO_ERROR
+			{ 0xC00000EA, 0x00B381, 0x00B3A0, 31, 252 }, // STATUS_UNEXPECTED_MM_CREATE_ERR
+			{ 0xC00000EB, 0x00B49C, 0x00B3A0, 30, 252 }, // STATUS_UNEXPECTED_MM_MAP_ERROR
+			{ 0xC00000EC, 0x00B4BA, 0x00B3A0, 31, 252 }, // STATUS_UNEXPECTED_MM_EXTEND_ERR
+			{ 0xC00000ED, 0x00B4D9, 0x00B4F1, 24, 126 }, // STATUS_NOT_LOGON_PROCESS
+			{ 0xC00000EE, 0x00B56F, 0x00B58A, 27, 111 }, // STATUS_LOGON_SESSION_EXISTS
+			{ 0xC00000EF, 0x00B5F9, 0x00B613, 26, 79 }, // STATUS_INVALID_PARAMETER_1
+			{ 0xC00000F0, 0x00B662, 0x00B67C, 26, 80 }, // STATUS_INVALID_PARAMETER_2
+			{ 0xC00000F1, 0x00B6CC, 0x00B6E6, 26, 79 }, // STATUS_INVALID_PARAMETER_3
+			{ 0xC00000F2, 0x00B735, 0x00B74F, 26, 80 }, // STATUS_INVALID_PARAMETER_4
+			{ 0xC00000F3, 0x00B79F, 0x00B7B9, 26, 79 }, // STATUS_INVALID_PARAMETER_5
+			{ 0xC00000F4, 0x00B808, 0x00B822, 26, 79 }, // STATUS_INVALID_PARAMETER_6
+			{ 0xC00000F5, 0x00B871, 0x00B88B, 26, 81 }, // STATUS_INVALID_PARAMETER_7
+			{ 0xC00000F6, 0x00B8DC, 0x00B8F6, 26, 80 }, // STATUS_INVALID_PARAMETER_8
+			{ 0xC00000F7, 0x00B946, 0x00B960, 26, 79 }, // STATUS_INVALID_PARAMETER_9
+			{ 0xC00000F8, 0x00B9AF, 0x00B9CA, 27, 79 }, // STATUS_INVALID_PARAMETER_10
+			{ 0xC00000F9, 0x00BA19, 0x00BA34, 27, 82 }, // STATUS_INVALID_PARAMETER_11
+			{ 0xC00000FA, 0x00BA86, 0x00BAA1, 27, 81 }, // STATUS_INVALID_PARAMETER_12
+			{ 0xC00000FB, 0x00BAF2, 0x00BB0F, 29, 91 }, // STATUS_REDIRECTOR_NOT_STARTED
+			{ 0xC00000FC, 0x00BB6A, 0x00BB83, 25, 89 }, // STATUS_REDIRECTOR_STARTED
+			{ 0xC00000FD, 0x00BBDC, 0x00BBF1, 21, 49 }, // STATUS_STACK_OVERFLOW
+			{ 0xC00000FE, 0x00BC22, 0x00BC38, 22, 46 }, // STATUS_NO_SUCH_PACKAGE
+			{ 0xC00000FF, 0x00BC66, 0x00BC7F, 25, 70 }, // STATUS_BAD_FUNCTION_TABLE
+			{ 0xC0000100, 0x00BCC5, 0x00BCDE, 25, 99 }, // STATUS_VARIABLE_NOT_FOUND
+			{ 0xC0000101, 0x00BD41, 0x00BD5B, 26, 63 }, // STATUS_DIRECTORY_NOT_EMPTY
+			{ 0xC0000102, 0x00BD9A, 0x00BDB3, 25, 98 }, // STATUS_FILE_CORRUPT_ERROR
+			{ 0xC0000103, 0x00BE15, 0x00BE2B, 22, 43 }, // STATUS_NOT_A_DIRECTORY
+			{ 0xC0000104, 0x00BE56, 0x00BE74, 30, 84 }, // STATUS_BAD_LOGON_SESSION_STATE
+			{ 0xC0000105, 0x00BEC8, 0x00BEE6, 30, 175 }, // STATUS_LOGON_SESSION_COLLISION
+			{ 0xC0000106, 0x00BF95, 0x00BFA9, 20, 57 }, // STATUS_NAME_TOO_LONG
+			{ 0xC0000107, 0x00BFE2, 0x00BFF3, 17, 166 }, // STATUS_FILES_OPEN
+			{ 0xC0000108, 0x00C099, 0x00C0B1, 24, 172 }, // STATUS_CONNECTION_IN_USE
+			{ 0xC0000109, 0x00C15D, 0x00C175, 24, 87 }, // STATUS_MESSAGE_NOT_FOUND
+			{ 0xC000010A, 0x00C1CC, 0x00C1E9, 29, 49 }, // STATUS_PROCESS_IS_TERMINATING
+			{ 0xC000010B, 0x00C21A, 0x00C233, 25, 73 }, // STATUS_INVALID_LOGON_TYPE
+			{ 0xC000010C, 0x00C27C, 0x00C296, 26, 307 }, // STATUS_NO_GUID_TRANSLATION
+			{ 0xC000010D, 0x00C3C9, 0x00C3E2, 25, 104 }, // STATUS_CANNOT_IMPERSONATE
+			{ 0xC000010E, 0x00C44A, 0x00C465, 27, 53 }, // STATUS_IMAGE_ALREADY_LOADED
+			{ 0xC000010F, 0x00C49A, 0x00C49A, 24, 24 }, // STATUS_ABIOS_NOT_PRESENT
+			{ 0xC0000110, 0x00C4B2, 0x00C4B2, 26, 26 }, // STATUS_ABIOS_LID_NOT_EXIST
+			{ 0xC0000111, 0x00C4CC, 0x00C4CC, 30, 30 }, // STATUS_ABIOS_LID_ALREADY_OWNED
+			{ 0xC0000112, 0x00C4EA, 0x00C4EA, 26, 26 }, // STATUS_ABIOS_NOT_LID_OWNER
+			{ 0xC0000113, 0x00C504, 0x00C504, 28, 28 }, // STATUS_ABIOS_INVALID_COMMAND
+			{ 0xC0000114, 0x00C520, 0x00C520, 24, 24 }, // STATUS_ABIOS_INVALID_LID
+			{ 0xC0000115, 0x00C538, 0x00C538, 35, 35 }, // STATUS_ABIOS_SELECTOR_NOT_AVAILABLE
+			{ 0xC0000116, 0x00C55B, 0x00C55B, 29, 29 }, // STATUS_ABIOS_INVALID_SELECTOR
+			{ 0xC0000117, 0x00C578, 0x00C585, 13, 95 }, // STATUS_NO_LDT
+			{ 0xC0000118, 0x00C5E4, 0x00C5FB, 23, 124 }, // STATUS_INVALID_LDT_SIZE
+			{ 0xC0000119, 0x00C677, 0x00C690, 25, 108 }, // STATUS_INVALID_LDT_OFFSET
+			{ 0xC000011A, 0x00C6FC, 0x00C719, 29, 93 }, // STATUS_INVALID_LDT_DESCRIPTOR
+			{ 0xC000011B, 0x00C776, 0x00C794, 30, 85 }, // STATUS_INVALID_IMAGE_NE_FORMAT
+			{ 0xC000011C, 0x00C7E9, 0x00C803, 26, 288 }, // STATUS_RXACT_INVALID_STATE
+			{ 0xC000011D, 0x00C923, 0x00C93E, 27, 206 }, // STATUS_RXACT_COMMIT_FAILURE
+			{ 0xC000011E, 0x00CA0C, 0x00CA28, 28, 87 }, // STATUS_MAPPED_FILE_SIZE_ZERO
+			{ 0xC000011F, 0x00CA7F, 0x00CA9B, 28, 125 }, // STATUS_TOO_MANY_OPENED_FILES
+			{ 0xC0000120, 0x00CB18, 0x00CB28, 16, 29 }, // STATUS_CANCELLED
+			{ 0xC0000121, 0x00CB45, 0x00CB59, 20, 78 }, // STATUS_CANNOT_DELETE
+			{ 0xC0000122, 0x00CBA7, 0x00CBC3, 28, 78 }, // STATUS_INVALID_COMPUTER_NAME
+			{ 0xC0000123, 0x00CC11, 0x00CC24, 19, 187 }, // STATUS_FILE_DELETED
+			{ 0xC0000124, 0x00CCDF, 0x00CCF5, 22, 173 }, // STATUS_SPECIAL_ACCOUNT
+			{ 0xC0000125, 0x00CDA2, 0x00CDB6, 20, 107 }, // STATUS_SPECIAL_GROUP
+			{ 0xC0000126, 0x00CE21, 0x00CE34, 19, 105 }, // STATUS_SPECIAL_USER
+			{ 0xC0000127, 0x00CE9D, 0x00CEB9, 28, 108 }, // STATUS_MEMBERS_PRIMARY_GROUP
+			{ 0xC0000128, 0x00CF25, 0x00CF37, 18, 137 }, // STATUS_FILE_CLOSED
+			{ 0xC0000129, 0x00CFC0, 0x00CFD7, 23, 178 }, // STATUS_TOO_MANY_THREADS
+			{ 0xC000012A, 0x00D089, 0x00D0A5, 28, 127 }, // STATUS_THREAD_NOT_IN_PROCESS
+			{ 0xC000012B, 0x00D124, 0x00D13F, 27, 164 }, // STATUS_TOKEN_ALREADY_IN_USE
+			{ 0xC000012C, 0x00D1E3, 0x00D201, 30, 29 }, // STATUS_PAGEFILE_QUOTA_EXCEEDED
+			{ 0xC000012D, 0x00D21E, 0x00D235, 23, 185 }, // STATUS_COMMITMENT_LIMIT
+			{ 0xC000012E, 0x00D2EE, 0x00D30C, 30, 85 }, // STATUS_INVALID_IMAGE_LE_FORMAT
+			{ 0xC000012F, 0x00D361, 0x00D37C, 27, 88 }, // STATUS_INVALID_IMAGE_NOT_MZ
+			{ 0xC0000130, 0x00D3D4, 0x00D3F0, 28, 109 }, // STATUS_INVALID_IMAGE_PROTECT
+			{ 0xC0000131, 0x00D45D, 0x00D478, 27, 98 }, // STATUS_INVALID_IMAGE_WIN_16
+			{ 0xC0000132, 0x00D4DA, 0x00D4F6, 28, 123 }, // STATUS_LOGON_SERVER_CONFLICT
+			{ 0xC0000133, 0x00D571, 0x00D58D, 28, 141 }, // STATUS_TIME_DIFFERENCE_AT_DC
+			{ 0xC0000134, 0x00D61A, 0x00D639, 31, 156 }, // STATUS_SYNCHRONIZATION_REQUIRED
+			{ 0xC0000135, 0x00D6D5, 0x00D6E9, 20, 116 }, // STATUS_DLL_NOT_FOUND
+			{ 0xC0000136, 0x00D75D, 0x00D76F, 18, 190 }, // STATUS_OPEN_FAILED
+			{ 0xC0000137, 0x00D82D, 0x00D847, 26, 76 }, // STATUS_IO_PRIVILEGE_FAILED
+			{ 0xC0000138, 0x00D893, 0x00D8AB, 24, 89 }, // STATUS_ORDINAL_NOT_FOUND
+			{ 0xC0000139, 0x00D904, 0x00D91F, 27, 107 }, // STATUS_ENTRYPOINT_NOT_FOUND
+			{ 0xC000013A, 0x00D98A, 0x00D99F, 21, 80 }, // STATUS_CONTROL_C_EXIT
+			{ 0xC000013B, 0x00D9EF, 0x00DA06, 23, 146 }, // STATUS_LOCAL_DISCONNECT
+			{ 0xC000013C, 0x00DA98, 0x00DAB0, 24, 150 }, // STATUS_REMOTE_DISCONNECT
+			{ 0xC000013D, 0x00DB46, 0x00DB5D, 23, 240 }, // STATUS_REMOTE_RESOURCES
+			{ 0xC000013E, 0x00DC4D, 0x00DC5F, 18, 222 }, // STATUS_LINK_FAILED
+			{ 0xC000013F, 0x00DD3D, 0x00DD50, 19, 168 }, // STATUS_LINK_TIMEOUT
+			{ 0xC0000140, 0x00DDF8, 0x00DE11, 25, 57 }, // STATUS_INVALID_CONNECTION
+			{ 0xC0000141, 0x00DE4A, 0x00DE60, 22, 54 }, // STATUS_INVALID_ADDRESS
+			{ 0xC0000142, 0x00DE96, 0x00DEAC, 22, 121 }, // STATUS_DLL_INIT_FAILED
+			{ 0xC0000143, 0x00DF25, 0x00DF3E, 25, 69 }, // STATUS_MISSING_SYSTEMFILE
+			{ 0xC0000144, 0x00DF83, 0x00DF9D, 26, 95 }, // STATUS_UNHANDLED_EXCEPTION
+			{ 0xC0000145, 0x00DFFC, 0x00E013, 23, 109 }, // STATUS_APP_INIT_FAILURE
+			{ 0xC0000146, 0x00E080, 0x00E09D, 29, 108 }, // STATUS_PAGEFILE_CREATE_FAILED
+			{ 0xC0000147, 0x00E109, 0x00E11B, 18, 84 }, // STATUS_NO_PAGEFILE
+			{ 0xC0000148, 0x00E16F, 0x00E183, 20, 89 }, // STATUS_INVALID_LEVEL
+			{ 0xC0000149, 0x00E1DC, 0x00E1F6, 26, 117 }, // STATUS_WRONG_PASSWORD_CORE
+			{ 0xC000014A, 0x00E26B, 0x00E287, 28, 115 }, // STATUS_ILLEGAL_FLOAT_CONTEXT
+			{ 0xC000014B, 0x00E2FA, 0x00E30C, 18, 80 }, // STATUS_PIPE_BROKEN
+			{ 0xC000014C, 0x00E35C, 0x00E373, 23, 238 }, // STATUS_REGISTRY_CORRUPT
+			{ 0xC000014D, 0x00E461, 0x00E47A, 25, 186 }, // STATUS_REGISTRY_IO_FAILED
+			{ 0xC000014E, 0x00E534, 0x00E548, 20, 169 }, // STATUS_NO_EVENT_PAIR
+			{ 0xC000014F, 0x00E5F1, 0x00E60B, 26, 155 }, // STATUS_UNRECOGNIZED_VOLUME
+			{ 0xC0000150, 0x00E6A6, 0x00E6C4, 30, 77 }, // STATUS_SERIAL_NO_DEVICE_INITED
+			{ 0xC0000151, 0x00E711, 0x00E725, 20, 41 }, // STATUS_NO_SUCH_ALIAS
+			{ 0xC0000152, 0x00E74E, 0x00E768, 26, 56 }, // STATUS_MEMBER_NOT_IN_ALIAS
+			{ 0xC0000153, 0x00E7A0, 0x00E7B6, 22, 60 }, // STATUS_MEMBER_IN_ALIAS
+			{ 0xC0000154, 0x00E7F2, 0x00E805, 19, 41 }, // STATUS_ALIAS_EXISTS
+			{ 0xC0000155, 0x00E82E, 0x00E846, 24, 198 }, // STATUS_LOGON_NOT_GRANTED
+			{ 0xC0000156, 0x00E90C, 0x00E923, 23, 193 }, // STATUS_TOO_MANY_SECRETS
+			{ 0xC0000157, 0x00E9E4, 0x00E9FA, 22, 165 }, // STATUS_SECRET_TOO_LONG
+			{ 0xC0000158, 0x00EA9F, 0x00EAB7, 24, 79 }, // STATUS_INTERNAL_DB_ERROR
+			{ 0xC0000159, 0x00EB06, 0x00EB1C, 22, 63 }, // STATUS_FULLSCREEN_MODE
+			{ 0xC000015A, 0x00EB5B, 0x00EB76, 27, 248 }, // STATUS_TOO_MANY_CONTEXT_IDS
+			{ 0xC000015B, 0x00EC6E, 0x00EC8B, 29, 181 }, // STATUS_LOGON_TYPE_NOT_GRANTED
+			{ 0xC000015C, 0x00ED40, 0x00ED58, 24, 133 }, // STATUS_NOT_REGISTRY_FILE
+			{ 0xC000015D, 0x00EDDD, 0x00EE00, 35, 143 }, // STATUS_NT_CROSS_ENCRYPTION_REQUIRED
+			{ 0xC000015E, 0x00EE8F, 0x00EEAF, 32, 48 }, // STATUS_DOMAIN_CTRLR_CONFIG_ERROR
+			{ 0xC000015F, 0x00EEDF, 0x00EEF7, 24, 178 }, // STATUS_FT_MISSING_MEMBER
+			{ 0xC0000160, 0x00EFA9, 0x00EFC8, 31, 124 }, // STATUS_ILL_FORMED_SERVICE_ENTRY
+			{ 0xC0000161, 0x00F044, 0x00F05C, 24, 205 }, // STATUS_ILLEGAL_CHARACTER
+			{ 0xC0000162, 0x00F129, 0x00F144, 27, 79 }, // STATUS_UNMAPPABLE_CHARACTER
+			{ 0xC0000163, 0x00F193, 0x00F1AD, 26, 90 }, // STATUS_UNDEFINED_CHARACTER
+			{ 0xC0000164, 0x00F207, 0x00F21B, 20, 55 }, // STATUS_FLOPPY_VOLUME
+			{ 0xC0000165, 0x00F252, 0x00F271, 31, 84 }, // STATUS_FLOPPY_ID_MARK_NOT_FOUND
+			{ 0xC0000166, 0x00F2C5, 0x00F2E1, 28, 172 }, // STATUS_FLOPPY_WRONG_CYLINDER
+			{ 0xC0000167, 0x00F38D, 0x00F3A8, 27, 114 }, // STATUS_FLOPPY_UNKNOWN_ERROR
+			{ 0xC0000168, 0x00F41A, 0x00F435, 27, 114 }, // STATUS_FLOPPY_BAD_REGISTERS
+			{ 0xC0000169, 0x00F4A7, 0x00F4C5, 30, 100 }, // STATUS_DISK_RECALIBRATE_FAILED
+			{ 0xC000016A, 0x00F529, 0x00F545, 28, 92 }, // STATUS_DISK_OPERATION_FAILED
+			{ 0xC000016B, 0x00F5A1, 0x00F5B9, 24, 106 }, // STATUS_DISK_RESET_FAILED
+			{ 0xC000016C, 0x00F623, 0x00F639, 22, 291 }, // STATUS_SHARED_IRQ_BUSY
+			{ 0xC000016D, 0x00F75C, 0x00F76F, 19, 88 }, // STATUS_FT_ORPHANING
+			{ 0xC000016E, 0x00F7C7, 0x00F7EE, 39, 108 }, // STATUS_BIOS_FAILED_TO_CONNECT_INTERRUPT
+			{ 0xC0000172, 0x00F85A, 0x00F872, 24, 30 }, // STATUS_PARTITION_FAILURE
+			{ 0xC0000173, 0x00F890, 0x00F8AB, 27, 89 }, // STATUS_INVALID_BLOCK_LENGTH
+			{ 0xC0000174, 0x00F904, 0x00F921, 29, 66 }, // STATUS_DEVICE_NOT_PARTITIONED
+			{ 0xC0000175, 0x00F963, 0x00F97E, 27, 48 }, // STATUS_UNABLE_TO_LOCK_MEDIA
+			{ 0xC0000176, 0x00F9AE, 0x00F9CB, 29, 19 }, // STATUS_UNABLE_TO_UNLOAD_MEDIA
+			{ 0xC0000177, 0x00F9DE, 0x00F9F1, 19, 34 }, // STATUS_EOM_OVERFLOW
+			{ 0xC0000178, 0x00FA13, 0x00FA22, 15, 78 }, // STATUS_NO_MEDIA
+			{ 0xC000017A, 0x00FA70, 0x00FA85, 21, 97 }, // STATUS_NO_SUCH_MEMBER
+			{ 0xC000017B, 0x00FAE6, 0x00FAFB, 21, 95 }, // STATUS_INVALID_MEMBER
+			{ 0xC000017C, 0x00FB5A, 0x00FB6C, 18, 81 }, // STATUS_KEY_DELETED
+			{ 0xC000017D, 0x00FBBD, 0x00FBD0, 19, 59 }, // STATUS_NO_LOG_SPACE
+			{ 0xC000017E, 0x00FC0B, 0x00FC1F, 20, 34 }, // STATUS_TOO_MANY_SIDS
+			{ 0xC000017F, 0x00FC41, 0x00FC64, 35, 138 }, // STATUS_LM_CROSS_ENCRYPTION_REQUIRED
+			{ 0xC0000180, 0x00FCEE, 0x00FD05, 23, 99 }, // STATUS_KEY_HAS_CHILDREN
+			{ 0xC0000181, 0x00FD68, 0x00FD85, 29, 74 }, // STATUS_CHILD_MUST_BE_VOLATILE
+			{ 0xC0000182, 0x00FDCF, 0x00FDF0, 33, 101 }, // STATUS_DEVICE_CONFIGURATION_ERROR
+			{ 0xC0000183, 0x00FE55, 0x00FE71, 28, 66 }, // STATUS_DRIVER_INTERNAL_ERROR
+			{ 0xC0000184, 0x00FEB3, 0x00FECE, 27, 59 }, // STATUS_INVALID_DEVICE_STATE
+			{ 0xC0000185, 0x00FF09, 0x00FF1F, 22, 37 }, // STATUS_IO_DEVICE_ERROR
+			{ 0xC0000186, 0x00FF44, 0x00FF60, 28, 64 }, // STATUS_DEVICE_PROTOCOL_ERROR
+			{ 0xC0000187, 0x00FFA0, 0x00ADCF, 24, 79 }, // STATUS_BACKUP_CONTROLLER
+			{ 0xC0000188, 0x00FFB8, 0x010000, 20, 57 }, // STATUS_LOG_FILE_FULL
+			{ 0xC0000189, 0x010039, 0x010048, 15, 68 }, // STATUS_TOO_LATE
+			{ 0xC000018A, 0x01008C, 0x0100A6, 26, 94 }, // STATUS_NO_TRUST_LSA_SECRET
+			{ 0xC000018B, 0x010104, 0x01011F, 27, 112 }, // STATUS_NO_TRUST_SAM_ACCOUNT
+			{ 0xC000018C, 0x01018F, 0x0101AC, 29, 113 }, // STATUS_TRUSTED_DOMAIN_FAILURE
+			{ 0xC000018D, 0x01021D, 0x010240, 35, 111 }, // STATUS_TRUSTED_RELATIONSHIP_FAILURE
+			{ 0xC000018E, 0x0102AF, 0x0102CB, 28, 33 }, // STATUS_EVENTLOG_FILE_CORRUPT
+			{ 0xC000018F, 0x0102EC, 0x010306, 26, 73 }, // STATUS_EVENTLOG_CANT_START
+			{ 0xC0000190, 0x01034F, 0x010363, 20, 88 }, // STATUS_TRUST_FAILURE
+			{ 0xC0000191, 0x0103BB, 0x0103D7, 28, 93 }, // STATUS_MUTANT_LIMIT_EXCEEDED
+			{ 0xC0000192, 0x010434, 0x01044F, 27, 71 }, // STATUS_NETLOGON_NOT_STARTED
+			{ 0xC0000193, 0x010496, 0x0104AC, 22, 31 }, // STATUS_ACCOUNT_EXPIRED
+			{ 0xC0000194, 0x0104CB, 0x0104E3, 24, 40 }, // STATUS_POSSIBLE_DEADLOCK
+			{ 0xC0000195, 0x01050B, 0x01052D, 34, 201 }, // STATUS_NETWORK_CREDENTIAL_CONFLICT
+			{ 0xC0000196, 0x0105F6, 0x010611, 27, 131 }, // STATUS_REMOTE_SESSION_LIMIT
+			{ 0xC0000197, 0x010694, 0x0106B0, 28, 39 }, // STATUS_EVENTLOG_FILE_CHANGED
+			{ 0xC0000198, 0x0106D7, 0x0106FF, 40, 123 }, // STATUS_NOLOGON_INTERDOMAIN_TRUST_ACCOUNT
+			{ 0xC0000199, 0x01077A, 0x0107A2, 40, 113 }, // STATUS_NOLOGON_WORKSTATION_TRUST_ACCOUNT
+			{ 0xC000019A, 0x010813, 0x010836, 35, 118 }, // STATUS_NOLOGON_SERVER_TRUST_ACCOUNT
+			{ 0xC000019B, 0x0108AC, 0x0108CC, 32, 99 }, // STATUS_DOMAIN_TRUST_INCONSISTENT
+			{ 0xC000019C, 0x01092F, 0x010948, 25, 99 }, // STATUS_FS_DRIVER_REQUIRED
+			{ 0xC000019D, 0x0109AB, 0x0109CD, 34, 62 }, // STATUS_IMAGE_ALREADY_LOADED_AS_DLL
+			{ 0xC000019E, 0x010A0B, 0x010A46, 59, 89 }, // STATUS_INCOMPATIBLE_WITH_GLOBAL_SHORT_NAME_REGISTRY_SETTING
+			{ 0xC000019F, 0x010A9F, 0x010AC7, 40, 43 }, // STATUS_SHORT_NAMES_NOT_ENABLED_ON_VOLUME
+			{ 0xC00001A0, 0x010AF2, 0x010B18, 38, 102 }, // STATUS_SECURITY_STREAM_IS_INCONSISTENT
+			{ 0xC00001A1, 0x010B7E, 0x010B97, 25, 81 }, // STATUS_INVALID_LOCK_RANGE
+			{ 0xC00001A2, 0x010BE8, 0x010C04, 28, 95 }, // STATUS_INVALID_ACE_CONDITION
+			{ 0xC00001A3, 0x010C63, 0x010C85, 34, 62 }, // STATUS_IMAGE_SUBSYSTEM_NOT_PRESENT
+			{ 0xC00001A4, 0x010CC3, 0x010CEB, 40, 94 }, // STATUS_NOTIFICATION_GUID_ALREADY_DEFINED
+			{ 0xC0000201, 0x010D49, 0x010D68, 31, 78 }, // STATUS_NETWORK_OPEN_RESTRICTION
+			{ 0xC0000202, 0x010DB6, 0x010DD0, 26, 61 }, // STATUS_NO_USER_SESSION_KEY
+			{ 0xC0000203, 0x010E0D, 0x010E28, 27, 41 }, // STATUS_USER_SESSION_DELETED
+			{ 0xC0000204, 0x010E51, 0x010E6F, 30, 79 }, // STATUS_RESOURCE_LANG_NOT_FOUND
+			{ 0xC0000205, 0x010EBE, 0x010EDC, 30, 60 }, // STATUS_INSUFF_SERVER_RESOURCES
+			{ 0xC0000206, 0x010F18, 0x010F32, 26, 62 }, // STATUS_INVALID_BUFFER_SIZE
+			{ 0xC0000207, 0x010F70, 0x010F90, 32, 64 }, // STATUS_INVALID_ADDRESS_COMPONENT
+			{ 0xC0000208, 0x010FD0, 0x010FEF, 31, 89 }, // STATUS_INVALID_ADDRESS_WILDCARD
+			{ 0xC0000209, 0x011048, 0x011061, 25, 89 }, // STATUS_TOO_MANY_ADDRESSES
+			{ 0xC000020A, 0x0110BA, 0x0110D7, 29, 68 }, // STATUS_ADDRESS_ALREADY_EXISTS
+			{ 0xC000020B, 0x01111B, 0x011130, 21, 36 }, // STATUS_ADDRESS_CLOSED
+			{ 0xC000020C, 0x011154, 0x011172, 30, 45 }, // STATUS_CONNECTION_DISCONNECTED
+			{ 0xC000020D, 0x01119F, 0x0111B6, 23, 40 }, // STATUS_CONNECTION_RESET
+			{ 0xC000020E, 0x0111DE, 0x0111F3, 21, 56 }, // STATUS_TOO_MANY_NODES
+			{ 0xC000020F, 0x01122B, 0x011245, 26, 44 }, // STATUS_TRANSACTION_ABORTED
+			{ 0xC0000210, 0x011271, 0x01128D, 28, 57 }, // STATUS_TRANSACTION_TIMED_OUT
+			{ 0xC0000211, 0x0112C6, 0x0112E3, 29, 63 }, // STATUS_TRANSACTION_NO_RELEASE
+			{ 0xC0000212, 0x011322, 0x01133D, 27, 69 }, // STATUS_TRANSACTION_NO_MATCH
+			{ 0xC0000213, 0x011382, 0x01139E, 28, 64 }, // STATUS_TRANSACTION_RESPONDED
+			{ 0xC0000214, 0x0113DE, 0x0113FB, 29, 79 }, // STATUS_TRANSACTION_INVALID_ID
+			{ 0xC0000215, 0x01144A, 0x011469, 31, 72 }, // STATUS_TRANSACTION_INVALID_TYPE
+			{ 0xC0000216, 0x0114B1, 0x0114CA, 25, 85 }, // STATUS_NOT_SERVER_SESSION
+			{ 0xC0000217, 0x01151F, 0x011538, 25, 85 }, // STATUS_NOT_CLIENT_SESSION
+			{ 0xC0000218, 0x01158D, 0x0115AD, 32, 134 }, // STATUS_CANNOT_LOAD_REGISTRY_FILE
+			{ 0xC0000219, 0x011633, 0x01164D, 26, 199 }, // STATUS_DEBUG_ATTACH_FAILED
+			{ 0xC000021A, 0x011714, 0x011734, 32, 139 }, // STATUS_SYSTEM_PROCESS_TERMINATED
+			{ 0xC000021B, 0x0117BF, 0x0117D7, 24, 91 }, // STATUS_DATA_NOT_ACCEPTED
+			{ 0xC000021C, 0x011832, 0x011851, 31, 107 }, // STATUS_NO_BROWSER_SERVERS_FOUND
+			{ 0xC000021D, 0x0118BC, 0x0118D1, 21, 31 }, // STATUS_VDM_HARD_ERROR
+			{ 0xC000021E, 0x0118F0, 0x01190C, 28, 96 }, // STATUS_DRIVER_CANCEL_TIMEOUT
+			{ 0xC000021F, 0x01196C, 0x011989, 29, 162 }, // STATUS_REPLY_MESSAGE_MISMATCH
+			{ 0xC0000220, 0x011A2B, 0x011A42, 23, 199 }, // STATUS_MAPPED_ALIGNMENT
+			{ 0xC0000221, 0x011B09, 0x011B27, 30, 113 }, // STATUS_IMAGE_CHECKSUM_MISMATCH
+			{ 0xC0000222, 0x011B98, 0x011BB4, 28, 231 }, // STATUS_LOST_WRITEBEHIND_DATA
+			{ 0xC0000223, 0x011C9B, 0x011CC2, 39, 154 }, // STATUS_CLIENT_SERVER_PARAMETERS_INVALID
+			{ 0xC0000224, 0x011D5C, 0x011D77, 27, 69 }, // STATUS_PASSWORD_MUST_CHANGE
+			{ 0xC0000225, 0x011DBC, 0x011DCC, 16, 25 }, // STATUS_NOT_FOUND
+			{ 0xC0000226, 0x011DE5, 0x011DFB, 22, 32 }, // STATUS_NOT_TINY_STREAM
+			{ 0xC0000227, 0x011E1B, 0x011E32, 23, 29 }, // STATUS_RECOVERY_FAILURE
+			{ 0xC0000228, 0x011E4F, 0x011E69, 26, 55 }, // STATUS_STACK_OVERFLOW_READ
+			{ 0xC0000229, 0x011EA0, 0x011EB1, 17, 27 }, // STATUS_FAIL_CHECK
+			{ 0xC000022A, 0x011ECC, 0x011EE5, 25, 88 }, // STATUS_DUPLICATE_OBJECTID
+			{ 0xC000022B, 0x011F3D, 0x011F53, 22, 79 }, // STATUS_OBJECTID_EXISTS
+			{ 0xC000022C, 0x011FA2, 0x011FB9, 23, 186 }, // STATUS_CONVERT_TO_LARGE
+			{ 0xC000022D, 0x012073, 0x01207F, 12, 32 }, // STATUS_RETRY
+			{ 0xC000022E, 0x01209F, 0x0120B8, 25, 140 }, // STATUS_FOUND_OUT_OF_SCOPE
+			{ 0xC000022F, 0x012144, 0x01215A, 22, 65 }, // STATUS_ALLOCATE_BUCKET
+			{ 0xC0000230, 0x01219B, 0x0121B3, 24, 56 }, // STATUS_PROPSET_NOT_FOUND
+			{ 0xC0000231, 0x0121EB, 0x012203, 24, 50 }, // STATUS_MARSHALL_OVERFLOW
+			{ 0xC0000232, 0x012235, 0x01224B, 22, 53 }, // STATUS_INVALID_VARIANT
+			{ 0xC0000233, 0x012280, 0x0122A2, 34, 51 }, // STATUS_DOMAIN_CONTROLLER_NOT_FOUND
+			{ 0xC0000234, 0x0122D5, 0x0122EE, 25, 135 }, // STATUS_ACCOUNT_LOCKED_OUT
+			{ 0xC0000235, 0x012375, 0x01238F, 26, 88 }, // STATUS_HANDLE_NOT_CLOSABLE
+			{ 0xC0000236, 0x0123E7, 0x012400, 25, 66 }, // STATUS_CONNECTION_REFUSED
+			{ 0xC0000237, 0x012442, 0x01245C, 26, 47 }, // STATUS_GRACEFUL_DISCONNECT
+			{ 0xC0000238, 0x01248B, 0x0124AC, 33, 65 }, // STATUS_ADDRESS_ALREADY_ASSOCIATED
+			{ 0xC0000239, 0x0124ED, 0x01250A, 29, 67 }, // STATUS_ADDRESS_NOT_ASSOCIATED
+			{ 0xC000023A, 0x01254D, 0x012566, 25, 65 }, // STATUS_CONNECTION_INVALID
+			{ 0xC000023B, 0x0125A7, 0x0125BF, 24, 69 }, // STATUS_CONNECTION_ACTIVE
+			{ 0xC000023C, 0x012604, 0x01261E, 26, 53 }, // STATUS_NETWORK_UNREACHABLE
+			{ 0xC000023D, 0x012653, 0x01266A, 23, 52 }, // STATUS_HOST_UNREACHABLE
+			{ 0xC000023E, 0x01269E, 0x0126B9, 27, 58 }, // STATUS_PROTOCOL_UNREACHABLE
+			{ 0xC000023F, 0x0126F3, 0x01270A, 23, 86 }, // STATUS_PORT_UNREACHABLE
+			{ 0xC0000240, 0x012760, 0x012776, 22, 24 }, // STATUS_REQUEST_ABORTED
+			{ 0xC0000241, 0x01278E, 0x0127A7, 25, 57 }, // STATUS_CONNECTION_ABORTED
+			{ 0xC0000242, 0x0127E0, 0x0127FD, 29, 46 }, // STATUS_BAD_COMPRESSION_BUFFER
+			{ 0xC0000243, 0x01282B, 0x012842, 23, 86 }, // STATUS_USER_MAPPED_FILE
+			{ 0xC0000244, 0x012898, 0x0128AB, 19, 62 }, // STATUS_AUDIT_FAILED
+			{ 0xC0000245, 0x0128E9, 0x012908, 31, 67 }, // STATUS_TIMER_RESOLUTION_NOT_SET
+			{ 0xC0000246, 0x01294B, 0x012968, 29, 137 }, // STATUS_CONNECTION_COUNT_LIMIT
+			{ 0xC0000247, 0x0129F1, 0x012A0E, 29, 72 }, // STATUS_LOGIN_TIME_RESTRICTION
+			{ 0xC0000248, 0x012A56, 0x012A74, 30, 57 }, // STATUS_LOGIN_WKSTA_RESTRICTION
+			{ 0xC0000249, 0x012AAD, 0x012AC8, 27, 173 }, // STATUS_IMAGE_MP_UP_MISMATCH
+			{ 0xC0000250, 0x012B75, 0x012B93, 30, 56 }, // STATUS_INSUFFICIENT_LOGON_INFO
+			{ 0xC0000251, 0x012BCB, 0x012BE4, 25, 322 }, // STATUS_BAD_DLL_ENTRYPOINT
+			{ 0xC0000252, 0x012D26, 0x012D43, 29, 315 }, // STATUS_BAD_SERVICE_ENTRYPOINT
+			{ 0xC0000253, 0x012E7E, 0x012E93, 21, 58 }, // STATUS_LPC_REPLY_LOST
+			{ 0xC0000254, 0x012ECD, 0x012EE8, 27, 66 }, // STATUS_IP_ADDRESS_CONFLICT1
+			{ 0xC0000255, 0x012F2A, 0x012EE8, 27, 66 }, // STATUS_IP_ADDRESS_CONFLICT2
+			{ 0xC0000256, 0x012F45, 0x012F60, 27, 153 }, // STATUS_REGISTRY_QUOTA_LIMIT
+			{ 0xC0000257, 0x012FF9, 0x013010, 23, 78 }, // STATUS_PATH_NOT_COVERED
+			{ 0xC0000258, 0x01305E, 0x013077, 25, 79 }, // STATUS_NO_CALLBACK_ACTIVE
+			{ 0xC0000259, 0x0130C6, 0x0130E3, 29, 211 }, // STATUS_LICENSE_QUOTA_EXCEEDED
+			{ 0xC000025A, 0x0131B6, 0x0131CA, 20, 108 }, // STATUS_PWD_TOO_SHORT
+			{ 0xC000025B, 0x013236, 0x01324B, 21, 314 }, // STATUS_PWD_TOO_RECENT
+			{ 0xC000025C, 0x013385, 0x0133A0, 27, 194 }, // STATUS_PWD_HISTORY_CONFLICT
+			{ 0xC000025E, 0x013462, 0x01347B, 25, 94 }, // STATUS_PLUGPLAY_NO_DEVICE
+			{ 0xC000025F, 0x0134D9, 0x0134F7, 30, 48 }, // STATUS_UNSUPPORTED_COMPRESSION
+			{ 0xC0000260, 0x013527, 0x013540, 25, 56 }, // STATUS_INVALID_HW_PROFILE
+			{ 0xC0000261, 0x013578, 0x01359B, 35, 60 }, // STATUS_INVALID_PLUGPLAY_DEVICE_PATH
+			{ 0xC0000262, 0x0135D7, 0x0135F6, 31, 100 }, // STATUS_DRIVER_ORDINAL_NOT_FOUND
+			{ 0xC0000263, 0x01365A, 0x01367C, 34, 104 }, // STATUS_DRIVER_ENTRYPOINT_NOT_FOUND
+			{ 0xC0000264, 0x0136E4, 0x0136FD, 25, 122 }, // STATUS_RESOURCE_NOT_OWNED
+			{ 0xC0000265, 0x013777, 0x01378C, 21, 81 }, // STATUS_TOO_MANY_LINKS
+			{ 0xC0000266, 0x0137DD, 0x0137FB, 30, 72 }, // STATUS_QUOTA_LIST_INCONSISTENT
+			{ 0xC0000267, 0x013843, 0x013859, 22, 57 }, // STATUS_FILE_IS_OFFLINE
+			{ 0xC0000268, 0x013892, 0x0138AE, 28, 269 }, // STATUS_EVALUATION_EXPIRATION
+			{ 0xC0000269, 0x0139BB, 0x0139D8, 29, 282 }, // STATUS_ILLEGAL_DLL_RELOCATION
+			{ 0xC000026A, 0x013AF2, 0x013B0A, 24, 180 }, // STATUS_LICENSE_VIOLATION
+			{ 0xC000026B, 0x013BBE, 0x013BDB, 29, 109 }, // STATUS_DLL_INIT_FAILED_LOGOFF
+			{ 0xC000026C, 0x013C48, 0x013C64, 28, 91 }, // STATUS_DRIVER_UNABLE_TO_LOAD
+			{ 0xC000026D, 0x013CBF, 0x013CD5, 22, 43 }, // STATUS_DFS_UNAVAILABLE
+			{ 0xC000026E, 0x013D00, 0x013D18, 24, 63 }, // STATUS_VOLUME_DISMOUNTED
+			{ 0xC000026F, 0x013D57, 0x013D71, 26, 64 }, // STATUS_WX86_INTERNAL_ERROR
+			{ 0xC0000270, 0x013DB1, 0x013DCE, 29, 57 }, // STATUS_WX86_FLOAT_STACK_CHECK
+			{ 0xC0000271, 0x013E07, 0x013E1F, 24, 61 }, // STATUS_VALIDATE_CONTINUE
+			{ 0xC0000272, 0x013E5C, 0x013E6B, 15, 54 }, // STATUS_NO_MATCH
+			{ 0xC0000273, 0x013EA1, 0x013EB7, 22, 60 }, // STATUS_NO_MORE_MATCHES
+			{ 0xC0000275, 0x013EF3, 0x013F0D, 26, 50 }, // STATUS_NOT_A_REPARSE_POINT
+			{ 0xC0000276, 0x013F3F, 0x013F5C, 29, 73 }, // STATUS_IO_REPARSE_TAG_INVALID
+			{ 0xC0000277, 0x013FA5, 0x013FC3, 30, 85 }, // STATUS_IO_REPARSE_TAG_MISMATCH
+			{ 0xC0000278, 0x014018, 0x014036, 30, 59 }, // STATUS_IO_REPARSE_DATA_INVALID
+			{ 0xC0000279, 0x014071, 0x014092, 33, 77 }, // STATUS_IO_REPARSE_TAG_NOT_HANDLED
+			{ 0xC0000280, 0x0140DF, 0x014100, 33, 88 }, // STATUS_REPARSE_POINT_NOT_RESOLVED
+			{ 0xC0000281, 0x014158, 0x01417B, 35, 38 }, // STATUS_DIRECTORY_IS_A_REPARSE_POINT
+			{ 0xC0000282, 0x0141A1, 0x0141BB, 26, 69 }, // STATUS_RANGE_LIST_CONFLICT
+			{ 0xC0000283, 0x014200, 0x01421B, 27, 62 }, // STATUS_SOURCE_ELEMENT_EMPTY
+			{ 0xC0000284, 0x014259, 0x014278, 31, 72 }, // STATUS_DESTINATION_ELEMENT_FULL
+			{ 0xC0000285, 0x0142C0, 0x0142DE, 30, 52 }, // STATUS_ILLEGAL_ELEMENT_ADDRESS
+			{ 0xC0000286, 0x014312, 0x01432D, 27, 79 }, // STATUS_MAGAZINE_NOT_PRESENT
+			{ 0xC0000287, 0x01437C, 0x01439A, 30, 60 }, // STATUS_REINITIALIZATION_NEEDED
+			{ 0xC000028A, 0x0143D6, 0x0143EE, 24, 35 }, // STATUS_ENCRYPTION_FAILED
+			{ 0xC000028B, 0x014411, 0x014429, 24, 35 }, // STATUS_DECRYPTION_FAILED
+			{ 0xC000028C, 0x01444C, 0x014462, 22, 57 }, // STATUS_RANGE_NOT_FOUND
+			{ 0xC000028D, 0x01449B, 0x0144B4, 25, 66 }, // STATUS_NO_RECOVERY_POLICY
+			{ 0xC000028E, 0x0144F6, 0x014503, 13, 61 }, // STATUS_NO_EFS
+			{ 0xC000028F, 0x014540, 0x014550, 16, 83 }, // STATUS_WRONG_EFS
+			{ 0xC0000290, 0x0145A3, 0x0145B6, 19, 43 }, // STATUS_NO_USER_KEYS
+			{ 0xC0000291, 0x0145E1, 0x0145FA, 25, 36 }, // STATUS_FILE_NOT_ENCRYPTED
+			{ 0xC0000292, 0x01461E, 0x014636, 24, 59 }, // STATUS_NOT_EXPORT_FORMAT
+			{ 0xC0000293, 0x014671, 0x014686, 21, 85 }, // STATUS_FILE_ENCRYPTED
+			{ 0xC0000295, 0x0146DB, 0x0146F4, 25, 67 }, // STATUS_WMI_GUID_NOT_FOUND
+			{ 0xC0000296, 0x014737, 0x014754, 29, 76 }, // STATUS_WMI_INSTANCE_NOT_FOUND
+			{ 0xC0000297, 0x0147A0, 0x0147BB, 27, 75 }, // STATUS_WMI_ITEMID_NOT_FOUND
+			{ 0xC0000298, 0x014806, 0x01481A, 20, 61 }, // STATUS_WMI_TRY_AGAIN
+			{ 0xC0000299, 0x014857, 0x01486B, 20, 64 }, // STATUS_SHARED_POLICY
+			{ 0xC000029A, 0x0148AB, 0x0148C9, 30, 47 }, // STATUS_POLICY_OBJECT_NOT_FOUND
+			{ 0xC000029B, 0x0148F8, 0x014910, 24, 53 }, // STATUS_POLICY_ONLY_IN_DS
+			{ 0xC000029C, 0x014945, 0x01495F, 26, 50 }, // STATUS_VOLUME_NOT_UPGRADED
+			{ 0xC000029D, 0x014991, 0x0149B1, 32, 59 }, // STATUS_REMOTE_STORAGE_NOT_ACTIVE
+			{ 0xC000029E, 0x0149EC, 0x014A0D, 33, 53 }, // STATUS_REMOTE_STORAGE_MEDIA_ERROR
+			{ 0xC000029F, 0x014A42, 0x014A5C, 26, 50 }, // STATUS_NO_TRACKING_SERVICE
+			{ 0xC00002A0, 0x014A8E, 0x014AA8, 26, 81 }, // STATUS_SERVER_SID_MISMATCH
+			{ 0xC00002A1, 0x014AF9, 0x014B18, 31, 66 }, // STATUS_DS_NO_ATTRIBUTE_OR_VALUE
+			{ 0xC00002A2, 0x014B5A, 0x014B7C, 34, 67 }, // STATUS_DS_INVALID_ATTRIBUTE_SYNTAX
+			{ 0xC00002A3, 0x014BBF, 0x014BE1, 34, 69 }, // STATUS_DS_ATTRIBUTE_TYPE_UNDEFINED
+			{ 0xC00002A4, 0x014C26, 0x014C49, 35, 66 }, // STATUS_DS_ATTRIBUTE_OR_VALUE_EXISTS
+			{ 0xC00002A5, 0x014C8B, 0x014C99, 14, 30 }, // STATUS_DS_BUSY
+			{ 0xC00002A6, 0x014CB7, 0x014CCC, 21, 39 }, // STATUS_DS_UNAVAILABLE
+			{ 0xC00002A7, 0x014CF3, 0x014D0E, 27, 67 }, // STATUS_DS_NO_RIDS_ALLOCATED
+			{ 0xC00002A8, 0x014D51, 0x014D67, 22, 69 }, // STATUS_DS_NO_MORE_RIDS
+			{ 0xC00002A9, 0x014DAC, 0x014DCA, 30, 122 }, // STATUS_DS_INCORRECT_ROLE_OWNER
+			{ 0xC00002AA, 0x014E44, 0x014E5F, 27, 97 }, // STATUS_DS_RIDMGR_INIT_ERROR
+			{ 0xC00002AB, 0x014EC0, 0x014EDD, 29, 104 }, // STATUS_DS_OBJ_CLASS_VIOLATION
+			{ 0xC00002AC, 0x014F45, 0x014F5F, 26, 80 }, // STATUS_DS_CANT_ON_NON_LEAF
+			{ 0xC00002AD, 0x014FAF, 0x014FC4, 21, 121 }, // STATUS_DS_CANT_ON_RDN
+			{ 0xC00002AE, 0x01503D, 0x015059, 28, 82 }, // STATUS_DS_CANT_MOD_OBJ_CLASS
+			{ 0xC00002AF, 0x0150AB, 0x0150CA, 31, 65 }, // STATUS_DS_CROSS_DOM_MOVE_FAILED
+			{ 0xC00002B0, 0x01510B, 0x015125, 26, 44 }, // STATUS_DS_GC_NOT_AVAILABLE
+			{ 0xC00002B1, 0x015151, 0x015172, 33, 77 }, // STATUS_DIRECTORY_SERVICE_REQUIRED
+			{ 0xC00002B2, 0x0151BF, 0x0151E0, 33, 85 }, // STATUS_REPARSE_ATTRIBUTE_CONFLICT
+			{ 0xC00002B3, 0x015235, 0x015251, 28, 51 }, // STATUS_CANT_ENABLE_DENY_ONLY
+			{ 0xC00002B4, 0x015284, 0x0152A0, 28, 43 }, // STATUS_FLOAT_MULTIPLE_FAULTS
+			{ 0xC00002B5, 0x0152CB, 0x0152E6, 27, 42 }, // STATUS_FLOAT_MULTIPLE_TRAPS
+			{ 0xC00002B6, 0x015310, 0x015325, 21, 28 }, // STATUS_DEVICE_REMOVED
+			{ 0xC00002B7, 0x015341, 0x015362, 33, 43 }, // STATUS_JOURNAL_DELETE_IN_PROGRESS
+			{ 0xC00002B8, 0x01538D, 0x0153A6, 25, 40 }, // STATUS_JOURNAL_NOT_ACTIVE
+			{ 0xC00002B9, 0x0153CE, 0x0153E0, 18, 41 }, // STATUS_NOINTERFACE
+			{ 0xC00002C1, 0x015409, 0x015427, 30, 53 }, // STATUS_DS_ADMIN_LIMIT_EXCEEDED
+			{ 0xC00002C2, 0x01545C, 0x015476, 26, 134 }, // STATUS_DRIVER_FAILED_SLEEP
+			{ 0xC00002C3, 0x0154FC, 0x01551F, 35, 92 }, // STATUS_MUTUAL_AUTHENTICATION_FAILED
+			{ 0xC00002C4, 0x01557B, 0x015595, 26, 60 }, // STATUS_CORRUPT_SYSTEM_FILE
+			{ 0xC00002C5, 0x0155D1, 0x0155F3, 34, 102 }, // STATUS_DATATYPE_MISALIGNMENT_ERROR
+			{ 0xC00002C6, 0x015659, 0x01566D, 20, 45 }, // STATUS_WMI_READ_ONLY
+			{ 0xC00002C7, 0x01569A, 0x0156B0, 22, 53 }, // STATUS_WMI_SET_FAILURE
+			{ 0xC00002C8, 0x0156E5, 0x0156FE, 25, 243 }, // STATUS_COMMITMENT_MINIMUM
+			{ 0xC00002C9, 0x0157F1, 0x01580B, 26, 102 }, // STATUS_REG_NAT_CONSUMPTION
+			{ 0xC00002CA, 0x015871, 0x015886, 21, 94 }, // STATUS_TRANSPORT_FULL
+			{ 0xC00002CB, 0x0158E4, 0x0158FE, 26, 231 }, // STATUS_DS_SAM_INIT_FAILURE
+			{ 0xC00002CC, 0x0159E5, 0x0159FD, 24, 70 }, // STATUS_ONLY_IF_CONNECTED
+			{ 0xC00002CD, 0x015A43, 0x015A66, 35, 80 }, // STATUS_DS_SENSITIVE_GROUP_VIOLATION
+			{ 0xC00002CE, 0x015AB6, 0x015AD4, 30, 54 }, // STATUS_PNP_RESTART_ENUMERATION
+			{ 0xC00002CF, 0x015B0A, 0x015B26, 28, 52 }, // STATUS_JOURNAL_ENTRY_DELETED
+			{ 0xC00002D0, 0x015B5A, 0x015B7B, 33, 66 }, // STATUS_DS_CANT_MOD_PRIMARYGROUPID
+			{ 0xC00002D1, 0x015BBD, 0x015BDE, 33, 144 }, // STATUS_SYSTEM_IMAGE_BAD_SIGNATURE
+			{ 0xC00002D2, 0x015C6E, 0x015C88, 26, 39 }, // STATUS_PNP_REBOOT_REQUIRED
+			{ 0xC00002D3, 0x015CAF, 0x015CC9, 26, 55 }, // STATUS_POWER_STATE_INVALID
+			{ 0xC00002D4, 0x015D00, 0x015D1C, 28, 36 }, // STATUS_DS_INVALID_GROUP_TYPE
+			{ 0xC00002D5, 0x015D40, 0x015D6C, 44, 72 }, // STATUS_DS_NO_NEST_GLOBALGROUP_IN_MIXEDDOMAIN
+			{ 0xC00002D6, 0x015DB4, 0x015DDF, 43, 100 }, // STATUS_DS_NO_NEST_LOCALGROUP_IN_MIXEDDOMAIN
+			{ 0xC00002D7, 0x015E43, 0x015E6A, 39, 53 }, // STATUS_DS_GLOBAL_CANT_HAVE_LOCAL_MEMBER
+			{ 0xC00002D8, 0x015E9F, 0x015ECA, 43, 57 }, // STATUS_DS_GLOBAL_CANT_HAVE_UNIVERSAL_MEMBER
+			{ 0xC00002D9, 0x015F03, 0x015F2D, 42, 56 }, // STATUS_DS_UNIVERSAL_CANT_HAVE_LOCAL_MEMBER
+			{ 0xC00002DA, 0x015F65, 0x015F92, 45, 49 }, // STATUS_DS_GLOBAL_CANT_HAVE_CROSSDOMAIN_MEMBER
+			{ 0xC00002DB, 0x015FC3, 0x015FF5, 50, 71 }, // STATUS_DS_LOCAL_CANT_HAVE_CROSSDOMAIN_LOCAL_MEMBER
+			{ 0xC00002DC, 0x01603C, 0x01605A, 30, 89 }, // STATUS_DS_HAVE_PRIMARY_MEMBERS
+			{ 0xC00002DD, 0x0160B3, 0x0160CB, 24, 63 }, // STATUS_WMI_NOT_SUPPORTED
+			{ 0xC00002DE, 0x01610A, 0x016123, 25, 62 }, // STATUS_INSUFFICIENT_POWER
+			{ 0xC00002DF, 0x016161, 0x016181, 32, 56 }, // STATUS_SAM_NEED_BOOTKEY_PASSWORD
+			{ 0xC00002E0, 0x0161B9, 0x0161D7, 30, 68 }, // STATUS_SAM_NEED_BOOTKEY_FLOPPY
+			{ 0xC00002E1, 0x01621B, 0x01622F, 20, 31 }, // STATUS_DS_CANT_START
+			{ 0xC00002E2, 0x01624E, 0x016264, 22, 218 }, // STATUS_DS_INIT_FAILURE
+			{ 0xC00002E3, 0x01633E, 0x016355, 23, 221 }, // STATUS_SAM_INIT_FAILURE
+			{ 0xC00002E4, 0x016432, 0x016447, 21, 73 }, // STATUS_DS_GC_REQUIRED
+			{ 0xC00002E5, 0x016490, 0x0164B4, 36, 76 }, // STATUS_DS_LOCAL_MEMBER_OF_LOCAL_ONLY
+			{ 0xC00002E6, 0x016500, 0x016524, 36, 66 }, // STATUS_DS_NO_FPO_IN_UNIVERSAL_GROUPS
+			{ 0xC00002E7, 0x016566, 0x01658E, 40, 221 }, // STATUS_DS_MACHINE_ACCOUNT_QUOTA_EXCEEDED
+			{ 0xC00002E8, 0x01666B, 0x01666B, 31, 31 }, // STATUS_MULTIPLE_FAULT_VIOLATION
+			{ 0xC00002E9, 0x01668A, 0x0166AB, 33, 57 }, // STATUS_CURRENT_DOMAIN_NOT_ALLOWED
+			{ 0xC00002EA, 0x0166E4, 0x0166F6, 18, 40 }, // STATUS_CANNOT_MAKE
+			{ 0xC00002EB, 0x01671E, 0x016734, 22, 46 }, // STATUS_SYSTEM_SHUTDOWN
+			{ 0xC00002EC, 0x016762, 0x016780, 30, 195 }, // STATUS_DS_INIT_FAILURE_CONSOLE
+			{ 0xC00002ED, 0x016843, 0x016865, 34, 208 }, // STATUS_DS_SAM_INIT_FAILURE_CONSOLE
+			{ 0xC00002EE, 0x016935, 0x016956, 33, 100 }, // STATUS_UNFINISHED_CONTEXT_DELETED
+			{ 0xC00002EF, 0x0169BA, 0x0169CD, 19, 109 }, // STATUS_NO_TGT_REPLY
+			{ 0xC00002F0, 0x016A3A, 0x016A53, 25, 39 }, // STATUS_OBJECTID_NOT_FOUND
+			{ 0xC00002F1, 0x016A7A, 0x016A90, 22, 97 }, // STATUS_NO_IP_ADDRESSES
+			{ 0xC00002F2, 0x016AF1, 0x016B0F, 30, 98 }, // STATUS_WRONG_CREDENTIAL_HANDLE
+			{ 0xC00002F3, 0x016B71, 0x016B8D, 28, 93 }, // STATUS_CRYPTO_SYSTEM_INVALID
+			{ 0xC00002F4, 0x016BEA, 0x016C07, 29, 57 }, // STATUS_MAX_REFERRALS_EXCEEDED
+			{ 0xC00002F5, 0x016C40, 0x016C52, 18, 75 }, // STATUS_MUST_BE_KDC
+			{ 0xC00002F6, 0x016C9D, 0x016CBF, 34, 113 }, // STATUS_STRONG_CRYPTO_NOT_SUPPORTED
+			{ 0xC00002F7, 0x016D30, 0x016D4A, 26, 53 }, // STATUS_TOO_MANY_PRINCIPALS
+			{ 0xC00002F8, 0x016D7F, 0x016D90, 17, 79 }, // STATUS_NO_PA_DATA
+			{ 0xC00002F9, 0x016DDF, 0x016DFA, 27, 143 }, // STATUS_PKINIT_NAME_MISMATCH
+			{ 0xC00002FA, 0x016E89, 0x016EA8, 31, 45 }, // STATUS_SMARTCARD_LOGON_REQUIRED
+			{ 0xC00002FB, 0x016ED5, 0x016EEF, 26, 39 }, // STATUS_KDC_INVALID_REQUEST
+			{ 0xC00002FC, 0x016F16, 0x016F30, 26, 68 }, // STATUS_KDC_UNABLE_TO_REFER
+			{ 0xC00002FD, 0x016F74, 0x016F8C, 24, 58 }, // STATUS_KDC_UNKNOWN_ETYPE
+			{ 0xC00002FE, 0x016FC6, 0x016FE1, 27, 33 }, // STATUS_SHUTDOWN_IN_PROGRESS
+			{ 0xC00002FF, 0x017002, 0x017024, 34, 36 }, // STATUS_SERVER_SHUTDOWN_IN_PROGRESS
+			{ 0xC0000300, 0x017048, 0x017063, 27, 99 }, // STATUS_NOT_SUPPORTED_ON_SBS
+			{ 0xC0000301, 0x0170C6, 0x0170E2, 28, 35 }, // STATUS_WMI_GUID_DISCONNECTED
+			{ 0xC0000302, 0x017105, 0x017120, 27, 58 }, // STATUS_WMI_ALREADY_DISABLED
+			{ 0xC0000303, 0x01715A, 0x017174, 26, 57 }, // STATUS_WMI_ALREADY_ENABLED
+			{ 0xC0000304, 0x0171AD, 0x0171C6, 25, 81 }, // STATUS_MFT_TOO_FRAGMENTED
+			{ 0xC0000305, 0x017217, 0x017235, 30, 24 }, // STATUS_COPY_PROTECTION_FAILURE
+			{ 0xC0000306, 0x01724D, 0x01726E, 33, 54 }, // STATUS_CSS_AUTHENTICATION_FAILURE
+			{ 0xC0000307, 0x0172A4, 0x0172BE, 26, 70 }, // STATUS_CSS_KEY_NOT_PRESENT
+			{ 0xC0000308, 0x017304, 0x017322, 30, 56 }, // STATUS_CSS_KEY_NOT_ESTABLISHED
+			{ 0xC0000309, 0x01735A, 0x017375, 27, 72 }, // STATUS_CSS_SCRAMBLED_SECTOR
+			{ 0xC000030A, 0x0173BD, 0x0173D7, 26, 102 }, // STATUS_CSS_REGION_MISMATCH
+			{ 0xC000030B, 0x01743D, 0x017458, 27, 68 }, // STATUS_CSS_RESETS_EXHAUSTED
+			{ 0xC0000320, 0x01749C, 0x0174B1, 21, 154 }, // STATUS_PKINIT_FAILURE
+			{ 0xC0000321, 0x01754B, 0x01756D, 34, 95 }, // STATUS_SMARTCARD_SUBSYSTEM_FAILURE
+			{ 0xC0000322, 0x0175CC, 0x0175DE, 18, 64 }, // STATUS_NO_KERB_KEY
+			{ 0xC0000350, 0x01761E, 0x01762E, 16, 56 }, // STATUS_HOST_DOWN
+			{ 0xC0000351, 0x017666, 0x017680, 26, 81 }, // STATUS_UNSUPPORTED_PREAUTH
+			{ 0xC0000352, 0x0176D1, 0x0176EC, 27, 117 }, // STATUS_EFS_ALG_BLOB_TOO_BIG
+			{ 0xC0000353, 0x017761, 0x017774, 19, 108 }, // STATUS_PORT_NOT_SET
+			{ 0xC0000354, 0x0177E0, 0x0177F8, 24, 82 }, // STATUS_DEBUGGER_INACTIVE
+			{ 0xC0000355, 0x01784A, 0x017869, 31, 117 }, // STATUS_DS_VERSION_CHECK_FAILURE
+			{ 0xC0000356, 0x0178DE, 0x0178F6, 24, 51 }, // STATUS_AUDITING_DISABLED
+			{ 0xC0000357, 0x017929, 0x017946, 29, 75 }, // STATUS_PRENT4_MACHINE_ACCOUNT
+			{ 0xC0000358, 0x017991, 0x0179B8, 39, 58 }, // STATUS_DS_AG_CANT_HAVE_UNIVERSAL_MEMBER
+			{ 0xC0000359, 0x0179F2, 0x017A0D, 27, 98 }, // STATUS_INVALID_IMAGE_WIN_32
+			{ 0xC000035A, 0x017A6F, 0x017A8A, 27, 98 }, // STATUS_INVALID_IMAGE_WIN_64
+			{ 0xC000035B, 0x017AEC, 0x017AFF, 19, 55 }, // STATUS_BAD_BINDINGS
+			{ 0xC000035C, 0x017B36, 0x017B54, 30, 111 }, // STATUS_NETWORK_SESSION_EXPIRED
+			{ 0xC000035D, 0x017BC3, 0x017BD7, 20, 70 }, // STATUS_APPHELP_BLOCK
+			{ 0xC000035E, 0x017C1D, 0x017C35, 24, 45 }, // STATUS_ALL_SIDS_FILTERED
+			{ 0xC000035F, 0x017C62, 0x017C7D, 27, 71 }, // STATUS_NOT_SAFE_MODE_DRIVER
+			{ 0xC0000361, 0x017CC4, 0x017CEC, 40, 104 }, // STATUS_ACCESS_DISABLED_BY_POLICY_DEFAULT
+			{ 0xC0000362, 0x017D54, 0x017D79, 37, 104 }, // STATUS_ACCESS_DISABLED_BY_POLICY_PATH
+			{ 0xC0000363, 0x017DE1, 0x017E0B, 42, 84 }, // STATUS_ACCESS_DISABLED_BY_POLICY_PUBLISHER
+			{ 0xC0000364, 0x017E5F, 0x017E85, 38, 73 }, // STATUS_ACCESS_DISABLED_BY_POLICY_OTHER
+			{ 0xC0000365, 0x017ECE, 0x017EE8, 26, 69 }, // STATUS_FAILED_DRIVER_ENTRY
+			{ 0xC0000366, 0x017F2D, 0x017F4C, 31, 162 }, // STATUS_DEVICE_ENUMERATION_ERROR
+			{ 0xC0000368, 0x017FEE, 0x01800D, 31, 160 }, // STATUS_MOUNT_POINT_NOT_RESOLVED
+			{ 0xC0000369, 0x0180AD, 0x0180D3, 38, 124 }, // STATUS_INVALID_DEVICE_OBJECT_PARAMETER
+			{ 0xC000036A, 0x01814F, 0x018161, 18, 96 }, // STATUS_MCA_OCCURED
+			{ 0xC000036B, 0x0181C1, 0x0181DF, 30, 40 }, // STATUS_DRIVER_BLOCKED_CRITICAL
+			{ 0xC000036C, 0x018207, 0x0181DF, 21, 40 }, // STATUS_DRIVER_BLOCKED
+			{ 0xC000036D, 0x01821C, 0x018238, 28, 52 }, // STATUS_DRIVER_DATABASE_ERROR
+			{ 0xC000036E, 0x01826C, 0x018288, 28, 40 }, // STATUS_SYSTEM_HIVE_TOO_LARGE
+			{ 0xC000036F, 0x0182B0, 0x0182D0, 32, 107 }, // STATUS_INVALID_IMPORT_OF_NON_DLL
+			{ 0xC0000371, 0x01833B, 0x01834C, 17, 83 }, // STATUS_NO_SECRETS
+			{ 0xC0000372, 0x01839F, 0x017E85, 44, 73 }, // STATUS_ACCESS_DISABLED_NO_SAFER_UI_BY_POLICY
+			{ 0xC0000373, 0x0183CB, 0x0183E5, 26, 76 }, // STATUS_FAILED_STACK_SWITCH
+			{ 0xC0000374, 0x018431, 0x018447, 22, 26 }, // STATUS_HEAP_CORRUPTION
+			{ 0xC0000380, 0x018461, 0x01847B, 26, 48 }, // STATUS_SMARTCARD_WRONG_PIN
+			{ 0xC0000381, 0x0184AB, 0x0184C8, 29, 25 }, // STATUS_SMARTCARD_CARD_BLOCKED
+			{ 0xC0000382, 0x0184E1, 0x018508, 39, 38 }, // STATUS_SMARTCARD_CARD_NOT_AUTHENTICATED
+			{ 0xC0000383, 0x01852E, 0x018546, 24, 23 }, // STATUS_SMARTCARD_NO_CARD
+			{ 0xC0000384, 0x01855D, 0x01857E, 33, 60 }, // STATUS_SMARTCARD_NO_KEY_CONTAINER
+			{ 0xC0000385, 0x0185BA, 0x0185D9, 31, 58 }, // STATUS_SMARTCARD_NO_CERTIFICATE
+			{ 0xC0000386, 0x018613, 0x01862D, 26, 35 }, // STATUS_SMARTCARD_NO_KEYSET
+			{ 0xC0000387, 0x018650, 0x018669, 25, 60 }, // STATUS_SMARTCARD_IO_ERROR
+			{ 0xC0000388, 0x0186A5, 0x0186BE, 25, 132 }, // STATUS_DOWNGRADE_DETECTED
+			{ 0xC0000389, 0x018742, 0x01875F, 29, 163 }, // STATUS_SMARTCARD_CERT_REVOKED
+			{ 0xC000038A, 0x018802, 0x01881D, 27, 157 }, // STATUS_ISSUING_CA_UNTRUSTED
+			{ 0xC000038B, 0x0188BA, 0x0188D5, 27, 141 }, // STATUS_REVOCATION_OFFLINE_C
+			{ 0xC000038C, 0x018962, 0x01897E, 28, 108 }, // STATUS_PKINIT_CLIENT_FAILURE
+			{ 0xC000038D, 0x0189EA, 0x018A07, 29, 104 }, // STATUS_SMARTCARD_CERT_EXPIRED
+			{ 0xC000038E, 0x018A6F, 0x018A90, 33, 91 }, // STATUS_DRIVER_FAILED_PRIOR_UNLOAD
+			{ 0xC000038F, 0x018AEB, 0x018B0A, 31, 93 }, // STATUS_SMARTCARD_SILENT_CONTEXT
+			{ 0xC0000401, 0x018B67, 0x018B8B, 36, 68 }, // STATUS_PER_USER_TRUST_QUOTA_EXCEEDED
+			{ 0xC0000402, 0x018BCF, 0x018BF3, 36, 59 }, // STATUS_ALL_USER_TRUST_QUOTA_EXCEEDED
+			{ 0xC0000403, 0x018C2E, 0x018C55, 39, 68 }, // STATUS_USER_DELETE_TRUST_QUOTA_EXCEEDED
+			{ 0xC0000404, 0x018C99, 0x018CB2, 25, 57 }, // STATUS_DS_NAME_NOT_UNIQUE
+			{ 0xC0000405, 0x018CEB, 0x018D07, 28, 73 }, // STATUS_DS_DUPLICATE_ID_FOUND
+			{ 0xC0000406, 0x018D50, 0x018D70, 32, 88 }, // STATUS_DS_GROUP_CONVERSION_ERROR
+			{ 0xC0000407, 0x018DC8, 0x018DE8, 32, 114 }, // STATUS_VOLSNAP_PREPARE_HIBERNATE
+			{ 0xC0000408, 0x018E5A, 0x018E73, 25, 44 }, // STATUS_USER2USER_REQUIRED
+			{ 0xC0000409, 0x018E9F, 0x018EBA, 27, 166 }, // STATUS_STACK_BUFFER_OVERRUN
+			{ 0xC000040A, 0x018F60, 0x018F7A, 26, 158 }, // STATUS_NO_S4U_PROT_SUPPORT
+			{ 0xC000040B, 0x019018, 0x01903C, 36, 265 }, // STATUS_CROSSREALM_DELEGATION_FAILURE
+			{ 0xC000040C, 0x019145, 0x019162, 29, 216 }, // STATUS_REVOCATION_OFFLINE_KDC
+			{ 0xC000040D, 0x01923A, 0x019259, 31, 222 }, // STATUS_ISSUING_CA_UNTRUSTED_KDC
+			{ 0xC000040E, 0x019337, 0x01934E, 23, 156 }, // STATUS_KDC_CERT_EXPIRED
+			{ 0xC000040F, 0x0193EA, 0x019401, 23, 161 }, // STATUS_KDC_CERT_REVOKED
+			{ 0xC0000410, 0x0194A2, 0x0194C1, 31, 79 }, // STATUS_PARAMETER_QUOTA_EXCEEDED
+			{ 0xC0000411, 0x019510, 0x01952A, 26, 119 }, // STATUS_HIBERNATION_FAILURE
+			{ 0xC0000412, 0x0195A1, 0x0195B9, 24, 88 }, // STATUS_DELAY_LOAD_FAILED
+			{ 0xC0000413, 0x019611, 0x019636, 37, 160 }, // STATUS_AUTHENTICATION_FIREWALL_FAILED
+			{ 0xC0000414, 0x0196D6, 0x0196EB, 21, 143 }, // STATUS_VDM_DISALLOWED
+			{ 0xC0000415, 0x01977A, 0x01979B, 33, 285 }, // STATUS_HUNG_DISPLAY_DRIVER_THREAD
+			{ 0xC0000416, 0x0198B8, 0x0198F6, 62, 121 }, // STATUS_INSUFFICIENT_RESOURCE_FOR_SPECIFIED_SHARED_SECTION_SIZE
+			{ 0xC0000417, 0x01996F, 0x019990, 33, 56 }, // STATUS_INVALID_CRUNTIME_PARAMETER
+			{ 0xC0000418, 0x0199C8, 0x0199DB, 19, 49 }, // STATUS_NTLM_BLOCKED
+			{ 0xC0000419, 0x019A0C, 0x019A2E, 34, 61 }, // STATUS_DS_SRC_SID_EXISTS_IN_FOREST
+			{ 0xC000041A, 0x019A6B, 0x019A91, 38, 67 }, // STATUS_DS_DOMAIN_NAME_EXISTS_IN_FOREST
+			{ 0xC000041B, 0x019AD4, 0x019AF8, 36, 65 }, // STATUS_DS_FLAT_NAME_EXISTS_IN_FOREST
+			{ 0xC000041C, 0x019B39, 0x019B5B, 34, 41 }, // STATUS_INVALID_USER_PRINCIPAL_NAME
+			{ 0xC000041D, 0x019B84, 0x019BA8, 36, 62 }, // STATUS_FATAL_USER_CALLBACK_EXCEPTION
+			{ 0xC0000420, 0x019BE6, 0x019BFE, 24, 34 }, // STATUS_ASSERTION_FAILURE
+			{ 0xC0000421, 0x019C20, 0x019C34, 20, 63 }, // STATUS_VERIFIER_STOP
+			{ 0xC0000423, 0x019C73, 0x019C8C, 25, 98 }, // STATUS_CALLBACK_POP_STACK
+			{ 0xC0000424, 0x019CEE, 0x019D10, 34, 149 }, // STATUS_INCOMPATIBLE_DRIVER_BLOCKED
+			{ 0xC0000425, 0x019DA5, 0x019DB9, 20, 78 }, // STATUS_HIVE_UNLOADED
+			{ 0xC0000426, 0x019E07, 0x019E22, 27, 40 }, // STATUS_COMPRESSION_DISABLED
+			{ 0xC0000427, 0x019E4A, 0x019E67, 29, 78 }, // STATUS_FILE_SYSTEM_LIMITATION
+			{ 0xC0000428, 0x019EB5, 0x019ECE, 25, 222 }, // STATUS_INVALID_IMAGE_HASH
+			{ 0xC0000429, 0x019FAC, 0x019FBE, 18, 60 }, // STATUS_NOT_CAPABLE
+			{ 0xC000042A, 0x019FFA, 0x01A018, 30, 73 }, // STATUS_REQUEST_OUT_OF_SEQUENCE
+			{ 0xC000042B, 0x01A061, 0x01A07C, 27, 65 }, // STATUS_IMPLEMENTATION_LIMIT
+			{ 0xC000042C, 0x01A0BD, 0x01A0D6, 25, 43 }, // STATUS_ELEVATION_REQUIRED
+			{ 0xC000042D, 0x01A101, 0x01A11B, 26, 45 }, // STATUS_NO_SECURITY_CONTEXT
+			{ 0xC000042F, 0x01A148, 0x01A161, 25, 96 }, // STATUS_PKU2U_CERT_FAILURE
+			{ 0xC0000432, 0x01A1C1, 0x01A1D2, 17, 69 }, // STATUS_BEYOND_VDL
+			{ 0xC0000433, 0x01A217, 0x01A23B, 36, 100 }, // STATUS_ENCOUNTERED_WRITE_IN_PROGRESS
+			{ 0xC0000434, 0x01A29F, 0x01A2B1, 18, 101 }, // STATUS_PTE_CHANGED
+			{ 0xC0000435, 0x01A316, 0x01A329, 19, 92 }, // STATUS_PURGE_FAILED
+			{ 0xC0000440, 0x01A385, 0x01A3A6, 33, 47 }, // STATUS_CRED_REQUIRES_CONFIRMATION
+			{ 0xC0000441, 0x01A3D5, 0x01A401, 44, 95 }, // STATUS_CS_ENCRYPTION_INVALID_SERVER_RESPONSE
+			{ 0xC0000442, 0x01A460, 0x01A487, 39, 97 }, // STATUS_CS_ENCRYPTION_UNSUPPORTED_SERVER
+			{ 0xC0000443, 0x01A4E8, 0x01A514, 44, 70 }, // STATUS_CS_ENCRYPTION_EXISTING_ENCRYPTED_FILE
+			{ 0xC0000444, 0x01A55A, 0x01A581, 39, 70 }, // STATUS_CS_ENCRYPTION_NEW_ENCRYPTED_FILE
+			{ 0xC0000445, 0x01A5C7, 0x01A5E8, 33, 55 }, // STATUS_CS_ENCRYPTION_FILE_NOT_CSE
+			{ 0xC0000446, 0x01A61F, 0x01A633, 20, 81 }, // STATUS_INVALID_LABEL
+			{ 0xC0000450, 0x01A684, 0x01A6A4, 32, 62 }, // STATUS_DRIVER_PROCESS_TERMINATED
+			{ 0xC0000451, 0x01A6E2, 0x01A700, 30, 140 }, // STATUS_AMBIGUOUS_SYSTEM_DEVICE
+			{ 0xC0000452, 0x01A78C, 0x01A7AA, 30, 44 }, // STATUS_SYSTEM_DEVICE_NOT_FOUND
+			{ 0xC0000453, 0x01A7D6, 0x01A7F5, 31, 40 }, // STATUS_RESTART_BOOT_APPLICATION
+			{ 0xC0000454, 0x01A81D, 0x01A840, 35, 84 }, // STATUS_INSUFFICIENT_NVRAM_RESOURCES
+			{ 0xC0000500, 0x01A894, 0x01A8AC, 24, 35 }, // STATUS_INVALID_TASK_NAME
+			{ 0xC0000501, 0x01A8CF, 0x01A8E8, 25, 36 }, // STATUS_INVALID_TASK_INDEX
+			{ 0xC0000502, 0x01A90C, 0x01A929, 29, 47 }, // STATUS_THREAD_ALREADY_IN_TASK
+			{ 0xC0000503, 0x01A958, 0x01A96E, 22, 47 }, // STATUS_CALLBACK_BYPASS
+			{ 0xC0000602, 0x01A99D, 0x01A9B7, 26, 140 }, // STATUS_FAIL_FAST_EXCEPTION
+			{ 0xC0000603, 0x01AA43, 0x01AA5C, 25, 114 }, // STATUS_IMAGE_CERT_REVOKED
+			{ 0xC0000700, 0x01AACE, 0x01AAE0, 18, 24 }, // STATUS_PORT_CLOSED
+			{ 0xC0000701, 0x01AAF8, 0x01AB0B, 19, 50 }, // STATUS_MESSAGE_LOST
+			{ 0xC0000702, 0x01AB3D, 0x01AB53, 22, 37 }, // STATUS_INVALID_MESSAGE
+			{ 0xC0000703, 0x01AB78, 0x01AB8F, 23, 35 }, // STATUS_REQUEST_CANCELED
+			{ 0xC0000704, 0x01ABB2, 0x01ABCB, 25, 35 }, // STATUS_RECURSIVE_DISPATCH
+			{ 0xC0000705, 0x01ABEE, 0x01AC10, 34, 61 }, // STATUS_LPC_RECEIVE_BUFFER_EXPECTED
+			{ 0xC0000706, 0x01AC4D, 0x01AC70, 35, 50 }, // STATUS_LPC_INVALID_CONNECTION_USAGE
+			{ 0xC0000707, 0x01ACA2, 0x01ACC1, 31, 51 }, // STATUS_LPC_REQUESTS_NOT_ALLOWED
+			{ 0xC0000708, 0x01ACF4, 0x01AD0A, 22, 41 }, // STATUS_RESOURCE_IN_USE
+			{ 0xC0000709, 0x01AD33, 0x01AD4F, 28, 56 }, // STATUS_HARDWARE_MEMORY_ERROR
+			{ 0xC000070A, 0x01AD87, 0x01ADA9, 34, 81 }, // STATUS_THREADPOOL_HANDLE_EXCEPTION
+			{ 0xC000070B, 0x01ADFA, 0x01AE2A, 48, 94 }, // STATUS_THREADPOOL_SET_EVENT_ON_COMPLETION_FAILED
+			{ 0xC000070C, 0x01AE88, 0x01AEC0, 56, 106 }, // STATUS_THREADPOOL_RELEASE_SEMAPHORE_ON_COMPLETION_FAILED
+			{ 0xC000070D, 0x01AF2A, 0x01AF5E, 52, 96 }, // STATUS_THREADPOOL_RELEASE_MUTEX_ON_COMPLETION_FAILED
+			{ 0xC000070E, 0x01AFBE, 0x01AFF1, 51, 96 }, // STATUS_THREADPOOL_FREE_LIBRARY_ON_COMPLETION_FAILED
+			{ 0xC000070F, 0x01B051, 0x01B07C, 43, 91 }, // STATUS_THREADPOOL_RELEASED_DURING_OPERATION
+			{ 0xC0000710, 0x01B0D7, 0x01B103, 44, 181 }, // STATUS_CALLBACK_RETURNED_WHILE_IMPERSONATING
+			{ 0xC0000711, 0x01B1B8, 0x01B1DF, 39, 168 }, // STATUS_APC_RETURNED_WHILE_IMPERSONATING
+			{ 0xC0000712, 0x01B287, 0x01B2A2, 27, 93 }, // STATUS_PROCESS_IS_PROTECTED
+			{ 0xC0000713, 0x01B2FF, 0x01B313, 20, 65 }, // STATUS_MCA_EXCEPTION
+			{ 0xC0000714, 0x01B354, 0x01B379, 37, 53 }, // STATUS_CERTIFICATE_MAPPING_NOT_UNIQUE
+			{ 0xC0000715, 0x01B3AE, 0x01B3CB, 29, 66 }, // STATUS_SYMLINK_CLASS_DISABLED
+			{ 0xC0000716, 0x01B40D, 0x01B42D, 32, 71 }, // STATUS_INVALID_IDN_NORMALIZATION
+			{ 0xC0000717, 0x01B474, 0x00F144, 29, 79 }, // STATUS_NO_UNICODE_TRANSLATION
+			{ 0xC0000718, 0x01B491, 0x01B4AA, 25, 44 }, // STATUS_ALREADY_REGISTERED
+			{ 0xC0000719, 0x01B4D6, 0x01B4ED, 23, 46 }, // STATUS_CONTEXT_MISMATCH
+			{ 0xC000071A, 0x01B51B, 0x01B542, 39, 49 }, // STATUS_PORT_ALREADY_HAS_COMPLETION_LIST
+			{ 0xC000071B, 0x01B573, 0x01B59B, 40, 181 }, // STATUS_CALLBACK_RETURNED_THREAD_PRIORITY
+			{ 0xC000071C, 0x01B650, 0x01B665, 21, 114 }, // STATUS_INVALID_THREAD
+			{ 0xC000071D, 0x01B6D7, 0x01B6FB, 36, 156 }, // STATUS_CALLBACK_RETURNED_TRANSACTION
+			{ 0xC000071E, 0x01B797, 0x01B7B8, 33, 153 }, // STATUS_CALLBACK_RETURNED_LDR_LOCK
+			{ 0xC000071F, 0x01B851, 0x01B86E, 29, 156 }, // STATUS_CALLBACK_RETURNED_LANG
+			{ 0xC0000720, 0x01B90A, 0x01B92B, 33, 178 }, // STATUS_CALLBACK_RETURNED_PRI_BACK
+			{ 0xC0000721, 0x01B9DD, 0x01BA05, 40, 172 }, // STATUS_CALLBACK_RETURNED_THREAD_AFFINITY
+			{ 0xC0000800, 0x01BAB1, 0x01BACC, 27, 60 }, // STATUS_DISK_REPAIR_DISABLED
+			{ 0xC0000801, 0x01BB08, 0x01BB2B, 35, 110 }, // STATUS_DS_DOMAIN_RENAME_IN_PROGRESS
+			{ 0xC0000802, 0x01BB99, 0x01BBB3, 26, 219 }, // STATUS_DISK_QUOTA_EXCEEDED
+			{ 0xC0000804, 0x01BC8E, 0x01BCA4, 22, 145 }, // STATUS_CONTENT_BLOCKED
+			{ 0xC0000805, 0x01BD35, 0x01BD48, 19, 65 }, // STATUS_BAD_CLUSTERS
+			{ 0xC0000806, 0x01BD89, 0x01BD9C, 19, 98 }, // STATUS_VOLUME_DIRTY
+			{ 0xC0000901, 0x01BDFE, 0x01BE15, 23, 63 }, // STATUS_FILE_CHECKED_OUT
+			{ 0xC0000902, 0x01BE54, 0x01BE6C, 24, 51 }, // STATUS_CHECKOUT_REQUIRED
+			{ 0xC0000903, 0x01BE9F, 0x01BEB3, 20, 56 }, // STATUS_BAD_FILE_TYPE
+			{ 0xC0000904, 0x01BEEB, 0x01BF00, 21, 60 }, // STATUS_FILE_TOO_LARGE
+			{ 0xC0000905, 0x01BF3C, 0x01BF56, 26, 137 }, // STATUS_FORMS_AUTH_REQUIRED
+			{ 0xC0000906, 0x01BFDF, 0x01BFF4, 21, 74 }, // STATUS_VIRUS_INFECTED
+			{ 0xC0000907, 0x01C03E, 0x01C052, 20, 127 }, // STATUS_VIRUS_DELETED
+			{ 0xC0000908, 0x01C0D1, 0x01C0E6, 21, 68 }, // STATUS_BAD_MCFG_TABLE
+			{ 0xC0000909, 0x01C12A, 0x01C144, 26, 152 }, // STATUS_CANNOT_BREAK_OPLOCK
+			{ 0xC0009898, 0x01C1DC, 0x01C1F0, 20, 20 }, // STATUS_WOW_ASSERTION
+			{ 0xC000A000, 0x01C204, 0x01C21C, 24, 39 }, // STATUS_INVALID_SIGNATURE
+			{ 0xC000A001, 0x01C243, 0x01C25C, 25, 49 }, // STATUS_HMAC_NOT_SUPPORTED
+			{ 0xC000A002, 0x01C28D, 0x01C2A5, 24, 75 }, // STATUS_AUTH_TAG_MISMATCH
+			{ 0xC000A010, 0x01C2F0, 0x01C30B, 27, 27 }, // STATUS_IPSEC_QUEUE_OVERFLOW
+			{ 0xC000A011, 0x01C326, 0x01C33E, 24, 40 }, // STATUS_ND_QUEUE_OVERFLOW
+			{ 0xC000A012, 0x01C366, 0x01C37E, 24, 46 }, // STATUS_HOPLIMIT_EXCEEDED
+			{ 0xC000A013, 0x01C3AC, 0x01C3C9, 29, 51 }, // STATUS_PROTOCOL_NOT_SUPPORTED
+			{ 0xC000A014, 0x01C3FC, 0x01C414, 24, 70 }, // STATUS_FASTPATH_REJECTED
+			{ 0xC000A080, 0x01C45A, 0x01C48B, 49, 201 }, // STATUS_LOST_WRITEBEHIND_DATA_NETWORK_DISCONNECTED
+			{ 0xC000A081, 0x01C554, 0x01C585, 49, 208 }, // STATUS_LOST_WRITEBEHIND_DATA_NETWORK_SERVER_ERROR
+			{ 0xC000A082, 0x01C655, 0x01C682, 45, 193 }, // STATUS_LOST_WRITEBEHIND_DATA_LOCAL_DISK_ERROR
+			{ 0xC000A083, 0x01C743, 0x01C759, 22, 51 }, // STATUS_XML_PARSE_ERROR
+			{ 0xC000A084, 0x01C78C, 0x01C7A0, 20, 67 }, // STATUS_XMLDSIG_ERROR
+			{ 0xC000A085, 0x01C7E3, 0x01C7FB, 24, 87 }, // STATUS_WRONG_COMPARTMENT
+			{ 0xC000A086, 0x01C852, 0x01C867, 21, 89 }, // STATUS_AUTHIP_FAILURE
+			{ 0xC000A087, 0x01C8C0, 0x01C8EC, 44, 38 }, // STATUS_DS_OID_MAPPED_GROUP_CANT_HAVE_MEMBERS
+			{ 0xC000A088, 0x01C912, 0x01C929, 23, 34 }, // STATUS_DS_OID_NOT_FOUND
+			{ 0xC000A100, 0x01C94B, 0x01C964, 25, 81 }, // STATUS_HASH_NOT_SUPPORTED
+			{ 0xC000A101, 0x01C9B5, 0x01C9CC, 23, 82 }, // STATUS_HASH_NOT_PRESENT
+			{ 0xC0010001, 0x01CA1E, 0x01CA31, 19, 40 }, // DBG_NO_STATE_CHANGE
+			{ 0xC0010002, 0x01CA59, 0x01CA69, 16, 47 }, // DBG_APP_NOT_IDLE
+			{ 0xC0020001, 0x01CA98, 0x01CAB5, 29, 30 }, // RPC_NT_INVALID_STRING_BINDING
+			{ 0xC0020002, 0x01CAD3, 0x01CAEF, 28, 43 }, // RPC_NT_WRONG_KIND_OF_BINDING
+			{ 0xC0020003, 0x01CB1A, 0x01CB30, 22, 30 }, // RPC_NT_INVALID_BINDING
+			{ 0xC0020004, 0x01CB4E, 0x01CB6A, 28, 43 }, // RPC_NT_PROTSEQ_NOT_SUPPORTED
+			{ 0xC0020005, 0x01CB95, 0x01CBAF, 26, 37 }, // RPC_NT_INVALID_RPC_PROTSEQ
+			{ 0xC0020006, 0x01CBD4, 0x01CBEE, 26, 27 }, // RPC_NT_INVALID_STRING_UUID
+			{ 0xC0020007, 0x01CC09, 0x01CC27, 30, 31 }, // RPC_NT_INVALID_ENDPOINT_FORMAT
+			{ 0xC0020008, 0x01CC46, 0x01CC5D, 23, 31 }, // RPC_NT_INVALID_NET_ADDR
+			{ 0xC0020009, 0x01CC7C, 0x01CC94, 24, 22 }, // RPC_NT_NO_ENDPOINT_FOUND
+			{ 0xC002000A, 0x01CCAA, 0x01CCC0, 22, 29 }, // RPC_NT_INVALID_TIMEOUT
+			{ 0xC002000B, 0x01CCDD, 0x01CCF4, 23, 30 }, // RPC_NT_OBJECT_NOT_FOUND
+			{ 0xC002000C, 0x01CD12, 0x01CD2B, 25, 44 }, // RPC_NT_ALREADY_REGISTERED
+			{ 0xC002000D, 0x01CD57, 0x01CD75, 30, 42 }, // RPC_NT_TYPE_ALREADY_REGISTERED
+			{ 0xC002000E, 0x01CD9F, 0x01CDB7, 24, 36 }, // RPC_NT_ALREADY_LISTENING
+			{ 0xC002000F, 0x01CDDB, 0x01CDF8, 29, 43 }, // RPC_NT_NO_PROTSEQS_REGISTERED
+			{ 0xC0020010, 0x01CE23, 0x01CE37, 20, 32 }, // RPC_NT_NOT_LISTENING
+			{ 0xC0020011, 0x01CE57, 0x01CE6E, 23, 28 }, // RPC_NT_UNKNOWN_MGR_TYPE
+			{ 0xC0020012, 0x01CE8A, 0x01CE9B, 17, 25 }, // RPC_NT_UNKNOWN_IF
+			{ 0xC0020013, 0x01CEB4, 0x01CEC6, 18, 22 }, // RPC_NT_NO_BINDINGS
+			{ 0xC0020014, 0x01CEDC, 0x01CEEE, 18, 32 }, // RPC_NT_NO_PROTSEQS
+			{ 0xC0020015, 0x01CF0E, 0x01CF29, 27, 31 }, // RPC_NT_CANT_CREATE_ENDPOINT
+			{ 0xC0020016, 0x01CF48, 0x01CF5F, 23, 62 }, // RPC_NT_OUT_OF_RESOURCES
+			{ 0xC0020017, 0x01CF9D, 0x01CFB6, 25, 30 }, // RPC_NT_SERVER_UNAVAILABLE
+			{ 0xC0020018, 0x01CFD4, 0x01CFEA, 22, 54 }, // RPC_NT_SERVER_TOO_BUSY
+			{ 0xC0020019, 0x01D020, 0x01D03E, 30, 32 }, // RPC_NT_INVALID_NETWORK_OPTIONS
+			{ 0xC002001A, 0x01D05E, 0x01D073, 21, 58 }, // RPC_NT_NO_CALL_ACTIVE
+			{ 0xC002001B, 0x01D0AD, 0x01D0BF, 18, 33 }, // RPC_NT_CALL_FAILED
+			{ 0xC002001C, 0x01D0E0, 0x01D0F6, 22, 53 }, // RPC_NT_CALL_FAILED_DNE
+			{ 0xC002001D, 0x01D12B, 0x01D140, 21, 31 }, // RPC_NT_PROTOCOL_ERROR
+			{ 0xC002001F, 0x01D15F, 0x01D17B, 28, 55 }, // RPC_NT_UNSUPPORTED_TRANS_SYN
+			{ 0xC0020021, 0x01D1B2, 0x01D1C9, 23, 31 }, // RPC_NT_UNSUPPORTED_TYPE
+			{ 0xC0020022, 0x01D1E8, 0x01D1FA, 18, 19 }, // RPC_NT_INVALID_TAG
+			{ 0xC0020023, 0x01D20D, 0x01D221, 20, 29 }, // RPC_NT_INVALID_BOUND
+			{ 0xC0020024, 0x01D23E, 0x01D252, 20, 43 }, // RPC_NT_NO_ENTRY_NAME
+			{ 0xC0020025, 0x01D27D, 0x01D297, 26, 27 }, // RPC_NT_INVALID_NAME_SYNTAX
+			{ 0xC0020026, 0x01D2B2, 0x01D2D0, 30, 33 }, // RPC_NT_UNSUPPORTED_NAME_SYNTAX
+			{ 0xC0020028, 0x01D2F1, 0x01D307, 22, 59 }, // RPC_NT_UUID_NO_ADDRESS
+			{ 0xC0020029, 0x01D342, 0x01D35B, 25, 28 }, // RPC_NT_DUPLICATE_ENDPOINT
+			{ 0xC002002A, 0x01D377, 0x01D390, 25, 35 }, // RPC_NT_UNKNOWN_AUTHN_TYPE
+			{ 0xC002002B, 0x01D3B3, 0x01D3CD, 26, 41 }, // RPC_NT_MAX_CALLS_TOO_SMALL
+			{ 0xC002002C, 0x01D3F6, 0x01D40C, 22, 23 }, // RPC_NT_STRING_TOO_LONG
+			{ 0xC002002D, 0x01D423, 0x01D43B, 24, 40 }, // RPC_NT_PROTSEQ_NOT_FOUND
+			{ 0xC002002E, 0x01D463, 0x01D47E, 27, 37 }, // RPC_NT_PROCNUM_OUT_OF_RANGE
+			{ 0xC002002F, 0x01D4A3, 0x01D4BD, 26, 60 }, // RPC_NT_BINDING_HAS_NO_AUTH
+			{ 0xC0020030, 0x01D4F9, 0x01D515, 28, 38 }, // RPC_NT_UNKNOWN_AUTHN_SERVICE
+			{ 0xC0020031, 0x01D53B, 0x01D555, 26, 36 }, // RPC_NT_UNKNOWN_AUTHN_LEVEL
+			{ 0xC0020032, 0x01D579, 0x01D595, 28, 32 }, // RPC_NT_INVALID_AUTH_IDENTITY
+			{ 0xC0020033, 0x01D5B5, 0x01D5D1, 28, 37 }, // RPC_NT_UNKNOWN_AUTHZ_SERVICE
+			{ 0xC0020034, 0x01D5F6, 0x01D60A, 20, 21 }, // EPT_NT_INVALID_ENTRY
+			{ 0xC0020035, 0x01D61F, 0x01D635, 22, 34 }, // EPT_NT_CANT_PERFORM_OP
+			{ 0xC0020036, 0x01D657, 0x01D66C, 21, 63 }, // EPT_NT_NOT_REGISTERED
+			{ 0xC0020037, 0x01D6AB, 0x01D6C3, 24, 33 }, // RPC_NT_NOTHING_TO_EXPORT
+			{ 0xC0020038, 0x01D6E4, 0x01D6FA, 22, 29 }, // RPC_NT_INCOMPLETE_NAME
+			{ 0xC0020039, 0x01D717, 0x01D731, 26, 30 }, // RPC_NT_INVALID_VERS_OPTION
+			{ 0xC002003A, 0x01D74F, 0x01D765, 22, 26 }, // RPC_NT_NO_MORE_MEMBERS
+			{ 0xC002003B, 0x01D77F, 0x01D79D, 30, 29 }, // RPC_NT_NOT_ALL_OBJS_UNEXPORTED
+			{ 0xC002003C, 0x01D7BA, 0x01D7D4, 26, 28 }, // RPC_NT_INTERFACE_NOT_FOUND
+			{ 0xC002003D, 0x01D7F0, 0x01D80B, 27, 25 }, // RPC_NT_ENTRY_ALREADY_EXISTS
+			{ 0xC002003E, 0x01D824, 0x01D83A, 22, 23 }, // RPC_NT_ENTRY_NOT_FOUND
+			{ 0xC002003F, 0x01D851, 0x01D870, 31, 32 }, // RPC_NT_NAME_SERVICE_UNAVAILABLE
+			{ 0xC0020040, 0x01D890, 0x01D8A5, 21, 38 }, // RPC_NT_INVALID_NAF_ID
+			{ 0xC0020041, 0x01D8CB, 0x01D8E0, 21, 41 }, // RPC_NT_CANNOT_SUPPORT
+			{ 0xC0020042, 0x01D909, 0x01D924, 27, 56 }, // RPC_NT_NO_CONTEXT_AVAILABLE
+			{ 0xC0020043, 0x01D95C, 0x01D971, 21, 34 }, // RPC_NT_INTERNAL_ERROR
+			{ 0xC0020044, 0x01D993, 0x01D9A5, 18, 51 }, // RPC_NT_ZERO_DIVIDE
+			{ 0xC0020045, 0x01D9D8, 0x01D9EC, 20, 47 }, // RPC_NT_ADDRESS_ERROR
+			{ 0xC0020046, 0x01DA1B, 0x01DA2D, 18, 69 }, // RPC_NT_FP_DIV_ZERO
+			{ 0xC0020047, 0x01DA72, 0x01DA85, 19, 54 }, // RPC_NT_FP_UNDERFLOW
+			{ 0xC0020048, 0x01DABB, 0x01DACD, 18, 53 }, // RPC_NT_FP_OVERFLOW
+			{ 0xC0020049, 0x01DB02, 0x01DB19, 23, 63 }, // RPC_NT_CALL_IN_PROGRESS
+			{ 0xC002004A, 0x01DB58, 0x01DB6F, 23, 27 }, // RPC_NT_NO_MORE_BINDINGS
+			{ 0xC002004B, 0x01DB8A, 0x01DBA7, 29, 31 }, // RPC_NT_GROUP_MEMBER_NOT_FOUND
+			{ 0xC002004C, 0x01DBC6, 0x01DBD8, 18, 56 }, // EPT_NT_CANT_CREATE
+			{ 0xC002004D, 0x01DC10, 0x01DC25, 21, 32 }, // RPC_NT_INVALID_OBJECT
+			{ 0xC002004F, 0x01DC45, 0x01DC59, 20, 35 }, // RPC_NT_NO_INTERFACES
+			{ 0xC0020050, 0x01DC7C, 0x01DC91, 21, 40 }, // RPC_NT_CALL_CANCELLED
+			{ 0xC0020051, 0x01DCB9, 0x01DCD2, 25, 61 }, // RPC_NT_BINDING_INCOMPLETE
+			{ 0xC0020052, 0x01DD0F, 0x01DD22, 19, 65 }, // RPC_NT_COMM_FAILURE
+			{ 0xC0020053, 0x01DD63, 0x01DD81, 30, 52 }, // RPC_NT_UNSUPPORTED_AUTHN_LEVEL
+			{ 0xC0020054, 0x01DDB5, 0x01DDC9, 20, 29 }, // RPC_NT_NO_PRINC_NAME
+			{ 0xC0020055, 0x01DDE6, 0x01DDFA, 20, 58 }, // RPC_NT_NOT_RPC_ERROR
+			{ 0xC0020057, 0x01DE34, 0x01DE48, 20, 43 }, // RPC_NT_SEC_PKG_ERROR
+			{ 0xC0020058, 0x01DE73, 0x01DE87, 20, 24 }, // RPC_NT_NOT_CANCELLED
+			{ 0xC0020062, 0x01DE9F, 0x01DEBA, 27, 50 }, // RPC_NT_INVALID_ASYNC_HANDLE
+			{ 0xC0020063, 0x01DEEC, 0x01DF05, 25, 56 }, // RPC_NT_INVALID_ASYNC_CALL
+			{ 0xC0020064, 0x01DF3D, 0x01DF57, 26, 35 }, // RPC_NT_PROXY_ACCESS_DENIED
+			{ 0xC0020065, 0x01DF7A, 0x01DF93, 25, 83 }, // RPC_NT_COOKIE_AUTH_FAILED
+			{ 0xC0030001, 0x01DFE6, 0x01DFFC, 22, 77 }, // RPC_NT_NO_MORE_ENTRIES
+			{ 0xC0030002, 0x01E049, 0x01E067, 30, 56 }, // RPC_NT_SS_CHAR_TRANS_OPEN_FAIL
+			{ 0xC0030003, 0x01E09F, 0x01E0BE, 31, 77 }, // RPC_NT_SS_CHAR_TRANS_SHORT_FILE
+			{ 0xC0030004, 0x01E10B, 0x01E124, 25, 53 }, // RPC_NT_SS_IN_NULL_CONTEXT
+			{ 0xC0030005, 0x01E159, 0x01E173, 26, 60 }, // RPC_NT_SS_CONTEXT_MISMATCH
+			{ 0xC0030006, 0x01E1AF, 0x01E1C8, 25, 41 }, // RPC_NT_SS_CONTEXT_DAMAGED
+			{ 0xC0030007, 0x01E1F1, 0x01E20B, 26, 67 }, // RPC_NT_SS_HANDLES_MISMATCH
+			{ 0xC0030008, 0x01E24E, 0x01E26E, 32, 42 }, // RPC_NT_SS_CANNOT_GET_CALL_HANDLE
+			{ 0xC0030009, 0x01E298, 0x01E2AF, 23, 48 }, // RPC_NT_NULL_REF_POINTER
+			{ 0xC003000A, 0x01E2DF, 0x01E2FD, 30, 38 }, // RPC_NT_ENUM_VALUE_OUT_OF_RANGE
+			{ 0xC003000B, 0x01E323, 0x01E33E, 27, 28 }, // RPC_NT_BYTE_COUNT_TOO_SMALL
+			{ 0xC003000C, 0x01E35A, 0x01E36E, 20, 27 }, // RPC_NT_BAD_STUB_DATA
+			{ 0xC0030059, 0x01E389, 0x01E3A1, 24, 50 }, // RPC_NT_INVALID_ES_ACTION
+			{ 0xC003005A, 0x01E3D3, 0x01E3EA, 23, 48 }, // RPC_NT_WRONG_ES_VERSION
+			{ 0xC003005B, 0x01E41A, 0x01E433, 25, 37 }, // RPC_NT_WRONG_STUB_VERSION
+			{ 0xC003005C, 0x01E458, 0x01E472, 26, 44 }, // RPC_NT_INVALID_PIPE_OBJECT
+			{ 0xC003005D, 0x01E49E, 0x01E4BB, 29, 57 }, // RPC_NT_INVALID_PIPE_OPERATION
+			{ 0xC003005E, 0x01E4F4, 0x01E50D, 25, 29 }, // RPC_NT_WRONG_PIPE_VERSION
+			{ 0xC003005F, 0x01E52A, 0x01E53C, 18, 44 }, // RPC_NT_PIPE_CLOSED
+			{ 0xC0030060, 0x01E568, 0x01E584, 28, 55 }, // RPC_NT_PIPE_DISCIPLINE_ERROR
+			{ 0xC0030061, 0x01E5BB, 0x01E5CC, 17, 44 }, // RPC_NT_PIPE_EMPTY
+			{ 0xC0040035, 0x01E5F8, 0x01E610, 24, 137 }, // STATUS_PNP_BAD_MPS_TABLE
+			{ 0xC0040036, 0x01E699, 0x01E6B6, 29, 43 }, // STATUS_PNP_TRANSLATION_FAILED
+			{ 0xC0040037, 0x01E6E1, 0x01E702, 33, 47 }, // STATUS_PNP_IRQ_TRANSLATION_FAILED
+			{ 0xC0040038, 0x01E731, 0x01E746, 21, 54 }, // STATUS_PNP_INVALID_ID
+			{ 0xC0040039, 0x01E77C, 0x01E797, 27, 52 }, // STATUS_IO_REISSUE_AS_CACHED
+			{ 0xC00A0001, 0x01E7CB, 0x01E7ED, 34, 27 }, // STATUS_CTX_WINSTATION_NAME_INVALID
+			{ 0xC00A0002, 0x01E808, 0x01E81D, 21, 34 }, // STATUS_CTX_INVALID_PD
+			{ 0xC00A0003, 0x01E83F, 0x01E856, 23, 56 }, // STATUS_CTX_PD_NOT_FOUND
+			{ 0xC00A0006, 0x01E88E, 0x01E8A6, 24, 56 }, // STATUS_CTX_CLOSE_PENDING
+			{ 0xC00A0007, 0x01E8DE, 0x01E8F2, 20, 43 }, // STATUS_CTX_NO_OUTBUF
+			{ 0xC00A0008, 0x01E91D, 0x01E93B, 30, 33 }, // STATUS_CTX_MODEM_INF_NOT_FOUND
+			{ 0xC00A0009, 0x01E95C, 0x01E978, 28, 42 }, // STATUS_CTX_INVALID_MODEMNAME
+			{ 0xC00A000A, 0x01E9A2, 0x01E9BB, 25, 109 }, // STATUS_CTX_RESPONSE_ERROR
+			{ 0xC00A000B, 0x01EA28, 0x01EA49, 33, 104 }, // STATUS_CTX_MODEM_RESPONSE_TIMEOUT
+			{ 0xC00A000C, 0x01EAB1, 0x01EAD5, 36, 72 }, // STATUS_CTX_MODEM_RESPONSE_NO_CARRIER
+			{ 0xC00A000D, 0x01EB1D, 0x01EB42, 37, 100 }, // STATUS_CTX_MODEM_RESPONSE_NO_DIALTONE
+			{ 0xC00A000E, 0x01EBA6, 0x01EBC4, 30, 48 }, // STATUS_CTX_MODEM_RESPONSE_BUSY
+			{ 0xC00A000F, 0x01EBF4, 0x01EC13, 31, 42 }, // STATUS_CTX_MODEM_RESPONSE_VOICE
+			{ 0xC00A0010, 0x01EC3D, 0x01EC50, 19, 22 }, // STATUS_CTX_TD_ERROR
+			{ 0xC00A0012, 0x01EC66, 0x01EC87, 33, 90 }, // STATUS_CTX_LICENSE_CLIENT_INVALID
+			{ 0xC00A0013, 0x01ECE1, 0x01ED01, 32, 72 }, // STATUS_CTX_LICENSE_NOT_AVAILABLE
+			{ 0xC00A0014, 0x01ED49, 0x01ED63, 26, 61 }, // STATUS_CTX_LICENSE_EXPIRED
+			{ 0xC00A0015, 0x01EDA0, 0x01EDBF, 31, 38 }, // STATUS_CTX_WINSTATION_NOT_FOUND
+			{ 0xC00A0016, 0x01EDE5, 0x01EE09, 36, 45 }, // STATUS_CTX_WINSTATION_NAME_COLLISION
+			{ 0xC00A0017, 0x01EE36, 0x01EE50, 26, 178 }, // STATUS_CTX_WINSTATION_BUSY
+			{ 0xC00A0018, 0x01EF02, 0x01EF1B, 25, 105 }, // STATUS_CTX_BAD_VIDEO_MODE
+			{ 0xC00A0022, 0x01EF84, 0x01EF9F, 27, 90 }, // STATUS_CTX_GRAPHICS_INVALID
+			{ 0xC00A0024, 0x01EFF9, 0x01F00F, 22, 157 }, // STATUS_CTX_NOT_CONSOLE
+			{ 0xC00A0026, 0x01F0AC, 0x01F0CB, 31, 59 }, // STATUS_CTX_CLIENT_QUERY_TIMEOUT
+			{ 0xC00A0027, 0x01F106, 0x01F123, 29, 51 }, // STATUS_CTX_CONSOLE_DISCONNECT
+			{ 0xC00A0028, 0x01F156, 0x01F170, 26, 68 }, // STATUS_CTX_CONSOLE_CONNECT
+			{ 0xC00A002A, 0x01F1B4, 0x01F1CC, 24, 59 }, // STATUS_CTX_SHADOW_DENIED
+			{ 0xC00A002B, 0x01F207, 0x01F22A, 35, 90 }, // STATUS_CTX_WINSTATION_ACCESS_DENIED
+			{ 0xC00A002E, 0x01F284, 0x01F299, 21, 45 }, // STATUS_CTX_INVALID_WD
+			{ 0xC00A002F, 0x01F2C6, 0x01F2DD, 23, 67 }, // STATUS_CTX_WD_NOT_FOUND
+			{ 0xC00A0030, 0x01F320, 0x01F339, 25, 222 }, // STATUS_CTX_SHADOW_INVALID
+			{ 0xC00A0031, 0x01F417, 0x01F431, 26, 64 }, // STATUS_CTX_SHADOW_DISABLED
+			{ 0xC00A0032, 0x01F471, 0x01F48A, 25, 103 }, // STATUS_RDP_PROTOCOL_ERROR
+			{ 0xC00A0033, 0x01F4F1, 0x01F512, 33, 313 }, // STATUS_CTX_CLIENT_LICENSE_NOT_SET
+			{ 0xC00A0034, 0x01F64B, 0x01F66B, 32, 298 }, // STATUS_CTX_CLIENT_LICENSE_IN_USE
+			{ 0xC00A0035, 0x01F795, 0x01F7BB, 38, 158 }, // STATUS_CTX_SHADOW_ENDED_BY_MODE_CHANGE
+			{ 0xC00A0036, 0x01F859, 0x01F876, 29, 112 }, // STATUS_CTX_SHADOW_NOT_RUNNING
+			{ 0xC00A0037, 0x01F8E6, 0x01F8FF, 25, 93 }, // STATUS_CTX_LOGON_DISABLED
+			{ 0xC00A0038, 0x01F95C, 0x01F97B, 31, 123 }, // STATUS_CTX_SECURITY_LAYER_ERROR
+			{ 0xC00A0039, 0x01F9F6, 0x01FA15, 31, 60 }, // STATUS_TS_INCOMPATIBLE_SESSIONS
+			{ 0xC00A003A, 0x01FA51, 0x01FA70, 31, 176 }, // STATUS_TS_VIDEO_SUBSYSTEM_ERROR
+			{ 0xC00B0001, 0x01FB20, 0x01FB39, 25, 44 }, // STATUS_MUI_FILE_NOT_FOUND
+			{ 0xC00B0002, 0x01FB65, 0x01FB7C, 23, 85 }, // STATUS_MUI_INVALID_FILE
+			{ 0xC00B0003, 0x01FBD1, 0x01FBED, 28, 95 }, // STATUS_MUI_INVALID_RC_CONFIG
+			{ 0xC00B0004, 0x01FC4C, 0x01FC6A, 30, 41 }, // STATUS_MUI_INVALID_LOCALE_NAME
+			{ 0xC00B0005, 0x01FC93, 0x01FCBB, 40, 50 }, // STATUS_MUI_INVALID_ULTIMATEFALLBACK_NAME
+			{ 0xC00B0006, 0x01FCED, 0x01FD07, 26, 56 }, // STATUS_MUI_FILE_NOT_LOADED
+			{ 0xC00B0007, 0x01FD3F, 0x01FD5D, 30, 34 }, // STATUS_RESOURCE_ENUM_USER_STOP
+			{ 0xC0130001, 0x01FD7F, 0x01FD9A, 27, 30 }, // STATUS_CLUSTER_INVALID_NODE
+			{ 0xC0130002, 0x01FDB8, 0x01FDD2, 26, 32 }, // STATUS_CLUSTER_NODE_EXISTS
+			{ 0xC0130003, 0x01FDF2, 0x01FE11, 31, 48 }, // STATUS_CLUSTER_JOIN_IN_PROGRESS
+			{ 0xC0130004, 0x01FE41, 0x01FE5E, 29, 31 }, // STATUS_CLUSTER_NODE_NOT_FOUND
+			{ 0xC0130005, 0x01FE7D, 0x01FEA0, 35, 49 }, // STATUS_CLUSTER_LOCAL_NODE_NOT_FOUND
+			{ 0xC0130006, 0x01FED1, 0x01FEEE, 29, 35 }, // STATUS_CLUSTER_NETWORK_EXISTS
+			{ 0xC0130007, 0x01FF11, 0x01FF31, 32, 34 }, // STATUS_CLUSTER_NETWORK_NOT_FOUND
+			{ 0xC0130008, 0x01FF53, 0x01FF75, 34, 45 }, // STATUS_CLUSTER_NETINTERFACE_EXISTS
+			{ 0xC0130009, 0x01FFA2, 0x020000, 37, 44 }, // STATUS_CLUSTER_NETINTERFACE_NOT_FOUND
+			{ 0xC013000A, 0x02002C, 0x02004A, 30, 49 }, // STATUS_CLUSTER_INVALID_REQUEST
+			{ 0xC013000B, 0x02007B, 0x0200A2, 39, 42 }, // STATUS_CLUSTER_INVALID_NETWORK_PROVIDER
+			{ 0xC013000C, 0x0200CC, 0x0200E4, 24, 25 }, // STATUS_CLUSTER_NODE_DOWN
+			{ 0xC013000D, 0x0200FD, 0x02011C, 31, 34 }, // STATUS_CLUSTER_NODE_UNREACHABLE
+			{ 0xC013000E, 0x02013E, 0x02015C, 30, 48 }, // STATUS_CLUSTER_NODE_NOT_MEMBER
+			{ 0xC013000F, 0x02018C, 0x0201AF, 35, 44 }, // STATUS_CLUSTER_JOIN_NOT_IN_PROGRESS
+			{ 0xC0130010, 0x0201DB, 0x0201F9, 30, 33 }, // STATUS_CLUSTER_INVALID_NETWORK
+			{ 0xC0130011, 0x02021A, 0x020238, 30, 34 }, // STATUS_CLUSTER_NO_NET_ADAPTERS
+			{ 0xC0130012, 0x02025A, 0x020270, 22, 23 }, // STATUS_CLUSTER_NODE_UP
+			{ 0xC0130013, 0x020287, 0x0202A1, 26, 27 }, // STATUS_CLUSTER_NODE_PAUSED
+			{ 0xC0130014, 0x0202BC, 0x0202DA, 30, 31 }, // STATUS_CLUSTER_NODE_NOT_PAUSED
+			{ 0xC0130015, 0x0202F9, 0x02031B, 34, 41 }, // STATUS_CLUSTER_NO_SECURITY_CONTEXT
+			{ 0xC0130016, 0x020344, 0x020367, 35, 73 }, // STATUS_CLUSTER_NETWORK_NOT_INTERNAL
+			{ 0xC0130017, 0x0203B0, 0x0203C7, 23, 35 }, // STATUS_CLUSTER_POISONED
+			{ 0xC0130018, 0x0203EA, 0x020405, 27, 52 }, // STATUS_CLUSTER_NON_CSV_PATH
+			{ 0xC0130019, 0x020439, 0x02045C, 35, 49 }, // STATUS_CLUSTER_CSV_VOLUME_NOT_LOCAL
+			{ 0xC0140001, 0x02048D, 0x0204A7, 26, 48 }, // STATUS_ACPI_INVALID_OPCODE
+			{ 0xC0140002, 0x0204D7, 0x0204F1, 26, 40 }, // STATUS_ACPI_STACK_OVERFLOW
+			{ 0xC0140003, 0x020519, 0x020532, 25, 34 }, // STATUS_ACPI_ASSERT_FAILED
+			{ 0xC0140004, 0x020554, 0x02056D, 25, 60 }, // STATUS_ACPI_INVALID_INDEX
+			{ 0xC0140005, 0x0205A9, 0x0205C5, 28, 37 }, // STATUS_ACPI_INVALID_ARGUMENT
+			{ 0xC0140006, 0x0205EA, 0x0205FB, 17, 26 }, // STATUS_ACPI_FATAL
+			{ 0xC0140007, 0x020615, 0x020632, 29, 34 }, // STATUS_ACPI_INVALID_SUPERNAME
+			{ 0xC0140008, 0x020654, 0x02066F, 27, 48 }, // STATUS_ACPI_INVALID_ARGTYPE
+			{ 0xC0140009, 0x02069F, 0x0206BA, 27, 46 }, // STATUS_ACPI_INVALID_OBJTYPE
+			{ 0xC014000A, 0x0206E8, 0x020706, 30, 45 }, // STATUS_ACPI_INVALID_TARGETTYPE
+			{ 0xC014000B, 0x020733, 0x020757, 36, 47 }, // STATUS_ACPI_INCORRECT_ARGUMENT_COUNT
+			{ 0xC014000C, 0x020786, 0x0207A4, 30, 30 }, // STATUS_ACPI_ADDRESS_NOT_MAPPED
+			{ 0xC014000D, 0x0207C2, 0x0207DF, 29, 37 }, // STATUS_ACPI_INVALID_EVENTTYPE
+			{ 0xC014000E, 0x020804, 0x020821, 29, 39 }, // STATUS_ACPI_HANDLER_COLLISION
+			{ 0xC014000F, 0x020848, 0x020860, 24, 41 }, // STATUS_ACPI_INVALID_DATA
+			{ 0xC0140010, 0x020889, 0x0208A3, 26, 46 }, // STATUS_ACPI_INVALID_REGION
+			{ 0xC0140011, 0x0208D1, 0x0208F0, 31, 66 }, // STATUS_ACPI_INVALID_ACCESS_SIZE
+			{ 0xC0140012, 0x020932, 0x020951, 31, 44 }, // STATUS_ACPI_ACQUIRE_GLOBAL_LOCK
+			{ 0xC0140013, 0x02097D, 0x02099C, 31, 54 }, // STATUS_ACPI_ALREADY_INITIALIZED
+			{ 0xC0140014, 0x0209D2, 0x0209ED, 27, 43 }, // STATUS_ACPI_NOT_INITIALIZED
+			{ 0xC0140015, 0x020A18, 0x020A37, 31, 32 }, // STATUS_ACPI_INVALID_MUTEX_LEVEL
+			{ 0xC0140016, 0x020A57, 0x020A72, 27, 32 }, // STATUS_ACPI_MUTEX_NOT_OWNED
+			{ 0xC0140017, 0x020A92, 0x020AAD, 27, 75 }, // STATUS_ACPI_MUTEX_NOT_OWNER
+			{ 0xC0140018, 0x020AF8, 0x020B0D, 21, 50 }, // STATUS_ACPI_RS_ACCESS
+			{ 0xC0140019, 0x020B3F, 0x020B58, 25, 45 }, // STATUS_ACPI_INVALID_TABLE
+			{ 0xC0140020, 0x020B85, 0x020BA3, 30, 40 }, // STATUS_ACPI_REG_HANDLER_FAILED
+			{ 0xC0140021, 0x020BCB, 0x020BEB, 32, 47 }, // STATUS_ACPI_POWER_REQUEST_FAILED
+			{ 0xC0150001, 0x020C1A, 0x020C36, 28, 63 }, // STATUS_SXS_SECTION_NOT_FOUND
+			{ 0xC0150002, 0x020C75, 0x020C8F, 26, 131 }, // STATUS_SXS_CANT_GEN_ACTCTX
+			{ 0xC0150003, 0x020D12, 0x020D36, 36, 47 }, // STATUS_SXS_INVALID_ACTCTXDATA_FORMAT
+			{ 0xC0150004, 0x020D65, 0x020D82, 29, 56 }, // STATUS_SXS_ASSEMBLY_NOT_FOUND
+			{ 0xC0150005, 0x020DBA, 0x020DDA, 32, 78 }, // STATUS_SXS_MANIFEST_FORMAT_ERROR
+			{ 0xC0150006, 0x020E28, 0x020E47, 31, 53 }, // STATUS_SXS_MANIFEST_PARSE_ERROR
+			{ 0xC0150007, 0x020E7C, 0x020EA2, 38, 68 }, // STATUS_SXS_ACTIVATION_CONTEXT_DISABLED
+			{ 0xC0150008, 0x020EE6, 0x020EFE, 24, 72 }, // STATUS_SXS_KEY_NOT_FOUND
+			{ 0xC0150009, 0x020F46, 0x020F61, 27, 104 }, // STATUS_SXS_VERSION_CONFLICT
+			{ 0xC015000A, 0x020FC9, 0x020FE6, 29, 80 }, // STATUS_SXS_WRONG_SECTION_TYPE
+			{ 0xC015000B, 0x021036, 0x021058, 34, 109 }, // STATUS_SXS_THREAD_QUERIES_DISABLED
+			{ 0xC015000C, 0x0210C5, 0x0210E0, 27, 43 }, // STATUS_SXS_ASSEMBLY_MISSING
+			{ 0xC015000E, 0x02110B, 0x021131, 38, 127 }, // STATUS_SXS_PROCESS_DEFAULT_ALREADY_SET
+			{ 0xC015000F, 0x0211B0, 0x0211CD, 29, 80 }, // STATUS_SXS_EARLY_DEACTIVATION
+			{ 0xC0150010, 0x02121D, 0x02123C, 31, 91 }, // STATUS_SXS_INVALID_DEACTIVATION
+			{ 0xC0150011, 0x021297, 0x0212B7, 32, 70 }, // STATUS_SXS_MULTIPLE_DEACTIVATION
+			{ 0xC0150012, 0x0212FD, 0x02132F, 50, 73 }, // STATUS_SXS_SYSTEM_DEFAULT_ACTIVATION_CONTEXT_EMPTY
+			{ 0xC0150013, 0x021378, 0x0213A0, 40, 82 }, // STATUS_SXS_PROCESS_TERMINATION_REQUESTED
+			{ 0xC0150014, 0x0213F2, 0x021415, 35, 87 }, // STATUS_SXS_CORRUPT_ACTIVATION_STACK
+			{ 0xC0150015, 0x02146C, 0x021481, 21, 81 }, // STATUS_SXS_CORRUPTION
+			{ 0xC0150016, 0x0214D2, 0x0214FD, 43, 71 }, // STATUS_SXS_INVALID_IDENTITY_ATTRIBUTE_VALUE
+			{ 0xC0150017, 0x021544, 0x02156E, 42, 70 }, // STATUS_SXS_INVALID_IDENTITY_ATTRIBUTE_NAME
+			{ 0xC0150018, 0x0215B4, 0x0215DB, 39, 60 }, // STATUS_SXS_IDENTITY_DUPLICATE_ATTRIBUTE
+			{ 0xC0150019, 0x021617, 0x021636, 31, 155 }, // STATUS_SXS_IDENTITY_PARSE_ERROR
+			{ 0xC015001A, 0x0216D1, 0x0216F3, 34, 39 }, // STATUS_SXS_COMPONENT_STORE_CORRUPT
+			{ 0xC015001B, 0x02171A, 0x021737, 29, 97 }, // STATUS_SXS_FILE_HASH_MISMATCH
+			{ 0xC015001C, 0x021798, 0x0217D0, 56, 79 }, // STATUS_SXS_MANIFEST_IDENTITY_SAME_BUT_CONTENTS_DIFFERENT
+			{ 0xC015001D, 0x02181F, 0x02183E, 31, 39 }, // STATUS_SXS_IDENTITIES_DIFFERENT
+			{ 0xC015001E, 0x021865, 0x02188C, 39, 33 }, // STATUS_SXS_ASSEMBLY_IS_NOT_A_DEPLOYMENT
+			{ 0xC015001F, 0x0218AD, 0x0218D1, 36, 39 }, // STATUS_SXS_FILE_NOT_PART_OF_ASSEMBLY
+			{ 0xC0150020, 0x0218F8, 0x021918, 32, 55 }, // STATUS_ADVANCED_INSTALLER_FAILED
+			{ 0xC0150021, 0x02194F, 0x02196B, 28, 94 }, // STATUS_XML_ENCODING_MISMATCH
+			{ 0xC0150022, 0x0219C9, 0x0219E4, 27, 53 }, // STATUS_SXS_MANIFEST_TOO_BIG
+			{ 0xC0150023, 0x021A19, 0x021A3A, 33, 30 }, // STATUS_SXS_SETTING_NOT_REGISTERED
+			{ 0xC0150024, 0x021A58, 0x021A81, 41, 64 }, // STATUS_SXS_TRANSACTION_CLOSURE_INCOMPLETE
+			{ 0xC0150025, 0x021AC1, 0x021AE6, 37, 61 }, // STATUS_SMI_PRIMITIVE_INSTALLER_FAILED
+			{ 0xC0150026, 0x021B23, 0x021B40, 29, 70 }, // STATUS_GENERIC_COMMAND_FAILED
+			{ 0xC0150027, 0x021B86, 0x021BA2, 28, 69 }, // STATUS_SXS_FILE_HASH_MISSING
+			{ 0xC0190001, 0x021BE7, 0x021C04, 29, 85 }, // STATUS_TRANSACTIONAL_CONFLICT
+			{ 0xC0190002, 0x021C59, 0x021C73, 26, 67 }, // STATUS_INVALID_TRANSACTION
+			{ 0xC0190003, 0x021CB6, 0x021CD3, 29, 90 }, // STATUS_TRANSACTION_NOT_ACTIVE
+			{ 0xC0190004, 0x021D2D, 0x021D4C, 31, 107 }, // STATUS_TM_INITIALIZATION_FAILED
+			{ 0xC0190005, 0x021DB7, 0x021DCB, 20, 106 }, // STATUS_RM_NOT_ACTIVE
+			{ 0xC0190006, 0x021E35, 0x021E4F, 26, 68 }, // STATUS_RM_METADATA_CORRUPT
+			{ 0xC0190007, 0x021E93, 0x021EB0, 29, 96 }, // STATUS_TRANSACTION_NOT_JOINED
+			{ 0xC0190008, 0x021F10, 0x021F27, 23, 72 }, // STATUS_DIRECTORY_NOT_RM
+			{ 0xC019000A, 0x021F6F, 0x021F95, 38, 71 }, // STATUS_TRANSACTIONS_UNSUPPORTED_REMOTE
+			{ 0xC019000B, 0x021FDC, 0x021FFA, 30, 71 }, // STATUS_LOG_RESIZE_INVALID_SIZE
+			{ 0xC019000C, 0x022041, 0x022064, 35, 93 }, // STATUS_REMOTE_FILE_VERSION_MISMATCH
+			{ 0xC019000F, 0x0220C1, 0x0220E3, 34, 56 }, // STATUS_CRM_PROTOCOL_ALREADY_EXISTS
+			{ 0xC0190010, 0x02211B, 0x022140, 37, 48 }, // STATUS_TRANSACTION_PROPAGATION_FAILED
+			{ 0xC0190011, 0x022170, 0x02218D, 29, 63 }, // STATUS_CRM_PROTOCOL_NOT_FOUND
+			{ 0xC0190012, 0x0221CC, 0x0221EE, 34, 181 }, // STATUS_TRANSACTION_SUPERIOR_EXISTS
+			{ 0xC0190013, 0x0222A3, 0x0222C7, 36, 84 }, // STATUS_TRANSACTION_REQUEST_NOT_VALID
+			{ 0xC0190014, 0x02231B, 0x02233B, 32, 140 }, // STATUS_TRANSACTION_NOT_REQUESTED
+			{ 0xC0190015, 0x0223C7, 0x0223E9, 34, 98 }, // STATUS_TRANSACTION_ALREADY_ABORTED
+			{ 0xC0190016, 0x02244B, 0x02246F, 36, 100 }, // STATUS_TRANSACTION_ALREADY_COMMITTED
+			{ 0xC0190017, 0x0224D3, 0x0224FD, 42, 88 }, // STATUS_TRANSACTION_INVALID_MARSHALL_BUFFER
+			{ 0xC0190018, 0x022555, 0x022579, 36, 105 }, // STATUS_CURRENT_TRANSACTION_NOT_VALID
+			{ 0xC0190019, 0x0225E2, 0x0225FA, 24, 133 }, // STATUS_LOG_GROWTH_FAILED
+			{ 0xC0190021, 0x02267F, 0x02269D, 30, 113 }, // STATUS_OBJECT_NO_LONGER_EXISTS
+			{ 0xC0190022, 0x02270E, 0x022731, 35, 75 }, // STATUS_STREAM_MINIVERSION_NOT_FOUND
+			{ 0xC0190023, 0x02277C, 0x02279F, 35, 121 }, // STATUS_STREAM_MINIVERSION_NOT_VALID
+			{ 0xC0190024, 0x022818, 0x022852, 58, 83 }, // STATUS_MINIVERSION_INACCESSIBLE_FROM_SPECIFIED_TRANSACTION
+			{ 0xC0190025, 0x0228A5, 0x0228D4, 47, 60 }, // STATUS_CANT_OPEN_MINIVERSION_WITH_MODIFY_INTENT
+			{ 0xC0190026, 0x022910, 0x02293B, 43, 67 }, // STATUS_CANT_CREATE_MORE_STREAM_MINIVERSIONS
+			{ 0xC0190028, 0x02297E, 0x02299B, 29, 189 }, // STATUS_HANDLE_NO_LONGER_VALID
+			{ 0xC0190030, 0x022A58, 0x022A76, 30, 24 }, // STATUS_LOG_CORRUPTION_DETECTED
+			{ 0xC0190032, 0x022A8E, 0x022AA4, 22, 104 }, // STATUS_RM_DISCONNECTED
+			{ 0xC0190033, 0x022B0C, 0x022B2A, 30, 89 }, // STATUS_ENLISTMENT_NOT_SUPERIOR
+			{ 0xC0190036, 0x022B83, 0x022BA6, 35, 116 }, // STATUS_FILE_IDENTITY_NOT_PERSISTENT
+			{ 0xC0190037, 0x022C1A, 0x022C44, 42, 122 }, // STATUS_CANT_BREAK_TRANSACTIONAL_DEPENDENCY
+			{ 0xC0190038, 0x022CBE, 0x022CDB, 29, 112 }, // STATUS_CANT_CROSS_RM_BOUNDARY
+			{ 0xC0190039, 0x022D4B, 0x022D63, 24, 63 }, // STATUS_TXF_DIR_NOT_EMPTY
+			{ 0xC019003A, 0x022DA2, 0x022DC3, 33, 113 }, // STATUS_INDOUBT_TRANSACTIONS_EXIST
+			{ 0xC019003B, 0x022E34, 0x022E46, 18, 89 }, // STATUS_TM_VOLATILE
+			{ 0xC019003C, 0x022E9F, 0x022EBC, 29, 124 }, // STATUS_ROLLBACK_TIMER_EXPIRED
+			{ 0xC019003D, 0x022F38, 0x022F54, 28, 92 }, // STATUS_TXF_ATTRIBUTE_CORRUPT
+			{ 0xC019003E, 0x022FB0, 0x022FD5, 37, 80 }, // STATUS_EFS_NOT_ALLOWED_IN_TRANSACTION
+			{ 0xC019003F, 0x023025, 0x02304A, 37, 57 }, // STATUS_TRANSACTIONAL_OPEN_NOT_ALLOWED
+			{ 0xC0190040, 0x023083, 0x0230AF, 44, 94 }, // STATUS_TRANSACTED_MAPPING_UNSUPPORTED_REMOTE
+			{ 0xC0190043, 0x02310D, 0x023132, 37, 116 }, // STATUS_TRANSACTION_REQUIRED_PROMOTION
+			{ 0xC0190044, 0x0231A6, 0x0231CF, 41, 122 }, // STATUS_CANNOT_EXECUTE_FILE_IN_TRANSACTION
+			{ 0xC0190045, 0x023249, 0x023267, 30, 104 }, // STATUS_TRANSACTIONS_NOT_FROZEN
+			{ 0xC0190046, 0x0232CF, 0x0232F4, 37, 70 }, // STATUS_TRANSACTION_FREEZE_IN_PROGRESS
+			{ 0xC0190047, 0x02333A, 0x023354, 26, 107 }, // STATUS_NOT_SNAPSHOT_VOLUME
+			{ 0xC0190048, 0x0233BF, 0x0233E2, 35, 96 }, // STATUS_NO_SAVEPOINT_WITH_OPEN_FILES
+			{ 0xC0190049, 0x023442, 0x02346A, 40, 88 }, // STATUS_SPARSE_NOT_ALLOWED_IN_TRANSACTION
+			{ 0xC019004A, 0x0234C2, 0x0234DD, 27, 165 }, // STATUS_TM_IDENTITY_MISMATCH
+			{ 0xC019004B, 0x023582, 0x023598, 22, 120 }, // STATUS_FLOATED_SECTION
+			{ 0xC019004C, 0x023610, 0x023634, 36, 126 }, // STATUS_CANNOT_ACCEPT_TRANSACTED_WORK
+			{ 0xC019004D, 0x0236B2, 0x0236D2, 32, 152 }, // STATUS_CANNOT_ABORT_TRANSACTIONS
+			{ 0xC019004E, 0x02376A, 0x023786, 28, 76 }, // STATUS_TRANSACTION_NOT_FOUND
+			{ 0xC019004F, 0x0237D2, 0x0237F2, 32, 80 }, // STATUS_RESOURCEMANAGER_NOT_FOUND
+			{ 0xC0190050, 0x023842, 0x02385D, 27, 75 }, // STATUS_ENLISTMENT_NOT_FOUND
+			{ 0xC0190051, 0x0238A8, 0x0238CB, 35, 83 }, // STATUS_TRANSACTIONMANAGER_NOT_FOUND
+			{ 0xC0190052, 0x02391E, 0x023942, 36, 416 }, // STATUS_TRANSACTIONMANAGER_NOT_ONLINE
+			{ 0xC0190053, 0x023AE2, 0x023B13, 49, 168 }, // STATUS_TRANSACTIONMANAGER_RECOVERY_NAME_COLLISION
+			{ 0xC0190054, 0x023BBB, 0x023BD6, 27, 262 }, // STATUS_TRANSACTION_NOT_ROOT
+			{ 0xC0190055, 0x023CDC, 0x023CFD, 33, 110 }, // STATUS_TRANSACTION_OBJECT_EXPIRED
+			{ 0xC0190056, 0x023D6B, 0x023D98, 45, 93 }, // STATUS_COMPRESSION_NOT_ALLOWED_IN_TRANSACTION
+			{ 0xC0190057, 0x023DF5, 0x023E1D, 40, 182 }, // STATUS_TRANSACTION_RESPONSE_NOT_ENLISTED
+			{ 0xC0190058, 0x023ED3, 0x023EF5, 34, 296 }, // STATUS_TRANSACTION_RECORD_TOO_LONG
+			{ 0xC0190059, 0x02401D, 0x024043, 38, 83 }, // STATUS_NO_LINK_TRACKING_IN_TRANSACTION
+			{ 0xC019005A, 0x024096, 0x0240C3, 45, 52 }, // STATUS_OPERATION_NOT_SUPPORTED_IN_TRANSACTION
+			{ 0xC019005B, 0x0240F7, 0x02411C, 37, 106 }, // STATUS_TRANSACTION_INTEGRITY_VIOLATED
+			{ 0xC019005C, 0x024186, 0x0241B1, 43, 118 }, // STATUS_TRANSACTIONMANAGER_IDENTITY_MISMATCH
+			{ 0xC019005D, 0x024227, 0x02424E, 39, 138 }, // STATUS_RM_CANNOT_BE_FROZEN_FOR_SNAPSHOT
+			{ 0xC019005E, 0x0242D8, 0x0242FC, 36, 346 }, // STATUS_TRANSACTION_MUST_WRITETHROUGH
+			{ 0xC019005F, 0x024456, 0x024474, 30, 52 }, // STATUS_TRANSACTION_NO_SUPERIOR
+			{ 0xC0190060, 0x0244A8, 0x0244BD, 21, 212 }, // STATUS_EXPIRED_HANDLE
+			{ 0xC0190061, 0x024591, 0x0245B0, 31, 111 }, // STATUS_TRANSACTION_NOT_ENLISTED
+			{ 0xC01A0001, 0x02461F, 0x024638, 25, 40 }, // STATUS_LOG_SECTOR_INVALID
+			{ 0xC01A0002, 0x024660, 0x024680, 32, 63 }, // STATUS_LOG_SECTOR_PARITY_INVALID
+			{ 0xC01A0003, 0x0246BF, 0x0246D9, 26, 46 }, // STATUS_LOG_SECTOR_REMAPPED
+			{ 0xC01A0004, 0x024707, 0x024722, 27, 58 }, // STATUS_LOG_BLOCK_INCOMPLETE
+			{ 0xC01A0005, 0x02475C, 0x024774, 24, 76 }, // STATUS_LOG_INVALID_RANGE
+			{ 0xC01A0006, 0x0247C0, 0x0247DB, 27, 55 }, // STATUS_LOG_BLOCKS_EXHAUSTED
+			{ 0xC01A0007, 0x024812, 0x024831, 31, 93 }, // STATUS_LOG_READ_CONTEXT_INVALID
+			{ 0xC01A0008, 0x02488E, 0x0248A8, 26, 52 }, // STATUS_LOG_RESTART_INVALID
+			{ 0xC01A0009, 0x0248DC, 0x0248F4, 24, 53 }, // STATUS_LOG_BLOCK_VERSION
+			{ 0xC01A000A, 0x024929, 0x024941, 24, 45 }, // STATUS_LOG_BLOCK_INVALID
+			{ 0xC01A000B, 0x02496E, 0x02498A, 28, 77 }, // STATUS_LOG_READ_MODE_INVALID
+			{ 0xC01A000D, 0x0249D7, 0x0249F2, 27, 50 }, // STATUS_LOG_METADATA_CORRUPT
+			{ 0xC01A000E, 0x024A24, 0x024A3F, 27, 89 }, // STATUS_LOG_METADATA_INVALID
+			{ 0xC01A000F, 0x024A98, 0x024AB8, 32, 63 }, // STATUS_LOG_METADATA_INCONSISTENT
+			{ 0xC01A0010, 0x024AF7, 0x024B15, 30, 88 }, // STATUS_LOG_RESERVATION_INVALID
+			{ 0xC01A0011, 0x024B6D, 0x024B83, 22, 60 }, // STATUS_LOG_CANT_DELETE
+			{ 0xC01A0012, 0x024BBF, 0x024BE2, 35, 81 }, // STATUS_LOG_CONTAINER_LIMIT_EXCEEDED
+			{ 0xC01A0013, 0x024C33, 0x024C4A, 23, 79 }, // STATUS_LOG_START_OF_LOG
+			{ 0xC01A0014, 0x024C99, 0x024CBC, 35, 87 }, // STATUS_LOG_POLICY_ALREADY_INSTALLED
+			{ 0xC01A0015, 0x024D13, 0x024D32, 31, 68 }, // STATUS_LOG_POLICY_NOT_INSTALLED
+			{ 0xC01A0016, 0x024D76, 0x024D8F, 25, 52 }, // STATUS_LOG_POLICY_INVALID
+			{ 0xC01A0017, 0x024DC3, 0x024DDD, 26, 72 }, // STATUS_LOG_POLICY_CONFLICT
+			{ 0xC01A0018, 0x024E25, 0x024E43, 30, 76 }, // STATUS_LOG_PINNED_ARCHIVE_TAIL
+			{ 0xC01A0019, 0x024E8F, 0x024EAC, 29, 43 }, // STATUS_LOG_RECORD_NONEXISTENT
+			{ 0xC01A001A, 0x024ED7, 0x024EFA, 35, 98 }, // STATUS_LOG_RECORDS_RESERVED_INVALID
+			{ 0xC01A001B, 0x024F5C, 0x024F7D, 33, 65 }, // STATUS_LOG_SPACE_RESERVED_INVALID
+			{ 0xC01A001C, 0x024FBE, 0x024FD5, 23, 68 }, // STATUS_LOG_TAIL_INVALID
+			{ 0xC01A001D, 0x025019, 0x025028, 15, 23 }, // STATUS_LOG_FULL
+			{ 0xC01A001E, 0x02503F, 0x025055, 22, 68 }, // STATUS_LOG_MULTIPLEXED
+			{ 0xC01A001F, 0x025099, 0x0250AD, 20, 56 }, // STATUS_LOG_DEDICATED
+			{ 0xC01A0020, 0x0250E5, 0x025107, 34, 42 }, // STATUS_LOG_ARCHIVE_NOT_IN_PROGRESS
+			{ 0xC01A0021, 0x025131, 0x02514F, 30, 28 }, // STATUS_LOG_ARCHIVE_IN_PROGRESS
+			{ 0xC01A0022, 0x02516B, 0x02517F, 20, 69 }, // STATUS_LOG_EPHEMERAL
+			{ 0xC01A0023, 0x0251C4, 0x0251E4, 32, 83 }, // STATUS_LOG_NOT_ENOUGH_CONTAINERS
+			{ 0xC01A0024, 0x025237, 0x02525B, 36, 50 }, // STATUS_LOG_CLIENT_ALREADY_REGISTERED
+			{ 0xC01A0025, 0x02528D, 0x0252AD, 32, 51 }, // STATUS_LOG_CLIENT_NOT_REGISTERED
+			{ 0xC01A0026, 0x0252E0, 0x025303, 35, 65 }, // STATUS_LOG_FULL_HANDLER_IN_PROGRESS
+			{ 0xC01A0027, 0x025344, 0x025364, 32, 78 }, // STATUS_LOG_CONTAINER_READ_FAILED
+			{ 0xC01A0028, 0x0253B2, 0x0253D3, 33, 77 }, // STATUS_LOG_CONTAINER_WRITE_FAILED
+			{ 0xC01A0029, 0x025420, 0x025440, 32, 70 }, // STATUS_LOG_CONTAINER_OPEN_FAILED
+			{ 0xC01A002A, 0x025486, 0x0254A8, 34, 86 }, // STATUS_LOG_CONTAINER_STATE_INVALID
+			{ 0xC01A002B, 0x0254FE, 0x025516, 24, 70 }, // STATUS_LOG_STATE_INVALID
+			{ 0xC01A002C, 0x02555C, 0x02556D, 17, 56 }, // STATUS_LOG_PINNED
+			{ 0xC01A002D, 0x0255A5, 0x0255C5, 32, 26 }, // STATUS_LOG_METADATA_FLUSH_FAILED
+			{ 0xC01A002E, 0x0255DF, 0x0255FF, 32, 55 }, // STATUS_LOG_INCONSISTENT_SECURITY
+			{ 0xC01A002F, 0x025636, 0x025656, 32, 100 }, // STATUS_LOG_APPENDED_FLUSH_FAILED
+			{ 0xC01A0030, 0x0256BA, 0x0256D7, 29, 121 }, // STATUS_LOG_PINNED_RESERVATION
+			{ 0xC01B00EA, 0x025750, 0x025777, 39, 296 }, // STATUS_VIDEO_HUNG_DISPLAY_DRIVER_THREAD
+			{ 0xC01C0001, 0x02589F, 0x0258BC, 29, 59 }, // STATUS_FLT_NO_HANDLER_DEFINED
+			{ 0xC01C0002, 0x0258F7, 0x025919, 34, 45 }, // STATUS_FLT_CONTEXT_ALREADY_DEFINED
+			{ 0xC01C0003, 0x025946, 0x02596D, 39, 55 }, // STATUS_FLT_INVALID_ASYNCHRONOUS_REQUEST
+			{ 0xC01C0004, 0x0259A4, 0x0259BF, 27, 162 }, // STATUS_FLT_DISALLOW_FAST_IO
+			{ 0xC01C0005, 0x025A61, 0x025A80, 31, 86 }, // STATUS_FLT_INVALID_NAME_REQUEST
+			{ 0xC01C0006, 0x025AD6, 0x025AFB, 37, 133 }, // STATUS_FLT_NOT_SAFE_TO_POST_OPERATION
+			{ 0xC01C0007, 0x025B80, 0x025B9A, 26, 136 }, // STATUS_FLT_NOT_INITIALIZED
+			{ 0xC01C0008, 0x025C22, 0x025C3D, 27, 131 }, // STATUS_FLT_FILTER_NOT_READY
+			{ 0xC01C0009, 0x025CC0, 0x025CE1, 33, 167 }, // STATUS_FLT_POST_OPERATION_CLEANUP
+			{ 0xC01C000A, 0x025D88, 0x025DA1, 25, 208 }, // STATUS_FLT_INTERNAL_ERROR
+			{ 0xC01C000B, 0x025E71, 0x025E8B, 26, 137 }, // STATUS_FLT_DELETING_OBJECT
+			{ 0xC01C000C, 0x025F14, 0x025F34, 32, 53 }, // STATUS_FLT_MUST_BE_NONPAGED_POOL
+			{ 0xC01C000D, 0x025F69, 0x025F83, 26, 66 }, // STATUS_FLT_DUPLICATE_ENTRY
+			{ 0xC01C000E, 0x025FC5, 0x025FDD, 24, 42 }, // STATUS_FLT_CBDQ_DISABLED
+			{ 0xC01C000F, 0x026007, 0x02601F, 24, 52 }, // STATUS_FLT_DO_NOT_ATTACH
+			{ 0xC01C0010, 0x026053, 0x02606B, 24, 54 }, // STATUS_FLT_DO_NOT_DETACH
+			{ 0xC01C0011, 0x0260A1, 0x0260C7, 38, 68 }, // STATUS_FLT_INSTANCE_ALTITUDE_COLLISION
+			{ 0xC01C0012, 0x02610B, 0x02612D, 34, 66 }, // STATUS_FLT_INSTANCE_NAME_COLLISION
+			{ 0xC01C0013, 0x02616F, 0x02618A, 27, 47 }, // STATUS_FLT_FILTER_NOT_FOUND
+			{ 0xC01C0014, 0x0261B9, 0x0261D4, 27, 47 }, // STATUS_FLT_VOLUME_NOT_FOUND
+			{ 0xC01C0015, 0x026203, 0x026220, 29, 49 }, // STATUS_FLT_INSTANCE_NOT_FOUND
+			{ 0xC01C0016, 0x026251, 0x026278, 39, 76 }, // STATUS_FLT_CONTEXT_ALLOCATION_NOT_FOUND
+			{ 0xC01C0017, 0x0262C4, 0x0262EB, 39, 63 }, // STATUS_FLT_INVALID_CONTEXT_REGISTRATION
+			{ 0xC01C0018, 0x02632A, 0x026344, 26, 112 }, // STATUS_FLT_NAME_CACHE_MISS
+			{ 0xC01C0019, 0x0263B4, 0x0263CF, 27, 64 }, // STATUS_FLT_NO_DEVICE_OBJECT
+			{ 0xC01C001A, 0x02640F, 0x026430, 33, 40 }, // STATUS_FLT_VOLUME_ALREADY_MOUNTED
+			{ 0xC01C001B, 0x026458, 0x026473, 27, 70 }, // STATUS_FLT_ALREADY_ENLISTED
+			{ 0xC01C001C, 0x0264B9, 0x0264DA, 33, 59 }, // STATUS_FLT_CONTEXT_ALREADY_LINKED
+			{ 0xC01C0020, 0x026515, 0x026533, 30, 60 }, // STATUS_FLT_NO_WAITER_FOR_REPLY
+			{ 0xC01D0001, 0x02656F, 0x02658B, 28, 41 }, // STATUS_MONITOR_NO_DESCRIPTOR
+			{ 0xC01D0002, 0x0265B4, 0x0265DC, 40, 75 }, // STATUS_MONITOR_UNKNOWN_DESCRIPTOR_FORMAT
+			{ 0xC01D0003, 0x026627, 0x026651, 42, 55 }, // STATUS_MONITOR_INVALID_DESCRIPTOR_CHECKSUM
+			{ 0xC01D0004, 0x026688, 0x0266B4, 44, 61 }, // STATUS_MONITOR_INVALID_STANDARD_TIMING_BLOCK
+			{ 0xC01D0005, 0x0266F1, 0x026721, 48, 80 }, // STATUS_MONITOR_WMI_DATABLOCK_REGISTRATION_FAILED
+			{ 0xC01D0006, 0x026771, 0x0267A2, 49, 107 }, // STATUS_MONITOR_INVALID_SERIAL_NUMBER_MONDSC_BLOCK
+			{ 0xC01D0007, 0x02680D, 0x02683E, 49, 103 }, // STATUS_MONITOR_INVALID_USER_FRIENDLY_MONDSC_BLOCK
+			{ 0xC01D0008, 0x0268A5, 0x0268CB, 38, 75 }, // STATUS_MONITOR_NO_MORE_DESCRIPTOR_DATA
+			{ 0xC01D0009, 0x026916, 0x026942, 44, 61 }, // STATUS_MONITOR_INVALID_DETAILED_TIMING_BLOCK
+			{ 0xC01D000A, 0x02697F, 0x0269A6, 39, 53 }, // STATUS_MONITOR_INVALID_MANUFACTURE_DATE
+			{ 0xC01E0000, 0x0269DB, 0x026A03, 40, 74 }, // STATUS_GRAPHICS_NOT_EXCLUSIVE_MODE_OWNER
+			{ 0xC01E0001, 0x026A4D, 0x026A74, 39, 84 }, // STATUS_GRAPHICS_INSUFFICIENT_DMA_BUFFER
+			{ 0xC01E0002, 0x026AC8, 0x026AEF, 39, 44 }, // STATUS_GRAPHICS_INVALID_DISPLAY_ADAPTER
+			{ 0xC01E0003, 0x026B1B, 0x026B3C, 33, 62 }, // STATUS_GRAPHICS_ADAPTER_WAS_RESET
+			{ 0xC01E0004, 0x026B7A, 0x026B9E, 36, 57 }, // STATUS_GRAPHICS_INVALID_DRIVER_MODEL
+			{ 0xC01E0005, 0x026BD7, 0x026BFB, 36, 59 }, // STATUS_GRAPHICS_PRESENT_MODE_CHANGED
+			{ 0xC01E0006, 0x026C36, 0x026C56, 32, 43 }, // STATUS_GRAPHICS_PRESENT_OCCLUDED
+			{ 0xC01E0007, 0x026C81, 0x026C9F, 30, 51 }, // STATUS_GRAPHICS_PRESENT_DENIED
+			{ 0xC01E0008, 0x026CD2, 0x026CF4, 34, 41 }, // STATUS_GRAPHICS_CANNOTCOLORCONVERT
+			{ 0xC01E0009, 0x026D1D, 0x026D3C, 31, 82 }, // STATUS_GRAPHICS_DRIVER_MISMATCH
+			{ 0xC01E000B, 0x026D8E, 0x026DBA, 44, 80 }, // STATUS_GRAPHICS_PRESENT_REDIRECTION_DISABLED
+			{ 0xC01E000C, 0x026E0A, 0x026E2C, 34, 64 }, // STATUS_GRAPHICS_PRESENT_UNOCCLUDED
+			{ 0xC01E0100, 0x026E6C, 0x026E8B, 31, 60 }, // STATUS_GRAPHICS_NO_VIDEO_MEMORY
+			{ 0xC01E0101, 0x026EC7, 0x026EE7, 32, 63 }, // STATUS_GRAPHICS_CANT_LOCK_MEMORY
+			{ 0xC01E0102, 0x026F26, 0x026F45, 31, 33 }, // STATUS_GRAPHICS_ALLOCATION_BUSY
+			{ 0xC01E0103, 0x026F66, 0x026F89, 35, 111 }, // STATUS_GRAPHICS_TOO_MANY_REFERENCES
+			{ 0xC01E0104, 0x026FF8, 0x027017, 31, 111 }, // STATUS_GRAPHICS_TRY_AGAIN_LATER
+			{ 0xC01E0105, 0x027086, 0x0270A3, 29, 117 }, // STATUS_GRAPHICS_TRY_AGAIN_NOW
+			{ 0xC01E0106, 0x027118, 0x02713A, 34, 26 }, // STATUS_GRAPHICS_ALLOCATION_INVALID
+			{ 0xC01E0107, 0x027154, 0x027184, 48, 53 }, // STATUS_GRAPHICS_UNSWIZZLING_APERTURE_UNAVAILABLE
+			{ 0xC01E0108, 0x0271B9, 0x0271E9, 48, 58 }, // STATUS_GRAPHICS_UNSWIZZLING_APERTURE_UNSUPPORTED
+			{ 0xC01E0109, 0x027223, 0x02724F, 44, 64 }, // STATUS_GRAPHICS_CANT_EVICT_PINNED_ALLOCATION
+			{ 0xC01E0110, 0x02728F, 0x0272B7, 40, 92 }, // STATUS_GRAPHICS_INVALID_ALLOCATION_USAGE
+			{ 0xC01E0111, 0x027313, 0x027340, 45, 64 }, // STATUS_GRAPHICS_CANT_RENDER_LOCKED_ALLOCATION
+			{ 0xC01E0112, 0x027380, 0x0273A1, 33, 60 }, // STATUS_GRAPHICS_ALLOCATION_CLOSED
+			{ 0xC01E0113, 0x0273DD, 0x027408, 43, 51 }, // STATUS_GRAPHICS_INVALID_ALLOCATION_INSTANCE
+			{ 0xC01E0114, 0x02743B, 0x027464, 41, 49 }, // STATUS_GRAPHICS_INVALID_ALLOCATION_HANDLE
+			{ 0xC01E0115, 0x027495, 0x0274BC, 39, 69 }, // STATUS_GRAPHICS_WRONG_ALLOCATION_DEVICE
+			{ 0xC01E0116, 0x027501, 0x027528, 39, 42 }, // STATUS_GRAPHICS_ALLOCATION_CONTENT_LOST
+			{ 0xC01E0200, 0x027552, 0x027579, 39, 86 }, // STATUS_GRAPHICS_GPU_EXCEPTION_ON_DEVICE
+			{ 0xC01E0300, 0x0275CF, 0x0275F5, 38, 36 }, // STATUS_GRAPHICS_INVALID_VIDPN_TOPOLOGY
+			{ 0xC01E0301, 0x027619, 0x027645, 44, 92 }, // STATUS_GRAPHICS_VIDPN_TOPOLOGY_NOT_SUPPORTED
+			{ 0xC01E0302, 0x0276A1, 0x0276D7, 54, 135 }, // STATUS_GRAPHICS_VIDPN_TOPOLOGY_CURRENTLY_NOT_SUPPORTED
+			{ 0xC01E0303, 0x02775E, 0x02777B, 29, 34 }, // STATUS_GRAPHICS_INVALID_VIDPN
+			{ 0xC01E0304, 0x02779D, 0x0277C9, 44, 42 }, // STATUS_GRAPHICS_INVALID_VIDEO_PRESENT_SOURCE
+			{ 0xC01E0305, 0x0277F3, 0x02781F, 44, 42 }, // STATUS_GRAPHICS_INVALID_VIDEO_PRESENT_TARGET
+			{ 0xC01E0306, 0x027849, 0x027875, 44, 103 }, // STATUS_GRAPHICS_VIDPN_MODALITY_NOT_SUPPORTED
+			{ 0xC01E0308, 0x0278DC, 0x027907, 43, 43 }, // STATUS_GRAPHICS_INVALID_VIDPN_SOURCEMODESET
+			{ 0xC01E0309, 0x027932, 0x02795D, 43, 43 }, // STATUS_GRAPHICS_INVALID_VIDPN_TARGETMODESET
+			{ 0xC01E030A, 0x027988, 0x0279A9, 33, 44 }, // STATUS_GRAPHICS_INVALID_FREQUENCY
+			{ 0xC01E030B, 0x0279D5, 0x0279FA, 37, 48 }, // STATUS_GRAPHICS_INVALID_ACTIVE_REGION
+			{ 0xC01E030C, 0x027A2A, 0x027A4E, 36, 47 }, // STATUS_GRAPHICS_INVALID_TOTAL_REGION
+			{ 0xC01E0310, 0x027A7D, 0x027AAE, 49, 47 }, // STATUS_GRAPHICS_INVALID_VIDEO_PRESENT_SOURCE_MODE
+			{ 0xC01E0311, 0x027ADD, 0x027B0E, 49, 47 }, // STATUS_GRAPHICS_INVALID_VIDEO_PRESENT_TARGET_MODE
+			{ 0xC01E0312, 0x027B3D, 0x027B6B, 46, 80 }, // STATUS_GRAPHICS_PINNED_MODE_MUST_REMAIN_IN_SET
+			{ 0xC01E0313, 0x027BBB, 0x027BE3, 40, 60 }, // STATUS_GRAPHICS_PATH_ALREADY_IN_TOPOLOGY
+			{ 0xC01E0314, 0x027C1F, 0x027C46, 39, 42 }, // STATUS_GRAPHICS_MODE_ALREADY_IN_MODESET
+			{ 0xC01E0315, 0x027C70, 0x027C9D, 45, 46 }, // STATUS_GRAPHICS_INVALID_VIDEOPRESENTSOURCESET
+			{ 0xC01E0316, 0x027CCB, 0x027CF8, 45, 46 }, // STATUS_GRAPHICS_INVALID_VIDEOPRESENTTARGETSET
+			{ 0xC01E0317, 0x027D26, 0x027D4B, 37, 74 }, // STATUS_GRAPHICS_SOURCE_ALREADY_IN_SET
+			{ 0xC01E0318, 0x027D95, 0x027DBA, 37, 74 }, // STATUS_GRAPHICS_TARGET_ALREADY_IN_SET
+			{ 0xC01E0319, 0x027E04, 0x027E2E, 42, 40 }, // STATUS_GRAPHICS_INVALID_VIDPN_PRESENT_PATH
+			{ 0xC01E031A, 0x027E56, 0x027E83, 45, 82 }, // STATUS_GRAPHICS_NO_RECOMMENDED_VIDPN_TOPOLOGY
+			{ 0xC01E031B, 0x027ED5, 0x027F06, 49, 49 }, // STATUS_GRAPHICS_INVALID_MONITOR_FREQUENCYRANGESET
+			{ 0xC01E031C, 0x027F37, 0x027F65, 46, 45 }, // STATUS_GRAPHICS_INVALID_MONITOR_FREQUENCYRANGE
+			{ 0xC01E031D, 0x027F92, 0x027FBB, 41, 78 }, // STATUS_GRAPHICS_FREQUENCYRANGE_NOT_IN_SET
+			{ 0xC01E031F, 0x028009, 0x028036, 45, 82 }, // STATUS_GRAPHICS_FREQUENCYRANGE_ALREADY_IN_SET
+			{ 0xC01E0320, 0x028088, 0x0280A5, 29, 63 }, // STATUS_GRAPHICS_STALE_MODESET
+			{ 0xC01E0321, 0x0280E4, 0x028111, 45, 45 }, // STATUS_GRAPHICS_INVALID_MONITOR_SOURCEMODESET
+			{ 0xC01E0322, 0x02813E, 0x028169, 43, 41 }, // STATUS_GRAPHICS_INVALID_MONITOR_SOURCE_MODE
+			{ 0xC01E0323, 0x028192, 0x0281C1, 47, 142 }, // STATUS_GRAPHICS_NO_RECOMMENDED_FUNCTIONAL_VIDPN
+			{ 0xC01E0324, 0x02824F, 0x028275, 38, 68 }, // STATUS_GRAPHICS_MODE_ID_MUST_BE_UNIQUE
+			{ 0xC01E0325, 0x0282B9, 0x0282F8, 63, 112 }, // STATUS_GRAPHICS_EMPTY_ADAPTER_MONITOR_MODE_SUPPORT_INTERSECTION
+			{ 0xC01E0326, 0x028368, 0x02839F, 55, 101 }, // STATUS_GRAPHICS_VIDEO_PRESENT_TARGETS_LESS_THAN_SOURCES
+			{ 0xC01E0327, 0x028404, 0x028428, 36, 50 }, // STATUS_GRAPHICS_PATH_NOT_IN_TOPOLOGY
+			{ 0xC01E0328, 0x02845A, 0x02848F, 53, 60 }, // STATUS_GRAPHICS_ADAPTER_MUST_HAVE_AT_LEAST_ONE_SOURCE
+			{ 0xC01E0329, 0x0284CB, 0x028500, 53, 60 }, // STATUS_GRAPHICS_ADAPTER_MUST_HAVE_AT_LEAST_ONE_TARGET
+			{ 0xC01E032A, 0x02853C, 0x028568, 44, 44 }, // STATUS_GRAPHICS_INVALID_MONITORDESCRIPTORSET
+			{ 0xC01E032B, 0x028594, 0x0285BD, 41, 40 }, // STATUS_GRAPHICS_INVALID_MONITORDESCRIPTOR
+			{ 0xC01E032C, 0x0285E5, 0x028611, 44, 68 }, // STATUS_GRAPHICS_MONITORDESCRIPTOR_NOT_IN_SET
+			{ 0xC01E032D, 0x028655, 0x028685, 48, 72 }, // STATUS_GRAPHICS_MONITORDESCRIPTOR_ALREADY_IN_SET
+			{ 0xC01E032E, 0x0286CD, 0x028700, 51, 88 }, // STATUS_GRAPHICS_MONITORDESCRIPTOR_ID_MUST_BE_UNIQUE
+			{ 0xC01E032F, 0x028758, 0x028788, 48, 54 }, // STATUS_GRAPHICS_INVALID_VIDPN_TARGET_SUBSET_TYPE
+			{ 0xC01E0330, 0x0287BE, 0x0287E3, 37, 108 }, // STATUS_GRAPHICS_RESOURCES_NOT_RELATED
+			{ 0xC01E0331, 0x02884F, 0x028877, 40, 86 }, // STATUS_GRAPHICS_SOURCE_ID_MUST_BE_UNIQUE
+			{ 0xC01E0332, 0x0288CD, 0x0288F5, 40, 86 }, // STATUS_GRAPHICS_TARGET_ID_MUST_BE_UNIQUE
+			{ 0xC01E0333, 0x02894B, 0x028974, 41, 98 }, // STATUS_GRAPHICS_NO_AVAILABLE_VIDPN_TARGET
+			{ 0xC01E0334, 0x0289D6, 0x028A12, 60, 69 }, // STATUS_GRAPHICS_MONITOR_COULD_NOT_BE_ASSOCIATED_WITH_ADAPTER
+			{ 0xC01E0335, 0x028A57, 0x028A72, 27, 70 }, // STATUS_GRAPHICS_NO_VIDPNMGR
+			{ 0xC01E0336, 0x028AB8, 0x028AD7, 31, 79 }, // STATUS_GRAPHICS_NO_ACTIVE_VIDPN
+			{ 0xC01E0337, 0x028B26, 0x028B4A, 36, 69 }, // STATUS_GRAPHICS_STALE_VIDPN_TOPOLOGY
+			{ 0xC01E0338, 0x028B8F, 0x028BB4, 37, 68 }, // STATUS_GRAPHICS_MONITOR_NOT_CONNECTED
+			{ 0xC01E0339, 0x028BF8, 0x028C1E, 38, 63 }, // STATUS_GRAPHICS_SOURCE_NOT_IN_TOPOLOGY
+			{ 0xC01E033A, 0x028C5D, 0x028C88, 43, 42 }, // STATUS_GRAPHICS_INVALID_PRIMARYSURFACE_SIZE
+			{ 0xC01E033B, 0x028CB2, 0x028CDC, 42, 41 }, // STATUS_GRAPHICS_INVALID_VISIBLEREGION_SIZE
+			{ 0xC01E033C, 0x028D05, 0x028D23, 30, 28 }, // STATUS_GRAPHICS_INVALID_STRIDE
+			{ 0xC01E033D, 0x028D3F, 0x028D62, 35, 34 }, // STATUS_GRAPHICS_INVALID_PIXELFORMAT
+			{ 0xC01E033E, 0x028D84, 0x028DA6, 34, 33 }, // STATUS_GRAPHICS_INVALID_COLORBASIS
+			{ 0xC01E033F, 0x028DC7, 0x028DF3, 44, 45 }, // STATUS_GRAPHICS_INVALID_PIXELVALUEACCESSMODE
+			{ 0xC01E0340, 0x028E20, 0x028E46, 38, 63 }, // STATUS_GRAPHICS_TARGET_NOT_IN_TOPOLOGY
+			{ 0xC01E0341, 0x028E85, 0x028EB7, 50, 52 }, // STATUS_GRAPHICS_NO_DISPLAY_MODE_MANAGEMENT_SUPPORT
+			{ 0xC01E0342, 0x028EEB, 0x028F0E, 35, 105 }, // STATUS_GRAPHICS_VIDPN_SOURCE_IN_USE
+			{ 0xC01E0343, 0x028F77, 0x028F9F, 40, 49 }, // STATUS_GRAPHICS_CANT_ACCESS_ACTIVE_VIDPN
+			{ 0xC01E0344, 0x028FD0, 0x028FFF, 47, 59 }, // STATUS_GRAPHICS_INVALID_PATH_IMPORTANCE_ORDINAL
+			{ 0xC01E0345, 0x02903A, 0x029076, 60, 72 }, // STATUS_GRAPHICS_INVALID_PATH_CONTENT_GEOMETRY_TRANSFORMATION
+			{ 0xC01E0346, 0x0290BE, 0x029100, 66, 96 }, // STATUS_GRAPHICS_PATH_CONTENT_GEOMETRY_TRANSFORMATION_NOT_SUPPORTED
+			{ 0xC01E0347, 0x029160, 0x029182, 34, 32 }, // STATUS_GRAPHICS_INVALID_GAMMA_RAMP
+			{ 0xC01E0348, 0x0291A2, 0x0291CA, 40, 75 }, // STATUS_GRAPHICS_GAMMA_RAMP_NOT_SUPPORTED
+			{ 0xC01E0349, 0x029215, 0x029240, 43, 69 }, // STATUS_GRAPHICS_MULTISAMPLING_NOT_SUPPORTED
+			{ 0xC01E034A, 0x029285, 0x0292A8, 35, 48 }, // STATUS_GRAPHICS_MODE_NOT_IN_MODESET
+			{ 0xC01E034D, 0x0292D8, 0x029314, 60, 58 }, // STATUS_GRAPHICS_INVALID_VIDPN_TOPOLOGY_RECOMMENDATION_REASON
+			{ 0xC01E034E, 0x02934E, 0x029377, 41, 53 }, // STATUS_GRAPHICS_INVALID_PATH_CONTENT_TYPE
+			{ 0xC01E034F, 0x0293AC, 0x0293D7, 43, 61 }, // STATUS_GRAPHICS_INVALID_COPYPROTECTION_TYPE
+			{ 0xC01E0350, 0x029414, 0x029445, 49, 97 }, // STATUS_GRAPHICS_UNASSIGNED_MODESET_ALREADY_EXISTS
+			{ 0xC01E0352, 0x0294A6, 0x0294CF, 41, 44 }, // STATUS_GRAPHICS_INVALID_SCANLINE_ORDERING
+			{ 0xC01E0353, 0x0294FB, 0x029527, 44, 57 }, // STATUS_GRAPHICS_TOPOLOGY_CHANGES_NOT_ALLOWED
+			{ 0xC01E0354, 0x029560, 0x029590, 48, 73 }, // STATUS_GRAPHICS_NO_AVAILABLE_IMPORTANCE_ORDINALS
+			{ 0xC01E0355, 0x0295D9, 0x029604, 43, 99 }, // STATUS_GRAPHICS_INCOMPATIBLE_PRIVATE_FORMAT
+			{ 0xC01E0356, 0x029667, 0x029695, 46, 43 }, // STATUS_GRAPHICS_INVALID_MODE_PRUNING_ALGORITHM
+			{ 0xC01E0357, 0x0296C0, 0x0296F1, 49, 47 }, // STATUS_GRAPHICS_INVALID_MONITOR_CAPABILITY_ORIGIN
+			{ 0xC01E0358, 0x029720, 0x029759, 57, 56 }, // STATUS_GRAPHICS_INVALID_MONITOR_FREQUENCYRANGE_CONSTRAINT
+			{ 0xC01E0359, 0x029791, 0x0297B6, 37, 59 }, // STATUS_GRAPHICS_MAX_NUM_PATHS_REACHED
+			{ 0xC01E035A, 0x0297F1, 0x029823, 50, 109 }, // STATUS_GRAPHICS_CANCEL_VIDPN_TOPOLOGY_AUGMENTATION
+			{ 0xC01E035B, 0x029890, 0x0298B3, 35, 41 }, // STATUS_GRAPHICS_INVALID_CLIENT_TYPE
+			{ 0xC01E035C, 0x0298DC, 0x0298FF, 35, 114 }, // STATUS_GRAPHICS_CLIENTVIDPN_NOT_SET
+			{ 0xC01E0400, 0x029971, 0x0299A2, 49, 86 }, // STATUS_GRAPHICS_SPECIFIED_CHILD_ALREADY_CONNECTED
+			{ 0xC01E0401, 0x0299F8, 0x029A26, 46, 76 }, // STATUS_GRAPHICS_CHILD_DESCRIPTOR_NOT_SUPPORTED
+			{ 0xC01E0430, 0x029A72, 0x029A96, 36, 56 }, // STATUS_GRAPHICS_NOT_A_LINKED_ADAPTER
+			{ 0xC01E0431, 0x029ACE, 0x029AF5, 39, 62 }, // STATUS_GRAPHICS_LEADLINK_NOT_ENUMERATED
+			{ 0xC01E0432, 0x029B33, 0x029B5C, 41, 70 }, // STATUS_GRAPHICS_CHAINLINKS_NOT_ENUMERATED
+			{ 0xC01E0433, 0x029BA2, 0x029BC9, 39, 81 }, // STATUS_GRAPHICS_ADAPTER_CHAIN_NOT_READY
+			{ 0xC01E0434, 0x029C1A, 0x029C40, 38, 99 }, // STATUS_GRAPHICS_CHAINLINKS_NOT_STARTED
+			{ 0xC01E0435, 0x029CA3, 0x029CCC, 41, 99 }, // STATUS_GRAPHICS_CHAINLINKS_NOT_POWERED_ON
+			{ 0xC01E0436, 0x029D2F, 0x029D5D, 46, 111 }, // STATUS_GRAPHICS_INCONSISTENT_DEVICE_LINK_STATE
+			{ 0xC01E0438, 0x029DCC, 0x029DF2, 38, 88 }, // STATUS_GRAPHICS_NOT_POST_DEVICE_DRIVER
+			{ 0xC01E043B, 0x029E4A, 0x029E75, 43, 93 }, // STATUS_GRAPHICS_ADAPTER_ACCESS_NOT_EXCLUDED
+			{ 0xC01E0500, 0x029ED2, 0x029EF3, 33, 32 }, // STATUS_GRAPHICS_OPM_NOT_SUPPORTED
+			{ 0xC01E0501, 0x029F13, 0x029F35, 34, 33 }, // STATUS_GRAPHICS_COPP_NOT_SUPPORTED
+			{ 0xC01E0502, 0x029F56, 0x029F77, 33, 32 }, // STATUS_GRAPHICS_UAB_NOT_SUPPORTED
+			{ 0xC01E0503, 0x029F97, 0x029FC7, 48, 47 }, // STATUS_GRAPHICS_OPM_INVALID_ENCRYPTED_PARAMETERS
+			{ 0xC01E0505, 0x029FF6, 0x02A024, 46, 90 }, // STATUS_GRAPHICS_OPM_NO_PROTECTED_OUTPUTS_EXIST
+			{ 0xC01E050B, 0x02A07E, 0x02A0A0, 34, 46 }, // STATUS_GRAPHICS_OPM_INTERNAL_ERROR
+			{ 0xC01E050C, 0x02A0CE, 0x02A0F0, 34, 81 }, // STATUS_GRAPHICS_OPM_INVALID_HANDLE
+			{ 0xC01E050E, 0x02A141, 0x02A16F, 46, 104 }, // STATUS_GRAPHICS_PVP_INVALID_CERTIFICATE_LENGTH
+			{ 0xC01E050F, 0x02A1D7, 0x02A200, 41, 134 }, // STATUS_GRAPHICS_OPM_SPANNING_MODE_ENABLED
+			{ 0xC01E0510, 0x02A286, 0x02A2AE, 40, 133 }, // STATUS_GRAPHICS_OPM_THEATER_MODE_ENABLED
+			{ 0xC01E0511, 0x02A333, 0x02A351, 30, 119 }, // STATUS_GRAPHICS_PVP_HFS_FAILED
+			{ 0xC01E0512, 0x02A3C8, 0x02A3E7, 31, 121 }, // STATUS_GRAPHICS_OPM_INVALID_SRM
+			{ 0xC01E0513, 0x02A460, 0x02A490, 48, 128 }, // STATUS_GRAPHICS_OPM_OUTPUT_DOES_NOT_SUPPORT_HDCP
+			{ 0xC01E0514, 0x02A510, 0x02A53F, 47, 98 }, // STATUS_GRAPHICS_OPM_OUTPUT_DOES_NOT_SUPPORT_ACP
+			{ 0xC01E0515, 0x02A5A1, 0x02A5D2, 49, 151 }, // STATUS_GRAPHICS_OPM_OUTPUT_DOES_NOT_SUPPORT_CGMSA
+			{ 0xC01E0516, 0x02A669, 0x02A68F, 38, 167 }, // STATUS_GRAPHICS_OPM_HDCP_SRM_NEVER_SET
+			{ 0xC01E0517, 0x02A736, 0x02A75D, 39, 156 }, // STATUS_GRAPHICS_OPM_RESOLUTION_TOO_HIGH
+			{ 0xC01E0518, 0x02A7F9, 0x02A82D, 52, 159 }, // STATUS_GRAPHICS_OPM_ALL_HDCP_HARDWARE_ALREADY_IN_USE
+			{ 0xC01E051A, 0x02A8CC, 0x02A901, 53, 351 }, // STATUS_GRAPHICS_OPM_PROTECTED_OUTPUT_NO_LONGER_EXISTS
+			{ 0xC01E051C, 0x02AA60, 0x02AAA1, 65, 258 }, // STATUS_GRAPHICS_OPM_PROTECTED_OUTPUT_DOES_NOT_HAVE_COPP_SEMANTICS
+			{ 0xC01E051D, 0x02ABA3, 0x02ABD2, 47, 213 }, // STATUS_GRAPHICS_OPM_INVALID_INFORMATION_REQUEST
+			{ 0xC01E051E, 0x02ACA7, 0x02ACD0, 41, 84 }, // STATUS_GRAPHICS_OPM_DRIVER_INTERNAL_ERROR
+			{ 0xC01E051F, 0x02AD24, 0x02AD64, 64, 259 }, // STATUS_GRAPHICS_OPM_PROTECTED_OUTPUT_DOES_NOT_HAVE_OPM_SEMANTICS
+			{ 0xC01E0520, 0x02AE67, 0x02AE92, 43, 243 }, // STATUS_GRAPHICS_OPM_SIGNALING_NOT_SUPPORTED
+			{ 0xC01E0521, 0x02AF85, 0x02AFB6, 49, 180 }, // STATUS_GRAPHICS_OPM_INVALID_CONFIGURATION_REQUEST
+			{ 0xC01E0580, 0x02B06A, 0x02B08B, 33, 77 }, // STATUS_GRAPHICS_I2C_NOT_SUPPORTED
+			{ 0xC01E0581, 0x02B0D8, 0x02B101, 41, 51 }, // STATUS_GRAPHICS_I2C_DEVICE_DOES_NOT_EXIST
+			{ 0xC01E0582, 0x02B134, 0x02B15F, 43, 71 }, // STATUS_GRAPHICS_I2C_ERROR_TRANSMITTING_DATA
+			{ 0xC01E0583, 0x02B1A6, 0x02B1CE, 40, 70 }, // STATUS_GRAPHICS_I2C_ERROR_RECEIVING_DATA
+			{ 0xC01E0584, 0x02B214, 0x02B23B, 39, 52 }, // STATUS_GRAPHICS_DDCCI_VCP_NOT_SUPPORTED
+			{ 0xC01E0585, 0x02B26F, 0x02B291, 34, 46 }, // STATUS_GRAPHICS_DDCCI_INVALID_DATA
+			{ 0xC01E0586, 0x02B2BF, 0x02B300, 65, 200 }, // STATUS_GRAPHICS_DDCCI_MONITOR_RETURNED_INVALID_TIMING_STATUS_BYTE
+			{ 0xC01E0587, 0x02B3C8, 0x02B3F9, 49, 141 }, // STATUS_GRAPHICS_DDCCI_INVALID_CAPABILITIES_STRING
+			{ 0xC01E0588, 0x02B486, 0x02A0A0, 34, 46 }, // STATUS_GRAPHICS_MCA_INTERNAL_ERROR
+			{ 0xC01E0589, 0x02B4A8, 0x02B4D5, 45, 87 }, // STATUS_GRAPHICS_DDCCI_INVALID_MESSAGE_COMMAND
+			{ 0xC01E058A, 0x02B52C, 0x02B558, 44, 90 }, // STATUS_GRAPHICS_DDCCI_INVALID_MESSAGE_LENGTH
+			{ 0xC01E058B, 0x02B5B2, 0x02B5E0, 46, 225 }, // STATUS_GRAPHICS_DDCCI_INVALID_MESSAGE_CHECKSUM
+			{ 0xC01E058C, 0x02B6C1, 0x02B6F0, 47, 72 }, // STATUS_GRAPHICS_INVALID_PHYSICAL_MONITOR_HANDLE
+			{ 0xC01E058D, 0x02B738, 0x02B760, 40, 421 }, // STATUS_GRAPHICS_MONITOR_NO_LONGER_EXISTS
+			{ 0xC01E05E0, 0x02B905, 0x02B933, 46, 187 }, // STATUS_GRAPHICS_ONLY_CONSOLE_SESSION_SUPPORTED
+			{ 0xC01E05E1, 0x02B9EE, 0x02BA23, 53, 114 }, // STATUS_GRAPHICS_NO_DISPLAY_DEVICE_CORRESPONDS_TO_NAME
+			{ 0xC01E05E2, 0x02BA95, 0x02BACB, 54, 101 }, // STATUS_GRAPHICS_DISPLAY_DEVICE_NOT_ATTACHED_TO_DESKTOP
+			{ 0xC01E05E3, 0x02BB30, 0x02BB5F, 47, 154 }, // STATUS_GRAPHICS_MIRRORING_DEVICES_NOT_SUPPORTED
+			{ 0xC01E05E4, 0x02BBF9, 0x02BC18, 31, 220 }, // STATUS_GRAPHICS_INVALID_POINTER
+			{ 0xC01E05E5, 0x02BCF4, 0x02BD2C, 56, 102 }, // STATUS_GRAPHICS_NO_MONITORS_CORRESPOND_TO_DISPLAY_DEVICE
+			{ 0xC01E05E6, 0x02BD92, 0x02BDBB, 41, 103 }, // STATUS_GRAPHICS_PARAMETER_ARRAY_TOO_SMALL
+			{ 0xC01E05E7, 0x02BE22, 0x02A0A0, 30, 46 }, // STATUS_GRAPHICS_INTERNAL_ERROR
+			{ 0xC01E05E8, 0x02BE40, 0x02BE6F, 47, 226 }, // STATUS_GRAPHICS_SESSION_TYPE_CHANGE_IN_PROGRESS
+			{ 0xC0210000, 0x02BF51, 0x02BF69, 24, 52 }, // STATUS_FVE_LOCKED_VOLUME
+			{ 0xC0210001, 0x02BF9D, 0x02BFB5, 24, 49 }, // STATUS_FVE_NOT_ENCRYPTED
+			{ 0xC0210002, 0x02BFE6, 0x02C000, 26, 56 }, // STATUS_FVE_BAD_INFORMATION
+			{ 0xC0210003, 0x02C038, 0x02C04C, 20, 74 }, // STATUS_FVE_TOO_SMALL
+			{ 0xC0210004, 0x02C096, 0x02C0B0, 26, 72 }, // STATUS_FVE_FAILED_WRONG_FS
+			{ 0xC0210005, 0x02C0F8, 0x02C115, 29, 78 }, // STATUS_FVE_BAD_PARTITION_SIZE
+			{ 0xC0210006, 0x02C163, 0x02C17D, 26, 57 }, // STATUS_FVE_FS_NOT_EXTENDED
+			{ 0xC0210007, 0x02C1B6, 0x02C1CB, 21, 80 }, // STATUS_FVE_FS_MOUNTED
+			{ 0xC0210008, 0x02C21B, 0x02C230, 21, 72 }, // STATUS_FVE_NO_LICENSE
+			{ 0xC0210009, 0x02C278, 0x02C295, 29, 57 }, // STATUS_FVE_ACTION_NOT_ALLOWED
+			{ 0xC021000A, 0x02C2CE, 0x02C2E1, 19, 27 }, // STATUS_FVE_BAD_DATA
+			{ 0xC021000B, 0x02C2FC, 0x02C317, 27, 38 }, // STATUS_FVE_VOLUME_NOT_BOUND
+			{ 0xC021000C, 0x02C33D, 0x02C357, 26, 33 }, // STATUS_FVE_NOT_DATA_VOLUME
+			{ 0xC021000D, 0x02C378, 0x02C392, 26, 52 }, // STATUS_FVE_CONV_READ_ERROR
+			{ 0xC021000E, 0x02C3C6, 0x02C3E1, 27, 53 }, // STATUS_FVE_CONV_WRITE_ERROR
+			{ 0xC021000F, 0x02C416, 0x02C432, 28, 84 }, // STATUS_FVE_OVERLAPPED_UPDATE
+			{ 0xC0210010, 0x02C486, 0x02C4A3, 29, 73 }, // STATUS_FVE_FAILED_SECTOR_SIZE
+			{ 0xC0210011, 0x02C4EC, 0x02C50C, 32, 41 }, // STATUS_FVE_FAILED_AUTHENTICATION
+			{ 0xC0210012, 0x02C535, 0x02C54D, 24, 33 }, // STATUS_FVE_NOT_OS_VOLUME
+			{ 0xC0210013, 0x02C56E, 0x02C58A, 28, 85 }, // STATUS_FVE_KEYFILE_NOT_FOUND
+			{ 0xC0210014, 0x02C5DF, 0x02C5F9, 26, 74 }, // STATUS_FVE_KEYFILE_INVALID
+			{ 0xC0210015, 0x02C643, 0x02C65C, 25, 93 }, // STATUS_FVE_KEYFILE_NO_VMK
+			{ 0xC0210016, 0x02C6B9, 0x02C6D0, 23, 46 }, // STATUS_FVE_TPM_DISABLED
+			{ 0xC0210017, 0x02C6FE, 0x02C71E, 32, 103 }, // STATUS_FVE_TPM_SRK_AUTH_NOT_ZERO
+			{ 0xC0210018, 0x02C785, 0x02C79F, 26, 152 }, // STATUS_FVE_TPM_INVALID_PCR
+			{ 0xC0210019, 0x02C837, 0x02C84C, 21, 90 }, // STATUS_FVE_TPM_NO_VMK
+			{ 0xC021001A, 0x02C8A6, 0x02C8BC, 22, 98 }, // STATUS_FVE_PIN_INVALID
+			{ 0xC021001B, 0x02C91E, 0x02C941, 35, 86 }, // STATUS_FVE_AUTH_INVALID_APPLICATION
+			{ 0xC021001C, 0x02C997, 0x02C9B5, 30, 105 }, // STATUS_FVE_AUTH_INVALID_CONFIG
+			{ 0xC021001D, 0x02CA1E, 0x02CA39, 27, 54 }, // STATUS_FVE_DEBUGGER_ENABLED
+			{ 0xC021001E, 0x02CA6F, 0x02CA88, 25, 51 }, // STATUS_FVE_DRY_RUN_FAILED
+			{ 0xC021001F, 0x02CABB, 0x02CADA, 31, 46 }, // STATUS_FVE_BAD_METADATA_POINTER
+			{ 0xC0210020, 0x02CB08, 0x02CB24, 28, 47 }, // STATUS_FVE_OLD_METADATA_COPY
+			{ 0xC0210021, 0x02CB53, 0x02CB6D, 26, 51 }, // STATUS_FVE_REBOOT_REQUIRED
+			{ 0xC0210022, 0x02CBA0, 0x02CBB5, 21, 72 }, // STATUS_FVE_RAW_ACCESS
+			{ 0xC0210023, 0x02CBFD, 0x02CC13, 22, 72 }, // STATUS_FVE_RAW_BLOCKED
+			{ 0xC0210024, 0x02CC5B, 0x02CC7E, 35, 133 }, // STATUS_FVE_NO_AUTOUNLOCK_MASTER_KEY
+			{ 0xC0210025, 0x02CD03, 0x02CD18, 21, 73 }, // STATUS_FVE_MOR_FAILED
+			{ 0xC0210026, 0x02CD61, 0x02CD7E, 29, 88 }, // STATUS_FVE_NO_FEATURE_LICENSE
+			{ 0xC0210027, 0x02CDD6, 0x02CE04, 46, 92 }, // STATUS_FVE_POLICY_USER_DISABLE_RDV_NOT_ALLOWED
+			{ 0xC0210028, 0x02CE60, 0x02CE7F, 31, 169 }, // STATUS_FVE_CONV_RECOVERY_FAILED
+			{ 0xC0210029, 0x02CF28, 0x02CF4C, 36, 45 }, // STATUS_FVE_VIRTUALIZED_SPACE_TOO_BIG
+			{ 0xC021002A, 0x02CF79, 0x02CF96, 29, 166 }, // STATUS_FVE_INVALID_DATUM_TYPE
+			{ 0xC0210030, 0x02D03C, 0x02D057, 27, 72 }, // STATUS_FVE_VOLUME_TOO_SMALL
+			{ 0xC0210031, 0x02D09F, 0x02D0B9, 26, 149 }, // STATUS_FVE_ENH_PIN_INVALID
+			{ 0xC0220001, 0x02D14E, 0x02D16A, 28, 27 }, // STATUS_FWP_CALLOUT_NOT_FOUND
+			{ 0xC0220002, 0x02D185, 0x02D1A3, 30, 36 }, // STATUS_FWP_CONDITION_NOT_FOUND
+			{ 0xC0220003, 0x02D1C7, 0x02D1E2, 27, 26 }, // STATUS_FWP_FILTER_NOT_FOUND
+			{ 0xC0220004, 0x02D1FC, 0x02D216, 26, 25 }, // STATUS_FWP_LAYER_NOT_FOUND
+			{ 0xC0220005, 0x02D22F, 0x02D24C, 29, 28 }, // STATUS_FWP_PROVIDER_NOT_FOUND
+			{ 0xC0220006, 0x02D268, 0x02D28D, 37, 36 }, // STATUS_FWP_PROVIDER_CONTEXT_NOT_FOUND
+			{ 0xC0220007, 0x02D2B1, 0x02D2CE, 29, 28 }, // STATUS_FWP_SUBLAYER_NOT_FOUND
+			{ 0xC0220008, 0x02D2EA, 0x02D2FE, 20, 26 }, // STATUS_FWP_NOT_FOUND
+			{ 0xC0220009, 0x02D318, 0x02D331, 25, 48 }, // STATUS_FWP_ALREADY_EXISTS
+			{ 0xC022000A, 0x02D361, 0x02D372, 17, 63 }, // STATUS_FWP_IN_USE
+			{ 0xC022000B, 0x02D3B1, 0x02D3D7, 38, 54 }, // STATUS_FWP_DYNAMIC_SESSION_IN_PROGRESS
+			{ 0xC022000C, 0x02D40D, 0x02D425, 24, 64 }, // STATUS_FWP_WRONG_SESSION
+			{ 0xC022000D, 0x02D465, 0x02D482, 29, 58 }, // STATUS_FWP_NO_TXN_IN_PROGRESS
+			{ 0xC022000E, 0x02D4BC, 0x02D4D6, 26, 60 }, // STATUS_FWP_TXN_IN_PROGRESS
+			{ 0xC022000F, 0x02D512, 0x02D528, 22, 53 }, // STATUS_FWP_TXN_ABORTED
+			{ 0xC0220010, 0x02D55D, 0x02D577, 26, 31 }, // STATUS_FWP_SESSION_ABORTED
+			{ 0xC0220011, 0x02D596, 0x02D5B1, 27, 60 }, // STATUS_FWP_INCOMPATIBLE_TXN
+			{ 0xC0220012, 0x02D5ED, 0x02D5FF, 18, 65 }, // STATUS_FWP_TIMEOUT
+			{ 0xC0220013, 0x02D640, 0x02D65E, 30, 52 }, // STATUS_FWP_NET_EVENTS_DISABLED
+			{ 0xC0220014, 0x02D692, 0x02D6AF, 29, 54 }, // STATUS_FWP_INCOMPATIBLE_LAYER
+			{ 0xC0220015, 0x02D6E5, 0x02D6FF, 26, 49 }, // STATUS_FWP_KM_CLIENTS_ONLY
+			{ 0xC0220016, 0x02D730, 0x02D74C, 28, 68 }, // STATUS_FWP_LIFETIME_MISMATCH
+			{ 0xC0220017, 0x02D790, 0x02D7A9, 25, 44 }, // STATUS_FWP_BUILTIN_OBJECT
+			{ 0xC0220018, 0x02D7D5, 0x02D7F1, 28, 48 }, // STATUS_FWP_TOO_MANY_CALLOUTS
+			{ 0xC0220019, 0x02D821, 0x02D840, 31, 89 }, // STATUS_FWP_NOTIFICATION_DROPPED
+			{ 0xC022001A, 0x02D899, 0x02D8B4, 27, 79 }, // STATUS_FWP_TRAFFIC_MISMATCH
+			{ 0xC022001B, 0x02D903, 0x02D923, 32, 67 }, // STATUS_FWP_INCOMPATIBLE_SA_STATE
+			{ 0xC022001C, 0x02D966, 0x02D97D, 23, 27 }, // STATUS_FWP_NULL_POINTER
+			{ 0xC022001D, 0x02D998, 0x02D9B5, 29, 27 }, // STATUS_FWP_INVALID_ENUMERATOR
+			{ 0xC022001E, 0x02D9D0, 0x02D9E8, 24, 42 }, // STATUS_FWP_INVALID_FLAGS
+			{ 0xC022001F, 0x02DA12, 0x02DA2D, 27, 28 }, // STATUS_FWP_INVALID_NET_MASK
+			{ 0xC0220020, 0x02DA49, 0x02DA61, 24, 26 }, // STATUS_FWP_INVALID_RANGE
+			{ 0xC0220021, 0x02DA7B, 0x02DA96, 27, 31 }, // STATUS_FWP_INVALID_INTERVAL
+			{ 0xC0220022, 0x02DAB5, 0x02DAD1, 28, 63 }, // STATUS_FWP_ZERO_LENGTH_ARRAY
+			{ 0xC0220023, 0x02DB10, 0x02DB2C, 28, 42 }, // STATUS_FWP_NULL_DISPLAY_NAME
+			{ 0xC0220024, 0x02DB56, 0x02DB74, 30, 68 }, // STATUS_FWP_INVALID_ACTION_TYPE
+			{ 0xC0220025, 0x02DBB8, 0x02DBD1, 25, 31 }, // STATUS_FWP_INVALID_WEIGHT
+			{ 0xC0220026, 0x02DBF0, 0x02DC0E, 30, 82 }, // STATUS_FWP_MATCH_TYPE_MISMATCH
+			{ 0xC0220027, 0x02DC60, 0x02DC78, 24, 58 }, // STATUS_FWP_TYPE_MISMATCH
+			{ 0xC0220028, 0x02DCB2, 0x02DCCA, 24, 46 }, // STATUS_FWP_OUT_OF_BOUNDS
+			{ 0xC0220029, 0x02DCF8, 0x02DD0B, 19, 29 }, // STATUS_FWP_RESERVED
+			{ 0xC022002A, 0x02DD28, 0x02DD46, 30, 72 }, // STATUS_FWP_DUPLICATE_CONDITION
+			{ 0xC022002B, 0x02DD8E, 0x02DDA9, 27, 62 }, // STATUS_FWP_DUPLICATE_KEYMOD
+			{ 0xC022002C, 0x02DDE7, 0x02DE10, 41, 49 }, // STATUS_FWP_ACTION_INCOMPATIBLE_WITH_LAYER
+			{ 0xC022002D, 0x02DE41, 0x02DE6D, 44, 52 }, // STATUS_FWP_ACTION_INCOMPATIBLE_WITH_SUBLAYER
+			{ 0xC022002E, 0x02DEA1, 0x02DECB, 42, 73 }, // STATUS_FWP_CONTEXT_INCOMPATIBLE_WITH_LAYER
+			{ 0xC022002F, 0x02DF14, 0x02DF40, 44, 75 }, // STATUS_FWP_CONTEXT_INCOMPATIBLE_WITH_CALLOUT
+			{ 0xC0220030, 0x02DF8B, 0x02DFAE, 35, 65 }, // STATUS_FWP_INCOMPATIBLE_AUTH_METHOD
+			{ 0xC0220031, 0x02DFEF, 0x02E00F, 32, 64 }, // STATUS_FWP_INCOMPATIBLE_DH_GROUP
+			{ 0xC0220032, 0x02E04F, 0x02E06A, 27, 53 }, // STATUS_FWP_EM_NOT_SUPPORTED
+			{ 0xC0220033, 0x02E09F, 0x02E0B5, 22, 70 }, // STATUS_FWP_NEVER_MATCH
+			{ 0xC0220034, 0x02E0FB, 0x02E11F, 36, 42 }, // STATUS_FWP_PROVIDER_CONTEXT_MISMATCH
+			{ 0xC0220035, 0x02E149, 0x02E165, 28, 27 }, // STATUS_FWP_INVALID_PARAMETER
+			{ 0xC0220036, 0x02E180, 0x02E19D, 29, 49 }, // STATUS_FWP_TOO_MANY_SUBLAYERS
+			{ 0xC0220037, 0x02E1CE, 0x02E1F4, 38, 58 }, // STATUS_FWP_CALLOUT_NOTIFICATION_FAILED
+			{ 0xC0220038, 0x02E22E, 0x02E24F, 33, 48 }, // STATUS_FWP_INVALID_AUTH_TRANSFORM
+			{ 0xC0220039, 0x02E27F, 0x02E2A2, 35, 40 }, // STATUS_FWP_INVALID_CIPHER_TRANSFORM
+			{ 0xC022003A, 0x02E2CA, 0x02E2F2, 40, 61 }, // STATUS_FWP_INCOMPATIBLE_CIPHER_TRANSFORM
+			{ 0xC022003B, 0x02E32F, 0x02E357, 40, 54 }, // STATUS_FWP_INVALID_TRANSFORM_COMBINATION
+			{ 0xC022003C, 0x02E38D, 0x02E3AD, 32, 60 }, // STATUS_FWP_DUPLICATE_AUTH_METHOD
+			{ 0xC0220100, 0x02E3E9, 0x02E403, 26, 30 }, // STATUS_FWP_TCPIP_NOT_READY
+			{ 0xC0220101, 0x02E421, 0x02E441, 32, 55 }, // STATUS_FWP_INJECT_HANDLE_CLOSING
+			{ 0xC0220102, 0x02E478, 0x02E496, 30, 30 }, // STATUS_FWP_INJECT_HANDLE_STALE
+			{ 0xC0220103, 0x02E4B4, 0x02E4CA, 22, 30 }, // STATUS_FWP_CANNOT_PEND
+			{ 0xC0220104, 0x02E4E8, 0x02E4FE, 22, 53 }, // STATUS_FWP_DROP_NOICMP
+			{ 0xC0230002, 0x02E533, 0x02E546, 19, 53 }, // STATUS_NDIS_CLOSING
+			{ 0xC0230004, 0x02E57B, 0x02E592, 23, 33 }, // STATUS_NDIS_BAD_VERSION
+			{ 0xC0230005, 0x02E5B3, 0x02E5D2, 31, 42 }, // STATUS_NDIS_BAD_CHARACTERISTICS
+			{ 0xC0230006, 0x02E5FC, 0x02E619, 29, 71 }, // STATUS_NDIS_ADAPTER_NOT_FOUND
+			{ 0xC0230007, 0x02E660, 0x02E677, 23, 37 }, // STATUS_NDIS_OPEN_FAILED
+			{ 0xC0230008, 0x02E69C, 0x02E6B5, 25, 68 }, // STATUS_NDIS_DEVICE_FAILED
+			{ 0xC0230009, 0x02E6F9, 0x02E713, 26, 52 }, // STATUS_NDIS_MULTICAST_FULL
+			{ 0xC023000A, 0x02E747, 0x02E763, 28, 69 }, // STATUS_NDIS_MULTICAST_EXISTS
+			{ 0xC023000B, 0x02E7A8, 0x02E7C7, 31, 71 }, // STATUS_NDIS_MULTICAST_NOT_FOUND
+			{ 0xC023000C, 0x02E80E, 0x02E829, 27, 39 }, // STATUS_NDIS_REQUEST_ABORTED
+			{ 0xC023000D, 0x02E850, 0x02E86D, 29, 72 }, // STATUS_NDIS_RESET_IN_PROGRESS
+			{ 0xC023000F, 0x02E8B5, 0x02E8CF, 26, 69 }, // STATUS_NDIS_INVALID_PACKET
+			{ 0xC0230010, 0x02E914, 0x005DD6, 34, 69 }, // STATUS_NDIS_INVALID_DEVICE_REQUEST
+			{ 0xC0230011, 0x02E936, 0x02E953, 29, 58 }, // STATUS_NDIS_ADAPTER_NOT_READY
+			{ 0xC0230014, 0x02E98D, 0x02E9A7, 26, 67 }, // STATUS_NDIS_INVALID_LENGTH
+			{ 0xC0230015, 0x02E9EA, 0x02EA02, 24, 46 }, // STATUS_NDIS_INVALID_DATA
+			{ 0xC0230016, 0x02EA30, 0x02EA4C, 28, 63 }, // STATUS_NDIS_BUFFER_TOO_SHORT
+			{ 0xC0230017, 0x02EA8B, 0x02EAA2, 23, 63 }, // STATUS_NDIS_INVALID_OID
+			{ 0xC0230018, 0x02EAE1, 0x02EAFC, 27, 39 }, // STATUS_NDIS_ADAPTER_REMOVED
+			{ 0xC0230019, 0x02EB23, 0x02EB40, 29, 51 }, // STATUS_NDIS_UNSUPPORTED_MEDIA
+			{ 0xC023001A, 0x02EB73, 0x02EB93, 32, 92 }, // STATUS_NDIS_GROUP_ADDRESS_IN_USE
+			{ 0xC023001B, 0x02EBEF, 0x02EC09, 26, 56 }, // STATUS_NDIS_FILE_NOT_FOUND
+			{ 0xC023001C, 0x02EC41, 0x02EC5F, 30, 50 }, // STATUS_NDIS_ERROR_READING_FILE
+			{ 0xC023001D, 0x02EC91, 0x02ECAB, 26, 56 }, // STATUS_NDIS_ALREADY_MAPPED
+			{ 0xC023001E, 0x02ECE3, 0x02ED00, 29, 100 }, // STATUS_NDIS_RESOURCE_CONFLICT
+			{ 0xC023001F, 0x02ED64, 0x02ED82, 30, 104 }, // STATUS_NDIS_MEDIA_DISCONNECTED
+			{ 0xC0230022, 0x02EDEA, 0x02EE05, 27, 51 }, // STATUS_NDIS_INVALID_ADDRESS
+			{ 0xC023002A, 0x02EE38, 0x02EE4A, 18, 63 }, // STATUS_NDIS_PAUSED
+			{ 0xC023002B, 0x02EE89, 0x02EEA8, 31, 32 }, // STATUS_NDIS_INTERFACE_NOT_FOUND
+			{ 0xC023002C, 0x02EEC8, 0x02EEE8, 32, 64 }, // STATUS_NDIS_UNSUPPORTED_REVISION
+			{ 0xC023002D, 0x02EF28, 0x02EF40, 24, 60 }, // STATUS_NDIS_INVALID_PORT
+			{ 0xC023002E, 0x02EF7C, 0x02EF9A, 30, 107 }, // STATUS_NDIS_INVALID_PORT_STATE
+			{ 0xC023002F, 0x02F005, 0x02F020, 27, 45 }, // STATUS_NDIS_LOW_POWER_STATE
+			{ 0xC02300BB, 0x02F04D, 0x02F066, 25, 48 }, // STATUS_NDIS_NOT_SUPPORTED
+			{ 0xC023100F, 0x02F096, 0x02F0B0, 26, 72 }, // STATUS_NDIS_OFFLOAD_POLICY
+			{ 0xC0231012, 0x02F0F8, 0x02F11F, 39, 68 }, // STATUS_NDIS_OFFLOAD_CONNECTION_REJECTED
+			{ 0xC0231013, 0x02F163, 0x02F184, 33, 50 }, // STATUS_NDIS_OFFLOAD_PATH_REJECTED
+			{ 0xC0232000, 0x02F1B6, 0x02F1DB, 37, 133 }, // STATUS_NDIS_DOT11_AUTO_CONFIG_ENABLED
+			{ 0xC0232001, 0x02F260, 0x02F27E, 30, 94 }, // STATUS_NDIS_DOT11_MEDIA_IN_USE
+			{ 0xC0232002, 0x02F2DC, 0x02F301, 37, 100 }, // STATUS_NDIS_DOT11_POWER_STATE_INVALID
+			{ 0xC0232003, 0x02F365, 0x02F389, 36, 41 }, // STATUS_NDIS_PM_WOL_PATTERN_LIST_FULL
+			{ 0xC0232004, 0x02F3B2, 0x02F3DB, 41, 48 }, // STATUS_NDIS_PM_PROTOCOL_OFFLOAD_LIST_FULL
+			{ 0xC0350002, 0x02F40B, 0x02F42B, 32, 100 }, // STATUS_HV_INVALID_HYPERCALL_CODE
+			{ 0xC0350003, 0x02F48F, 0x02F4B0, 33, 117 }, // STATUS_HV_INVALID_HYPERCALL_INPUT
+			{ 0xC0350004, 0x02F525, 0x02F540, 27, 92 }, // STATUS_HV_INVALID_ALIGNMENT
+			{ 0xC0350005, 0x02F59C, 0x02F5B7, 27, 90 }, // STATUS_HV_INVALID_PARAMETER
+			{ 0xC0350006, 0x02F611, 0x02F628, 23, 42 }, // STATUS_HV_ACCESS_DENIED
+			{ 0xC0350007, 0x02F652, 0x02F673, 33, 104 }, // STATUS_HV_INVALID_PARTITION_STATE
+			{ 0xC0350008, 0x02F6DB, 0x02F6F5, 26, 50 }, // STATUS_HV_OPERATION_DENIED
+			{ 0xC0350009, 0x02F727, 0x02F741, 26, 67 }, // STATUS_HV_UNKNOWN_PROPERTY
+			{ 0xC035000A, 0x02F784, 0x02F7A9, 37, 85 }, // STATUS_HV_PROPERTY_VALUE_OUT_OF_RANGE
+			{ 0xC035000B, 0x02F7FE, 0x02F81B, 29, 76 }, // STATUS_HV_INSUFFICIENT_MEMORY
+			{ 0xC035000C, 0x02F867, 0x02F883, 28, 74 }, // STATUS_HV_PARTITION_TOO_DEEP
+			{ 0xC035000D, 0x02F8CD, 0x02F8EB, 30, 59 }, // STATUS_HV_INVALID_PARTITION_ID
+			{ 0xC035000E, 0x02F926, 0x02F940, 26, 89 }, // STATUS_HV_INVALID_VP_INDEX
+			{ 0xC0350011, 0x02F999, 0x02F9B2, 25, 96 }, // STATUS_HV_INVALID_PORT_ID
+			{ 0xC0350012, 0x02FA12, 0x02FA31, 31, 102 }, // STATUS_HV_INVALID_CONNECTION_ID
+			{ 0xC0350013, 0x02FA97, 0x02FAB5, 30, 51 }, // STATUS_HV_INSUFFICIENT_BUFFERS
+			{ 0xC0350014, 0x02FAE8, 0x02FB02, 26, 57 }, // STATUS_HV_NOT_ACKNOWLEDGED
+			{ 0xC0350016, 0x02FB3B, 0x02FB51, 22, 61 }, // STATUS_HV_ACKNOWLEDGED
+			{ 0xC0350017, 0x02FB8E, 0x02FBB2, 36, 72 }, // STATUS_HV_INVALID_SAVE_RESTORE_STATE
+			{ 0xC0350018, 0x02FBFA, 0x02FC17, 29, 134 }, // STATUS_HV_INVALID_SYNIC_STATE
+			{ 0xC0350019, 0x02FC9D, 0x02FCB4, 23, 176 }, // STATUS_HV_OBJECT_IN_USE
+			{ 0xC035001A, 0x02FD64, 0x02FD8B, 39, 44 }, // STATUS_HV_INVALID_PROXIMITY_DOMAIN_INFO
+			{ 0xC035001B, 0x02FDB7, 0x02FDC8, 17, 72 }, // STATUS_HV_NO_DATA
+			{ 0xC035001C, 0x02FE10, 0x02FE22, 18, 113 }, // STATUS_HV_INACTIVE
+			{ 0xC035001D, 0x02FE93, 0x02FEA9, 22, 57 }, // STATUS_HV_NO_RESOURCES
+			{ 0xC035001E, 0x02FEE2, 0x02FEFF, 29, 50 }, // STATUS_HV_FEATURE_UNAVAILABLE
+			{ 0xC0351000, 0x02FF31, 0x02FF46, 21, 40 }, // STATUS_HV_NOT_PRESENT
+			{ 0xC0360001, 0x02FF6E, 0x02FF82, 20, 54 }, // STATUS_IPSEC_BAD_SPI
+			{ 0xC0360002, 0x02FFB8, 0x030000, 32, 62 }, // STATUS_IPSEC_SA_LIFETIME_EXPIRED
+			{ 0xC0360003, 0x03003E, 0x030053, 21, 82 }, // STATUS_IPSEC_WRONG_SA
+			{ 0xC0360004, 0x0300A5, 0x0300C5, 32, 43 }, // STATUS_IPSEC_REPLAY_CHECK_FAILED
+			{ 0xC0360005, 0x0300F0, 0x03010B, 27, 53 }, // STATUS_IPSEC_INVALID_PACKET
+			{ 0xC0360006, 0x030140, 0x030163, 35, 29 }, // STATUS_IPSEC_INTEGRITY_CHECK_FAILED
+			{ 0xC0360007, 0x030180, 0x03019C, 28, 34 }, // STATUS_IPSEC_CLEAR_TEXT_DROP
+			{ 0xC0360008, 0x0301BE, 0x0301DD, 31, 89 }, // STATUS_IPSEC_AUTH_FIREWALL_DROP
+			{ 0xC0360009, 0x030236, 0x030250, 26, 45 }, // STATUS_IPSEC_THROTTLE_DROP
+			{ 0xC0368000, 0x03027D, 0x030294, 23, 52 }, // STATUS_IPSEC_DOSP_BLOCK
+			{ 0xC0368001, 0x0302C8, 0x0302EC, 36, 86 }, // STATUS_IPSEC_DOSP_RECEIVED_MULTICAST
+			{ 0xC0368002, 0x030342, 0x030362, 32, 62 }, // STATUS_IPSEC_DOSP_INVALID_PACKET
+			{ 0xC0368003, 0x0303A0, 0x0303C5, 37, 45 }, // STATUS_IPSEC_DOSP_STATE_LOOKUP_FAILED
+			{ 0xC0368004, 0x0303F2, 0x03040F, 29, 117 }, // STATUS_IPSEC_DOSP_MAX_ENTRIES
+			{ 0xC0368005, 0x030484, 0x0304A8, 36, 109 }, // STATUS_IPSEC_DOSP_KEYMOD_NOT_ALLOWED
+			{ 0xC0368006, 0x030515, 0x030542, 45, 145 }, // STATUS_IPSEC_DOSP_MAX_PER_IP_RATELIMIT_QUEUES
+			{ 0xC0370001, 0x0305D3, 0x0305EF, 28, 194 }, // STATUS_VID_DUPLICATE_HANDLER
+			{ 0xC0370002, 0x0306B1, 0x0306CD, 28, 215 }, // STATUS_VID_TOO_MANY_HANDLERS
+			{ 0xC0370003, 0x0307A4, 0x0307B9, 21, 217 }, // STATUS_VID_QUEUE_FULL
+			{ 0xC0370004, 0x030892, 0x0308B0, 30, 200 }, // STATUS_VID_HANDLER_NOT_PRESENT
+			{ 0xC0370005, 0x030978, 0x030996, 30, 214 }, // STATUS_VID_INVALID_OBJECT_NAME
+			{ 0xC0370006, 0x030A6C, 0x030A8E, 34, 83 }, // STATUS_VID_PARTITION_NAME_TOO_LONG
+			{ 0xC0370007, 0x030AE1, 0x030B07, 38, 87 }, // STATUS_VID_MESSAGE_QUEUE_NAME_TOO_LONG
+			{ 0xC0370008, 0x030B5E, 0x030B81, 35, 133 }, // STATUS_VID_PARTITION_ALREADY_EXISTS
+			{ 0xC0370009, 0x030C06, 0x030C29, 35, 221 }, // STATUS_VID_PARTITION_DOES_NOT_EXIST
+			{ 0xC037000A, 0x030D06, 0x030D29, 35, 221 }, // STATUS_VID_PARTITION_NAME_NOT_FOUND
+			{ 0xC037000B, 0x030E06, 0x030E2D, 39, 95 }, // STATUS_VID_MESSAGE_QUEUE_ALREADY_EXISTS
+			{ 0xC037000C, 0x030E8C, 0x030EB3, 39, 243 }, // STATUS_VID_EXCEEDED_MBP_ENTRY_MAP_LIMIT
+			{ 0xC037000D, 0x030FA6, 0x030FC4, 30, 106 }, // STATUS_VID_MB_STILL_REFERENCED
+			{ 0xC037000E, 0x03102E, 0x031055, 39, 240 }, // STATUS_VID_CHILD_GPA_PAGE_SET_CORRUPTED
+			{ 0xC037000F, 0x031145, 0x031165, 32, 252 }, // STATUS_VID_INVALID_NUMA_SETTINGS
+			{ 0xC0370010, 0x031261, 0x031283, 34, 105 }, // STATUS_VID_INVALID_NUMA_NODE_INDEX
+			{ 0xC0370011, 0x0312EC, 0x03131C, 48, 105 }, // STATUS_VID_NOTIFICATION_QUEUE_ALREADY_ASSOCIATED
+			{ 0xC0370012, 0x031385, 0x0313AB, 38, 91 }, // STATUS_VID_INVALID_MEMORY_BLOCK_HANDLE
+			{ 0xC0370013, 0x031406, 0x031424, 30, 209 }, // STATUS_VID_PAGE_RANGE_OVERFLOW
+			{ 0xC0370014, 0x0314F5, 0x03151C, 39, 92 }, // STATUS_VID_INVALID_MESSAGE_QUEUE_HANDLE
+			{ 0xC0370015, 0x031578, 0x03159B, 35, 89 }, // STATUS_VID_INVALID_GPA_RANGE_HANDLE
+			{ 0xC0370016, 0x0315F4, 0x031621, 45, 142 }, // STATUS_VID_NO_MEMORY_BLOCK_NOTIFICATION_QUEUE
+			{ 0xC0370017, 0x0316AF, 0x0316DA, 43, 254 }, // STATUS_VID_MEMORY_BLOCK_LOCK_COUNT_EXCEEDED
+			{ 0xC0370018, 0x0317D8, 0x0317F5, 29, 103 }, // STATUS_VID_INVALID_PPM_HANDLE
+			{ 0xC0370019, 0x03185C, 0x031876, 26, 70 }, // STATUS_VID_MBPS_ARE_LOCKED
+			{ 0xC037001A, 0x0318BC, 0x0318DB, 31, 194 }, // STATUS_VID_MESSAGE_QUEUE_CLOSED
+			{ 0xC037001B, 0x03199D, 0x0319C8, 43, 85 }, // STATUS_VID_VIRTUAL_PROCESSOR_LIMIT_EXCEEDED
+			{ 0xC037001C, 0x031A1D, 0x031A34, 23, 77 }, // STATUS_VID_STOP_PENDING
+			{ 0xC037001D, 0x031A81, 0x031AA3, 34, 155 }, // STATUS_VID_INVALID_PROCESSOR_STATE
+			{ 0xC037001E, 0x031B3E, 0x031B68, 42, 219 }, // STATUS_VID_EXCEEDED_KM_CONTEXT_COUNT_LIMIT
+			{ 0xC037001F, 0x031C43, 0x031C6E, 43, 216 }, // STATUS_VID_KM_INTERFACE_ALREADY_INITIALIZED
+			{ 0xC0370020, 0x031D46, 0x031D6E, 40, 221 }, // STATUS_VID_MB_PROPERTY_ALREADY_SET_RESET
+			{ 0xC0370021, 0x031E4B, 0x031E6A, 31, 174 }, // STATUS_VID_MMIO_RANGE_DESTROYED
+			{ 0xC0370022, 0x031F18, 0x031F3D, 37, 196 }, // STATUS_VID_INVALID_CHILD_GPA_PAGE_SET
+			{ 0xC0370023, 0x032001, 0x03202A, 41, 226 }, // STATUS_VID_RESERVE_PAGE_SET_IS_BEING_USED
+			{ 0xC0370024, 0x03210C, 0x032131, 37, 221 }, // STATUS_VID_RESERVE_PAGE_SET_TOO_SMALL
+			{ 0xC0370025, 0x03220E, 0x03223F, 49, 266 }, // STATUS_VID_MBP_ALREADY_LOCKED_USING_RESERVED_PAGE
+			{ 0xC0370026, 0x032349, 0x03236C, 35, 248 }, // STATUS_VID_MBP_COUNT_EXCEEDED_LIMIT
+			{ 0xC0370027, 0x032464, 0x032482, 30, 151 }, // STATUS_VID_SAVED_STATE_CORRUPT
+			{ 0xC0370028, 0x032519, 0x032541, 40, 172 }, // STATUS_VID_SAVED_STATE_UNRECOGNIZED_ITEM
+			{ 0xC0370029, 0x0325ED, 0x032610, 35, 164 }, // STATUS_VID_SAVED_STATE_INCOMPATIBLE
+			{ 0xC0380001, 0x0326B4, 0x0326CF, 27, 35 }, // STATUS_VOLMGR_DATABASE_FULL
+			{ 0xC0380002, 0x0326F2, 0x03271C, 42, 48 }, // STATUS_VOLMGR_DISK_CONFIGURATION_CORRUPTED
+			{ 0xC0380003, 0x03274C, 0x032778, 44, 77 }, // STATUS_VOLMGR_DISK_CONFIGURATION_NOT_IN_SYNC
+			{ 0xC0380004, 0x0327C5, 0x0327EC, 39, 68 }, // STATUS_VOLMGR_PACK_CONFIG_UPDATE_FAILED
+			{ 0xC0380005, 0x032830, 0x03285D, 45, 37 }, // STATUS_VOLMGR_DISK_CONTAINS_NON_SIMPLE_VOLUME
+			{ 0xC0380006, 0x032882, 0x03289E, 28, 65 }, // STATUS_VOLMGR_DISK_DUPLICATE
+			{ 0xC0380007, 0x0328DF, 0x0328F9, 26, 28 }, // STATUS_VOLMGR_DISK_DYNAMIC
+			{ 0xC0380008, 0x032915, 0x032932, 29, 80 }, // STATUS_VOLMGR_DISK_ID_INVALID
+			{ 0xC0380009, 0x032982, 0x03299C, 26, 84 }, // STATUS_VOLMGR_DISK_INVALID
+			{ 0xC038000A, 0x0329F0, 0x032A0D, 29, 77 }, // STATUS_VOLMGR_DISK_LAST_VOTER
+			{ 0xC038000B, 0x032A5A, 0x032A7B, 33, 46 }, // STATUS_VOLMGR_DISK_LAYOUT_INVALID
+			{ 0xC038000C, 0x032AA9, 0x032AE5, 60, 113 }, // STATUS_VOLMGR_DISK_LAYOUT_NON_BASIC_BETWEEN_BASIC_PARTITIONS
+			{ 0xC038000D, 0x032B56, 0x032B84, 46, 67 }, // STATUS_VOLMGR_DISK_LAYOUT_NOT_CYLINDER_ALIGNED
+			{ 0xC038000E, 0x032BC7, 0x032BF5, 46, 76 }, // STATUS_VOLMGR_DISK_LAYOUT_PARTITIONS_TOO_SMALL
+			{ 0xC038000F, 0x032C41, 0x032C7D, 60, 102 }, // STATUS_VOLMGR_DISK_LAYOUT_PRIMARY_BETWEEN_LOGICAL_PARTITIONS
+			{ 0xC0380010, 0x032CE3, 0x032D10, 45, 78 }, // STATUS_VOLMGR_DISK_LAYOUT_TOO_MANY_PARTITIONS
+			{ 0xC0380011, 0x032D5E, 0x032D78, 26, 79 }, // STATUS_VOLMGR_DISK_MISSING
+			{ 0xC0380012, 0x032DC7, 0x032DE3, 28, 32 }, // STATUS_VOLMGR_DISK_NOT_EMPTY
+			{ 0xC0380013, 0x032E03, 0x032E26, 35, 52 }, // STATUS_VOLMGR_DISK_NOT_ENOUGH_SPACE
+			{ 0xC0380014, 0x032E5A, 0x032E7F, 37, 44 }, // STATUS_VOLMGR_DISK_REVECTORING_FAILED
+			{ 0xC0380015, 0x032EAB, 0x032ED1, 38, 46 }, // STATUS_VOLMGR_DISK_SECTOR_SIZE_INVALID
+			{ 0xC0380016, 0x032EFF, 0x032F23, 36, 80 }, // STATUS_VOLMGR_DISK_SET_NOT_CONTAINED
+			{ 0xC0380017, 0x032F73, 0x032F9E, 43, 79 }, // STATUS_VOLMGR_DISK_USED_BY_MULTIPLE_MEMBERS
+			{ 0xC0380018, 0x032FED, 0x033017, 42, 67 }, // STATUS_VOLMGR_DISK_USED_BY_MULTIPLE_PLEXES
+			{ 0xC0380019, 0x03305A, 0x033082, 40, 47 }, // STATUS_VOLMGR_DYNAMIC_DISK_NOT_SUPPORTED
+			{ 0xC038001A, 0x0330B1, 0x0330D2, 33, 54 }, // STATUS_VOLMGR_EXTENT_ALREADY_USED
+			{ 0xC038001B, 0x033108, 0x03312B, 35, 168 }, // STATUS_VOLMGR_EXTENT_NOT_CONTIGUOUS
+			{ 0xC038001C, 0x0331D3, 0x0331FC, 41, 72 }, // STATUS_VOLMGR_EXTENT_NOT_IN_PUBLIC_REGION
+			{ 0xC038001D, 0x033244, 0x03326B, 39, 49 }, // STATUS_VOLMGR_EXTENT_NOT_SECTOR_ALIGNED
+			{ 0xC038001E, 0x03329C, 0x0332C7, 43, 97 }, // STATUS_VOLMGR_EXTENT_OVERLAPS_EBR_PARTITION
+			{ 0xC038001F, 0x033328, 0x033358, 48, 88 }, // STATUS_VOLMGR_EXTENT_VOLUME_LENGTHS_DO_NOT_MATCH
+			{ 0xC0380020, 0x0333B0, 0x0333DA, 42, 51 }, // STATUS_VOLMGR_FAULT_TOLERANT_NOT_SUPPORTED
+			{ 0xC0380021, 0x03340D, 0x033434, 39, 43 }, // STATUS_VOLMGR_INTERLEAVE_LENGTH_INVALID
+			{ 0xC0380022, 0x03345F, 0x033485, 38, 54 }, // STATUS_VOLMGR_MAXIMUM_REGISTERED_USERS
+			{ 0xC0380023, 0x0334BB, 0x0334D7, 28, 106 }, // STATUS_VOLMGR_MEMBER_IN_SYNC
+			{ 0xC0380024, 0x033541, 0x033565, 36, 51 }, // STATUS_VOLMGR_MEMBER_INDEX_DUPLICATE
+			{ 0xC0380025, 0x033598, 0x0335BA, 34, 93 }, // STATUS_VOLMGR_MEMBER_INDEX_INVALID
+			{ 0xC0380026, 0x033617, 0x033633, 28, 58 }, // STATUS_VOLMGR_MEMBER_MISSING
+			{ 0xC0380027, 0x03366D, 0x03368E, 33, 84 }, // STATUS_VOLMGR_MEMBER_NOT_DETACHED
+			{ 0xC0380028, 0x0336E2, 0x033703, 33, 45 }, // STATUS_VOLMGR_MEMBER_REGENERATING
+			{ 0xC0380029, 0x033730, 0x03374E, 30, 39 }, // STATUS_VOLMGR_ALL_DISKS_FAILED
+			{ 0xC038002A, 0x033775, 0x033796, 33, 123 }, // STATUS_VOLMGR_NO_REGISTERED_USERS
+			{ 0xC038002B, 0x033811, 0x03382B, 26, 92 }, // STATUS_VOLMGR_NO_SUCH_USER
+			{ 0xC038002C, 0x033887, 0x0338A7, 32, 128 }, // STATUS_VOLMGR_NOTIFICATION_RESET
+			{ 0xC038002D, 0x033927, 0x03394E, 39, 43 }, // STATUS_VOLMGR_NUMBER_OF_MEMBERS_INVALID
+			{ 0xC038002E, 0x033979, 0x03399F, 38, 42 }, // STATUS_VOLMGR_NUMBER_OF_PLEXES_INVALID
+			{ 0xC038002F, 0x0339C9, 0x0339E5, 28, 52 }, // STATUS_VOLMGR_PACK_DUPLICATE
+			{ 0xC0380030, 0x033A19, 0x033A36, 29, 80 }, // STATUS_VOLMGR_PACK_ID_INVALID
+			{ 0xC0380031, 0x033A86, 0x033AA0, 26, 92 }, // STATUS_VOLMGR_PACK_INVALID
+			{ 0xC0380032, 0x033AFC, 0x033B1B, 31, 35 }, // STATUS_VOLMGR_PACK_NAME_INVALID
+			{ 0xC0380033, 0x033B3E, 0x033B58, 26, 30 }, // STATUS_VOLMGR_PACK_OFFLINE
+			{ 0xC0380034, 0x033B76, 0x033B93, 29, 57 }, // STATUS_VOLMGR_PACK_HAS_QUORUM
+			{ 0xC0380035, 0x033BCC, 0x033BED, 33, 49 }, // STATUS_VOLMGR_PACK_WITHOUT_QUORUM
+			{ 0xC0380036, 0x033C1E, 0x033C43, 37, 103 }, // STATUS_VOLMGR_PARTITION_STYLE_INVALID
+			{ 0xC0380037, 0x033CAA, 0x033CCF, 37, 45 }, // STATUS_VOLMGR_PARTITION_UPDATE_FAILED
+			{ 0xC0380038, 0x033CFC, 0x033D16, 26, 103 }, // STATUS_VOLMGR_PLEX_IN_SYNC
+			{ 0xC0380039, 0x033D7D, 0x033D9F, 34, 49 }, // STATUS_VOLMGR_PLEX_INDEX_DUPLICATE
+			{ 0xC038003A, 0x033DD0, 0x033DF0, 32, 85 }, // STATUS_VOLMGR_PLEX_INDEX_INVALID
+			{ 0xC038003B, 0x033E45, 0x033E63, 30, 120 }, // STATUS_VOLMGR_PLEX_LAST_ACTIVE
+			{ 0xC038003C, 0x033EDB, 0x033EF5, 26, 30 }, // STATUS_VOLMGR_PLEX_MISSING
+			{ 0xC038003D, 0x033F13, 0x033F32, 31, 45 }, // STATUS_VOLMGR_PLEX_REGENERATING
+			{ 0xC038003E, 0x033F5F, 0x033F7E, 31, 35 }, // STATUS_VOLMGR_PLEX_TYPE_INVALID
+			{ 0xC038003F, 0x033FA1, 0x033FBD, 28, 49 }, // STATUS_VOLMGR_PLEX_NOT_RAID5
+			{ 0xC0380040, 0x033FEE, 0x03400B, 29, 49 }, // STATUS_VOLMGR_PLEX_NOT_SIMPLE
+			{ 0xC0380041, 0x03403C, 0x034060, 36, 76 }, // STATUS_VOLMGR_STRUCTURE_SIZE_INVALID
+			{ 0xC0380042, 0x0340AC, 0x0340D8, 44, 135 }, // STATUS_VOLMGR_TOO_MANY_NOTIFICATION_REQUESTS
+			{ 0xC0380043, 0x03415F, 0x034184, 37, 44 }, // STATUS_VOLMGR_TRANSACTION_IN_PROGRESS
+			{ 0xC0380044, 0x0341B0, 0x0341DB, 43, 67 }, // STATUS_VOLMGR_UNEXPECTED_DISK_LAYOUT_CHANGE
+			{ 0xC0380045, 0x03421E, 0x034248, 42, 45 }, // STATUS_VOLMGR_VOLUME_CONTAINS_MISSING_DISK
+			{ 0xC0380046, 0x034275, 0x034294, 31, 86 }, // STATUS_VOLMGR_VOLUME_ID_INVALID
+			{ 0xC0380047, 0x0342EA, 0x03430D, 35, 39 }, // STATUS_VOLMGR_VOLUME_LENGTH_INVALID
+			{ 0xC0380048, 0x034334, 0x034368, 52, 71 }, // STATUS_VOLMGR_VOLUME_LENGTH_NOT_SECTOR_SIZE_MULTIPLE
+			{ 0xC0380049, 0x0343AF, 0x0343D0, 33, 52 }, // STATUS_VOLMGR_VOLUME_NOT_MIRRORED
+			{ 0xC038004A, 0x034404, 0x034425, 33, 54 }, // STATUS_VOLMGR_VOLUME_NOT_RETAINED
+			{ 0xC038004B, 0x03445B, 0x034477, 28, 32 }, // STATUS_VOLMGR_VOLUME_OFFLINE
+			{ 0xC038004C, 0x034497, 0x0344B4, 29, 52 }, // STATUS_VOLMGR_VOLUME_RETAINED
+			{ 0xC038004D, 0x0344E8, 0x03450F, 39, 43 }, // STATUS_VOLMGR_NUMBER_OF_EXTENTS_INVALID
+			{ 0xC038004E, 0x03453A, 0x03455D, 35, 69 }, // STATUS_VOLMGR_DIFFERENT_SECTOR_SIZE
+			{ 0xC038004F, 0x0345A2, 0x0345BD, 27, 35 }, // STATUS_VOLMGR_BAD_BOOT_DISK
+			{ 0xC0380050, 0x0345E0, 0x034601, 33, 41 }, // STATUS_VOLMGR_PACK_CONFIG_OFFLINE
+			{ 0xC0380051, 0x03462A, 0x03464A, 32, 40 }, // STATUS_VOLMGR_PACK_CONFIG_ONLINE
+			{ 0xC0380052, 0x034672, 0x034690, 30, 43 }, // STATUS_VOLMGR_NOT_PRIMARY_PACK
+			{ 0xC0380053, 0x0346BB, 0x0346DF, 36, 63 }, // STATUS_VOLMGR_PACK_LOG_UPDATE_FAILED
+			{ 0xC0380054, 0x03471E, 0x03474B, 45, 51 }, // STATUS_VOLMGR_NUMBER_OF_DISKS_IN_PLEX_INVALID
+			{ 0xC0380055, 0x03477E, 0x0347AD, 47, 58 }, // STATUS_VOLMGR_NUMBER_OF_DISKS_IN_MEMBER_INVALID
+			{ 0xC0380056, 0x0347E7, 0x034804, 29, 51 }, // STATUS_VOLMGR_VOLUME_MIRRORED
+			{ 0xC0380057, 0x034837, 0x03485C, 37, 61 }, // STATUS_VOLMGR_PLEX_NOT_SIMPLE_SPANNED
+			{ 0xC0380058, 0x034899, 0x0348BA, 33, 33 }, // STATUS_VOLMGR_NO_VALID_LOG_COPIES
+			{ 0xC0380059, 0x0348DB, 0x0348FD, 34, 34 }, // STATUS_VOLMGR_PRIMARY_PACK_PRESENT
+			{ 0xC038005A, 0x03491F, 0x034944, 37, 41 }, // STATUS_VOLMGR_NUMBER_OF_DISKS_INVALID
+			{ 0xC038005B, 0x03496D, 0x03498F, 34, 45 }, // STATUS_VOLMGR_MIRROR_NOT_SUPPORTED
+			{ 0xC038005C, 0x0349BC, 0x0349DD, 33, 43 }, // STATUS_VOLMGR_RAID5_NOT_SUPPORTED
+			{ 0xC0390002, 0x034A08, 0x034A24, 28, 55 }, // STATUS_BCD_TOO_MANY_ELEMENTS
+			{ 0xC03A0001, 0x034A5B, 0x034A7A, 31, 82 }, // STATUS_VHD_DRIVE_FOOTER_MISSING
+			{ 0xC03A0002, 0x034ACC, 0x034AF5, 41, 116 }, // STATUS_VHD_DRIVE_FOOTER_CHECKSUM_MISMATCH
+			{ 0xC03A0003, 0x034B69, 0x034B88, 31, 109 }, // STATUS_VHD_DRIVE_FOOTER_CORRUPT
+			{ 0xC03A0004, 0x034BF5, 0x034C0E, 25, 72 }, // STATUS_VHD_FORMAT_UNKNOWN
+			{ 0xC03A0005, 0x034C56, 0x034C7B, 37, 61 }, // STATUS_VHD_FORMAT_UNSUPPORTED_VERSION
+			{ 0xC03A0006, 0x034CB8, 0x034CE2, 42, 99 }, // STATUS_VHD_SPARSE_HEADER_CHECKSUM_MISMATCH
+			{ 0xC03A0007, 0x034D45, 0x034D71, 44, 117 }, // STATUS_VHD_SPARSE_HEADER_UNSUPPORTED_VERSION
+			{ 0xC03A0008, 0x034DE6, 0x034E06, 32, 90 }, // STATUS_VHD_SPARSE_HEADER_CORRUPT
+			{ 0xC03A0009, 0x034E60, 0x034E83, 35, 123 }, // STATUS_VHD_BLOCK_ALLOCATION_FAILURE
+			{ 0xC03A000A, 0x034EFE, 0x034F27, 41, 99 }, // STATUS_VHD_BLOCK_ALLOCATION_TABLE_CORRUPT
+			{ 0xC03A000B, 0x034F8A, 0x034FA7, 29, 93 }, // STATUS_VHD_INVALID_BLOCK_SIZE
+			{ 0xC03A000C, 0x035004, 0x03501E, 26, 121 }, // STATUS_VHD_BITMAP_MISMATCH
+			{ 0xC03A000D, 0x035097, 0x0350B6, 31, 123 }, // STATUS_VHD_PARENT_VHD_NOT_FOUND
+			{ 0xC03A000E, 0x035131, 0x035154, 35, 139 }, // STATUS_VHD_CHILD_PARENT_ID_MISMATCH
+			{ 0xC03A000F, 0x0351DF, 0x035209, 42, 148 }, // STATUS_VHD_CHILD_PARENT_TIMESTAMP_MISMATCH
+			{ 0xC03A0010, 0x03529D, 0x0352BD, 32, 53 }, // STATUS_VHD_METADATA_READ_FAILURE
+			{ 0xC03A0011, 0x0352F2, 0x035313, 33, 57 }, // STATUS_VHD_METADATA_WRITE_FAILURE
+			{ 0xC03A0012, 0x03534C, 0x035363, 23, 47 }, // STATUS_VHD_INVALID_SIZE
+			{ 0xC03A0013, 0x035392, 0x0353AE, 28, 53 }, // STATUS_VHD_INVALID_FILE_SIZE
+			{ 0xC03A0014, 0x0353E3, 0x035405, 34, 69 }, // STATUS_VIRTDISK_PROVIDER_NOT_FOUND
+			{ 0xC03A0015, 0x03544A, 0x03546A, 32, 41 }, // STATUS_VIRTDISK_NOT_VIRTUAL_DISK
+			{ 0xC03A0016, 0x035493, 0x0354B6, 35, 154 }, // STATUS_VHD_PARENT_VHD_ACCESS_DENIED
+			{ 0xC03A0017, 0x035550, 0x035575, 37, 141 }, // STATUS_VHD_CHILD_PARENT_SIZE_MISMATCH
+			{ 0xC03A0018, 0x035602, 0x03562E, 44, 103 }, // STATUS_VHD_DIFFERENCING_CHAIN_CYCLE_DETECTED
+			{ 0xC03A0019, 0x035695, 0x0356C2, 45, 117 }, // STATUS_VHD_DIFFERENCING_CHAIN_ERROR_IN_PARENT
+			{ 0xC03A001A, 0x035737, 0x035755, 30, 184 }, // STATUS_VIRTUAL_DISK_LIMITATION
+			{ 0xC03A001B, 0x03580D, 0x035824, 23, 75 }, // STATUS_VHD_INVALID_TYPE
+			{ 0xC03A001C, 0x03586F, 0x035887, 24, 85 }, // STATUS_VHD_INVALID_STATE
+			{ 0xC03A001D, 0x0358DC, 0x035908, 44, 88 }, // STATUS_VIRTDISK_UNSUPPORTED_DISK_SECTOR_SIZE
+			{ 0xC03C0001, 0x035960, 0x035976, 22, 78 }, // STATUS_DIS_NOT_PRESENT
+			{ 0xC03C0002, 0x0359C4, 0x0359E2, 30, 60 }, // STATUS_DIS_ATTRIBUTE_NOT_FOUND
+			{ 0xC03C0003, 0x035A1E, 0x035A3F, 33, 44 }, // STATUS_DIS_UNRECOGNIZED_ATTRIBUTE
+			{ 0xC03C0004, 0x035A6B, 0x035A82, 23, 93 }, // STATUS_DIS_PARTIAL_DATA
+		};
+
+		constexpr std::uint16_t code_seeds[512] = {
+			0x0000, 0x0004, 0x0001, 0x0009, 0x0003, 0x0002, 0x0000, 0x0002, 0x0000, 0x0000, 0x0000, 0x0004, 0x0000, 0x0001, 0x0002, 0x0000,
+			0x0006, 0x0001, 0x0000, 0x0000, 0x0000, 0x0006, 0x0001, 0x0002, 0x0000, 0x0000, 0x0003, 0x0005, 0x0001, 0x0003, 0x0002, 0x0003,
+			0x000A, 0x0009, 0x0004, 0x0000, 0x0000, 0x0008, 0x0003, 0x0004, 0x000A, 0x0000, 0x0001, 0x0000, 0x0004, 0x0000, 0x0002, 0x0000,
+			0x0004, 0x0005, 0x0001, 0x0000, 0x0002, 0x0003, 0x0001, 0x0000, 0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0007, 0x000C, 0x0002,
+			0x0000, 0x0000, 0x0001, 0x0000, 0x0000, 0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0002, 0x0000, 0x0000, 0x0003,
+			0x0001, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0000, 0x0001, 0x0000, 0x0005, 0x0000, 0x0004, 0x0001, 0x0002, 0x0000, 0x0002,
+			0x0000, 0x0003, 0x0002, 0x0000, 0x0000, 0x0002, 0x0000, 0x0003, 0x0001, 0x0002, 0x0000, 0x0003, 0x0006, 0x0002, 0x0002, 0x0001,
+			0x0003, 0x0002, 0x0005, 0x0000, 0x0000, 0x0003, 0x0001, 0x0003, 0x0001, 0x0003, 0x0004, 0x0000, 0x0008, 0x0000, 0x0007, 0x0000,
+			0x0000, 0x0001, 0x0000, 0x0000, 0x0000, 0x0001, 0x0000, 0x0002, 0x0005, 0x0000, 0x0001, 0x0000, 0x0000, 0x000B, 0x0007, 0x0001,
+			0x0002, 0x0001, 0x0000, 0x0004, 0x0001, 0x0000, 0x0002, 0x0003, 0x0004, 0x0001, 0x0007, 0x0002, 0x0000, 0x0002, 0x0007, 0x0000,
+			0x0000, 0x0001, 0x0000, 0x0006, 0x0003, 0x0002, 0x0000, 0x000D, 0x0008, 0x0004, 0x0005, 0x0003, 0x0001, 0x0004, 0x0002, 0x0004,
+			0x0000, 0x0000, 0x0000, 0x0001, 0x0003, 0x0000, 0x0001, 0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x000C, 0x0001,
+			0x0000, 0x0003, 0x0000, 0x0002, 0x0003, 0x000C, 0x0000, 0x0000, 0x0009, 0x0005, 0x0003, 0x0003, 0x0000, 0x0000, 0x0000, 0x0013,
+			0x0002, 0x0002, 0x0000, 0x0000, 0x0000, 0x0005, 0x0001, 0x0001, 0x0000, 0x0002, 0x0001, 0x0003, 0x0001, 0x0000, 0x0007, 0x0000,
+			0x0002, 0x0002, 0x0007, 0x0003, 0x0000, 0x0007, 0x0003, 0x0000, 0x0000, 0x0003, 0x0000, 0x0001, 0x0001, 0x0008, 0x0008, 0x000A,
+			0x0002, 0x0000, 0x0002, 0x0002, 0x0002, 0x0000, 0x0000, 0x0003, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0003, 0x0000, 0x0003,
+			0x0006, 0x000A, 0x0005, 0x0000, 0x0005, 0x0000, 0x0001, 0x0006, 0x0006, 0x0002, 0x0008, 0x0002, 0x0002, 0x0001, 0x0001, 0x000C,
+			0x0000, 0x0003, 0x0000, 0x0000, 0x0001, 0x0000, 0x0001, 0x0000, 0x0000, 0x0007, 0x0000, 0x0000, 0x0001, 0x0001, 0x0000, 0x0004,
+			0x0002, 0x0006, 0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0003, 0x0003, 0x0002, 0x0001, 0x0000, 0x0002, 0x0003, 0x000A,
+			0x0006, 0x0000, 0x0000, 0x0001, 0x0004, 0x0005, 0x0001, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0000, 0x0001, 0x0003, 0x0002,
+			0x0002, 0x0007, 0x0000, 0x0000, 0x0003, 0x0009, 0x0001, 0x0001, 0x000A, 0x0005, 0x0001, 0x0004, 0x0004, 0x000B, 0x0000, 0x0005,
+			0x0005, 0x0003, 0x0002, 0x0001, 0x0003, 0x0001, 0x0001, 0x0003, 0x0001, 0x0003, 0x0002, 0x0002, 0x0000, 0x0000, 0x0005, 0x000B,
+			0x0001, 0x0001, 0x0000, 0x0000, 0x0001, 0x0004, 0x0003, 0x0006, 0x0004, 0x0000, 0x0002, 0x000A, 0x0001, 0x0000, 0x0000, 0x0003,
+			0x0001, 0x0000, 0x0002, 0x0000, 0x0006, 0x000B, 0x0000, 0x0002, 0x0007, 0x0005, 0x0008, 0x000C, 0x0002, 0x0000, 0x0003, 0x0000,
+			0x0005, 0x0001, 0x0002, 0x0002, 0x0009, 0x0002, 0x0001, 0x0002, 0x0000, 0x0001, 0x0004, 0x0000, 0x0000, 0x0003, 0x0003, 0x0005,
+			0x0001, 0x0000, 0x0003, 0x000D, 0x0002, 0x0000, 0x0006, 0x0002, 0x0001, 0x0005, 0x0002, 0x0006, 0x0002, 0x0003, 0x0000, 0x0008,
+			0x0006, 0x0005, 0x0002, 0x0000, 0x0001, 0x0000, 0x0003, 0x0004, 0x0005, 0x0004, 0x0004, 0x0001, 0x0001, 0x0003, 0x0003, 0x0001,
+			0x0001, 0x0002, 0x0003, 0x0005, 0x0000, 0x0000, 0x0001, 0x0004, 0x0000, 0x0007, 0x0000, 0x0000, 0x0001, 0x0001, 0x0002, 0x0003,
+			0x0002, 0x0000, 0x0000, 0x0007, 0x0002, 0x0002, 0x0008, 0x0004, 0x0001, 0x0001, 0x0000, 0x0000, 0x0001, 0x0003, 0x0001, 0x0002,
+			0x0001, 0x0000, 0x0000, 0x0001, 0x0005, 0x000D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0006, 0x0000, 0x0007, 0x0006, 0x0006, 0x0006,
+			0x0004, 0x0000, 0x0000, 0x0009, 0x0000, 0x0002, 0x000C, 0x0009, 0x0000, 0x0003, 0x0000, 0x0000, 0x0002, 0x0001, 0x0002, 0x0002,
+			0x0008, 0x0000, 0x0007, 0x0001, 0x0002, 0x0006, 0x0002, 0x000B, 0x0001, 0x0000, 0x0002, 0x0001, 0x0001, 0x0002, 0x0005, 0x0006,
+		};
+
+		constexpr std::uint16_t code_slots[4096] = {
+			0x0000, 0x0566, 0x05CE, 0x0413, 0xFFFF, 0xFFFF, 0x06AF, 0x0062, 0x062F, 0xFFFF, 0xFFFF, 0xFFFF, 0x02FF, 0x05C1, 0x018C, 0x01C9,
+			0xFFFF, 0xFFFF, 0xFFFF, 0x010C, 0x0191, 0x05FC, 0x021C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0507, 0xFFFF, 0x074D, 0xFFFF,
+			0xFFFF, 0xFFFF, 0x0340, 0xFFFF, 0x0775, 0xFFFF, 0xFFFF, 0xFFFF, 0x0696, 0xFFFF, 0x02DA, 0xFFFF, 0xFFFF, 0x00A1, 0xFFFF, 0xFFFF,
+			0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x04C9, 0x0052, 0xFFFF, 0xFFFF, 0x02CD, 0x0778, 0xFFFF, 0x00B2, 0xFFFF, 0x0474, 0xFFFF, 0xFFFF,
+			0xFFFF, 0x05F0, 0x0640, 0x05CF, 0x0433, 0x0781, 0x009D, 0x056F, 0xFFFF, 0x03F6, 0x01A5, 0x0134, 0x015D, 0xFFFF, 0x067D, 0x074F,
+			0x0125, 0x04CF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0271, 0x06CC, 0xFFFF, 0xFFFF, 0x03BD, 0xFFFF, 0x04AC, 0xFFFF,
+			0xFFFF, 0x02D7, 0x0753, 0xFFFF, 0xFFFF, 0xFFFF, 0x064D, 0xFFFF, 0x051C, 0x07A8, 0x03DF, 0x00B9, 0x0363, 0xFFFF, 0x01F2, 0xFFFF,
+			0xFFFF, 0xFFFF, 0xFFFF, 0x0136, 0xFFFF, 0x049C, 0xFFFF, 0x06C3, 0xFFFF, 0x0590, 0xFFFF, 0x0431, 0x025B, 0xFFFF, 0xFFFF, 0x0245,
+			0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x044C, 0x06E2, 0xFFFF, 0xFFFF, 0x0023, 0xFFFF, 0x04DB, 0x0659, 0xFFFF, 0xFFFF,
+			0xFFFF, 0xFFFF, 0x0303, 0x02A4, 0x03E8, 0x02E4, 0x05D9, 0xFFFF, 0x017E, 0xFFFF, 0xFFFF, 0x03AE, 0xFFFF, 0xFFFF, 0x031A, 0x06D6,
+			0x06AA, 0x015C, 0x01FD, 0xFFFF, 0xFFFF, 0x0686, 0x0484, 0x02DE, 0x02E9, 0xFFFF, 0xFFFF, 0x0374, 0xFFFF, 0xFFFF, 0x0593, 0x04FC,
+			0x0196, 0x0043, 0xFFFF, 0x0528, 0x0332, 0x03D6, 0x0612, 0x072B, 0xFFFF, 0x0064, 0xFFFF, 0x01D1, 0x003C, 0xFFFF, 0x00E1, 0x059E,
+			0xFFFF, 0x0055, 0xFFFF, 0x0445, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0607, 0xFFFF, 0xFFFF, 0x0622, 0x05CA, 0xFFFF, 0xFFFF,
+			0x002B, 0x0735, 0xFFFF, 0xFFFF, 0x00C2, 0x0756, 0x052D, 0x01BC, 0x02A8, 0x07B5, 0xFFFF, 0x01AE, 0xFFFF, 0x01D5, 0x06C4, 0x071D,
+			0xFFFF, 0x03F7, 0x065D, 0xFFFF, 0xFFFF, 0x00BA, 0x0129, 0x079D, 0xFFFF, 0x03CC, 0x0481, 0xFFFF, 0x048B, 0xFFFF, 0x00B8, 0xFFFF,
+			0xFFFF, 0x03D1, 0xFFFF, 0x0585, 0xFFFF, 0xFFFF, 0x062A, 0x0632, 0x05C5, 0xFFFF, 0x078F, 0x05EF, 0x0254, 0x064A, 0xFFFF, 0xFFFF,
+			0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x020D, 0xFFFF, 0xFFFF, 0xFFFF, 0x0649, 0x02D1, 0xFFFF, 0x0083, 0xFFFF, 0x01D3, 0x02FD, 0xFFFF,
+			0xFFFF, 0x016E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x047E, 0x02C5, 0xFFFF, 0x0461, 0xFFFF, 0x03E3, 0x004E, 0xFFFF,
+			0x052C, 0x038F, 0x0309, 0xFFFF, 0x01E7, 0xFFFF, 0xFFFF, 0xFFFF, 0x0629, 0x0740, 0x058D, 0xFFFF, 0x021E, 0x038D, 0xFFFF, 0xFFFF,
+			0xFFFF, 0xFFFF, 0x050D, 0xFFFF, 0x026F, 0x0621, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x02EA, 0xFFFF, 0x06CB, 0xFFFF,
+			0x0739, 0xFFFF, 0x04A5, 0xFFFF, 0x0304, 0xFFFF, 0xFFFF, 0x0107, 0xFFFF, 0x036D, 0xFFFF, 0x01CF, 0xFFFF, 0x068F, 0x031C, 0xFFFF,
+			0xFFFF, 0xFFFF, 0x062C, 0x07BB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x01F9, 0xFFFF, 0xFFFF,
+			0xFFFF, 0x02FE, 0xFFFF, 0xFFFF, 0xFFFF, 0x01CD, 0xFFFF, 0xFFFF, 0x0429, 0x0360, 0x03E6, 0x0711, 0xFFFF, 0x067E, 0xFFFF, 0xFFFF,
+			0x065E, 0xFFFF, 0x038B, 0x078A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0785, 0xFFFF, 0x0372, 0x0657, 0x06DD, 0x0661, 0xFFFF, 0x0291,
+			0xFFFF, 0xFFFF, 0x04D0, 0x044D, 0x079E, 0x07CB, 0x05FE, 0x0346, 0x0691, 0x0121, 0x0276, 0xFFFF, 0x07B7, 0xFFFF, 0xFFFF, 0x0051,
+			0xFFFF, 0xFFFF, 0x0699, 0xFFFF, 0xFFFF, 0xFFFF, 0x033F, 0xFFFF, 0xFFFF, 0x0520, 0x04B7, 0xFFFF, 0xFFFF, 0x0248, 0xFFFF, 0x0027,
+			0x0235, 0x054D, 0x0166, 0x0545, 0x05E3, 0x0767, 0xFFFF, 0xFFFF, 0xFFFF, 0x0747, 0x0392, 0x021A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+			0xFFFF, 0x041C, 0xFFFF, 0xFFFF, 0x0532, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x05A2, 0x0505, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0706,
+			0x0321, 0xFFFF, 0xFFFF, 0x02A5, 0xFFFF, 0xFFFF, 0xFFFF, 0x00DD, 0x018F, 0x05FB, 0xFFFF, 0xFFFF, 0x06BC, 0xFFFF, 0xFFFF, 0xFFFF,
+			0xFFFF, 0xFFFF, 0xFFFF, 0x05A7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x053D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x07D3, 0xFFFF, 0xFFFF,
+			0xFFFF, 0x06B2, 0x0078, 0x01F6, 0x061E, 0xFFFF, 0x043F, 0x017D, 0xFFFF, 0xFFFF, 0x054E, 0x01EE, 0xFFFF, 0xFFFF, 0x00AD, 0xFFFF,
+			0x0762, 0x06C0, 0x0549, 0xFFFF, 0xFFFF, 0xFFFF, 0x0162, 0xFFFF, 0x010A, 0xFFFF, 0x032D, 0x04DA, 0x02D4, 0x0697, 0xFFFF, 0x0370,
+			0x03FA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x01D4, 0xFFFF, 0xFFFF, 0xFFFF, 0x02E8, 0x06D5, 0xFFFF, 0x006D, 0xFFFF, 0xFFFF, 0x02B8,
+			0xFFFF, 0x045D, 0xFFFF, 0x009B, 0xFFFF, 0x04B3, 0x0643, 0x0562, 0xFFFF, 0x0342, 0xFFFF, 0xFFFF, 0x0790, 0xFFFF, 0xFFFF, 0x0682,
+			0x00E8, 0x0554, 0xFFFF, 0xFFFF, 0x05A8, 0xFFFF, 0x0016, 0xFFFF, 0x062D, 0x00B5, 0xFFFF, 0x02BB, 0xFFFF, 0x06A0, 0xFFFF, 0xFFFF,
+			0xFFFF, 0x0264, 0xFFFF, 0xFFFF, 0x0721, 0x0592, 0xFFFF, 0x015E, 0xFFFF, 0x06FD, 0x0281, 0x0285, 0xFFFF, 0xFFFF, 0x06F2, 0x0208,
+			0x04FF, 0x04F4, 0xFFFF, 0x016B, 0xFFFF, 0x029B, 0xFFFF, 0xFFFF, 0x0323, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x04FB,
+			0xFFFF, 0xFFFF, 0x0296, 0xFFFF, 0x0463, 0xFFFF, 0xFFFF, 0xFFFF, 0x06CF, 0xFFFF, 0x0349, 0x0411, 0x0646, 0xFFFF, 0xFFFF, 0xFFFF,
+			0x0495, 0xFFFF, 0x04F5, 0xFFFF, 0xFFFF, 0x0159, 0x001F, 0x0662, 0x0434, 0x031D, 0xFFFF, 0xFFFF, 0xFFFF, 0x0611, 0x04F6, 0xFFFF,
+			0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0150, 0xFFFF, 0x03A9, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x011F, 0xFFFF, 0x003E,
+			0x0015, 0x06D9, 0x0352, 0x0765, 0xFFFF, 0x0489, 0x0634, 0x0485, 0xFFFF, 0x04E4, 0xFFFF, 0xFFFF, 0x042F, 0xFFFF, 0xFFFF, 0xFFFF,
+			0xFFFF, 0x014C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0117, 0xFFFF, 0x0746, 0xFFFF, 0x03B7, 0xFFFF, 0x0266, 0x026B, 0x00C0, 0xFFFF,
+			0x0260, 0x0683, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x01BE, 0x01F8, 0xFFFF, 0x0525, 0x04EE, 0x0105, 0x0012,
+			0x0336, 0xFFFF, 0xFFFF, 0x05A0, 0xFFFF, 0x00C9, 0x02AA, 0xFFFF, 0x072A, 0x043C, 0xFFFF, 0x03C7, 0x01E4, 0x042C, 0x0466, 0xFFFF,
+			0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0097, 0x06E9, 0x0530, 0xFFFF, 0xFFFF, 0x0600, 0x01A2, 0x00E3, 0x0550, 0x0091, 0xFFFF, 0x0130,
+			0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x00AC, 0xFFFF, 0x04F9, 0x0625, 0x02AF, 0xFFFF, 0x058C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+			0xFFFF, 0x06E8, 0x010F, 0x0084, 0xFFFF, 0x0240, 0x02A1, 0x07A9, 0x0061, 0xFFFF, 0x012F, 0xFFFF, 0xFFFF, 0x07CE, 0x07A6, 0xFFFF,
+			0xFFFF, 0x01F7, 0x048E, 0xFFFF, 0x0736, 0x03E4, 0xFFFF, 0x0142, 0xFFFF, 0xFFFF, 0x0345, 0x07B6, 0xFFFF, 0x0364, 0x053F, 0x0439,
+			0x0357, 0x0322, 0xFFFF, 0xFFFF, 0x0782, 0xFFFF, 0x01A1, 0xFFFF, 0x05FF, 0x0442, 0xFFFF, 0xFFFF, 0x06CE, 0x07C6, 0xFFFF, 0x036E,
+			0x060C, 0xFFFF, 0xFFFF, 0xFFFF, 0x0297, 0x014F, 0x012A, 0x0596, 0x0102, 0x003A, 0x0045, 0x029E, 0x004B, 0x0185, 0xFFFF, 0x0366,
+			0x04A2, 0xFFFF, 0xFFFF, 0x0478, 0xFFFF, 0x038A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0112, 0xFFFF, 0x05AA, 0xFFFF, 0x0011,
+			0xFFFF, 0x041D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x03E1, 0xFFFF, 0x0036, 0xFFFF, 0x01C2, 0xFFFF, 0x030E, 0x05CB, 0xFFFF,
+			0x0388, 0x00AB, 0xFFFF, 0x03C8, 0xFFFF, 0xFFFF, 0xFFFF, 0x05E9, 0x032F, 0x0521, 0x053C, 0xFFFF, 0xFFFF, 0x00AA, 0x006B, 0xFFFF,
+			0xFFFF, 0x03EC, 0xFFFF, 0x0356, 0xFFFF, 0xFFFF, 0x0786, 0xFFFF, 0x013C, 0x075C, 0x002A, 0x01B8, 0xFFFF, 0x0436, 0xFFFF, 0x0386,
+			0x0034, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0758, 0x03F0, 0xFFFF, 0xFFFF, 0x059D, 0x0115, 0xFFFF, 0xFFFF, 0x006F, 0xFFFF, 0xFFFF,
+			0x037F, 0xFFFF, 0x074A, 0xFFFF, 0x014D, 0xFFFF, 0x02BA, 0x03B8, 0x0759, 0x00D4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x025D, 0x027C,
+			0xFFFF, 0xFFFF, 0x014E, 0x052E, 0xFFFF, 0x0074, 0x074E, 0xFFFF, 0x01AF, 0x0226, 0x061F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+			0x01A8, 0xFFFF, 0x02B1, 0xFFFF, 0xFFFF, 0x0263, 0xFFFF, 0xFFFF, 0xFFFF, 0x071A, 0xFFFF, 0xFFFF, 0x071E, 0x06CD, 0x0713, 0x06A8,
+			0xFFFF, 0xFFFF, 0x06C7, 0x00BE, 0xFFFF, 0xFFFF, 0x02D0, 0x041A, 0x01BD, 0xFFFF, 0xFFFF, 0xFFFF, 0x0526, 0x0178, 0x03FD, 0x02BD,
+			0xFFFF, 0x05DC, 0x00BC, 0x029F, 0xFFFF, 0x07AB, 0xFFFF, 0x0167, 0xFFFF, 0xFFFF, 0x04B4, 0x00B3, 0x057E, 0x049E, 0x0080, 0x0568,
+			0x0487, 0xFFFF, 0xFFFF, 0x0201, 0x0085, 0xFFFF, 0xFFFF, 0x0588, 0x02FA, 0xFFFF, 0x0018, 0xFFFF, 0xFFFF, 0x00CA, 0x0534, 0x01A9,
+			0xFFFF, 0x04A8, 0x01A0, 0x026D, 0x0652, 0x05DA, 0xFFFF, 0xFFFF, 0x067C, 0x0156, 0xFFFF, 0x04C2, 0x0031, 0xFFFF, 0xFFFF, 0x040D,
+			0xFFFF, 0xFFFF, 0xFFFF, 0x05E0, 0xFFFF, 0x042E, 0xFFFF, 0xFFFF, 0xFFFF, 0x055E, 0x0143, 0x021D, 0x0635, 0x03BA, 0x0234, 0xFFFF,
+			0xFFFF, 0xFFFF, 0xFFFF, 0x0325, 0xFFFF, 0xFFFF, 0x02C1, 0x00D1, 0xFFFF, 0x0669, 0xFFFF, 0xFFFF, 0x02F5, 0xFFFF, 0xFFFF, 0xFFFF,
+			0x009A, 0x06E3, 0x04E9, 0x0395, 0x0720, 0x065C, 0x037D, 0x00C3, 0xFFFF, 0x079F, 0xFFFF, 0xFFFF, 0x0779, 0xFFFF, 0x042A, 0xFFFF,
+			0xFFFF, 0xFFFF, 0xFFFF, 0x00E0, 0xFFFF, 0x02FB, 0x0605, 0xFFFF, 0x05C9, 0xFFFF, 0xFFFF, 0xFFFF, 0x0099, 0x00A7, 0x04A7, 0x04D9,
+			0xFFFF, 0x0058, 0x05AB, 0xFFFF, 0x019B, 0x019F, 0x04F0, 0xFFFF, 0xFFFF, 0xFFFF, 0x05C6, 0x02C8, 0x06FE, 0x06BD, 0x0799, 0xFFFF,
+			0xFFFF, 0xFFFF, 0x0733, 0x0212, 0xFFFF, 0xFFFF, 0x060F, 0x0041, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x05D0, 0x046B, 0x04B8, 0xFFFF,
+			0x02CE, 0xFFFF, 0xFFFF, 0x0284, 0xFFFF, 0xFFFF, 0x00D2, 0x0595, 0xFFFF, 0xFFFF, 0x0355, 0xFFFF, 0xFFFF, 0x04CA, 0xFFFF, 0x016C,
+			0x01E9, 0xFFFF, 0x05E4, 0xFFFF, 0x0496, 0x0232, 0xFFFF, 0x0242, 0x064F, 0x068C, 0xFFFF, 0x04EB, 0x072C, 0x0690, 0xFFFF, 0xFFFF,
+			0xFFFF, 0xFFFF, 0x071C, 0x071B, 0x041E, 0x035A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0312, 0xFFFF, 0xFFFF, 0x07BE,
+			0x075B, 0xFFFF, 0xFFFF, 0x0435, 0xFFFF, 0xFFFF, 0x037B, 0x073D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0110, 0xFFFF, 0xFFFF, 0xFFFF,
+			0xFFFF, 0xFFFF, 0x04DD, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x007E, 0xFFFF, 0x07AA, 0xFFFF, 0x0283, 0xFFFF, 0xFFFF, 0x0231, 0x06D0,
+			0x07CA, 0xFFFF, 0x0069, 0x0054, 0x0108, 0xFFFF, 0x04B5, 0xFFFF, 0xFFFF, 0x0037, 0xFFFF, 0x0446, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+			0xFFFF, 0x0448, 0xFFFF, 0x0789, 0xFFFF, 0x0081, 0xFFFF, 0x01E5, 0xFFFF, 0x06DE, 0xFFFF, 0xFFFF, 0x020A, 0x01D2, 0xFFFF, 0xFFFF,
+			0x01CC, 0x04D8, 0x00A6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x07B1, 0xFFFF, 0x03A8, 0x0375, 0xFFFF, 0x0359, 0xFFFF, 0x07B9, 0xFFFF,
+			0x07BF, 0xFFFF, 0x0754, 0xFFFF, 0xFFFF, 0x0748, 0xFFFF, 0x0719, 0x0022, 0xFFFF, 0xFFFF, 0xFFFF, 0x0480, 0xFFFF, 0x07C7, 0xFFFF,
+			0x0013, 0xFFFF, 0x00B7, 0x0638, 0x0766, 0xFFFF, 0xFFFF, 0xFFFF, 0x0660, 0xFFFF, 0x0373, 0xFFFF, 0xFFFF, 0x03FF, 0x05AE, 0xFFFF,
+			0x0454, 0xFFFF, 0x01FA, 0x0402, 0xFFFF, 0x02EE, 0x03D2, 0xFFFF, 0x0522, 0x05B4, 0xFFFF, 0x0616, 0x01D6, 0x00BB, 0x060A, 0xFFFF,
+			0x02E7, 0x0538, 0x0316, 0xFFFF, 0x0419, 0x0044, 0x07A2, 0xFFFF, 0xFFFF, 0x031F, 0x01B3, 0x0076, 0x061B, 0x0761, 0x05BC, 0xFFFF,
+			0x00CE, 0x032E, 0xFFFF, 0x02B5, 0xFFFF, 0xFFFF, 0x026E, 0xFFFF, 0x0272, 0x0542, 0xFFFF, 0x03A0, 0xFFFF, 0xFFFF, 0xFFFF, 0x03B4,
+			0xFFFF, 0x05A5, 0xFFFF, 0xFFFF, 0x0381, 0xFFFF, 0x04D3, 0x03A6, 0xFFFF, 0xFFFF, 0x008C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+			0x06A1, 0x0256, 0xFFFF, 0xFFFF, 0xFFFF, 0x050C, 0x0042, 0x0447, 0x0287, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0645, 0xFFFF, 0x073A,
+			0x06DA, 0x0184, 0xFFFF, 0x0619, 0xFFFF, 0xFFFF, 0x01C7, 0x0223, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0602, 0x03DB, 0xFFFF, 0x006A,
+			0x0367, 0x0118, 0x028D, 0x02CF, 0xFFFF, 0xFFFF, 0x05D3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0385, 0x0341, 0x0460, 0x0654,
+			0xFFFF, 0xFFFF, 0x01DB, 0xFFFF, 0xFFFF, 0x00B1, 0x0676, 0xFFFF, 0xFFFF, 0x055B, 0x0160, 0xFFFF, 0xFFFF, 0x06AC, 0x0197, 0x0512,
+			0xFFFF, 0xFFFF, 0x0728, 0x000C, 0x0628, 0xFFFF, 0xFFFF, 0xFFFF, 0x00EB, 0xFFFF, 0xFFFF, 0xFFFF, 0x0301, 0x03D8, 0xFFFF, 0xFFFF,
+			0xFFFF, 0x0492, 0xFFFF, 0x001A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x01AD, 0x01F0, 0x0558, 0xFFFF, 0x0151, 0xFFFF, 0xFFFF,
+			0x0432, 0x014B, 0xFFFF, 0xFFFF, 0x045F, 0x05F4, 0x05F5, 0xFFFF, 0x0005, 0xFFFF, 0xFFFF, 0x026C, 0xFFFF, 0xFFFF, 0xFFFF, 0x051E,
+			0x069B, 0xFFFF, 0x04D6, 0xFFFF, 0x0319, 0xFFFF, 0x05EC, 0x049D, 0x0236, 0xFFFF, 0x0293, 0x03BB, 0xFFFF, 0xFFFF, 0x056D, 0x04E3,
+			0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0172, 0x040B, 0x043A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x000E, 0x009F,
+			0x009E, 0x075A, 0xFFFF, 0x0430, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x020F, 0xFFFF, 0x06E0, 0xFFFF, 0xFFFF, 0x00EA, 0xFFFF, 0x072D,
+			0xFFFF, 0xFFFF, 0xFFFF, 0x018E, 0xFFFF, 0x0183, 0xFFFF, 0xFFFF, 0xFFFF, 0x0289, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0552, 0xFFFF,
+			0x05D7, 0x00FF, 0x01DC, 0xFFFF, 0x042B, 0x049F, 0x0692, 0x0655, 0x073B, 0xFFFF, 0xFFFF, 0xFFFF, 0x02EB, 0xFFFF, 0x0770, 0x01C6,
+			0xFFFF, 0x068E, 0x074B, 0xFFFF, 0x0493, 0xFFFF, 0x0176, 0xFFFF, 0xFFFF, 0x04B0, 0xFFFF, 0x0570, 0xFFFF, 0xFFFF, 0x06AB, 0x02CC,
+			0x075E, 0x02B0, 0xFFFF, 0x0656, 0xFFFF, 0x0068, 0x02B4, 0xFFFF, 0xFFFF, 0x0452, 0x04D1, 0x00E4, 0xFFFF, 0x03A5, 0xFFFF, 0x02E5,
+			0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0693, 0x0247, 0x0059, 0x0394, 0x0032, 0x0119, 0x06A3, 0xFFFF, 0xFFFF, 0xFFFF, 0x0401,
+			0xFFFF, 0x0449, 0xFFFF, 0x02B7, 0xFFFF, 0xFFFF, 0x070E, 0x04D5, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0049, 0xFFFF, 0x0255, 0x04B1,
+			0x06D2, 0x0501, 0x0572, 0xFFFF, 0xFFFF, 0x03F2, 0xFFFF, 0xFFFF, 0x0783, 0xFFFF, 0xFFFF, 0x0560, 0xFFFF, 0xFFFF, 0x050A, 0xFFFF,
+			0x0161, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x01C4, 0xFFFF, 0x071F, 0x0306, 0xFFFF, 0x0186, 0x010B, 0xFFFF, 0xFFFF, 0xFFFF, 0x05B7,
+			0xFFFF, 0x0158, 0x0776, 0xFFFF, 0x0324, 0x002D, 0xFFFF, 0x03AA, 0xFFFF, 0x067A, 0x039E, 0xFFFF, 0x073C, 0x031B, 0x02BF, 0x0318,
+			0x0070, 0x048A, 0xFFFF, 0x00E9, 0x022E, 0xFFFF, 0x0361, 0x0780, 0xFFFF, 0xFFFF, 0x07A3, 0xFFFF, 0x0664, 0x07D2, 0xFFFF, 0xFFFF,
+			0xFFFF, 0x07AE, 0xFFFF, 0xFFFF, 0xFFFF, 0x0035, 0xFFFF, 0x007D, 0xFFFF, 0xFFFF, 0x005B, 0x0327, 0xFFFF, 0x04E8, 0xFFFF, 0x00F7,
+			0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0169, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x02E3, 0x0773, 0xFFFF,
+			0xFFFF, 0xFFFF, 0x07C4, 0xFFFF, 0xFFFF, 0x011E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0114, 0xFFFF, 0x0396, 0x0749,
+			0x000A, 0xFFFF, 0x0382, 0xFFFF, 0x0539, 0xFFFF, 0xFFFF, 0x074C, 0x025F, 0x0379, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x00A0, 0x0533,
+			0x0140, 0x04AD, 0xFFFF, 0xFFFF, 0x0103, 0xFFFF, 0xFFFF, 0x0644, 0xFFFF, 0x0343, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+			0xFFFF, 0x0714, 0x05E5, 0xFFFF, 0xFFFF, 0xFFFF, 0x03E0, 0x035C, 0x0090, 0xFFFF, 0xFFFF, 0x05BE, 0xFFFF, 0x051D, 0x0350, 0xFFFF,
+			0x0469, 0xFFFF, 0x0703, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0583, 0x07C5, 0x0797, 0x02E2, 0xFFFF, 0xFFFF, 0xFFFF, 0x0224, 0xFFFF,
+			0x0707, 0xFFFF, 0xFFFF, 0x05D4, 0x06A9, 0xFFFF, 0x0523, 0xFFFF, 0x02B2, 0xFFFF, 0xFFFF, 0x0209, 0x00EC, 0xFFFF, 0xFFFF, 0xFFFF,
+			0xFFFF, 0xFFFF, 0x0308, 0x073E, 0xFFFF, 0x024A, 0x0148, 0xFFFF, 0xFFFF, 0x0425, 0x0237, 0xFFFF, 0xFFFF, 0xFFFF, 0x034E, 0x02DB,
+			0x00EE, 0x0695, 0xFFFF, 0x0488, 0x0331, 0xFFFF, 0xFFFF, 0x0506, 0x06B6, 0x0416, 0xFFFF, 0xFFFF, 0x03EB, 0xFFFF, 0xFFFF, 0x04CB,
+			0x02C2, 0xFFFF, 0x05EA, 0x02E1, 0x03FC, 0xFFFF, 0x0565, 0xFFFF, 0x04E6, 0x0071, 0x06A7, 0x06C6, 0xFFFF, 0xFFFF, 0x004C, 0x0531,
+			0xFFFF, 0xFFFF, 0x032C, 0xFFFF, 0xFFFF, 0x076E, 0xFFFF, 0x0404, 0x01E0, 0xFFFF, 0x05C3, 0x0137, 0x0546, 0xFFFF, 0x0680, 0xFFFF,
+			0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0126, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x027D, 0xFFFF, 0xFFFF, 0x033A, 0xFFFF, 0xFFFF, 0x065A,
+			0x036C, 0x063F, 0x044B, 0xFFFF, 0x0422, 0x0637, 0xFFFF, 0x0127, 0x0347, 0x057A, 0x06D4, 0x06DC, 0xFFFF, 0xFFFF, 0xFFFF, 0x06CA,
+			0xFFFF, 0xFFFF, 0x048D, 0xFFFF, 0x0120, 0xFFFF, 0xFFFF, 0xFFFF, 0x05E2, 0xFFFF, 0xFFFF, 0x05D6, 0x03F1, 0x056C, 0x03D5, 0x0543,
+			0xFFFF, 0x058E, 0xFFFF, 0xFFFF, 0x0258, 0x03B3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x062E, 0x06ED, 0x0229, 0x0490, 0xFFFF, 0x03F8,
+			0xFFFF, 0x070A, 0xFFFF, 0x0518, 0xFFFF, 0xFFFF, 0xFFFF, 0x0305, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0009, 0xFFFF, 0x05BB,
+			0x0689, 0xFFFF, 0xFFFF, 0x0065, 0xFFFF, 0xFFFF, 0xFFFF, 0x0601, 0x07AC, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x04AF, 0x0768,
+			0xFFFF, 0x017F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0238, 0xFFFF, 0x02F2, 0x02A7, 0xFFFF, 0x0163, 0xFFFF, 0xFFFF, 0xFFFF,
+			0x0048, 0x03C0, 0xFFFF, 0x079B, 0x068B, 0xFFFF, 0x0086, 0xFFFF, 0x0194, 0xFFFF, 0x03B1, 0x0096, 0xFFFF, 0x0681, 0xFFFF, 0x0742,
+			0xFFFF, 0xFFFF, 0x001C, 0xFFFF, 0x0581, 0x06FF, 0x0582, 0xFFFF, 0xFFFF, 0xFFFF, 0x002F, 0xFFFF, 0x011B, 0xFFFF, 0x0517, 0xFFFF,
+			0x007C, 0xFFFF, 0x01F3, 0x0259, 0xFFFF, 0xFFFF, 0x0365, 0xFFFF, 0xFFFF, 0x0387, 0xFFFF, 0x01F5, 0xFFFF, 0xFFFF, 0x0019, 0xFFFF,
+			0x04FD, 0x0653, 0x050B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x012C, 0xFFFF, 0x01B6, 0xFFFF, 0x031E, 0xFFFF, 0x032B, 0xFFFF, 0x04C6,
+			0xFFFF, 0xFFFF, 0x027B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x00FB, 0x00D8, 0xFFFF, 0xFFFF, 0x03F5, 0xFFFF, 0x039F,
+			0xFFFF, 0x03C3, 0x0153, 0x0482, 0x05F3, 0xFFFF, 0xFFFF, 0x045E, 0xFFFF, 0x0650, 0xFFFF, 0x0313, 0x00ED, 0x04C4, 0xFFFF, 0xFFFF,
+			0x0315, 0xFFFF, 0x0215, 0x007A, 0xFFFF, 0x001B, 0xFFFF, 0xFFFF, 0x0636, 0x024E, 0xFFFF, 0x0744, 0xFFFF, 0x00CB, 0x0028, 0x03BE,
+			0xFFFF, 0x0698, 0xFFFF, 0xFFFF, 0xFFFF, 0x0774, 0xFFFF, 0xFFFF, 0x0688, 0x073F, 0xFFFF, 0x0725, 0x0292, 0xFFFF, 0xFFFF, 0x0631,
+			0xFFFF, 0xFFFF, 0x00F6, 0x010D, 0xFFFF, 0xFFFF, 0xFFFF, 0x0073, 0xFFFF, 0x02A3, 0x0563, 0x0717, 0xFFFF, 0x0420, 0x01B0, 0xFFFF,
+			0x0575, 0x059F, 0x0200, 0xFFFF, 0xFFFF, 0x069E, 0x0415, 0xFFFF, 0xFFFF, 0xFFFF, 0x0410, 0xFFFF, 0x016F, 0x0687, 0xFFFF, 0xFFFF,
+			0x0456, 0xFFFF, 0x0310, 0xFFFF, 0xFFFF, 0x0458, 0xFFFF, 0x04BE, 0xFFFF, 0xFFFF, 0xFFFF, 0x06E5, 0xFFFF, 0x02F7, 0xFFFF, 0xFFFF,
+			0xFFFF, 0xFFFF, 0xFFFF, 0x0020, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x06FC, 0xFFFF, 0xFFFF, 0x018A, 0xFFFF, 0xFFFF, 0x0383, 0x046C,
+			0x078D, 0xFFFF, 0xFFFF, 0x06E1, 0x0230, 0x04AB, 0x06F1, 0x039A, 0x02D6, 0x0441, 0xFFFF, 0xFFFF, 0x051F, 0x0113, 0x022C, 0xFFFF,
+			0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x065B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x023E, 0x0540, 0xFFFF, 0xFFFF, 0x0604,
+			0xFFFF, 0xFFFF, 0xFFFF, 0x03AB, 0xFFFF, 0x0408, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x077C, 0xFFFF, 0xFFFF, 0x019C, 0x05ED,
+			0x0014, 0xFFFF, 0x01D9, 0xFFFF, 0xFFFF, 0x03E2, 0x04A1, 0xFFFF, 0x0252, 0xFFFF, 0x07D5, 0x01D8, 0xFFFF, 0x05AD, 0x0598, 0x0574,
+			0x0642, 0x034F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x04EC, 0xFFFF, 0xFFFF, 0xFFFF, 0x0147, 0x0087, 0x0275, 0x007F,
+			0x0412, 0x01CE, 0x0464, 0x0267, 0xFFFF, 0xFFFF, 0x0586, 0xFFFF, 0x0168, 0xFFFF, 0x0187, 0x03EF, 0xFFFF, 0x03E9, 0xFFFF, 0x04B2,
+			0x057F, 0x050F, 0xFFFF, 0xFFFF, 0x03CE, 0xFFFF, 0xFFFF, 0x0002, 0x0351, 0xFFFF, 0xFFFF, 0x0515, 0x0618, 0xFFFF, 0xFFFF, 0x0273,
+			0xFFFF, 0x0239, 0xFFFF, 0x0455, 0xFFFF, 0x0039, 0x0246, 0x04E0, 0xFFFF, 0x059A, 0x05B1, 0xFFFF, 0x005A, 0x03CB, 0xFFFF, 0xFFFF,
+			0x0380, 0x0220, 0x0427, 0x0648, 0x0494, 0x04BB, 0x00B6, 0x05F2, 0xFFFF, 0xFFFF, 0xFFFF, 0x04FE, 0xFFFF, 0xFFFF, 0x05A6, 0x035B,
+			0xFFFF, 0xFFFF, 0x04CD, 0xFFFF, 0x0317, 0x0017, 0x0193, 0x0222, 0x063A, 0xFFFF, 0xFFFF, 0x04CE, 0x05C4, 0x0620, 0xFFFF, 0x0149,
+			0xFFFF, 0x03A4, 0xFFFF, 0x056E, 0xFFFF, 0xFFFF, 0x064B, 0xFFFF, 0x0333, 0xFFFF, 0xFFFF, 0x06D7, 0xFFFF, 0x02A0, 0xFFFF, 0xFFFF,
+			0x0050, 0xFFFF, 0x06E4, 0x038C, 0xFFFF, 0xFFFF, 0x008B, 0xFFFF, 0xFFFF, 0xFFFF, 0x044A, 0x0192, 0x0678, 0xFFFF, 0x05F7, 0x01C8,
+			0xFFFF, 0xFFFF, 0xFFFF, 0x063C, 0xFFFF, 0xFFFF, 0x0529, 0x0658, 0x05E7, 0x01B5, 0x030F, 0xFFFF, 0xFFFF, 0x0111, 0x076B, 0xFFFF,
+			0x0128, 0x01A4, 0xFFFF, 0xFFFF, 0x0233, 0x0751, 0xFFFF, 0xFFFF, 0x0189, 0xFFFF, 0x0261, 0xFFFF, 0xFFFF, 0x0358, 0xFFFF, 0x0491,
+			0xFFFF, 0x00FD, 0x0088, 0x0123, 0xFFFF, 0x0195, 0xFFFF, 0x0750, 0x03EE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x00F8, 0x025A, 0x0674,
+			0x011A, 0x02B6, 0xFFFF, 0x04A0, 0x03AD, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0615, 0x055D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x072F,
+			0x066E, 0x02C6, 0x0561, 0x066D, 0xFFFF, 0x0057, 0xFFFF, 0x040E, 0xFFFF, 0xFFFF, 0x06A6, 0x0299, 0xFFFF, 0xFFFF, 0x03C6, 0xFFFF,
+			0x023C, 0x00AF, 0xFFFF, 0x06A5, 0x0138, 0xFFFF, 0x017C, 0xFFFF, 0x0793, 0xFFFF, 0xFFFF, 0x0165, 0x07CF, 0xFFFF, 0x0421, 0xFFFF,
+			0xFFFF, 0xFFFF, 0xFFFF, 0x0179, 0x0104, 0x0210, 0xFFFF, 0x069F, 0xFFFF, 0x0772, 0xFFFF, 0x061D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+			0x00F0, 0x0202, 0xFFFF, 0x0109, 0xFFFF, 0x01BB, 0xFFFF, 0xFFFF, 0xFFFF, 0x030B, 0xFFFF, 0xFFFF, 0x0399, 0xFFFF, 0xFFFF, 0x0213,
+			0xFFFF, 0x01EA, 0x0077, 0xFFFF, 0xFFFF, 0x057B, 0x04BD, 0xFFFF, 0xFFFF, 0x0569, 0x054B, 0xFFFF, 0xFFFF, 0x0393, 0x04DE, 0x02C3,
+			0xFFFF, 0x06F9, 0xFFFF, 0x066A, 0xFFFF, 0x078B, 0x05D5, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0277, 0xFFFF,
+			0xFFFF, 0xFFFF, 0x025C, 0xFFFF, 0x028C, 0x05C7, 0x0004, 0xFFFF, 0xFFFF, 0xFFFF, 0x05A3, 0xFFFF, 0xFFFF, 0xFFFF, 0x05C0, 0xFFFF,
+			0x022D, 0xFFFF, 0xFFFF, 0x0006, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0190, 0x0339, 0x034B, 0xFFFF, 0x07CD, 0x04A6, 0xFFFF, 0xFFFF,
+			0xFFFF, 0xFFFF, 0x02DD, 0x05BF, 0x018B, 0xFFFF, 0x03C1, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0030, 0x0106, 0x0391, 0x0591, 0x0221,
+			0xFFFF, 0x0294, 0xFFFF, 0x06F6, 0xFFFF, 0x030A, 0x01B4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x04B6, 0x0024, 0xFFFF, 0x013F,
+			0x046E, 0xFFFF, 0xFFFF, 0xFFFF, 0x03F9, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0599, 0xFFFF, 0xFFFF, 0xFFFF, 0x0217,
+			0x0250, 0xFFFF, 0x0290, 0x033E, 0xFFFF, 0x03C2, 0x05B6, 0xFFFF, 0xFFFF, 0xFFFF, 0x0732, 0xFFFF, 0xFFFF, 0xFFFF, 0x0479, 0xFFFF,
+			0x069D, 0x070F, 0xFFFF, 0x0262, 0x05D8, 0xFFFF, 0x076A, 0x06B3, 0xFFFF, 0x0627, 0xFFFF, 0x040C, 0xFFFF, 0x06EB, 0xFFFF, 0xFFFF,
+			0x0298, 0x0757, 0xFFFF, 0xFFFF, 0xFFFF, 0x03B2, 0x01EC, 0x021B, 0x0274, 0xFFFF, 0xFFFF, 0x00C4, 0xFFFF, 0x06B1, 0x01C0, 0x0551,
+			0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0174, 0x03D9, 0x0702, 0x00FC, 0xFFFF, 0x00D0, 0x03CF, 0xFFFF, 0x0584, 0x00DC,
+			0xFFFF, 0x0556, 0xFFFF, 0x0199, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x00F3, 0x03A2, 0xFFFF, 0xFFFF, 0x0580, 0x01E8, 0x00FA,
+			0x054F, 0xFFFF, 0x0079, 0xFFFF, 0x0302, 0x0630, 0x04C3, 0x020B, 0xFFFF, 0x0718, 0x0564, 0xFFFF, 0x0576, 0xFFFF, 0x0462, 0xFFFF,
+			0x04C1, 0x02ED, 0x046A, 0xFFFF, 0x03A7, 0x038E, 0xFFFF, 0x008A, 0x01FB, 0x01BF, 0x015B, 0x021F, 0xFFFF, 0xFFFF, 0xFFFF, 0x0203,
+			0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x02DC, 0x0311, 0x05DF, 0xFFFF, 0xFFFF, 0x00D5, 0x0509, 0x0519, 0xFFFF, 0xFFFF, 0x004A, 0x0679,
+			0xFFFF, 0xFFFF, 0x075D, 0x05BA, 0x03AC, 0x0182, 0x0170, 0xFFFF, 0xFFFF, 0xFFFF, 0x012E, 0xFFFF, 0x01AC, 0x07AF, 0x0046, 0x07A4,
+			0xFFFF, 0x0675, 0x01A6, 0x06B8, 0x046D, 0x0082, 0xFFFF, 0x0684, 0xFFFF, 0x02E0, 0xFFFF, 0xFFFF, 0x05FD, 0x019A, 0xFFFF, 0x001D,
+			0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x03D3, 0xFFFF, 0x0536, 0xFFFF, 0xFFFF, 0x0249, 0xFFFF, 0x0745, 0x00F2, 0x0471, 0xFFFF, 0x0021,
+			0x05EE, 0xFFFF, 0x06A2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0704, 0xFFFF, 0xFFFF, 0x0497, 0xFFFF, 0xFFFF, 0x00B4, 0xFFFF, 0x05D2,
+			0x027E, 0xFFFF, 0x043B, 0x008D, 0x03B0, 0x02CA, 0x0269, 0x052F, 0xFFFF, 0x0029, 0xFFFF, 0xFFFF, 0x06AE, 0xFFFF, 0x005C, 0x0423,
+			0xFFFF, 0xFFFF, 0x05A4, 0x015A, 0x0537, 0xFFFF, 0xFFFF, 0xFFFF, 0x053B, 0xFFFF, 0x06AD, 0xFFFF, 0x054A, 0xFFFF, 0x002C, 0x06F4,
+			0x05B2, 0x01DF, 0x0503, 0xFFFF, 0xFFFF, 0x0253, 0x03F4, 0x02AB, 0xFFFF, 0xFFFF, 0xFFFF, 0x01AA, 0x0094, 0xFFFF, 0x039D, 0xFFFF,
+			0xFFFF, 0x060E, 0xFFFF, 0xFFFF, 0x0527, 0x005D, 0xFFFF, 0xFFFF, 0x013A, 0x078C, 0x03C9, 0xFFFF, 0xFFFF, 0xFFFF, 0x0338, 0x0514,
+			0xFFFF, 0x00D3, 0x049B, 0xFFFF, 0xFFFF, 0xFFFF, 0x0726, 0x064C, 0x0792, 0xFFFF, 0x07B4, 0xFFFF, 0xFFFF, 0xFFFF, 0x0139, 0xFFFF,
+			0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x022A, 0xFFFF, 0x00E2, 0x01E6, 0x02F9, 0x0483, 0xFFFF, 0x04D7, 0x0144, 0xFFFF, 0xFFFF, 0xFFFF,
+			0x0524, 0xFFFF, 0xFFFF, 0x0511, 0x06BB, 0x00D7, 0xFFFF, 0x02DF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x01E1, 0xFFFF, 0x02F0,
+			0xFFFF, 0xFFFF, 0xFFFF, 0x0438, 0xFFFF, 0xFFFF, 0xFFFF, 0x07A1, 0x076D, 0xFFFF, 0x032A, 0xFFFF, 0x0666, 0xFFFF, 0x04F1, 0x02E6,
+			0x0038, 0x047F, 0xFFFF, 0x079A, 0x046F, 0xFFFF, 0xFFFF, 0xFFFF, 0x04FA, 0x0026, 0xFFFF, 0xFFFF, 0x000B, 0x063B, 0xFFFF, 0xFFFF,
+			0x00DE, 0x01D0, 0x05DE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x03E5, 0x03DC, 0xFFFF, 0x06C5, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+			0x022F, 0x0075, 0xFFFF, 0x0722, 0xFFFF, 0xFFFF, 0x060D, 0xFFFF, 0xFFFF, 0x013E, 0xFFFF, 0x0771, 0xFFFF, 0xFFFF, 0xFFFF, 0x0216,
+			0xFFFF, 0x0282, 0xFFFF, 0x05B9, 0x019D, 0x017B, 0x00BF, 0xFFFF, 0x01A3, 0x0152, 0x02D3, 0xFFFF, 0xFFFF, 0x05B0, 0xFFFF, 0xFFFF,
+			0xFFFF, 0x063D, 0xFFFF, 0x00B0, 0x0685, 0xFFFF, 0x061C, 0xFFFF, 0x0610, 0x04BA, 0xFFFF, 0x045B, 0xFFFF, 0xFFFF, 0xFFFF, 0x03F3,
+			0x0701, 0x027A, 0xFFFF, 0xFFFF, 0x042D, 0xFFFF, 0xFFFF, 0x02A9, 0xFFFF, 0x0377, 0x051B, 0x0535, 0x013D, 0x050E, 0xFFFF, 0xFFFF,
+			0xFFFF, 0x028B, 0xFFFF, 0xFFFF, 0x0418, 0x06F7, 0xFFFF, 0xFFFF, 0xFFFF, 0x0095, 0x06C8, 0x01D7, 0xFFFF, 0x0606, 0xFFFF, 0x069C,
+			0xFFFF, 0xFFFF, 0x00BD, 0xFFFF, 0xFFFF, 0xFFFF, 0x00F9, 0xFFFF, 0xFFFF, 0xFFFF, 0x00A9, 0x03C4, 0x0228, 0x0677, 0x0578, 0x0207,
+			0x008E, 0xFFFF, 0x020E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x06FA, 0xFFFF, 0xFFFF, 0xFFFF, 0x047D, 0xFFFF, 0x01EB, 0x03FB, 0x0225,
+			0xFFFF, 0xFFFF, 0xFFFF, 0x0133, 0x057C, 0xFFFF, 0xFFFF, 0xFFFF, 0x03EA, 0xFFFF, 0x02F3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+			0xFFFF, 0x0089, 0xFFFF, 0xFFFF, 0x0227, 0xFFFF, 0x03FE, 0xFFFF, 0xFFFF, 0x056B, 0x06FB, 0x02D9, 0x03BF, 0x01B7, 0xFFFF, 0xFFFF,
+			0xFFFF, 0x07A7, 0xFFFF, 0xFFFF, 0x0205, 0xFFFF, 0xFFFF, 0x0555, 0xFFFF, 0xFFFF, 0x0510, 0x035D, 0x00C1, 0xFFFF, 0xFFFF, 0x04ED,
+			0x039B, 0x03DE, 0x04BF, 0x0594, 0x024C, 0x066F, 0x0712, 0xFFFF, 0xFFFF, 0x00A2, 0x0155, 0x011C, 0x078E, 0xFFFF, 0x0188, 0x035E,
+			0xFFFF, 0x0389, 0x03ED, 0x0777, 0x03B5, 0x06F8, 0xFFFF, 0x065F, 0x0651, 0x07A0, 0xFFFF, 0x062B, 0x0465, 0xFFFF, 0xFFFF, 0xFFFF,
+			0x02C7, 0x057D, 0x0334, 0x06C2, 0x0177, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x04DF, 0xFFFF, 0x06D3, 0xFFFF,
+			0x05B5, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0672, 0xFFFF, 0x04EF, 0x00A5, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x04AE, 0x02A2,
+			0x06C1, 0x079C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0268, 0x00C5, 0x00A8, 0x077E, 0xFFFF, 0x0624, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+			0x020C, 0x03BC, 0xFFFF, 0xFFFF, 0xFFFF, 0x0741, 0xFFFF, 0x04B9, 0xFFFF, 0x0354, 0x02AE, 0x0544, 0x0715, 0x0443, 0xFFFF, 0xFFFF,
+			0xFFFF, 0xFFFF, 0x056A, 0xFFFF, 0xFFFF, 0x05BD, 0xFFFF, 0x01DA, 0x0154, 0x00CF, 0x03D4, 0x04F7, 0xFFFF, 0x0451, 0x06BA, 0xFFFF,
+			0x000F, 0x037A, 0x0066, 0x011D, 0x04AA, 0x0440, 0xFFFF, 0x033D, 0x06D1, 0x0473, 0x043E, 0xFFFF, 0xFFFF, 0x0417, 0x0286, 0x04D2,
+			0x04F2, 0xFFFF, 0x009C, 0x035F, 0xFFFF, 0xFFFF, 0x023F, 0x02EC, 0x01DD, 0x0335, 0xFFFF, 0xFFFF, 0x05A1, 0xFFFF, 0x0670, 0xFFFF,
+			0xFFFF, 0xFFFF, 0xFFFF, 0x028F, 0x0390, 0x04C7, 0xFFFF, 0x0008, 0xFFFF, 0xFFFF, 0x053A, 0xFFFF, 0x006E, 0x077F, 0xFFFF, 0x03A3,
+			0x07C1, 0xFFFF, 0x0243, 0xFFFF, 0x02F1, 0x017A, 0xFFFF, 0xFFFF, 0x03CD, 0xFFFF, 0x0146, 0x001E, 0x07D0, 0x0376, 0x0053, 0x01FC,
+			0x0314, 0xFFFF, 0xFFFF, 0xFFFF, 0x01AB, 0x07AD, 0x03B6, 0x01F4, 0xFFFF, 0xFFFF, 0x0709, 0x04A4, 0x05F6, 0x05CD, 0x05E6, 0x0609,
+			0xFFFF, 0x01FF, 0xFFFF, 0x040A, 0xFFFF, 0x04E2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x059C, 0x06DF, 0x01B9, 0xFFFF, 0x06EC, 0x01FE,
+			0x0453, 0xFFFF, 0x028A, 0x0426, 0x02D2, 0xFFFF, 0x025E, 0x07C8, 0x07BC, 0xFFFF, 0x00A4, 0x06EE, 0x05E8, 0x06F0, 0x029C, 0x041B,
+			0xFFFF, 0xFFFF, 0x0398, 0xFFFF, 0x01E3, 0xFFFF, 0xFFFF, 0x028E, 0xFFFF, 0x0548, 0xFFFF, 0x0623, 0x0300, 0xFFFF, 0xFFFF, 0x0665,
+			0xFFFF, 0x01BA, 0x05F9, 0xFFFF, 0xFFFF, 0x0727, 0xFFFF, 0xFFFF, 0x00C8, 0x0047, 0x0251, 0xFFFF, 0xFFFF, 0xFFFF, 0x003D, 0x024F,
+			0xFFFF, 0xFFFF, 0xFFFF, 0x0723, 0xFFFF, 0xFFFF, 0x01C3, 0x0098, 0xFFFF, 0x03CA, 0xFFFF, 0x0010, 0x04F8, 0xFFFF, 0x01A7, 0x0407,
+			0xFFFF, 0x0437, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x00DF, 0x055C, 0xFFFF, 0x0617, 0xFFFF, 0xFFFF, 0xFFFF, 0x0040, 0xFFFF,
+			0x07A5, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x052A, 0x0500, 0x07C0, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x037E, 0xFFFF,
+			0x07D6, 0x0348, 0x047A, 0x007B, 0xFFFF, 0x044E, 0x055F, 0xFFFF, 0x06DB, 0x068A, 0x0513, 0x00AE, 0xFFFF, 0xFFFF, 0x07D7, 0xFFFF,
+			0x0279, 0xFFFF, 0x02BC, 0x02F4, 0x05D1, 0x04D4, 0xFFFF, 0xFFFF, 0xFFFF, 0x0567, 0x0724, 0xFFFF, 0xFFFF, 0x0743, 0x00CC, 0xFFFF,
+			0xFFFF, 0x02FC, 0xFFFF, 0xFFFF, 0x04E5, 0xFFFF, 0x0369, 0xFFFF, 0xFFFF, 0xFFFF, 0x02CB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+			0x0368, 0xFFFF, 0x07B3, 0xFFFF, 0xFFFF, 0x0608, 0xFFFF, 0x05F8, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+			0xFFFF, 0x0362, 0xFFFF, 0xFFFF, 0x0470, 0xFFFF, 0xFFFF, 0xFFFF, 0x06A4, 0x07BD, 0xFFFF, 0xFFFF, 0xFFFF, 0x075F, 0xFFFF, 0xFFFF,
+			0x05B8, 0xFFFF, 0x0571, 0xFFFF, 0xFFFF, 0x0003, 0x0467, 0x024B, 0xFFFF, 0x0132, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0330, 0x04C0,
+			0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x045A, 0xFFFF, 0xFFFF, 0xFFFF, 0x070D, 0xFFFF, 0x040F, 0x06B0, 0x024D,
+			0xFFFF, 0x063E, 0x0476, 0x0180, 0x02EF, 0x012B, 0xFFFF, 0x045C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0705, 0xFFFF, 0xFFFF,
+			0xFFFF, 0x005F, 0xFFFF, 0x0145, 0x0667, 0x06D8, 0x02D8, 0x02AD, 0x00A3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x013B, 0xFFFF,
+			0x06BF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0280, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x05C2, 0xFFFF, 0x0092, 0x0206,
+			0x0214, 0xFFFF, 0x0278, 0x0763, 0xFFFF, 0xFFFF, 0xFFFF, 0x0198, 0xFFFF, 0x0181, 0x03DA, 0x05B3, 0x0577, 0xFFFF, 0xFFFF, 0x0737,
+			0xFFFF, 0x0573, 0x014A, 0x0257, 0x03A1, 0xFFFF, 0xFFFF, 0x05AF, 0xFFFF, 0x0403, 0x06EA, 0x00E6, 0xFFFF, 0x06F5, 0x0752, 0xFFFF,
+			0xFFFF, 0x0587, 0xFFFF, 0xFFFF, 0x04DC, 0xFFFF, 0xFFFF, 0xFFFF, 0x022B, 0x0734, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0541, 0x02B9,
+			0x002E, 0xFFFF, 0x01ED, 0xFFFF, 0xFFFF, 0x034D, 0x054C, 0x06B7, 0x0101, 0xFFFF, 0xFFFF, 0xFFFF, 0x0353, 0xFFFF, 0xFFFF, 0xFFFF,
+			0x005E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0072, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0694, 0x0641, 0x029A, 0x0508, 0x01C1,
+			0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x04EA, 0xFFFF, 0xFFFF, 0x0700, 0x0320, 0xFFFF,
+			0x0100, 0x01F1, 0x068D, 0x048F, 0x07B2, 0x0060, 0x0671, 0xFFFF, 0xFFFF, 0xFFFF, 0x0791, 0x05AC, 0x06E6, 0x0553, 0xFFFF, 0x02BE,
+			0x0730, 0x0794, 0x064E, 0x05FA, 0x0764, 0xFFFF, 0xFFFF, 0x01EF, 0xFFFF, 0x07BA, 0xFFFF, 0x026A, 0x00E7, 0x07C2, 0xFFFF, 0xFFFF,
+			0x0288, 0x0559, 0x07D4, 0x0157, 0x0579, 0xFFFF, 0xFFFF, 0x070B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0614, 0xFFFF, 0x012D, 0xFFFF,
+			0xFFFF, 0x0063, 0x03B9, 0xFFFF, 0xFFFF, 0x0371, 0xFFFF, 0x047C, 0xFFFF, 0x034A, 0x0218, 0x02C9, 0x06EF, 0xFFFF, 0x018D, 0xFFFF,
+			0xFFFF, 0x030C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0400, 0x00DA, 0x0477, 0xFFFF, 0x00EF, 0x0547, 0xFFFF, 0xFFFF,
+			0xFFFF, 0x02AC, 0xFFFF, 0x037C, 0x0708, 0x0729, 0xFFFF, 0x00F4, 0x006C, 0x077A, 0xFFFF, 0x0486, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+			0xFFFF, 0x0498, 0xFFFF, 0x04CC, 0xFFFF, 0xFFFF, 0x0056, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0409, 0xFFFF, 0x0116, 0xFFFF,
+			0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x03AF, 0x041F, 0xFFFF, 0x066C, 0xFFFF, 0xFFFF, 0xFFFF, 0x00F5, 0xFFFF, 0x0639,
+			0x0673, 0x061A, 0x00CD, 0x076C, 0xFFFF, 0x003F, 0xFFFF, 0x0457, 0x0603, 0x044F, 0xFFFF, 0x00C6, 0xFFFF, 0x02F8, 0x0270, 0x0450,
+			0x047B, 0x0295, 0xFFFF, 0xFFFF, 0x00C7, 0x004D, 0xFFFF, 0x030D, 0x0613, 0xFFFF, 0xFFFF, 0x0344, 0xFFFF, 0xFFFF, 0x05DB, 0xFFFF,
+			0x036A, 0x059B, 0x0204, 0x04F3, 0xFFFF, 0x0755, 0xFFFF, 0x05C8, 0x0326, 0x0787, 0x015F, 0x0033, 0x0784, 0x058A, 0xFFFF, 0xFFFF,
+			0xFFFF, 0x02C4, 0x05CC, 0xFFFF, 0xFFFF, 0x05DD, 0xFFFF, 0x0241, 0x0135, 0x02B3, 0xFFFF, 0x0093, 0xFFFF, 0x01CA, 0x0067, 0x0716,
+			0x066B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x06B5, 0x05EB, 0xFFFF, 0x00D9, 0x0444, 0x03C5, 0xFFFF, 0x0557, 0xFFFF, 0xFFFF,
+			0xFFFF, 0xFFFF, 0x0164, 0xFFFF, 0xFFFF, 0x0475, 0x0265, 0x0668, 0x076F, 0xFFFF, 0xFFFF, 0x036B, 0xFFFF, 0x0424, 0xFFFF, 0xFFFF,
+			0xFFFF, 0xFFFF, 0xFFFF, 0x036F, 0x04C5, 0xFFFF, 0xFFFF, 0x0459, 0xFFFF, 0xFFFF, 0xFFFF, 0x00D6, 0x0378, 0x033B, 0x01B2, 0x023D,
+			0xFFFF, 0x03D0, 0xFFFF, 0xFFFF, 0xFFFF, 0x04BC, 0x04A9, 0xFFFF, 0x00E5, 0x0788, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0328, 0xFFFF,
+			0xFFFF, 0xFFFF, 0x04E1, 0x0516, 0x0738, 0x0405, 0xFFFF, 0xFFFF, 0x0597, 0xFFFF, 0x07C9, 0x00FE, 0xFFFF, 0x01E2, 0x043D, 0xFFFF,
+			0x07B0, 0x0760, 0x0795, 0x049A, 0x058F, 0xFFFF, 0x069A, 0xFFFF, 0x034C, 0x06B9, 0x008F, 0xFFFF, 0x0626, 0xFFFF, 0xFFFF, 0xFFFF,
+			0xFFFF, 0x077D, 0xFFFF, 0x02A6, 0x04C8, 0x07CC, 0x0124, 0xFFFF, 0xFFFF, 0x0329, 0x0307, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0384,
+			0xFFFF, 0x02F6, 0xFFFF, 0xFFFF, 0xFFFF, 0x03DD, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x06B4, 0x051A,
+			0xFFFF, 0x077B, 0x03D7, 0x01DE, 0x0131, 0xFFFF, 0xFFFF, 0x04A3, 0x06BE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0397, 0x0472, 0xFFFF,
+			0x016A, 0x055A, 0x0171, 0x0769, 0x06C9, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x01C5,
+			0xFFFF, 0x07C3, 0xFFFF, 0x048C, 0xFFFF, 0x023B, 0x0647, 0x067B, 0xFFFF, 0x0175, 0x0141, 0x0122, 0x05F1, 0xFFFF, 0x000D, 0x0798,
+			0x0731, 0x07D1, 0xFFFF, 0x0337, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x06E7, 0x0173, 0x0796, 0x029D, 0x0502, 0xFFFF, 0x05A9,
+			0x00F1, 0xFFFF, 0x05E1, 0x0589, 0x0468, 0xFFFF, 0xFFFF, 0x039C, 0x01CB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x016D, 0x0244, 0x00DB,
+			0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x052B, 0xFFFF, 0x02D5, 0xFFFF, 0x067F, 0x023A, 0xFFFF, 0xFFFF, 0xFFFF, 0x0499, 0x003B,
+			0xFFFF, 0xFFFF, 0x04E7, 0x004F, 0x010E, 0xFFFF, 0x0710, 0x03E7, 0xFFFF, 0x053E, 0x0211, 0xFFFF, 0xFFFF, 0x072E, 0x060B, 0xFFFF,
+			0x06F3, 0x0504, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x033C, 0xFFFF, 0x0428, 0xFFFF, 0x0663, 0x0414, 0x0633, 0x070C, 0x01B1,
+			0x0219, 0xFFFF, 0x027F, 0xFFFF, 0x0406, 0xFFFF, 0x0025, 0xFFFF, 0x02C0, 0xFFFF, 0x058B, 0xFFFF, 0x07B8, 0x019E, 0xFFFF, 0xFFFF,
+		};
+
+		constexpr std::uint16_t name_seeds[512] = {
+			0x0004, 0x0000, 0x0003, 0x0005, 0x0003, 0x0001, 0x0002, 0x0000, 0x0001, 0x0000, 0x0001, 0x0008, 0x0000, 0x0000, 0x0002, 0x0001,
+			0x0000, 0x0001, 0x0000, 0x0002, 0x0000, 0x0000, 0x0002, 0x0008, 0x0003, 0x0000, 0x0000, 0x0001, 0x0000, 0x0002, 0x0001, 0x0003,
+			0x0000, 0x0004, 0x0000, 0x0000, 0x0003, 0x0004, 0x0001, 0x0000, 0x0000, 0x0001, 0x0002, 0x000B, 0x0002, 0x0003, 0x0000, 0x0000,
+			0x0002, 0x0001, 0x0000, 0x0000, 0x0001, 0x0004, 0x0001, 0x0001, 0x0000, 0x0005, 0x0003, 0x0004, 0x0000, 0x0000, 0x0001, 0x0000,
+			0x0000, 0x0003, 0x0000, 0x0005, 0x0000, 0x0008, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0000, 0x0002, 0x0009, 0x0000, 0x0002,
+			0x0000, 0x0001, 0x0000, 0x0001, 0x0000, 0x0007, 0x0004, 0x0000, 0x0000, 0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x000A, 0x0000,
+			0x0000, 0x0000, 0x0005, 0x0000, 0x0006, 0x0000, 0x0006, 0x0005, 0x0002, 0x0005, 0x0000, 0x0000, 0x0002, 0x0002, 0x0000, 0x000F,
+			0x0001, 0x0002, 0x0000, 0x0001, 0x0004, 0x0000, 0x0000, 0x0000, 0x0004, 0x0004, 0x0000, 0x000A, 0x0000, 0x0003, 0x0000, 0x0001,
+			0x0004, 0x0003, 0x000C, 0x000A, 0x0006, 0x0004, 0x0004, 0x0001, 0x0002, 0x000A, 0x0002, 0x0000, 0x0001, 0x0007, 0x0001, 0x0003,
+			0x0002, 0x0002, 0x0003, 0x0000, 0x0003, 0x0002, 0x0007, 0x0004, 0x0000, 0x0002, 0x0003, 0x0000, 0x0006, 0x0007, 0x0003, 0x0000,
+			0x0008, 0x0003, 0x0001, 0x0000, 0x0001, 0x0000, 0x0001, 0x0002, 0x0006, 0x0002, 0x0004, 0x0003, 0x0000, 0x0000, 0x0000, 0x0001,
+			0x0000, 0x0000, 0x0002, 0x0001, 0x0001, 0x0001, 0x0002, 0x0000, 0x0002, 0x0007, 0x0000, 0x0001, 0x0005, 0x0001, 0x0000, 0x0000,
+			0x0000, 0x0005, 0x0004, 0x0001, 0x0004, 0x000E, 0x0001, 0x0001, 0x0006, 0x0001, 0x0000, 0x0001, 0x0006, 0x0004, 0x0004, 0x0000,
+			0x0004, 0x0002, 0x0001, 0x0001, 0x0002, 0x0001, 0x0000, 0x000A, 0x0003, 0x0002, 0x0001, 0x0004, 0x0005, 0x0006, 0x0006, 0x0002,
+			0x0002, 0x0000, 0x000A, 0x0000, 0x0000, 0x0005, 0x0000, 0x0005, 0x0001, 0x0003, 0x000A, 0x0000, 0x0000, 0x0001, 0x0005, 0x0003,
+			0x0001, 0x0000, 0x0001, 0x0001, 0x0002, 0x0002, 0x0000, 0x0001, 0x0002, 0x0004, 0x0009, 0x0001, 0x0001, 0x0001, 0x0000, 0x0000,
+			0x0002, 0x0001, 0x0000, 0x0005, 0x0001, 0x0000, 0x0000, 0x0005, 0x0000, 0x0000, 0x000C, 0x0000, 0x0003, 0x0003, 0x0002, 0x0000,
+			0x0001, 0x0000, 0x0008, 0x0001, 0x0002, 0x0000, 0x0001, 0x0009, 0x0001, 0x0001, 0x0000, 0x0000, 0x0000, 0x0007, 0x0005, 0x0001,
+			0x0002, 0x0003, 0x000A, 0x0001, 0x0003, 0x0001, 0x0002, 0x0000, 0x0000, 0x0000, 0x0001, 0x0005, 0x0000, 0x0003, 0x0000, 0x0006,
+			0x0000, 0x0000, 0x0003, 0x0000, 0x0007, 0x0000, 0x0004, 0x0002, 0x0001, 0x0000, 0x0002, 0x0007, 0x0000, 0x0000, 0x0001, 0x0006,
+			0x0003, 0x0000, 0x0001, 0x0000, 0x0004, 0x0001, 0x0002, 0x0001, 0x0003, 0x0007, 0x0002, 0x0002, 0x0002, 0x0007, 0x0005, 0x0001,
+			0x0001, 0x0005, 0x0001, 0x0004, 0x0004, 0x0001, 0x0004, 0x0004, 0x0001, 0x0002, 0x0000, 0x0002, 0x0000, 0x0001, 0x0000, 0x0001,
+			0x0004, 0x0003, 0x0000, 0x0016, 0x0008, 0x0001, 0x0004, 0x0015, 0x0003, 0x0001, 0x0000, 0x0002, 0x0000, 0x0000, 0x000F, 0x0005,
+			0x0001, 0x0004, 0x0004, 0x0001, 0x0002, 0x0002, 0x0005, 0x0002, 0x0008, 0x0000, 0x0003, 0x0000, 0x0003, 0x0001, 0x0000, 0x0000,
+			0x0001, 0x0000, 0x0006, 0x0005, 0x0001, 0x0003, 0x0000, 0x0000, 0x0010, 0x0001, 0x0005, 0x0006, 0x0009, 0x0009, 0x0006, 0x0007,
+			0x0000, 0x0005, 0x0004, 0x0003, 0x000B, 0x0000, 0x0001, 0x0003, 0x0002, 0x0008, 0x0003, 0x0002, 0x0002, 0x0000, 0x0003, 0x0001,
+			0x0002, 0x0001, 0x0005, 0x0002, 0x0007, 0x0001, 0x0000, 0x0001, 0x0006, 0x0002, 0x0001, 0x0006, 0x0001, 0x0001, 0x0005, 0x0000,
+			0x0001, 0x0002, 0x0000, 0x0002, 0x0005, 0x0007, 0x0000, 0x0002, 0x0000, 0x0001, 0x000A, 0x0002, 0x0000, 0x0007, 0x0003, 0x0000,
+			0x0022, 0x000B, 0x0001, 0x0003, 0x0004, 0x0008, 0x0001, 0x0002, 0x0006, 0x0000, 0x0008, 0x0004, 0x0004, 0x0004, 0x000A, 0x0005,
+			0x0000, 0x0000, 0x000A, 0x0002, 0x0004, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004, 0x0002, 0x0001, 0x0005, 0x0001, 0x0000,
+			0x0001, 0x0000, 0x0011, 0x0006, 0x0001, 0x0005, 0x0000, 0x0009, 0x0007, 0x0006, 0x0001, 0x0000, 0x0000, 0x000D, 0x0006, 0x0001,
+			0x0007, 0x0000, 0x0000, 0x0002, 0x0001, 0x0005, 0x000E, 0x0003, 0x000C, 0x0004, 0x0004, 0x0000, 0x0004, 0x0000, 0x0003, 0x0000,
+		};
+
+		constexpr std::uint16_t name_slots[4096] = {
+			0xFFFF, 0x0737, 0x078A, 0x0728, 0x0533, 0xFFFF, 0x0246, 0x01D9, 0x048F, 0xFFFF, 0xFFFF, 0x0058, 0x0680, 0x04B0, 0xFFFF, 0x0211,
+			0x0435, 0x01F3, 0x0099, 0xFFFF, 0xFFFF, 0x0125, 0x0600, 0xFFFF, 0x0305, 0x060E, 0xFFFF, 0xFFFF, 0x0263, 0x06D9, 0xFFFF, 0xFFFF,
+			0xFFFF, 0x01B8, 0x05B6, 0x06B9, 0x043C, 0x04DA, 0x0738, 0x02A2, 0xFFFF, 0x053F, 0xFFFF, 0x0224, 0x02E5, 0xFFFF, 0xFFFF, 0xFFFF,
+			0x045D, 0xFFFF, 0xFFFF, 0x06D4, 0x0344, 0x0760, 0x01E5, 0x0742, 0xFFFF, 0x02FD, 0x03E5, 0xFFFF, 0x003E, 0xFFFF, 0x0163, 0xFFFF,
+			0x02A6, 0xFFFF, 0xFFFF, 0xFFFF, 0x011E, 0xFFFF, 0x01B2, 0x06FE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x06B8, 0xFFFF, 0x0516,
+			0x061B, 0xFFFF, 0x02E0, 0xFFFF, 0x004D, 0xFFFF, 0xFFFF, 0xFFFF, 0x0434, 0x05FB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0479,
+			0xFFFF, 0x03EB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x067A, 0x065C, 0xFFFF, 0xFFFF, 0x0280, 0x0546, 0x0281,
+			0xFFFF, 0xFFFF, 0x04EB, 0xFFFF, 0x0241, 0x0557, 0x054C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0457, 0xFFFF, 0x04D7, 0xFFFF, 0xFFFF,
+			0xFFFF, 0x06F7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0362, 0xFFFF, 0x020C, 0x010D, 0xFFFF, 0x0102, 0xFFFF,
+			0xFFFF, 0x0571, 0xFFFF, 0x039C, 0xFFFF, 0xFFFF, 0xFFFF, 0x0078, 0x0274, 0xFFFF, 0x079A, 0xFFFF, 0x03CD, 0xFFFF, 0xFFFF, 0xFFFF,
+			0x03FE, 0x010A, 0x0775, 0x06CB, 0x033A, 0xFFFF, 0x02B8, 0xFFFF, 0x0570, 0x0057, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x068B, 0x05BF,
+			0x005F, 0xFFFF, 0xFFFF, 0x033B, 0x04AD, 0x05D3, 0xFFFF, 0xFFFF, 0xFFFF, 0x0242, 0x0104, 0x02CB, 0x0123, 0x0354, 0xFFFF, 0x06E2,
+			0xFFFF, 0xFFFF, 0x0137, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x03E1, 0x045E, 0x063F, 0x0314, 0xFFFF, 0x075D, 0x0730, 0x070D, 0x03B0,
+			0xFFFF, 0xFFFF, 0x003A, 0x0069, 0x0176, 0x0583, 0x062D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x023C, 0xFFFF, 0x0252, 0xFFFF,
+			0x02A3, 0xFFFF, 0x0122, 0x050E, 0x02ED, 0xFFFF, 0x05FA, 0x005B, 0x041B, 0xFFFF, 0xFFFF, 0xFFFF, 0x042A, 0xFFFF, 0x01E4, 0x02FA,
+			0x00C6, 0xFFFF, 0xFFFF, 0xFFFF, 0x02CE, 0x0026, 0x049A, 0xFFFF, 0x00D8, 0x0442, 0x012F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+			0xFFFF, 0x00F1, 0xFFFF, 0xFFFF, 0x0109, 0xFFFF, 0x040B, 0xFFFF, 0x029C, 0x063E, 0xFFFF, 0x0193, 0xFFFF, 0x0340, 0xFFFF, 0x06B7,
+			0xFFFF, 0x0666, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0236, 0xFFFF, 0xFFFF, 0x0454, 0xFFFF, 0x047A, 0xFFFF, 0xFFFF, 0x0331, 0xFFFF,
+			0xFFFF, 0xFFFF, 0x04CB, 0xFFFF, 0xFFFF, 0x07B2, 0x050F, 0x0255, 0xFFFF, 0x063A, 0x079D, 0xFFFF, 0x022B, 0xFFFF, 0xFFFF, 0x03F8,
+			0x059C, 0x01CD, 0x01AF, 0x043D, 0x013A, 0x065B, 0xFFFF, 0x0518, 0xFFFF, 0x06D0, 0x0681, 0xFFFF, 0x073B, 0xFFFF, 0x0240, 0xFFFF,
+			0xFFFF, 0x0797, 0x00CA, 0x0342, 0xFFFF, 0x05DE, 0x0429, 0xFFFF, 0x042F, 0xFFFF, 0xFFFF, 0xFFFF, 0x0602, 0xFFFF, 0xFFFF, 0x069D,
+			0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x05F0, 0x04E0, 0xFFFF, 0x0076, 0x0487, 0xFFFF,
+			0xFFFF, 0x03FF, 0x0190, 0xFFFF, 0x005C, 0xFFFF, 0x0669, 0xFFFF, 0xFFFF, 0x0179, 0x06DE, 0x0230, 0x02A9, 0x0437, 0x06FF, 0xFFFF,
+			0x007A, 0x0564, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x049C, 0xFFFF, 0x035F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+			0x024B, 0xFFFF, 0xFFFF, 0x01C9, 0xFFFF, 0xFFFF, 0x00E4, 0xFFFF, 0x0213, 0x025A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0238, 0xFFFF,
+			0x048E, 0xFFFF, 0x024C, 0xFFFF, 0xFFFF, 0x0786, 0x027E, 0xFFFF, 0x0604, 0xFFFF, 0xFFFF, 0x055C, 0x0119, 0x03E0, 0x01AD, 0xFFFF,
+			0x01E0, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x04B1, 0xFFFF, 0xFFFF, 0xFFFF, 0x00F7, 0x03A2, 0x0082, 0xFFFF, 0xFFFF, 0x07B0, 0x015C,
+			0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0576, 0x0495, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0360, 0x00AA,
+			0x041D, 0xFFFF, 0x0539, 0x0548, 0x0467, 0x009A, 0x06EC, 0x06CA, 0x00BB, 0xFFFF, 0xFFFF, 0x00DF, 0xFFFF, 0x035E, 0xFFFF, 0x05A9,
+			0x073C, 0xFFFF, 0x031C, 0xFFFF, 0xFFFF, 0x04F3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x02DB, 0x0540, 0x0111, 0xFFFF, 0x0713, 0xFFFF,
+			0x0399, 0x0304, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0418, 0xFFFF, 0xFFFF, 0x01DF, 0x06CD, 0xFFFF, 0xFFFF, 0xFFFF,
+			0x0262, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0142, 0xFFFF, 0xFFFF, 0xFFFF, 0x0644, 0x0371, 0x068C, 0x0668, 0x0090, 0xFFFF,
+			0x01A1, 0xFFFF, 0xFFFF, 0xFFFF, 0x0482, 0xFFFF, 0x0231, 0xFFFF, 0xFFFF, 0x0702, 0x0033, 0x00C4, 0x0060, 0x0105, 0xFFFF, 0xFFFF,
+			0xFFFF, 0xFFFF, 0x022C, 0x03C9, 0x05AE, 0x04AC, 0x023B, 0xFFFF, 0x007E, 0xFFFF, 0x07C6, 0x03A1, 0x0759, 0xFFFF, 0x0108, 0xFFFF,
+			0xFFFF, 0x0030, 0xFFFF, 0x0652, 0xFFFF, 0x0743, 0xFFFF, 0x0041, 0xFFFF, 0xFFFF, 0xFFFF, 0x0247, 0xFFFF, 0x047E, 0x07BA, 0xFFFF,
+			0x06F9, 0xFFFF, 0x017E, 0xFFFF, 0xFFFF, 0x036F, 0xFFFF, 0x0603, 0xFFFF, 0x01F4, 0x06E1, 0xFFFF, 0x048C, 0xFFFF, 0xFFFF, 0xFFFF,
+			0x0448, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x05CF, 0x07A7, 0x0651, 0x025C, 0x0768, 0x055D, 0xFFFF, 0xFFFF, 0x05D4, 0xFFFF,
+			0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0287, 0x0083, 0xFFFF, 0x05F9, 0xFFFF, 0xFFFF, 0xFFFF, 0x049D, 0xFFFF, 0x03F6, 0x00F4, 0x0662,
+			0xFFFF, 0x0423, 0x0425, 0x00B2, 0x066F, 0xFFFF, 0x03EA, 0xFFFF, 0x0545, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x00BC,
+			0xFFFF, 0xFFFF, 0x014D, 0x06F0, 0x00A2, 0x001D, 0x012C, 0xFFFF, 0x0779, 0xFFFF, 0xFFFF, 0x0659, 0x0294, 0x066E, 0xFFFF, 0xFFFF,
+			0xFFFF, 0xFFFF, 0x067F, 0xFFFF, 0xFFFF, 0x0016, 0x0006, 0xFFFF, 0x0609, 0xFFFF, 0x0433, 0x026A, 0x05FD, 0xFFFF, 0xFFFF, 0x047B,
+			0x075E, 0x03BF, 0x01B4, 0x0353, 0xFFFF, 0x042B, 0x039D, 0xFFFF, 0xFFFF, 0x0556, 0xFFFF, 0x0691, 0x0676, 0xFFFF, 0x023F, 0x06A4,
+			0x0531, 0x03E6, 0xFFFF, 0xFFFF, 0x048D, 0x0784, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0496, 0x01C0, 0x0720, 0xFFFF, 0x0153, 0x062E,
+			0x03C3, 0xFFFF, 0xFFFF, 0xFFFF, 0x0145, 0x01C1, 0xFFFF, 0xFFFF, 0x0144, 0xFFFF, 0x0043, 0xFFFF, 0xFFFF, 0x0568, 0x0180, 0xFFFF,
+			0x028D, 0x0705, 0xFFFF, 0x00CF, 0xFFFF, 0x0612, 0xFFFF, 0xFFFF, 0xFFFF, 0x005E, 0xFFFF, 0x06A6, 0x0202, 0x0525, 0xFFFF, 0x0551,
+			0x054B, 0x00F5, 0x00D3, 0x0339, 0x038C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0745, 0xFFFF, 0x01E2, 0xFFFF, 0xFFFF, 0xFFFF,
+			0xFFFF, 0xFFFF, 0x051C, 0x03A4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x021D, 0xFFFF, 0x0126, 0x0566, 0xFFFF, 0xFFFF, 0x07BF, 0x06D5,
+			0x066B, 0x0368, 0x0787, 0x034E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0550, 0xFFFF, 0xFFFF, 0xFFFF,
+			0x020E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x02B1, 0x0731, 0x00A5, 0x04BE, 0xFFFF, 0xFFFF, 0xFFFF, 0x05AF, 0x0151, 0x05DC, 0x00DB,
+			0x0277, 0xFFFF, 0xFFFF, 0x0543, 0xFFFF, 0xFFFF, 0x0295, 0xFFFF, 0xFFFF, 0xFFFF, 0x0417, 0xFFFF, 0xFFFF, 0x04CC, 0xFFFF, 0x076A,
+			0x0744, 0x01A9, 0x07A0, 0x01BC, 0xFFFF, 0xFFFF, 0x009C, 0xFFFF, 0x04A7, 0x00EF, 0xFFFF, 0xFFFF, 0x02B3, 0x03FC, 0xFFFF, 0x006E,
+			0x03A7, 0x004E, 0x0616, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x05A8, 0xFFFF, 0x0474, 0xFFFF, 0x03D8, 0xFFFF, 0x020B, 0x0210,
+			0xFFFF, 0xFFFF, 0xFFFF, 0x066A, 0xFFFF, 0x06A9, 0x0648, 0x051A, 0xFFFF, 0x0046, 0x073A, 0x06DA, 0x013C, 0xFFFF, 0xFFFF, 0xFFFF,
+			0xFFFF, 0xFFFF, 0x0752, 0xFFFF, 0x01EE, 0xFFFF, 0x00E6, 0x0460, 0x078E, 0x05E8, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x05B5, 0xFFFF,
+			0x010C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x07C5, 0x038E, 0x0772, 0x016C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x05E5,
+			0xFFFF, 0xFFFF, 0x0619, 0x05EE, 0x046B, 0x027B, 0xFFFF, 0x073E, 0xFFFF, 0x0678, 0xFFFF, 0xFFFF, 0x06D6, 0x001E, 0x04E3, 0xFFFF,
+			0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x04BA, 0xFFFF, 0xFFFF, 0x0015, 0x078F, 0x03BA, 0xFFFF, 0x06E3, 0xFFFF, 0xFFFF, 0x02E4, 0x0100,
+			0x042E, 0x02B4, 0x0319, 0x07B4, 0xFFFF, 0x0152, 0xFFFF, 0xFFFF, 0xFFFF, 0x05BE, 0xFFFF, 0xFFFF, 0xFFFF, 0x074D, 0xFFFF, 0xFFFF,
+			0xFFFF, 0x0530, 0xFFFF, 0x0129, 0x03B7, 0x0395, 0x0259, 0x05BB, 0xFFFF, 0x0400, 0x03ED, 0xFFFF, 0xFFFF, 0x0521, 0xFFFF, 0x0683,
+			0x07C3, 0x0756, 0xFFFF, 0x035B, 0x04DE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0214, 0xFFFF, 0xFFFF, 0x0092, 0x0679, 0xFFFF, 0x05E1,
+			0xFFFF, 0xFFFF, 0x0587, 0x02CA, 0xFFFF, 0x03B4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x04E9, 0xFFFF, 0x0782, 0xFFFF, 0xFFFF,
+			0x02D6, 0x064C, 0xFFFF, 0x04FD, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x02E7, 0x0704, 0xFFFF, 0xFFFF, 0x043E, 0xFFFF, 0xFFFF, 0xFFFF,
+			0x0347, 0x0406, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x038B, 0x028E, 0xFFFF, 0xFFFF, 0x04FC, 0xFFFF, 0xFFFF, 0x07A8, 0x046D,
+			0x01E8, 0xFFFF, 0x0626, 0x0313, 0x0011, 0xFFFF, 0xFFFF, 0x04D8, 0xFFFF, 0xFFFF, 0x077E, 0xFFFF, 0xFFFF, 0xFFFF, 0x02B6, 0xFFFF,
+			0x0128, 0x0504, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x04C2, 0x0047, 0x032C, 0x050A, 0xFFFF, 0x04EF, 0xFFFF, 0xFFFF,
+			0x031D, 0x058A, 0xFFFF, 0xFFFF, 0x018F, 0x07A9, 0x023A, 0xFFFF, 0x04A0, 0x020D, 0x0189, 0xFFFF, 0xFFFF, 0xFFFF, 0x04D4, 0xFFFF,
+			0x0121, 0xFFFF, 0xFFFF, 0x0366, 0x06BE, 0x0154, 0x05B2, 0xFFFF, 0x06DB, 0x058D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x04EC, 0xFFFF,
+			0xFFFF, 0x00CD, 0x0130, 0xFFFF, 0x0080, 0x03A0, 0x01D2, 0xFFFF, 0x0035, 0xFFFF, 0xFFFF, 0xFFFF, 0x0341, 0x0379, 0x0746, 0x0627,
+			0x0721, 0xFFFF, 0x04AF, 0x02DA, 0xFFFF, 0xFFFF, 0xFFFF, 0x0451, 0xFFFF, 0x0585, 0x04A5, 0xFFFF, 0x07D7, 0x07A4, 0x0405, 0xFFFF,
+			0x04C1, 0x0370, 0xFFFF, 0x038A, 0x00D4, 0x04F8, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x01A6, 0x0664, 0xFFFF, 0x0774, 0xFFFF, 0x03CE,
+			0x04E1, 0x02B0, 0x0569, 0xFFFF, 0xFFFF, 0x07B7, 0xFFFF, 0x04E5, 0x0039, 0x07C4, 0x0302, 0xFFFF, 0xFFFF, 0x018A, 0xFFFF, 0x0770,
+			0xFFFF, 0x06D1, 0x04DF, 0x026C, 0xFFFF, 0xFFFF, 0x0184, 0xFFFF, 0x05BC, 0x05A5, 0xFFFF, 0xFFFF, 0x02AF, 0xFFFF, 0x0113, 0xFFFF,
+			0x006F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x01A5, 0x02F6, 0x05A1, 0x03F1, 0xFFFF, 0xFFFF, 0x0526, 0x06C5, 0xFFFF, 0x0701,
+			0xFFFF, 0xFFFF, 0x06A1, 0xFFFF, 0xFFFF, 0xFFFF, 0x04F6, 0x00FD, 0xFFFF, 0x0376, 0xFFFF, 0xFFFF, 0x073D, 0xFFFF, 0x003B, 0x078C,
+			0xFFFF, 0xFFFF, 0x006C, 0x05F8, 0x071D, 0xFFFF, 0x071C, 0x068F, 0xFFFF, 0xFFFF, 0xFFFF, 0x018B, 0xFFFF, 0x009E, 0xFFFF, 0x031B,
+			0x045F, 0xFFFF, 0x0329, 0xFFFF, 0xFFFF, 0xFFFF, 0x07C9, 0x05EA, 0x02FF, 0x04F7, 0x06CE, 0x0045, 0xFFFF, 0x00BE, 0x0477, 0x03C5,
+			0xFFFF, 0xFFFF, 0x0022, 0xFFFF, 0xFFFF, 0x056D, 0x052F, 0xFFFF, 0xFFFF, 0x04B3, 0x06F8, 0x0620, 0xFFFF, 0x076F, 0x07AB, 0xFFFF,
+			0x00CE, 0xFFFF, 0xFFFF, 0xFFFF, 0x011B, 0xFFFF, 0xFFFF, 0xFFFF, 0x0217, 0xFFFF, 0xFFFF, 0xFFFF, 0x01F9, 0xFFFF, 0x01BD, 0xFFFF,
+			0xFFFF, 0xFFFF, 0x05F7, 0x07B3, 0xFFFF, 0x0207, 0xFFFF, 0x019A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0796, 0xFFFF, 0xFFFF, 0x0468,
+			0x0215, 0xFFFF, 0x0005, 0xFFFF, 0xFFFF, 0xFFFF, 0x009D, 0x034F, 0x00B4, 0xFFFF, 0x04E7, 0xFFFF, 0xFFFF, 0x0613, 0x0296, 0x04BF,
+			0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0578, 0xFFFF, 0x0633, 0xFFFF, 0x031E, 0x00A6, 0xFFFF, 0x07BE, 0xFFFF, 0xFFFF, 0xFFFF, 0x035D,
+			0x074E, 0x01E9, 0x04D9, 0xFFFF, 0xFFFF, 0xFFFF, 0x007C, 0xFFFF, 0x069B, 0xFFFF, 0xFFFF, 0xFFFF, 0x0624, 0x0709, 0x06AB, 0xFFFF,
+			0xFFFF, 0x0420, 0xFFFF, 0xFFFF, 0xFFFF, 0x0582, 0x0486, 0x04F0, 0xFFFF, 0x074F, 0xFFFF, 0x04A6, 0xFFFF, 0xFFFF, 0xFFFF, 0x033E,
+			0xFFFF, 0xFFFF, 0x0002, 0xFFFF, 0x04B7, 0xFFFF, 0xFFFF, 0x0630, 0x0639, 0x01BF, 0xFFFF, 0xFFFF, 0x0748, 0xFFFF, 0x065D, 0x0735,
+			0xFFFF, 0x0698, 0x0049, 0x0426, 0x0722, 0x05C3, 0xFFFF, 0x0390, 0xFFFF, 0xFFFF, 0x072A, 0x00C0, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+			0xFFFF, 0xFFFF, 0x0535, 0x015A, 0xFFFF, 0x0470, 0xFFFF, 0x0412, 0x0375, 0x0219, 0x0471, 0xFFFF, 0x037F, 0xFFFF, 0xFFFF, 0xFFFF,
+			0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x05F6, 0xFFFF, 0x0475, 0xFFFF, 0xFFFF, 0x02E3, 0xFFFF, 0xFFFF, 0x064B, 0xFFFF,
+			0x000D, 0xFFFF, 0xFFFF, 0x078B, 0xFFFF, 0x0708, 0x00B0, 0xFFFF, 0xFFFF, 0xFFFF, 0x0483, 0x003C, 0x007B, 0x0686, 0xFFFF, 0xFFFF,
+			0x01FE, 0xFFFF, 0xFFFF, 0x027F, 0x0695, 0xFFFF, 0xFFFF, 0x032E, 0x03AB, 0x040D, 0x030A, 0xFFFF, 0xFFFF, 0x00DC, 0x04CE, 0x032D,
+			0xFFFF, 0xFFFF, 0x03DB, 0x05C1, 0xFFFF, 0xFFFF, 0x0055, 0xFFFF, 0xFFFF, 0x0317, 0x0191, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0658,
+			0x026F, 0xFFFF, 0x0449, 0x0079, 0xFFFF, 0x0481, 0x0524, 0x01DD, 0x0071, 0xFFFF, 0x0333, 0xFFFF, 0x0554, 0x0780, 0x0120, 0x0765,
+			0xFFFF, 0x0010, 0xFFFF, 0x05EC, 0xFFFF, 0xFFFF, 0x036C, 0xFFFF, 0x034B, 0xFFFF, 0xFFFF, 0x04AB, 0x0171, 0x0689, 0xFFFF, 0xFFFF,
+			0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x053E, 0xFFFF, 0x075F, 0xFFFF, 0x05AB, 0xFFFF, 0xFFFF, 0xFFFF, 0x0574,
+			0x06EE, 0xFFFF, 0xFFFF, 0x0381, 0xFFFF, 0x0008, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x028B, 0xFFFF, 0xFFFF,
+			0x075A, 0x0147, 0xFFFF, 0x0248, 0x06D2, 0xFFFF, 0x0013, 0xFFFF, 0x02D2, 0xFFFF, 0x05B1, 0xFFFF, 0xFFFF, 0xFFFF, 0x0419, 0xFFFF,
+			0x00A4, 0x07BB, 0xFFFF, 0xFFFF, 0x003F, 0xFFFF, 0x02F1, 0xFFFF, 0x0096, 0xFFFF, 0x05C0, 0xFFFF, 0xFFFF, 0x054A, 0xFFFF, 0xFFFF,
+			0xFFFF, 0xFFFF, 0x0038, 0x0711, 0xFFFF, 0x0789, 0x0522, 0xFFFF, 0x056B, 0xFFFF, 0x013D, 0x01F1, 0x03D5, 0x019C, 0xFFFF, 0xFFFF,
+			0x015D, 0xFFFF, 0x042C, 0xFFFF, 0x0559, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0169, 0x01E7, 0x070A, 0xFFFF, 0x07D1, 0x06A2,
+			0xFFFF, 0x0764, 0xFFFF, 0xFFFF, 0x02C6, 0xFFFF, 0xFFFF, 0x0232, 0x01EA, 0xFFFF, 0x0037, 0x0094, 0xFFFF, 0x07AD, 0x0511, 0x0348,
+			0x0192, 0xFFFF, 0x0249, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x04FA, 0xFFFF, 0x04B5, 0xFFFF, 0x04F5, 0x02E6, 0xFFFF, 0xFFFF, 0x001A,
+			0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x04C7, 0xFFFF, 0x021A, 0x0343, 0xFFFF, 0xFFFF, 0x0430, 0xFFFF, 0x0741, 0xFFFF, 0x00BF,
+			0xFFFF, 0xFFFF, 0xFFFF, 0x0134, 0xFFFF, 0x000B, 0x050C, 0xFFFF, 0xFFFF, 0xFFFF, 0x0181, 0x04C5, 0x0073, 0x0637, 0x001C, 0xFFFF,
+			0x03DD, 0x03F0, 0xFFFF, 0xFFFF, 0xFFFF, 0x00E9, 0xFFFF, 0x0326, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x030F, 0xFFFF, 0xFFFF,
+			0xFFFF, 0xFFFF, 0x072D, 0xFFFF, 0xFFFF, 0xFFFF, 0x0012, 0xFFFF, 0xFFFF, 0x0315, 0xFFFF, 0x014B, 0x0327, 0x0165, 0x00DD, 0xFFFF,
+			0x01AA, 0x0222, 0xFFFF, 0x021B, 0xFFFF, 0xFFFF, 0x006B, 0x0661, 0xFFFF, 0xFFFF, 0x04E8, 0xFFFF, 0xFFFF, 0x07C2, 0x0407, 0x0541,
+			0xFFFF, 0x0463, 0xFFFF, 0x0763, 0x05A7, 0xFFFF, 0xFFFF, 0xFFFF, 0x02F9, 0xFFFF, 0xFFFF, 0x06BC, 0x02EA, 0x01F8, 0x0579, 0xFFFF,
+			0xFFFF, 0x0031, 0xFFFF, 0x0175, 0xFFFF, 0x0357, 0x071B, 0x02BD, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x013E, 0x03F2, 0xFFFF, 0x03A8,
+			0x036A, 0xFFFF, 0x030B, 0xFFFF, 0xFFFF, 0xFFFF, 0x0634, 0xFFFF, 0x003D, 0x00E0, 0x04BB, 0x07A3, 0xFFFF, 0x0403, 0x00D5, 0xFFFF,
+			0xFFFF, 0x0636, 0x0562, 0x013F, 0x030E, 0xFFFF, 0xFFFF, 0x0424, 0xFFFF, 0xFFFF, 0x0306, 0x079B, 0xFFFF, 0x06B1, 0x0361, 0x0726,
+			0x0649, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x042D, 0xFFFF, 0x0133, 0x0350, 0xFFFF, 0xFFFF, 0x00F2, 0x06F2, 0x0740, 0x049F,
+			0x0318, 0x07D4, 0x0640, 0xFFFF, 0xFFFF, 0x04A9, 0x0791, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x03D0, 0xFFFF, 0x03AF, 0xFFFF,
+			0xFFFF, 0xFFFF, 0xFFFF, 0x0200, 0x06FA, 0x03DC, 0xFFFF, 0x02EF, 0xFFFF, 0x0328, 0xFFFF, 0xFFFF, 0x0266, 0xFFFF, 0x04C0, 0x0646,
+			0x00EC, 0x0755, 0xFFFF, 0xFFFF, 0xFFFF, 0x01BA, 0x00E1, 0xFFFF, 0xFFFF, 0x027A, 0xFFFF, 0x024D, 0x012B, 0x05D1, 0xFFFF, 0xFFFF,
+			0xFFFF, 0x01F7, 0xFFFF, 0x06EF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x07B1, 0xFFFF, 0x0586, 0xFFFF, 0x0529, 0xFFFF,
+			0x01EC, 0x064D, 0xFFFF, 0xFFFF, 0x06C6, 0xFFFF, 0xFFFF, 0xFFFF, 0x0725, 0xFFFF, 0x0606, 0xFFFF, 0xFFFF, 0x0473, 0xFFFF, 0x00D1,
+			0xFFFF, 0xFFFF, 0xFFFF, 0x04E2, 0x04D5, 0x02AE, 0xFFFF, 0x037C, 0xFFFF, 0xFFFF, 0x03A6, 0x03E4, 0x0367, 0x0261, 0xFFFF, 0x03F4,
+			0xFFFF, 0x04F9, 0x0501, 0x05D6, 0x06CF, 0xFFFF, 0x018D, 0x0150, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0542, 0xFFFF, 0x0088, 0xFFFF,
+			0xFFFF, 0xFFFF, 0xFFFF, 0x0599, 0xFFFF, 0x044E, 0x05A6, 0x03B3, 0x06A8, 0xFFFF, 0xFFFF, 0x017B, 0x00B1, 0xFFFF, 0x0161, 0xFFFF,
+			0xFFFF, 0x06BB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0617, 0xFFFF, 0x069C, 0x03D7, 0xFFFF, 0x0413, 0x049E, 0xFFFF, 0xFFFF,
+			0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x02AA, 0xFFFF, 0x0345, 0xFFFF, 0x0590, 0x030C, 0xFFFF, 0x0476, 0x0785, 0x0059, 0xFFFF,
+			0xFFFF, 0xFFFF, 0xFFFF, 0x05FC, 0x0374, 0xFFFF, 0xFFFF, 0x0598, 0x0716, 0xFFFF, 0x0465, 0xFFFF, 0xFFFF, 0x0072, 0xFFFF, 0xFFFF,
+			0x0672, 0xFFFF, 0x0615, 0x02EB, 0x0024, 0xFFFF, 0xFFFF, 0x05A4, 0x052D, 0xFFFF, 0xFFFF, 0xFFFF, 0x04D2, 0xFFFF, 0xFFFF, 0x03B9,
+			0xFFFF, 0x06DF, 0x067B, 0xFFFF, 0x07B9, 0xFFFF, 0xFFFF, 0x06A5, 0xFFFF, 0x01A0, 0x04CD, 0x029E, 0x0289, 0x026E, 0xFFFF, 0x032F,
+			0xFFFF, 0x02CC, 0x05DB, 0xFFFF, 0xFFFF, 0x05BA, 0x0478, 0x020F, 0xFFFF, 0x0268, 0x07D3, 0x0538, 0x078D, 0xFFFF, 0xFFFF, 0xFFFF,
+			0x055A, 0xFFFF, 0xFFFF, 0x00B8, 0x055F, 0x03D1, 0x01DB, 0x06ED, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x06B4, 0x01B5,
+			0xFFFF, 0xFFFF, 0xFFFF, 0x032A, 0xFFFF, 0x0565, 0xFFFF, 0xFFFF, 0xFFFF, 0x0351, 0x076D, 0xFFFF, 0x0177, 0x02AC, 0x06AA, 0x06A3,
+			0x059A, 0xFFFF, 0x0068, 0xFFFF, 0xFFFF, 0x07A1, 0xFFFF, 0x0384, 0xFFFF, 0xFFFF, 0x016D, 0x04B6, 0x057D, 0xFFFF, 0xFFFF, 0x02BF,
+			0xFFFF, 0x0596, 0xFFFF, 0xFFFF, 0x0264, 0x0056, 0xFFFF, 0x05CB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0168, 0xFFFF, 0x0657,
+			0xFFFF, 0x0070, 0x0091, 0x07C1, 0x05AC, 0x041E, 0x0051, 0x0199, 0xFFFF, 0xFFFF, 0x053D, 0x0157, 0xFFFF, 0x0394, 0x074C, 0xFFFF,
+			0xFFFF, 0xFFFF, 0xFFFF, 0x017D, 0xFFFF, 0x016E, 0x0714, 0x05C4, 0x052C, 0x01A4, 0x0291, 0xFFFF, 0x02BA, 0x03C7, 0x0595, 0xFFFF,
+			0x051E, 0x036E, 0x019B, 0xFFFF, 0x00B5, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x077C, 0xFFFF, 0xFFFF, 0x0611, 0x0452, 0xFFFF,
+			0x03C4, 0x0372, 0x03EC, 0x03FB, 0x071A, 0xFFFF, 0xFFFF, 0x037D, 0xFFFF, 0x070B, 0x0558, 0x07AF, 0x03F5, 0x04FF, 0x0555, 0x02A1,
+			0x04D0, 0xFFFF, 0x04AE, 0xFFFF, 0xFFFF, 0x02DD, 0x050B, 0x07D2, 0xFFFF, 0xFFFF, 0x072F, 0xFFFF, 0x0205, 0x02A7, 0xFFFF, 0x075C,
+			0x00C9, 0x0710, 0x0635, 0x0519, 0x063C, 0x0508, 0x0506, 0x0203, 0x0776, 0xFFFF, 0xFFFF, 0x06BA, 0x0696, 0x01CC, 0x04D1, 0xFFFF,
+			0x044F, 0x0349, 0x017F, 0x051D, 0xFFFF, 0xFFFF, 0xFFFF, 0x000C, 0x0050, 0xFFFF, 0xFFFF, 0x01FB, 0xFFFF, 0xFFFF, 0x0170, 0xFFFF,
+			0xFFFF, 0xFFFF, 0x05DA, 0x031F, 0xFFFF, 0x070F, 0x03C2, 0xFFFF, 0x02B5, 0xFFFF, 0x0410, 0xFFFF, 0xFFFF, 0x0638, 0xFFFF, 0xFFFF,
+			0xFFFF, 0xFFFF, 0xFFFF, 0x03AA, 0x02F0, 0xFFFF, 0x014F, 0x0226, 0xFFFF, 0x0025, 0x0693, 0x0000, 0xFFFF, 0xFFFF, 0x01D7, 0x040C,
+			0x0608, 0xFFFF, 0xFFFF, 0xFFFF, 0x00B9, 0x048B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0197, 0x01C4, 0x053A, 0xFFFF, 0x0795, 0xFFFF,
+			0xFFFF, 0xFFFF, 0x04F2, 0x0781, 0x03F9, 0xFFFF, 0x0288, 0x06A7, 0xFFFF, 0x00AD, 0xFFFF, 0x045C, 0x07A2, 0xFFFF, 0x0196, 0xFFFF,
+			0xFFFF, 0x03D6, 0xFFFF, 0x00EA, 0x041C, 0xFFFF, 0x056A, 0x008F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0671, 0xFFFF,
+			0x0441, 0xFFFF, 0xFFFF, 0xFFFF, 0x005A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x01AB, 0x02D7, 0xFFFF, 0x05D0, 0x0443, 0x0383, 0x0581,
+			0x001B, 0x060B, 0xFFFF, 0x00D0, 0xFFFF, 0x050D, 0x07AC, 0x0208, 0xFFFF, 0xFFFF, 0x062A, 0xFFFF, 0x01AC, 0x01B1, 0xFFFF, 0x0788,
+			0x01B3, 0x00AC, 0x05E3, 0x01D8, 0x0396, 0xFFFF, 0xFFFF, 0x068E, 0xFFFF, 0xFFFF, 0xFFFF, 0x0734, 0x0077, 0xFFFF, 0xFFFF, 0xFFFF,
+			0x0239, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x01A3, 0x03C1, 0x0282, 0xFFFF, 0xFFFF, 0x0063, 0xFFFF, 0xFFFF, 0xFFFF, 0x045A, 0x0401,
+			0x031A, 0x04E6, 0x0003, 0xFFFF, 0x0692, 0xFFFF, 0xFFFF, 0xFFFF, 0x0488, 0x016A, 0x01A2, 0x05F1, 0xFFFF, 0x06FD, 0x039A, 0x05E9,
+			0x04A4, 0x063D, 0x0408, 0x0439, 0xFFFF, 0xFFFF, 0x0089, 0x0293, 0x06C1, 0xFFFF, 0xFFFF, 0xFFFF, 0x0773, 0x040F, 0xFFFF, 0x04C3,
+			0x0645, 0xFFFF, 0xFFFF, 0xFFFF, 0x07B6, 0x008D, 0x0512, 0x01E1, 0xFFFF, 0x01DA, 0xFFFF, 0xFFFF, 0x0436, 0xFFFF, 0xFFFF, 0xFFFF,
+			0xFFFF, 0x0066, 0xFFFF, 0xFFFF, 0x0422, 0xFFFF, 0xFFFF, 0xFFFF, 0x0112, 0xFFFF, 0xFFFF, 0x0136, 0xFFFF, 0xFFFF, 0xFFFF, 0x00DA,
+			0x0155, 0x00FC, 0x0297, 0x0382, 0x0172, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x002C, 0x06E8, 0xFFFF, 0xFFFF, 0xFFFF, 0x00F3, 0xFFFF,
+			0x052E, 0xFFFF, 0x05CD, 0x0592, 0xFFFF, 0x023E, 0x03B2, 0x043B, 0xFFFF, 0xFFFF, 0xFFFF, 0x04BD, 0x0732, 0x0275, 0xFFFF, 0x00A1,
+			0xFFFF, 0x061C, 0xFFFF, 0x05B3, 0x0139, 0xFFFF, 0x0098, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x028F, 0x0216, 0x056E, 0x052B, 0x02AD,
+			0x04BC, 0x028C, 0x038D, 0x0532, 0x02E9, 0x0303, 0xFFFF, 0xFFFF, 0x01D4, 0xFFFF, 0x00CB, 0x0335, 0xFFFF, 0xFFFF, 0x05EB, 0xFFFF,
+			0x043F, 0xFFFF, 0x058F, 0x036D, 0x0771, 0x0007, 0xFFFF, 0x0173, 0xFFFF, 0x0687, 0xFFFF, 0x02FE, 0x0762, 0x05F3, 0x0497, 0xFFFF,
+			0x069A, 0xFFFF, 0x00EB, 0xFFFF, 0x039B, 0xFFFF, 0x059D, 0xFFFF, 0xFFFF, 0x0699, 0xFFFF, 0x01BE, 0x03D3, 0x0053, 0xFFFF, 0xFFFF,
+			0xFFFF, 0x02C2, 0x05F5, 0x0492, 0xFFFF, 0xFFFF, 0xFFFF, 0x01F2, 0xFFFF, 0x0310, 0x00C5, 0x011A, 0x053B, 0x0389, 0xFFFF, 0xFFFF,
+			0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0009, 0xFFFF, 0x044D, 0x0459, 0xFFFF, 0x0075, 0xFFFF, 0xFFFF, 0xFFFF, 0x05D7, 0x00CC, 0x04EA,
+			0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0156, 0xFFFF, 0xFFFF, 0xFFFF, 0x0622, 0xFFFF, 0xFFFF, 0x06C8, 0x05E4, 0xFFFF, 0x0563,
+			0xFFFF, 0xFFFF, 0xFFFF, 0x00C3, 0x0385, 0xFFFF, 0xFFFF, 0x0642, 0x010B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x011D, 0xFFFF,
+			0xFFFF, 0xFFFF, 0x0653, 0x006A, 0xFFFF, 0xFFFF, 0xFFFF, 0x00DE, 0xFFFF, 0x04DB, 0x07CA, 0x0625, 0xFFFF, 0x0182, 0x0052, 0xFFFF,
+			0x061D, 0xFFFF, 0x02E8, 0xFFFF, 0x0042, 0xFFFF, 0xFFFF, 0xFFFF, 0x0663, 0xFFFF, 0x0117, 0xFFFF, 0xFFFF, 0xFFFF, 0x01F0, 0xFFFF,
+			0xFFFF, 0x046E, 0x0388, 0x0605, 0xFFFF, 0xFFFF, 0xFFFF, 0x004C, 0x0276, 0xFFFF, 0x0500, 0xFFFF, 0xFFFF, 0x04C6, 0x07CE, 0xFFFF,
+			0x008B, 0xFFFF, 0x0549, 0x00A9, 0x0081, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x000F, 0x0227, 0xFFFF, 0xFFFF, 0xFFFF, 0x0507, 0xFFFF,
+			0x0453, 0xFFFF, 0x06BF, 0x051F, 0xFFFF, 0x0352, 0x0723, 0x0093, 0x0697, 0xFFFF, 0xFFFF, 0xFFFF, 0x0062, 0xFFFF, 0x0284, 0xFFFF,
+			0x03A5, 0x0028, 0x0761, 0x001F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0018, 0x061E, 0x004A, 0x027C, 0x02C5, 0xFFFF, 0xFFFF,
+			0x01BB, 0x037E, 0x02FC, 0xFFFF, 0xFFFF, 0x014A, 0x071F, 0xFFFF, 0x00F9, 0x04FB, 0x029D, 0x076C, 0xFFFF, 0x0004, 0x04CF, 0x0739,
+			0xFFFF, 0x0398, 0x00A3, 0x01B9, 0x056C, 0x07AA, 0xFFFF, 0xFFFF, 0x06E4, 0xFFFF, 0x03BE, 0x053C, 0xFFFF, 0xFFFF, 0x03F3, 0xFFFF,
+			0x05B9, 0xFFFF, 0xFFFF, 0xFFFF, 0x070C, 0xFFFF, 0x06F3, 0x02D0, 0xFFFF, 0xFFFF, 0x0404, 0xFFFF, 0x068A, 0x0254, 0x06E9, 0x0220,
+			0xFFFF, 0x00C2, 0x077A, 0xFFFF, 0x035C, 0xFFFF, 0x0364, 0x07CD, 0x01CA, 0x0712, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x03E8, 0x02B2,
+			0xFFFF, 0xFFFF, 0x056F, 0xFFFF, 0x016F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0610, 0x03EE, 0x015B, 0xFFFF, 0xFFFF, 0x0135,
+			0xFFFF, 0xFFFF, 0x06E6, 0x0757, 0x05C8, 0x00FA, 0x01D1, 0xFFFF, 0x02BC, 0x0034, 0xFFFF, 0x018C, 0xFFFF, 0xFFFF, 0x07B8, 0x022E,
+			0x06B3, 0xFFFF, 0x029B, 0x0450, 0xFFFF, 0xFFFF, 0x0243, 0x00D6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x01D6, 0xFFFF, 0xFFFF, 0xFFFF,
+			0x048A, 0xFFFF, 0x06C9, 0xFFFF, 0xFFFF, 0x0409, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x03B5, 0x0623, 0x024A, 0x05CA, 0x01FD, 0x0614,
+			0x0749, 0x0316, 0xFFFF, 0xFFFF, 0xFFFF, 0x052A, 0x00BA, 0xFFFF, 0x0503, 0xFFFF, 0xFFFF, 0xFFFF, 0x01D0, 0xFFFF, 0x01F5, 0xFFFF,
+			0xFFFF, 0x0736, 0x012E, 0xFFFF, 0xFFFF, 0x061F, 0x05DF, 0xFFFF, 0xFFFF, 0xFFFF, 0x077B, 0x0682, 0x02C0, 0xFFFF, 0xFFFF, 0xFFFF,
+			0x047C, 0x06B5, 0xFFFF, 0xFFFF, 0x0321, 0x0494, 0xFFFF, 0xFFFF, 0xFFFF, 0x002B, 0x0265, 0xFFFF, 0x02C7, 0xFFFF, 0xFFFF, 0xFFFF,
+			0xFFFF, 0x046F, 0x0322, 0xFFFF, 0xFFFF, 0x00C7, 0x044C, 0x00B3, 0xFFFF, 0x0160, 0xFFFF, 0x0201, 0xFFFF, 0xFFFF, 0x0021, 0x06B6,
+			0x00AB, 0x02FB, 0x0572, 0x05BD, 0xFFFF, 0x0513, 0x0085, 0xFFFF, 0x010E, 0xFFFF, 0x0188, 0xFFFF, 0xFFFF, 0x04B8, 0x03B8, 0x0337,
+			0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0650, 0xFFFF, 0x0552, 0x060F, 0xFFFF, 0x0724, 0x01DC, 0x0706, 0x0790, 0x00E8, 0x0250,
+			0x06AF, 0xFFFF, 0xFFFF, 0x018E, 0x051B, 0xFFFF, 0xFFFF, 0x059E, 0x0667, 0x07AE, 0x00A0, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x02EC,
+			0x034A, 0xFFFF, 0x037B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x07C7, 0x0378, 0x04DC, 0xFFFF, 0xFFFF, 0x02BB, 0xFFFF, 0xFFFF, 0xFFFF,
+			0xFFFF, 0x0673, 0x04C9, 0x034C, 0x04D6, 0x05EF, 0xFFFF, 0x0299, 0xFFFF, 0x07CC, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x006D, 0xFFFF,
+			0xFFFF, 0xFFFF, 0xFFFF, 0x072B, 0xFFFF, 0x00FF, 0xFFFF, 0x025D, 0xFFFF, 0xFFFF, 0x062F, 0xFFFF, 0x0253, 0xFFFF, 0xFFFF, 0x057F,
+			0xFFFF, 0xFFFF, 0x079E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x038F, 0x03E3, 0x055B, 0xFFFF, 0x0628, 0x05CC, 0xFFFF, 0xFFFF,
+			0xFFFF, 0x0597, 0x0793, 0x0455, 0xFFFF, 0x02C4, 0x0101, 0x0498, 0x033D, 0xFFFF, 0xFFFF, 0x04D3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+			0x02E2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x06CC, 0x020A, 0x0110, 0x066C, 0x0446, 0xFFFF, 0x0272, 0xFFFF, 0xFFFF,
+			0x0086, 0x0234, 0x0523, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0019, 0x027D, 0x0309, 0xFFFF, 0x0561, 0xFFFF, 0xFFFF, 0xFFFF, 0x0514,
+			0xFFFF, 0xFFFF, 0xFFFF, 0x0127, 0xFFFF, 0xFFFF, 0xFFFF, 0x03F7, 0x07C8, 0x0491, 0xFFFF, 0xFFFF, 0x008A, 0x0332, 0xFFFF, 0x05B0,
+			0x00E3, 0x007D, 0x05F4, 0x0258, 0x0358, 0x06B2, 0x0589, 0xFFFF, 0xFFFF, 0x07C0, 0x060D, 0x05A2, 0x00D7, 0x0767, 0xFFFF, 0x068D,
+			0x009F, 0x0044, 0x02CF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x02F4, 0xFFFF, 0xFFFF, 0x02B7,
+			0x0411, 0xFFFF, 0x019E, 0x0489, 0xFFFF, 0x05C9, 0xFFFF, 0x02EE, 0x0778, 0x01AE, 0x04B4, 0x02A8, 0x004B, 0xFFFF, 0x070E, 0xFFFF,
+			0x0132, 0xFFFF, 0xFFFF, 0x02D3, 0xFFFF, 0xFFFF, 0x017C, 0xFFFF, 0xFFFF, 0xFFFF, 0x019D, 0x054F, 0x0505, 0xFFFF, 0x05C7, 0x002E,
+			0xFFFF, 0xFFFF, 0x0553, 0xFFFF, 0xFFFF, 0x0131, 0x02F8, 0xFFFF, 0x01FF, 0x0237, 0x01CF, 0x0493, 0x04C4, 0xFFFF, 0xFFFF, 0xFFFF,
+			0x04B2, 0xFFFF, 0x03CC, 0x0560, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x05FE, 0x012D, 0x0632, 0x0363, 0xFFFF, 0x0577, 0x0084,
+			0x05CE, 0xFFFF, 0xFFFF, 0x04FE, 0x03BB, 0x076B, 0x0097, 0x0356, 0x021F, 0xFFFF, 0x025F, 0xFFFF, 0x0245, 0x06FC, 0x05B4, 0x0377,
+			0xFFFF, 0x0067, 0xFFFF, 0x03B1, 0x043A, 0x0285, 0xFFFF, 0x0792, 0xFFFF, 0x0124, 0x0290, 0x0428, 0xFFFF, 0x0575, 0x037A, 0xFFFF,
+			0xFFFF, 0xFFFF, 0xFFFF, 0x0547, 0x0225, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x06E0, 0x06AC, 0xFFFF, 0xFFFF, 0xFFFF, 0x059B, 0x01A8,
+			0x07D0, 0x01CE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x06AE, 0xFFFF, 0xFFFF, 0x0769, 0xFFFF, 0x029A, 0x064E, 0xFFFF,
+			0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x03DF, 0x02A5, 0xFFFF, 0xFFFF, 0x07A6, 0x0393, 0x06C0, 0xFFFF, 0xFFFF, 0xFFFF, 0x0466, 0xFFFF,
+			0x0148, 0x0298, 0xFFFF, 0x0753, 0xFFFF, 0x0027, 0xFFFF, 0xFFFF, 0xFFFF, 0x057E, 0xFFFF, 0x0373, 0x060A, 0xFFFF, 0x077F, 0xFFFF,
+			0xFFFF, 0xFFFF, 0x04EE, 0x02AB, 0xFFFF, 0x065A, 0x06D8, 0x0032, 0x01C7, 0x040A, 0x066D, 0xFFFF, 0x04ED, 0xFFFF, 0x04CA, 0x07B5,
+			0x046C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x02D9, 0x06D7, 0x02DC, 0xFFFF, 0x065F, 0xFFFF, 0xFFFF, 0x0387, 0x0269, 0x0087,
+			0x0204, 0xFFFF, 0x0688, 0x0143, 0x0194, 0xFFFF, 0x0116, 0x07BC, 0xFFFF, 0x01D5, 0x014E, 0xFFFF, 0x02DF, 0x05AD, 0xFFFF, 0x046A,
+			0x03CF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x04DD, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x011C, 0x02D4, 0x0369,
+			0x061A, 0xFFFF, 0x0312, 0x0509, 0x074A, 0x03CB, 0xFFFF, 0xFFFF, 0x02F5, 0xFFFF, 0x0733, 0xFFFF, 0xFFFF, 0xFFFF, 0x05A0, 0xFFFF,
+			0xFFFF, 0x0536, 0x057B, 0x022A, 0xFFFF, 0x0185, 0xFFFF, 0xFFFF, 0x0278, 0xFFFF, 0x0588, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+			0xFFFF, 0x0308, 0x0221, 0x0751, 0xFFFF, 0xFFFF, 0x00D9, 0x01C6, 0x0758, 0xFFFF, 0x044A, 0xFFFF, 0x014C, 0x0267, 0xFFFF, 0x02F2,
+			0x077D, 0xFFFF, 0x033C, 0x058E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0251, 0x0414, 0xFFFF, 0x062C, 0xFFFF, 0x0158, 0xFFFF, 0xFFFF,
+			0xFFFF, 0x07BD, 0xFFFF, 0xFFFF, 0xFFFF, 0x032B, 0xFFFF, 0x05AA, 0xFFFF, 0x019F, 0xFFFF, 0x0534, 0xFFFF, 0x03EF, 0xFFFF, 0x01DE,
+			0xFFFF, 0x0684, 0xFFFF, 0xFFFF, 0xFFFF, 0x0618, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x01ED, 0x059F,
+			0x00B7, 0x030D, 0x0244, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x03D9, 0xFFFF, 0x0717, 0xFFFF, 0x0336, 0x00D2, 0xFFFF,
+			0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0198, 0xFFFF, 0xFFFF, 0x0544, 0x03DA, 0x01B0, 0x072C, 0xFFFF, 0xFFFF, 0xFFFF, 0x0359, 0x0065,
+			0x057C, 0xFFFF, 0xFFFF, 0xFFFF, 0x0432, 0xFFFF, 0x06E5, 0x05C2, 0x0462, 0x0647, 0x079C, 0x071E, 0x0271, 0x05C6, 0x0641, 0xFFFF,
+			0xFFFF, 0x0727, 0x0118, 0xFFFF, 0x029F, 0x0064, 0xFFFF, 0x0074, 0xFFFF, 0xFFFF, 0x016B, 0x0103, 0x01C5, 0x03AE, 0x072E, 0x06F5,
+			0x04AA, 0x00F0, 0x075B, 0x0107, 0xFFFF, 0xFFFF, 0xFFFF, 0x0464, 0x023D, 0xFFFF, 0xFFFF, 0xFFFF, 0x0023, 0x04A1, 0xFFFF, 0xFFFF,
+			0x00F8, 0x0660, 0x0594, 0x05FF, 0xFFFF, 0x01EB, 0xFFFF, 0x00B6, 0xFFFF, 0xFFFF, 0x0195, 0xFFFF, 0xFFFF, 0xFFFF, 0x0798, 0xFFFF,
+			0x0520, 0xFFFF, 0x065E, 0xFFFF, 0x0300, 0xFFFF, 0xFFFF, 0x01C2, 0xFFFF, 0x06C2, 0x06F4, 0x0048, 0xFFFF, 0x06A0, 0xFFFF, 0xFFFF,
+			0x0629, 0x03E7, 0x0228, 0xFFFF, 0x0799, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0783, 0xFFFF, 0x00A8, 0xFFFF,
+			0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x03D2, 0x0517, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x035A, 0xFFFF,
+			0x03FD, 0x012A, 0x02E1, 0xFFFF, 0xFFFF, 0x0223, 0x026B, 0x02CD, 0xFFFF, 0xFFFF, 0xFFFF, 0x034D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+			0x0415, 0x0029, 0xFFFF, 0x03A3, 0xFFFF, 0x024F, 0xFFFF, 0x0095, 0x0138, 0x04B9, 0xFFFF, 0xFFFF, 0x0162, 0xFFFF, 0xFFFF, 0x02D1,
+			0x07D6, 0xFFFF, 0xFFFF, 0xFFFF, 0x0472, 0xFFFF, 0x06FB, 0xFFFF, 0x06DD, 0xFFFF, 0x06DC, 0x0206, 0x01F6, 0xFFFF, 0x0510, 0x04A8,
+			0x0235, 0xFFFF, 0x0380, 0xFFFF, 0xFFFF, 0x02D5, 0xFFFF, 0xFFFF, 0xFFFF, 0x0631, 0xFFFF, 0xFFFF, 0x033F, 0xFFFF, 0x0427, 0x0279,
+			0xFFFF, 0xFFFF, 0xFFFF, 0x07CF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0146, 0xFFFF, 0x0229, 0xFFFF, 0xFFFF, 0xFFFF,
+			0x00ED, 0x0061, 0x057A, 0x026D, 0x0167, 0xFFFF, 0xFFFF, 0xFFFF, 0x0656, 0x041A, 0x05ED, 0x0729, 0x03C0, 0x0480, 0x0777, 0xFFFF,
+			0xFFFF, 0xFFFF, 0x002A, 0x0607, 0x05DD, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x03B6, 0x069E, 0x0485, 0x02A4, 0x055E, 0xFFFF,
+			0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x00C1, 0x004F, 0x0017, 0x02C1, 0x0020, 0xFFFF, 0x0794, 0x0445, 0xFFFF, 0xFFFF, 0x015E, 0x0270,
+			0x0685, 0xFFFF, 0x06EB, 0x0490, 0x04A2, 0x00C8, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0114, 0xFFFF, 0x017A, 0xFFFF, 0xFFFF, 0xFFFF,
+			0x02F3, 0xFFFF, 0x0677, 0xFFFF, 0xFFFF, 0x00FB, 0x0233, 0x0694, 0xFFFF, 0x0106, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+			0xFFFF, 0x0591, 0xFFFF, 0x067C, 0x076E, 0xFFFF, 0x000A, 0x009B, 0xFFFF, 0xFFFF, 0xFFFF, 0x040E, 0xFFFF, 0xFFFF, 0x02C9, 0xFFFF,
+			0xFFFF, 0xFFFF, 0x03AD, 0xFFFF, 0xFFFF, 0x0292, 0xFFFF, 0x03BC, 0x01EF, 0x0499, 0x0567, 0xFFFF, 0x060C, 0x00A7, 0xFFFF, 0x010F,
+			0x0187, 0xFFFF, 0xFFFF, 0x0164, 0x06D3, 0x00BD, 0x05B8, 0x0140, 0x0416, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+			0xFFFF, 0x05B7, 0x0528, 0xFFFF, 0x045B, 0x002D, 0xFFFF, 0x0402, 0xFFFF, 0x0461, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x07CB,
+			0xFFFF, 0x05E6, 0xFFFF, 0x0665, 0xFFFF, 0x03C8, 0xFFFF, 0x05E2, 0xFFFF, 0xFFFF, 0xFFFF, 0x05F2, 0xFFFF, 0x0178, 0x03DE, 0xFFFF,
+			0x0212, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0515, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+			0x0747, 0xFFFF, 0xFFFF, 0x01FA, 0x044B, 0x02DE, 0xFFFF, 0xFFFF, 0x07A5, 0xFFFF, 0x0421, 0xFFFF, 0x01A7, 0xFFFF, 0xFFFF, 0xFFFF,
+			0x0584, 0x02BE, 0xFFFF, 0xFFFF, 0xFFFF, 0x0183, 0xFFFF, 0x002F, 0xFFFF, 0x06F1, 0xFFFF, 0x0707, 0xFFFF, 0xFFFF, 0x0256, 0xFFFF,
+			0xFFFF, 0x039F, 0x067D, 0xFFFF, 0xFFFF, 0x022F, 0xFFFF, 0xFFFF, 0x07D5, 0x0392, 0xFFFF, 0x0440, 0xFFFF, 0xFFFF, 0x0330, 0x0754,
+			0xFFFF, 0xFFFF, 0x06EA, 0x025B, 0xFFFF, 0xFFFF, 0xFFFF, 0x067E, 0x0715, 0xFFFF, 0xFFFF, 0x0257, 0xFFFF, 0xFFFF, 0x05D9, 0x02C8,
+			0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x01B7, 0x00AF, 0x0601, 0x03E9, 0xFFFF, 0xFFFF, 0x0643, 0xFFFF, 0x04C8, 0x008C, 0xFFFF, 0xFFFF,
+			0xFFFF, 0xFFFF, 0xFFFF, 0x0325, 0xFFFF, 0xFFFF, 0xFFFF, 0x008E, 0x03FA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0115, 0x0311,
+			0xFFFF, 0x01C3, 0xFFFF, 0x024E, 0xFFFF, 0xFFFF, 0xFFFF, 0x00FE, 0x0001, 0x015F, 0x01B6, 0xFFFF, 0x047D, 0xFFFF, 0x0654, 0x0447,
+			0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x01FC, 0xFFFF, 0x00E7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x03BD, 0xFFFF, 0xFFFF, 0x0283,
+			0x0260, 0x05D5, 0x0334, 0xFFFF, 0x021C, 0xFFFF, 0x0655, 0xFFFF, 0x0573, 0xFFFF, 0x02D8, 0x021E, 0xFFFF, 0x06C7, 0x049B, 0x000E,
+			0x0286, 0xFFFF, 0x041F, 0x0365, 0x0621, 0x0323, 0x069F, 0x0036, 0x0307, 0x073F, 0xFFFF, 0x03A9, 0x03D4, 0x06E7, 0xFFFF, 0x0338,
+			0xFFFF, 0xFFFF, 0x01CB, 0x0456, 0x05A3, 0xFFFF, 0x06C4, 0xFFFF, 0x03CA, 0x0438, 0x0690, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x06B0,
+			0x005D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0149, 0xFFFF, 0x0431, 0xFFFF, 0x0502, 0x063B, 0xFFFF, 0x0054, 0x0391, 0x04A3, 0x03E2,
+			0xFFFF, 0x022D, 0x058C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x06AD, 0xFFFF, 0xFFFF, 0x0703, 0x00AE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+			0x058B, 0x01E6, 0x0218, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0301, 0x02C3, 0x00EE, 0x0444,
+			0x02F7, 0x06BD, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0174, 0x0141, 0xFFFF, 0xFFFF, 0x0346, 0x0527, 0x0386, 0x0320, 0x036B, 0xFFFF,
+			0xFFFF, 0x0674, 0x0750, 0x0537, 0xFFFF, 0xFFFF, 0xFFFF, 0x0670, 0xFFFF, 0x01E3, 0xFFFF, 0x0469, 0xFFFF, 0x0186, 0xFFFF, 0x06C3,
+			0xFFFF, 0xFFFF, 0xFFFF, 0x0458, 0x0159, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0675, 0xFFFF, 0xFFFF, 0xFFFF, 0x0580, 0x01C8, 0x054E,
+			0x0324, 0xFFFF, 0x028A, 0x0718, 0x05D2, 0x0355, 0xFFFF, 0x013B, 0xFFFF, 0x02B9, 0x05E0, 0xFFFF, 0xFFFF, 0x00E2, 0xFFFF, 0xFFFF,
+			0xFFFF, 0xFFFF, 0x0209, 0x0700, 0x05C5, 0x04F4, 0x04F1, 0xFFFF, 0xFFFF, 0x0766, 0x02A0, 0xFFFF, 0xFFFF, 0xFFFF, 0x062B, 0xFFFF,
+			0x007F, 0xFFFF, 0x047F, 0x074B, 0x00F6, 0x0273, 0xFFFF, 0xFFFF, 0x064F, 0x011F, 0x01D3, 0xFFFF, 0x04E4, 0x0040, 0x06F6, 0xFFFF,
+			0x025E, 0x0166, 0xFFFF, 0xFFFF, 0xFFFF, 0x0014, 0x0397, 0x05D8, 0x03AC, 0xFFFF, 0xFFFF, 0x0484, 0xFFFF, 0x054D, 0x03C6, 0x00E5,
+			0xFFFF, 0x039E, 0xFFFF, 0x064A, 0x05E7, 0xFFFF, 0xFFFF, 0x079F, 0x0719, 0xFFFF, 0x0593, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+		};
+
+	}
+
+	constexpr status_table::table_t table = {
+		detail::entries,
+		2008,
+		detail::pages,
+		{ detail::code_seeds, 9, detail::code_slots, 0xFFF },
+		{ detail::name_seeds, 9, detail::name_slots, 0xFFF },
+	};
+
+	static_assert(status_table::verify_codes(table, 0, 128), "ntstatus_table: code hash does not reach every entry");
+	static_assert(status_table::verify_codes(table, 128, 256), "ntstatus_table: code hash does not reach every entry");
+	static_assert(status_table::verify_codes(table, 256, 384), "ntstatus_table: code hash does not reach every entry");
+	static_assert(status_table::verify_codes(table, 384, 512), "ntstatus_table: code hash does not reach every entry");
+	static_assert(status_table::verify_codes(table, 512, 640), "ntstatus_table: code hash does not reach every entry");
+	static_assert(status_table::verify_codes(table, 640, 768), "ntstatus_table: code hash does not reach every entry");
+	static_assert(status_table::verify_codes(table, 768, 896), "ntstatus_table: code hash does not reach every entry");
+	static_assert(status_table::verify_codes(table, 896, 1024), "ntstatus_table: code hash does not reach every entry");
+	static_assert(status_table::verify_codes(table, 1024, 1152), "ntstatus_table: code hash does not reach every entry");
+	static_assert(status_table::verify_codes(table, 1152, 1280), "ntstatus_table: code hash does not reach every entry");
+	static_assert(status_table::verify_codes(table, 1280, 1408), "ntstatus_table: code hash does not reach every entry");
+	static_assert(status_table::verify_codes(table, 1408, 1536), "ntstatus_table: code hash does not reach every entry");
+	static_assert(status_table::verify_codes(table, 1536, 1664), "ntstatus_table: code hash does not reach every entry");
+	static_assert(status_table::verify_codes(table, 1664, 1792), "ntstatus_table: code hash does not reach every entry");
+	static_assert(status_table::verify_codes(table, 1792, 1920), "ntstatus_table: code hash does not reach every entry");
+	static_assert(status_table::verify_codes(table, 1920, 2048), "ntstatus_table: code hash does not reach every entry");
+	static_assert(status_table::verify_names(table, 0, 128), "ntstatus_table: name hash does not reach every entry");
+	static_assert(status_table::verify_names(table, 128, 256), "ntstatus_table: name hash does not reach every entry");
+	static_assert(status_table::verify_names(table, 256, 384), "ntstatus_table: name hash does not reach every entry");
+	static_assert(status_table::verify_names(table, 384, 512), "ntstatus_table: name hash does not reach every entry");
+	static_assert(status_table::verify_names(table, 512, 640), "ntstatus_table: name hash does not reach every entry");
+	static_assert(status_table::verify_names(table, 640, 768), "ntstatus_table: name hash does not reach every entry");
+	static_assert(status_table::verify_names(table, 768, 896), "ntstatus_table: name hash does not reach every entry");
+	static_assert(status_table::verify_names(table, 896, 1024), "ntstatus_table: name hash does not reach every entry");
+	static_assert(status_table::verify_names(table, 1024, 1152), "ntstatus_table: name hash does not reach every entry");
+	static_assert(status_table::verify_names(table, 1152, 1280), "ntstatus_table: name hash does not reach every entry");
+	static_assert(status_table::verify_names(table, 1280, 1408), "ntstatus_table: name hash does not reach every entry");
+	static_assert(status_table::verify_names(table, 1408, 1536), "ntstatus_table: name hash does not reach every entry");
+	static_assert(status_table::verify_names(table, 1536, 1664), "ntstatus_table: name hash does not reach every entry");
+	static_assert(status_table::verify_names(table, 1664, 1792), "ntstatus_table: name hash does not reach every entry");
+	static_assert(status_table::verify_names(table, 1792, 1920), "ntstatus_table: name hash does not reach every entry");
+	static_assert(status_table::verify_names(table, 1920, 2048), "ntstatus_table: name hash does not reach every entry");
+}
@@ -0,0 +1,155 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// NTSTATUS -> win32 error translation without the round trip through ntdll!RtlNtStatusToDosError
+//
+// same rules as ntdll: zero and customer codes pass through, FACILITY_NTWIN32 (and FACILITY_DEBUGGER errors) carry
+// the win32 code in their low word, the rest is looked up in a run length table and unknown codes give
+// ERROR_MR_MID_NOT_FOUND; the table is limited to the codes the loader can meet (registry, image, section,
+// privilege and file system failures), extend it as needed, ranges must stay sorted
+
+namespace ntstatus_win32 {
+
+	// ERROR_MR_MID_NOT_FOUND, spelled out since windows.h owns the ERROR_* macros
+	constexpr std::uint32_t not_found = 317;
+
+	// `count` consecutive statuses starting at `first` all translate to `error`
+	typedef struct _range_t {
+		std::uint32_t first;
+		std::uint32_t count;
+		std::uint32_t error;
+	} range_t, *prange_t;
+
+	constexpr range_t ranges[] = {
+		{ 0x00000102, 1, 258 },  // STATUS_TIMEOUT -> WAIT_TIMEOUT
+		{ 0x00000103, 1, 997 },  // STATUS_PENDING -> ERROR_IO_PENDING
+		{ 0x00000106, 1, 1300 }, // STATUS_NOT_ALL_ASSIGNED -> ERROR_NOT_ALL_ASSIGNED
+		{ 0x40000003, 1, 700 },  // STATUS_IMAGE_NOT_AT_BASE -> ERROR_IMAGE_NOT_AT_BASE
+		{ 0x4000000E, 1, 706 },  // STATUS_IMAGE_MACHINE_TYPE_MISMATCH -> ERROR_IMAGE_MACHINE_TYPE_MISMATCH
+		{ 0x80000002, 1, 998 },  // STATUS_DATATYPE_MISALIGNMENT -> ERROR_NOACCESS
+		{ 0x80000005, 1, 234 },  // STATUS_BUFFER_OVERFLOW -> ERROR_MORE_DATA
+		{ 0x80000006, 1, 18 },   // STATUS_NO_MORE_FILES -> ERROR_NO_MORE_FILES
+		{ 0x80000011, 1, 170 },  // STATUS_DEVICE_BUSY -> ERROR_BUSY
+		{ 0x8000001A, 1, 259 },  // STATUS_NO_MORE_ENTRIES -> ERROR_NO_MORE_ITEMS
+		{ 0xC0000001, 1, 31 },   // STATUS_UNSUCCESSFUL -> ERROR_GEN_FAILURE
+		{ 0xC0000002, 1, 1 },    // STATUS_NOT_IMPLEMENTED -> ERROR_INVALID_FUNCTION
+		{ 0xC0000003, 1, 87 },   // STATUS_INVALID_INFO_CLASS -> ERROR_INVALID_PARAMETER
+		{ 0xC0000004, 1, 24 },   // STATUS_INFO_LENGTH_MISMATCH -> ERROR_BAD_LENGTH
+		{ 0xC0000005, 1, 998 },  // STATUS_ACCESS_VIOLATION -> ERROR_NOACCESS
+		{ 0xC0000008, 1, 6 },    // STATUS_INVALID_HANDLE -> ERROR_INVALID_HANDLE
+		{ 0xC000000D, 1, 87 },   // STATUS_INVALID_PARAMETER -> ERROR_INVALID_PARAMETER
+		{ 0xC000000E, 2, 2 },    // STATUS_NO_SUCH_DEVICE, STATUS_NO_SUCH_FILE -> ERROR_FILE_NOT_FOUND
+		{ 0xC0000010, 1, 1 },    // STATUS_INVALID_DEVICE_REQUEST -> ERROR_INVALID_FUNCTION
+		{ 0xC0000011, 1, 38 },   // STATUS_END_OF_FILE -> ERROR_HANDLE_EOF
+		{ 0xC0000017, 1, 8 },    // STATUS_NO_MEMORY -> ERROR_NOT_ENOUGH_MEMORY
+		{ 0xC0000018, 1, 487 },  // STATUS_CONFLICTING_ADDRESSES -> ERROR_INVALID_ADDRESS
+		{ 0xC0000020, 1, 193 },  // STATUS_INVALID_FILE_FOR_SECTION -> ERROR_BAD_EXE_FORMAT
+		{ 0xC0000022, 1, 5 },    // STATUS_ACCESS_DENIED -> ERROR_ACCESS_DENIED
+		{ 0xC0000023, 1, 122 },  // STATUS_BUFFER_TOO_SMALL -> ERROR_INSUFFICIENT_BUFFER
+		{ 0xC0000024, 1, 6 },    // STATUS_OBJECT_TYPE_MISMATCH -> ERROR_INVALID_HANDLE
+		{ 0xC0000033, 1, 123 },  // STATUS_OBJECT_NAME_INVALID -> ERROR_INVALID_NAME
+		{ 0xC0000034, 1, 2 },    // STATUS_OBJECT_NAME_NOT_FOUND -> ERROR_FILE_NOT_FOUND
+		{ 0xC0000035, 1, 183 },  // STATUS_OBJECT_NAME_COLLISION -> ERROR_ALREADY_EXISTS
+		{ 0xC0000039, 1, 161 },  // STATUS_OBJECT_PATH_INVALID -> ERROR_BAD_PATHNAME
+		{ 0xC000003A, 1, 3 },    // STATUS_OBJECT_PATH_NOT_FOUND -> ERROR_PATH_NOT_FOUND
+		{ 0xC000003B, 1, 161 },  // STATUS_OBJECT_PATH_SYNTAX_BAD -> ERROR_BAD_PATHNAME
+		{ 0xC0000040, 1, 8 },    // STATUS_SECTION_TOO_BIG -> ERROR_NOT_ENOUGH_MEMORY
+		{ 0xC0000043, 1, 32 },   // STATUS_SHARING_VIOLATION -> ERROR_SHARING_VIOLATION
+		{ 0xC0000054, 2, 33 },   // STATUS_FILE_LOCK_CONFLICT, STATUS_LOCK_NOT_GRANTED -> ERROR_LOCK_VIOLATION
+		{ 0xC0000056, 1, 5 },    // STATUS_DELETE_PENDING -> ERROR_ACCESS_DENIED
+		{ 0xC0000060, 1, 1313 }, // STATUS_NO_SUCH_PRIVILEGE -> ERROR_NO_SUCH_PRIVILEGE
+		{ 0xC0000061, 1, 1314 }, // STATUS_PRIVILEGE_NOT_HELD -> ERROR_PRIVILEGE_NOT_HELD
+		{ 0xC000007A, 1, 127 },  // STATUS_PROCEDURE_NOT_FOUND -> ERROR_PROC_NOT_FOUND
+		{ 0xC000007B, 1, 193 },  // STATUS_INVALID_IMAGE_FORMAT -> ERROR_BAD_EXE_FORMAT
+		{ 0xC000007C, 1, 1008 }, // STATUS_NO_TOKEN -> ERROR_NO_TOKEN
+		{ 0xC000007F, 1, 112 },  // STATUS_DISK_FULL -> ERROR_DISK_FULL
+		{ 0xC0000095, 1, 534 },  // STATUS_INTEGER_OVERFLOW -> ERROR_ARITHMETIC_OVERFLOW
+		{ 0xC0000098, 1, 1006 }, // STATUS_FILE_INVALID -> ERROR_FILE_INVALID
+		{ 0xC000009A, 1, 1450 }, // STATUS_INSUFFICIENT_RESOURCES -> ERROR_NO_SYSTEM_RESOURCES
+		{ 0xC00000A2, 1, 19 },   // STATUS_MEDIA_WRITE_PROTECTED -> ERROR_WRITE_PROTECT
+		{ 0xC00000A3, 1, 21 },   // STATUS_DEVICE_NOT_READY -> ERROR_NOT_READY
+		{ 0xC00000A5, 1, 1346 }, // STATUS_BAD_IMPERSONATION_LEVEL -> ERROR_BAD_IMPERSONATION_LEVEL
+		{ 0xC00000AF, 1, 1 },    // STATUS_ILLEGAL_FUNCTION -> ERROR_INVALID_FUNCTION
+		{ 0xC00000B5, 1, 121 },  // STATUS_IO_TIMEOUT -> ERROR_SEM_TIMEOUT
+		{ 0xC00000BA, 1, 5 },    // STATUS_FILE_IS_A_DIRECTORY -> ERROR_ACCESS_DENIED
+		{ 0xC00000BB, 1, 50 },   // STATUS_NOT_SUPPORTED -> ERROR_NOT_SUPPORTED
+		{ 0xC00000BE, 1, 53 },   // STATUS_BAD_NETWORK_PATH -> ERROR_BAD_NETPATH
+		{ 0xC00000C0, 1, 55 },   // STATUS_DEVICE_DOES_NOT_EXIST -> ERROR_DEV_NOT_EXIST
+		{ 0xC00000D4, 1, 17 },   // STATUS_NOT_SAME_DEVICE -> ERROR_NOT_SAME_DEVICE
+		{ 0xC00000EF, 12, 87 },  // STATUS_INVALID_PARAMETER_1..12 -> ERROR_INVALID_PARAMETER
+		{ 0xC0000103, 1, 267 },  // STATUS_NOT_A_DIRECTORY -> ERROR_DIRECTORY
+		{ 0xC0000106, 1, 206 },  // STATUS_NAME_TOO_LONG -> ERROR_FILENAME_EXCED_RANGE
+		{ 0xC000010A, 1, 5 },    // STATUS_PROCESS_IS_TERMINATING -> ERROR_ACCESS_DENIED
+		{ 0xC000010E, 1, 1056 }, // STATUS_IMAGE_ALREADY_LOADED -> ERROR_SERVICE_ALREADY_RUNNING
+		{ 0xC000011F, 1, 4 },    // STATUS_TOO_MANY_OPENED_FILES -> ERROR_TOO_MANY_OPEN_FILES
+		{ 0xC0000120, 1, 995 },  // STATUS_CANCELLED -> ERROR_OPERATION_ABORTED
+		{ 0xC0000121, 1, 5 },    // STATUS_CANNOT_DELETE -> ERROR_ACCESS_DENIED
+		{ 0xC0000128, 1, 6 },    // STATUS_FILE_CLOSED -> ERROR_INVALID_HANDLE
+		{ 0xC000012E, 4, 193 },  // STATUS_INVALID_IMAGE_LE_FORMAT, _NOT_MZ, _PROTECT, _WIN_16 -> ERROR_BAD_EXE_FORMAT
+		{ 0xC0000135, 1, 126 },  // STATUS_DLL_NOT_FOUND -> ERROR_MOD_NOT_FOUND
+		{ 0xC0000138, 1, 182 },  // STATUS_ORDINAL_NOT_FOUND -> ERROR_INVALID_ORDINAL
+		{ 0xC0000139, 1, 127 },  // STATUS_ENTRYPOINT_NOT_FOUND -> ERROR_PROC_NOT_FOUND
+		{ 0xC000014B, 1, 109 },  // STATUS_PIPE_BROKEN -> ERROR_BROKEN_PIPE
+		{ 0xC000014C, 1, 1009 }, // STATUS_REGISTRY_CORRUPT -> ERROR_BADDB
+		{ 0xC000014D, 1, 1016 }, // STATUS_REGISTRY_IO_FAILED -> ERROR_REGISTRY_IO_FAILED
+		{ 0xC000017C, 1, 1018 }, // STATUS_KEY_DELETED -> ERROR_KEY_DELETED
+		{ 0xC0000181, 1, 1021 }, // STATUS_CHILD_MUST_BE_VOLATILE -> ERROR_CHILD_MUST_BE_VOLATILE
+		{ 0xC0000184, 1, 22 },   // STATUS_INVALID_DEVICE_STATE -> ERROR_BAD_COMMAND
+		{ 0xC0000225, 1, 1168 }, // STATUS_NOT_FOUND -> ERROR_NOT_FOUND
+		{ 0xC000036B, 2, 1275 }, // STATUS_DRIVER_BLOCKED_CRITICAL, STATUS_DRIVER_BLOCKED -> ERROR_DRIVER_BLOCKED
+		{ 0xC0000428, 1, 577 },  // STATUS_INVALID_IMAGE_HASH -> ERROR_INVALID_IMAGE_HASH
+	};
+
+	constexpr std::size_t range_count = sizeof(ranges) / sizeof(ranges[0]);
+
+	constexpr bool ranges_sorted(void) {
+		for (std::size_t i = 1; i < range_count; ++i) {
+			if (ranges[i].first < ranges[i - 1].first + ranges[i - 1].count) {
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	static_assert(ranges_sorted(), "ntstatus_win32::ranges must be sorted and must not overlap");
+
+	constexpr std::uint32_t to_win32(std::uint32_t status) {
+		if (status == 0 || (status & 0x20000000) != 0) {
+			return status;
+		}
+
+		// the N bit marks an NTSTATUS wrapped in an HRESULT
+		if ((status & 0xF0000000) == 0xD0000000) {
+			status &= ~0x10000000u;
+		}
+
+		std::uint32_t high = status >> 16;
+		if (high == 0x8007 || high == 0xC007 || high == 0xC001) {
+			return status & 0xFFFF;
+		}
+
+		// last range starting at or before status
+		std::size_t low = 0;
+		std::size_t count = range_count;
+
+		while (count > 0) {
+			std::size_t half = count / 2;
+
+			if (ranges[low + half].first <= status) {
+				low += half + 1;
+				count -= half + 1;
+			} else {
+				count = half;
+			}
+		}
+
+		if (low != 0 && status - ranges[low - 1].first < ranges[low - 1].count) {
+			return ranges[low - 1].error;
+		}
+
+		return not_found;
+	}
+}
@@ -0,0 +1,288 @@
+#pragma once
+
+#include "platform.hpp"
+#include "unique_resource.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+#if defined(__linux__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/stat.h>
+#endif
+
+// pre-flight checks of a driver image, so a file the kernel would reject fails before the service key and NtLoadDriver
+//
+// validate() reads the headers in place, with every offset checked against the file size:
+//   IMAGE_DOS_HEADER            "MZ", e_lfanew inside the file
+//   IMAGE_NT_HEADERS            "PE\0\0", Machine of the host, IMAGE_FILE_EXECUTABLE_IMAGE
+//   IMAGE_OPTIONAL_HEADER       PE32 or PE32+ as the machine requires, IMAGE_SUBSYSTEM_NATIVE, SizeOfImage and SizeOfHeaders
+//   IMAGE_SECTION_HEADER[]      inside the file, raw data inside the file, virtual range inside SizeOfImage
+// mapped_file maps the image read only, nothing is copied
+
+namespace pe {
+
+	typedef enum _error_t {
+		none,
+		truncated,
+		bad_dos_header,
+		bad_nt_signature,
+		machine_mismatch,
+		not_executable,
+		bad_optional_header,
+		not_native,
+		bad_size_of_image,
+		bad_section_table,
+		section_outside_file,
+		section_outside_image,
+
+		// number of entries in enum
+		n_error
+	} error_t;
+
+	static const char* error_name(error_t error) {
+		constexpr const char* names[] = {
+			"none",
+			"truncated",
+			"bad_dos_header",
+			"bad_nt_signature",
+			"machine_mismatch",
+			"not_executable",
+			"bad_optional_header",
+			"not_native",
+			"bad_size_of_image",
+			"bad_section_table",
+			"section_outside_file",
+			"section_outside_image",
+		};
+
+		return error < n_error ? names[error] : "unknown";
+	}
+
+	constexpr std::uint16_t machine_i386 = 0x014C;
+	constexpr std::uint16_t machine_amd64 = 0x8664;
+	constexpr std::uint16_t machine_arm64 = 0xAA64;
+
+	// drivers run in the kernel of the build architecture (a 32 bits build on a 64 bits windows checks for i386)
+#if defined(_M_X64) || defined(__x86_64__)
+	constexpr std::uint16_t host_machine = machine_amd64;
+#elif defined(_M_ARM64) || defined(__aarch64__)
+	constexpr std::uint16_t host_machine = machine_arm64;
+#else
+	constexpr std::uint16_t host_machine = machine_i386;
+#endif
+
+	constexpr std::uint16_t subsystem_native = 1;
+	constexpr std::uint16_t file_executable_image = 0x0002;
+	constexpr std::uint16_t optional_magic_pe32 = 0x010B;
+	constexpr std::uint16_t optional_magic_pe32_plus = 0x020B;
+
+	// the loader rejects more sections than this
+	constexpr std::uint16_t max_sections = 96;
+
+	typedef struct _image_info_t {
+		std::uint16_t machine;
+		std::uint16_t subsystem;
+		std::uint16_t section_count;
+		std::uint32_t size_of_image;
+	} image_info_t, *pimage_info_t;
+
+	namespace detail {
+
+		template <typename T>
+		static T read(const std::uint8_t* at) {
+			T value;
+			std::memcpy(&value, at, sizeof(T));
+			return value;
+		}
+
+		// offset + length <= size without overflowing
+		static bool fits(std::uint64_t offset, std::uint64_t length, std::uint64_t size) {
+			return offset <= size && length <= size - offset;
+		}
+	}
+
+	// info is filled as far as the headers could be read
+	static error_t validate(const std::uint8_t* image, std::size_t size, std::uint16_t machine, image_info_t& info) {
+		constexpr std::size_t dos_header_size = 64;
+		constexpr std::size_t e_lfanew = 0x3C;
+		constexpr std::size_t file_header_size = 20;
+		constexpr std::size_t section_header_size = 40;
+
+		info = {};
+
+		if (size < dos_header_size) {
+			return truncated;
+		}
+
+		if (image[0] != 'M' || image[1] != 'Z') {
+			return bad_dos_header;
+		}
+
+		std::uint32_t nt_headers = detail::read<std::uint32_t>(image + e_lfanew);
+		if ((nt_headers & 3) != 0 || nt_headers < dos_header_size) {
+			return bad_dos_header;
+		}
+
+		if (!detail::fits(nt_headers, 4 + file_header_size, size)) {
+			return truncated;
+		}
+
+		if (std::memcmp(image + nt_headers, "PE\0\0", 4) != 0) {
+			return bad_nt_signature;
+		}
+
+		const std::uint8_t* file_header = image + nt_headers + 4;
+		info.machine = detail::read<std::uint16_t>(file_header);
+		info.section_count = detail::read<std::uint16_t>(file_header + 2);
+		std::uint16_t optional_header_size = detail::read<std::uint16_t>(file_header + 16);
+		std::uint16_t characteristics = detail::read<std::uint16_t>(file_header + 18);
+
+		if (info.machine != machine) {
+			return machine_mismatch;
+		}
+
+		if ((characteristics & file_executable_image) == 0) {
+			return not_executable;
+		}
+
+		// PE32+ drops BaseOfData, the fields checked here sit at the same offsets otherwise
+		std::uint16_t expected_magic = machine == machine_i386 ? optional_magic_pe32 : optional_magic_pe32_plus;
+		std::size_t minimum_optional_size = expected_magic == optional_magic_pe32 ? 96 : 112; // up to NumberOfRvaAndSizes
+
+		std::uint64_t optional_header = static_cast<std::uint64_t>(nt_headers) + 4 + file_header_size;
+		if (!detail::fits(optional_header, optional_header_size, size)) {
+			return truncated;
+		}
+
+		const std::uint8_t* optional = image + optional_header;
+		if (optional_header_size < minimum_optional_size || detail::read<std::uint16_t>(optional) != expected_magic) {
+			return bad_optional_header;
+		}
+
+		std::uint32_t section_alignment = detail::read<std::uint32_t>(optional + 32);
+		std::uint32_t file_alignment = detail::read<std::uint32_t>(optional + 36);
+		info.size_of_image = detail::read<std::uint32_t>(optional + 56);
+		std::uint32_t size_of_headers = detail::read<std::uint32_t>(optional + 60);
+		info.subsystem = detail::read<std::uint16_t>(optional + 68);
+
+		if (info.subsystem != subsystem_native) {
+			return not_native;
+		}
+
+		if (section_alignment == 0 || (section_alignment & (section_alignment - 1)) != 0 || file_alignment == 0 || (file_alignment & (file_alignment - 1)) != 0) {
+			return bad_optional_header;
+		}
+
+		if (size_of_headers > size || size_of_headers > info.size_of_image || info.size_of_image % section_alignment != 0) {
+			return bad_size_of_image;
+		}
+
+		std::uint64_t section_table = optional_header + optional_header_size;
+		if (info.section_count == 0 || info.section_count > max_sections) {
+			return bad_section_table;
+		}
+
+		if (!detail::fits(section_table, static_cast<std::uint64_t>(info.section_count) * section_header_size, size)) {
+			return truncated;
+		}
+
+		for (std::uint16_t i = 0; i < info.section_count; ++i) {
+			const std::uint8_t* section = image + section_table + static_cast<std::size_t>(i) * section_header_size;
+
+			std::uint32_t virtual_size = detail::read<std::uint32_t>(section + 8);
+			std::uint32_t virtual_address = detail::read<std::uint32_t>(section + 12);
+			std::uint32_t raw_size = detail::read<std::uint32_t>(section + 16);
+			std::uint32_t raw_offset = detail::read<std::uint32_t>(section + 20);
+
+			if (raw_size != 0 && !detail::fits(raw_offset, raw_size, size)) {
+				return section_outside_file;
+			}
+
+			if (!detail::fits(virtual_address, virtual_size > raw_size ? virtual_size : raw_size, info.size_of_image)) {
+				return section_outside_image;
+			}
+		}
+
+		return none;
+	}
+
+	// read only view of a whole file, an empty file maps to nullptr
+	class mapped_file {
+		public:
+			mapped_file(void) = default;
+
+			mapped_file(const mapped_file&) = delete; // non copyable
+			mapped_file& operator= (const mapped_file&) = delete;
+
+			// win32 error code, ERROR_SUCCESS once mapped
+			std::uint32_t open(const std::string& path) {
+#if defined(_WIN32)
+				helpers::unique_handle file(::CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr));
+				if (!file) {
+					return ::GetLastError();
+				}
+
+				LARGE_INTEGER file_size = {};
+				if (!::GetFileSizeEx(file.get(), &file_size)) {
+					return ::GetLastError();
+				}
+
+				_size = static_cast<std::size_t>(file_size.QuadPart);
+				if (_size == 0) {
+					return ERROR_SUCCESS;
+				}
+
+				helpers::unique_handle mapping(::CreateFileMappingA(file.get(), nullptr, PAGE_READONLY, 0, 0, nullptr));
+				if (!mapping) {
+					return ::GetLastError();
+				}
+
+				// the view keeps the section alive once both handles are closed
+				_view.reset(::MapViewOfFile(mapping.get(), FILE_MAP_READ, 0, 0, 0));
+				if (!_view) {
+					return ::GetLastError();
+				}
+
+				_data = static_cast<const std::uint8_t*>(_view.get());
+#else
+				helpers::unique_fd file(::open(path.c_str(), O_RDONLY | O_CLOEXEC));
+				if (!file) {
+					return platform::last_error();
+				}
+
+				struct stat file_stat = {};
+				if (::fstat(file.get(), &file_stat) != 0) {
+					return platform::last_error();
+				}
+
+				_size = static_cast<std::size_t>(file_stat.st_size);
+				if (_size == 0) {
+					return ERROR_SUCCESS;
+				}
+
+				_view.reset({ ::mmap(nullptr, _size, PROT_READ, MAP_PRIVATE, file.get(), 0), _size });
+				if (!_view) {
+					return platform::last_error();
+				}
+
+				_data = static_cast<const std::uint8_t*>(_view.get().address);
+#endif
+				return ERROR_SUCCESS;
+			}
+
+			const std::uint8_t* data(void) const { return _data; }
+			std::size_t size(void) const { return _size; }
+
+		private:
+#if defined(_WIN32)
+			helpers::unique_view _view;
+#else
+			helpers::unique_mapping _view;
+#endif
+			const std::uint8_t* _data = nullptr;
+			std::size_t _size = 0;
+	};
+}
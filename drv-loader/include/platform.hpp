@@ -0,0 +1,77 @@
+#pragma once
+
+#include <cerrno>
+#include <cstdint>
+
+// windows.h on windows; elsewhere the few win32 types, codes and constants the portable part of the loader uses,
+// so the load/unload pipeline builds and runs against the simulated backend (see backend.hpp)
+
+#if defined(_WIN32)
+#define NOMINMAX
+#include <windows.h>
+#elif defined(__linux__) || defined(__APPLE__)
+#include <climits>
+#include <unistd.h>
+
+typedef std::int32_t LONG;
+typedef LONG NTSTATUS;
+typedef LONG LSTATUS;
+typedef std::uint32_t DWORD;
+typedef std::uint8_t BYTE;
+typedef unsigned short USHORT;
+typedef wchar_t* PWSTR;
+
+#define ERROR_SUCCESS                    0L
+#define ERROR_FILE_NOT_FOUND             2L
+#define ERROR_ACCESS_DENIED              5L
+#define ERROR_INVALID_HANDLE             6L
+#define ERROR_NOT_ENOUGH_MEMORY          8L
+#define ERROR_INVALID_DATA               13L
+#define ERROR_GEN_FAILURE                31L
+#define ERROR_INVALID_PARAMETER          87L
+#define ERROR_BAD_PATHNAME               161L
+#define ERROR_BAD_EXE_FORMAT             193L
+#define ERROR_FILENAME_EXCED_RANGE       206L
+#define ERROR_EXE_MACHINE_TYPE_MISMATCH  216L
+#define ERROR_DEPENDENT_SERVICES_RUNNING 1051L
+#define ERROR_SERVICE_ALREADY_RUNNING    1056L
+#define ERROR_SERVICE_DEPENDENCY_FAIL    1068L
+#define ERROR_NO_UNICODE_TRANSLATION     1113L
+#define ERROR_INVALID_OPERATION          4317L
+
+#define REG_NONE                         ( 0ul )
+#define REG_SZ                           ( 1ul )
+#define REG_EXPAND_SZ                    ( 2ul )
+#define REG_BINARY                       ( 3ul )
+#define REG_DWORD                        ( 4ul )
+#endif
+
+namespace platform {
+
+	// GetLastError on windows, errno mapped to the closest win32 code elsewhere
+	static std::uint32_t last_error(void) {
+#if defined(_WIN32)
+		return ::GetLastError();
+#else
+		switch (errno) {
+			case 0:
+				return ERROR_SUCCESS;
+			case ENOENT:
+			case ENOTDIR:
+				return ERROR_FILE_NOT_FOUND;
+			case EACCES:
+			case EPERM:
+				return ERROR_ACCESS_DENIED;
+			case ENOMEM:
+				return ERROR_NOT_ENOUGH_MEMORY;
+			case EINVAL:
+				return ERROR_INVALID_PARAMETER;
+			case ENAMETOOLONG:
+			case ERANGE:
+				return ERROR_FILENAME_EXCED_RANGE;
+			default:
+				return ERROR_GEN_FAILURE;
+		}
+#endif
+	}
+}
@@ -0,0 +1,102 @@
+#pragma once
+
+#include "platform.hpp"
+
+#include "ntstatus_codes.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <random>
+#include <thread>
+#include <vector>
+
+// bounded retries of NtLoadDriver/NtUnloadDriver
+//
+// a failed call is retried while its status is retryable, at most max_attempts calls in total and never past the deadline
+// the wait before retry n (1 based) is drawn uniformly from [0, min(max_backoff, initial_backoff * 2^(n - 1))] ("full jitter"),
+// so concurrent loads of a batch do not retry in lockstep
+
+namespace retry {
+
+	typedef struct _policy_t {
+		std::uint32_t max_attempts; // calls including the first one, 1 disables retries
+		std::chrono::microseconds initial_backoff;
+		std::chrono::microseconds max_backoff;
+		std::chrono::microseconds deadline; // since the first call, zero means no deadline
+		std::vector<std::uint32_t> retryable_statuses; // NTSTATUS values
+	} policy_t, *ppolicy_t;
+
+	// an image still being unloaded by the kernel reports STATUS_IMAGE_ALREADY_LOADED for a few milliseconds
+	static policy_t default_policy(void) {
+		return {
+			5,
+			std::chrono::milliseconds(10),
+			std::chrono::milliseconds(500),
+			std::chrono::seconds(2),
+			{ static_cast<std::uint32_t>(STATUS_IMAGE_ALREADY_LOADED), static_cast<std::uint32_t>(STATUS_INSUFFICIENT_RESOURCES) },
+		};
+	}
+
+	static bool is_retryable(const policy_t& policy, std::uint32_t status) {
+		for (std::uint32_t retryable : policy.retryable_statuses) {
+			if (retryable == status) {
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	// hands out the waits of one operation, started at its first call
+	class backoff {
+		public:
+			explicit backoff(const policy_t& policy) : _policy(policy), _start(std::chrono::steady_clock::now()) {}
+
+			backoff(const backoff&) = delete; // non copyable
+			backoff& operator= (const backoff&) = delete;
+
+			// false when the attempts are used up or the wait would end past the deadline
+			bool next(std::chrono::microseconds& delay) {
+				if (_attempts >= _policy.max_attempts) {
+					return false;
+				}
+
+				std::chrono::microseconds::rep ceiling = _policy.initial_backoff.count();
+				for (std::uint32_t i = 1; i < _attempts && ceiling < _policy.max_backoff.count(); ++i) {
+					ceiling *= 2;
+				}
+
+				ceiling = ceiling < _policy.max_backoff.count() ? ceiling : _policy.max_backoff.count();
+				delay = std::chrono::microseconds(ceiling > 0 ? std::uniform_int_distribution<std::chrono::microseconds::rep>(0, ceiling)(generator()) : 0);
+
+				if (_policy.deadline.count() != 0 && std::chrono::steady_clock::now() + delay - _start > _policy.deadline) {
+					return false;
+				}
+
+				++_attempts;
+				return true;
+			}
+
+			std::uint32_t attempts(void) const { return _attempts; }
+
+		private:
+			static std::minstd_rand& generator(void) {
+				thread_local std::minstd_rand generator(std::random_device{}());
+				return generator;
+			}
+
+			const policy_t& _policy;
+			std::chrono::steady_clock::time_point _start;
+			std::uint32_t _attempts = 1; // the first call is not a retry
+	};
+
+	// a zero wait still gives up the rest of the time slice, like NtYieldExecution
+	template <typename Backend>
+	static void wait(std::chrono::microseconds delay) {
+		if (delay.count() == 0) {
+			Backend::yield();
+		} else {
+			std::this_thread::sleep_for(delay);
+		}
+	}
+}
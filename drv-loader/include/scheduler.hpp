@@ -0,0 +1,291 @@
+#pragma once
+
+#include "drv-loader.hpp"
+#include "trace.hpp"
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <queue>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+// dependency ordered batch execution over a worker pool
+//
+// entries are the nodes of a graph, an edge u -> v means v starts once u finished:
+//   load B depends_on A      load A -> load B       B is skipped when A failed
+//   unload B depends_on A    unload B -> unload A   A is skipped (kept loaded) when B failed to unload
+//   same display name        earlier -> later       manifest order per driver, whatever the outcome
+// a dependency names every entry of the same operation with that display name, names compare case insensitively
+
+namespace scheduler {
+
+	typedef struct _edge_t {
+		std::size_t target;
+		bool propagates_failure; // depends_on edges, the per driver ordering edges do not
+	} edge_t, *pedge_t;
+
+	typedef struct _graph_t {
+		std::vector<std::vector<edge_t>> successors;
+		std::vector<std::size_t> predecessor_counts;
+	} graph_t, *pgraph_t;
+
+	typedef struct _build_error_t {
+		std::size_t entry; // index of the offending entry
+		const char* reason;
+		std::string detail; // the unknown dependency, or the cycle "load A -> load B -> load A"
+	} build_error_t, *pbuild_error_t;
+
+	typedef struct _node_result_t {
+		drv_loader::loader_error_t error;
+		std::uint64_t start; // nanoseconds since the batch started
+		std::uint64_t duration; // zero when skipped
+		drv_loader::report_t report;
+		bool skipped; // not run because a dependency failed
+	} node_result_t, *pnode_result_t;
+
+	namespace detail {
+
+		typedef std::pair<drv_loader::loader_operation_t, std::string> node_key_t;
+
+		static std::string fold(const std::string& str) {
+			std::string folded(str);
+
+			for (char& c : folded) {
+				c = (c >= 'A' && c <= 'Z') ? static_cast<char>(c - 'A' + 'a') : c;
+			}
+
+			return folded;
+		}
+
+		static std::string node_name(const drv_loader::config_t& config) {
+			return std::string(drv_loader::operation_name(config.operation)) + " " + config.display_name;
+		}
+
+		static void add_edge(graph_t& graph, std::size_t from, std::size_t to, bool propagates_failure) {
+			graph.successors[from].push_back({ to, propagates_failure });
+			++graph.predecessor_counts[to];
+		}
+
+		// kahn's algorithm; on failure walks predecessors inside the unresolved set, which always closes a cycle
+		static bool check_acyclic(const std::vector<drv_loader::config_t>& configs, const graph_t& graph, build_error_t& error) {
+			std::size_t count = configs.size();
+			std::vector<std::size_t> pending = graph.predecessor_counts;
+			std::vector<std::size_t> ready;
+			std::size_t resolved = 0;
+
+			for (std::size_t i = 0; i < count; ++i) {
+				if (pending[i] == 0) {
+					ready.push_back(i);
+				}
+			}
+
+			while (!ready.empty()) {
+				std::size_t node = ready.back();
+				ready.pop_back();
+				++resolved;
+
+				for (const edge_t& edge : graph.successors[node]) {
+					if (--pending[edge.target] == 0) {
+						ready.push_back(edge.target);
+					}
+				}
+			}
+
+			if (resolved == count) {
+				return true;
+			}
+
+			std::vector<std::size_t> predecessor(count, count);
+			for (std::size_t i = 0; i < count; ++i) {
+				for (const edge_t& edge : graph.successors[i]) {
+					if (pending[i] != 0 && pending[edge.target] != 0) {
+						predecessor[edge.target] = i;
+					}
+				}
+			}
+
+			std::size_t node = 0;
+			while (pending[node] == 0) {
+				++node;
+			}
+
+			std::vector<std::size_t> position(count, count);
+			std::vector<std::size_t> walk;
+
+			while (position[node] == count) {
+				position[node] = walk.size();
+				walk.push_back(node);
+				node = predecessor[node];
+			}
+
+			// the walk went backwards along the edges, the cycle reads forwards from its end
+			error = { node, "dependency cycle", std::string() };
+
+			for (std::size_t i = walk.size(); i > position[node]; --i) {
+				error.detail += node_name(configs[walk[i - 1]]) + " -> ";
+			}
+
+			error.detail += node_name(configs[walk.back()]);
+			return false;
+		}
+
+		static drv_loader::loader_error_t dependency_error(const drv_loader::config_t& config) {
+			if (config.operation == drv_loader::loader_operation_t::unload) {
+				return drv_loader::win32_error(drv_loader::phase_unload, ERROR_DEPENDENT_SERVICES_RUNNING);
+			}
+
+			return drv_loader::win32_error(drv_loader::phase_load, ERROR_SERVICE_DEPENDENCY_FAIL);
+		}
+	}
+
+	static bool build(const std::vector<drv_loader::config_t>& configs, graph_t& graph, build_error_t& error) {
+		std::size_t count = configs.size();
+		graph.successors.assign(count, std::vector<edge_t>());
+		graph.predecessor_counts.assign(count, 0);
+
+		std::multimap<detail::node_key_t, std::size_t> entries;
+		std::map<std::string, std::size_t> last_by_name;
+
+		for (std::size_t i = 0; i < count; ++i) {
+			std::string name = detail::fold(configs[i].display_name);
+			entries.emplace(detail::node_key_t(configs[i].operation, name), i);
+
+			std::map<std::string, std::size_t>::iterator last = last_by_name.find(name);
+			if (last != last_by_name.end()) {
+				detail::add_edge(graph, last->second, i, false);
+			}
+
+			last_by_name[name] = i;
+		}
+
+		for (std::size_t i = 0; i < count; ++i) {
+			for (const std::string& dependency : configs[i].depends_on) {
+				auto range = entries.equal_range(detail::node_key_t(configs[i].operation, detail::fold(dependency)));
+
+				if (range.first == range.second) {
+					error = { i, "unknown dependency", dependency };
+					return false;
+				}
+
+				for (auto it = range.first; it != range.second; ++it) {
+					if (configs[i].operation == drv_loader::loader_operation_t::unload) {
+						detail::add_edge(graph, i, it->second, true);
+					} else {
+						detail::add_edge(graph, it->second, i, true);
+					}
+				}
+			}
+		}
+
+		return detail::check_acyclic(configs, graph, error);
+	}
+
+	// runs every entry once its predecessors finished, on up to jobs threads sharing one services key
+	// ready entries start lowest index first, so one job keeps the manifest order
+	// fails without running anything when the services key cannot be opened
+	template <typename Backend = drv_loader::default_backend>
+	static drv_loader::loader_error_t run(const std::vector<drv_loader::config_t>& configs, const graph_t& graph, std::size_t jobs, std::vector<node_result_t>& results) {
+		std::size_t count = configs.size();
+		results.assign(count, node_result_t());
+
+		if (count == 0) {
+			return drv_loader::success();
+		}
+
+		typename Backend::key_type services;
+
+		drv_loader::loader_error_t ret = drv_loader::open_services_key<Backend>(services);
+		if (ret.failed()) {
+			drv_loader::loader_metrics().failures.increment(ret.domain, ret.code);
+			return ret;
+		}
+
+		std::mutex mutex;
+		std::condition_variable changed;
+		std::priority_queue<std::size_t, std::vector<std::size_t>, std::greater<std::size_t>> ready;
+		std::vector<std::size_t> pending = graph.predecessor_counts;
+		std::vector<bool> blocked(count, false); // a failure propagating predecessor failed or was skipped
+		std::size_t finished = 0;
+		std::uint64_t batch_start = trace::now();
+
+		for (std::size_t i = 0; i < count; ++i) {
+			if (pending[i] == 0) {
+				ready.push(i);
+			}
+		}
+
+		auto worker = [&]() {
+			std::unique_lock<std::mutex> lock(mutex);
+
+			for (;;) {
+				changed.wait(lock, [&]() { return !ready.empty() || finished == count; });
+
+				if (ready.empty()) {
+					return;
+				}
+
+				std::size_t node = ready.top();
+				ready.pop();
+
+				node_result_t result = {};
+				result.skipped = blocked[node];
+
+				lock.unlock();
+
+				std::uint64_t start = trace::now();
+
+				if (result.skipped) {
+					result.error = detail::dependency_error(configs[node]);
+					drv_loader::loader_metrics().failures.increment(result.error.domain, result.error.code);
+				} else {
+					result.error = drv_loader::load_unload<Backend>(configs[node], services, result.report);
+					result.duration = trace::now() - start;
+
+					if (trace::enabled()) {
+						trace::record(configs[node].display_name.c_str(), start, result.duration);
+					}
+				}
+
+				result.start = start - batch_start;
+
+				lock.lock();
+
+				results[node] = result;
+				++finished;
+
+				for (const edge_t& edge : graph.successors[node]) {
+					if (edge.propagates_failure && result.error.failed()) {
+						blocked[edge.target] = true;
+					}
+
+					if (--pending[edge.target] == 0) {
+						ready.push(edge.target);
+					}
+				}
+
+				changed.notify_all();
+			}
+		};
+
+		jobs = jobs == 0 ? 1 : (jobs < count ? jobs : count);
+
+		std::vector<std::thread> workers;
+		for (std::size_t i = 1; i < jobs; ++i) {
+			workers.emplace_back(worker);
+		}
+
+		worker();
+
+		for (std::thread& thread : workers) {
+			thread.join();
+		}
+
+		return drv_loader::success();
+	}
+}
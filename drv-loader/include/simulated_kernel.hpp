@@ -0,0 +1,477 @@
+#pragma once
+
+#include "helpers.hpp"
+#include "modules.hpp"
+#include "platform.hpp"
+#include "unique_resource.hpp"
+
+#include "ntstatus_codes.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+// in-memory stand-in for the registry and the kernel driver table, backs drv_loader::simulated_backend
+//
+// registry paths are win32 paths relative to an open key, or to HKLM for root_key ("System\CurrentControlSet\Services"),
+// and compare case insensitively; NtLoadDriver/NtUnloadDriver take the "\Registry\Machine\..." form and fail the way the kernel does:
+//   missing service key or image file      STATUS_OBJECT_NAME_NOT_FOUND
+//   service or image already loaded        STATUS_IMAGE_ALREADY_LOADED
+//   unloading a driver that is not loaded  STATUS_OBJECT_NAME_NOT_FOUND
+// loaded drivers, including those still being unloaded, are listed like SystemModuleInformation does (see modules.hpp)
+
+namespace simulated {
+
+	// delays applied to every call, zero means no delay
+	typedef struct _latency_t {
+		std::chrono::microseconds registry;       // create key, set value, delete tree
+		std::chrono::microseconds load;           // NtLoadDriver
+		std::chrono::microseconds unload;         // NtUnloadDriver
+		std::chrono::microseconds unload_pending; // an unloaded image keeps its slot this long, a reload meanwhile is STATUS_IMAGE_ALREADY_LOADED
+	} latency_t, *platency_t;
+
+	typedef struct _value_t {
+		DWORD type;
+		std::vector<std::uint8_t> data;
+	} value_t, *pvalue_t;
+
+	// parent of HKLM relative paths, the simulated HKEY_LOCAL_MACHINE
+	constexpr std::uint32_t root_key = 0;
+
+	class kernel {
+		public:
+			static kernel& instance() {
+				static kernel instance;
+				return instance;
+			}
+
+			void set_latency(const latency_t& latency) {
+				std::lock_guard<std::mutex> lock(_mutex);
+				_latency = latency;
+			}
+
+			latency_t latency(void) {
+				std::lock_guard<std::mutex> lock(_mutex);
+				return _latency;
+			}
+
+			// when set (the default) NtLoadDriver fails unless ImagePath names an existing file of the host
+			void set_check_images(bool check_images) {
+				std::lock_guard<std::mutex> lock(_mutex);
+				_check_images = check_images;
+			}
+
+			// added to the NtLoadDriver/NtUnloadDriver latency of one service, by display name
+			void set_driver_latency(const char* service, std::chrono::microseconds latency) {
+				std::lock_guard<std::mutex> lock(_mutex);
+				_driver_latency[fold(service)] = latency;
+			}
+
+			// true when path exists under HKLM
+			bool key_exists(const char* path) {
+				std::lock_guard<std::mutex> lock(_mutex);
+				return _keys.find(fold(path)) != _keys.end();
+			}
+
+			// forgets every key, handle, loaded driver and per driver latency
+			void reset(void) {
+				std::lock_guard<std::mutex> lock(_mutex);
+				_keys.clear();
+				_handles.clear();
+				_drivers.clear();
+				_driver_latency.clear();
+			}
+
+			// creates parent\path and its missing parents, handle receives a non zero handle and created whether the key is new
+			LSTATUS create_key(std::uint32_t parent, const char* path, std::uint32_t& handle, bool& created) {
+				delay(&latency_t::registry);
+
+				if (*path == '\0') {
+					return ERROR_BAD_PATHNAME;
+				}
+
+				std::lock_guard<std::mutex> lock(_mutex);
+
+				std::string key;
+				if (!resolve(parent, path, key)) {
+					return ERROR_INVALID_HANDLE;
+				}
+
+				created = _keys.find(key) == _keys.end();
+
+				for (std::size_t separator = key.find('\\'); separator != std::string::npos; separator = key.find('\\', separator + 1)) {
+					_keys[key.substr(0, separator)];
+				}
+
+				_keys[key];
+
+				handle = ++_last_handle;
+				_handles[handle] = key;
+
+				return ERROR_SUCCESS;
+			}
+
+			LSTATUS close_key(std::uint32_t handle) {
+				std::lock_guard<std::mutex> lock(_mutex);
+				return _handles.erase(handle) != 0 ? ERROR_SUCCESS : ERROR_INVALID_HANDLE;
+			}
+
+			// writes every value or none, values[i] has name, type, data and size members like drv_loader::registry_value_t
+			// each value costs one registry latency, as the win32 backend still makes one RegSetValueExA per value
+			template <typename Value>
+			LSTATUS set_values(std::uint32_t handle, const Value* values, std::size_t count) {
+				for (std::size_t i = 0; i < count; ++i) {
+					delay(&latency_t::registry);
+				}
+
+				std::lock_guard<std::mutex> lock(_mutex);
+
+				std::unordered_map<std::uint32_t, std::string>::const_iterator it = _handles.find(handle);
+				if (it == _handles.end()) {
+					return ERROR_INVALID_HANDLE;
+				}
+
+				// the key was deleted through another path while the handle was open
+				std::map<std::string, registry_key_t>::iterator key = _keys.find(it->second);
+				if (key == _keys.end()) {
+					return ERROR_INVALID_HANDLE;
+				}
+
+				for (std::size_t i = 0; i < count; ++i) {
+					const std::uint8_t* bytes = static_cast<const std::uint8_t*>(values[i].data);
+					key->second.values[fold(values[i].name)] = { values[i].type, std::vector<std::uint8_t>(bytes, bytes + values[i].size) };
+				}
+
+				return ERROR_SUCCESS;
+			}
+
+			// like RegDeleteValueA, ERROR_FILE_NOT_FOUND when the key has no such value
+			LSTATUS delete_value(std::uint32_t handle, const char* name) {
+				delay(&latency_t::registry);
+
+				std::lock_guard<std::mutex> lock(_mutex);
+
+				std::unordered_map<std::uint32_t, std::string>::const_iterator it = _handles.find(handle);
+				if (it == _handles.end()) {
+					return ERROR_INVALID_HANDLE;
+				}
+
+				std::map<std::string, registry_key_t>::iterator key = _keys.find(it->second);
+				if (key == _keys.end()) {
+					return ERROR_INVALID_HANDLE;
+				}
+
+				return key->second.values.erase(fold(name)) != 0 ? ERROR_SUCCESS : ERROR_FILE_NOT_FOUND;
+			}
+
+			// deletes parent\path and every subkey
+			LSTATUS delete_tree(std::uint32_t parent, const char* path) {
+				delay(&latency_t::registry);
+
+				std::lock_guard<std::mutex> lock(_mutex);
+
+				std::string key;
+				if (!resolve(parent, path, key)) {
+					return ERROR_INVALID_HANDLE;
+				}
+
+				std::map<std::string, registry_key_t>::iterator it = _keys.find(key);
+				if (it == _keys.end()) {
+					return ERROR_FILE_NOT_FOUND;
+				}
+
+				// keys sharing the prefix are contiguous, subkeys are interleaved with siblings like "<key> 2"
+				while (it != _keys.end() && it->first.compare(0, key.size(), key) == 0) {
+					if (it->first.size() == key.size() || is_subkey(key, it->first)) {
+						it = _keys.erase(it);
+					} else {
+						++it;
+					}
+				}
+
+				return ERROR_SUCCESS;
+			}
+
+			// copy of the value name of parent\path, like RegGetValueA
+			LSTATUS query_value(std::uint32_t parent, const char* path, const char* name, value_t& out) {
+				delay(&latency_t::registry);
+
+				std::lock_guard<std::mutex> lock(_mutex);
+
+				std::string key;
+				if (!resolve(parent, path, key)) {
+					return ERROR_INVALID_HANDLE;
+				}
+
+				const value_t* value = find_value(key, fold(name));
+				if (value == nullptr) {
+					return ERROR_FILE_NOT_FOUND;
+				}
+
+				out = *value;
+				return ERROR_SUCCESS;
+			}
+
+			// copy of a value under HKLM, false when the key or the value does not exist
+			bool query_value(const char* path, const char* name, value_t& out) {
+				std::lock_guard<std::mutex> lock(_mutex);
+
+				const value_t* value = find_value(fold(path), fold(name));
+				if (value == nullptr) {
+					return false;
+				}
+
+				out = *value;
+				return true;
+			}
+
+			NTSTATUS load_driver(const wchar_t* registry_path, std::size_t length) {
+				std::string key;
+				bool found = service_key(registry_path, length, key);
+
+				delay(&latency_t::load, found ? base_name(key) : std::string());
+
+				if (!found) {
+					return STATUS_OBJECT_NAME_NOT_FOUND;
+				}
+
+				std::lock_guard<std::mutex> lock(_mutex);
+
+				const value_t* image_path = find_value(key, "imagepath");
+				if (image_path == nullptr || (image_path->type != REG_SZ && image_path->type != REG_EXPAND_SZ)) {
+					return STATUS_OBJECT_NAME_NOT_FOUND;
+				}
+
+				std::string image(image_path->data.begin(), image_path->data.end());
+				image.resize(std::char_traits<char>::length(image.c_str())); // REG_SZ data may or may not count the terminator
+
+				std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+				std::string image_name = fold(base_name(image).c_str());
+
+				for (std::map<std::string, driver_t>::iterator it = _drivers.begin(); it != _drivers.end();) {
+					if (it->second.unloaded && now >= it->second.release_at) {
+						it = _drivers.erase(it);
+						continue;
+					}
+
+					// the kernel keys loaded images by name, whichever service loaded them
+					if (it->first == key || fold(base_name(it->second.image_path).c_str()) == image_name) {
+						return STATUS_IMAGE_ALREADY_LOADED;
+					}
+
+					++it;
+				}
+
+				if (_check_images && !image_exists(image)) {
+					return STATUS_OBJECT_NAME_NOT_FOUND;
+				}
+
+				std::error_code error;
+				std::uintmax_t file_size = std::filesystem::file_size(image_file(image), error);
+				std::uint32_t image_size = error ? 0x1000 : static_cast<std::uint32_t>((file_size + 0xFFF) & ~std::uintmax_t(0xFFF));
+
+				_drivers[key] = { image, false, now, ++_load_order, image_size };
+
+				return STATUS_SUCCESS;
+			}
+
+			NTSTATUS unload_driver(const wchar_t* registry_path, std::size_t length) {
+				std::string key;
+				bool found = service_key(registry_path, length, key);
+
+				delay(&latency_t::unload, found ? base_name(key) : std::string());
+
+				if (!found) {
+					return STATUS_OBJECT_NAME_NOT_FOUND;
+				}
+
+				std::lock_guard<std::mutex> lock(_mutex);
+
+				std::map<std::string, driver_t>::iterator it = _drivers.find(key);
+				if (_keys.find(key) == _keys.end() || it == _drivers.end() || it->second.unloaded) {
+					return STATUS_OBJECT_NAME_NOT_FOUND;
+				}
+
+				if (_latency.unload_pending.count() == 0) {
+					_drivers.erase(it);
+				} else {
+					it->second.unloaded = true;
+					it->second.release_at = std::chrono::steady_clock::now() + _latency.unload_pending;
+				}
+
+				return STATUS_SUCCESS;
+			}
+
+			// RTL_PROCESS_MODULES of every mapped driver in load order, in the host layout, into buffer
+			NTSTATUS query_modules(std::vector<std::uint8_t>& buffer) {
+				const modules::layout_t& layout = modules::host_layout;
+
+				std::lock_guard<std::mutex> lock(_mutex);
+
+				std::vector<const driver_t*> mapped;
+				std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+
+				for (const std::pair<const std::string, driver_t>& driver : _drivers) {
+					if (!driver.second.unloaded || now < driver.second.release_at) {
+						mapped.push_back(&driver.second);
+					}
+				}
+
+				std::sort(mapped.begin(), mapped.end(), [](const driver_t* lhs, const driver_t* rhs) { return lhs->load_order < rhs->load_order; });
+
+				buffer.assign(layout.header_size + mapped.size() * layout.entry_size, 0);
+
+				std::uint32_t count = static_cast<std::uint32_t>(mapped.size());
+				std::memcpy(buffer.data(), &count, sizeof(count));
+
+				for (std::size_t i = 0; i < mapped.size(); ++i) {
+					std::uint8_t* entry = buffer.data() + layout.header_size + i * layout.entry_size;
+					const std::string& path = mapped[i]->image_path;
+
+					std::uint64_t image_base = 0xFFFFF80000000000ull + static_cast<std::uint64_t>(mapped[i]->load_order) * 0x100000;
+					std::uint16_t load_order_index = static_cast<std::uint16_t>(i);
+					std::uint16_t load_count = 1;
+					std::size_t path_length = path.size() < modules::max_full_path_name ? path.size() : modules::max_full_path_name - 1;
+					std::size_t separator = path.find_last_of("\\/", path_length);
+					std::uint16_t file_name = static_cast<std::uint16_t>(separator == std::string::npos ? 0 : separator + 1);
+
+					std::memcpy(entry + layout.image_base, &image_base, layout.pointer_size); // low half first, little endian
+					std::memcpy(entry + layout.image_size, &mapped[i]->image_size, sizeof(std::uint32_t));
+					std::memcpy(entry + layout.load_order_index, &load_order_index, sizeof(load_order_index));
+					std::memcpy(entry + layout.load_count, &load_count, sizeof(load_count));
+					std::memcpy(entry + layout.offset_to_file_name, &file_name, sizeof(file_name));
+					std::memcpy(entry + layout.full_path_name, path.data(), path_length);
+				}
+
+				return STATUS_SUCCESS;
+			}
+
+		private:
+			typedef struct _registry_key_t {
+				std::map<std::string, value_t> values;
+			} registry_key_t, *pregistry_key_t;
+
+			typedef struct _driver_t {
+				std::string image_path;
+				bool unloaded; // NtUnloadDriver returned, the image is still mapped until release_at
+				std::chrono::steady_clock::time_point release_at;
+				std::uint32_t load_order;
+				std::uint32_t image_size; // file size rounded up to a page
+			} driver_t, *pdriver_t;
+
+			kernel(void) = default;
+
+			void delay(std::chrono::microseconds latency_t::* which, const std::string& service = std::string()) {
+				std::chrono::microseconds duration;
+
+				{
+					std::lock_guard<std::mutex> lock(_mutex);
+					duration = _latency.*which;
+
+					std::map<std::string, std::chrono::microseconds>::const_iterator it = _driver_latency.find(service);
+					if (it != _driver_latency.end()) {
+						duration += it->second;
+					}
+				}
+
+				if (duration.count() != 0) {
+					std::this_thread::sleep_for(duration);
+				}
+			}
+
+			static std::string fold(const char* str) {
+				std::string folded(str);
+
+				for (char& c : folded) {
+					c = (c >= 'A' && c <= 'Z') ? static_cast<char>(c - 'A' + 'a') : c;
+				}
+
+				return folded;
+			}
+
+			static bool is_subkey(const std::string& key, const std::string& other) {
+				return other.size() > key.size() && other[key.size()] == '\\' && other.compare(0, key.size(), key) == 0;
+			}
+
+			static std::string base_name(const std::string& path) {
+				std::size_t separator = path.find_last_of("\\/");
+				return separator == std::string::npos ? path : path.substr(separator + 1);
+			}
+
+			// host path of "\??\<path>" as written by build_image_path
+			static std::string image_file(const std::string& image_path) {
+				constexpr char dos_devices[] = "\\??\\";
+				return image_path.compare(0, sizeof(dos_devices) - 1, dos_devices) == 0 ? image_path.substr(sizeof(dos_devices) - 1) : image_path;
+			}
+
+			static bool image_exists(const std::string& image_path) {
+				std::error_code error;
+				return std::filesystem::is_regular_file(image_file(image_path), error);
+			}
+
+			// "\Registry\Machine\<key>" -> folded "<key>", false when the path is not under HKLM
+			static bool service_key(const wchar_t* registry_path, std::size_t length, std::string& key) {
+				constexpr char machine[] = "\\registry\\machine\\";
+
+				std::string path = fold(helpers::to_ansi(std::wstring(registry_path, length)).c_str());
+				if (path.compare(0, sizeof(machine) - 1, machine) != 0) {
+					return false;
+				}
+
+				key = path.substr(sizeof(machine) - 1);
+				return true;
+			}
+
+			// folded HKLM relative path of parent\path, false when parent is not an open key or was deleted
+			bool resolve(std::uint32_t parent, const char* path, std::string& key) const {
+				if (parent == root_key) {
+					key = fold(path);
+					return true;
+				}
+
+				std::unordered_map<std::uint32_t, std::string>::const_iterator it = _handles.find(parent);
+				if (it == _handles.end() || _keys.find(it->second) == _keys.end()) {
+					return false;
+				}
+
+				key = it->second + "\\" + fold(path);
+				return true;
+			}
+
+			const value_t* find_value(const std::string& key, const std::string& name) const {
+				std::map<std::string, registry_key_t>::const_iterator it = _keys.find(key);
+				if (it == _keys.end()) {
+					return nullptr;
+				}
+
+				std::map<std::string, value_t>::const_iterator value = it->second.values.find(name);
+				return value != it->second.values.end() ? &value->second : nullptr;
+			}
+
+			std::mutex _mutex;
+			latency_t _latency = {};
+			bool _check_images = true;
+			std::map<std::string, registry_key_t> _keys; // by folded path, parents created implicitly
+			std::unordered_map<std::uint32_t, std::string> _handles;
+			std::uint32_t _last_handle = 0;
+			std::uint32_t _load_order = 0;
+			std::map<std::string, driver_t> _drivers; // keyed by service key
+			std::map<std::string, std::chrono::microseconds> _driver_latency; // keyed by service name
+	};
+
+	struct key_traits {
+		typedef std::uint32_t type;
+		static type invalid(void) { return 0; }
+		static void close(type value) { kernel::instance().close_key(value); }
+	};
+
+	typedef helpers::unique_resource<key_traits> unique_key;
+}
@@ -0,0 +1,128 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+// layout and lookup shared by the generated status tables (see tools/gen_status_table.py)
+//
+// strings live in one pool addressed by 32 bits offsets; msvc caps string literals at 64KiB so the pool is
+// emitted as 64KiB pages, page = offset >> 16, position in page = offset & 0xFFFF
+//
+// code -> entry and name -> entry are hash and displace perfect hashes: the high bits of mix32(key) pick a bucket,
+// the bucket seed displaces its keys into distinct slots, and the slot holds the entry index (or empty_slot);
+// names are keyed by their fnv1a hash, the generator rejects tables where two names share one
+
+namespace status_table {
+
+	constexpr std::uint16_t empty_slot = 0xFFFF;
+
+	typedef struct _entry_t {
+		std::uint32_t value;
+		std::uint32_t name;    // pool offset
+		std::uint32_t message; // pool offset
+		std::uint16_t name_length;
+		std::uint16_t message_length;
+	} entry_t, *pentry_t;
+
+	typedef struct _perfect_hash_t {
+		const std::uint16_t* seeds;
+		std::uint32_t bucket_bits;
+		const std::uint16_t* slots;
+		std::uint32_t slot_mask;
+	} perfect_hash_t, *pperfect_hash_t;
+
+	typedef struct _table_t {
+		const entry_t* entries;
+		std::size_t entry_count;
+		const char* const* pages;
+		perfect_hash_t codes;
+		perfect_hash_t names;
+	} table_t, *ptable_t;
+
+	// murmur3 finalizer
+	constexpr std::uint32_t mix32(std::uint32_t x) {
+		x ^= x >> 16;
+		x *= 0x85EBCA6Bu;
+		x ^= x >> 13;
+		x *= 0xC2B2AE35u;
+		x ^= x >> 16;
+		return x;
+	}
+
+	constexpr std::uint32_t fnv1a(std::string_view str) {
+		std::uint32_t hash = 0x811C9DC5u;
+
+		for (char c : str) {
+			hash = (hash ^ static_cast<std::uint8_t>(c)) * 0x01000193u;
+		}
+
+		return hash;
+	}
+
+	constexpr std::uint32_t slot_hash(std::uint32_t key, std::uint16_t seed) {
+		return mix32(key ^ (seed * 0x9E3779B9u));
+	}
+
+	// entry index for key, or empty_slot; the caller still has to compare the entry against the key
+	constexpr std::uint16_t probe(const perfect_hash_t& hash, std::uint32_t key) {
+		std::uint16_t seed = hash.seeds[mix32(key) >> (32 - hash.bucket_bits)];
+		return hash.slots[slot_hash(key, seed) & hash.slot_mask];
+	}
+
+	constexpr const entry_t* find_code(const table_t& table, std::uint32_t value) {
+		std::uint16_t index = probe(table.codes, value);
+
+		if (index == empty_slot || table.entries[index].value != value) {
+			return nullptr;
+		}
+
+		return &table.entries[index];
+	}
+
+	constexpr std::string_view pool_string(const table_t& table, std::uint32_t offset, std::uint16_t length) {
+		return std::string_view(table.pages[offset >> 16] + (offset & 0xFFFF), length);
+	}
+
+	constexpr std::string_view name(const table_t& table, const entry_t& entry) {
+		return pool_string(table, entry.name, entry.name_length);
+	}
+
+	constexpr std::string_view message(const table_t& table, const entry_t& entry) {
+		return pool_string(table, entry.message, entry.message_length);
+	}
+
+	constexpr const entry_t* find_name(const table_t& table, std::string_view str) {
+		std::uint16_t index = probe(table.names, fnv1a(str));
+
+		if (index == empty_slot || name(table, table.entries[index]) != str) {
+			return nullptr;
+		}
+
+		return &table.entries[index];
+	}
+
+	// every entry in [first, last) must be reachable through the code hash (or share its value with an earlier entry)
+	// the generated tables check themselves in chunks to stay below msvc's constexpr evaluation step limit
+	constexpr bool verify_codes(const table_t& table, std::size_t first, std::size_t last) {
+		for (std::size_t i = first; i < last && i < table.entry_count; ++i) {
+			const entry_t* entry = find_code(table, table.entries[i].value);
+
+			if (entry == nullptr || entry->value != table.entries[i].value) {
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	constexpr bool verify_names(const table_t& table, std::size_t first, std::size_t last) {
+		for (std::size_t i = first; i < last && i < table.entry_count; ++i) {
+			if (find_name(table, name(table, table.entries[i])) != &table.entries[i]) {
+				return false;
+			}
+		}
+
+		return true;
+	}
+}
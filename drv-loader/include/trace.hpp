@@ -0,0 +1,160 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// scoped trace spans recorded per thread and dumped as chrome trace-event json (chrome://tracing, ui.perfetto.dev)
+// when tracing is disabled a span costs one relaxed load and a branch
+
+namespace trace {
+
+	typedef struct _event_t {
+		const char* name; // must outlive the dump, spans are named with string literals
+		std::uint64_t start; // nanoseconds on the monotonic clock
+		std::uint64_t duration;
+	} event_t, *pevent_t;
+
+	namespace detail {
+
+		typedef struct _thread_buffer_t {
+			std::uint32_t thread_id;
+			std::mutex mutex; // only contended while dumping
+			std::vector<event_t> events;
+		} thread_buffer_t, *pthread_buffer_t;
+
+		class registry {
+			public:
+				static registry& instance() {
+					static registry instance;
+					return instance;
+				}
+
+				std::atomic<bool>& enabled(void) { return _enabled; }
+
+				// buffers are shared with the registry so events survive the thread that recorded them
+				std::shared_ptr<thread_buffer_t> create_buffer(void) {
+					std::shared_ptr<thread_buffer_t> buffer = std::make_shared<thread_buffer_t>();
+					buffer->events.reserve(1024);
+
+					std::lock_guard<std::mutex> lock(_mutex);
+					buffer->thread_id = static_cast<std::uint32_t>(_buffers.size() + 1);
+					_buffers.push_back(buffer);
+
+					return buffer;
+				}
+
+				template <typename Fn>
+				void for_each_buffer(Fn fn) {
+					std::lock_guard<std::mutex> lock(_mutex);
+
+					for (const std::shared_ptr<thread_buffer_t>& buffer : _buffers) {
+						std::lock_guard<std::mutex> buffer_lock(buffer->mutex);
+						fn(*buffer);
+					}
+				}
+
+			private:
+				registry(void) = default;
+
+				std::atomic<bool> _enabled = { false };
+				std::mutex _mutex;
+				std::vector<std::shared_ptr<thread_buffer_t>> _buffers;
+		};
+
+		static thread_buffer_t& local_buffer(void) {
+			thread_local std::shared_ptr<thread_buffer_t> buffer = registry::instance().create_buffer();
+			return *buffer;
+		}
+
+		// a json string body: quote and backslash escaped, control characters as \u00XX, other bytes as they are
+		static void write_escaped(std::FILE* file, const char* str) {
+			for (; *str != '\0'; ++str) {
+				if (static_cast<unsigned char>(*str) < 0x20) {
+					std::fprintf(file, "\\u%04X", static_cast<unsigned>(static_cast<unsigned char>(*str)));
+					continue;
+				}
+
+				if (*str == '"' || *str == '\\') {
+					std::fputc('\\', file);
+				}
+
+				std::fputc(*str, file);
+			}
+		}
+	}
+
+	static std::uint64_t now(void) {
+		return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+	}
+
+	static bool enabled(void) {
+		return detail::registry::instance().enabled().load(std::memory_order_relaxed);
+	}
+
+	static void enable(bool value = true) {
+		detail::registry::instance().enabled().store(value, std::memory_order_relaxed);
+	}
+
+	static void record(const char* name, std::uint64_t start, std::uint64_t duration) {
+		detail::thread_buffer_t& buffer = detail::local_buffer();
+
+		std::lock_guard<std::mutex> lock(buffer.mutex);
+		buffer.events.push_back({ name, start, duration });
+	}
+
+	class scoped_span {
+		public:
+			explicit scoped_span(const char* name) : _name(name), _start(enabled() ? now() : 0) {}
+
+			scoped_span(const scoped_span&) = delete; // non copyable
+			scoped_span& operator= (const scoped_span&) = delete;
+
+			~scoped_span(void) {
+				if (_start != 0) {
+					record(_name, _start, now() - _start);
+				}
+			}
+
+		private:
+			const char* _name;
+			std::uint64_t _start;
+	};
+
+	// complete ("X") events, timestamps in microseconds relative to the first recorded event
+	static bool dump_chrome_json(const std::string& path) {
+		std::FILE* file = std::fopen(path.c_str(), "wb");
+		if (file == nullptr) {
+			return false;
+		}
+
+		std::uint64_t origin = UINT64_MAX;
+		detail::registry::instance().for_each_buffer([&origin](const detail::thread_buffer_t& buffer) {
+			for (const event_t& event : buffer.events) {
+				origin = event.start < origin ? event.start : origin;
+			}
+		});
+
+		bool first = true;
+		std::fputs("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[", file);
+
+		detail::registry::instance().for_each_buffer([&](const detail::thread_buffer_t& buffer) {
+			for (const event_t& event : buffer.events) {
+				std::fputs(first ? "\n{\"name\":\"" : ",\n{\"name\":\"", file);
+				detail::write_escaped(file, event.name);
+				std::fprintf(file, "\",\"cat\":\"drv-loader\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":1,\"tid\":%u}",
+					static_cast<double>(event.start - origin) / 1000.0, static_cast<double>(event.duration) / 1000.0, buffer.thread_id);
+				first = false;
+			}
+		});
+
+		std::fputs("\n]}\n", file);
+
+		return std::fclose(file) == 0;
+	}
+}
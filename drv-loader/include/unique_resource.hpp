@@ -0,0 +1,170 @@
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#if defined(_WIN32)
+#define NOMINMAX
+#include <windows.h>
+#elif defined(__linux__) || defined(__APPLE__)
+#include <dlfcn.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace helpers {
+
+	namespace detail {
+		// Traits::empty(value) when the traits define it, value == Traits::invalid() otherwise
+		template <typename Traits, typename = void>
+		struct owns_nothing {
+			static bool test(const typename Traits::type& value) { return value == Traits::invalid(); }
+		};
+
+		template <typename Traits>
+		struct owns_nothing<Traits, std::void_t<decltype(Traits::empty(std::declval<typename Traits::type>()))>> {
+			static bool test(const typename Traits::type& value) { return Traits::empty(value); }
+		};
+	}
+
+	// move only owner of a resource described by Traits:
+	//   typedef ... type;               the raw resource
+	//   static type invalid(void);      value meaning "owns nothing"
+	//   static void close(type value);  releases a valid value
+	//   static bool empty(type value);  optional, for resources with more than one "owns nothing" value
+	// Traits is empty and inherited, so the wrapper is exactly as large as the raw resource
+	template <typename Traits>
+	class unique_resource : private Traits {
+		public:
+			typedef typename Traits::type element_type;
+
+			unique_resource(void) : _value(Traits::invalid()) {}
+			explicit unique_resource(element_type value) : _value(value) {}
+
+			unique_resource(const unique_resource&) = delete; // non copyable
+			unique_resource& operator= (const unique_resource&) = delete;
+
+			unique_resource(unique_resource&& other) noexcept : _value(other.release()) {}
+
+			unique_resource& operator= (unique_resource&& other) noexcept {
+				if (this != &other) {
+					reset(other.release());
+				}
+
+				return *this;
+			}
+
+			~unique_resource(void) { reset(); }
+
+			// closes the owned value (if any) and takes ownership of value
+			void reset(element_type value = Traits::invalid()) {
+				element_type old = _value;
+				_value = value;
+
+				if (!detail::owns_nothing<Traits>::test(old)) {
+					Traits::close(old);
+				}
+			}
+
+			// gives up ownership without closing
+			element_type release(void) {
+				element_type value = _value;
+				_value = Traits::invalid();
+				return value;
+			}
+
+			// closes the owned value and exposes storage for apis returning the resource through an out parameter
+			element_type* put(void) {
+				reset();
+				return &_value;
+			}
+
+			const element_type& get(void) const { return _value; }
+
+			bool valid(void) const { return !detail::owns_nothing<Traits>::test(_value); }
+			explicit operator bool(void) const { return valid(); }
+
+		private:
+			element_type _value;
+	};
+
+	template <typename T>
+	struct heap_traits {
+		typedef T* type;
+		static type invalid(void) { return nullptr; }
+		static void close(type value) { delete value; }
+	};
+
+	template <typename T>
+	using unique_heap_ptr = unique_resource<heap_traits<T>>;
+
+#if defined(_WIN32)
+	// kernel object handles, both null and INVALID_HANDLE_VALUE (what CreateFile returns on failure) are treated as empty
+	struct handle_traits {
+		typedef HANDLE type;
+		static type invalid(void) { return nullptr; }
+		static bool empty(type value) { return value == nullptr || value == INVALID_HANDLE_VALUE; }
+		static void close(type value) { ::CloseHandle(value); }
+	};
+
+	struct hkey_traits {
+		typedef HKEY type;
+		static type invalid(void) { return nullptr; }
+		static void close(type value) { ::RegCloseKey(value); }
+	};
+
+	struct module_traits {
+		typedef HMODULE type;
+		static type invalid(void) { return nullptr; }
+		static void close(type value) { ::FreeLibrary(value); }
+	};
+
+	struct view_traits {
+		typedef const void* type;
+		static type invalid(void) { return nullptr; }
+		static void close(type value) { ::UnmapViewOfFile(value); }
+	};
+
+	typedef unique_resource<handle_traits> unique_handle;
+	typedef unique_resource<hkey_traits> unique_hkey;
+	typedef unique_resource<module_traits> unique_module;
+	typedef unique_resource<view_traits> unique_view;
+
+	static_assert(sizeof(unique_handle) == sizeof(HANDLE), "helpers::unique_handle must stay pointer sized");
+#elif defined(__linux__) || defined(__APPLE__)
+	struct fd_traits {
+		typedef int type;
+		static type invalid(void) { return -1; }
+		static void close(type value) { ::close(value); }
+	};
+
+	struct module_traits {
+		typedef void* type;
+		static type invalid(void) { return nullptr; }
+		static void close(type value) { ::dlclose(value); }
+	};
+
+	typedef struct _mapping_t {
+		void* address;
+		std::size_t size;
+
+		// identified by its address only, so a failed mmap is invalid whatever the requested size
+		bool operator== (const _mapping_t& other) const { return address == other.address; }
+	} mapping_t, *pmapping_t;
+
+	struct mapping_traits {
+		typedef mapping_t type;
+		static type invalid(void) { return { MAP_FAILED, 0 }; }
+		static void close(type value) { ::munmap(value.address, value.size); }
+	};
+
+	typedef unique_resource<fd_traits> unique_fd;
+	typedef unique_resource<module_traits> unique_module;
+	typedef unique_resource<mapping_traits> unique_mapping;
+
+	static_assert(sizeof(unique_fd) == sizeof(int), "helpers::unique_fd must stay int sized");
+#endif
+
+	static_assert(sizeof(unique_heap_ptr<int>) == sizeof(int*), "helpers::unique_resource must not add storage");
+}
@@ -0,0 +1,566 @@
+#pragma once
+
+#include "cpu_features.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+// utf-8 transcoding with vectorized ascii runs (sse2/avx2 selected at runtime) and validating scalar paths
+// wide units are utf-16 when 2 bytes large (windows wchar_t) and utf-32 when 4 bytes large (linux wchar_t)
+
+namespace utf {
+
+	typedef enum _error_t {
+		none,
+		truncated_sequence,
+		invalid_lead_byte,
+		invalid_continuation,
+		overlong_encoding,
+		surrogate_code_point,
+		unpaired_surrogate,
+		out_of_range,
+
+		// number of entries in enum
+		n_error
+	} error_t;
+
+	typedef struct _result_t {
+		error_t error;
+		std::size_t position; // offset of the first malformed source unit (source length on success)
+		std::size_t written;  // number of destination units written
+	} result_t, *presult_t;
+
+	static const char* error_name(error_t error) {
+		constexpr const char* names[] = {
+			"none",
+			"truncated sequence",
+			"invalid lead byte",
+			"invalid continuation byte",
+			"overlong encoding",
+			"surrogate code point",
+			"unpaired surrogate",
+			"code point out of range",
+		};
+
+		return error < n_error ? names[error] : "unknown";
+	}
+
+	namespace detail {
+
+		template <typename CharT>
+		static std::size_t put_code_point(std::uint32_t code_point, CharT* dst) {
+			if constexpr (sizeof(CharT) == 2) {
+				if (code_point >= 0x10000) {
+					code_point -= 0x10000;
+					dst[0] = static_cast<CharT>(0xD800 + (code_point >> 10));
+					dst[1] = static_cast<CharT>(0xDC00 + (code_point & 0x3FF));
+					return 2;
+				}
+			}
+
+			dst[0] = static_cast<CharT>(code_point);
+			return 1;
+		}
+
+		// decodes the multi byte sequence starting at src[i], advancing i and written on success
+		template <typename CharT>
+		static error_t decode_sequence(const std::uint8_t* src, std::size_t length, std::size_t& i, CharT* dst, std::size_t& written) {
+			constexpr std::uint32_t minimum[] = { 0, 0, 0x80, 0x800, 0x10000 };
+
+			std::uint8_t lead = src[i];
+			std::size_t count = 0;
+			std::uint32_t code_point = 0;
+
+			if (lead < 0xC0) {
+				return invalid_lead_byte;
+			} else if (lead < 0xE0) {
+				count = 2;
+				code_point = lead & 0x1F;
+			} else if (lead < 0xF0) {
+				count = 3;
+				code_point = lead & 0x0F;
+			} else if (lead < 0xF8) {
+				count = 4;
+				code_point = lead & 0x07;
+			} else {
+				return invalid_lead_byte;
+			}
+
+			for (std::size_t k = 1; k < count; ++k) {
+				if (i + k >= length) {
+					return truncated_sequence;
+				}
+
+				std::uint8_t byte = src[i + k];
+				if ((byte & 0xC0) != 0x80) {
+					return invalid_continuation;
+				}
+
+				code_point = (code_point << 6) | (byte & 0x3F);
+			}
+
+			if (code_point < minimum[count]) {
+				return overlong_encoding;
+			}
+
+			if (code_point >= 0xD800 && code_point <= 0xDFFF) {
+				return surrogate_code_point;
+			}
+
+			if (code_point > 0x10FFFF) {
+				return out_of_range;
+			}
+
+			written += put_code_point(code_point, dst + written);
+			i += count;
+
+			return none;
+		}
+
+		template <typename CharT>
+		static result_t from_utf8_scalar(const std::uint8_t* src, std::size_t length, CharT* dst, std::size_t i = 0, std::size_t written = 0) {
+			while (i < length) {
+				// eight ascii bytes at a time
+				if (i + 8 <= length) {
+					std::uint64_t word;
+					std::memcpy(&word, src + i, sizeof(word));
+
+					if ((word & 0x8080808080808080ull) == 0) {
+						for (std::size_t k = 0; k < 8; ++k) {
+							dst[written + k] = static_cast<CharT>(src[i + k]);
+						}
+
+						i += 8;
+						written += 8;
+						continue;
+					}
+				}
+
+				if (src[i] < 0x80) {
+					dst[written++] = static_cast<CharT>(src[i++]);
+					continue;
+				}
+
+				error_t error = decode_sequence(src, length, i, dst, written);
+				if (error != none) {
+					return { error, i, written };
+				}
+			}
+
+			return { none, length, written };
+		}
+
+#if defined(CPU_FEATURES_X86)
+		// widened stores may run past the ascii prefix, this is fine as long as dst holds at least `length` units
+		template <typename CharT>
+		static void widen_16(__m128i bytes, CharT* dst) {
+			const __m128i zero = _mm_setzero_si128();
+			__m128i lo = _mm_unpacklo_epi8(bytes, zero);
+			__m128i hi = _mm_unpackhi_epi8(bytes, zero);
+
+			if constexpr (sizeof(CharT) == 2) {
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(dst), lo);
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 8), hi);
+			} else {
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(dst), _mm_unpacklo_epi16(lo, zero));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 4), _mm_unpackhi_epi16(lo, zero));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 8), _mm_unpacklo_epi16(hi, zero));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 12), _mm_unpackhi_epi16(hi, zero));
+			}
+		}
+
+		template <typename CharT>
+		static result_t from_utf8_sse2(const std::uint8_t* src, std::size_t length, CharT* dst) {
+			std::size_t i = 0;
+			std::size_t written = 0;
+
+			while (i + 16 <= length) {
+				__m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+				std::uint32_t mask = static_cast<std::uint32_t>(_mm_movemask_epi8(bytes));
+
+				widen_16(bytes, dst + written);
+
+				if (mask == 0) {
+					i += 16;
+					written += 16;
+					continue;
+				}
+
+				std::uint32_t ascii_prefix = cpu_features::count_trailing_zeros(mask);
+				i += ascii_prefix;
+				written += ascii_prefix;
+
+				error_t error = decode_sequence(src, length, i, dst, written);
+				if (error != none) {
+					return { error, i, written };
+				}
+			}
+
+			return from_utf8_scalar(src, length, dst, i, written);
+		}
+
+		template <typename CharT>
+		CPU_FEATURES_TARGET_AVX2 static result_t from_utf8_avx2(const std::uint8_t* src, std::size_t length, CharT* dst) {
+			std::size_t i = 0;
+			std::size_t written = 0;
+
+			while (i + 32 <= length) {
+				__m256i bytes = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+				std::uint32_t mask = static_cast<std::uint32_t>(_mm256_movemask_epi8(bytes));
+
+				// zero extension keeps lanes in order, unlike the in-lane unpack instructions
+				if constexpr (sizeof(CharT) == 2) {
+					_mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + written), _mm256_cvtepu8_epi16(_mm256_castsi256_si128(bytes)));
+					_mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + written + 16), _mm256_cvtepu8_epi16(_mm256_extracti128_si256(bytes, 1)));
+				} else {
+					for (std::size_t k = 0; k < 32; k += 8) {
+						__m128i chunk = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(src + i + k));
+						_mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + written + k), _mm256_cvtepu8_epi32(chunk));
+					}
+				}
+
+				if (mask == 0) {
+					i += 32;
+					written += 32;
+					continue;
+				}
+
+				std::uint32_t ascii_prefix = cpu_features::count_trailing_zeros(mask);
+				i += ascii_prefix;
+				written += ascii_prefix;
+
+				error_t error = decode_sequence(src, length, i, dst, written);
+				if (error != none) {
+					_mm256_zeroupper();
+					return { error, i, written };
+				}
+			}
+
+			// gcc and clang emit no vzeroupper for target("avx2") functions, the sse code running next (malloc) would stall on the dirty upper halves
+			_mm256_zeroupper();
+			return from_utf8_scalar(src, length, dst, i, written);
+		}
+#endif
+
+		template <typename CharT>
+		using from_utf8_fn = result_t(*)(const std::uint8_t*, std::size_t, CharT*);
+
+		template <typename CharT>
+		static result_t from_utf8_scalar_entry(const std::uint8_t* src, std::size_t length, CharT* dst) {
+			return from_utf8_scalar(src, length, dst);
+		}
+
+		template <typename CharT>
+		static from_utf8_fn<CharT> select_from_utf8(void) {
+#if defined(CPU_FEATURES_X86)
+			const cpu_features::features_t& features = cpu_features::get();
+
+			if (features.avx2) {
+				return &from_utf8_avx2<CharT>;
+			}
+
+			if (features.sse2) {
+				return &from_utf8_sse2<CharT>;
+			}
+#endif
+			return &from_utf8_scalar_entry<CharT>;
+		}
+	}
+
+	// number of units from_utf8 produces for well formed input
+	template <typename CharT>
+	static std::size_t from_utf8_length(const char* src, std::size_t length) {
+		std::size_t units = 0;
+
+		for (std::size_t i = 0; i < length; ++i) {
+			std::uint8_t byte = static_cast<std::uint8_t>(src[i]);
+
+			// every non continuation byte starts a code point, four bytes sequences need a surrogate pair in utf-16
+			units += (byte & 0xC0) != 0x80;
+			units += sizeof(CharT) == 2 && byte >= 0xF0;
+		}
+
+		return units;
+	}
+
+	// number of bytes to_utf8 produces for well formed input
+	template <typename CharT>
+	static std::size_t to_utf8_length(const CharT* src, std::size_t length) {
+		typedef typename std::make_unsigned<CharT>::type unit_t;
+
+		std::size_t bytes = 0;
+
+		for (std::size_t i = 0; i < length; ++i) {
+			std::uint32_t unit = static_cast<unit_t>(src[i]);
+
+			if (unit < 0x80) {
+				bytes += 1;
+			} else if (unit < 0x800) {
+				bytes += 2;
+			} else if (sizeof(CharT) == 2 && unit >= 0xD800 && unit <= 0xDFFF) {
+				bytes += 2; // half of a four bytes sequence
+			} else if (unit < 0x10000) {
+				bytes += 3;
+			} else {
+				bytes += 4;
+			}
+		}
+
+		return bytes;
+	}
+
+	// decodes utf-8 into utf-16 (2 bytes units) or utf-32 (4 bytes units), dst must hold at least `length` units
+	template <typename CharT>
+	static result_t from_utf8(const char* src, std::size_t length, CharT* dst) {
+		static_assert(std::is_integral<CharT>::value && (sizeof(CharT) == 2 || sizeof(CharT) == 4), "utf::from_utf8 only produces 16 or 32 bits units");
+
+		static const detail::from_utf8_fn<CharT> fn = detail::select_from_utf8<CharT>();
+		return fn(reinterpret_cast<const std::uint8_t*>(src), length, dst);
+	}
+
+	// same as from_utf8 but never writes past the produced units, for destinations sized with from_utf8_length
+	template <typename CharT>
+	static result_t from_utf8_exact(const char* src, std::size_t length, CharT* dst) {
+		static_assert(std::is_integral<CharT>::value && (sizeof(CharT) == 2 || sizeof(CharT) == 4), "utf::from_utf8_exact only produces 16 or 32 bits units");
+
+		return detail::from_utf8_scalar(reinterpret_cast<const std::uint8_t*>(src), length, dst);
+	}
+	namespace detail {
+
+		// encodes the non ascii code point starting at src[i], advancing i and written on success
+		template <typename CharT>
+		static error_t encode_sequence(const CharT* src, std::size_t length, std::size_t& i, char* dst, std::size_t& written) {
+			typedef typename std::make_unsigned<CharT>::type unit_t;
+
+			std::uint32_t code_point = static_cast<unit_t>(src[i]);
+			std::size_t consumed = 1;
+
+			if constexpr (sizeof(CharT) == 2) {
+				if (code_point >= 0xDC00 && code_point <= 0xDFFF) {
+					return unpaired_surrogate;
+				}
+
+				if (code_point >= 0xD800 && code_point <= 0xDBFF) {
+					std::uint32_t low = i + 1 < length ? static_cast<unit_t>(src[i + 1]) : 0;
+					if (low < 0xDC00 || low > 0xDFFF) {
+						return unpaired_surrogate;
+					}
+
+					code_point = 0x10000 + ((code_point - 0xD800) << 10) + (low - 0xDC00);
+					consumed = 2;
+				}
+			} else {
+				if (code_point >= 0xD800 && code_point <= 0xDFFF) {
+					return surrogate_code_point;
+				}
+
+				if (code_point > 0x10FFFF) {
+					return out_of_range;
+				}
+			}
+
+			char* out = dst + written;
+
+			if (code_point < 0x80) {
+				out[0] = static_cast<char>(code_point);
+				written += 1;
+			} else if (code_point < 0x800) {
+				out[0] = static_cast<char>(0xC0 | (code_point >> 6));
+				out[1] = static_cast<char>(0x80 | (code_point & 0x3F));
+				written += 2;
+			} else if (code_point < 0x10000) {
+				out[0] = static_cast<char>(0xE0 | (code_point >> 12));
+				out[1] = static_cast<char>(0x80 | ((code_point >> 6) & 0x3F));
+				out[2] = static_cast<char>(0x80 | (code_point & 0x3F));
+				written += 3;
+			} else {
+				out[0] = static_cast<char>(0xF0 | (code_point >> 18));
+				out[1] = static_cast<char>(0x80 | ((code_point >> 12) & 0x3F));
+				out[2] = static_cast<char>(0x80 | ((code_point >> 6) & 0x3F));
+				out[3] = static_cast<char>(0x80 | (code_point & 0x3F));
+				written += 4;
+			}
+
+			i += consumed;
+
+			return none;
+		}
+
+		template <typename CharT>
+		static result_t to_utf8_scalar(const CharT* src, std::size_t length, char* dst, std::size_t i = 0, std::size_t written = 0) {
+			typedef typename std::make_unsigned<CharT>::type unit_t;
+
+			while (i < length) {
+				if (static_cast<unit_t>(src[i]) < 0x80) {
+					dst[written++] = static_cast<char>(src[i++]);
+					continue;
+				}
+
+				error_t error = encode_sequence(src, length, i, dst, written);
+				if (error != none) {
+					return { error, i, written };
+				}
+			}
+
+			return { none, length, written };
+		}
+
+#if defined(CPU_FEATURES_X86)
+		// narrows 16 units to bytes, bit n of the returned mask is set when unit n is not ascii
+		template <typename CharT>
+		static std::uint32_t narrow_16(const CharT* src, __m128i& bytes) {
+			const __m128i zero = _mm_setzero_si128();
+
+			if constexpr (sizeof(CharT) == 2) {
+				const __m128i high_bits = _mm_set1_epi16(static_cast<short>(0xFF80));
+				__m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+				__m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 8));
+
+				__m128i ascii = _mm_packs_epi16(_mm_cmpeq_epi16(_mm_and_si128(a, high_bits), zero), _mm_cmpeq_epi16(_mm_and_si128(b, high_bits), zero));
+				bytes = _mm_packus_epi16(a, b);
+
+				return ~static_cast<std::uint32_t>(_mm_movemask_epi8(ascii)) & 0xFFFF;
+			} else {
+				const __m128i high_bits = _mm_set1_epi32(static_cast<int>(0xFFFFFF80));
+				__m128i v[4];
+				__m128i ascii[4];
+
+				for (int k = 0; k < 4; ++k) {
+					v[k] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + k * 4));
+					ascii[k] = _mm_cmpeq_epi32(_mm_and_si128(v[k], high_bits), zero);
+				}
+
+				__m128i ascii_bytes = _mm_packs_epi16(_mm_packs_epi32(ascii[0], ascii[1]), _mm_packs_epi32(ascii[2], ascii[3]));
+				bytes = _mm_packus_epi16(_mm_packs_epi32(v[0], v[1]), _mm_packs_epi32(v[2], v[3]));
+
+				return ~static_cast<std::uint32_t>(_mm_movemask_epi8(ascii_bytes)) & 0xFFFF;
+			}
+		}
+
+		template <typename CharT>
+		static result_t to_utf8_sse2(const CharT* src, std::size_t length, char* dst) {
+			std::size_t i = 0;
+			std::size_t written = 0;
+
+			while (i + 16 <= length) {
+				__m128i bytes;
+				std::uint32_t mask = narrow_16(src + i, bytes);
+
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(dst + written), bytes);
+
+				if (mask == 0) {
+					i += 16;
+					written += 16;
+					continue;
+				}
+
+				std::uint32_t ascii_prefix = cpu_features::count_trailing_zeros(mask);
+				i += ascii_prefix;
+				written += ascii_prefix;
+
+				error_t error = encode_sequence(src, length, i, dst, written);
+				if (error != none) {
+					return { error, i, written };
+				}
+			}
+
+			return to_utf8_scalar(src, length, dst, i, written);
+		}
+
+		// utf-16 only, utf-32 input goes through the sse2 kernel
+		template <typename CharT>
+		CPU_FEATURES_TARGET_AVX2 static result_t to_utf8_avx2(const CharT* src, std::size_t length, char* dst) {
+			const __m256i zero = _mm256_setzero_si256();
+			const __m256i high_bits = _mm256_set1_epi16(static_cast<short>(0xFF80));
+
+			std::size_t i = 0;
+			std::size_t written = 0;
+
+			while (i + 32 <= length) {
+				__m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+				__m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i + 16));
+
+				// packs work per 128 bits lane, the permute puts the four quarters back in source order
+				__m256i ascii = _mm256_packs_epi16(_mm256_cmpeq_epi16(_mm256_and_si256(a, high_bits), zero), _mm256_cmpeq_epi16(_mm256_and_si256(b, high_bits), zero));
+				ascii = _mm256_permute4x64_epi64(ascii, 0xD8);
+				__m256i bytes = _mm256_permute4x64_epi64(_mm256_packus_epi16(a, b), 0xD8);
+
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + written), bytes);
+
+				std::uint32_t mask = ~static_cast<std::uint32_t>(_mm256_movemask_epi8(ascii));
+
+				if (mask == 0) {
+					i += 32;
+					written += 32;
+					continue;
+				}
+
+				std::uint32_t ascii_prefix = cpu_features::count_trailing_zeros(mask);
+				i += ascii_prefix;
+				written += ascii_prefix;
+
+				error_t error = encode_sequence(src, length, i, dst, written);
+				if (error != none) {
+					_mm256_zeroupper();
+					return { error, i, written };
+				}
+			}
+
+			// no implicit vzeroupper, see from_utf8_avx2
+			_mm256_zeroupper();
+			return to_utf8_scalar(src, length, dst, i, written);
+		}
+#endif
+
+		template <typename CharT>
+		using to_utf8_fn = result_t(*)(const CharT*, std::size_t, char*);
+
+		template <typename CharT>
+		static result_t to_utf8_scalar_entry(const CharT* src, std::size_t length, char* dst) {
+			return to_utf8_scalar(src, length, dst);
+		}
+
+		template <typename CharT>
+		static to_utf8_fn<CharT> select_to_utf8(void) {
+#if defined(CPU_FEATURES_X86)
+			const cpu_features::features_t& features = cpu_features::get();
+
+			if constexpr (sizeof(CharT) == 2) {
+				if (features.avx2) {
+					return &to_utf8_avx2<CharT>;
+				}
+			}
+
+			if (features.sse2) {
+				return &to_utf8_sse2<CharT>;
+			}
+#endif
+			return &to_utf8_scalar_entry<CharT>;
+		}
+	}
+
+	// worst case utf-8 size for `length` wide units
+	template <typename CharT>
+	constexpr std::size_t max_utf8_length(std::size_t length) {
+		return length * (sizeof(CharT) == 2 ? 3 : 4);
+	}
+
+	// encodes utf-16 (2 bytes units) or utf-32 (4 bytes units) into utf-8, dst must hold max_utf8_length<CharT>(length) bytes
+	template <typename CharT>
+	static result_t to_utf8(const CharT* src, std::size_t length, char* dst) {
+		static_assert(std::is_integral<CharT>::value && (sizeof(CharT) == 2 || sizeof(CharT) == 4), "utf::to_utf8 only consumes 16 or 32 bits units");
+
+		static const detail::to_utf8_fn<CharT> fn = detail::select_to_utf8<CharT>();
+		return fn(src, length, dst);
+	}
+
+	// same as to_utf8 but never writes past the produced bytes, for destinations sized with to_utf8_length
+	template <typename CharT>
+	static result_t to_utf8_exact(const CharT* src, std::size_t length, char* dst) {
+		static_assert(std::is_integral<CharT>::value && (sizeof(CharT) == 2 || sizeof(CharT) == 4), "utf::to_utf8_exact only consumes 16 or 32 bits units");
+
+		return detail::to_utf8_scalar(src, length, dst);
+	}
+}
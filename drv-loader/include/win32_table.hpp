@@ -0,0 +1,195 @@
+#pragma once
+
+// generated by tools/gen_status_table.py from winerror_subset.h, do not edit
+// 75 entries, 75 distinct codes
+
+#include <cstdint>
+
+#include "status_table.hpp"
+
+namespace win32_table {
+
+	namespace detail {
+
+		constexpr const char page_0[] =
+			"ERROR_SUCCESSThe operation completed successfully.ERROR_INVALID_FUNCTIONIncorrect function.ERROR_FILE_NOT_FOUNDThe system cannot find the file specified."
+			"ERROR_PATH_NOT_FOUNDThe system cannot find the path specified.ERROR_TOO_MANY_OPEN_FILESThe system cannot open the file.ERROR_ACCESS_DENIED"
+			"Access is denied.ERROR_INVALID_HANDLEThe handle is invalid.ERROR_NOT_ENOUGH_MEMORYNot enough memory resources are available to process this command."
+			"ERROR_BAD_FORMATAn attempt was made to load a program with an incorrect format.ERROR_INVALID_DATAThe data is invalid.ERROR_NOT_SAME_DEVICE"
+			"The system cannot move the file to a different disk drive.ERROR_NO_MORE_FILESThere are no more files.ERROR_WRITE_PROTECT"
+			"The media is write protected.ERROR_NOT_READYThe device is not ready.ERROR_BAD_COMMANDThe device does not recognize the command."
+			"ERROR_BAD_LENGTHThe program issued a command but the command length is incorrect.ERROR_GEN_FAILUREA device attached to the system is not functioning."
+			"ERROR_SHARING_VIOLATIONThe process cannot access the file because it is being used by another process.ERROR_LOCK_VIOLATION"
+			"The process cannot access the file because another process has locked a portion of the file.ERROR_HANDLE_EOFReached the end of the file."
+			"ERROR_NOT_SUPPORTEDThe request is not supported.ERROR_BAD_NETPATHThe network path was not found.ERROR_DEV_NOT_EXISTThe specified network resource or device is no longer available."
+			"ERROR_INVALID_PARAMETERThe parameter is incorrect.ERROR_BROKEN_PIPEThe pipe has been ended.ERROR_DISK_FULLThere is not enough space on the disk."
+			"ERROR_SEM_TIMEOUTThe semaphore timeout period has expired.ERROR_INSUFFICIENT_BUFFERThe data area passed to a system call is too small."
+			"ERROR_INVALID_NAMEThe filename, directory name, or volume label syntax is incorrect.ERROR_MOD_NOT_FOUNDThe specified module could not be found."
+			"ERROR_PROC_NOT_FOUNDThe specified procedure could not be found.ERROR_BAD_PATHNAMEThe specified path is invalid.ERROR_BUSY"
+			"The requested resource is in use.ERROR_INVALID_ORDINALThe operating system cannot run %1.ERROR_ALREADY_EXISTSCannot create a file when that file already exists."
+			"ERROR_BAD_EXE_FORMAT%1 is not a valid Win32 application.ERROR_FILENAME_EXCED_RANGEThe filename or extension is too long."
+			"ERROR_EXE_MACHINE_TYPE_MISMATCHThe image file %1 is valid, but is for a machine type other than the current machine.ERROR_MORE_DATA"
+			"More data is available.WAIT_TIMEOUTThe wait operation timed out.ERROR_NO_MORE_ITEMSNo more data is available.ERROR_DIRECTORY"
+			"The directory name is invalid.ERROR_MR_MID_NOT_FOUNDThe system cannot find message text for message number 0x%1 in the message file for %2."
+			"ERROR_INVALID_ADDRESSAttempt to access invalid address.ERROR_ARITHMETIC_OVERFLOWArithmetic result exceeded 32 bits.ERROR_INVALID_IMAGE_HASH"
+			"Windows cannot verify the digital signature for this file. A recent hardware or software change might have installed a file that is signed incorrectly or damaged, or that might be malicious software from an unknown source."
+			"ERROR_IMAGE_NOT_AT_BASE{Image Relocated} An image file could not be mapped at the address specified in the image file. Local fixups must be performed on this image."
+			"ERROR_IMAGE_MACHINE_TYPE_MISMATCH{Machine Type Mismatch} The image file %hs is valid, but is for a machine type other than the current machine. Select OK to continue, or CANCEL to fail the DLL load."
+			"ERROR_OPERATION_ABORTEDThe I/O operation has been aborted because of either a thread exit or an application request.ERROR_IO_PENDING"
+			"Overlapped I/O operation is in progress.ERROR_NOACCESSInvalid access to memory location.ERROR_FILE_INVALIDThe volume for a file has been externally altered so that the opened file is no longer valid."
+			"ERROR_NO_TOKENAn attempt was made to reference a token that does not exist.ERROR_BADDBThe configuration registry database is corrupt."
+			"ERROR_BADKEYThe configuration registry key is invalid.ERROR_CANTOPENThe configuration registry key could not be opened.ERROR_CANTREAD"
+			"The configuration registry key could not be read.ERROR_CANTWRITEThe configuration registry key could not be written.ERROR_REGISTRY_IO_FAILED"
+			"An I/O operation initiated by the registry failed unrecoverably. The registry could not read in, or write out, or flush, one of the files that contain the system's image of the registry."
+			"ERROR_KEY_DELETEDIllegal operation attempted on a registry key that has been marked for deletion.ERROR_CHILD_MUST_BE_VOLATILE"
+			"Cannot create a stable subkey under a volatile parent key.ERROR_DEPENDENT_SERVICES_RUNNINGA stop control has been sent to a service that other running services are dependent on."
+			"ERROR_SERVICE_ALREADY_RUNNINGAn instance of the service is already running.ERROR_SERVICE_DOES_NOT_EXISTThe specified service does not exist as an installed service."
+			"ERROR_SERVICE_DEPENDENCY_FAILThe dependency service or group failed to start.ERROR_SERVICE_MARKED_FOR_DELETEThe specified service has been marked for deletion."
+			"ERROR_NO_UNICODE_TRANSLATIONNo mapping for the Unicode character exists in the target multi-byte code page.ERROR_NOT_FOUND"
+			"Element not found.ERROR_DRIVER_BLOCKEDThis driver has been blocked from loadingERROR_NOT_ALL_ASSIGNEDNot all privileges or groups referenced are assigned to the caller."
+			"ERROR_NO_SUCH_PRIVILEGEA specified privilege does not exist.ERROR_PRIVILEGE_NOT_HELDA required privilege is not held by the client."
+			"ERROR_BAD_IMPERSONATION_LEVELEither a required impersonation level was not provided, or the provided impersonation level is invalid."
+			"ERROR_NO_SYSTEM_RESOURCESInsufficient system resources exist to complete the requested service.ERROR_INVALID_OPERATIONThe operation identifier is not valid."
+			"";
+
+		constexpr const char* pages[1] = { page_0 };
+
+		constexpr status_table::entry_t entries[75] = {
+			{ 0x00000000, 0x000000, 0x00000D, 13, 37 }, // ERROR_SUCCESS
+			{ 0x00000001, 0x000032, 0x000048, 22, 19 }, // ERROR_INVALID_FUNCTION
+			{ 0x00000002, 0x00005B, 0x00006F, 20, 42 }, // ERROR_FILE_NOT_FOUND
+			{ 0x00000003, 0x000099, 0x0000AD, 20, 42 }, // ERROR_PATH_NOT_FOUND
+			{ 0x00000004, 0x0000D7, 0x0000F0, 25, 32 }, // ERROR_TOO_MANY_OPEN_FILES
+			{ 0x00000005, 0x000110, 0x000123, 19, 17 }, // ERROR_ACCESS_DENIED
+			{ 0x00000006, 0x000134, 0x000148, 20, 22 }, // ERROR_INVALID_HANDLE
+			{ 0x00000008, 0x00015E, 0x000175, 23, 66 }, // ERROR_NOT_ENOUGH_MEMORY
+			{ 0x0000000B, 0x0001B7, 0x0001C7, 16, 63 }, // ERROR_BAD_FORMAT
+			{ 0x0000000D, 0x000206, 0x000218, 18, 20 }, // ERROR_INVALID_DATA
+			{ 0x00000011, 0x00022C, 0x000241, 21, 58 }, // ERROR_NOT_SAME_DEVICE
+			{ 0x00000012, 0x00027B, 0x00028E, 19, 24 }, // ERROR_NO_MORE_FILES
+			{ 0x00000013, 0x0002A6, 0x0002B9, 19, 29 }, // ERROR_WRITE_PROTECT
+			{ 0x00000015, 0x0002D6, 0x0002E5, 15, 24 }, // ERROR_NOT_READY
+			{ 0x00000016, 0x0002FD, 0x00030E, 17, 42 }, // ERROR_BAD_COMMAND
+			{ 0x00000018, 0x000338, 0x000348, 16, 65 }, // ERROR_BAD_LENGTH
+			{ 0x0000001F, 0x000389, 0x00039A, 17, 51 }, // ERROR_GEN_FAILURE
+			{ 0x00000020, 0x0003CD, 0x0003E4, 23, 79 }, // ERROR_SHARING_VIOLATION
+			{ 0x00000021, 0x000433, 0x000447, 20, 92 }, // ERROR_LOCK_VIOLATION
+			{ 0x00000026, 0x0004A3, 0x0004B3, 16, 28 }, // ERROR_HANDLE_EOF
+			{ 0x00000032, 0x0004CF, 0x0004E2, 19, 29 }, // ERROR_NOT_SUPPORTED
+			{ 0x00000035, 0x0004FF, 0x000510, 17, 31 }, // ERROR_BAD_NETPATH
+			{ 0x00000037, 0x00052F, 0x000542, 19, 64 }, // ERROR_DEV_NOT_EXIST
+			{ 0x00000057, 0x000582, 0x000599, 23, 27 }, // ERROR_INVALID_PARAMETER
+			{ 0x0000006D, 0x0005B4, 0x0005C5, 17, 24 }, // ERROR_BROKEN_PIPE
+			{ 0x00000070, 0x0005DD, 0x0005EC, 15, 38 }, // ERROR_DISK_FULL
+			{ 0x00000079, 0x000612, 0x000623, 17, 41 }, // ERROR_SEM_TIMEOUT
+			{ 0x0000007A, 0x00064C, 0x000665, 25, 51 }, // ERROR_INSUFFICIENT_BUFFER
+			{ 0x0000007B, 0x000698, 0x0006AA, 18, 66 }, // ERROR_INVALID_NAME
+			{ 0x0000007E, 0x0006EC, 0x0006FF, 19, 40 }, // ERROR_MOD_NOT_FOUND
+			{ 0x0000007F, 0x000727, 0x00073B, 20, 43 }, // ERROR_PROC_NOT_FOUND
+			{ 0x000000A1, 0x000766, 0x000778, 18, 30 }, // ERROR_BAD_PATHNAME
+			{ 0x000000AA, 0x000796, 0x0007A0, 10, 33 }, // ERROR_BUSY
+			{ 0x000000B6, 0x0007C1, 0x0007D6, 21, 35 }, // ERROR_INVALID_ORDINAL
+			{ 0x000000B7, 0x0007F9, 0x00080D, 20, 51 }, // ERROR_ALREADY_EXISTS
+			{ 0x000000C1, 0x000840, 0x000854, 20, 36 }, // ERROR_BAD_EXE_FORMAT
+			{ 0x000000CE, 0x000878, 0x000892, 26, 38 }, // ERROR_FILENAME_EXCED_RANGE
+			{ 0x000000D8, 0x0008B8, 0x0008D7, 31, 85 }, // ERROR_EXE_MACHINE_TYPE_MISMATCH
+			{ 0x000000EA, 0x00092C, 0x00093B, 15, 23 }, // ERROR_MORE_DATA
+			{ 0x00000102, 0x000952, 0x00095E, 12, 29 }, // WAIT_TIMEOUT
+			{ 0x00000103, 0x00097B, 0x00098E, 19, 26 }, // ERROR_NO_MORE_ITEMS
+			{ 0x0000010B, 0x0009A8, 0x0009B7, 15, 30 }, // ERROR_DIRECTORY
+			{ 0x0000013D, 0x0009D5, 0x0009EB, 22, 87 }, // ERROR_MR_MID_NOT_FOUND
+			{ 0x000001E7, 0x000A42, 0x000A57, 21, 34 }, // ERROR_INVALID_ADDRESS
+			{ 0x00000216, 0x000A79, 0x000A92, 25, 35 }, // ERROR_ARITHMETIC_OVERFLOW
+			{ 0x00000241, 0x000AB5, 0x000ACD, 24, 222 }, // ERROR_INVALID_IMAGE_HASH
+			{ 0x000002BC, 0x000BAB, 0x000BC2, 23, 141 }, // ERROR_IMAGE_NOT_AT_BASE
+			{ 0x000002C2, 0x000C4F, 0x000C70, 33, 165 }, // ERROR_IMAGE_MACHINE_TYPE_MISMATCH
+			{ 0x000003E3, 0x000D15, 0x000D2C, 23, 93 }, // ERROR_OPERATION_ABORTED
+			{ 0x000003E5, 0x000D89, 0x000D99, 16, 40 }, // ERROR_IO_PENDING
+			{ 0x000003E6, 0x000DC1, 0x000DCF, 14, 34 }, // ERROR_NOACCESS
+			{ 0x000003EE, 0x000DF1, 0x000E03, 18, 93 }, // ERROR_FILE_INVALID
+			{ 0x000003F0, 0x000E60, 0x000E6E, 14, 61 }, // ERROR_NO_TOKEN
+			{ 0x000003F1, 0x000EAB, 0x000EB6, 11, 47 }, // ERROR_BADDB
+			{ 0x000003F2, 0x000EE5, 0x000EF1, 12, 42 }, // ERROR_BADKEY
+			{ 0x000003F3, 0x000F1B, 0x000F29, 14, 51 }, // ERROR_CANTOPEN
+			{ 0x000003F4, 0x000F5C, 0x000F6A, 14, 49 }, // ERROR_CANTREAD
+			{ 0x000003F5, 0x000F9B, 0x000FAA, 15, 52 }, // ERROR_CANTWRITE
+			{ 0x000003F8, 0x000FDE, 0x000FF6, 24, 186 }, // ERROR_REGISTRY_IO_FAILED
+			{ 0x000003FA, 0x0010B0, 0x0010C1, 17, 80 }, // ERROR_KEY_DELETED
+			{ 0x000003FD, 0x001111, 0x00112D, 28, 58 }, // ERROR_CHILD_MUST_BE_VOLATILE
+			{ 0x0000041B, 0x001167, 0x001187, 32, 87 }, // ERROR_DEPENDENT_SERVICES_RUNNING
+			{ 0x00000420, 0x0011DE, 0x0011FB, 29, 46 }, // ERROR_SERVICE_ALREADY_RUNNING
+			{ 0x00000424, 0x001229, 0x001245, 28, 61 }, // ERROR_SERVICE_DOES_NOT_EXIST
+			{ 0x0000042C, 0x001282, 0x00129F, 29, 48 }, // ERROR_SERVICE_DEPENDENCY_FAIL
+			{ 0x00000430, 0x0012CF, 0x0012EE, 31, 51 }, // ERROR_SERVICE_MARKED_FOR_DELETE
+			{ 0x00000459, 0x001321, 0x00133D, 28, 79 }, // ERROR_NO_UNICODE_TRANSLATION
+			{ 0x00000490, 0x00138C, 0x00139B, 15, 18 }, // ERROR_NOT_FOUND
+			{ 0x000004FB, 0x0013AD, 0x0013C1, 20, 41 }, // ERROR_DRIVER_BLOCKED
+			{ 0x00000514, 0x0013EA, 0x001400, 22, 67 }, // ERROR_NOT_ALL_ASSIGNED
+			{ 0x00000521, 0x001443, 0x00145A, 23, 37 }, // ERROR_NO_SUCH_PRIVILEGE
+			{ 0x00000522, 0x00147F, 0x001497, 24, 47 }, // ERROR_PRIVILEGE_NOT_HELD
+			{ 0x00000542, 0x0014C6, 0x0014E3, 29, 103 }, // ERROR_BAD_IMPERSONATION_LEVEL
+			{ 0x000005AA, 0x00154A, 0x001563, 25, 70 }, // ERROR_NO_SYSTEM_RESOURCES
+			{ 0x000010DD, 0x0015A9, 0x0015C0, 23, 38 }, // ERROR_INVALID_OPERATION
+		};
+
+		constexpr std::uint16_t code_seeds[32] = {
+			0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0000, 0x0000, 0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002,
+			0x0000, 0x0000, 0x0000, 0x0002, 0x0000, 0x0000, 0x0000, 0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001,
+		};
+
+		constexpr std::uint16_t code_slots[256] = {
+			0x0000, 0xFFFF, 0x0017, 0xFFFF, 0x0008, 0xFFFF, 0x0002, 0xFFFF, 0x0006, 0x0033, 0xFFFF, 0x0007, 0x001C, 0xFFFF, 0xFFFF, 0xFFFF,
+			0xFFFF, 0xFFFF, 0x0047, 0xFFFF, 0x000C, 0xFFFF, 0xFFFF, 0x000B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x003C, 0xFFFF, 0xFFFF,
+			0x0018, 0xFFFF, 0xFFFF, 0x0045, 0xFFFF, 0x0035, 0xFFFF, 0x0003, 0xFFFF, 0x001A, 0xFFFF, 0x0037, 0xFFFF, 0xFFFF, 0xFFFF, 0x003E,
+			0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x002C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+			0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0044, 0xFFFF, 0xFFFF, 0x0004, 0xFFFF, 0x002E, 0xFFFF, 0xFFFF, 0x0040, 0xFFFF, 0xFFFF,
+			0x0027, 0xFFFF, 0xFFFF, 0x0021, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0010, 0xFFFF, 0x003A, 0x002A, 0xFFFF,
+			0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x000D, 0xFFFF, 0xFFFF, 0x0025, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+			0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0011, 0xFFFF, 0x001D, 0xFFFF, 0xFFFF, 0x0022, 0xFFFF, 0xFFFF,
+			0x0029, 0x0015, 0x0038, 0x0049, 0x0014, 0x0012, 0xFFFF, 0xFFFF, 0xFFFF, 0x0030, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+			0x003F, 0xFFFF, 0x0009, 0xFFFF, 0x000E, 0xFFFF, 0x0020, 0xFFFF, 0xFFFF, 0xFFFF, 0x004A, 0xFFFF, 0x002F, 0xFFFF, 0x0039, 0xFFFF,
+			0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0043, 0xFFFF, 0xFFFF, 0x001E, 0xFFFF, 0x003D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0046,
+			0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0028, 0xFFFF, 0xFFFF, 0x0001, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0032,
+			0x000F, 0xFFFF, 0xFFFF, 0x001B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0042, 0xFFFF, 0xFFFF, 0x0005, 0xFFFF, 0x0016,
+			0xFFFF, 0x0026, 0xFFFF, 0xFFFF, 0x0048, 0xFFFF, 0x003B, 0x0019, 0x0034, 0xFFFF, 0xFFFF, 0xFFFF, 0x0023, 0xFFFF, 0xFFFF, 0xFFFF,
+			0xFFFF, 0xFFFF, 0xFFFF, 0x002D, 0xFFFF, 0xFFFF, 0x0036, 0xFFFF, 0x000A, 0x0041, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0031,
+			0xFFFF, 0x0013, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x002B, 0xFFFF, 0xFFFF, 0x001F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0024,
+		};
+
+		constexpr std::uint16_t name_seeds[32] = {
+			0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0000, 0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0003, 0x0003,
+			0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0000, 0x0003, 0x0000, 0x0001, 0x0000, 0x0000,
+		};
+
+		constexpr std::uint16_t name_slots[256] = {
+			0x003C, 0x0001, 0xFFFF, 0x0043, 0xFFFF, 0x0027, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x002F, 0x0030, 0xFFFF, 0xFFFF, 0x0031, 0xFFFF,
+			0xFFFF, 0x000F, 0x0009, 0xFFFF, 0x0017, 0xFFFF, 0x0011, 0xFFFF, 0xFFFF, 0xFFFF, 0x003F, 0x0037, 0xFFFF, 0x001C, 0xFFFF, 0xFFFF,
+			0x0034, 0xFFFF, 0xFFFF, 0xFFFF, 0x002A, 0x0048, 0x0015, 0x0036, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+			0x0004, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x004A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x001B, 0x002C, 0xFFFF, 0xFFFF,
+			0xFFFF, 0x0016, 0x0002, 0x0042, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0003, 0xFFFF, 0xFFFF, 0xFFFF,
+			0x000E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+			0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0035, 0xFFFF, 0xFFFF, 0x0032, 0xFFFF,
+			0x001D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0013, 0x003B, 0xFFFF, 0xFFFF, 0x0040, 0x001E, 0x0026, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+			0xFFFF, 0xFFFF, 0x0018, 0xFFFF, 0xFFFF, 0xFFFF, 0x0006, 0x0033, 0x000A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0012, 0x0044, 0xFFFF,
+			0x0046, 0xFFFF, 0x002D, 0xFFFF, 0x000D, 0xFFFF, 0xFFFF, 0xFFFF, 0x0007, 0xFFFF, 0x0023, 0xFFFF, 0xFFFF, 0x000B, 0xFFFF, 0x0029,
+			0xFFFF, 0x0019, 0x001A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0049, 0x0024, 0xFFFF,
+			0xFFFF, 0x0038, 0xFFFF, 0xFFFF, 0xFFFF, 0x000C, 0xFFFF, 0x0000, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x003E, 0x003D,
+			0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0047, 0xFFFF, 0xFFFF, 0x002E, 0xFFFF, 0xFFFF, 0xFFFF, 0x0020, 0xFFFF, 0xFFFF,
+			0x003A, 0xFFFF, 0xFFFF, 0xFFFF, 0x002B, 0x0021, 0x0014, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0025, 0xFFFF,
+			0xFFFF, 0xFFFF, 0x0022, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0028, 0xFFFF, 0xFFFF, 0x0005, 0xFFFF, 0xFFFF, 0xFFFF,
+			0x0045, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0041, 0x0010, 0x0008, 0x0039, 0x001F,
+		};
+
+	}
+
+	constexpr status_table::table_t table = {
+		detail::entries,
+		75,
+		detail::pages,
+		{ detail::code_seeds, 5, detail::code_slots, 0xFF },
+		{ detail::name_seeds, 5, detail::name_slots, 0xFF },
+	};
+
+	static_assert(status_table::verify_codes(table, 0, 128), "win32_table: code hash does not reach every entry");
+	static_assert(status_table::verify_names(table, 0, 128), "win32_table: name hash does not reach every entry");
+}
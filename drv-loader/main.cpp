@@ -1,20 +1,219 @@
 #include "include/clara.hpp"
 #include "include/drv-loader.hpp"
+#include "include/logger.hpp"
+#include "include/manifest.hpp"
+#include "include/modules.hpp"
+#include "include/ntstatus_table.hpp"
+#include "include/pe.hpp"
+#include "include/platform.hpp"
+#include "include/scheduler.hpp"
+#include "include/simulated_kernel.hpp"
 
-#include <iostream>
+#include <charconv>
+#include <chrono>
+#include <cstdio>
+#include <sstream>
+#include <string_view>
+#include <thread>
+#include <vector>
 
-#define NOMINMAX
-#include <windows.h>
+// p50/p90/p99/max of every phase that ran, in microseconds
+static void print_phase_stats(void) {
+    logger::info_line("[*] Phase latencies (us): count p50 p90 p99 max");
 
-static std::uint32_t print_last_error(void) {
-    std::uint32_t last_error_code = ::GetLastError();
-    std::cerr << "[!] Failed with last error " << last_error_code << std::endl;
+    for (std::size_t i = 0; i < drv_loader::n_phase; ++i) {
+        drv_loader::phase_t phase = static_cast<drv_loader::phase_t>(i);
+        const drv_loader::phase_histogram_t& histogram = drv_loader::phase_histogram(phase);
 
-    return last_error_code;
+        if (histogram.count() == 0) {
+            continue;
+        }
+
+        logger::info_line("    ", drv_loader::phase_name(phase), " ", histogram.count(),
+            " ", histogram.value_at_percentile(50.0) / 1000,
+            " ", histogram.value_at_percentile(90.0) / 1000,
+            " ", histogram.value_at_percentile(99.0) / 1000,
+            " ", histogram.max() / 1000);
+    }
+}
+
+// comma separated NTSTATUS names (STATUS_IMAGE_ALREADY_LOADED) or hexadecimal values (0xC000010E)
+static bool parse_statuses(const std::string& list, std::vector<std::uint32_t>& out) {
+    std::size_t begin = 0;
+
+    while (begin <= list.size()) {
+        std::size_t end = list.find(',', begin);
+        end = end == std::string::npos ? list.size() : end;
+
+        std::string_view token(list.data() + begin, end - begin);
+        const status_table::entry_t* status = status_table::find_name(ntstatus_table::table, token);
+
+        if (status != nullptr) {
+            out.push_back(status->value);
+        } else {
+            hex::parse_result_t<std::uint32_t> value = hex::parse<std::uint32_t>(token.data(), token.size());
+            if (value.error != hex::none) {
+                return false;
+            }
+
+            out.push_back(value.value);
+        }
+
+        begin = end + 1;
+    }
+
+    return true;
+}
+
+// comma separated "<display name>=<microseconds>" pairs, applied to the simulated kernel
+static bool parse_driver_latencies(const std::string& list) {
+    std::size_t begin = 0;
+
+    while (begin <= list.size()) {
+        std::size_t end = list.find(',', begin);
+        end = end == std::string::npos ? list.size() : end;
+
+        std::size_t separator = list.find('=', begin);
+        if (separator == std::string::npos || separator >= end || separator == begin) {
+            return false;
+        }
+
+        std::uint32_t latency = 0;
+        std::from_chars_result res = std::from_chars(list.data() + separator + 1, list.data() + end, latency);
+        if (res.ec != std::errc() || res.ptr != list.data() + end) {
+            return false;
+        }
+
+        simulated::kernel::instance().set_driver_latency(list.substr(begin, separator - begin).c_str(), std::chrono::microseconds(latency));
+        begin = end + 1;
+    }
+
+    return true;
+}
+
+// one line per manifest entry with its start offset and duration in microseconds, returns the number of failed entries
+// what the message of a failure is about: the driver file, or the service when the entry has no path
+static std::string_view error_subject(const drv_loader::config_t& config) {
+    return config.file_path.empty() ? config.display_name : config.file_path;
+}
+
+static std::size_t print_batch_results(const std::vector<drv_loader::config_t>& configs, const std::vector<scheduler::node_result_t>& results) {
+    std::size_t failures = 0;
+
+    for (std::size_t i = 0; i < results.size(); ++i) {
+        const char* operation = drv_loader::operation_name(configs[i].operation);
+
+        if (results[i].skipped) {
+            drv_loader::error_text_t text;
+            drv_loader::format_error(results[i].error, text, error_subject(configs[i]));
+            logger::error_line("[!] ", operation, " ", configs[i].display_name, " skipped: ", std::string_view(text.c_str(), text.size()));
+            ++failures;
+        } else if (results[i].error.failed()) {
+            drv_loader::error_text_t text;
+            drv_loader::format_error(results[i].error, text, error_subject(configs[i]));
+            logger::error_line("[!] ", operation, " ", configs[i].display_name, " (+", results[i].start / 1000, " us, ", results[i].duration / 1000, " us, ", results[i].report.retries, " retries): ", std::string_view(text.c_str(), text.size()));
+
+            if (results[i].report.image_error != pe::none) {
+                logger::error_line("    image rejected: ", pe::error_name(results[i].report.image_error));
+            }
+
+            ++failures;
+        } else if (results[i].report.unchanged) {
+            logger::info_line("[+] ", operation, " ", configs[i].display_name, " (+", results[i].start / 1000, " us, ", results[i].duration / 1000, " us): already loaded, unchanged");
+        } else {
+            logger::info_line("[+] ", operation, " ", configs[i].display_name, " (+", results[i].start / 1000, " us, ", results[i].duration / 1000, " us, ", results[i].report.retries, " retries)");
+        }
+    }
+
+    return failures;
+}
+
+static drv_loader::loader_error_t read_blob(const std::string& path, std::vector<std::uint8_t>& blob) {
+    std::FILE* file = std::fopen(path.c_str(), "rb");
+    if (file == nullptr) {
+        return drv_loader::win32_error(drv_loader::phase_query_modules, platform::last_error());
+    }
+
+    std::uint8_t chunk[0x10000];
+    std::size_t read = 0;
+
+    blob.clear();
+    while ((read = std::fread(chunk, 1, sizeof(chunk), file)) != 0) {
+        blob.insert(blob.end(), chunk, chunk + read);
+    }
+
+    bool failed = std::ferror(file) != 0;
+    std::fclose(file);
+
+    return failed ? drv_loader::win32_error(drv_loader::phase_query_modules, ERROR_GEN_FAILURE) : drv_loader::success();
+}
+
+static bool write_blob(const std::string& path, const std::vector<std::uint8_t>& blob) {
+    std::FILE* file = std::fopen(path.c_str(), "wb");
+    if (file == nullptr) {
+        return false;
+    }
+
+    bool written = std::fwrite(blob.data(), 1, blob.size(), file) == blob.size();
+    return std::fclose(file) == 0 && written;
+}
+
+static void print_module(const modules::module_t& module) {
+    logger::info_line("    ", module.load_order_index, " 0x", helpers::to_hex_string(module.image_base, hex::uppercase | hex::zero_padded),
+        " 0x", helpers::to_hex_string(module.image_size, hex::uppercase | hex::zero_padded), " ", module.base_name, " ", module.full_path);
+}
+
+// list and status, against the kernel module list or a SystemModuleInformation blob captured by --save-modules
+template <typename Backend>
+static drv_loader::loader_error_t query_loaded_modules(const drv_loader::config_t& config, const std::string& blob_path, const std::string& save_path) {
+    std::vector<std::uint8_t> blob;
+
+    drv_loader::loader_error_t ret = blob_path.empty() ? drv_loader::query_modules<Backend>(blob) : read_blob(blob_path, blob);
+    if (ret.failed()) {
+        return ret;
+    }
+
+    if (!save_path.empty() && !write_blob(save_path, blob)) {
+        logger::error_line("[!] Failed to write module list to ", save_path);
+    }
+
+    modules::module_index index;
+
+    ret = drv_loader::index_modules(blob, index);
+    if (ret.failed()) {
+        return ret;
+    }
+
+    if (config.operation == drv_loader::loader_operation_t::list) {
+        logger::info_line("[*] ", index.size(), " modules loaded: load order, image base, image size, name, path");
+
+        for (std::size_t i = 0; i < index.size(); ++i) {
+            print_module(index.at(i));
+        }
+
+        return drv_loader::success();
+    }
+
+    std::string base_name;
+
+    ret = drv_loader::status_image_name<Backend>(config, base_name);
+    if (ret.failed()) {
+        return ret;
+    }
+
+    const modules::module_t* module = drv_loader::find_module(index, base_name);
+    if (module == nullptr) {
+        logger::info_line("[*] ", base_name, " is not loaded");
+    } else {
+        logger::info_line("[+] ", base_name, " is loaded");
+        print_module(*module);
+    }
+
+    return drv_loader::success();
 }
 
 static void banner(void) {
-    std::cout <<
+    logger::info_line(
         "      _                   _                 _           \n"
         "     | |                 | |               | |          \n"
         "   __| |_ ____   __      | | ___   __ _  __| | ___ _ __ \n"
@@ -23,18 +222,33 @@ static void banner(void) {
         "  \\__,_|_|    \\_/        |_|\\___/ \\__,_|\\__,_|\\___|_|   \n"
         "                                                        \n"
         "   (c) Midi12                                           \n"
-        << std::endl;
+    );
 }
 
-int main(int argc, char* argv[], char* envp[]) {
+int main(int argc, char* argv[]) {
+    logger::async_logger::instance().install_crash_handlers();
+
     bool show_help = false;
     drv_loader::config_t config = {};
+    std::string trace_path;
+    bool show_stats = false;
+    std::string metrics_path;
+    metrics::format_t metrics_format = metrics::json;
+    bool simulate = false;
+    std::string manifest_path;
+    std::string modules_blob_path;
+    std::string save_modules_path;
+    std::size_t jobs = std::thread::hardware_concurrency();
+    std::uint32_t simulate_latency = 0;
+    std::uint32_t simulate_unload_pending = 0;
+
+    config.retry = retry::default_policy();
 
     auto cmd_parser = clara::Help(show_help)
         | clara::Opt(
             [&](const std::string& display_name) { config.display_name = display_name; },
             "Display name"
-        )["--display"]["-d"]("Set the display name").required()
+        )["--display"]["-d"]("Set the display name")
         | clara::Opt(
             [&](const std::string& op_type) {
                 auto ret = clara::ParserResult::runtimeError("Unrecognized operation");
@@ -45,12 +259,91 @@ int main(int argc, char* argv[], char* envp[]) {
                 } else if (op_type == "unload") {
                     config.operation = drv_loader::loader_operation_t::unload;
                     ret = clara::ParserResult::ok(clara::ParseResultType::Matched);
+                } else if (op_type == "list") {
+                    config.operation = drv_loader::loader_operation_t::list;
+                    ret = clara::ParserResult::ok(clara::ParseResultType::Matched);
+                } else if (op_type == "status") {
+                    config.operation = drv_loader::loader_operation_t::status;
+                    ret = clara::ParserResult::ok(clara::ParseResultType::Matched);
+                }
+
+                return ret;
+            },
+            "load|unload|list|status"
+        )["--operation"]["-o"]("Load or unload the specified driver, list the loaded modules or tell whether the driver (-d or file path) is loaded")
+        | clara::Opt(
+            [&](const std::string& statuses) {
+                if (!parse_statuses(statuses, config.tolerated_statuses)) {
+                    return clara::ParserResult::runtimeError("Unrecognized status in --tolerate list");
+                }
+
+                return clara::ParserResult::ok(clara::ParseResultType::Matched);
+            },
+            "STATUS_XXX,..."
+        )["--tolerate"]("Report these NtLoadDriver/NtUnloadDriver statuses (names or hex values) as success")
+        | clara::Opt(config.check_image)["--check-image"]("Validate the PE headers of the driver file (machine, native subsystem, sections) before loading it")
+        | clara::Opt(config.skip_if_loaded)["--skip-if-loaded"]("Do nothing when the same driver file, unchanged since its last load, is already loaded")
+        | clara::Opt(config.retry.max_attempts, "n")["--retry-attempts"]("NtLoadDriver/NtUnloadDriver calls per operation, including the first (default: 5, 1 disables retries)")
+        | clara::Opt(
+            [&](std::uint32_t backoff) { config.retry.initial_backoff = std::chrono::microseconds(backoff); },
+            "us"
+        )["--retry-backoff"]("Wait before the first retry, doubled on each retry and randomized (default: 10000)")
+        | clara::Opt(
+            [&](std::uint32_t backoff) { config.retry.max_backoff = std::chrono::microseconds(backoff); },
+            "us"
+        )["--retry-max-backoff"]("Upper bound of the wait between retries (default: 500000)")
+        | clara::Opt(
+            [&](std::uint32_t deadline) { config.retry.deadline = std::chrono::microseconds(deadline); },
+            "us"
+        )["--retry-deadline"]("Stop retrying an operation this long after its first call, 0 for none (default: 2000000)")
+        | clara::Opt(
+            [&](const std::string& statuses) {
+                config.retry.retryable_statuses.clear();
+
+                if (!parse_statuses(statuses, config.retry.retryable_statuses)) {
+                    return clara::ParserResult::runtimeError("Unrecognized status in --retry-on list");
+                }
+
+                return clara::ParserResult::ok(clara::ParseResultType::Matched);
+            },
+            "STATUS_XXX,..."
+        )["--retry-on"]("Retry NtLoadDriver/NtUnloadDriver on these statuses (default: STATUS_IMAGE_ALREADY_LOADED,STATUS_INSUFFICIENT_RESOURCES)")
+        | clara::Opt(modules_blob_path, "file")["--modules-blob"]("With list/status, read a module list captured by --save-modules instead of querying the kernel")
+        | clara::Opt(save_modules_path, "file")["--save-modules"]("With list/status, write the raw SystemModuleInformation output to file")
+        | clara::Opt(manifest_path, "file")["--manifest"]("Run every operation listed in file (\"<load|unload> <display name> [driver path]\" per line) in this process, instead of -o/-d")
+        | clara::Opt(jobs, "n")["--jobs"]["-j"]("Worker threads running independent --manifest entries (default: one per cpu)")
+        | clara::Opt(trace_path, "file")["--trace"]("Write a Chrome trace-event JSON of the load/unload phases to file")
+        | clara::Opt(show_stats)["--stats"]("Print per-phase latency percentiles on exit")
+        | clara::Opt(metrics_path, "file")["--metrics"]("Write operation and failure counters to file on exit")
+        | clara::Opt(
+            [&](const std::string& format) {
+                auto ret = clara::ParserResult::runtimeError("Unrecognized metrics format");
+
+                if (format == "json") {
+                    metrics_format = metrics::json;
+                    ret = clara::ParserResult::ok(clara::ParseResultType::Matched);
+                } else if (format == "openmetrics") {
+                    metrics_format = metrics::openmetrics;
+                    ret = clara::ParserResult::ok(clara::ParseResultType::Matched);
                 }
 
                 return ret;
             },
-            "load|unload"
-        )["--operation"]["-o"]("Load or unload the specified driver").required()
+            "json|openmetrics"
+        )["--metrics-format"]("Format of the --metrics file (default: json)")
+        | clara::Opt(simulate)["--simulate"]("Run against the in-memory simulated kernel instead of the registry and ntdll (always on outside windows)")
+        | clara::Opt(simulate_latency, "us")["--simulate-latency"]("Delay every simulated registry and driver call by this many microseconds")
+        | clara::Opt(
+            [&](const std::string& latencies) {
+                if (!parse_driver_latencies(latencies)) {
+                    return clara::ParserResult::runtimeError("Malformed --simulate-driver-latency list");
+                }
+
+                return clara::ParserResult::ok(clara::ParseResultType::Matched);
+            },
+            "name=us,..."
+        )["--simulate-driver-latency"]("Add this many microseconds to the simulated NtLoadDriver/NtUnloadDriver of these drivers")
+        | clara::Opt(simulate_unload_pending, "us")["--simulate-unload-pending"]("Keep a simulated unloaded image in place this many microseconds, reloading it meanwhile fails with STATUS_IMAGE_ALREADY_LOADED")
         | clara::Arg(
             [&](const std::string& file_path) { config.file_path = file_path; },
             "Driver file path"
@@ -61,46 +354,138 @@ int main(int argc, char* argv[], char* envp[]) {
     banner();
 
     if (!result) {
-        std::cerr << "[!] Error in command line: " << result.errorMessage() << std::endl;
+        logger::error_line("[!] Error in command line: ", result.errorMessage());
         return 1;
     }
 
     if (show_help) {
-        std::cout << cmd_parser << std::endl;
+        std::ostringstream usage;
+        usage << cmd_parser;
+        logger::info_line(usage.str());
         return 0;
     }
 
-    if (config.operation == drv_loader::loader_operation_t::load && config.file_path.empty()) {
-        std::cerr << "[!] File path is empty" << std::endl;
-        return 1;
+    std::vector<drv_loader::config_t> batch;
+    scheduler::graph_t batch_graph;
+
+    if (!manifest_path.empty()) {
+        manifest::parse_error_t error = {};
+
+        if (!manifest::read(manifest_path, config, batch, error)) {
+            logger::error_line("[!] ", manifest_path, ":", error.line, ": ", error.reason);
+            return 1;
+        }
+
+        scheduler::build_error_t build_error = {};
+
+        if (!scheduler::build(batch, batch_graph, build_error)) {
+            const drv_loader::config_t& entry = batch[build_error.entry];
+            logger::error_line("[!] ", manifest_path, ": ", drv_loader::operation_name(entry.operation), " ", entry.display_name, ": ", build_error.reason, " ", build_error.detail);
+            return 1;
+        }
+    } else {
+        if (config.operation == drv_loader::loader_operation_t::none) {
+            logger::error_line("[!] Operation is not set");
+            return 1;
+        }
+
+        if (config.operation == drv_loader::loader_operation_t::load && config.file_path.empty()) {
+            logger::error_line("[!] File path is empty");
+            return 1;
+        }
+
+        if (config.operation == drv_loader::loader_operation_t::status && config.display_name.empty() && config.file_path.empty()) {
+            logger::error_line("[!] Status needs a display name or a file path");
+            return 1;
+        }
+
+        if (config.display_name.empty() && config.operation != drv_loader::loader_operation_t::list && config.operation != drv_loader::loader_operation_t::status) {
+            logger::error_line("[!] Display name is empty");
+            return 1;
+        }
     }
 
-    if (config.display_name.empty()) {
-        std::cerr << "[!] Display name is empty" << std::endl;
-        return 1;
+    bool query = manifest_path.empty() && (config.operation == drv_loader::loader_operation_t::list || config.operation == drv_loader::loader_operation_t::status);
+
+#if !defined(_WIN32)
+    simulate = true; // the simulated kernel is the only backend
+#endif
+
+    if (simulate) {
+        std::chrono::microseconds latency(simulate_latency);
+        simulated::kernel::instance().set_latency({ latency, latency, latency, std::chrono::microseconds(simulate_unload_pending) });
     }
 
-    if (!helpers::add_privilege("SeLoadDriverPrivilege")) {
-        std::cerr << "[!] Failed to add SeLoadDriverPrivilege privilege" << std::endl;
+    if (!simulate && !query && !helpers::add_privilege("SeLoadDriverPrivilege")) {
+        logger::error_line("[!] Failed to add SeLoadDriverPrivilege privilege");
         return 1;
     }
 
-    std::uint32_t ret = drv_loader::load_unload(config);
+    if (!trace_path.empty()) {
+        trace::enable();
+    }
+
+    drv_loader::loader_error_t ret = drv_loader::success();
+    std::vector<scheduler::node_result_t> batch_results;
+    drv_loader::report_t report = {};
 
-    if (ret != ERROR_SUCCESS) {
-        std::cerr << "[!] An error happened (last error: " << helpers::to_hex_string(ret) << ")" << std::endl;
+    if (query) {
+        ret = simulate ? query_loaded_modules<drv_loader::simulated_backend>(config, modules_blob_path, save_modules_path) : query_loaded_modules<drv_loader::default_backend>(config, modules_blob_path, save_modules_path);
+    } else if (!manifest_path.empty()) {
+        // one privilege adjustment, one ntdll resolution and one open services key for the whole batch
+        ret = simulate ? scheduler::run<drv_loader::simulated_backend>(batch, batch_graph, jobs, batch_results) : scheduler::run(batch, batch_graph, jobs, batch_results);
+    } else {
+        ret = simulate ? drv_loader::load_unload<drv_loader::simulated_backend>(config, report) : drv_loader::load_unload(config, report);
+    }
+
+    if (!trace_path.empty() && !trace::dump_chrome_json(trace_path)) {
+        logger::error_line("[!] Failed to write trace to ", trace_path);
+    }
+
+    if (show_stats) {
+        print_phase_stats();
+    }
+
+    if (!metrics_path.empty() && !drv_loader::write_metrics(metrics_path, metrics_format)) {
+        logger::error_line("[!] Failed to write metrics to ", metrics_path);
+    }
+
+    if (report.retries != 0) {
+        logger::info_line("[*] Retried ", report.retries, " times");
+    }
+
+    // nonzero when the operation, or any operation of the manifest, failed
+    int exit_code = 0;
+
+    if (ret.failed()) {
+        exit_code = 1;
+
+        drv_loader::error_text_t text;
+        drv_loader::format_error(ret, text, error_subject(config));
+        logger::error_line("[!] ", std::string_view(text.c_str(), text.size()));
+
+        if (report.image_error != pe::none) {
+            logger::error_line("[!] Image rejected: ", pe::error_name(report.image_error));
+        }
+    } else if (!manifest_path.empty()) {
+        std::size_t failures = print_batch_results(batch, batch_results);
+        logger::info_line("[*] ", batch_results.size(), " operations, ", failures, " failed");
+
+        if (failures != 0) {
+            exit_code = 1;
+        }
     } else {
         switch (config.operation) {
             case drv_loader::loader_operation_t::load:
-                std::cout << "[+] Driver loaded successfully" << std::endl;
+                logger::info_line(report.unchanged ? "[+] Driver already loaded, unchanged" : "[+] Driver loaded successfully");
                 break;
             case drv_loader::loader_operation_t::unload:
-                std::cout << "[+] Driver unloaded successfully" << std::endl;
+                logger::info_line("[+] Driver unloaded successfully");
                 break;
             default:
                 break;
         }
     }
 
-    return 0;
+    return exit_code;
 }
\ No newline at end of file
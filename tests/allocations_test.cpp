@@ -0,0 +1,158 @@
+#include "test.hpp"
+
+#include "drv-loader.hpp"
+
+#include <atomic>
+#include <cstdlib>
+#include <filesystem>
+#include <new>
+#include <string>
+
+// the steady state load/unload path does not touch the heap: every global operator new is counted while
+// load_unload runs against a backend that allocates nothing itself, after a first warm up operation
+// (function statics of the vectorized kernels, thread locals)
+// also checks helpers::append_full_path, which builds the image path, against std::filesystem
+
+static std::atomic<bool> counting(false);
+static std::atomic<std::size_t> allocations(0);
+
+static void* counted_allocation(std::size_t size) {
+	if (counting.load(std::memory_order_relaxed)) {
+		allocations.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	void* pointer = std::malloc(size != 0 ? size : 1);
+	if (pointer == nullptr) {
+		throw std::bad_alloc();
+	}
+
+	return pointer;
+}
+
+void* operator new(std::size_t size) { return counted_allocation(size); }
+void* operator new[](std::size_t size) { return counted_allocation(size); }
+void operator delete(void* pointer) noexcept { std::free(pointer); }
+void operator delete[](void* pointer) noexcept { std::free(pointer); }
+void operator delete(void* pointer, std::size_t) noexcept { std::free(pointer); }
+void operator delete[](void* pointer, std::size_t) noexcept { std::free(pointer); }
+
+using drv_loader::UNICODE_STRING;
+
+// registry and ntdll calls that succeed and only remember the service key path they were given
+struct null_backend {
+	struct key_type {
+		void reset(void) {}
+	};
+
+	static wchar_t* last_path(void) {
+		static wchar_t path[drv_loader::max_registry_path + 1];
+		return path;
+	}
+
+	static NTSTATUS record(UNICODE_STRING* registry_path) {
+		std::size_t length = registry_path->Length / sizeof(wchar_t);
+		std::char_traits<wchar_t>::copy(last_path(), registry_path->Buffer, length);
+		last_path()[length] = L'\0';
+		return STATUS_SUCCESS;
+	}
+
+	static LSTATUS open_key(const char*, key_type&) { return ERROR_SUCCESS; }
+
+	static LSTATUS create_key(const key_type&, const char*, key_type&, bool& created) {
+		created = true;
+		return ERROR_SUCCESS;
+	}
+
+	static LSTATUS set_values(const key_type&, const drv_loader::registry_value_t*, std::size_t) { return ERROR_SUCCESS; }
+	static LSTATUS delete_tree(const key_type&, const char*) { return ERROR_SUCCESS; }
+	static LSTATUS delete_value(const key_type&, const char*) { return ERROR_SUCCESS; }
+	static LSTATUS query_value(const key_type&, const char*, const char*, DWORD&, std::vector<std::uint8_t>&) { return ERROR_FILE_NOT_FOUND; }
+	static NTSTATUS query_modules(std::vector<std::uint8_t>&) { return STATUS_OBJECT_NAME_NOT_FOUND; }
+	static NTSTATUS load_driver(UNICODE_STRING* registry_path) { return record(registry_path); }
+	static NTSTATUS unload_driver(UNICODE_STRING* registry_path) { return record(registry_path); }
+	static void yield(void) {}
+};
+
+static void load_unload_does_not_allocate(void) {
+	drv_loader::config_t load = {};
+	load.display_name = "AllocationTest";
+	load.file_path = "drivers/../drivers/allocation_test.sys";
+	load.operation = drv_loader::loader_operation_t::load;
+	load.retry = retry::default_policy();
+
+	drv_loader::config_t unload = load;
+	unload.operation = drv_loader::loader_operation_t::unload;
+
+	null_backend::key_type services;
+	drv_loader::report_t report = {};
+
+	CHECK(!drv_loader::load_unload<null_backend>(load, services, report).failed());
+	CHECK(!drv_loader::load_unload<null_backend>(unload, services, report).failed());
+	CHECK(std::wstring(null_backend::last_path()) == L"\\Registry\\Machine\\System\\CurrentControlSet\\Services\\AllocationTest");
+
+	bool failed = false;
+
+	counting = true;
+
+	for (int i = 0; i < 100; ++i) {
+		failed |= drv_loader::load_unload<null_backend>(load, services, report).failed();
+		failed |= drv_loader::load_unload<null_backend>(unload, services, report).failed();
+	}
+
+	counting = false;
+
+	CHECK(!failed);
+	CHECK(allocations == 0);
+}
+
+static std::string expected_full_path(const char* path) {
+	return std::filesystem::absolute(path).lexically_normal().string();
+}
+
+static void append_full_path_matches_filesystem(void) {
+	const char* paths[] = {
+		"driver.sys",
+		"./drivers/driver.sys",
+		"drivers//nested/../driver.sys",
+		"../driver.sys",
+		"../../../../../../../../driver.sys",
+		"/opt/drivers/./driver.sys",
+		"/opt/../../driver.sys",
+		"//opt///drivers/driver.sys",
+	};
+
+	for (const char* path : paths) {
+		helpers::fixed_string<char, 4096> out;
+		std::string expected = expected_full_path(path);
+
+		counting = true;
+		std::size_t length = helpers::append_full_path(out, path);
+		counting = false;
+
+		CHECK(length == expected.size());
+		CHECK(out.c_str() == expected);
+	}
+
+	CHECK(allocations == 0);
+
+	// too small: nothing usable, a length past the capacity
+	helpers::fixed_string<char, 8> small;
+	CHECK(helpers::append_full_path(small, "/opt/drivers/driver.sys") > small.capacity());
+
+	helpers::fixed_string<char, 8> exact;
+	CHECK(helpers::append_full_path(exact, "/opt/a/../b") == 6);
+	CHECK(std::string(exact.c_str()) == "/opt/b");
+
+	// appended after the "\??\" prefix, ".." never climbs above the root of the appended path
+	helpers::fixed_string<char, 64> prefixed;
+	prefixed.assign("\\??\\", 4);
+	CHECK(helpers::append_full_path(prefixed, "/../opt/x.sys") == 14);
+	CHECK(std::string(prefixed.c_str()) == "\\??\\/opt/x.sys");
+}
+
+int main(void) {
+	append_full_path_matches_filesystem();
+	load_unload_does_not_allocate();
+
+	return test::result();
+}
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+// timing helpers of the tests/bench programs, built and run by tools/run_tests.py --bench
+//
+// every program takes -repeat=<n> (best of n runs, default 5) and -iterations=<n> (calls per run, default per program)
+
+namespace bench {
+
+	typedef struct _options_t {
+		std::size_t repeat;
+		std::size_t iterations;
+	} options_t, *poptions_t;
+
+	static options_t parse_options(int argc, char* argv[], std::size_t iterations) {
+		options_t options = { 5, iterations };
+
+		for (int i = 1; i < argc; ++i) {
+			if (std::strncmp(argv[i], "-repeat=", 8) == 0) {
+				options.repeat = std::strtoul(argv[i] + 8, nullptr, 10);
+			} else if (std::strncmp(argv[i], "-iterations=", 12) == 0) {
+				options.iterations = std::strtoul(argv[i] + 12, nullptr, 10);
+			} else {
+				std::fprintf(stderr, "usage: %s [-repeat=<n>] [-iterations=<n>]\n", argv[0]);
+				std::exit(1);
+			}
+		}
+
+		options.repeat = options.repeat != 0 ? options.repeat : 1;
+		options.iterations = options.iterations != 0 ? options.iterations : 1;
+		return options;
+	}
+
+	// keeps a result alive without a store the compiler could drop
+	template <typename T>
+	static void keep(const T& value) {
+#if defined(_MSC_VER) && !defined(__clang__)
+		static volatile std::uintptr_t sink;
+		sink = reinterpret_cast<std::uintptr_t>(&value);
+#else
+		__asm__ volatile("" : : "r"(&value) : "memory");
+#endif
+	}
+
+	// best nanoseconds per call of fn over options.repeat runs of options.iterations calls
+	template <typename Fn>
+	static double measure(const options_t& options, Fn&& fn) {
+		double best = 0;
+
+		for (std::size_t run = 0; run < options.repeat; ++run) {
+			auto start = std::chrono::steady_clock::now();
+
+			for (std::size_t i = 0; i < options.iterations; ++i) {
+				fn();
+			}
+
+			double elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / static_cast<double>(options.iterations);
+			best = run == 0 || elapsed < best ? elapsed : best;
+		}
+
+		return best;
+	}
+
+	// bytes per nanosecond is GB/s, reported in MB/s
+	static double megabytes_per_second(std::size_t bytes, double nanoseconds) {
+		return nanoseconds > 0 ? static_cast<double>(bytes) * 1000.0 / nanoseconds : 0;
+	}
+}
@@ -0,0 +1,76 @@
+#include "bench.hpp"
+
+#include "hex.hpp"
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+// hex encoding and decoding of digests, registry binary values and dumped images:
+//   scalar  hex::detail::encode_scalar and decode_scalar_entry, one byte at a time
+//   simd    hex::encode and hex::decode, the kernel the cpu supports (ssse3 or avx2)
+// and hex::dump_writer over the same bytes, offsets, digits and ascii columns
+
+// the same amount of bytes for every input
+static bench::options_t scale(const bench::options_t& options, std::size_t bytes) {
+	bench::options_t scaled = options;
+	scaled.iterations = options.iterations * 32 / (bytes > 32 ? bytes : 32);
+	scaled.iterations = scaled.iterations != 0 ? scaled.iterations : 1;
+	return scaled;
+}
+
+static std::vector<std::uint8_t> bytes(std::size_t size) {
+	std::vector<std::uint8_t> data(size);
+	std::uint32_t state = 0x9E3779B9;
+
+	for (std::uint8_t& byte : data) {
+		state = state * 1664525 + 1013904223;
+		byte = static_cast<std::uint8_t>(state >> 24);
+	}
+
+	return data;
+}
+
+int main(int argc, char* argv[]) {
+	bench::options_t options = bench::parse_options(argc, argv, 1000000);
+
+	const std::pair<const char*, std::size_t> inputs[] = {
+		{ "sha-256 digest", 32 },
+		{ "4 KiB", 4096 },
+		{ "1 MiB", 1 << 20 },
+	};
+
+	std::printf("%-16s  %8s  %10s  %10s  %8s  %10s  %10s  %8s  %10s\n", "input", "bytes", "enc scalar", "enc simd", "MB/s",
+		"dec scalar", "dec simd", "MB/s", "dump MB/s");
+
+	for (const auto& input : inputs) {
+		std::vector<std::uint8_t> data = bytes(input.second);
+		std::vector<std::uint8_t> decoded(data.size());
+		std::string text(data.size() * 2, '\0');
+		bench::options_t scaled = scale(options, data.size());
+
+		hex::encode(data.data(), data.size(), &text[0]);
+		if (hex::decode(text.data(), text.size(), decoded.data()).error != hex::none || decoded != data) {
+			std::fprintf(stderr, "%s: decode does not round trip\n", input.first);
+			return 1;
+		}
+
+		std::size_t dumped = 0;
+		auto sink = [&dumped](const char* line, std::size_t length) { dumped += length; bench::keep(line); };
+
+		double encode_scalar = bench::measure(scaled, [&]() { hex::detail::encode_scalar(data.data(), data.size(), &text[0], hex::lowercase); bench::keep(text.data()); });
+		double encode = bench::measure(scaled, [&]() { hex::encode(data.data(), data.size(), &text[0]); bench::keep(text.data()); });
+		double decode_scalar = bench::measure(scaled, [&]() { bench::keep(hex::detail::decode_scalar_entry(text.data(), text.size(), decoded.data())); });
+		double decode = bench::measure(scaled, [&]() { bench::keep(hex::decode(text.data(), text.size(), decoded.data())); });
+		double dump = bench::measure(scaled, [&]() {
+			hex::dump_writer<decltype(sink)> writer(sink);
+			writer.write(data.data(), data.size());
+		});
+
+		std::printf("%-16s  %8zu  %10.1f  %10.1f  %8.0f  %10.1f  %10.1f  %8.0f  %10.0f\n", input.first, data.size(), encode_scalar, encode,
+			bench::megabytes_per_second(data.size(), encode), decode_scalar, decode, bench::megabytes_per_second(data.size(), decode),
+			bench::megabytes_per_second(data.size(), dump));
+	}
+
+	return 0;
+}
@@ -0,0 +1,119 @@
+#include "bench.hpp"
+
+#include "logger.hpp"
+
+#include <cstdio>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if defined(_WIN32)
+#include <io.h>
+#define dup _dup
+#define dup2 _dup2
+#define open _open
+#define O_WRONLY _O_WRONLY
+#define null_device "NUL"
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#define null_device "/dev/null"
+#endif
+
+// cost of one console line, stdout going to the null device:
+//   endl     std::cout << ... << std::endl, what main.cpp did before the logger (one write per line)
+//   newline  std::cout << ... << '\n', buffered by the stream
+//   logger   logger::info_line, formatting and the copy into the ring, the writer thread drains in the background
+//   flushed  logger::info_line over 1000 lines then logger::flush, the whole cost including the writes
+// and with several threads logging at once, cout serialized by a mutex as the lines would interleave otherwise
+
+static const std::string service = "MyDriver";
+static const std::uint32_t status = 0xC0000034;
+
+static void cout_endl(void) {
+	std::cout << "[+] Service " << service << " loaded, status " << status << std::endl;
+}
+
+static void cout_newline(void) {
+	std::cout << "[+] Service " << service << " loaded, status " << status << '\n';
+}
+
+static void logger_line(void) {
+	logger::info_line("[+] Service ", service, " loaded, status ", status);
+}
+
+// wall nanoseconds per line with threads loggers of iterations lines each
+template <typename Fn>
+static double concurrent(const bench::options_t& options, std::size_t threads, Fn&& fn) {
+	bench::options_t once = { options.repeat, 1 };
+
+	return bench::measure(once, [&]() {
+		std::vector<std::thread> workers;
+
+		for (std::size_t t = 0; t < threads; ++t) {
+			workers.emplace_back([&]() {
+				for (std::size_t i = 0; i < options.iterations; ++i) {
+					fn();
+				}
+			});
+		}
+
+		for (std::thread& worker : workers) {
+			worker.join();
+		}
+
+		logger::flush();
+		std::cout.flush();
+	}) / static_cast<double>(options.iterations * threads);
+}
+
+int main(int argc, char* argv[]) {
+	bench::options_t options = bench::parse_options(argc, argv, 100000);
+	std::ios::sync_with_stdio(false);
+
+	// the table goes to the real stdout, the measured lines to the null device
+	std::fflush(stdout);
+	int console = ::dup(1);
+	int null = ::open(null_device, O_WRONLY);
+	::dup2(null, 1);
+
+	bench::options_t batches = { options.repeat, options.iterations / 1000 != 0 ? options.iterations / 1000 : 1 };
+
+	double endl = bench::measure(options, cout_endl);
+	double newline = bench::measure(options, cout_newline);
+	double ring = bench::measure(options, logger_line);
+	double flushed = bench::measure(batches, []() {
+		for (int i = 0; i < 1000; ++i) {
+			logger_line();
+		}
+
+		logger::flush();
+	}) / 1000;
+
+	std::mutex cout_mutex;
+	std::size_t thread_counts[] = { 1, 4 };
+	double threaded[2][2] = {};
+
+	for (std::size_t i = 0; i < 2; ++i) {
+		threaded[i][0] = concurrent(options, thread_counts[i], [&]() {
+			std::lock_guard<std::mutex> lock(cout_mutex);
+			cout_endl();
+		});
+		threaded[i][1] = concurrent(options, thread_counts[i], logger_line);
+	}
+
+	std::cout.flush();
+	::dup2(console, 1);
+
+	std::printf("%-10s  %10s  %10s  %10s  %10s  %8s\n", "threads", "endl ns", "newline ns", "logger ns", "flushed ns", "speedup");
+	std::printf("%-10s  %10.1f  %10.1f  %10.1f  %10.1f  %7.1fx\n", "1", endl, newline, ring, flushed, endl / flushed);
+
+	std::printf("\n%-10s  %10s  %10s  %8s\n", "threads", "endl ns", "logger ns", "speedup");
+	for (std::size_t i = 0; i < 2; ++i) {
+		std::printf("%-10zu  %10.1f  %10.1f  %7.1fx\n", thread_counts[i], threaded[i][0], threaded[i][1], threaded[i][0] / threaded[i][1]);
+	}
+
+	return 0;
+}
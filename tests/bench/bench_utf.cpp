@@ -0,0 +1,120 @@
+// the codecvt converter helpers::to_unicode used to construct on every call, kept here as the baseline
+#define _SILENCE_CXX17_CODECVT_HEADER_DEPRECATION_WARNING
+
+#include "bench.hpp"
+
+#include "helpers.hpp"
+
+#include <codecvt>
+#include <cstdio>
+#include <locale>
+#include <string>
+#include <vector>
+
+// utf-8 to wide conversion of registry and image paths, and of whole --manifest files:
+//   codecvt     std::wstring_convert<std::codecvt_utf8_utf16<wchar_t>>, constructed per call (the previous to_unicode)
+//   to_unicode  helpers::to_unicode(const std::string&), vectorized decoder into a std::wstring
+//   buffer      helpers::to_unicode into a caller buffer, as the load path builds the NT path
+// and back, for the same inputs:
+//   codecvt     the same converter's to_bytes (the previous to_ansi)
+//   to_ansi     helpers::to_ansi(const std::wstring&)
+//   utf-16      utf::to_utf8 from 16 bits units into a caller buffer, the wchar_t of windows whatever the host
+
+#if defined(__GNUC__)
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+#endif
+
+static std::wstring codecvt_to_unicode(const std::string& str) {
+	std::wstring_convert<std::codecvt_utf8_utf16<wchar_t>> converter;
+	return converter.from_bytes(str);
+}
+
+static std::string codecvt_to_ansi(const std::wstring& wstr) {
+	std::wstring_convert<std::codecvt_utf8_utf16<wchar_t>> converter;
+	return converter.to_bytes(wstr);
+}
+
+// the utf-16 form of str in out, whatever the size of wchar_t
+static std::size_t to_utf16(const std::string& str, std::u16string& out) {
+	utf::result_t result = utf::from_utf8(str.data(), str.size(), out.data());
+	return result.written;
+}
+
+// the same amount of bytes for every input
+static bench::options_t scale(const bench::options_t& options, std::size_t bytes) {
+	bench::options_t scaled = options;
+	scaled.iterations = options.iterations * 64 / (bytes > 64 ? bytes : 64);
+	scaled.iterations = scaled.iterations != 0 ? scaled.iterations : 1;
+	return scaled;
+}
+
+static std::string manifest(std::size_t lines, bool ascii) {
+	std::string text;
+
+	for (std::size_t i = 0; i < lines; ++i) {
+		std::string name = (ascii ? "Driver" : "Pilote\xC3\xA9") + std::to_string(i);
+		text += "load    " + name + "    C:\\drivers\\" + (ascii ? "provisioning" : "r\xC3\xA9seau \xE6\x97\xA5\xE6\x9C\xAC") + "\\" + name + ".sys\n";
+	}
+
+	return text;
+}
+
+int main(int argc, char* argv[]) {
+	bench::options_t options = bench::parse_options(argc, argv, 200000);
+
+	const std::pair<const char*, std::string> inputs[] = {
+		{ "image path", "C:\\Windows\\System32\\drivers\\my_driver.sys" },
+		{ "service key", "\\Registry\\Machine\\System\\CurrentControlSet\\Services\\MyDriver" },
+		{ "non ascii path", "C:\\pilotes\\contr\xC3\xB4leur r\xC3\xA9seau \xE6\x97\xA5\xE6\x9C\xAC.sys" },
+		{ "manifest ascii", manifest(1000, true) },
+		{ "manifest mixed", manifest(1000, false) },
+	};
+
+	std::printf("%-16s  %8s  %12s  %14s  %10s  %8s  %12s\n", "input", "bytes", "codecvt ns", "to_unicode ns", "buffer ns", "speedup", "buffer MB/s");
+
+	for (const auto& input : inputs) {
+		const std::string& str = input.second;
+		bench::options_t scaled = scale(options, str.size());
+
+		if (helpers::to_unicode(str) != codecvt_to_unicode(str)) {
+			std::fprintf(stderr, "%s: to_unicode and codecvt disagree\n", input.first);
+			return 1;
+		}
+
+		std::vector<wchar_t> buffer(str.size() + 1);
+
+		double codecvt = bench::measure(scaled, [&]() { bench::keep(codecvt_to_unicode(str)); });
+		double to_unicode = bench::measure(scaled, [&]() { bench::keep(helpers::to_unicode(str)); });
+		double into_buffer = bench::measure(scaled, [&]() { bench::keep(helpers::to_unicode(str.data(), str.size(), buffer.data(), buffer.size())); });
+
+		std::printf("%-16s  %8zu  %12.1f  %14.1f  %10.1f  %7.1fx  %12.0f\n", input.first, str.size(), codecvt, to_unicode, into_buffer,
+			codecvt / to_unicode, bench::megabytes_per_second(str.size(), into_buffer));
+	}
+
+	std::printf("\n%-16s  %8s  %12s  %14s  %10s  %8s  %12s\n", "input", "units", "codecvt ns", "to_ansi ns", "utf-16 ns", "speedup", "utf-16 MB/s");
+
+	for (const auto& input : inputs) {
+		const std::string& str = input.second;
+		bench::options_t scaled = scale(options, str.size());
+
+		std::wstring wstr = helpers::to_unicode(str);
+		std::u16string utf16(wstr.size() * 2, u'\0');
+		utf16.resize(to_utf16(str, utf16));
+
+		if (helpers::to_ansi(wstr) != codecvt_to_ansi(wstr)) {
+			std::fprintf(stderr, "%s: to_ansi and codecvt disagree\n", input.first);
+			return 1;
+		}
+
+		std::vector<char> buffer(utf::max_utf8_length<char16_t>(utf16.size()));
+
+		double codecvt = bench::measure(scaled, [&]() { bench::keep(codecvt_to_ansi(wstr)); });
+		double to_ansi = bench::measure(scaled, [&]() { bench::keep(helpers::to_ansi(wstr)); });
+		double from_utf16 = bench::measure(scaled, [&]() { bench::keep(utf::to_utf8(utf16.data(), utf16.size(), buffer.data())); });
+
+		std::printf("%-16s  %8zu  %12.1f  %14.1f  %10.1f  %7.1fx  %12.0f\n", input.first, wstr.size(), codecvt, to_ansi, from_utf16,
+			codecvt / to_ansi, bench::megabytes_per_second(str.size(), from_utf16));
+	}
+
+	return 0;
+}
@@ -0,0 +1,52 @@
+#include "test.hpp"
+
+#include "drv-loader.hpp"
+
+#include <string>
+
+// drv_loader::format_error fills the inserts of message table text: the first string insert ("%1", "%hs") names the
+// driver given as subject, every other insert ("%2", "%08lx", "%p", "%s") reads "?"
+
+static std::string format(const drv_loader::loader_error_t& error, const char* subject) {
+	drv_loader::error_text_t text;
+	drv_loader::format_error(error, text, subject);
+	return std::string(text.c_str(), text.size());
+}
+
+static bool ends_with(const std::string& text, const std::string& suffix) {
+	return text.size() >= suffix.size() && text.compare(text.size() - suffix.size(), suffix.size(), suffix) == 0;
+}
+
+static void subject_fills_the_first_string_insert(void) {
+	drv_loader::loader_error_t bad_exe_format = drv_loader::win32_error(drv_loader::phase_load, 193);
+	CHECK(ends_with(format(bad_exe_format, "C:\\drivers\\my.sys"), "): C:\\drivers\\my.sys is not a valid Win32 application."));
+	CHECK(ends_with(format(bad_exe_format, ""), "): ? is not a valid Win32 application."));
+
+	drv_loader::loader_error_t invalid_image_format = { drv_loader::domain_ntstatus, 0xC000007B, drv_loader::phase_load };
+	CHECK(format(invalid_image_format, "my.sys").find("{Bad Image} my.sys is either not designed to run on Windows") != std::string::npos);
+}
+
+static void other_inserts_are_marked(void) {
+	drv_loader::loader_error_t access_violation = { drv_loader::domain_ntstatus, 0xC0000005, drv_loader::phase_load };
+	CHECK(ends_with(format(access_violation, "my.sys"), "The instruction at 0x? referenced memory at 0x?. The memory could not be ?."));
+
+	// a number first: the library name that follows is not the driver either
+	drv_loader::loader_error_t ordinal_not_found = { drv_loader::domain_ntstatus, 0xC0000138, drv_loader::phase_load };
+	CHECK(ends_with(format(ordinal_not_found, "my.sys"), "The ordinal ? could not be located in the dynamic link library ?."));
+}
+
+static void messages_without_inserts_are_unchanged(void) {
+	drv_loader::loader_error_t not_found = { drv_loader::domain_ntstatus, 0xC0000034, drv_loader::phase_load };
+	CHECK(ends_with(format(not_found, "my.sys"), "): Object Name not found."));
+
+	drv_loader::loader_error_t access_denied = drv_loader::win32_error(drv_loader::phase_unload, 5);
+	CHECK(ends_with(format(access_denied, "my.sys"), "): Access is denied."));
+}
+
+int main(void) {
+	subject_fills_the_first_string_insert();
+	other_inserts_are_marked();
+	messages_without_inserts_are_unchanged();
+
+	return test::result();
+}
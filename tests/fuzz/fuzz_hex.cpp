@@ -0,0 +1,265 @@
+#include "standalone.hpp"
+
+#include "hex.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+// hex encoding (hex::encode, hex::dump_writer):
+//   every kernel (scalar, ssse3, avx2) writes exactly 2 * length digits, the same as printf("%02x"), in both cases
+//   dump_writer fed in arbitrary chunk sizes produces the same dump as a line by line reference
+// hex decoding (hex::decode, hex::parse):
+//   every kernel reports the first non hex character, or decodes the same bytes as a reference, on the raw input and on
+//   the encoded input with one character replaced
+//   parse of 64 and 8 bits, signed and unsigned, matches a reference on prefixes, signs, bad digits and overflow
+
+static constexpr char guard = '\x5A';
+
+typedef void(*encoder_t)(const std::uint8_t*, std::size_t, char*, std::uint32_t);
+
+static std::vector<encoder_t> encoders(void) {
+	std::vector<encoder_t> kernels = { &hex::detail::encode_scalar };
+
+#if defined(CPU_FEATURES_X86)
+	if (cpu_features::get().ssse3) {
+		kernels.push_back(&hex::detail::encode_ssse3);
+	}
+
+	if (cpu_features::get().avx2) {
+		kernels.push_back(&hex::detail::encode_avx2);
+	}
+#endif
+	return kernels;
+}
+
+static void check_encode(const std::uint8_t* data, std::size_t size, std::uint32_t format) {
+	static const std::vector<encoder_t> kernels = encoders();
+
+	std::string expected(size * 2, '\0');
+	for (std::size_t i = 0; i < size; ++i) {
+		char digits[3];
+		std::snprintf(digits, sizeof(digits), (format & hex::uppercase) != 0 ? "%02X" : "%02x", data[i]);
+		expected[i * 2] = digits[0];
+		expected[i * 2 + 1] = digits[1];
+	}
+
+	for (encoder_t kernel : kernels) {
+		std::string out(size * 2 + 1, guard);
+		kernel(data, size, &out[0], format);
+
+		FUZZ_CHECK(out.compare(0, size * 2, expected) == 0);
+		FUZZ_CHECK(out[size * 2] == guard);
+	}
+}
+
+static std::string reference_dump(const std::uint8_t* data, std::size_t size, std::uint32_t format, std::uint64_t base_offset) {
+	std::string dump;
+
+	for (std::size_t line = 0; line < size; line += 16) {
+		std::size_t count = std::min<std::size_t>(16, size - line);
+		char text[32];
+
+		std::snprintf(text, sizeof(text), (format & hex::uppercase) != 0 ? "%016llX  " : "%016llx  ", static_cast<unsigned long long>(base_offset + line));
+		dump += text;
+
+		for (std::size_t i = 0; i < 16; ++i) {
+			if (i < count) {
+				std::snprintf(text, sizeof(text), (format & hex::uppercase) != 0 ? "%02X " : "%02x ", data[line + i]);
+				dump += text;
+			} else {
+				dump += "   ";
+			}
+		}
+
+		dump += " |";
+		for (std::size_t i = 0; i < count; ++i) {
+			std::uint8_t byte = data[line + i];
+			dump += byte >= 0x20 && byte < 0x7F ? static_cast<char>(byte) : '.';
+		}
+
+		dump += "|\n";
+	}
+
+	return dump;
+}
+
+// the first bytes pick the case, the base offset and the chunk sizes, the rest is dumped
+static void check_dump(const std::uint8_t* data, std::size_t size) {
+	if (size < 3) {
+		return;
+	}
+
+	std::uint32_t format = (data[0] & 1) != 0 ? hex::uppercase : hex::lowercase;
+	std::uint64_t base_offset = static_cast<std::uint64_t>(data[1]) << ((data[0] >> 1) & 0x3F);
+	std::size_t chunk = 1 + data[2] % 40;
+
+	const std::uint8_t* payload = data + 3;
+	std::size_t payload_size = size - 3;
+
+	std::string dump;
+	auto sink = [&dump](const char* text, std::size_t length) { dump.append(text, length); };
+
+	{
+		hex::dump_writer<decltype(sink)> writer(sink, format, base_offset);
+
+		for (std::size_t offset = 0; offset < payload_size;) {
+			std::size_t length = std::min(chunk, payload_size - offset);
+			writer.write(payload + offset, length);
+
+			chunk = 1 + (chunk * 7 + payload[offset]) % 100;
+			offset += length;
+		}
+	}
+
+	FUZZ_CHECK(dump == reference_dump(payload, payload_size, format, base_offset));
+}
+
+typedef hex::decode_result_t(*decoder_t)(const char*, std::size_t, std::uint8_t*);
+
+static std::vector<decoder_t> decoders(void) {
+	std::vector<decoder_t> kernels = { &hex::detail::decode_scalar_entry };
+
+#if defined(CPU_FEATURES_X86)
+	if (cpu_features::get().ssse3) {
+		kernels.push_back(&hex::detail::decode_ssse3_entry);
+	}
+
+	if (cpu_features::get().avx2) {
+		kernels.push_back(&hex::detail::decode_avx2);
+	}
+#endif
+	return kernels;
+}
+
+static int reference_digit(char c) {
+	const char* digits = "0123456789abcdef";
+	const char* found = c != '\0' ? std::strchr(digits, c >= 'A' && c <= 'F' ? c - 'A' + 'a' : c) : nullptr;
+	return found != nullptr ? static_cast<int>(found - digits) : -1;
+}
+
+static void check_decode(const std::string& text) {
+	static const std::vector<decoder_t> kernels = decoders();
+
+	std::size_t bad = 0;
+	while (bad < text.size() && reference_digit(text[bad]) >= 0) {
+		++bad;
+	}
+
+	std::vector<std::uint8_t> expected(text.size() / 2);
+	for (std::size_t i = 0; i + 1 < text.size() && i + 1 < bad; i += 2) {
+		expected[i / 2] = static_cast<std::uint8_t>(reference_digit(text[i]) * 16 + reference_digit(text[i + 1]));
+	}
+
+	hex::decode_result_t result = hex::decode(text.data(), text.size(), expected.data());
+	if ((text.size() & 1) != 0) {
+		FUZZ_CHECK(result.error == hex::odd_length && result.position == text.size() - 1);
+		return;
+	}
+
+	for (decoder_t kernel : kernels) {
+		std::vector<std::uint8_t> out(text.size() / 2 + 1, static_cast<std::uint8_t>(guard));
+		result = kernel(text.data(), text.size(), out.data());
+
+		FUZZ_CHECK(result.error == (bad == text.size() ? hex::none : hex::invalid_digit));
+		FUZZ_CHECK(result.position == bad);
+		FUZZ_CHECK(out[text.size() / 2] == static_cast<std::uint8_t>(guard));
+
+		if (result.error == hex::none) {
+			FUZZ_CHECK(std::equal(expected.begin(), expected.end(), out.begin()));
+		}
+	}
+}
+
+template <typename T>
+static hex::parse_result_t<T> reference_parse(const std::string& text) {
+	typedef typename std::make_unsigned<T>::type unsigned_t;
+
+	hex::parse_result_t<T> result = { T(), hex::none, text.size() };
+
+	bool negative = std::is_signed<T>::value && !text.empty() && text[0] == '-';
+	std::size_t digits = negative ? 1 : 0;
+
+	if (text.size() - digits >= 2 && text[digits] == '0' && (text[digits + 1] == 'x' || text[digits + 1] == 'X')) {
+		digits += 2;
+	}
+
+	if (digits == text.size()) {
+		result.error = text.empty() ? hex::empty_input : hex::invalid_digit;
+		result.position = digits;
+		return result;
+	}
+
+	unsigned_t magnitude = 0;
+	bool overflow = false;
+
+	for (std::size_t i = digits; i < text.size(); ++i) {
+		int digit = reference_digit(text[i]);
+		if (digit < 0) {
+			result.error = hex::invalid_digit;
+			result.position = i;
+			return result;
+		}
+
+		overflow |= magnitude > (static_cast<unsigned_t>(-1) >> 4);
+		magnitude = static_cast<unsigned_t>(magnitude * 16 + digit);
+	}
+
+	unsigned_t max_positive = static_cast<unsigned_t>(std::numeric_limits<T>::max());
+	if (overflow || magnitude > max_positive + (negative ? 1 : 0)) {
+		result.error = hex::value_overflow;
+		result.position = digits;
+		return result;
+	}
+
+	result.value = static_cast<T>(negative ? static_cast<unsigned_t>(0) - magnitude : magnitude);
+	return result;
+}
+
+template <typename T>
+static void check_parse(const std::string& text) {
+	hex::parse_result_t<T> result = hex::parse<T>(text.data(), text.size());
+	hex::parse_result_t<T> expected = reference_parse<T>(text);
+
+	FUZZ_CHECK(result.error == expected.error);
+	FUZZ_CHECK(result.position == expected.position);
+	FUZZ_CHECK(result.error != hex::none || result.value == expected.value);
+}
+
+extern "C" int LLVMFuzzerTestOneInput(const std::uint8_t* data, std::size_t size) {
+	check_encode(data, size, hex::lowercase);
+	check_encode(data, size, hex::uppercase);
+	check_dump(data, size);
+
+	std::string raw(reinterpret_cast<const char*>(data), size);
+	check_decode(raw);
+
+	// mostly valid text: the encoded input, one character replaced at a place the input picks
+	std::string encoded(size * 2, '\0');
+	hex::encode(data, size, &encoded[0], size != 0 && (data[0] & 1) != 0 ? hex::uppercase : hex::lowercase);
+	check_decode(encoded);
+
+	if (size >= 2) {
+		encoded[(data[0] * 256u + data[1]) % encoded.size()] = static_cast<char>(data[size - 1]);
+		check_decode(encoded);
+	}
+
+	// integers: the start of the raw input, and of the encoded input behind a sign and a prefix
+	std::string number = raw.substr(0, size != 0 ? data[0] % 24 : 0);
+	std::string prefixed = std::string(size != 0 && (data[0] & 2) != 0 ? "-" : "") + (size != 0 && (data[0] & 4) != 0 ? "0x" : "") + encoded.substr(0, size != 0 ? data[0] % 20 : 0);
+
+	for (const std::string& text : { number, prefixed }) {
+		check_parse<std::uint64_t>(text);
+		check_parse<std::int64_t>(text);
+		check_parse<std::uint8_t>(text);
+		check_parse<std::int8_t>(text);
+	}
+
+	return 0;
+}
@@ -0,0 +1,157 @@
+#include "standalone.hpp"
+
+#include "logger.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#if !defined(_WIN32)
+#include <sys/types.h>
+#include <unistd.h>
+#endif
+
+// line formatting (logger::detail::line_t, logger::detail::append):
+//   strings, characters and integers appended into any capacity keep the full length, and the buffer holds the
+//   start of the unbounded line without writing past its capacity
+// output (logger::info_line, logger::debug_line, logger::flush), posix only:
+//   lines of any length, through the ring or written directly past max_line_length, reach stdout complete and in
+//   order once flushed, lines under the minimum level do not
+
+static constexpr char guard = '\x5A';
+
+// the input as a list of parts: a tag byte, then the part's bytes
+static void check_format(const std::uint8_t* data, std::size_t size) {
+	if (size == 0) {
+		return;
+	}
+
+	std::size_t capacity = data[0] % 300;
+	std::vector<char> buffer(capacity + 1, guard);
+	logger::detail::line_t line = { buffer.data(), capacity, 0 };
+	std::string expected;
+
+	for (std::size_t i = 1; i < size;) {
+		std::uint8_t tag = data[i++];
+		std::size_t available = size - i;
+
+		switch (tag % 5) {
+			case 0: {
+				std::size_t count = available < (tag >> 3) ? available : (tag >> 3);
+				std::string part(reinterpret_cast<const char*>(data + i), count);
+				logger::detail::append(line, part);
+				expected += part;
+				i += count;
+				break;
+			}
+			case 1: {
+				std::size_t count = available < (tag >> 3) ? available : (tag >> 3);
+				std::string_view part(reinterpret_cast<const char*>(data + i), count);
+				logger::detail::append(line, part);
+				expected += part;
+				i += count;
+				break;
+			}
+			case 2: {
+				// up to the first nul, as a c string
+				std::string part(reinterpret_cast<const char*>(data + i), available < 16 ? available : 16);
+				part.resize(std::strlen(part.c_str()));
+				logger::detail::append(line, part.c_str());
+				expected += part;
+				i += part.size();
+				break;
+			}
+			case 3: {
+				char c = available != 0 ? static_cast<char>(data[i++]) : 'x';
+				logger::detail::append(line, c);
+				expected += c;
+				break;
+			}
+			default: {
+				std::uint64_t bits = 0;
+				std::size_t count = available < 8 ? available : 8;
+				std::memcpy(&bits, data + i, count);
+				i += count;
+
+				if ((tag & 8) != 0) {
+					logger::detail::append(line, static_cast<std::int64_t>(bits));
+					expected += std::to_string(static_cast<std::int64_t>(bits));
+				} else {
+					logger::detail::append(line, static_cast<std::uint32_t>(bits));
+					expected += std::to_string(static_cast<std::uint32_t>(bits));
+				}
+				break;
+			}
+		}
+	}
+
+	std::size_t kept = expected.size() < capacity ? expected.size() : capacity;
+
+	FUZZ_CHECK(line.length == expected.size());
+	FUZZ_CHECK(expected.compare(0, kept, buffer.data(), kept) == 0);
+	FUZZ_CHECK(buffer[capacity] == guard);
+}
+
+#if !defined(_WIN32)
+// stdout goes to a temporary file for the whole run, read back after every input
+static int captured_stdout(void) {
+	static std::FILE* file = []() {
+		std::FILE* tmp = std::tmpfile();
+		if (tmp == nullptr || ::dup2(::fileno(tmp), 1) == -1) {
+			std::perror("fuzz_logger: capturing stdout");
+			std::abort();
+		}
+
+		return tmp;
+	}();
+
+	return ::fileno(file);
+}
+
+// the input split on new lines, every line logged with the length of the previous one as a number in front
+static void check_output(const std::uint8_t* data, std::size_t size) {
+	int fd = captured_stdout();
+
+	std::string expected;
+	std::size_t previous = 0;
+
+	for (std::size_t begin = 0; begin < size;) {
+		const std::uint8_t* end = static_cast<const std::uint8_t*>(std::memchr(data + begin, '\n', size - begin));
+		std::size_t length = (end != nullptr ? static_cast<std::size_t>(end - data) : size) - begin;
+		std::string_view text(reinterpret_cast<const char*>(data + begin), length);
+
+		// lines starting with an odd byte are debug lines, below the default minimum level
+		if (length != 0 && (data[begin] & 1) != 0) {
+			logger::debug_line(previous, ' ', text);
+		} else {
+			logger::info_line(previous, ' ', text);
+			expected += std::to_string(previous) + ' ' + std::string(text) + '\n';
+		}
+
+		previous = length;
+		begin += length + 1;
+	}
+
+	logger::flush();
+
+	std::string written(static_cast<std::size_t>(::lseek(fd, 0, SEEK_END)), '\0');
+	FUZZ_CHECK(::pread(fd, &written[0], written.size(), 0) == static_cast<ssize_t>(written.size()));
+	FUZZ_CHECK(written == expected);
+
+	FUZZ_CHECK(::ftruncate(fd, 0) == 0);
+	::lseek(fd, 0, SEEK_SET);
+}
+#endif
+
+extern "C" int LLVMFuzzerTestOneInput(const std::uint8_t* data, std::size_t size) {
+	check_format(data, size);
+
+#if !defined(_WIN32)
+	check_output(data, size);
+#endif
+
+	return 0;
+}
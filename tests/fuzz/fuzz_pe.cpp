@@ -0,0 +1,96 @@
+#include "standalone.hpp"
+
+#include "../pe_image.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+// driver image checks (pe::validate), on the raw input and on a valid image of tests/pe_image.hpp with bytes of the
+// header patched and the file cut where the input says:
+//   the result is an error_t, no byte past the end of the image is read (the image is copied to a buffer of its size)
+//   an accepted image has its nt headers, optional header, section table and raw data inside the file and its sections
+//   inside SizeOfImage, as a reference reading every field with 64 bits arithmetic finds them
+//   bytes appended to an accepted image keep it accepted
+
+static const std::uint16_t machines[] = { pe::machine_amd64, pe::machine_arm64, pe::machine_i386 };
+
+template <typename T>
+static T field(const std::vector<std::uint8_t>& image, std::uint64_t offset) {
+	FUZZ_CHECK(offset + sizeof(T) <= image.size());
+
+	T value;
+	std::memcpy(&value, image.data() + offset, sizeof(T));
+	return value;
+}
+
+static void check_accepted(const std::vector<std::uint8_t>& image, std::uint16_t machine, const pe::image_info_t& info) {
+	std::uint64_t nt_headers = field<std::uint32_t>(image, 0x3C);
+	std::uint64_t optional = nt_headers + 4 + 20;
+	std::uint64_t optional_size = field<std::uint16_t>(image, nt_headers + 4 + 16);
+	std::uint64_t section_table = optional + optional_size;
+
+	FUZZ_CHECK(std::memcmp(image.data() + nt_headers, "PE\0\0", 4) == 0);
+	FUZZ_CHECK(info.machine == machine && field<std::uint16_t>(image, nt_headers + 4) == machine);
+	FUZZ_CHECK(info.subsystem == pe::subsystem_native);
+	FUZZ_CHECK(info.section_count != 0 && info.section_count <= pe::max_sections);
+	FUZZ_CHECK(info.size_of_image == field<std::uint32_t>(image, optional + 56));
+	FUZZ_CHECK(field<std::uint32_t>(image, optional + 60) <= image.size());
+	FUZZ_CHECK(section_table + info.section_count * 40ull <= image.size());
+
+	for (std::uint64_t i = 0; i < info.section_count; ++i) {
+		std::uint64_t section = section_table + i * 40;
+		std::uint64_t virtual_size = field<std::uint32_t>(image, section + 8);
+		std::uint64_t virtual_address = field<std::uint32_t>(image, section + 12);
+		std::uint64_t raw_size = field<std::uint32_t>(image, section + 16);
+		std::uint64_t raw_offset = field<std::uint32_t>(image, section + 20);
+
+		FUZZ_CHECK(raw_size == 0 || raw_offset + raw_size <= image.size());
+		FUZZ_CHECK(virtual_address + (virtual_size > raw_size ? virtual_size : raw_size) <= info.size_of_image);
+	}
+}
+
+static void check_image(const std::vector<std::uint8_t>& image, std::uint16_t machine) {
+	pe::image_info_t info;
+	pe::error_t error = pe::validate(image.data(), image.size(), machine, info);
+
+	FUZZ_CHECK(error >= pe::none && error < pe::n_error);
+	if (error != pe::none) {
+		return;
+	}
+
+	check_accepted(image, machine, info);
+
+	std::vector<std::uint8_t> longer(image);
+	longer.resize(image.size() + 1 + image.size() % 61, 0xCC);
+	FUZZ_CHECK(pe::validate(longer.data(), longer.size(), machine, info) == pe::none);
+}
+
+// data[0]: the machine, data[1..2]: the size to cut the image at, then up to 4 patches of the headers (16 bits offset, byte)
+static void check_patched(const std::uint8_t* data, std::size_t size) {
+	if (size < 3) {
+		return;
+	}
+
+	std::uint16_t machine = machines[data[0] % 3];
+	std::vector<std::uint8_t> image = pe_image::build(pe_image::valid(machine));
+
+	for (std::size_t i = 3; i + 2 < size && i < 3 + 4 * 3; i += 3) {
+		image[(data[i] * 256u + data[i + 1]) % pe_image::file_alignment] = data[i + 2];
+	}
+
+	std::size_t cut = data[1] * 256u + data[2];
+	if (cut < image.size()) {
+		image.resize(cut);
+	}
+
+	check_image(image, (data[0] & 0x80) != 0 ? machines[(data[0] + 1) % 3] : machine);
+}
+
+extern "C" int LLVMFuzzerTestOneInput(const std::uint8_t* data, std::size_t size) {
+	check_image(std::vector<std::uint8_t>(data, data + size), pe::host_machine);
+	check_patched(data, size);
+
+	return 0;
+}
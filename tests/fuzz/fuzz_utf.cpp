@@ -0,0 +1,303 @@
+#include "standalone.hpp"
+
+#include "helpers.hpp"
+#include "utf.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+// utf-8 decoding (helpers::to_unicode):
+//   every kernel (scalar, sse2, avx2) agrees on the error, its position and the units written, for 16 and 32 bits units
+//   well formed input per a reference decoder written from the unicode tables decodes to the same code points
+//   from_utf8_length sizes the output and from_utf8_exact does not write past it
+// utf-8 encoding (helpers::to_ansi):
+//   decoded input encodes back to the same bytes with every kernel
+//   the input read as raw 16 and 32 bits units is rejected exactly when it holds an unpaired surrogate (or, in utf-32,
+//   a surrogate or a value past U+10FFFF), every kernel agrees, and what is accepted decodes back to the same units
+
+static constexpr std::uint32_t guard = 0xA5A5A5A5;
+
+// table 3-7 of the unicode standard, one code point at a time
+static bool reference_decode(const std::uint8_t* src, std::size_t length, std::vector<std::uint32_t>& code_points) {
+	code_points.clear();
+
+	for (std::size_t i = 0; i < length;) {
+		std::uint8_t lead = src[i];
+		std::size_t extra = 0;
+		std::uint32_t code_point = 0;
+		std::uint8_t low = 0x80, high = 0xBF;
+
+		if (lead < 0x80) {
+			code_point = lead;
+		} else if (lead >= 0xC2 && lead <= 0xDF) {
+			extra = 1;
+			code_point = lead & 0x1F;
+		} else if (lead >= 0xE0 && lead <= 0xEF) {
+			extra = 2;
+			code_point = lead & 0x0F;
+			low = lead == 0xE0 ? 0xA0 : 0x80;
+			high = lead == 0xED ? 0x9F : 0xBF;
+		} else if (lead >= 0xF0 && lead <= 0xF4) {
+			extra = 3;
+			code_point = lead & 0x07;
+			low = lead == 0xF0 ? 0x90 : 0x80;
+			high = lead == 0xF4 ? 0x8F : 0xBF;
+		} else {
+			return false;
+		}
+
+		if (length - i - 1 < extra) {
+			return false;
+		}
+
+		for (std::size_t k = 1; k <= extra; ++k) {
+			std::uint8_t byte = src[i + k];
+
+			if (byte < (k == 1 ? low : 0x80) || byte > (k == 1 ? high : 0xBF)) {
+				return false;
+			}
+
+			code_point = (code_point << 6) | (byte & 0x3F);
+		}
+
+		code_points.push_back(code_point);
+		i += extra + 1;
+	}
+
+	return true;
+}
+
+template <typename CharT>
+static void expand(const std::vector<std::uint32_t>& code_points, std::vector<CharT>& units) {
+	units.clear();
+
+	for (std::uint32_t code_point : code_points) {
+		if (sizeof(CharT) == 2 && code_point >= 0x10000) {
+			units.push_back(static_cast<CharT>(0xD800 + ((code_point - 0x10000) >> 10)));
+			units.push_back(static_cast<CharT>(0xDC00 + ((code_point - 0x10000) & 0x3FF)));
+		} else {
+			units.push_back(static_cast<CharT>(code_point));
+		}
+	}
+}
+
+template <typename CharT>
+using kernel_t = utf::result_t(*)(const std::uint8_t*, std::size_t, CharT*);
+
+template <typename CharT>
+static std::vector<kernel_t<CharT>> decoders(void) {
+	std::vector<kernel_t<CharT>> kernels = { &utf::detail::from_utf8_scalar_entry<CharT> };
+
+#if defined(CPU_FEATURES_X86)
+	if (cpu_features::get().sse2) {
+		kernels.push_back(&utf::detail::from_utf8_sse2<CharT>);
+	}
+
+	if (cpu_features::get().avx2) {
+		kernels.push_back(&utf::detail::from_utf8_avx2<CharT>);
+	}
+#endif
+	return kernels;
+}
+
+template <typename CharT>
+static void check_decode(const std::uint8_t* data, std::size_t size, bool valid, const std::vector<std::uint32_t>& code_points) {
+	static const std::vector<kernel_t<CharT>> kernels = decoders<CharT>();
+
+	std::vector<CharT> expected;
+	expand(code_points, expected);
+
+	std::vector<CharT> first(size + 1, static_cast<CharT>(guard));
+	utf::result_t first_result = kernels[0](data, size, first.data());
+
+	FUZZ_CHECK((first_result.error == utf::none) == valid);
+	FUZZ_CHECK(first_result.written <= size);
+	FUZZ_CHECK(first_result.position <= size);
+	FUZZ_CHECK(first[size] == static_cast<CharT>(guard));
+
+	if (valid) {
+		FUZZ_CHECK(first_result.position == size);
+		FUZZ_CHECK(first_result.written == expected.size());
+		FUZZ_CHECK(std::equal(expected.begin(), expected.end(), first.begin()));
+		FUZZ_CHECK(utf::from_utf8_length<CharT>(reinterpret_cast<const char*>(data), size) == expected.size());
+	}
+
+	for (std::size_t k = 1; k < kernels.size(); ++k) {
+		std::vector<CharT> units(size + 1, static_cast<CharT>(guard));
+		utf::result_t result = kernels[k](data, size, units.data());
+
+		FUZZ_CHECK(result.error == first_result.error);
+		FUZZ_CHECK(result.position == first_result.position);
+		FUZZ_CHECK(result.written == first_result.written);
+		FUZZ_CHECK(std::equal(units.begin(), units.begin() + result.written, first.begin()));
+		FUZZ_CHECK(units[size] == static_cast<CharT>(guard));
+	}
+
+	if (valid) {
+		// sized exactly, one guard unit right after the output
+		std::vector<CharT> exact(expected.size() + 1, static_cast<CharT>(guard));
+		utf::result_t result = utf::from_utf8_exact(reinterpret_cast<const char*>(data), size, exact.data());
+
+		FUZZ_CHECK(result.error == utf::none);
+		FUZZ_CHECK(result.written == expected.size());
+		FUZZ_CHECK(exact[expected.size()] == static_cast<CharT>(guard));
+	}
+}
+
+template <typename CharT>
+using encoder_t = utf::result_t(*)(const CharT*, std::size_t, char*);
+
+template <typename CharT>
+static std::vector<encoder_t<CharT>> encoders(void) {
+	std::vector<encoder_t<CharT>> kernels = { &utf::detail::to_utf8_scalar_entry<CharT> };
+
+#if defined(CPU_FEATURES_X86)
+	if (cpu_features::get().sse2) {
+		kernels.push_back(&utf::detail::to_utf8_sse2<CharT>);
+	}
+
+	if constexpr (sizeof(CharT) == 2) {
+		if (cpu_features::get().avx2) {
+			kernels.push_back(&utf::detail::to_utf8_avx2<CharT>);
+		}
+	}
+#endif
+	return kernels;
+}
+
+// position of the first unit a strict encoder rejects, length when all are valid
+template <typename CharT>
+static std::size_t reference_invalid_unit(const std::vector<CharT>& units) {
+	for (std::size_t i = 0; i < units.size(); ++i) {
+		std::uint32_t unit = units[i];
+
+		if (sizeof(CharT) == 4 && (unit > 0x10FFFF || (unit >= 0xD800 && unit <= 0xDFFF))) {
+			return i;
+		}
+
+		if (sizeof(CharT) == 2 && unit >= 0xDC00 && unit <= 0xDFFF) {
+			return i;
+		}
+
+		if (sizeof(CharT) == 2 && unit >= 0xD800 && unit <= 0xDBFF) {
+			if (i + 1 == units.size() || units[i + 1] < 0xDC00 || units[i + 1] > 0xDFFF) {
+				return i;
+			}
+
+			++i;
+		}
+	}
+
+	return units.size();
+}
+
+template <typename CharT>
+static void check_encode(const std::vector<CharT>& units, const std::uint8_t* expected, std::size_t expected_size) {
+	static const std::vector<encoder_t<CharT>> kernels = encoders<CharT>();
+
+	std::size_t invalid = reference_invalid_unit(units);
+	std::size_t capacity = utf::max_utf8_length<CharT>(units.size());
+
+	std::vector<char> first(capacity + 1, static_cast<char>(guard));
+	utf::result_t first_result = kernels[0](units.data(), units.size(), first.data());
+
+	FUZZ_CHECK((first_result.error == utf::none) == (invalid == units.size()));
+	FUZZ_CHECK(first_result.position == invalid);
+	FUZZ_CHECK(first_result.written <= capacity);
+	FUZZ_CHECK(first[capacity] == static_cast<char>(guard));
+
+	if (expected != nullptr) {
+		FUZZ_CHECK(first_result.written == expected_size);
+		FUZZ_CHECK(std::equal(expected, expected + expected_size, reinterpret_cast<const std::uint8_t*>(first.data())));
+	}
+
+	for (std::size_t k = 1; k < kernels.size(); ++k) {
+		std::vector<char> bytes(capacity + 1, static_cast<char>(guard));
+		utf::result_t result = kernels[k](units.data(), units.size(), bytes.data());
+
+		FUZZ_CHECK(result.error == first_result.error);
+		FUZZ_CHECK(result.position == first_result.position);
+		FUZZ_CHECK(result.written == first_result.written);
+		FUZZ_CHECK(std::equal(bytes.begin(), bytes.begin() + result.written, first.begin()));
+		FUZZ_CHECK(bytes[capacity] == static_cast<char>(guard));
+	}
+
+	if (first_result.error != utf::none) {
+		return;
+	}
+
+	std::size_t length = utf::to_utf8_length(units.data(), units.size());
+	FUZZ_CHECK(length == first_result.written);
+
+	std::vector<char> exact(length + 1, static_cast<char>(guard));
+	utf::result_t result = utf::to_utf8_exact(units.data(), units.size(), exact.data());
+	FUZZ_CHECK(result.error == utf::none && result.written == length);
+	FUZZ_CHECK(exact[length] == static_cast<char>(guard));
+
+	// and back
+	std::vector<CharT> decoded(length + 1);
+	result = utf::from_utf8(first.data(), length, decoded.data());
+	FUZZ_CHECK(result.error == utf::none);
+	FUZZ_CHECK(result.written == units.size());
+	FUZZ_CHECK(std::equal(units.begin(), units.end(), decoded.begin()));
+}
+
+template <typename CharT>
+static void raw_units(const std::uint8_t* data, std::size_t size, std::vector<CharT>& units) {
+	units.resize(size / sizeof(CharT));
+	std::memcpy(units.data(), data, units.size() * sizeof(CharT));
+}
+
+// the buffer api behind the registry paths: required length on overflow, npos on malformed input
+// (a four bytes lead alone counts two utf-16 units, malformed input may claim twice its length)
+static void check_buffer(const std::uint8_t* data, std::size_t size, bool valid, std::size_t units) {
+	const char* str = reinterpret_cast<const char*>(data);
+	std::vector<wchar_t> buffer(2 * size + 2, static_cast<wchar_t>(0x5A5A));
+
+	std::size_t written = helpers::to_unicode(str, size, buffer.data(), buffer.size());
+	FUZZ_CHECK(written == (valid ? units : helpers::npos));
+
+	if (valid) {
+		FUZZ_CHECK(buffer[units] == L'\0');
+
+		// too small by one: the terminator does not fit
+		std::vector<wchar_t> small(units + 1, static_cast<wchar_t>(0x5A5A));
+		FUZZ_CHECK(helpers::to_unicode(str, size, small.data(), units) == units);
+		FUZZ_CHECK(helpers::to_unicode(str, size, small.data(), units + 1) == units);
+		FUZZ_CHECK(small[units] == L'\0');
+	}
+}
+
+extern "C" int LLVMFuzzerTestOneInput(const std::uint8_t* data, std::size_t size) {
+	std::vector<std::uint32_t> code_points;
+	bool valid = reference_decode(data, size, code_points);
+
+	check_decode<char16_t>(data, size, valid, code_points);
+	check_decode<char32_t>(data, size, valid, code_points);
+
+	std::vector<wchar_t> units;
+	expand(code_points, units);
+	check_buffer(data, size, valid, units.size());
+
+	std::vector<char16_t> units_16;
+	std::vector<char32_t> units_32;
+
+	if (valid) {
+		expand(code_points, units_16);
+		expand(code_points, units_32);
+
+		check_encode(units_16, data, size);
+		check_encode(units_32, data, size);
+	}
+
+	raw_units(data, size, units_16);
+	raw_units(data, size, units_32);
+
+	check_encode(units_16, nullptr, 0);
+	check_encode(units_32, nullptr, 0);
+
+	return 0;
+}
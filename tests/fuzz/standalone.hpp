@@ -0,0 +1,164 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <random>
+#include <string>
+#include <vector>
+
+// libFuzzer targets of tests/fuzz, also built as standalone programs by tools/run_tests.py
+//
+// the standalone main runs the target over every file argument, or over -runs=<n> generated inputs of at most
+// -max_len=<n> bytes from -seed=<n>; inputs mix ascii runs, well formed utf-8 sequences of every length and raw bytes
+// built with -DFUZZING_BUILD_MODE_UNSAFE_FOR_PRODUCTION and -fsanitize=fuzzer, libFuzzer provides main and the mutations
+
+extern "C" int LLVMFuzzerTestOneInput(const std::uint8_t* data, std::size_t size);
+
+namespace fuzz {
+
+	namespace detail {
+
+		typedef struct _input_t {
+			const std::uint8_t* data;
+			std::size_t size;
+		} input_t, *pinput_t;
+
+		static input_t& current_input(void) {
+			static input_t input = {};
+			return input;
+		}
+	}
+
+	// prints the failed condition and the input in hex, then aborts so libFuzzer (or the sanitizers) keep the crash
+	[[noreturn]] static void fail(const char* condition, const char* file, int line) {
+		const detail::input_t& input = detail::current_input();
+
+		std::fprintf(stderr, "%s:%d: check failed: %s\ninput (%zu bytes):", file, line, condition, input.size);
+		for (std::size_t i = 0; i < input.size; ++i) {
+			std::fprintf(stderr, "%s%02x", i % 32 == 0 ? "\n  " : " ", input.data[i]);
+		}
+
+		std::fprintf(stderr, "\n");
+		std::abort();
+	}
+}
+
+#define FUZZ_CHECK(condition) ((condition) ? (void)0 : fuzz::fail(#condition, __FILE__, __LINE__))
+
+#if !defined(FUZZING_BUILD_MODE_UNSAFE_FOR_PRODUCTION)
+namespace fuzz {
+
+	static void utf8_sequence(std::uint32_t code_point, std::vector<std::uint8_t>& out) {
+		if (code_point < 0x80) {
+			out.push_back(static_cast<std::uint8_t>(code_point));
+		} else if (code_point < 0x800) {
+			out.push_back(static_cast<std::uint8_t>(0xC0 | (code_point >> 6)));
+			out.push_back(static_cast<std::uint8_t>(0x80 | (code_point & 0x3F)));
+		} else if (code_point < 0x10000) {
+			out.push_back(static_cast<std::uint8_t>(0xE0 | (code_point >> 12)));
+			out.push_back(static_cast<std::uint8_t>(0x80 | ((code_point >> 6) & 0x3F)));
+			out.push_back(static_cast<std::uint8_t>(0x80 | (code_point & 0x3F)));
+		} else {
+			out.push_back(static_cast<std::uint8_t>(0xF0 | (code_point >> 18)));
+			out.push_back(static_cast<std::uint8_t>(0x80 | ((code_point >> 12) & 0x3F)));
+			out.push_back(static_cast<std::uint8_t>(0x80 | ((code_point >> 6) & 0x3F)));
+			out.push_back(static_cast<std::uint8_t>(0x80 | (code_point & 0x3F)));
+		}
+	}
+
+	static void generate(std::minstd_rand& random, std::size_t max_length, std::vector<std::uint8_t>& input) {
+		std::size_t length = std::uniform_int_distribution<std::size_t>(0, max_length)(random);
+
+		input.clear();
+
+		while (input.size() < length) {
+			switch (random() % 4) {
+				case 0: {
+					// long enough to cross the 16 and 32 bytes blocks of the vectorized paths
+					std::size_t run = random() % 80;
+					for (std::size_t i = 0; i < run; ++i) {
+						input.push_back(static_cast<std::uint8_t>(0x20 + random() % 0x5F));
+					}
+					break;
+				}
+				case 1: {
+					constexpr std::uint32_t bounds[] = { 0x80, 0x800, 0x10000, 0x110000 };
+					std::uint32_t code_point = static_cast<std::uint32_t>(random()) % bounds[random() % 4];
+					utf8_sequence(code_point, input);
+					break;
+				}
+				case 2: {
+					// boundaries of the encodings: surrogates, last code points of each length, out of range
+					constexpr std::uint32_t edges[] = { 0x7F, 0x80, 0x7FF, 0x800, 0xD7FF, 0xD800, 0xDBFF, 0xDC00, 0xDFFF, 0xE000, 0xFFFF, 0x10000, 0x10FFFF, 0x110000 };
+					utf8_sequence(edges[random() % (sizeof(edges) / sizeof(edges[0]))], input);
+					break;
+				}
+				default:
+					input.push_back(static_cast<std::uint8_t>(random()));
+					break;
+			}
+		}
+
+		input.resize(length);
+	}
+
+	static int run(const std::uint8_t* data, std::size_t size) {
+		detail::current_input() = { data, size };
+		return LLVMFuzzerTestOneInput(data, size);
+	}
+}
+
+int main(int argc, char* argv[]) {
+	unsigned long runs = 10000;
+	unsigned long max_length = 4096;
+	unsigned long seed = 1;
+	std::vector<std::string> files;
+
+	for (int i = 1; i < argc; ++i) {
+		std::string argument = argv[i];
+
+		if (argument.rfind("-runs=", 0) == 0) {
+			runs = std::strtoul(argument.c_str() + 6, nullptr, 10);
+		} else if (argument.rfind("-max_len=", 0) == 0) {
+			max_length = std::strtoul(argument.c_str() + 9, nullptr, 10);
+		} else if (argument.rfind("-seed=", 0) == 0) {
+			seed = std::strtoul(argument.c_str() + 6, nullptr, 10);
+		} else {
+			files.push_back(argument);
+		}
+	}
+
+	std::vector<std::uint8_t> input;
+
+	for (const std::string& file : files) {
+		std::ifstream stream(file, std::ios::binary);
+		if (!stream) {
+			std::fprintf(stderr, "cannot read %s\n", file.c_str());
+			return 1;
+		}
+
+		input.assign(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>());
+		fuzz::run(input.data(), input.size());
+	}
+
+	if (!files.empty()) {
+		std::printf("%zu inputs passed\n", files.size());
+		return 0;
+	}
+
+	std::minstd_rand random(static_cast<std::minstd_rand::result_type>(seed));
+
+	for (unsigned long i = 0; i < runs; ++i) {
+		fuzz::generate(random, max_length, input);
+		fuzz::run(input.data(), input.size());
+	}
+
+	std::printf("%lu inputs passed (seed %lu, max_len %lu)\n", runs, seed, max_length);
+	return 0;
+}
+#endif
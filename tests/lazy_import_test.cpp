@@ -0,0 +1,84 @@
+#include "test.hpp"
+
+#include "backend.hpp"
+
+#include <cstdint>
+
+// lazy_loader_light::lazyimport::call reaches the callee with the values the caller passed, lvalues included:
+// stubs with the signatures of NtQuerySystemInformation and NtLoadDriver record what they receive, called the way
+// win32_backend calls the ntdll exports (ULONG as std::uint32_t, for the posix build)
+
+typedef struct _received_t {
+	std::uint32_t information_class;
+	void* buffer;
+	std::uint32_t length;
+	std::uint32_t* required;
+	drv_loader::UNICODE_STRING* registry_path;
+} received_t, *preceived_t;
+
+static received_t received = {};
+
+static NTSTATUS query_system_information_stub(std::uint32_t information_class, void* buffer, std::uint32_t length, std::uint32_t* required) {
+	received.information_class = information_class;
+	received.buffer = buffer;
+	received.length = length;
+	received.required = required;
+	*required = length * 2;
+	return STATUS_INFO_LENGTH_MISMATCH;
+}
+
+static NTSTATUS load_driver_stub(drv_loader::UNICODE_STRING* registry_path) {
+	received.registry_path = registry_path;
+	return registry_path->Length;
+}
+
+static lazy_loader_light::lazyimport stub(const char* name, std::uintptr_t ptr) {
+	return lazy_loader_light::lazyimport(name, ptr);
+}
+
+static void lvalues_reach_the_callee(void) {
+	received = {};
+	lazy_loader_light::lazyimport query = stub("query_system_information_stub", reinterpret_cast<std::uintptr_t>(&query_system_information_stub));
+
+	const std::uint32_t system_module_information = 11;
+	std::uint8_t buffer[16] = {};
+	void* data = buffer;
+	std::uint32_t size = sizeof(buffer);
+	std::uint32_t required = 0;
+
+	CHECK(query.call<NTSTATUS>(system_module_information, data, size, &required) == STATUS_INFO_LENGTH_MISMATCH);
+	CHECK(received.information_class == 11);
+	CHECK(received.buffer == buffer);
+	CHECK(received.length == sizeof(buffer));
+	CHECK(received.required == &required);
+	CHECK(required == sizeof(buffer) * 2);
+
+	wchar_t name[] = L"\\Registry\\Machine\\System\\CurrentControlSet\\Services\\Stub";
+	drv_loader::UNICODE_STRING path = { 6, 8, name };
+	drv_loader::UNICODE_STRING* registry_path = &path;
+
+	received = {};
+	lazy_loader_light::lazyimport load = stub("load_driver_stub", reinterpret_cast<std::uintptr_t>(&load_driver_stub));
+
+	CHECK(load.call<NTSTATUS>(registry_path) == 6);
+	CHECK(received.registry_path == &path);
+}
+
+static void prvalues_and_operator_reach_the_callee(void) {
+	received = {};
+	lazy_loader_light::lazyimport query = stub("query_system_information_stub", reinterpret_cast<std::uintptr_t>(&query_system_information_stub));
+
+	std::uint32_t required = 0;
+	CHECK(query.operator()<NTSTATUS>(std::uint32_t(11), static_cast<void*>(nullptr), std::uint32_t(32), &required) == STATUS_INFO_LENGTH_MISMATCH);
+	CHECK(received.information_class == 11);
+	CHECK(received.buffer == nullptr);
+	CHECK(received.length == 32);
+	CHECK(required == 64);
+}
+
+int main(void) {
+	lvalues_reach_the_callee();
+	prvalues_and_operator_reach_the_callee();
+
+	return test::result();
+}
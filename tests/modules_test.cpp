@@ -0,0 +1,232 @@
+#include "test.hpp"
+
+#include "drv-loader.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+// SystemModuleInformation parsing (modules::module_list) and the base name index (modules::module_index, through
+// drv_loader::index_modules and drv_loader::find_module for the host layout):
+//   x64 and x86 blobs give back every field, base names are found case insensitively, unknown ones are not
+//   a module count larger than the blob holds, down to a blob shorter than its header, rejects the whole blob
+//   malformed entries (OffsetToFileName past the path, FullPathName without a nul) stay inside their entry
+//   the modules the simulated kernel reports are found by the base name of their image
+
+typedef struct _entry_t {
+	std::uint64_t image_base;
+	std::uint32_t image_size;
+	std::uint16_t load_count;
+	std::string full_path;
+	std::uint16_t offset_to_file_name;
+} entry_t, *pentry_t;
+
+static entry_t entry(std::uint64_t image_base, const std::string& full_path) {
+	std::size_t separator = full_path.find_last_of('\\');
+	return { image_base, 0x10000, 1, full_path, static_cast<std::uint16_t>(separator == std::string::npos ? 0 : separator + 1) };
+}
+
+// count is written as given, the entries after it; FullPathName is nul terminated when the path leaves room for it
+static std::vector<std::uint8_t> blob(const modules::layout_t& layout, std::uint32_t count, const std::vector<entry_t>& entries) {
+	std::vector<std::uint8_t> out(layout.header_size + entries.size() * layout.entry_size, 0);
+	std::memcpy(out.data(), &count, sizeof(count));
+
+	for (std::size_t i = 0; i < entries.size(); ++i) {
+		std::uint8_t* at = out.data() + layout.header_size + i * layout.entry_size;
+		std::uint16_t load_order_index = static_cast<std::uint16_t>(i);
+		std::size_t path_length = entries[i].full_path.size() < modules::max_full_path_name ? entries[i].full_path.size() : modules::max_full_path_name;
+
+		std::memcpy(at + layout.image_base, &entries[i].image_base, layout.pointer_size);
+		std::memcpy(at + layout.image_size, &entries[i].image_size, sizeof(std::uint32_t));
+		std::memcpy(at + layout.load_order_index, &load_order_index, sizeof(load_order_index));
+		std::memcpy(at + layout.load_count, &entries[i].load_count, sizeof(std::uint16_t));
+		std::memcpy(at + layout.offset_to_file_name, &entries[i].offset_to_file_name, sizeof(std::uint16_t));
+		std::memcpy(at + layout.full_path_name, entries[i].full_path.data(), path_length);
+	}
+
+	return out;
+}
+
+static const std::vector<entry_t> kernel_modules = {
+	entry(0xFFFFF80012000000ull, "\\SystemRoot\\system32\\ntoskrnl.exe"),
+	entry(0xFFFFF80013400000ull, "\\SystemRoot\\System32\\drivers\\ACPI.sys"),
+	entry(0xFFFFF80014800000ull, "\\??\\C:\\drivers\\my driver.sys"),
+};
+
+static void check_lookups(const modules::module_index& index, std::uint64_t base_mask) {
+	CHECK(index.size() == kernel_modules.size());
+
+	for (std::size_t i = 0; i < kernel_modules.size(); ++i) {
+		CHECK(index.at(i).image_base == (kernel_modules[i].image_base & base_mask));
+		CHECK(index.at(i).image_size == 0x10000);
+		CHECK(index.at(i).load_order_index == i);
+		CHECK(index.at(i).load_count == 1);
+		CHECK(index.at(i).full_path == kernel_modules[i].full_path);
+	}
+
+	const modules::module_t* acpi = drv_loader::find_module(index, "acpi.SYS");
+	CHECK(acpi != nullptr && acpi->base_name == "ACPI.sys" && acpi->image_base == (kernel_modules[1].image_base & base_mask));
+
+	const modules::module_t* mine = drv_loader::find_module(index, "MY DRIVER.sys");
+	CHECK(mine != nullptr && mine->full_path == "\\??\\C:\\drivers\\my driver.sys");
+
+	CHECK(drv_loader::find_module(index, "ntoskrnl.exe") == &index.at(0));
+	CHECK(drv_loader::find_module(index, "ntoskrnl") == nullptr);
+	CHECK(drv_loader::find_module(index, "missing.sys") == nullptr);
+	CHECK(drv_loader::find_module(index, "") == nullptr);
+}
+
+static void x64_blob(void) {
+	std::vector<std::uint8_t> bytes = blob(modules::layout_x64, 3, kernel_modules);
+
+	modules::module_list list;
+	CHECK(list.assign(bytes.data(), bytes.size(), modules::layout_x64));
+	CHECK(list.size() == 3);
+
+	modules::module_index index;
+	index.build(list);
+	check_lookups(index, ~0ull);
+
+	if (sizeof(void*) == 8) {
+		modules::module_index host;
+		CHECK(!drv_loader::index_modules(bytes, host).failed());
+		check_lookups(host, ~0ull);
+	}
+}
+
+static void x86_blob(void) {
+	std::vector<std::uint8_t> bytes = blob(modules::layout_x86, 3, kernel_modules);
+
+	modules::module_list list;
+	CHECK(list.assign(bytes.data(), bytes.size(), modules::layout_x86));
+
+	// image bases are 32 bits pointers
+	modules::module_index index;
+	index.build(list);
+	check_lookups(index, 0xFFFFFFFFull);
+
+	// the same bytes read with the other layout do not line up with their count
+	CHECK(!list.assign(bytes.data(), bytes.size(), modules::layout_x64));
+}
+
+static void counts_past_the_blob(void) {
+	const modules::layout_t* layouts[] = { &modules::layout_x64, &modules::layout_x86 };
+
+	for (const modules::layout_t* layout : layouts) {
+		modules::module_list list;
+
+		std::vector<std::uint8_t> truncated = blob(*layout, 3, kernel_modules);
+		truncated.pop_back();
+		CHECK(!list.assign(truncated.data(), truncated.size(), *layout));
+		CHECK(list.size() == 0);
+
+		std::vector<std::uint8_t> oversized = blob(*layout, 0xFFFFFFFF, kernel_modules);
+		CHECK(!list.assign(oversized.data(), oversized.size(), *layout));
+
+		std::vector<std::uint8_t> one_more = blob(*layout, 4, kernel_modules);
+		CHECK(!list.assign(one_more.data(), one_more.size(), *layout));
+
+		// shorter than the module count itself
+		std::vector<std::uint8_t> header = blob(*layout, 0, {});
+		CHECK(list.assign(header.data(), header.size(), *layout) && list.size() == 0);
+		CHECK(!list.assign(header.data(), layout->header_size - 1, *layout));
+		CHECK(!list.assign(header.data(), 0, *layout));
+
+		// trailing bytes past the listed modules are ignored
+		std::vector<std::uint8_t> fewer = blob(*layout, 2, kernel_modules);
+		CHECK(list.assign(fewer.data(), fewer.size(), *layout) && list.size() == 2);
+	}
+
+	std::vector<std::uint8_t> truncated = blob(modules::host_layout, 3, kernel_modules);
+	truncated.resize(truncated.size() - modules::host_layout.entry_size / 2);
+
+	modules::module_index index;
+	drv_loader::loader_error_t status = drv_loader::index_modules(truncated, index);
+	CHECK(status.failed() && status.code == ERROR_INVALID_DATA && status.phase == drv_loader::phase_index_modules);
+
+	// an empty list finds nothing
+	std::vector<std::uint8_t> empty = blob(modules::host_layout, 0, {});
+	CHECK(!drv_loader::index_modules(empty, index).failed());
+	CHECK(index.size() == 0 && drv_loader::find_module(index, "ntoskrnl.exe") == nullptr);
+}
+
+static void malformed_entries(void) {
+	std::vector<entry_t> entries = {
+		entry(0x1000, "\\SystemRoot\\system32\\hal.dll"),
+		entry(0x2000, std::string(300, 'x')),
+		entry(0x3000, "\\SystemRoot\\system32\\duplicate.sys"),
+		entry(0x4000, "\\??\\C:\\other\\DUPLICATE.SYS"),
+	};
+	entries[0].offset_to_file_name = 0xFFFF;
+
+	std::vector<std::uint8_t> bytes = blob(modules::host_layout, 4, entries);
+	modules::module_index index;
+	CHECK(!drv_loader::index_modules(bytes, index).failed());
+
+	// the full path stands for the base name
+	CHECK(index.at(0).base_name == index.at(0).full_path);
+	CHECK(drv_loader::find_module(index, "\\SystemRoot\\system32\\hal.dll") == &index.at(0));
+
+	// no nul: the path ends with FullPathName, the next entry is not read
+	CHECK(index.at(1).full_path == std::string(modules::max_full_path_name, 'x'));
+
+	// the first module keeps a repeated base name
+	const modules::module_t* duplicate = drv_loader::find_module(index, "duplicate.sys");
+	CHECK(duplicate != nullptr && duplicate->image_base == 0x3000);
+}
+
+// enough modules to wrap probe sequences around the table
+static void many_modules(void) {
+	std::vector<entry_t> entries;
+
+	for (std::uint64_t i = 0; i < 600; ++i) {
+		entries.push_back(entry(0x10000 * (i + 1), "\\SystemRoot\\System32\\drivers\\driver" + std::to_string(i) + ".sys"));
+	}
+
+	std::vector<std::uint8_t> bytes = blob(modules::host_layout, static_cast<std::uint32_t>(entries.size()), entries);
+	modules::module_index index;
+	CHECK(!drv_loader::index_modules(bytes, index).failed());
+
+	std::size_t found = 0;
+	for (std::uint64_t i = 0; i < entries.size(); ++i) {
+		const modules::module_t* module = drv_loader::find_module(index, "DRIVER" + std::to_string(i) + ".SYS");
+		found += module != nullptr && module->image_base == 0x10000 * (i + 1);
+	}
+
+	CHECK(found == entries.size());
+	CHECK(drv_loader::find_module(index, "driver600.sys") == nullptr);
+}
+
+static void simulated_kernel_modules(void) {
+	simulated::kernel::instance().reset();
+	simulated::kernel::instance().set_latency({});
+	simulated::kernel::instance().set_check_images(false);
+
+	drv_loader::config_t config = {};
+	config.display_name = "ModulesTest";
+	config.file_path = "modules_test_driver.sys";
+	config.operation = drv_loader::loader_operation_t::load;
+
+	drv_loader::report_t report = {};
+	CHECK(!drv_loader::load_unload<drv_loader::simulated_backend>(config, report).failed());
+
+	std::vector<std::uint8_t> bytes;
+	modules::module_index index;
+	CHECK(!drv_loader::query_modules<drv_loader::simulated_backend>(bytes).failed());
+	CHECK(!drv_loader::index_modules(bytes, index).failed());
+
+	const modules::module_t* module = drv_loader::find_module(index, "Modules_Test_Driver.sys");
+	CHECK(module != nullptr && module->base_name == "modules_test_driver.sys");
+}
+
+int main(void) {
+	x64_blob();
+	x86_blob();
+	counts_past_the_blob();
+	malformed_entries();
+	many_modules();
+	simulated_kernel_modules();
+
+	return test::result();
+}
@@ -0,0 +1,71 @@
+#include "test.hpp"
+
+#include "ntstatus_win32.hpp"
+
+// ntstatus_win32::to_win32 gives the same win32 error as ntdll!RtlNtStatusToDosError for every status of the range
+// table, and for the statuses passed through by rule (success, customer codes, FACILITY_NTWIN32, wrapped HRESULTs)
+// windows only: elsewhere there is no ntdll to compare against and the program passes without checks
+
+#if defined(_WIN32)
+#define NOMINMAX
+#include <windows.h>
+
+#include <cstdint>
+#include <cstdio>
+
+typedef ULONG(NTAPI* rtl_nt_status_to_dos_error_t)(LONG status);
+
+static bool matches_ntdll(rtl_nt_status_to_dos_error_t rtl_nt_status_to_dos_error, std::uint32_t status) {
+	std::uint32_t expected = rtl_nt_status_to_dos_error(static_cast<LONG>(status));
+	std::uint32_t actual = ntstatus_win32::to_win32(status);
+
+	if (actual != expected) {
+		std::fprintf(stderr, "status 0x%08X: to_win32 %u, RtlNtStatusToDosError %u\n", status, actual, expected);
+		return false;
+	}
+
+	return true;
+}
+
+static void ranges_match_ntdll(rtl_nt_status_to_dos_error_t rtl_nt_status_to_dos_error) {
+	for (const ntstatus_win32::range_t& range : ntstatus_win32::ranges) {
+		for (std::uint32_t i = 0; i < range.count; ++i) {
+			CHECK(matches_ntdll(rtl_nt_status_to_dos_error, range.first + i));
+		}
+	}
+}
+
+static void pass_through_matches_ntdll(rtl_nt_status_to_dos_error_t rtl_nt_status_to_dos_error) {
+	const std::uint32_t statuses[] = {
+		0x00000000, // STATUS_SUCCESS
+		0x20000001, // customer, success
+		0xE0001234, // customer, error
+		0x80070005, // FACILITY_NTWIN32 warning, ERROR_ACCESS_DENIED
+		0xC0070002, // FACILITY_NTWIN32 error, ERROR_FILE_NOT_FOUND
+		0xC00704C7, // FACILITY_NTWIN32 error, ERROR_CANCELLED
+		0xC0010005, // FACILITY_DEBUGGER error
+		0xD0000022, // HRESULT_FROM_NT(STATUS_ACCESS_DENIED)
+		0xD0000034, // HRESULT_FROM_NT(STATUS_OBJECT_NAME_NOT_FOUND)
+	};
+
+	for (std::uint32_t status : statuses) {
+		CHECK(matches_ntdll(rtl_nt_status_to_dos_error, status));
+	}
+}
+#endif
+
+int main(void) {
+#if defined(_WIN32)
+	HMODULE ntdll = ::GetModuleHandleA("ntdll.dll");
+	rtl_nt_status_to_dos_error_t rtl_nt_status_to_dos_error = ntdll != nullptr
+		? reinterpret_cast<rtl_nt_status_to_dos_error_t>(reinterpret_cast<std::uintptr_t>(::GetProcAddress(ntdll, "RtlNtStatusToDosError")))
+		: nullptr;
+
+	if (CHECK(rtl_nt_status_to_dos_error != nullptr)) {
+		ranges_match_ntdll(rtl_nt_status_to_dos_error);
+		pass_through_matches_ntdll(rtl_nt_status_to_dos_error);
+	}
+#endif
+
+	return test::result();
+}
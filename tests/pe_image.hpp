@@ -0,0 +1,132 @@
+#pragma once
+
+#include "pe.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+// minimal driver images in memory for pe_test.cpp and fuzz/fuzz_pe.cpp, the images of tools/gen_pe_fixtures.py
+// the defaults give a valid native driver (PE32+, or PE32 for i386) with one .text section whose entry point returns
+// STATUS_SUCCESS; changing one field of image_t breaks the rule of pe::validate that reads it
+
+namespace pe_image {
+
+	constexpr std::uint32_t file_alignment = 0x200;
+	constexpr std::uint32_t section_alignment = 0x1000;
+
+	typedef struct _image_t {
+		std::uint16_t machine;
+		char dos_magic[2];
+		std::uint32_t nt_headers;                   // e_lfanew
+		char signature[4];
+		std::uint16_t section_count;
+		std::uint16_t optional_header_size;
+		std::uint16_t characteristics;
+		std::uint16_t optional_magic;
+		std::uint32_t section_alignment;
+		std::uint32_t file_alignment;
+		std::uint32_t size_of_image;
+		std::uint32_t size_of_headers;
+		std::uint16_t subsystem;
+		std::uint32_t virtual_size;
+		std::uint32_t section_address;
+		std::uint32_t raw_size;
+		std::uint32_t raw_offset;
+	} image_t, *pimage_t;
+
+	static image_t valid(std::uint16_t machine) {
+		bool pe32 = machine == pe::machine_i386;
+
+		image_t image = {};
+		image.machine = machine;
+		std::memcpy(image.dos_magic, "MZ", 2);
+		image.nt_headers = 0x40;
+		std::memcpy(image.signature, "PE\0\0", 4);
+		image.section_count = 1;
+		image.optional_header_size = pe32 ? 224 : 240; // with 16 data directories
+		image.characteristics = 0x0022;
+		image.optional_magic = pe32 ? pe::optional_magic_pe32 : pe::optional_magic_pe32_plus;
+		image.section_alignment = section_alignment;
+		image.file_alignment = file_alignment;
+		image.size_of_image = 2 * section_alignment;
+		image.size_of_headers = file_alignment;
+		image.subsystem = pe::subsystem_native;
+		image.virtual_size = 8;
+		image.section_address = section_alignment;
+		image.raw_size = file_alignment;
+		image.raw_offset = file_alignment;
+		return image;
+	}
+
+	namespace detail {
+
+		template <typename T>
+		static void write(std::vector<std::uint8_t>& out, std::size_t offset, T value) {
+			std::memcpy(out.data() + offset, &value, sizeof(T));
+		}
+	}
+
+	// headers in the first file_alignment bytes (a section header past them is left out), then the code section
+	static std::vector<std::uint8_t> build(const image_t& image) {
+		// mov w0, #0; ret on arm64, xor eax, eax; ret elsewhere
+		static const std::uint8_t arm64_code[] = { 0x00, 0x00, 0x80, 0x52, 0xC0, 0x03, 0x5F, 0xD6 };
+		static const std::uint8_t x86_code[] = { 0x31, 0xC0, 0xC3 };
+
+		bool pe32 = image.optional_magic == pe::optional_magic_pe32;
+		std::vector<std::uint8_t> out(file_alignment, 0);
+
+		std::memcpy(out.data(), image.dos_magic, 2);
+		detail::write<std::uint32_t>(out, 0x3C, image.nt_headers);
+
+		// an e_lfanew inside the dos header or past 0x80 points nowhere, the headers stay where they would be
+		std::size_t nt = image.nt_headers >= 0x40 && image.nt_headers <= 0x80 ? image.nt_headers : 0x40;
+		std::memcpy(out.data() + nt, image.signature, 4);
+
+		std::size_t file_header = nt + 4;
+		detail::write<std::uint16_t>(out, file_header, image.machine);
+		detail::write<std::uint16_t>(out, file_header + 2, image.section_count);
+		detail::write<std::uint16_t>(out, file_header + 16, image.optional_header_size);
+		detail::write<std::uint16_t>(out, file_header + 18, image.characteristics);
+
+		std::size_t optional = file_header + 20;
+		detail::write<std::uint16_t>(out, optional, image.optional_magic);
+		detail::write<std::uint8_t>(out, optional + 2, 14);
+		detail::write<std::uint32_t>(out, optional + 4, file_alignment);
+		detail::write<std::uint32_t>(out, optional + 16, image.section_address);
+		detail::write<std::uint32_t>(out, optional + 20, image.section_address);
+		if (pe32) {
+			detail::write<std::uint32_t>(out, optional + 28, 0x00400000);
+		} else {
+			detail::write<std::uint64_t>(out, optional + 24, 0x140000000);
+		}
+		detail::write<std::uint32_t>(out, optional + 32, image.section_alignment);
+		detail::write<std::uint32_t>(out, optional + 36, image.file_alignment);
+		detail::write<std::uint16_t>(out, optional + 40, 10);
+		detail::write<std::uint16_t>(out, optional + 44, 10);
+		detail::write<std::uint16_t>(out, optional + 48, 10);
+		detail::write<std::uint32_t>(out, optional + 56, image.size_of_image);
+		detail::write<std::uint32_t>(out, optional + 60, image.size_of_headers);
+		detail::write<std::uint16_t>(out, optional + 68, image.subsystem);
+		detail::write<std::uint16_t>(out, optional + 70, 0x0160);
+		detail::write<std::uint32_t>(out, optional + (pe32 ? 92 : 108), 16);
+
+		std::size_t section = optional + image.optional_header_size;
+		if (section + 40 <= file_alignment) {
+			std::memcpy(out.data() + section, ".text", 5);
+			detail::write<std::uint32_t>(out, section + 8, image.virtual_size);
+			detail::write<std::uint32_t>(out, section + 12, image.section_address);
+			detail::write<std::uint32_t>(out, section + 16, image.raw_size);
+			detail::write<std::uint32_t>(out, section + 20, image.raw_offset);
+			detail::write<std::uint32_t>(out, section + 36, 0x60000020);
+		}
+
+		out.resize(2 * file_alignment, 0);
+
+		const std::uint8_t* code = image.machine == pe::machine_arm64 ? arm64_code : x86_code;
+		std::size_t code_size = image.machine == pe::machine_arm64 ? sizeof(arm64_code) : sizeof(x86_code);
+		std::memcpy(out.data() + file_alignment, code, code_size);
+
+		return out;
+	}
+}
@@ -0,0 +1,202 @@
+#include "test.hpp"
+
+#include "pe_image.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+// pe::validate on the images of tools/gen_pe_fixtures.py built in memory: the valid driver of each machine passes,
+// each rejection rule gives its error_t, and offsets past the end of the file or overflowing 32 bits are caught
+// before anything is read there (the image is a vector of its exact size, the sanitizers see any read past it)
+
+static pe::error_t validate(const std::vector<std::uint8_t>& bytes, std::uint16_t machine) {
+	pe::image_info_t info;
+	std::vector<std::uint8_t> exact(bytes.begin(), bytes.end());
+	return pe::validate(exact.data(), exact.size(), machine, info);
+}
+
+static pe::error_t validate(const pe_image::image_t& image) {
+	return validate(pe_image::build(image), image.machine);
+}
+
+static void valid_images_pass(void) {
+	const std::uint16_t machines[] = { pe::machine_amd64, pe::machine_arm64, pe::machine_i386 };
+
+	for (std::uint16_t machine : machines) {
+		std::vector<std::uint8_t> bytes = pe_image::build(pe_image::valid(machine));
+
+		pe::image_info_t info;
+		CHECK(pe::validate(bytes.data(), bytes.size(), machine, info) == pe::none);
+		CHECK(info.machine == machine);
+		CHECK(info.subsystem == pe::subsystem_native);
+		CHECK(info.section_count == 1);
+		CHECK(info.size_of_image == 2 * pe_image::section_alignment);
+	}
+}
+
+// one image per fixture of gen_pe_fixtures.py, on amd64
+static void each_rule_has_its_error(void) {
+	const pe_image::image_t valid = pe_image::valid(pe::machine_amd64);
+	std::vector<std::uint8_t> bytes = pe_image::build(valid);
+	pe_image::image_t image;
+
+	CHECK(validate(std::vector<std::uint8_t>(bytes.begin(), bytes.begin() + 0x30), pe::machine_amd64) == pe::truncated);
+
+	image = valid;
+	std::memcpy(image.dos_magic, "ZM", 2);
+	CHECK(validate(image) == pe::bad_dos_header);
+
+	image = valid;
+	std::memcpy(image.signature, "NE\0\0", 4);
+	CHECK(validate(image) == pe::bad_nt_signature);
+
+	CHECK(validate(bytes, pe::machine_arm64) == pe::machine_mismatch);
+
+	image = valid;
+	image.characteristics = 0x0020;
+	CHECK(validate(image) == pe::not_executable);
+
+	image = valid;
+	image.optional_magic = pe::optional_magic_pe32;
+	CHECK(validate(image) == pe::bad_optional_header);
+
+	image = valid;
+	image.subsystem = 2;
+	CHECK(validate(image) == pe::not_native);
+
+	image = valid;
+	image.size_of_image = pe_image::section_alignment + 1;
+	CHECK(validate(image) == pe::bad_size_of_image);
+
+	image = valid;
+	image.section_count = 0;
+	CHECK(validate(image) == pe::bad_section_table);
+
+	CHECK(validate(std::vector<std::uint8_t>(bytes.begin(), bytes.begin() + pe_image::file_alignment + 0x10), pe::machine_amd64) == pe::section_outside_file);
+
+	image = valid;
+	image.section_address = 2 * pe_image::section_alignment;
+	CHECK(validate(image) == pe::section_outside_image);
+}
+
+// the rules gen_pe_fixtures.py has no fixture for
+static void header_fields_are_checked(void) {
+	const pe_image::image_t valid = pe_image::valid(pe::machine_amd64);
+	pe_image::image_t image;
+
+	// e_lfanew inside the dos header, or not 4 bytes aligned
+	image = valid;
+	image.nt_headers = 0x20;
+	CHECK(validate(image) == pe::bad_dos_header);
+
+	image = valid;
+	image.nt_headers = 0x42;
+	CHECK(validate(image) == pe::bad_dos_header);
+
+	// a PE32 optional header too short for its fields
+	image = pe_image::valid(pe::machine_i386);
+	image.optional_header_size = 95;
+	CHECK(validate(image) == pe::bad_optional_header);
+
+	image = valid;
+	image.section_alignment = 0x1800;
+	CHECK(validate(image) == pe::bad_optional_header);
+
+	image = valid;
+	image.file_alignment = 0;
+	CHECK(validate(image) == pe::bad_optional_header);
+
+	// SizeOfHeaders past the file or past SizeOfImage, SizeOfImage not a multiple of SectionAlignment
+	image = valid;
+	image.size_of_headers = 2 * pe_image::file_alignment + 1;
+	CHECK(validate(image) == pe::bad_size_of_image);
+
+	image = valid;
+	image.size_of_image = pe_image::file_alignment;
+	image.size_of_headers = pe_image::file_alignment + 4;
+	CHECK(validate(image) == pe::bad_size_of_image);
+
+	image = valid;
+	image.section_count = pe::max_sections + 1;
+	CHECK(validate(image) == pe::bad_section_table);
+
+	// virtual size past SizeOfImage, the raw size counts when it is the larger
+	image = valid;
+	image.virtual_size = pe_image::section_alignment + 1;
+	CHECK(validate(image) == pe::section_outside_image);
+
+	image = valid;
+	image.size_of_image = pe_image::section_alignment + 0x100;
+	image.section_alignment = 0x100;
+	CHECK(validate(image) == pe::section_outside_image);
+
+	// a section without raw data may start anywhere in the file
+	image = valid;
+	image.raw_size = 0;
+	image.raw_offset = 0xFFFFFFFF;
+	CHECK(validate(image) == pe::none);
+}
+
+static void truncated_and_overflowing_offsets(void) {
+	const pe_image::image_t valid = pe_image::valid(pe::machine_amd64);
+	std::vector<std::uint8_t> bytes = pe_image::build(valid);
+	pe_image::image_t image;
+
+	// every prefix of the valid image is rejected, the shortest ones as truncated
+	for (std::size_t size = 0; size < bytes.size(); ++size) {
+		pe::error_t error = validate(std::vector<std::uint8_t>(bytes.begin(), bytes.begin() + size), pe::machine_amd64);
+
+		CHECK(error != pe::none);
+		if (size < 0x40 + 4 + 20 + 240) {
+			CHECK(error == pe::truncated);
+		}
+	}
+
+	// e_lfanew near 4 GiB: offset + NT headers size overflows 32 bits
+	image = valid;
+	image.nt_headers = 0xFFFFFFFC;
+	CHECK(validate(image) == pe::truncated);
+
+	// an optional header or a section table running past the end of the file
+	image = valid;
+	image.optional_header_size = 0xFFFF;
+	CHECK(validate(image) == pe::truncated);
+
+	image = valid;
+	image.section_count = pe::max_sections;
+	CHECK(validate(image) == pe::truncated);
+
+	// raw data and virtual ranges whose end overflows 32 bits
+	image = valid;
+	image.raw_offset = 0xFFFFFF00;
+	CHECK(validate(image) == pe::section_outside_file);
+
+	image = valid;
+	image.raw_size = 0xFFFFFFFF;
+	CHECK(validate(image) == pe::section_outside_file);
+
+	image = valid;
+	image.section_address = 0xFFFFF000;
+	image.virtual_size = 0x2000;
+	CHECK(validate(image) == pe::section_outside_image);
+}
+
+static void error_names(void) {
+	for (int error = pe::none; error < pe::n_error; ++error) {
+		CHECK(std::strcmp(pe::error_name(static_cast<pe::error_t>(error)), "unknown") != 0);
+	}
+
+	CHECK(std::strcmp(pe::error_name(pe::section_outside_image), "section_outside_image") == 0);
+	CHECK(std::strcmp(pe::error_name(pe::n_error), "unknown") == 0);
+}
+
+int main(void) {
+	valid_images_pass();
+	each_rule_has_its_error();
+	header_fields_are_checked();
+	truncated_and_overflowing_offsets();
+	error_names();
+
+	return test::result();
+}
@@ -0,0 +1,138 @@
+#include "test.hpp"
+
+#include "drv-loader.hpp"
+
+#include <chrono>
+#include <cstdint>
+
+// NtLoadDriver retries on the simulated backend, against an image another service keeps loaded
+// (STATUS_IMAGE_ALREADY_LOADED on every attempt) or one still being unloaded (the simulated unload_pending):
+//   the attempts stop at max_attempts, or before the deadline whatever max_attempts says
+//   only the statuses of the policy (--retry-on) are retried
+//   a tolerated status is success at once, even when the policy would retry it
+
+static const std::uint32_t already_loaded = static_cast<std::uint32_t>(STATUS_IMAGE_ALREADY_LOADED);
+
+static drv_loader::config_t load_config(const char* display_name, const retry::policy_t& policy) {
+	drv_loader::config_t config = {};
+	config.display_name = display_name;
+	config.file_path = "retry_test.sys";
+	config.operation = drv_loader::loader_operation_t::load;
+	config.retry = policy;
+	return config;
+}
+
+static retry::policy_t policy(std::uint32_t max_attempts, std::chrono::microseconds backoff, std::chrono::microseconds deadline) {
+	return { max_attempts, backoff, backoff, deadline, { already_loaded } };
+}
+
+static drv_loader::loader_error_t load(const drv_loader::config_t& config, drv_loader::report_t& report) {
+	report = {};
+	return drv_loader::load_unload<drv_loader::simulated_backend>(config, report);
+}
+
+// a fresh kernel where "Holder" has retry_test.sys loaded, the image names are not checked against files
+static void hold_image(void) {
+	simulated::kernel::instance().reset();
+	simulated::kernel::instance().set_latency({});
+	simulated::kernel::instance().set_check_images(false);
+
+	drv_loader::report_t report;
+	CHECK(!load(load_config("Holder", retry::default_policy()), report).failed());
+}
+
+static void stops_at_max_attempts(void) {
+	hold_image();
+
+	std::uint64_t exhausted = drv_loader::loader_metrics().retries_exhausted.value();
+	drv_loader::report_t report;
+	drv_loader::loader_error_t status = load(load_config("Retried", policy(4, std::chrono::microseconds(0), std::chrono::microseconds(0))), report);
+
+	CHECK(status.failed() && status.code == already_loaded);
+	CHECK(report.retries == 3);
+	CHECK(drv_loader::loader_metrics().retries_exhausted.value() == exhausted + 1);
+
+	// a single attempt disables retries
+	CHECK(load(load_config("Retried", policy(1, std::chrono::microseconds(0), std::chrono::microseconds(0))), report).failed());
+	CHECK(report.retries == 0);
+}
+
+static void stops_at_deadline(void) {
+	hold_image();
+
+	const std::chrono::milliseconds deadline(30);
+	drv_loader::report_t report;
+
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	drv_loader::loader_error_t status = load(load_config("Retried", policy(100000, std::chrono::milliseconds(2), deadline)), report);
+	std::chrono::steady_clock::duration elapsed = std::chrono::steady_clock::now() - start;
+
+	// the last wait is at most the 2 ms backoff, and no wait may end past the deadline
+	CHECK(status.failed() && status.code == already_loaded);
+	CHECK(report.retries > 0 && report.retries < 100000 - 1);
+	CHECK(elapsed >= deadline - std::chrono::milliseconds(2));
+	CHECK(elapsed < deadline + std::chrono::milliseconds(250));
+}
+
+static void retries_only_policy_statuses(void) {
+	hold_image();
+
+	// --retry-on STATUS_INSUFFICIENT_RESOURCES: STATUS_IMAGE_ALREADY_LOADED fails at the first call
+	retry::policy_t insufficient_resources = policy(10, std::chrono::microseconds(0), std::chrono::microseconds(0));
+	insufficient_resources.retryable_statuses = { static_cast<std::uint32_t>(STATUS_INSUFFICIENT_RESOURCES) };
+
+	drv_loader::report_t report;
+	drv_loader::loader_error_t status = load(load_config("Retried", insufficient_resources), report);
+
+	CHECK(status.failed() && status.code == already_loaded);
+	CHECK(report.retries == 0);
+
+	// the default policy never retries a missing image
+	simulated::kernel::instance().set_check_images(true);
+	drv_loader::config_t missing = load_config("Missing", retry::default_policy());
+	missing.file_path = "missing/retry_test_missing.sys";
+
+	status = load(missing, report);
+	CHECK(status.failed() && status.code == static_cast<std::uint32_t>(STATUS_OBJECT_NAME_NOT_FOUND));
+	CHECK(report.retries == 0);
+}
+
+static void tolerated_status_is_not_retried(void) {
+	hold_image();
+
+	std::uint64_t tolerated = drv_loader::loader_metrics().tolerated_failures.value();
+	drv_loader::config_t config = load_config("Retried", policy(10, std::chrono::milliseconds(1), std::chrono::microseconds(0)));
+	config.tolerated_statuses = { already_loaded };
+
+	drv_loader::report_t report;
+	CHECK(!load(config, report).failed());
+	CHECK(report.retries == 0);
+	CHECK(drv_loader::loader_metrics().tolerated_failures.value() == tolerated + 1);
+}
+
+static void retries_until_the_image_is_released(void) {
+	hold_image();
+
+	drv_loader::config_t unload = load_config("Holder", retry::default_policy());
+	unload.operation = drv_loader::loader_operation_t::unload;
+
+	simulated::latency_t latency = {};
+	latency.unload_pending = std::chrono::milliseconds(20);
+	simulated::kernel::instance().set_latency(latency);
+
+	drv_loader::report_t report;
+	CHECK(!load(unload, report).failed());
+
+	CHECK(!load(load_config("Holder", policy(1000, std::chrono::milliseconds(1), std::chrono::seconds(2))), report).failed());
+	CHECK(report.retries > 0);
+}
+
+int main(void) {
+	stops_at_max_attempts();
+	stops_at_deadline();
+	retries_only_policy_statuses();
+	tolerated_status_is_not_retried();
+	retries_until_the_image_is_released();
+
+	return test::result();
+}
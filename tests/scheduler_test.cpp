@@ -0,0 +1,209 @@
+#include "test.hpp"
+
+#include "scheduler.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// manifest batches (scheduler::build, scheduler::run) on the simulated backend, slow drivers given their latency:
+//   a load starts once the loads it depends on finished, independent entries run meanwhile
+//   dependency cycles and unknown names are rejected by build with the entries involved
+//   the dependents of a failed load are skipped with ERROR_SERVICE_DEPENDENCY_FAIL, transitively
+//   unloads run in the reverse order of their dependencies
+//   a driver stays loaded, skipped with ERROR_DEPENDENT_SERVICES_RUNNING, when a dependent failed to unload
+
+static const std::chrono::milliseconds slow(40);
+
+static drv_loader::config_t entry(drv_loader::loader_operation_t operation, const char* display_name, const char* file_path, std::vector<std::string> depends_on = {}) {
+	drv_loader::config_t config = {};
+	config.display_name = display_name;
+	config.file_path = file_path;
+	config.operation = operation;
+	config.depends_on = depends_on;
+	config.retry = { 1, std::chrono::microseconds(0), std::chrono::microseconds(0), std::chrono::microseconds(0), {} };
+	return config;
+}
+
+static drv_loader::config_t load(const char* display_name, const char* file_path, std::vector<std::string> depends_on = {}) {
+	return entry(drv_loader::loader_operation_t::load, display_name, file_path, depends_on);
+}
+
+static drv_loader::config_t unload(const char* display_name, std::vector<std::string> depends_on = {}) {
+	return entry(drv_loader::loader_operation_t::unload, display_name, "", depends_on);
+}
+
+static std::vector<scheduler::node_result_t> run(const std::vector<drv_loader::config_t>& configs, std::size_t jobs) {
+	scheduler::graph_t graph;
+	scheduler::build_error_t error;
+	std::vector<scheduler::node_result_t> results;
+
+	if (CHECK(scheduler::build(configs, graph, error))) {
+		CHECK(!scheduler::run<drv_loader::simulated_backend>(configs, graph, jobs, results).failed());
+	}
+
+	results.resize(configs.size());
+	return results;
+}
+
+// a finished before b started
+static bool before(const scheduler::node_result_t& a, const scheduler::node_result_t& b) {
+	return a.start + a.duration <= b.start;
+}
+
+static bool is_loaded(const char* base_name) {
+	std::vector<std::uint8_t> blob;
+	modules::module_index index;
+
+	return !drv_loader::query_modules<drv_loader::simulated_backend>(blob).failed()
+		&& !drv_loader::index_modules(blob, index).failed()
+		&& drv_loader::find_module(index, base_name) != nullptr;
+}
+
+// a fresh kernel with a registry latency and core.sys and filter.sys slower to load and unload than the rest
+static void fresh_kernel(void) {
+	simulated::kernel::instance().reset();
+	simulated::kernel::instance().set_check_images(false);
+	simulated::kernel::instance().set_latency({ std::chrono::microseconds(100), std::chrono::microseconds(500), std::chrono::microseconds(500), std::chrono::microseconds(0) });
+	simulated::kernel::instance().set_driver_latency("Core", slow);
+	simulated::kernel::instance().set_driver_latency("Filter", slow);
+}
+
+static void dependents_wait(void) {
+	fresh_kernel();
+
+	std::vector<scheduler::node_result_t> results = run({
+		load("Filter", "filter.sys", { "core" }),
+		load("Core", "core.sys"),
+		load("Net", "net.sys", { "Core" }),
+		load("Other", "other.sys"),
+		load("Top", "top.sys", { "Filter", "Net" }),
+	}, 4);
+
+	for (const scheduler::node_result_t& result : results) {
+		CHECK(!result.error.failed() && !result.skipped);
+	}
+
+	CHECK(before(results[1], results[0]));
+	CHECK(before(results[1], results[2]));
+	CHECK(before(results[0], results[4]) && before(results[2], results[4]));
+
+	// other.sys does not wait for the slow core.sys
+	CHECK(results[3].start < results[1].start + results[1].duration);
+	CHECK(is_loaded("top.sys"));
+}
+
+static void cycles_are_rejected(void) {
+	scheduler::graph_t graph;
+	scheduler::build_error_t error;
+
+	CHECK(!scheduler::build({ load("A", "a.sys", { "C" }), load("B", "b.sys", { "A" }), load("C", "c.sys", { "B" }), load("D", "d.sys") }, graph, error));
+	CHECK(std::string(error.reason) == "dependency cycle");
+	CHECK(error.entry < 3);
+
+	// the cycle closes on the entry it starts from, in either rotation
+	std::string detail = error.detail;
+	std::string first = detail.substr(0, detail.find(" -> "));
+	CHECK(detail.size() > first.size() && detail.compare(detail.size() - first.size(), first.size(), first) == 0);
+	CHECK(detail.find("load A") != std::string::npos && detail.find("load B") != std::string::npos && detail.find("load C") != std::string::npos);
+	CHECK(detail.find("load D") == std::string::npos);
+
+	// a driver depending on itself, and unloads whose dependencies loop back
+	CHECK(!scheduler::build({ load("Self", "self.sys", { "SELF" }) }, graph, error));
+	CHECK(std::string(error.reason) == "dependency cycle" && error.detail == "load Self -> load Self");
+
+	CHECK(!scheduler::build({ unload("A", { "B" }), unload("B", { "A" }) }, graph, error));
+	CHECK(std::string(error.reason) == "dependency cycle");
+
+	// a dependency on another operation of the same name is unknown
+	CHECK(!scheduler::build({ load("A", "a.sys"), unload("B", { "A" }) }, graph, error));
+	CHECK(std::string(error.reason) == "unknown dependency" && error.entry == 1 && error.detail == "A");
+
+	// an unload then a load of the same driver is ordered, not a cycle
+	CHECK(scheduler::build({ unload("A"), load("A", "a.sys") }, graph, error));
+}
+
+static void dependents_of_a_failure_are_skipped(void) {
+	fresh_kernel();
+
+	// another service holds shared.sys, Broken fails with STATUS_IMAGE_ALREADY_LOADED
+	drv_loader::report_t report = {};
+	CHECK(!drv_loader::load_unload<drv_loader::simulated_backend>(load("Holder", "shared.sys"), report).failed());
+
+	std::vector<scheduler::node_result_t> results = run({
+		load("Broken", "shared.sys"),
+		load("Child", "child.sys", { "Broken" }),
+		load("Grand", "grand.sys", { "Child" }),
+		load("Sibling", "sibling.sys"),
+	}, 2);
+
+	CHECK(results[0].error.failed() && !results[0].skipped && results[0].error.code == static_cast<std::uint32_t>(STATUS_IMAGE_ALREADY_LOADED));
+
+	for (std::size_t i = 1; i < 3; ++i) {
+		CHECK(results[i].skipped && results[i].duration == 0);
+		CHECK(results[i].error.code == ERROR_SERVICE_DEPENDENCY_FAIL && results[i].error.phase == drv_loader::phase_load);
+	}
+
+	CHECK(!results[3].error.failed() && !results[3].skipped);
+	CHECK(!is_loaded("child.sys") && !is_loaded("grand.sys") && is_loaded("sibling.sys"));
+}
+
+static void unloads_run_in_reverse(void) {
+	fresh_kernel();
+
+	std::vector<scheduler::node_result_t> loaded = run({ load("Core", "core.sys"), load("Filter", "filter.sys", { "Core" }), load("Net", "net.sys", { "Core" }) }, 3);
+	CHECK(!loaded[0].error.failed() && !loaded[1].error.failed() && !loaded[2].error.failed());
+
+	// Core goes last, once both drivers depending on it are gone
+	std::vector<scheduler::node_result_t> results = run({
+		unload("Core"),
+		unload("Filter", { "Core" }),
+		unload("Net", { "Core" }),
+	}, 3);
+
+	for (const scheduler::node_result_t& result : results) {
+		CHECK(!result.error.failed() && !result.skipped);
+	}
+
+	CHECK(before(results[1], results[0]) && before(results[2], results[0]));
+	CHECK(!is_loaded("core.sys") && !is_loaded("filter.sys") && !is_loaded("net.sys"));
+}
+
+static void failed_dependent_keeps_its_dependency(void) {
+	fresh_kernel();
+
+	std::vector<scheduler::node_result_t> loaded = run({ load("A", "a.sys") }, 1);
+	CHECK(!loaded[0].error.failed());
+
+	// B was never loaded: its unload fails, A stays loaded
+	std::vector<scheduler::node_result_t> results = run({
+		unload("A"),
+		unload("B", { "A" }),
+	}, 2);
+
+	CHECK(results[1].error.failed() && !results[1].skipped);
+	CHECK(results[0].skipped && results[0].duration == 0);
+	CHECK(results[0].error.code == ERROR_DEPENDENT_SERVICES_RUNNING && results[0].error.phase == drv_loader::phase_unload);
+	CHECK(is_loaded("a.sys"));
+
+	// per driver ordering does not propagate failures: a failed load of A still lets its unload run
+	fresh_kernel();
+
+	drv_loader::report_t report = {};
+	CHECK(!drv_loader::load_unload<drv_loader::simulated_backend>(load("Holder", "a.sys"), report).failed());
+
+	results = run({ load("A", "a.sys"), unload("A") }, 2);
+	CHECK(results[0].error.failed() && !results[1].skipped);
+	CHECK(before(results[0], results[1]));
+}
+
+int main(void) {
+	dependents_wait();
+	cycles_are_rejected();
+	dependents_of_a_failure_are_skipped();
+	unloads_run_in_reverse();
+	failed_dependent_keeps_its_dependency();
+
+	return test::result();
+}
@@ -0,0 +1,134 @@
+#include "test.hpp"
+
+#include "drv-loader.hpp"
+
+#include <cstdio>
+#include <filesystem>
+#include <string>
+
+// a failed load on the simulated backend leaves the registry as it found it: a service key it created is deleted, an
+// existing one gets back the values the load replaced and loses the ones it added, other values stay untouched
+
+static const char service_path[] = "System\\CurrentControlSet\\Services\\ServiceKeyTest";
+
+static drv_loader::config_t load_config(const char* file_path) {
+	drv_loader::config_t config = {};
+	config.display_name = "ServiceKeyTest";
+	config.file_path = file_path;
+	config.operation = drv_loader::loader_operation_t::load;
+	config.retry = retry::default_policy();
+	return config;
+}
+
+static bool load(const char* file_path) {
+	drv_loader::report_t report = {};
+	return !drv_loader::load_unload<drv_loader::simulated_backend>(load_config(file_path), report).failed();
+}
+
+static void set_value(const char* name, DWORD type, const std::string& data) {
+	simulated::unique_key key;
+	bool created = false;
+
+	drv_loader::registry_value_t value = { name, type, data.data(), static_cast<DWORD>(data.size()) };
+
+	CHECK(simulated::kernel::instance().create_key(simulated::root_key, service_path, *key.put(), created) == ERROR_SUCCESS);
+	CHECK(simulated::kernel::instance().set_values(key.get(), &value, 1) == ERROR_SUCCESS);
+}
+
+static bool has_value(const char* name, DWORD type, const std::string& data) {
+	simulated::value_t value;
+	return simulated::kernel::instance().query_value(service_path, name, value) && value.type == type && std::string(value.data.begin(), value.data.end()) == data;
+}
+
+static bool has_value(const char* name) {
+	simulated::value_t value;
+	return simulated::kernel::instance().query_value(service_path, name, value);
+}
+
+static void created_key_is_deleted(void) {
+	simulated::kernel::instance().reset();
+
+	CHECK(!load("missing/service_key_test.sys"));
+	CHECK(!simulated::kernel::instance().key_exists(service_path));
+}
+
+static void existing_key_is_restored(void) {
+	simulated::kernel::instance().reset();
+
+	const std::string start("\x02\x00\x00\x00", 4);
+	set_value("ImagePath", REG_EXPAND_SZ, "\\??\\C:\\drivers\\previous.sys");
+	set_value("Start", REG_DWORD, start);
+	set_value("Description", REG_SZ, "installed by someone else");
+
+	CHECK(!load("missing/service_key_test.sys"));
+
+	CHECK(has_value("ImagePath", REG_EXPAND_SZ, "\\??\\C:\\drivers\\previous.sys"));
+	CHECK(has_value("Start", REG_DWORD, start));
+	CHECK(has_value("Description", REG_SZ, "installed by someone else"));
+	CHECK(!has_value("Type"));
+	CHECK(!has_value("ErrorControl"));
+	CHECK(!has_value("DisplayName"));
+}
+
+static void existing_key_keeps_a_successful_load(void) {
+	simulated::kernel::instance().reset();
+
+	std::string file_path = (std::filesystem::temp_directory_path() / "service_key_test.sys").string();
+	std::FILE* file = std::fopen(file_path.c_str(), "wb");
+	CHECK(file != nullptr && std::fclose(file) == 0);
+
+	set_value("ImagePath", REG_EXPAND_SZ, "\\??\\C:\\drivers\\previous.sys");
+
+	CHECK(load(file_path.c_str()));
+	CHECK(!has_value("ImagePath", REG_EXPAND_SZ, "\\??\\C:\\drivers\\previous.sys"));
+	CHECK(has_value("Type"));
+
+	std::remove(file_path.c_str());
+}
+
+// DrvLoaderImageIdentity is recorded with --skip-if-loaded only, a load without it drops a recorded one, a failed load
+// puts it back
+static void image_identity_follows_skip_if_loaded(void) {
+	simulated::kernel::instance().reset();
+
+	std::string file_path = (std::filesystem::temp_directory_path() / "service_key_test.sys").string();
+	std::FILE* file = std::fopen(file_path.c_str(), "wb");
+	CHECK(file != nullptr && std::fclose(file) == 0);
+
+	drv_loader::report_t report = {};
+	drv_loader::config_t config = load_config(file_path.c_str());
+	drv_loader::config_t unload = config;
+	unload.operation = drv_loader::loader_operation_t::unload;
+
+	CHECK(load(file_path.c_str()));
+	CHECK(!has_value(drv_loader::image_identity_value));
+	CHECK(!drv_loader::load_unload<drv_loader::simulated_backend>(unload, report).failed());
+
+	config.skip_if_loaded = true;
+	CHECK(!drv_loader::load_unload<drv_loader::simulated_backend>(config, report).failed());
+	CHECK(has_value(drv_loader::image_identity_value));
+
+	simulated::value_t recorded;
+	CHECK(simulated::kernel::instance().query_value(service_path, drv_loader::image_identity_value, recorded));
+
+	// the service key is gone after an unload, an identity left by someone else plays the previous run
+	CHECK(!drv_loader::load_unload<drv_loader::simulated_backend>(unload, report).failed());
+	set_value(drv_loader::image_identity_value, REG_BINARY, std::string(recorded.data.begin(), recorded.data.end()));
+
+	CHECK(!load("missing/service_key_test.sys"));
+	CHECK(has_value(drv_loader::image_identity_value, REG_BINARY, std::string(recorded.data.begin(), recorded.data.end())));
+
+	CHECK(load(file_path.c_str()));
+	CHECK(!has_value(drv_loader::image_identity_value));
+
+	std::remove(file_path.c_str());
+}
+
+int main(void) {
+	created_key_is_deleted();
+	existing_key_is_restored();
+	existing_key_keeps_a_successful_load();
+	image_identity_follows_skip_if_loaded();
+
+	return test::result();
+}
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <cstdio>
+
+// checks of the tests/*.cpp programs, built and run by tools/run_tests.py
+// a failed check prints its condition and the program goes on, main returns test::result()
+
+namespace test {
+
+	static int& failures(void) {
+		static int count = 0;
+		return count;
+	}
+
+	static bool check(bool condition, const char* text, const char* file, int line) {
+		if (!condition) {
+			std::fprintf(stderr, "%s:%d: check failed: %s\n", file, line, text);
+			++failures();
+		}
+
+		return condition;
+	}
+
+	static int result(void) {
+		if (failures() != 0) {
+			std::fprintf(stderr, "%d checks failed\n", failures());
+		}
+
+		return failures() != 0 ? 1 : 0;
+	}
+}
+
+#define CHECK(condition) test::check((condition), #condition, __FILE__, __LINE__)
@@ -0,0 +1,50 @@
+#include "test.hpp"
+
+#include "trace.hpp"
+
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+
+// trace::dump_chrome_json writes span names as json strings: quotes and backslashes escaped, control characters
+// (a display name read from a manifest may hold a tab) as \u00XX, other bytes unchanged
+
+static std::string dump(void) {
+	std::string path = (std::filesystem::temp_directory_path() / "trace_test.json").string();
+	CHECK(trace::dump_chrome_json(path));
+
+	std::ifstream stream(path, std::ios::binary);
+	std::string json((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>());
+	std::remove(path.c_str());
+
+	return json;
+}
+
+static void names_are_escaped(void) {
+	trace::enable();
+	trace::record("Quote\"Back\\slash", trace::now(), 1000);
+	trace::record("Tab\tNew\nline\x01\x1F end", trace::now(), 1000);
+	trace::record("Caf\xC3\xA9 ~\x7F", trace::now(), 1000);
+
+	std::string json = dump();
+
+	CHECK(json.find("\"name\":\"Quote\\\"Back\\\\slash\"") != std::string::npos);
+	CHECK(json.find("\"name\":\"Tab\\u0009New\\u000Aline\\u0001\\u001F end\"") != std::string::npos);
+	CHECK(json.find("\"name\":\"Caf\xC3\xA9 ~\x7F\"") != std::string::npos);
+
+	// the only raw control characters left are the new lines between events
+	bool raw_control = false;
+	for (char c : json) {
+		raw_control = raw_control || (static_cast<unsigned char>(c) < 0x20 && c != '\n');
+	}
+
+	CHECK(!raw_control);
+}
+
+int main(void) {
+	names_are_escaped();
+
+	return test::result();
+}
@@ -0,0 +1,170 @@
+#include "test.hpp"
+
+#include "unique_resource.hpp"
+
+#if defined(__linux__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+// helpers::unique_resource ownership: move, release, reset and put close exactly what they should, once
+// on the raw resources of the posix build (fd, mapping) and on counting traits, one of them with two empty values
+// the way handle_traits treats null and INVALID_HANDLE_VALUE on windows
+
+static int closed_count = 0;
+static int last_closed = 0;
+
+struct counting_traits {
+	typedef int type;
+	static type invalid(void) { return 0; }
+	static void close(type value) { ++closed_count; last_closed = value; }
+};
+
+// 0 and -1 both own nothing, as null and INVALID_HANDLE_VALUE do for a HANDLE
+struct two_sentinels_traits {
+	typedef int type;
+	static type invalid(void) { return 0; }
+	static bool empty(type value) { return value == 0 || value == -1; }
+	static void close(type value) { ++closed_count; last_closed = value; }
+};
+
+typedef helpers::unique_resource<counting_traits> counted;
+typedef helpers::unique_resource<two_sentinels_traits> two_sentinels;
+
+static void move_transfers_ownership(void) {
+	closed_count = 0;
+
+	{
+		counted a(7);
+		counted b(std::move(a));
+
+		CHECK(!a.valid());
+		CHECK(b.get() == 7);
+
+		counted c(9);
+		c = std::move(b);
+
+		CHECK(closed_count == 1 && last_closed == 9);
+		CHECK(!b);
+		CHECK(c.get() == 7);
+
+		c = std::move(c);
+		CHECK(c.get() == 7);
+	}
+
+	CHECK(closed_count == 2 && last_closed == 7);
+}
+
+static void release_does_not_close(void) {
+	closed_count = 0;
+
+	{
+		counted a(3);
+		CHECK(a.release() == 3);
+		CHECK(!a.valid());
+	}
+
+	CHECK(closed_count == 0);
+}
+
+static void reset_and_put_close_the_old_value(void) {
+	closed_count = 0;
+
+	counted a(1);
+	a.reset(2);
+	CHECK(closed_count == 1 && last_closed == 1);
+
+	a.reset();
+	CHECK(closed_count == 2 && last_closed == 2);
+	CHECK(!a.valid());
+
+	a.reset();
+	CHECK(closed_count == 2);
+
+	a.reset(4);
+	*a.put() = 5;
+	CHECK(closed_count == 3 && last_closed == 4);
+	CHECK(a.get() == 5);
+}
+
+static void both_sentinels_are_empty(void) {
+	closed_count = 0;
+
+	{
+		two_sentinels failed(-1);
+		CHECK(!failed.valid());
+		CHECK(!failed);
+
+		two_sentinels null;
+		CHECK(!null.valid());
+
+		two_sentinels owned(8);
+		CHECK(owned.valid());
+		owned.reset(-1);
+		CHECK(closed_count == 1 && last_closed == 8);
+	}
+
+	CHECK(closed_count == 1);
+}
+
+#if defined(__linux__) || defined(__APPLE__)
+static bool is_open(int fd) {
+	return ::fcntl(fd, F_GETFD) != -1;
+}
+
+static void fd_is_closed_once(void) {
+	int fds[2] = { -1, -1 };
+	CHECK(::pipe(fds) == 0);
+
+	{
+		helpers::unique_fd read_end(fds[0]);
+		helpers::unique_fd write_end(fds[1]);
+
+		helpers::unique_fd moved(std::move(read_end));
+		CHECK(!read_end.valid());
+		CHECK(is_open(fds[0]));
+
+		int raw = write_end.release();
+		CHECK(raw == fds[1]);
+		::close(raw);
+	}
+
+	CHECK(!is_open(fds[0]));
+
+	helpers::unique_fd failed(::open("/nonexistent/unique_resource_test", O_RDONLY));
+	CHECK(!failed.valid());
+}
+
+static void mapping_is_unmapped(void) {
+	std::size_t size = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+
+	helpers::unique_mapping mapping(helpers::mapping_t { ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0), size });
+	CHECK(mapping.valid());
+
+	helpers::unique_mapping failed(helpers::mapping_t { MAP_FAILED, size });
+	CHECK(!failed.valid());
+
+	void* address = mapping.get().address;
+	mapping.reset();
+
+	// msync fails with ENOMEM on an unmapped range
+	CHECK(::msync(address, size, MS_ASYNC) == -1);
+}
+#endif
+
+int main(void) {
+	move_transfers_ownership();
+	release_does_not_close();
+	reset_and_put_close_the_old_value();
+	both_sentinels_are_empty();
+
+#if defined(__linux__) || defined(__APPLE__)
+	fd_is_closed_once();
+	mapping_is_unmapped();
+#endif
+
+	static_assert(sizeof(two_sentinels) == sizeof(int), "the empty hook must not add storage");
+
+	return test::result();
+}
@@ -0,0 +1,75 @@
+#!/usr/bin/env python3
+"""Compares one drv-loader process per operation with a single --manifest run, against the simulated kernel.
+
+Every driver is loaded then unloaded; the simulated kernel lives in the process, so per process unloads find nothing
+loaded and are run with --tolerate STATUS_OBJECT_NAME_NOT_FOUND to keep the same amount of work on both sides. They
+still exit with 1 as the service key they delete is gone too, their exit status is not checked.
+
+usage: bench_manifest.py <drv-loader binary> [--drivers 100] [--latency 0] [--repeat 3]
+"""
+
+import argparse
+import os
+import subprocess
+import sys
+import tempfile
+import time
+
+
+def run(command, check=True):
+    subprocess.run(command, stdout=subprocess.DEVNULL, stderr=subprocess.DEVNULL, check=check)
+
+
+def per_process(binary, drivers, common):
+    start = time.perf_counter()
+
+    for name, path in drivers:
+        run([binary, '-o', 'load', '-d', name, path] + common)
+
+    for name, _ in drivers:
+        run([binary, '-o', 'unload', '-d', name] + common, check=False)
+
+    return time.perf_counter() - start
+
+
+def batched(binary, manifest, common):
+    start = time.perf_counter()
+    run([binary, '--manifest', manifest] + common)
+    return time.perf_counter() - start
+
+
+def main():
+    parser = argparse.ArgumentParser(description='per process invocations versus one --manifest run')
+    parser.add_argument('binary')
+    parser.add_argument('--drivers', type=int, default=100)
+    parser.add_argument('--latency', type=int, default=0, help='--simulate-latency, in microseconds')
+    parser.add_argument('--repeat', type=int, default=3, help='best of this many runs')
+    args = parser.parse_args()
+
+    common = ['--simulate', '--simulate-latency', str(args.latency), '--tolerate', 'STATUS_OBJECT_NAME_NOT_FOUND']
+
+    with tempfile.TemporaryDirectory() as directory:
+        drivers = []
+        for i in range(args.drivers):
+            path = os.path.join(directory, 'bench%d.sys' % i)
+            open(path, 'wb').close()
+            drivers.append(('Bench%d' % i, path))
+
+        manifest = os.path.join(directory, 'manifest.txt')
+        with open(manifest, 'w') as out:
+            for name, path in drivers:
+                out.write('load %s %s\n' % (name, path))
+            for name, _ in drivers:
+                out.write('unload %s\n' % name)
+
+        operations = 2 * len(drivers)
+        process_time = min(per_process(args.binary, drivers, common) for _ in range(args.repeat))
+        batch_time = min(batched(args.binary, manifest, common) for _ in range(args.repeat))
+
+    print('%d operations, simulated latency %d us' % (operations, args.latency))
+    print('per process  %8.3f s  %10.1f ops/s' % (process_time, operations / process_time))
+    print('manifest     %8.3f s  %10.1f ops/s  (x%.1f)' % (batch_time, operations / batch_time, process_time / batch_time))
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,83 @@
+#!/usr/bin/env python3
+"""Times the SystemModuleInformation parser of drv-loader on synthetic module lists of growing size.
+
+Each list is written in the x64 RTL_PROCESS_MODULES layout (see drv-loader/include/modules.hpp), the format --save-modules
+captures on Windows, and looked up with `-o status --modules-blob`. The index_modules (parse and index) and find_module
+(one lookup by base name) phases are read from --stats: indexing grows with the list, the lookup does not.
+
+usage: bench_modules.py <drv-loader binary> [--modules 100,1000,10000,65535] [--repeat 5] [--keep file]
+"""
+
+import argparse
+import os
+import re
+import struct
+import subprocess
+import sys
+import tempfile
+
+ENTRY = struct.Struct('<QQQIIHHHH256s')  # 296 bytes
+HEADER = struct.Struct('<I4x')
+
+STATS_LINE = re.compile(r'^\s+(\S+) (\d+) (\d+) (\d+) (\d+) (\d+)\s*$')
+
+
+def module_list(count):
+    """RTL_PROCESS_MODULES with count drivers, the last one is the looked up target"""
+    blob = bytearray(HEADER.pack(count))
+
+    for i in range(count):
+        directory = b'\\SystemRoot\\System32\\drivers\\'
+        name = b'bench%d.sys' % i
+        blob += ENTRY.pack(0, 0, 0xFFFFF80000000000 + i * 0x100000, 0x10000, 0, i, 0, 1, len(directory), directory + name)
+
+    return bytes(blob)
+
+
+def phases(binary, blob_path, target):
+    output = subprocess.run([binary, '-o', 'status', '-d', 'Bench', target, '--modules-blob', blob_path, '--stats'],
+                            stdout=subprocess.PIPE, stderr=subprocess.STDOUT, check=True, universal_newlines=True).stdout
+
+    found = {}
+    for line in output.splitlines():
+        match = STATS_LINE.match(line)
+        if match:
+            found[match.group(1)] = int(match.group(6))  # max of a single sample, in microseconds
+
+    if 'is loaded' not in output:
+        raise RuntimeError('%s not found in the module list' % target)
+
+    return found
+
+
+def main():
+    parser = argparse.ArgumentParser(description='SystemModuleInformation parse and lookup time by list size')
+    parser.add_argument('binary')
+    parser.add_argument('--modules', default='100,1000,10000,65535', help='comma separated list sizes (LoadOrderIndex is 16 bits)')
+    parser.add_argument('--repeat', type=int, default=5, help='best of this many runs')
+    parser.add_argument('--keep', help='also write the largest list to this file, e.g. as a --modules-blob fixture')
+    args = parser.parse_args()
+
+    print('%8s  %10s  %16s  %14s' % ('modules', 'blob bytes', 'index_modules us', 'find_module us'))
+
+    with tempfile.TemporaryDirectory() as directory:
+        blob_path = os.path.join(directory, 'modules.bin')
+
+        for count in [int(count) for count in args.modules.split(',')]:
+            blob = module_list(count)
+            with open(blob_path, 'wb') as out:
+                out.write(blob)
+
+            if args.keep:
+                with open(args.keep, 'wb') as out:
+                    out.write(blob)
+
+            runs = [phases(args.binary, blob_path, 'bench%d.sys' % (count - 1)) for _ in range(args.repeat)]
+            index = min(run['index_modules'] for run in runs)
+            lookup = min(run['find_module'] for run in runs)
+
+            print('%8d  %10d  %16d  %14d' % (count, len(blob), index, lookup))
+
+
+if __name__ == '__main__':
+    sys.exit(main())
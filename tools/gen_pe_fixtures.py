@@ -0,0 +1,88 @@
+#!/usr/bin/env python3
+"""Writes minimal driver images for --check-image (see drv-loader/include/pe.hpp), one valid and one per rejection.
+
+The valid image is a PE32+ native driver of the given machine, with one .text section whose entry point returns
+STATUS_SUCCESS; every other fixture breaks exactly one rule of it. Run the loader against them with the simulated kernel:
+
+    python tools/gen_pe_fixtures.py fixtures
+    drvl -o load -d Valid --check-image fixtures/valid.sys
+    drvl -o load -d Gui --check-image fixtures/not_native.sys
+
+usage: gen_pe_fixtures.py <output directory> [--machine amd64|arm64]
+"""
+
+import argparse
+import os
+import struct
+import sys
+
+MACHINES = {'amd64': 0x8664, 'arm64': 0xAA64}
+
+FILE_ALIGNMENT = 0x200
+SECTION_ALIGNMENT = 0x1000
+NT_HEADERS = 0x40
+OPTIONAL_HEADER_SIZE = 240  # PE32+ with 16 data directories
+
+ENTRY_POINT = {
+    'amd64': b'\x31\xc0\xc3',  # xor eax, eax; ret
+    'arm64': b'\x00\x00\x80\x52\xc0\x03\x5f\xd6',  # mov w0, #0; ret
+}
+
+
+def image(machine, code, subsystem=1, characteristics=0x0022, size_of_image=2 * SECTION_ALIGNMENT, section_address=SECTION_ALIGNMENT,
+          section_count=1, dos_magic=b'MZ', signature=b'PE\0\0', optional_magic=0x20B):
+    dos_header = dos_magic + b'\0' * (0x3C - len(dos_magic)) + struct.pack('<I', NT_HEADERS)
+
+    file_header = struct.pack('<HHIIIHH', machine, section_count, 0, 0, 0, OPTIONAL_HEADER_SIZE, characteristics)
+
+    optional_header = struct.pack('<HBBIIIII', optional_magic, 14, 0, FILE_ALIGNMENT, 0, 0, section_address, section_address)
+    optional_header += struct.pack('<QII', 0x140000000, SECTION_ALIGNMENT, FILE_ALIGNMENT)
+    optional_header += struct.pack('<HHHHHHI', 10, 0, 10, 0, 10, 0, 0)
+    optional_header += struct.pack('<IIIHH', size_of_image, FILE_ALIGNMENT, 0, subsystem, 0x0160)
+    optional_header += struct.pack('<QQQQII', 0x40000, 0x1000, 0x100000, 0x1000, 0, 16)
+    optional_header += b'\0' * (16 * 8)
+    assert len(optional_header) == OPTIONAL_HEADER_SIZE
+
+    section = struct.pack('<8sIIIIIIHHI', b'.text', len(code), section_address, FILE_ALIGNMENT, FILE_ALIGNMENT, 0, 0, 0, 0, 0x60000020)
+
+    headers = dos_header + signature + file_header + optional_header + section
+    return headers + b'\0' * (FILE_ALIGNMENT - len(headers)) + code + b'\0' * (FILE_ALIGNMENT - len(code))
+
+
+def main():
+    parser = argparse.ArgumentParser(description='driver images accepted and rejected by --check-image')
+    parser.add_argument('output')
+    parser.add_argument('--machine', choices=sorted(MACHINES), default='amd64', help='machine of the valid image (the host of the loader)')
+    args = parser.parse_args()
+
+    machine = MACHINES[args.machine]
+    other_machine = MACHINES['arm64' if args.machine == 'amd64' else 'amd64']
+    code = ENTRY_POINT[args.machine]
+    valid = image(machine, code)
+
+    fixtures = {
+        'valid.sys': valid,
+        'truncated.sys': valid[:0x30],
+        'bad_dos_header.sys': image(machine, code, dos_magic=b'ZM'),
+        'bad_nt_signature.sys': image(machine, code, signature=b'NE\0\0'),
+        'machine_mismatch.sys': image(other_machine, code),
+        'not_executable.sys': image(machine, code, characteristics=0x0020),
+        'bad_optional_header.sys': image(machine, code, optional_magic=0x10B),
+        'not_native.sys': image(machine, code, subsystem=2),
+        'bad_size_of_image.sys': image(machine, code, size_of_image=SECTION_ALIGNMENT + 1),
+        'bad_section_table.sys': image(machine, code, section_count=0),
+        'section_outside_file.sys': valid[:FILE_ALIGNMENT + 0x10],
+        'section_outside_image.sys': image(machine, code, section_address=2 * SECTION_ALIGNMENT),
+    }
+
+    os.makedirs(args.output, exist_ok=True)
+
+    for name, data in sorted(fixtures.items()):
+        with open(os.path.join(args.output, name), 'wb') as out:
+            out.write(data)
+
+        print('%-28s %5d bytes' % (name, len(data)))
+
+
+if __name__ == '__main__':
+    sys.exit(main())
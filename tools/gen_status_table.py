@@ -0,0 +1,303 @@
+#!/usr/bin/env python3
+"""Generates a constexpr status table (see drv-loader/include/status_table.hpp) from a message compiler header.
+
+The input is a header in the layout produced by mc.exe (ntstatus.h, winerror.h):
+
+    //
+    // MessageId: STATUS_IMAGE_ALREADY_LOADED
+    //
+    // MessageText:
+    //
+    // Indicates that the specified image is already loaded.
+    //
+    #define STATUS_IMAGE_ALREADY_LOADED      ((NTSTATUS)0xC000010EL)
+
+usage: gen_status_table.py <input> <output> --namespace <name> [--prefix STATUS_ ...] [--exclude STATUS_SEVERITY_ ...]
+"""
+
+import argparse
+import os
+import re
+import sys
+
+PAGE_SIZE = 0x10000
+MAX_PAGE_LENGTH = 0xFFF0  # msvc rejects string literals of 64KiB and more
+LINE_LENGTH = 120
+VERIFY_CHUNK = 128  # entries per static_assert, keeps each evaluation below msvc's /constexpr:steps default
+
+DEFINE = re.compile(r'^#define\s+([A-Z_][A-Z0-9_]*)\s+(?:\(\s*\(\s*\w+\s*\)\s*)?(0x[0-9A-Fa-f]+|\d+)L?\s*\)?\s*$')
+
+
+def parse(path, prefixes, excludes):
+    """[(name, value, message)] in definition order."""
+    entries = []
+    message_id = None
+    message = None
+
+    with open(path, 'r', encoding='ascii') as source:
+        for line in source:
+            line = line.rstrip('\r\n')
+
+            if line.startswith('// MessageId:'):
+                message_id = line[len('// MessageId:'):].strip()
+                message = None
+                continue
+
+            if line.startswith('// MessageText:'):
+                message = []
+                continue
+
+            if message is not None and line.startswith('//'):
+                text = line[2:].strip()
+                if text:
+                    message.append(text)
+                continue
+
+            # winnt.h duplicates carry a trailing "// winnt" marker
+            match = DEFINE.match(line.split('//', 1)[0].rstrip())
+            if match is None:
+                continue
+
+            name, literal = match.group(1), match.group(2)
+            if not name.startswith(tuple(prefixes)) or name.startswith(tuple(excludes)):
+                continue
+
+            value = int(literal, 0) & 0xFFFFFFFF
+            text = ' '.join(message) if message is not None and message_id == name else ''
+            entries.append((name, value, text))
+
+            message_id = None
+            message = None
+
+    return entries
+
+
+class string_pool:
+    """Strings packed into pages that never straddle a page boundary, identical strings stored once."""
+
+    def __init__(self):
+        self.pages = [[]]
+        self.lengths = [0]
+        self.offsets = {}
+
+    def add(self, text):
+        if text in self.offsets:
+            return self.offsets[text]
+
+        data = text.encode('ascii')
+        if len(data) > MAX_PAGE_LENGTH:
+            raise ValueError('string too long for a pool page: %r' % text)
+
+        if self.lengths[-1] + len(data) > MAX_PAGE_LENGTH:
+            self.pages.append([])
+            self.lengths.append(0)
+
+        offset = (len(self.pages) - 1) * PAGE_SIZE + self.lengths[-1]
+        self.pages[-1].append(data)
+        self.lengths[-1] += len(data)
+        self.offsets[text] = offset
+
+        return offset
+
+
+def mix32(x):
+    x ^= x >> 16
+    x = (x * 0x85EBCA6B) & 0xFFFFFFFF
+    x ^= x >> 13
+    x = (x * 0xC2B2AE35) & 0xFFFFFFFF
+    x ^= x >> 16
+    return x
+
+
+def fnv1a(text):
+    h = 0x811C9DC5
+    for byte in text.encode('ascii'):
+        h = ((h ^ byte) * 0x01000193) & 0xFFFFFFFF
+    return h
+
+
+def slot_hash(key, seed):
+    return mix32(key ^ ((seed * 0x9E3779B9) & 0xFFFFFFFF))
+
+
+def next_power_of_two(value):
+    power = 1
+    while power < value:
+        power <<= 1
+    return power
+
+
+def build_perfect_hash(keys):
+    """keys: {key: entry index}, returns (bucket_bits, seeds, slots) for status_table::probe."""
+    bucket_count = next_power_of_two(max(len(keys) // 4, 1))
+    bucket_bits = bucket_count.bit_length() - 1
+    slot_count = next_power_of_two(len(keys) * 2)
+
+    buckets = [[] for _ in range(bucket_count)]
+    for key in keys:
+        buckets[mix32(key) >> (32 - bucket_bits)].append(key)
+
+    seeds = [0] * bucket_count
+    slots = [0xFFFF] * slot_count
+
+    # largest buckets first, they are the hardest to place
+    for bucket in sorted(range(bucket_count), key=lambda b: -len(buckets[b])):
+        if not buckets[bucket]:
+            continue
+
+        for seed in range(0xFFFF):
+            positions = [slot_hash(key, seed) & (slot_count - 1) for key in buckets[bucket]]
+
+            if len(set(positions)) == len(positions) and all(slots[p] == 0xFFFF for p in positions):
+                for key, position in zip(buckets[bucket], positions):
+                    slots[position] = keys[key]
+                seeds[bucket] = seed
+                break
+        else:
+            raise RuntimeError('no seed found for bucket %d' % bucket)
+
+    return bucket_bits, seeds, slots
+
+
+def escape(data):
+    out = []
+    for byte in data:
+        c = chr(byte)
+        if c in '\\"?':
+            out.append('\\' + c)
+        elif 0x20 <= byte < 0x7F:
+            out.append(c)
+        else:
+            out.append('\\%03o' % byte)
+    return ''.join(out)
+
+
+def emit_string(out, name, strings):
+    out.append('\t\tconstexpr const char %s[] =' % name)
+
+    line = ''
+    for data in strings:
+        line += escape(data)
+
+        if len(line) >= LINE_LENGTH:
+            out.append('\t\t\t"%s"' % line)
+            line = ''
+
+    out.append('\t\t\t"%s";' % line if line else '\t\t\t"";')
+    out.append('')
+
+
+def emit_array(out, type_name, name, values, per_line, width):
+    out.append('\t\tconstexpr %s %s[%d] = {' % (type_name, name, len(values)))
+
+    for i in range(0, len(values), per_line):
+        chunk = values[i:i + per_line]
+        out.append('\t\t\t' + ', '.join('0x%0*X' % (width, v) for v in chunk) + ',')
+
+    out.append('\t\t};')
+    out.append('')
+
+
+def generate(entries, namespace, source_name):
+    # sorted by value so ranges can be walked in order, stable so the first definition of a value wins
+    entries = sorted(entries, key=lambda entry: entry[1])
+
+    pool = string_pool()
+    records = []
+    codes = {}
+    names = {}
+
+    for index, (name, value, message) in enumerate(entries):
+        if len(name) > 0xFFFF or len(message) > 0xFFFF:
+            raise ValueError('string too long: %s' % name)
+
+        records.append((value, pool.add(name), pool.add(message), len(name), len(message)))
+        codes.setdefault(value, index)
+
+        key = fnv1a(name)
+        if key in names:
+            if entries[names[key]][0] == name:
+                raise ValueError('%s is defined twice' % name)
+            raise ValueError('name hash collision between %s and %s' % (entries[names[key]][0], name))
+        names[key] = index
+
+    if len(records) >= 0xFFFF:
+        raise ValueError('too many entries for 16 bits slots')
+
+    bucket_bits, seeds, slots = build_perfect_hash(codes)
+    name_bucket_bits, name_seeds, name_slots = build_perfect_hash(names)
+
+    out = []
+    out.append('#pragma once')
+    out.append('')
+    out.append('// generated by tools/gen_status_table.py from %s, do not edit' % source_name)
+    out.append('// %d entries, %d distinct codes' % (len(records), len(codes)))
+    out.append('')
+    out.append('#include <cstdint>')
+    out.append('')
+    out.append('#include "status_table.hpp"')
+    out.append('')
+    out.append('namespace %s {' % namespace)
+    out.append('')
+    out.append('\tnamespace detail {')
+    out.append('')
+
+    for index, page in enumerate(pool.pages):
+        emit_string(out, 'page_%d' % index, page)
+
+    out.append('\t\tconstexpr const char* pages[%d] = { %s };' % (len(pool.pages), ', '.join('page_%d' % i for i in range(len(pool.pages)))))
+    out.append('')
+
+    out.append('\t\tconstexpr status_table::entry_t entries[%d] = {' % len(records))
+    for (value, name, message, name_length, message_length), entry in zip(records, entries):
+        out.append('\t\t\t{ 0x%08X, 0x%06X, 0x%06X, %d, %d }, // %s' % (value, name, message, name_length, message_length, entry[0]))
+    out.append('\t\t};')
+    out.append('')
+
+    emit_array(out, 'std::uint16_t', 'code_seeds', seeds, 16, 4)
+    emit_array(out, 'std::uint16_t', 'code_slots', slots, 16, 4)
+    emit_array(out, 'std::uint16_t', 'name_seeds', name_seeds, 16, 4)
+    emit_array(out, 'std::uint16_t', 'name_slots', name_slots, 16, 4)
+
+    out.append('\t}')
+    out.append('')
+    out.append('\tconstexpr status_table::table_t table = {')
+    out.append('\t\tdetail::entries,')
+    out.append('\t\t%d,' % len(records))
+    out.append('\t\tdetail::pages,')
+    out.append('\t\t{ detail::code_seeds, %d, detail::code_slots, 0x%X },' % (bucket_bits, len(slots) - 1))
+    out.append('\t\t{ detail::name_seeds, %d, detail::name_slots, 0x%X },' % (name_bucket_bits, len(name_slots) - 1))
+    out.append('\t};')
+    out.append('')
+
+    for first in range(0, len(records), VERIFY_CHUNK):
+        out.append('\tstatic_assert(status_table::verify_codes(table, %d, %d), "%s: code hash does not reach every entry");' % (first, first + VERIFY_CHUNK, namespace))
+
+    for first in range(0, len(records), VERIFY_CHUNK):
+        out.append('\tstatic_assert(status_table::verify_names(table, %d, %d), "%s: name hash does not reach every entry");' % (first, first + VERIFY_CHUNK, namespace))
+
+    out.append('}')
+    out.append('')
+
+    return '\n'.join(out)
+
+
+def main():
+    parser = argparse.ArgumentParser(description='generate a constexpr status table from a message compiler header')
+    parser.add_argument('input')
+    parser.add_argument('output')
+    parser.add_argument('--namespace', required=True)
+    parser.add_argument('--prefix', action='append', default=[], help='only keep macros starting with this prefix (repeatable)')
+    parser.add_argument('--exclude', action='append', default=[], help='drop macros starting with this prefix (repeatable)')
+    args = parser.parse_args()
+
+    entries = parse(args.input, args.prefix or [''], args.exclude)
+    if not entries:
+        sys.exit('%s: no status definitions found' % args.input)
+
+    with open(args.output, 'w', encoding='ascii', newline='\n') as output:
+        output.write(generate(entries, args.namespace, os.path.basename(args.input)))
+
+
+if __name__ == '__main__':
+    main()
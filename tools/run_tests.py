@@ -0,0 +1,100 @@
+#!/usr/bin/env python3
+"""Builds and runs the drv-loader tests with a gcc or clang style compiler, and optionally the fuzz targets and benchmarks.
+
+drv-loader/main.cpp is built first with every warning as an error. Every tests/*.cpp is a test program, exiting with 0
+when all its checks pass. tests/fuzz/*.cpp are libFuzzer targets, built here as standalone programs feeding them
+generated inputs (see tests/fuzz/standalone.hpp). tests/bench/*.cpp print a table of timings.
+
+    python tools/run_tests.py
+    python tools/run_tests.py --fuzz-runs 100000 --sanitize address,undefined
+    python tools/run_tests.py --bench
+
+usage: run_tests.py [--cxx g++] [--filter text] [--fuzz-runs 0] [--bench] [--sanitize list] [--keep dir]
+"""
+
+import argparse
+import glob
+import os
+import subprocess
+import sys
+import tempfile
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+
+FLAGS = ['-std=c++17', '-O2', '-g', '-Wall', '-Wextra', '-Werror', '-pthread']
+
+# the headers hold static functions, main.cpp and each test only call some of them
+TEST_FLAGS = ['-Wno-unused-function']
+
+
+def build(cxx, source, output, flags):
+    include = ['-I' + os.path.join(ROOT, 'drv-loader', 'include'), '-I' + os.path.dirname(source)]
+    result = subprocess.run([cxx] + FLAGS + flags + include + [source, '-o', output], stdout=subprocess.PIPE, stderr=subprocess.STDOUT,
+                            universal_newlines=True)
+
+    if result.returncode != 0:
+        print(result.stdout)
+
+    return result.returncode == 0
+
+
+def run(binary, arguments):
+    result = subprocess.run([binary] + arguments, stdout=subprocess.PIPE, stderr=subprocess.STDOUT, universal_newlines=True)
+    return result.returncode == 0, result.stdout
+
+
+def main():
+    parser = argparse.ArgumentParser(description='build and run the drv-loader tests')
+    parser.add_argument('--cxx', default=os.environ.get('CXX', 'g++'))
+    parser.add_argument('--filter', default='', help='only programs whose file name contains this text')
+    parser.add_argument('--fuzz-runs', type=int, default=0, help='also run every fuzz target over this many generated inputs')
+    parser.add_argument('--bench', action='store_true', help='also run the benchmarks and print their tables')
+    parser.add_argument('--sanitize', help='comma separated -fsanitize list, e.g. address,undefined')
+    parser.add_argument('--keep', help='build into this directory instead of a temporary one')
+    args = parser.parse_args()
+
+    flags = TEST_FLAGS + (['-fsanitize=' + args.sanitize, '-fno-omit-frame-pointer'] if args.sanitize else [])
+
+    programs = [(source, []) for source in sorted(glob.glob(os.path.join(ROOT, 'tests', '*.cpp')))]
+    if args.fuzz_runs > 0:
+        programs += [(source, ['-runs=%d' % args.fuzz_runs]) for source in sorted(glob.glob(os.path.join(ROOT, 'tests', 'fuzz', '*.cpp')))]
+    if args.bench:
+        programs += [(source, []) for source in sorted(glob.glob(os.path.join(ROOT, 'tests', 'bench', '*.cpp')))]
+
+    programs = [(source, arguments) for source, arguments in programs if args.filter in os.path.basename(source)]
+    failures = 0
+    count = len(programs)
+
+    with tempfile.TemporaryDirectory() as directory:
+        directory = args.keep or directory
+        os.makedirs(directory, exist_ok=True)
+
+        if args.filter in 'main.cpp':
+            passed = build(args.cxx, os.path.join(ROOT, 'drv-loader', 'main.cpp'), os.path.join(directory, 'drvl'), TEST_FLAGS)
+            failures += not passed
+            count += 1
+            print('%-32s %s' % ('main.cpp', 'built' if passed else 'build failed'))
+
+        for source, arguments in programs:
+            name = os.path.relpath(source, os.path.join(ROOT, 'tests'))
+            binary = os.path.join(directory, os.path.splitext(os.path.basename(source))[0])
+
+            if not build(args.cxx, source, binary, flags):
+                print('%-32s build failed' % name)
+                failures += 1
+                continue
+
+            passed, output = run(binary, arguments)
+            failures += not passed
+
+            if not passed or name.startswith('bench'):
+                print(output.rstrip())
+
+            print('%-32s %s' % (name, 'passed' if passed else 'FAILED'))
+
+    print('%d of %d failed' % (failures, count))
+    return 1 if failures else 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
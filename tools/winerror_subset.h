@@ -0,0 +1,699 @@
+/*++
+
+Module Name:
+
+    winerror_subset.h
+
+Abstract:
+
+    Subset of the Win32 error codes of winerror.h in the message compiler
+    layout, the input of the drv-loader Win32 error table:
+
+        python tools/gen_status_table.py tools/winerror_subset.h drv-loader/include/win32_table.hpp --namespace win32_table
+
+    Covers the registry, service, privilege, loader and file system errors
+    drv-loader can report, plus every error ntstatus_win32.hpp translates to.
+    Messages are copied from winerror.h, keep the layout when adding codes.
+
+--*/
+
+//
+// MessageId: ERROR_SUCCESS
+//
+// MessageText:
+//
+// The operation completed successfully.
+//
+#define ERROR_SUCCESS                    0L
+
+//
+// MessageId: ERROR_INVALID_FUNCTION
+//
+// MessageText:
+//
+// Incorrect function.
+//
+#define ERROR_INVALID_FUNCTION           1L
+
+//
+// MessageId: ERROR_FILE_NOT_FOUND
+//
+// MessageText:
+//
+// The system cannot find the file specified.
+//
+#define ERROR_FILE_NOT_FOUND             2L
+
+//
+// MessageId: ERROR_PATH_NOT_FOUND
+//
+// MessageText:
+//
+// The system cannot find the path specified.
+//
+#define ERROR_PATH_NOT_FOUND             3L
+
+//
+// MessageId: ERROR_TOO_MANY_OPEN_FILES
+//
+// MessageText:
+//
+// The system cannot open the file.
+//
+#define ERROR_TOO_MANY_OPEN_FILES        4L
+
+//
+// MessageId: ERROR_ACCESS_DENIED
+//
+// MessageText:
+//
+// Access is denied.
+//
+#define ERROR_ACCESS_DENIED              5L
+
+//
+// MessageId: ERROR_INVALID_HANDLE
+//
+// MessageText:
+//
+// The handle is invalid.
+//
+#define ERROR_INVALID_HANDLE             6L
+
+//
+// MessageId: ERROR_NOT_ENOUGH_MEMORY
+//
+// MessageText:
+//
+// Not enough memory resources are available to process this command.
+//
+#define ERROR_NOT_ENOUGH_MEMORY          8L
+
+//
+// MessageId: ERROR_BAD_FORMAT
+//
+// MessageText:
+//
+// An attempt was made to load a program with an incorrect format.
+//
+#define ERROR_BAD_FORMAT                 11L
+
+//
+// MessageId: ERROR_INVALID_DATA
+//
+// MessageText:
+//
+// The data is invalid.
+//
+#define ERROR_INVALID_DATA               13L
+
+//
+// MessageId: ERROR_NOT_SAME_DEVICE
+//
+// MessageText:
+//
+// The system cannot move the file to a different disk drive.
+//
+#define ERROR_NOT_SAME_DEVICE            17L
+
+//
+// MessageId: ERROR_NO_MORE_FILES
+//
+// MessageText:
+//
+// There are no more files.
+//
+#define ERROR_NO_MORE_FILES              18L
+
+//
+// MessageId: ERROR_WRITE_PROTECT
+//
+// MessageText:
+//
+// The media is write protected.
+//
+#define ERROR_WRITE_PROTECT              19L
+
+//
+// MessageId: ERROR_NOT_READY
+//
+// MessageText:
+//
+// The device is not ready.
+//
+#define ERROR_NOT_READY                  21L
+
+//
+// MessageId: ERROR_BAD_COMMAND
+//
+// MessageText:
+//
+// The device does not recognize the command.
+//
+#define ERROR_BAD_COMMAND                22L
+
+//
+// MessageId: ERROR_BAD_LENGTH
+//
+// MessageText:
+//
+// The program issued a command but the command length is incorrect.
+//
+#define ERROR_BAD_LENGTH                 24L
+
+//
+// MessageId: ERROR_GEN_FAILURE
+//
+// MessageText:
+//
+// A device attached to the system is not functioning.
+//
+#define ERROR_GEN_FAILURE                31L
+
+//
+// MessageId: ERROR_SHARING_VIOLATION
+//
+// MessageText:
+//
+// The process cannot access the file because it is being used by another process.
+//
+#define ERROR_SHARING_VIOLATION          32L
+
+//
+// MessageId: ERROR_LOCK_VIOLATION
+//
+// MessageText:
+//
+// The process cannot access the file because another process has locked a portion of the file.
+//
+#define ERROR_LOCK_VIOLATION             33L
+
+//
+// MessageId: ERROR_HANDLE_EOF
+//
+// MessageText:
+//
+// Reached the end of the file.
+//
+#define ERROR_HANDLE_EOF                 38L
+
+//
+// MessageId: ERROR_NOT_SUPPORTED
+//
+// MessageText:
+//
+// The request is not supported.
+//
+#define ERROR_NOT_SUPPORTED              50L
+
+//
+// MessageId: ERROR_BAD_NETPATH
+//
+// MessageText:
+//
+// The network path was not found.
+//
+#define ERROR_BAD_NETPATH                53L
+
+//
+// MessageId: ERROR_DEV_NOT_EXIST
+//
+// MessageText:
+//
+// The specified network resource or device is no longer available.
+//
+#define ERROR_DEV_NOT_EXIST              55L
+
+//
+// MessageId: ERROR_INVALID_PARAMETER
+//
+// MessageText:
+//
+// The parameter is incorrect.
+//
+#define ERROR_INVALID_PARAMETER          87L
+
+//
+// MessageId: ERROR_BROKEN_PIPE
+//
+// MessageText:
+//
+// The pipe has been ended.
+//
+#define ERROR_BROKEN_PIPE                109L
+
+//
+// MessageId: ERROR_DISK_FULL
+//
+// MessageText:
+//
+// There is not enough space on the disk.
+//
+#define ERROR_DISK_FULL                  112L
+
+//
+// MessageId: ERROR_SEM_TIMEOUT
+//
+// MessageText:
+//
+// The semaphore timeout period has expired.
+//
+#define ERROR_SEM_TIMEOUT                121L
+
+//
+// MessageId: ERROR_INSUFFICIENT_BUFFER
+//
+// MessageText:
+//
+// The data area passed to a system call is too small.
+//
+#define ERROR_INSUFFICIENT_BUFFER        122L
+
+//
+// MessageId: ERROR_INVALID_NAME
+//
+// MessageText:
+//
+// The filename, directory name, or volume label syntax is incorrect.
+//
+#define ERROR_INVALID_NAME               123L
+
+//
+// MessageId: ERROR_MOD_NOT_FOUND
+//
+// MessageText:
+//
+// The specified module could not be found.
+//
+#define ERROR_MOD_NOT_FOUND              126L
+
+//
+// MessageId: ERROR_PROC_NOT_FOUND
+//
+// MessageText:
+//
+// The specified procedure could not be found.
+//
+#define ERROR_PROC_NOT_FOUND             127L
+
+//
+// MessageId: ERROR_BAD_PATHNAME
+//
+// MessageText:
+//
+// The specified path is invalid.
+//
+#define ERROR_BAD_PATHNAME               161L
+
+//
+// MessageId: ERROR_BUSY
+//
+// MessageText:
+//
+// The requested resource is in use.
+//
+#define ERROR_BUSY                       170L
+
+//
+// MessageId: ERROR_INVALID_ORDINAL
+//
+// MessageText:
+//
+// The operating system cannot run %1.
+//
+#define ERROR_INVALID_ORDINAL            182L
+
+//
+// MessageId: ERROR_ALREADY_EXISTS
+//
+// MessageText:
+//
+// Cannot create a file when that file already exists.
+//
+#define ERROR_ALREADY_EXISTS             183L
+
+//
+// MessageId: ERROR_BAD_EXE_FORMAT
+//
+// MessageText:
+//
+// %1 is not a valid Win32 application.
+//
+#define ERROR_BAD_EXE_FORMAT             193L
+
+//
+// MessageId: ERROR_FILENAME_EXCED_RANGE
+//
+// MessageText:
+//
+// The filename or extension is too long.
+//
+#define ERROR_FILENAME_EXCED_RANGE       206L
+
+//
+// MessageId: ERROR_EXE_MACHINE_TYPE_MISMATCH
+//
+// MessageText:
+//
+// The image file %1 is valid, but is for a machine type other than the current machine.
+//
+#define ERROR_EXE_MACHINE_TYPE_MISMATCH  216L
+
+//
+// MessageId: ERROR_MORE_DATA
+//
+// MessageText:
+//
+// More data is available.
+//
+#define ERROR_MORE_DATA                  234L
+
+//
+// MessageId: WAIT_TIMEOUT
+//
+// MessageText:
+//
+// The wait operation timed out.
+//
+#define WAIT_TIMEOUT                     258L
+
+//
+// MessageId: ERROR_NO_MORE_ITEMS
+//
+// MessageText:
+//
+// No more data is available.
+//
+#define ERROR_NO_MORE_ITEMS              259L
+
+//
+// MessageId: ERROR_DIRECTORY
+//
+// MessageText:
+//
+// The directory name is invalid.
+//
+#define ERROR_DIRECTORY                  267L
+
+//
+// MessageId: ERROR_MR_MID_NOT_FOUND
+//
+// MessageText:
+//
+// The system cannot find message text for message number 0x%1 in the message file for %2.
+//
+#define ERROR_MR_MID_NOT_FOUND           317L
+
+//
+// MessageId: ERROR_INVALID_ADDRESS
+//
+// MessageText:
+//
+// Attempt to access invalid address.
+//
+#define ERROR_INVALID_ADDRESS            487L
+
+//
+// MessageId: ERROR_ARITHMETIC_OVERFLOW
+//
+// MessageText:
+//
+// Arithmetic result exceeded 32 bits.
+//
+#define ERROR_ARITHMETIC_OVERFLOW        534L
+
+//
+// MessageId: ERROR_INVALID_IMAGE_HASH
+//
+// MessageText:
+//
+// Windows cannot verify the digital signature for this file. A recent hardware or software change
+// might have installed a file that is signed incorrectly or damaged, or that might be malicious
+// software from an unknown source.
+//
+#define ERROR_INVALID_IMAGE_HASH         577L
+
+//
+// MessageId: ERROR_IMAGE_NOT_AT_BASE
+//
+// MessageText:
+//
+// {Image Relocated} An image file could not be mapped at the address specified in the image file.
+// Local fixups must be performed on this image.
+//
+#define ERROR_IMAGE_NOT_AT_BASE          700L
+
+//
+// MessageId: ERROR_IMAGE_MACHINE_TYPE_MISMATCH
+//
+// MessageText:
+//
+// {Machine Type Mismatch} The image file %hs is valid, but is for a machine type other than the
+// current machine. Select OK to continue, or CANCEL to fail the DLL load.
+//
+#define ERROR_IMAGE_MACHINE_TYPE_MISMATCH 706L
+
+//
+// MessageId: ERROR_OPERATION_ABORTED
+//
+// MessageText:
+//
+// The I/O operation has been aborted because of either a thread exit or an application request.
+//
+#define ERROR_OPERATION_ABORTED          995L
+
+//
+// MessageId: ERROR_IO_PENDING
+//
+// MessageText:
+//
+// Overlapped I/O operation is in progress.
+//
+#define ERROR_IO_PENDING                 997L
+
+//
+// MessageId: ERROR_NOACCESS
+//
+// MessageText:
+//
+// Invalid access to memory location.
+//
+#define ERROR_NOACCESS                   998L
+
+//
+// MessageId: ERROR_FILE_INVALID
+//
+// MessageText:
+//
+// The volume for a file has been externally altered so that the opened file is no longer valid.
+//
+#define ERROR_FILE_INVALID               1006L
+
+//
+// MessageId: ERROR_NO_TOKEN
+//
+// MessageText:
+//
+// An attempt was made to reference a token that does not exist.
+//
+#define ERROR_NO_TOKEN                   1008L
+
+//
+// MessageId: ERROR_BADDB
+//
+// MessageText:
+//
+// The configuration registry database is corrupt.
+//
+#define ERROR_BADDB                      1009L
+
+//
+// MessageId: ERROR_BADKEY
+//
+// MessageText:
+//
+// The configuration registry key is invalid.
+//
+#define ERROR_BADKEY                     1010L
+
+//
+// MessageId: ERROR_CANTOPEN
+//
+// MessageText:
+//
+// The configuration registry key could not be opened.
+//
+#define ERROR_CANTOPEN                   1011L
+
+//
+// MessageId: ERROR_CANTREAD
+//
+// MessageText:
+//
+// The configuration registry key could not be read.
+//
+#define ERROR_CANTREAD                   1012L
+
+//
+// MessageId: ERROR_CANTWRITE
+//
+// MessageText:
+//
+// The configuration registry key could not be written.
+//
+#define ERROR_CANTWRITE                  1013L
+
+//
+// MessageId: ERROR_REGISTRY_IO_FAILED
+//
+// MessageText:
+//
+// An I/O operation initiated by the registry failed unrecoverably. The registry could not read in, or
+// write out, or flush, one of the files that contain the system's image of the registry.
+//
+#define ERROR_REGISTRY_IO_FAILED         1016L
+
+//
+// MessageId: ERROR_KEY_DELETED
+//
+// MessageText:
+//
+// Illegal operation attempted on a registry key that has been marked for deletion.
+//
+#define ERROR_KEY_DELETED                1018L
+
+//
+// MessageId: ERROR_CHILD_MUST_BE_VOLATILE
+//
+// MessageText:
+//
+// Cannot create a stable subkey under a volatile parent key.
+//
+#define ERROR_CHILD_MUST_BE_VOLATILE     1021L
+
+//
+// MessageId: ERROR_DEPENDENT_SERVICES_RUNNING
+//
+// MessageText:
+//
+// A stop control has been sent to a service that other running services are dependent on.
+//
+#define ERROR_DEPENDENT_SERVICES_RUNNING 1051L
+
+//
+// MessageId: ERROR_SERVICE_ALREADY_RUNNING
+//
+// MessageText:
+//
+// An instance of the service is already running.
+//
+#define ERROR_SERVICE_ALREADY_RUNNING    1056L
+
+//
+// MessageId: ERROR_SERVICE_DOES_NOT_EXIST
+//
+// MessageText:
+//
+// The specified service does not exist as an installed service.
+//
+#define ERROR_SERVICE_DOES_NOT_EXIST     1060L
+
+//
+// MessageId: ERROR_SERVICE_DEPENDENCY_FAIL
+//
+// MessageText:
+//
+// The dependency service or group failed to start.
+//
+#define ERROR_SERVICE_DEPENDENCY_FAIL    1068L
+
+//
+// MessageId: ERROR_SERVICE_MARKED_FOR_DELETE
+//
+// MessageText:
+//
+// The specified service has been marked for deletion.
+//
+#define ERROR_SERVICE_MARKED_FOR_DELETE  1072L
+
+//
+// MessageId: ERROR_NO_UNICODE_TRANSLATION
+//
+// MessageText:
+//
+// No mapping for the Unicode character exists in the target multi-byte code page.
+//
+#define ERROR_NO_UNICODE_TRANSLATION     1113L
+
+//
+// MessageId: ERROR_NOT_FOUND
+//
+// MessageText:
+//
+// Element not found.
+//
+#define ERROR_NOT_FOUND                  1168L
+
+//
+// MessageId: ERROR_DRIVER_BLOCKED
+//
+// MessageText:
+//
+// This driver has been blocked from loading
+//
+#define ERROR_DRIVER_BLOCKED             1275L
+
+//
+// MessageId: ERROR_NOT_ALL_ASSIGNED
+//
+// MessageText:
+//
+// Not all privileges or groups referenced are assigned to the caller.
+//
+#define ERROR_NOT_ALL_ASSIGNED           1300L
+
+//
+// MessageId: ERROR_NO_SUCH_PRIVILEGE
+//
+// MessageText:
+//
+// A specified privilege does not exist.
+//
+#define ERROR_NO_SUCH_PRIVILEGE          1313L
+
+//
+// MessageId: ERROR_PRIVILEGE_NOT_HELD
+//
+// MessageText:
+//
+// A required privilege is not held by the client.
+//
+#define ERROR_PRIVILEGE_NOT_HELD         1314L
+
+//
+// MessageId: ERROR_BAD_IMPERSONATION_LEVEL
+//
+// MessageText:
+//
+// Either a required impersonation level was not provided, or the provided impersonation level is
+// invalid.
+//
+#define ERROR_BAD_IMPERSONATION_LEVEL    1346L
+
+//
+// MessageId: ERROR_NO_SYSTEM_RESOURCES
+//
+// MessageText:
+//
+// Insufficient system resources exist to complete the requested service.
+//
+#define ERROR_NO_SYSTEM_RESOURCES        1450L
+
+//
+// MessageId: ERROR_INVALID_OPERATION
+//
+// MessageText:
+//
+// The operation identifier is not valid.
+//
+#define ERROR_INVALID_OPERATION          4317L